@@ -0,0 +1,1476 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       Benchmarks/m+mBenchmarks.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The driver for the performance benchmarks of the m+m common library.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <m+m/m+mBaseClient.hpp>
+#include <m+m/m+mBaseInputHandler.hpp>
+#include <m+m/m+mClientChannel.hpp>
+#include "m+mBlobRecording.hpp"
+
+#include <m+m/m+mGeneralChannel.hpp>
+#include <m+m/m+mMessageCompressor.hpp>
+#include <m+m/m+mStringBuffer.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <atomic>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The driver for the performance benchmarks of the m+m common library. */
+
+/*! @dir /Benchmarks
+ @brief The set of files that measure the performance of parts of the m+m framework. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The canonical name of the service used to measure scaling across instances. */
+static const char * kInstanceServiceName = "RandomNumber";
+
+/*! @brief The request used to measure scaling across instances. */
+static const char * kInstanceServiceRequest = "random";
+
+/*! @brief The default number of iterations for a benchmark. */
+static const int kDefaultIterations = 10000;
+
+/*! @brief The default number of random values to ask for in each request. */
+static const int kDefaultRandomCount = 1000;
+
+/*! @brief The default number of segments per subject in a synthetic frame. */
+static const int kDefaultSegmentCount = 20;
+
+/*! @brief The default number of subjects in a synthetic frame. */
+static const int kDefaultSubjectCount = 5;
+
+/*! @brief The default serialized size at which a batch of small messages is written. */
+static const int kDefaultBatchBytes = 1400;
+
+/*! @brief The default longest time, in milliseconds, that a small message can wait in a batch. */
+static const int kDefaultBatchDelay = 2;
+
+/*! @brief The default number of small messages to send with batching off and on. */
+static const int kDefaultBatchIterations = 100000;
+
+/*! @brief The default number of messages to send for each payload size and transport. */
+static const int kDefaultTransportIterations = 1000;
+
+/*! @brief The default number of requests that can be waiting for responses. */
+static const int kDefaultWindow = 16;
+
+/*! @brief The payload sizes used to compare transports. */
+static const int kTransportPayloadSizes[] = { 64, 4096, 1048576 };
+
+/*! @brief The carriers that are compared for connections on the same host. */
+static const char * kTransportCarriers[] = { "tcp", "shmem" };
+
+/*! @brief The default number of synthetic frames to compress, when there is no recording. */
+static const int kDefaultCompressionFrames = 1000;
+
+/*! @brief The default number of frames used to train a zstd dictionary. */
+static const int kDefaultDictionaryFrames = 100;
+
+/*! @brief The largest size of a zstd dictionary trained on the frames. */
+static const size_t kDictionaryCapacity = 16384;
+
+/*! @brief An input handler that counts the messages that arrive. */
+class CountingInputHandler : public BaseInputHandler
+{
+public :
+
+protected :
+
+private :
+
+    /*! @brief The class that this class is derived from. */
+    typedef BaseInputHandler inherited;
+
+public :
+
+    /*! @brief The constructor. */
+    CountingInputHandler(void);
+
+    /*! @brief The destructor. */
+    virtual
+    ~CountingInputHandler(void);
+
+    /*! @brief Return the number of messages that have arrived.
+     @returns The number of messages that have arrived. */
+    inline int
+    count(void)
+    const
+    {
+        return _count.load();
+    } // count
+
+    /*! @brief Process partially-structured input data.
+     @param[in] input The partially-structured input data.
+     @param[in] senderChannel The name of the channel used to send the input data.
+     @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+     @param[in] numBytes The number of bytes available on the connection.
+     @returns @c true if the input was correctly structured and successfully processed. */
+    virtual bool
+    handleInput(const yarp::os::Bottle &     input,
+                const YarpString &           senderChannel,
+                yarp::os::ConnectionWriter * replyMechanism,
+                const size_t                 numBytes);
+
+    /*! @brief Start counting again. */
+    inline void
+    resetCount(void)
+    {
+        _count = 0;
+    } // resetCount
+
+protected :
+
+private :
+
+    /*! @brief The copy constructor.
+     @param[in] other The object to be copied. */
+    CountingInputHandler(const CountingInputHandler & other);
+
+    /*! @brief The assignment operator.
+     @param[in] other The object to be copied.
+     @returns The updated object. */
+    CountingInputHandler &
+    operator =(const CountingInputHandler & other);
+
+public :
+
+protected :
+
+private :
+
+    /*! @brief The number of messages that have arrived. */
+    std::atomic<int> _count;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+    /*! @brief Filler to pad to alignment boundary */
+    char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+}; // CountingInputHandler
+
+/*! @brief An input handler that answers each message with a short reply. */
+class EchoInputHandler : public BaseInputHandler
+{
+public :
+
+protected :
+
+private :
+
+    /*! @brief The class that this class is derived from. */
+    typedef BaseInputHandler inherited;
+
+public :
+
+    /*! @brief The constructor. */
+    EchoInputHandler(void);
+
+    /*! @brief The destructor. */
+    virtual
+    ~EchoInputHandler(void);
+
+    /*! @brief Process partially-structured input data.
+     @param[in] input The partially-structured input data.
+     @param[in] senderChannel The name of the channel used to send the input data.
+     @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+     @param[in] numBytes The number of bytes available on the connection.
+     @returns @c true if the input was correctly structured and successfully processed. */
+    virtual bool
+    handleInput(const yarp::os::Bottle &     input,
+                const YarpString &           senderChannel,
+                yarp::os::ConnectionWriter * replyMechanism,
+                const size_t                 numBytes);
+
+protected :
+
+private :
+
+    /*! @brief The copy constructor.
+     @param[in] other The object to be copied. */
+    EchoInputHandler(const EchoInputHandler & other);
+
+    /*! @brief The assignment operator.
+     @param[in] other The object to be copied.
+     @returns The updated object. */
+    EchoInputHandler &
+    operator =(const EchoInputHandler & other);
+
+}; // EchoInputHandler
+
+/*! @brief A client that sends requests to the instances of a service without waiting for each
+ response. */
+class InstanceBenchmarkClient : public BaseClient
+{
+public :
+
+protected :
+
+private :
+
+    /*! @brief The class that this class is derived from. */
+    typedef BaseClient inherited;
+
+public :
+
+    /*! @brief The constructor. */
+    InstanceBenchmarkClient(void);
+
+    /*! @brief The destructor. */
+    virtual
+    ~InstanceBenchmarkClient(void);
+
+    /*! @brief Send a request for random values, without waiting for the response.
+     @param[in] count The number of random values to ask for.
+     @returns @c true if the request was sent and @c false otherwise. */
+    bool
+    sendRandomRequest(const int count);
+
+protected :
+
+private :
+
+    /*! @brief The copy constructor.
+     @param[in] other The object to be copied. */
+    InstanceBenchmarkClient(const InstanceBenchmarkClient & other);
+
+    /*! @brief The assignment operator.
+     @param[in] other The object to be copied.
+     @returns The updated object. */
+    InstanceBenchmarkClient &
+    operator =(const InstanceBenchmarkClient & other);
+
+}; // InstanceBenchmarkClient
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Receive the response to an asynchronous request.
+ @param[in] correlationId The identifier of the request.
+ @param[in] response The response to the request.
+ @param[in] responseStuff Private data for the function. */
+static void
+benchmarkResponseReceived(const int                correlationId,
+                          const yarp::os::Bottle & response,
+                          void *                   responseStuff)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(correlationId,response,responseStuff)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_LL1("correlationId = ", correlationId); //####
+    ODL_S1s("response = ", response.toString()); //####
+    ODL_P1("responseStuff = ", responseStuff); //####
+    // Only the arrival of the response is of interest.
+    ODL_EXIT(); //####
+} // benchmarkResponseReceived
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+/*! @brief Retrieve an optional positive integer argument.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the benchmark.
+ @param[in] index The position of the argument of interest.
+ @param[in] defaultValue The value to use if the argument is missing or invalid.
+ @returns The value of the argument or the default value. */
+static int
+getIntArgument(const int    argc,
+               char * *     argv,
+               const int    index,
+               const int    defaultValue)
+{
+    ODL_ENTER(); //####
+    ODL_LL2("argc = ", argc, "index = ", index); //####
+    ODL_P1("argv = ", argv); //####
+    int result = defaultValue;
+
+    if (index < argc)
+    {
+        const char * startPtr = argv[index];
+        char *       endPtr;
+        int          value = strtol(startPtr, &endPtr, 10);
+
+        if ((startPtr != endPtr) && (! *endPtr) && (0 < value))
+        {
+            result = value;
+        }
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // getIntArgument
+
+/*! @brief Report the results of a timed run.
+ @param[in] label The name of the variant that was measured.
+ @param[in] elapsed The elapsed time, in seconds.
+ @param[in] iterations The number of operations performed.
+ @param[in] numBytes The total number of bytes produced. */
+static void
+reportTiming(const char * label,
+             const double elapsed,
+             const int    iterations,
+             const double numBytes)
+{
+    ODL_ENTER(); //####
+    ODL_S1("label = ", label); //####
+    ODL_D2("elapsed = ", elapsed, "numBytes = ", numBytes); //####
+    ODL_LL1("iterations = ", iterations); //####
+    double perOperation = ((0 < iterations) ? ((elapsed * 1e6) / iterations) : 0);
+    double throughput = ((0 < elapsed) ? (numBytes / (elapsed * 1024 * 1024)) : 0);
+
+    cout << label << "\t" << iterations << " ops\t" << perOperation << " us/op\t" <<
+            throughput << " MB/s" << endl;
+    ODL_EXIT(); //####
+} // reportTiming
+
+/*! @brief Fill a message with a synthetic motion-capture frame.
+
+ The frame has the same shape as the output of the Vicon and OpenStage input services: a list of
+ subjects, each a dictionary of named segments holding a position and an orientation.
+ @param[out] frame The message to be filled in.
+ @param[in] numSubjects The number of subjects in the frame.
+ @param[in] numSegments The number of segments per subject. */
+static void
+buildSampleFrame(yarp::os::Bottle & frame,
+                 const int          numSubjects,
+                 const int          numSegments)
+{
+    ODL_ENTER(); //####
+    ODL_P1("frame = ", &frame); //####
+    ODL_LL2("numSubjects = ", numSubjects, "numSegments = ", numSegments); //####
+    frame.clear();
+    for (int ii = 0; numSubjects > ii; ++ii)
+    {
+        yarp::os::Bottle & subject = frame.addList();
+        std::stringstream  subjectName;
+
+        subjectName << "subject_" << ii;
+        subject.addString(subjectName.str().c_str());
+        yarp::os::Property & segments = subject.addDict();
+
+        for (int jj = 0; numSegments > jj; ++jj)
+        {
+            std::stringstream segmentName;
+            yarp::os::Bottle  segmentData;
+
+            segmentName << "segment \"" << jj << "\"";
+            for (int kk = 0; 7 > kk; ++kk)
+            {
+                segmentData.addDouble((yarp::os::Random::uniform() * 2000.0) - 1000.0);
+            }
+            segments.put(segmentName.str().c_str(),
+                         yarp::os::Value::makeList(segmentData.toString().c_str()));
+        }
+    }
+    ODL_EXIT(); //####
+} // buildSampleFrame
+
+static void
+legacyStreamValue(std::stringstream &     outBuffer,
+                  const yarp::os::Value & inputValue);
+
+/*! @brief Convert a YARP list into JSON using the original stream-based method.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] inputList The list to be processed. */
+static void
+legacyStreamList(std::stringstream &      outBuffer,
+                 const yarp::os::Bottle & inputList)
+{
+    yarp::os::Property asDict;
+
+    // The original code always built a dictionary to check the list.
+    ListIsReallyDictionary(inputList, asDict);
+    outBuffer << "[ ";
+    for (int ii = 0, mm = inputList.size(); mm > ii; ++ii)
+    {
+        yarp::os::Value aValue(inputList.get(ii));
+
+        if (0 < ii)
+        {
+            outBuffer << ", ";
+        }
+        legacyStreamValue(outBuffer, aValue);
+    }
+    outBuffer << " ]";
+} // legacyStreamList
+
+/*! @brief Convert a YARP value into JSON using the original stream-based method.
+
+ This is the conversion that was used before the bulk-append buffer and is kept only for
+ comparison.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] inputValue The value to be processed. */
+static void
+legacyStreamValue(std::stringstream &     outBuffer,
+                  const yarp::os::Value & inputValue)
+{
+    if (inputValue.isBool())
+    {
+        outBuffer << (inputValue.asBool() ? "true" : "false");
+    }
+    else if (inputValue.isInt())
+    {
+        outBuffer << inputValue.asInt();
+    }
+    else if (inputValue.isString() || inputValue.isDict())
+    {
+        YarpString value = (inputValue.isString() ? inputValue.asString() :
+                            inputValue.asDict()->toString());
+
+        outBuffer << '"';
+        for (size_t ii = 0, mm = value.length(); mm > ii; ++ii)
+        {
+            char aChar = value[ii];
+
+            if (('\\' == aChar) || ('"' == aChar) || ('/' == aChar))
+            {
+                outBuffer << kEscapeChar << aChar;
+            }
+            else
+            {
+                outBuffer << aChar;
+            }
+        }
+        outBuffer << '"';
+    }
+    else if (inputValue.isDouble())
+    {
+        outBuffer << inputValue.asDouble();
+    }
+    else if (inputValue.isList())
+    {
+        legacyStreamList(outBuffer, *inputValue.asList());
+    }
+    else
+    {
+        outBuffer << "null";
+    }
+} // legacyStreamValue
+
+static void
+legacyBufferValue(std::string &           outBuffer,
+                  const yarp::os::Value & inputValue);
+
+/*! @brief Convert a YARP list into JSON using the original character-at-a-time buffer method.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] inputList The list to be processed. */
+static void
+legacyBufferList(std::string &            outBuffer,
+                 const yarp::os::Bottle & inputList)
+{
+    yarp::os::Property asDict;
+
+    ListIsReallyDictionary(inputList, asDict);
+    outBuffer.append("[ ");
+    for (int ii = 0, mm = inputList.size(); mm > ii; ++ii)
+    {
+        yarp::os::Value aValue(inputList.get(ii));
+
+        if (0 < ii)
+        {
+            outBuffer.append(", ");
+        }
+        legacyBufferValue(outBuffer, aValue);
+    }
+    outBuffer.append(" ]");
+} // legacyBufferList
+
+/*! @brief Convert a YARP value into JSON using the original character-at-a-time buffer method.
+
+ Each character is appended individually and each floating-point value is formatted with
+ @c snprintf(), which is how the original custom string buffer was used.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] inputValue The value to be processed. */
+static void
+legacyBufferValue(std::string &           outBuffer,
+                  const yarp::os::Value & inputValue)
+{
+    char numBuff[100];
+
+    if (inputValue.isBool())
+    {
+        outBuffer.append(inputValue.asBool() ? "true" : "false");
+    }
+    else if (inputValue.isInt())
+    {
+        snprintf(numBuff, sizeof(numBuff), "%d", inputValue.asInt());
+        outBuffer.append(numBuff);
+    }
+    else if (inputValue.isString() || inputValue.isDict())
+    {
+        YarpString value = (inputValue.isString() ? inputValue.asString() :
+                            inputValue.asDict()->toString());
+
+        outBuffer.push_back('"');
+        for (size_t ii = 0, mm = value.length(); mm > ii; ++ii)
+        {
+            char aChar = value[ii];
+
+            if (('\\' == aChar) || ('"' == aChar) || ('/' == aChar))
+            {
+                outBuffer.push_back(kEscapeChar);
+            }
+            outBuffer.push_back(aChar);
+        }
+        outBuffer.push_back('"');
+    }
+    else if (inputValue.isDouble())
+    {
+        snprintf(numBuff, sizeof(numBuff), "%g", inputValue.asDouble());
+        outBuffer.append(numBuff);
+    }
+    else if (inputValue.isList())
+    {
+        legacyBufferList(outBuffer, *inputValue.asList());
+    }
+    else
+    {
+        outBuffer.append("null");
+    }
+} // legacyBufferValue
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+CountingInputHandler::CountingInputHandler(void) :
+    inherited(), _count(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // CountingInputHandler::CountingInputHandler
+
+CountingInputHandler::~CountingInputHandler(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // CountingInputHandler::~CountingInputHandler
+
+EchoInputHandler::EchoInputHandler(void) :
+    inherited()
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // EchoInputHandler::EchoInputHandler
+
+EchoInputHandler::~EchoInputHandler(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // EchoInputHandler::~EchoInputHandler
+
+InstanceBenchmarkClient::InstanceBenchmarkClient(void) :
+    inherited("benchmark_")
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // InstanceBenchmarkClient::InstanceBenchmarkClient
+
+InstanceBenchmarkClient::~InstanceBenchmarkClient(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // InstanceBenchmarkClient::~InstanceBenchmarkClient
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+CountingInputHandler::handleInput(const yarp::os::Bottle &     input,
+                                  const YarpString &           senderChannel,
+                                  yarp::os::ConnectionWriter * replyMechanism,
+                                  const size_t                 numBytes)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(input,senderChannel,replyMechanism,numBytes)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_LL1("numBytes = ", numBytes); //####
+    bool result = true;
+
+    ++_count;
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // CountingInputHandler::handleInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+EchoInputHandler::handleInput(const yarp::os::Bottle &     input,
+                              const YarpString &           senderChannel,
+                              yarp::os::ConnectionWriter * replyMechanism,
+                              const size_t                 numBytes)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(input,senderChannel)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_LL1("numBytes = ", numBytes); //####
+    bool result = true;
+
+    try
+    {
+        if (replyMechanism)
+        {
+            yarp::os::Bottle reply;
+
+            // Only the arrival of the message is of interest, so the reply is kept small.
+            reply.addInt(static_cast<int>(numBytes));
+            result = reply.write(*replyMechanism);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // EchoInputHandler::handleInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+bool
+InstanceBenchmarkClient::sendRandomRequest(const int count)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("count = ", count); //####
+    bool             result;
+    yarp::os::Bottle parameters;
+
+    parameters.addInt(count);
+    result = sendAsync(kInstanceServiceRequest, parameters, benchmarkResponseReceived);
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // InstanceBenchmarkClient::sendRandomRequest
+
+#if defined(__APPLE__)
+# pragma mark *** Benchmark 01 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Measure the cost of converting messages to JSON.
+
+ The optional arguments are the number of iterations, the number of subjects per frame and the
+ number of segments per subject.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the benchmark.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doBenchmarkConvertToJSON(const int argc,
+                         char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int                  iterations = getIntArgument(argc, argv, 0, kDefaultIterations);
+        int                  numSubjects = getIntArgument(argc, argv, 1, kDefaultSubjectCount);
+        int                  numSegments = getIntArgument(argc, argv, 2, kDefaultSegmentCount);
+        double               numBytes = 0;
+        double               startTime;
+        yarp::os::Bottle     frame;
+        std::string          legacyBuffer;
+#if defined(MpM_UseCustomStringBuffer)
+        Common::StringBuffer outBuffer;
+#else // ! defined(MpM_UseCustomStringBuffer)
+        std::stringstream    outBuffer;
+#endif // ! defined(MpM_UseCustomStringBuffer)
+
+        buildSampleFrame(frame, numSubjects, numSegments);
+        cout << "Frame of " << numSubjects << " subjects with " << numSegments <<
+                " segments each" << endl;
+        startTime = yarp::os::Time::now();
+        for (int ii = 0; iterations > ii; ++ii)
+        {
+            std::stringstream legacyStream;
+
+            legacyStream << "{ \"time\" : " << Utilities::GetCurrentTimeInMilliseconds() <<
+                            ", \"value\" : ";
+            legacyStreamList(legacyStream, frame);
+            legacyStream << " }\n";
+            numBytes += legacyStream.str().length();
+        }
+        reportTiming("legacy stringstream", yarp::os::Time::now() - startTime, iterations,
+                     numBytes);
+        numBytes = 0;
+        startTime = yarp::os::Time::now();
+        for (int ii = 0; iterations > ii; ++ii)
+        {
+            char numBuff[30];
+
+            legacyBuffer.clear();
+            legacyBuffer.append("{ \"time\" : ");
+            snprintf(numBuff, sizeof(numBuff), "%lld",
+                     static_cast<long long>(Utilities::GetCurrentTimeInMilliseconds()));
+            legacyBuffer.append(numBuff);
+            legacyBuffer.append(", \"value\" : ");
+            legacyBufferList(legacyBuffer, frame);
+            legacyBuffer.append(" }\n");
+            numBytes += legacyBuffer.length();
+        }
+        reportTiming("legacy char buffer", yarp::os::Time::now() - startTime, iterations,
+                     numBytes);
+        numBytes = 0;
+        startTime = yarp::os::Time::now();
+        for (int ii = 0; iterations > ii; ++ii)
+        {
+            Utilities::ConvertMessageToJSON(outBuffer, frame);
+#if defined(MpM_UseCustomStringBuffer)
+            numBytes += outBuffer.length();
+#else // ! defined(MpM_UseCustomStringBuffer)
+            numBytes += outBuffer.str().length();
+#endif // ! defined(MpM_UseCustomStringBuffer)
+        }
+        reportTiming("ConvertMessageToJSON", yarp::os::Time::now() - startTime, iterations,
+                     numBytes);
+        result = 0;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doBenchmarkConvertToJSON
+
+#if defined(__APPLE__)
+# pragma mark *** Benchmark 02 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Measure the rate of requests as they are spread across more instances of a service.
+
+ Several instances of the Random Number service, with different tags, must be running. The rate
+ is measured for each number of instances, from one to all of them, and for each routing policy.
+ The optional arguments are the number of requests, the largest number of requests that can be
+ waiting for responses and the number of random values to ask for in each request.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the benchmark.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doBenchmarkInstanceScaling(const int argc,
+                           char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        if (Utilities::CheckForValidNetwork())
+        {
+            yarp::os::Network yarp; // This is necessary to establish any connections to the
+                                    // YARP infrastructure
+
+            if (Utilities::CheckForRegistryService())
+            {
+                int              iterations = getIntArgument(argc, argv, 0, kDefaultIterations);
+                int              window = getIntArgument(argc, argv, 1, kDefaultWindow);
+                int              randomCount = getIntArgument(argc, argv, 2, kDefaultRandomCount);
+                YarpStringVector channels;
+
+                if (Utilities::GetServiceInstances(kInstanceServiceName, channels,
+                                                   STANDARD_WAIT_TIME_) && (0 < channels.size()))
+                {
+                    static const InstanceRoutingPolicy policies[] =
+                    {
+                        kInstanceRoutingRoundRobin,
+                        kInstanceRoutingLeastOutstanding
+                    };
+                    static const char *                policyNames[] =
+                    {
+                        "round-robin",
+                        "least-outstanding"
+                    };
+                    static const size_t                numPolicies = (sizeof(policies) /
+                                                                      sizeof(*policies));
+                    bool                               okSoFar = true;
+
+                    cout << channels.size() << " instances of " << kInstanceServiceName <<
+                            ", window of " << window << " requests" << endl;
+                    for (size_t ii = 1, mm = channels.size(); okSoFar && (mm >= ii); ++ii)
+                    {
+                        for (size_t jj = 0; okSoFar && (numPolicies > jj); ++jj)
+                        {
+                            InstanceBenchmarkClient aClient;
+
+                            okSoFar = (aClient.findServiceInstances(kInstanceServiceName,
+                                                                    policies[jj], ii) &&
+                                       aClient.connectToService());
+                            if (okSoFar)
+                            {
+                                std::stringstream label;
+                                double            startTime = yarp::os::Time::now();
+
+                                for (int kk = 0; okSoFar && (iterations > kk); ++kk)
+                                {
+                                    // Wait for room in the window before sending the next
+                                    // request.
+                                    okSoFar = (aClient.waitForAsyncRequests(window - 1,
+                                                                            STANDARD_WAIT_TIME_)
+                                               && aClient.sendRandomRequest(randomCount));
+                                }
+                                if (okSoFar)
+                                {
+                                    okSoFar = aClient.waitForAsyncRequests(0,
+                                                                           STANDARD_WAIT_TIME_);
+                                }
+                                label << aClient.instanceCount() << " instances, " <<
+                                        policyNames[jj];
+                                reportTiming(label.str().c_str(),
+                                             yarp::os::Time::now() - startTime, iterations, 0);
+                                aClient.disconnectFromService();
+                            }
+                        }
+                    }
+                    if (okSoFar)
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        cerr << "Problem communicating with the service instances" << endl;
+                    }
+                }
+                else
+                {
+                    cerr << "No instances of the " << kInstanceServiceName <<
+                            " service were found" << endl;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (Utilities::CheckForRegistryService())"); //####
+                MpM_FAIL_(MSG_REGISTRY_NOT_RUNNING);
+            }
+        }
+        else
+        {
+            ODL_LOG("! (Utilities::CheckForValidNetwork())"); //####
+            MpM_FAIL_(MSG_YARP_NOT_RUNNING);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doBenchmarkInstanceScaling
+
+#if defined(__APPLE__)
+# pragma mark *** Benchmark 03 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Compare the latency and throughput of TCP and shared memory connections between two
+ channels on the same host.
+
+ Each message carries a binary payload and is answered with a short reply, so the time per
+ operation is the round-trip latency. The optional argument is the number of messages to send for
+ each payload size and carrier.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the benchmark.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doBenchmarkTransports(const int argc,
+                      char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        if (Utilities::CheckForValidNetwork())
+        {
+            yarp::os::Network yarp; // This is necessary to establish any connections to the
+                                    // YARP infrastructure
+            int               iterations = getIntArgument(argc, argv, 0,
+                                                          kDefaultTransportIterations);
+            EchoInputHandler  handler;
+            ClientChannel     sender;
+            GeneralChannel    receiver(false);
+            YarpString        receiverName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                        BUILD_NAME_("receiver_",
+                                                                    DEFAULT_CHANNEL_ROOT_)));
+            YarpString        senderName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                              BUILD_NAME_("sender_",
+                                                                  DEFAULT_CHANNEL_ROOT_)));
+
+            receiver.setReader(handler);
+            if (receiver.openWithRetries(receiverName, STANDARD_WAIT_TIME_) &&
+                sender.openWithRetries(senderName, STANDARD_WAIT_TIME_))
+            {
+                static const size_t numCarriers = (sizeof(kTransportCarriers) /
+                                                   sizeof(*kTransportCarriers));
+                static const size_t numSizes = (sizeof(kTransportPayloadSizes) /
+                                                sizeof(*kTransportPayloadSizes));
+                bool                okSoFar = true;
+                std::string         payload(kTransportPayloadSizes[numSizes - 1], 'x');
+
+                for (size_t ii = 0; okSoFar && (numCarriers > ii); ++ii)
+                {
+                    const char * carrier = kTransportCarriers[ii];
+
+                    if (yarp::os::Network::connect(senderName, receiverName, carrier, true))
+                    {
+                        for (size_t jj = 0; okSoFar && (numSizes > jj); ++jj)
+                        {
+                            int               payloadSize = kTransportPayloadSizes[jj];
+                            double            startTime;
+                            std::stringstream label;
+                            yarp::os::Bottle  message;
+
+                            message.add(yarp::os::Value(&payload[0], payloadSize));
+                            startTime = yarp::os::Time::now();
+                            for (int kk = 0; okSoFar && (iterations > kk); ++kk)
+                            {
+                                yarp::os::Bottle reply;
+
+                                okSoFar = sender.writeBottle(message, reply);
+                            }
+                            label << carrier << ", " << payloadSize << " bytes";
+                            reportTiming(label.str().c_str(), yarp::os::Time::now() - startTime,
+                                         iterations,
+                                         static_cast<double>(payloadSize) * iterations);
+                        }
+                        yarp::os::Network::disconnect(senderName, receiverName, true);
+                    }
+                    else
+                    {
+                        // The shared memory carrier might not be part of this YARP build.
+                        cerr << "Could not connect using " << carrier << endl;
+                    }
+                }
+                if (okSoFar)
+                {
+                    result = 0;
+                }
+                else
+                {
+                    cerr << "Problem sending to the receiving channel" << endl;
+                }
+            }
+            else
+            {
+                cerr << "Could not open the benchmark channels" << endl;
+            }
+#if defined(MpM_DoExplicitClose)
+            sender.close();
+            receiver.close();
+#endif // defined(MpM_DoExplicitClose)
+        }
+        else
+        {
+            ODL_LOG("! (Utilities::CheckForValidNetwork())"); //####
+            MpM_FAIL_(MSG_YARP_NOT_RUNNING);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doBenchmarkTransports
+
+#if defined(__APPLE__)
+# pragma mark *** Benchmark 04 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Compare the throughput of small messages written on their own and in batches.
+
+ Each message has the shape of a finger-tip sample: an index and a position. The time per
+ operation covers writing the message and its arrival at the input handler. The optional
+ arguments are the number of messages, the serialized size at which a batch is written and the
+ longest time, in milliseconds, that a message can wait in a batch.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the benchmark.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doBenchmarkBatching(const int argc,
+                    char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        if (Utilities::CheckForValidNetwork())
+        {
+            yarp::os::Network    yarp; // This is necessary to establish any connections to the
+                                       // YARP infrastructure
+            int                  iterations = getIntArgument(argc, argv, 0,
+                                                             kDefaultBatchIterations);
+            int                  batchBytes = getIntArgument(argc, argv, 1, kDefaultBatchBytes);
+            int                  batchDelay = getIntArgument(argc, argv, 2, kDefaultBatchDelay);
+            CountingInputHandler handler;
+            GeneralChannel       receiver(false);
+            GeneralChannel       sender(true);
+            YarpString           receiverName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                            BUILD_NAME_("receiver_",
+                                                                        DEFAULT_CHANNEL_ROOT_)));
+            YarpString           senderName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                                 BUILD_NAME_("sender_",
+                                                                     DEFAULT_CHANNEL_ROOT_)));
+
+            receiver.setReader(handler);
+            if (receiver.openWithRetries(receiverName, STANDARD_WAIT_TIME_) &&
+                sender.openWithRetries(senderName, STANDARD_WAIT_TIME_) &&
+                yarp::os::Network::connect(senderName, receiverName, "tcp", true))
+            {
+                bool okSoFar = true;
+
+                for (int ii = 0; okSoFar && (2 > ii); ++ii)
+                {
+                    bool             batched = (1 == ii);
+                    double           startTime;
+                    size_t           messageSize;
+                    yarp::os::Bottle message;
+
+                    message.addInt(0);
+                    message.addDouble(0);
+                    message.addDouble(0);
+                    message.addDouble(0);
+                    message.toBinary(&messageSize);
+                    if (batched)
+                    {
+                        okSoFar = sender.setBatching(batchBytes, batchDelay / 1000.0);
+                    }
+                    handler.resetCount();
+                    startTime = yarp::os::Time::now();
+                    for (int jj = 0; okSoFar && (iterations > jj); ++jj)
+                    {
+                        message.get(0) = yarp::os::Value(jj);
+                        message.get(1) = yarp::os::Value(jj * 0.5);
+                        okSoFar = sender.write(message);
+                    }
+                    // Wait for the last messages to arrive, allowing for the ones that are lost
+                    // when the receiver falls behind.
+                    for (int lastCount = -1; okSoFar && (iterations > handler.count()) &&
+                         (lastCount != handler.count()); )
+                    {
+                        lastCount = handler.count();
+                        yarp::os::Time::delay(0.1);
+                    }
+                    reportTiming(batched ? "batched" : "unbatched",
+                                 yarp::os::Time::now() - startTime, handler.count(),
+                                 static_cast<double>(messageSize) * handler.count());
+                    if (handler.count() < iterations)
+                    {
+                        cout << (iterations - handler.count()) << " messages did not arrive" <<
+                                endl;
+                    }
+                }
+                sender.setBatching(0, 0);
+                yarp::os::Network::disconnect(senderName, receiverName, true);
+                if (okSoFar)
+                {
+                    result = 0;
+                }
+                else
+                {
+                    cerr << "Problem sending to the receiving channel" << endl;
+                }
+            }
+            else
+            {
+                cerr << "Could not open and connect the benchmark channels" << endl;
+            }
+#if defined(MpM_DoExplicitClose)
+            sender.close();
+            receiver.close();
+#endif // defined(MpM_DoExplicitClose)
+        }
+        else
+        {
+            ODL_LOG("! (Utilities::CheckForValidNetwork())"); //####
+            MpM_FAIL_(MSG_YARP_NOT_RUNNING);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doBenchmarkBatching
+
+#if defined(__APPLE__)
+# pragma mark *** Benchmark 05 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Measure the processor time used by compression and the number of bytes that it saves.
+
+ The frames are the blobs in a recording made by the Record Blob output service or, if the first
+ argument is '-' or is missing, synthetic motion-capture frames. LZ4, zstd and zstd with a
+ dictionary trained on the first frames are compared. The optional arguments are the path to
+ the recording and the number of frames used to train the dictionary.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the benchmark.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doBenchmarkCompression(const int argc,
+                       char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        if (MessageCompressor::IsAvailable())
+        {
+            YarpString                      recordingPath((0 < argc) ? argv[0] : "-");
+            int                             trainingFrames = getIntArgument(argc, argv, 1,
+                                                                kDefaultDictionaryFrames);
+            bool                            okSoFar = true;
+            std::vector<yarp::os::Bottle>   frames;
+            YarpString                      dictionary;
+            YarpStringVector                samples;
+            RecordBlob::BlobRecordingReader recording;
+
+            if (recordingPath == "-")
+            {
+                for (int ii = 0; kDefaultCompressionFrames > ii; ++ii)
+                {
+                    yarp::os::Bottle aFrame;
+
+                    buildSampleFrame(aFrame, kDefaultSubjectCount, kDefaultSegmentCount);
+                    frames.push_back(aFrame);
+                }
+                cout << "Synthetic frames of " << kDefaultSubjectCount << " subjects with " <<
+                        kDefaultSegmentCount << " segments each" << endl;
+            }
+            else if (recording.open(recordingPath))
+            {
+                for (size_t ii = 0, mm = recording.count(); mm > ii; ++ii)
+                {
+                    const char * data;
+                    int64_t      timeStamp;
+                    size_t       length;
+
+                    if (recording.getRecord(ii, timeStamp, data, length))
+                    {
+                        yarp::os::Bottle aFrame;
+
+                        aFrame.add(yarp::os::Value(const_cast<char *>(data),
+                                                   static_cast<int>(length)));
+                        frames.push_back(aFrame);
+                    }
+                }
+                recording.close();
+                cout << "Recorded frames from " << recordingPath.c_str() << endl;
+            }
+            else
+            {
+                cerr << "Could not open the recording " << recordingPath.c_str() << endl;
+                okSoFar = false;
+            }
+            if (okSoFar && (0 < frames.size()))
+            {
+                for (size_t ii = 0, mm = frames.size();
+                     (mm > ii) && (static_cast<size_t>(trainingFrames) > ii); ++ii)
+                {
+                    size_t       length;
+                    const char * bytes = frames[ii].toBinary(&length);
+
+                    samples.push_back(YarpString(bytes, length));
+                }
+                if (! MessageCompressor::TrainDictionary(samples, kDictionaryCapacity,
+                                                         dictionary))
+                {
+                    cout << "Could not train a dictionary on " << samples.size() << " frames" <<
+                            endl;
+                }
+                for (int ii = 0; okSoFar && (3 > ii); ++ii)
+                {
+                    bool                          useDictionary = (2 == ii);
+                    const char *                  label = ((0 == ii) ? "lz4" :
+                                                           (useDictionary ? "zstd dictionary" :
+                                                            "zstd"));
+                    CompressionMethod             method = ((0 == ii) ? kCompressionMethodLZ4 :
+                                                            kCompressionMethodZstd);
+                    double                        compressedBytes = 0;
+                    double                        uncompressedBytes = 0;
+                    double                        startTime;
+                    int                           compressedCount = 0;
+                    MessageCompressor             compressor(method, 0);
+                    std::vector<yarp::os::Bottle> compressed(frames.size());
+
+                    if (useDictionary && (0 == dictionary.length()))
+                    {
+                        cout << label << "\tskipped" << endl;
+                    }
+                    else if (compressor.open(useDictionary ? dictionary : ""))
+                    {
+                        startTime = yarp::os::Time::now();
+                        for (size_t jj = 0, mm = frames.size(); mm > jj; ++jj)
+                        {
+                            size_t uncompressedSize;
+
+                            if (compressor.compress(frames[jj], compressed[jj], uncompressedSize))
+                            {
+                                ++compressedCount;
+                            }
+                            uncompressedBytes += uncompressedSize;
+                        }
+                        reportTiming(label, yarp::os::Time::now() - startTime,
+                                     static_cast<int>(frames.size()), uncompressedBytes);
+                        startTime = yarp::os::Time::now();
+                        for (size_t jj = 0, mm = frames.size(); okSoFar && (mm > jj); ++jj)
+                        {
+                            if (MessageCompressor::IsCompressed(compressed[jj]))
+                            {
+                                size_t           uncompressedSize;
+                                yarp::os::Bottle restored;
+
+                                okSoFar = MessageCompressor::Decompress(compressed[jj], restored,
+                                                                        uncompressedSize);
+                            }
+                        }
+                        reportTiming("restore", yarp::os::Time::now() - startTime,
+                                     compressedCount, uncompressedBytes);
+                        // Frames that did not shrink are sent as they are.
+                        for (size_t jj = 0, mm = frames.size(); mm > jj; ++jj)
+                        {
+                            size_t length;
+
+                            if (MessageCompressor::IsCompressed(compressed[jj]))
+                            {
+                                compressed[jj].toBinary(&length);
+                            }
+                            else
+                            {
+                                frames[jj].toBinary(&length);
+                            }
+                            compressedBytes += length;
+                        }
+                        cout << label << "\t" << compressedCount << " of " << frames.size() <<
+                                " compressed\t" << uncompressedBytes << " bytes\t" <<
+                                compressedBytes << " sent\t" <<
+                                ((100.0 * (uncompressedBytes - compressedBytes)) /
+                                 uncompressedBytes) << "% saved" << endl;
+                    }
+                    else
+                    {
+                        cerr << "Could not prepare the " << label << " compressor" << endl;
+                        okSoFar = false;
+                    }
+                }
+                if (okSoFar)
+                {
+                    result = 0;
+                }
+                else
+                {
+                    cerr << "Problem compressing or restoring the frames" << endl;
+                }
+            }
+            else if (okSoFar)
+            {
+                cerr << "There are no frames in the recording" << endl;
+            }
+        }
+        else
+        {
+            cerr << "m+m was built without message compression" << endl;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doBenchmarkCompression
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for the performance benchmarks of the m+m common classes.
+
+ The first argument is the benchmark number and the remaining arguments are specific to the
+ benchmark being run. Timing results are written to standard output.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the benchmarks.
+ @returns @c 0 on a successful run and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        Initialize(progName);
+        if (0 < --argc)
+        {
+            const char * startPtr = argv[1];
+            char *       endPtr;
+            int          selector = strtol(startPtr, &endPtr, 10);
+
+            if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+            {
+                switch (selector)
+                {
+                    case 1 :
+                        result = doBenchmarkConvertToJSON(argc - 1, argv + 2);
+                        break;
+
+                    case 2 :
+                        result = doBenchmarkInstanceScaling(argc - 1, argv + 2);
+                        break;
+
+                    case 3 :
+                        result = doBenchmarkTransports(argc - 1, argv + 2);
+                        break;
+
+                    case 4 :
+                        result = doBenchmarkBatching(argc - 1, argv + 2);
+                        break;
+
+                    case 5 :
+                        result = doBenchmarkCompression(argc - 1, argv + 2);
+                        break;
+
+                    default :
+                        cerr << "Unknown benchmark " << selector << endl;
+                        break;
+
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 < --argc)"); //####
+            cerr << "Usage: " << progName.c_str() << " benchmark-number [arguments]" << endl;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    yarp::os::Network::fini();
+    ODL_EXIT_L(result); //####
+    return result;
+} // main
@@ -0,0 +1,753 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mBlobRecording.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definitions for reading and writing recordings of binary blobs.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mBlobRecording.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if MAC_OR_LINUX_
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#else // ! MAC_OR_LINUX_
+# include <io.h>
+# include <windows.h>
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definitions for reading and writing recordings of binary blobs. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::RecordBlob;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The bytes at the start of a recording. */
+static const char kFileMagic[] = "MpMBLB01";
+
+/*! @brief The bytes at the end of a recording that was closed properly. */
+static const char kTrailerMagic[] = "MpMBLBFT";
+
+/*! @brief The number of bytes in the magic values. */
+static const size_t kMagicLength = sizeof(kFileMagic) - 1;
+
+/*! @brief The number of bytes in the file header; the magic value, the index interval and a
+ reserved field. */
+static const size_t kFileHeaderLength = kMagicLength + 4 + 4;
+
+/*! @brief The number of bytes in the trailer; the offset of the footer and the magic value. */
+static const size_t kTrailerLength = 8 + kMagicLength;
+
+/*! @brief The number of bytes in a record header; the marker, the length of the blob and the time
+ at which it was received. */
+static const size_t kRecordHeaderLength = 4 + 4 + 8;
+
+/*! @brief The number of bytes in an index block header; the marker and the number of entries. */
+static const size_t kIndexHeaderLength = 4 + 4;
+
+/*! @brief The number of bytes in an index block entry; the time and the offset of a record. */
+static const size_t kIndexEntryLength = 8 + 8;
+
+/*! @brief The number of bytes in the footer header; the marker, the number of index blocks and
+ the number of records. */
+static const size_t kFooterHeaderLength = 4 + 4 + 8;
+
+/*! @brief The marker at the start of a record ('BREC'). */
+static const uint32_t kRecordMarker = 0x43455242;
+
+/*! @brief The marker at the start of an index block ('BIDX'). */
+static const uint32_t kIndexMarker = 0x58444942;
+
+/*! @brief The marker at the start of the footer ('BFTR'). */
+static const uint32_t kFooterMarker = 0x52544642;
+
+/*! @brief The number of records between index blocks. */
+static const size_t kIndexInterval = 1024;
+
+/*! @brief The number of bytes written after which an index block is added, even if there are fewer
+ than the usual number of records since the previous index block. */
+static const size_t kIndexByteInterval = 4 * 1024 * 1024;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Add a 32-bit value to a byte string, least significant byte first.
+ @param[in,out] output The byte string to be added to.
+ @param[in] value The value to be added. */
+static void
+appendFixed32(std::string &  output,
+              const uint32_t value)
+{
+    for (int ii = 0; ii < 4; ++ii)
+    {
+        output += static_cast<char>((value >> (8 * ii)) & 0x00FF);
+    }
+} // appendFixed32
+
+/*! @brief Add a 64-bit value to a byte string, least significant byte first.
+ @param[in,out] output The byte string to be added to.
+ @param[in] value The value to be added. */
+static void
+appendFixed64(std::string &  output,
+              const uint64_t value)
+{
+    for (int ii = 0; ii < 8; ++ii)
+    {
+        output += static_cast<char>((value >> (8 * ii)) & 0x00FF);
+    }
+} // appendFixed64
+
+/*! @brief Retrieve a 32-bit value stored least significant byte first.
+ @param[in] data The bytes holding the value.
+ @returns The value. */
+static uint32_t
+readFixed32(const uint8_t * data)
+{
+    return (static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+            (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24));
+} // readFixed32
+
+/*! @brief Retrieve a 64-bit value stored least significant byte first.
+ @param[in] data The bytes holding the value.
+ @returns The value. */
+static uint64_t
+readFixed64(const uint8_t * data)
+{
+    uint64_t result = 0;
+
+    for (int ii = 7; ii >= 0; --ii)
+    {
+        result = (result << 8) | data[ii];
+    }
+    return result;
+} // readFixed64
+
+/*! @brief Discard the end of a file and position the file at its new end.
+ @param[in] aFile The file to be shortened.
+ @param[in] newSize The new size of the file.
+ @returns @c true if the file was shortened and @c false otherwise. */
+static bool
+truncateFile(FILE *         aFile,
+             const uint64_t newSize)
+{
+    fflush(aFile);
+#if MAC_OR_LINUX_
+    return ((0 == ftruncate(fileno(aFile), static_cast<off_t>(newSize))) &&
+            (0 == fseeko(aFile, static_cast<off_t>(newSize), SEEK_SET)));
+#else // ! MAC_OR_LINUX_
+    return ((0 == _chsize_s(_fileno(aFile), newSize)) &&
+            (0 == _fseeki64(aFile, newSize, SEEK_SET)));
+#endif // ! MAC_OR_LINUX_
+} // truncateFile
+
+/*! @brief Compare the times of two record locations.
+ @param[in] entry The record location to be compared.
+ @param[in] timeStamp The time to be compared with.
+ @returns @c true if the record was received before the time and @c false otherwise. */
+static bool
+recordIsEarlier(const BlobRecordingEntry & entry,
+                const int64_t              timeStamp)
+{
+    return (entry._timeStamp < timeStamp);
+} // recordIsEarlier
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+BlobRecordingWriter::BlobRecordingWriter(void) :
+    _lock(), _pending(), _blockOffsets(), _outFile(NULL), _lastTime(0), _position(0),
+    _numRecords(0), _bytesSinceIndex(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // BlobRecordingWriter::BlobRecordingWriter
+
+BlobRecordingWriter::~BlobRecordingWriter(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    ODL_OBJEXIT(); //####
+} // BlobRecordingWriter::~BlobRecordingWriter
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+BlobRecordingWriter::addRecord(const int64_t timeStamp,
+                               const void *  data,
+                               const size_t  length)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("timeStamp = ", timeStamp, "length = ", length); //####
+    ODL_P1("data = ", data); //####
+    bool okSoFar = false;
+
+    _lock.lock();
+    if (_outFile && data && (0 < length) && (0xFFFFFFFF >= length))
+    {
+        std::string        header;
+        BlobRecordingEntry entry;
+
+        // Keep the records in time order, so that the index can be searched.
+        entry._timeStamp = std::max(timeStamp, _lastTime);
+        entry._offset = _position;
+        appendFixed32(header, kRecordMarker);
+        appendFixed32(header, static_cast<uint32_t>(length));
+        appendFixed64(header, static_cast<uint64_t>(entry._timeStamp));
+        if (writeBytes(header.data(), header.length()))
+        {
+            if (writeBytes(data, length))
+            {
+                _pending.push_back(entry);
+                _lastTime = entry._timeStamp;
+                ++_numRecords;
+                _bytesSinceIndex += header.length() + length;
+                okSoFar = true;
+                if ((kIndexInterval <= _pending.size()) ||
+                    (kIndexByteInterval <= _bytesSinceIndex))
+                {
+                    writeIndexBlock();
+                }
+            }
+            else
+            {
+                ODL_LOG("! (writeBytes(data, length))"); //####
+                // Drop the header, so that the recording stays readable.
+                _position = entry._offset;
+                truncateFile(_outFile, _position);
+            }
+        }
+        else
+        {
+            ODL_LOG("! (writeBytes(header.data(), header.length()))"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (_outFile && data && (0 < length) && (0xFFFFFFFF >= length))"); //####
+    }
+    _lock.unlock();
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingWriter::addRecord
+
+bool
+BlobRecordingWriter::close(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar;
+
+    _lock.lock();
+    okSoFar = closeFile();
+    _lock.unlock();
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingWriter::close
+
+bool
+BlobRecordingWriter::closeFile(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = true;
+
+    if (_outFile)
+    {
+        okSoFar = writeIndexBlock();
+        if (okSoFar)
+        {
+            std::string footer;
+            uint64_t    footerOffset = _position;
+
+            appendFixed32(footer, kFooterMarker);
+            appendFixed32(footer, static_cast<uint32_t>(_blockOffsets.size()));
+            appendFixed64(footer, _numRecords);
+            for (std::vector<uint64_t>::const_iterator walker(_blockOffsets.begin());
+                 _blockOffsets.end() != walker; ++walker)
+            {
+                appendFixed64(footer, *walker);
+            }
+            appendFixed64(footer, footerOffset);
+            footer.append(kTrailerMagic, kMagicLength);
+            okSoFar = writeBytes(footer.data(), footer.length());
+        }
+        if (0 != fclose(_outFile))
+        {
+            okSoFar = false;
+        }
+        _outFile = NULL;
+        _pending.clear();
+        _blockOffsets.clear();
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingWriter::closeFile
+
+bool
+BlobRecordingWriter::open(const YarpString & filePath,
+                          int &              why)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("filePath = ", filePath); //####
+    ODL_P1("why = ", &why); //####
+    bool okSoFar = false;
+
+    _lock.lock();
+    closeFile();
+#if MAC_OR_LINUX_
+    _outFile = fopen(filePath.c_str(), "wb");
+    why = errno;
+#else // ! MAC_OR_LINUX_
+    why = fopen_s(&_outFile, filePath.c_str(), "wb");
+    if (why)
+    {
+        _outFile = NULL;
+    }
+#endif // ! MAC_OR_LINUX_
+    if (_outFile)
+    {
+        std::string header(kFileMagic, kMagicLength);
+
+        appendFixed32(header, static_cast<uint32_t>(kIndexInterval));
+        appendFixed32(header, 0);
+        _lastTime = 0;
+        _position = 0;
+        _numRecords = 0;
+        _bytesSinceIndex = 0;
+        okSoFar = (writeBytes(header.data(), header.length()) && (0 == fflush(_outFile)));
+        if (! okSoFar)
+        {
+            why = errno;
+            fclose(_outFile);
+            _outFile = NULL;
+        }
+    }
+    _lock.unlock();
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingWriter::open
+
+bool
+BlobRecordingWriter::writeBytes(const void * data,
+                                const size_t length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("data = ", data); //####
+    ODL_LL1("length = ", length); //####
+    bool okSoFar = (1 == fwrite(data, length, 1, _outFile));
+
+    if (okSoFar)
+    {
+        _position += length;
+    }
+    else
+    {
+        ODL_LOG("! (1 == fwrite(data, length, 1, _outFile))"); //####
+        truncateFile(_outFile, _position);
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingWriter::writeBytes
+
+bool
+BlobRecordingWriter::writeIndexBlock(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = true;
+
+    if (! _pending.empty())
+    {
+        std::string block;
+        uint64_t    blockOffset = _position;
+
+        appendFixed32(block, kIndexMarker);
+        appendFixed32(block, static_cast<uint32_t>(_pending.size()));
+        for (BlobRecordingEntryVector::const_iterator walker(_pending.begin());
+             _pending.end() != walker; ++walker)
+        {
+            appendFixed64(block, static_cast<uint64_t>(walker->_timeStamp));
+            appendFixed64(block, walker->_offset);
+        }
+        // The records are pushed out with their index block, rather than one at a time.
+        okSoFar = (writeBytes(block.data(), block.length()) && (0 == fflush(_outFile)));
+        if (okSoFar)
+        {
+            _blockOffsets.push_back(blockOffset);
+            _pending.clear();
+            _bytesSinceIndex = 0;
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingWriter::writeIndexBlock
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+BlobRecordingReader::BlobRecordingReader(void) :
+    _entries(), _base(NULL), _dataEnd(0), _fileSize(0),
+#if MAC_OR_LINUX_
+    _fileDescriptor(-1),
+#else // ! MAC_OR_LINUX_
+    _fileHandle(INVALID_HANDLE_VALUE), _mapHandle(NULL),
+#endif // ! MAC_OR_LINUX_
+    _wasRecovered(false)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // BlobRecordingReader::BlobRecordingReader
+
+BlobRecordingReader::~BlobRecordingReader(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    ODL_OBJEXIT(); //####
+} // BlobRecordingReader::~BlobRecordingReader
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+BlobRecordingReader::close(void)
+{
+    ODL_OBJENTER(); //####
+#if MAC_OR_LINUX_
+    if (_base)
+    {
+        munmap(const_cast<uint8_t *>(_base), static_cast<size_t>(_fileSize));
+    }
+    if (0 <= _fileDescriptor)
+    {
+        ::close(_fileDescriptor);
+        _fileDescriptor = -1;
+    }
+#else // ! MAC_OR_LINUX_
+    if (_base)
+    {
+        UnmapViewOfFile(_base);
+    }
+    if (_mapHandle)
+    {
+        CloseHandle(_mapHandle);
+        _mapHandle = NULL;
+    }
+    if (INVALID_HANDLE_VALUE != _fileHandle)
+    {
+        CloseHandle(_fileHandle);
+        _fileHandle = INVALID_HANDLE_VALUE;
+    }
+#endif // ! MAC_OR_LINUX_
+    _base = NULL;
+    _dataEnd = _fileSize = 0;
+    _entries.clear();
+    _wasRecovered = false;
+    ODL_OBJEXIT(); //####
+} // BlobRecordingReader::close
+
+size_t
+BlobRecordingReader::findRecord(const int64_t timeStamp)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("timeStamp = ", timeStamp); //####
+    size_t result = static_cast<size_t>(std::lower_bound(_entries.begin(), _entries.end(),
+                                                         timeStamp, recordIsEarlier) -
+                                        _entries.begin());
+
+    ODL_OBJEXIT_LL(result); //####
+    return result;
+} // BlobRecordingReader::findRecord
+
+bool
+BlobRecordingReader::getRecord(const size_t   index,
+                               int64_t &      timeStamp,
+                               const char * & data,
+                               size_t &       length)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("index = ", index); //####
+    ODL_P3("timeStamp = ", &timeStamp, "data = ", &data, "length = ", &length); //####
+    bool okSoFar = false;
+
+    if (_entries.size() > index)
+    {
+        const BlobRecordingEntry & entry = _entries[index];
+
+        // The index is not trusted, so check the record before handing out its contents.
+        if ((kFileHeaderLength <= entry._offset) && (_dataEnd > entry._offset) &&
+            ((entry._offset + kRecordHeaderLength) <= _dataEnd))
+        {
+            const uint8_t * header = _base + entry._offset;
+            uint64_t        blobLength = readFixed32(header + 4);
+
+            if ((kRecordMarker == readFixed32(header)) &&
+                ((entry._offset + kRecordHeaderLength + blobLength) <= _dataEnd))
+            {
+                timeStamp = entry._timeStamp;
+                data = reinterpret_cast<const char *>(header + kRecordHeaderLength);
+                length = static_cast<size_t>(blobLength);
+                okSoFar = true;
+            }
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingReader::getRecord
+
+bool
+BlobRecordingReader::loadFooter(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = false;
+
+    if ((kFileHeaderLength + kFooterHeaderLength + kTrailerLength) <= _fileSize)
+    {
+        const uint8_t * trailer = _base + _fileSize - kTrailerLength;
+        uint64_t        footerOffset = readFixed64(trailer);
+        uint64_t        footerLimit = _fileSize - kTrailerLength;
+
+        if ((! memcmp(trailer + 8, kTrailerMagic, kMagicLength)) &&
+            (kFileHeaderLength <= footerOffset) && (footerLimit >= footerOffset) &&
+            ((footerOffset + kFooterHeaderLength) <= footerLimit))
+        {
+            const uint8_t * footer = _base + footerOffset;
+            uint64_t        numBlocks = readFixed32(footer + 4);
+            uint64_t        numRecords = readFixed64(footer + 8);
+
+            okSoFar = ((kFooterMarker == readFixed32(footer)) &&
+                       ((footerOffset + kFooterHeaderLength + (numBlocks * 8)) <= footerLimit));
+            if (okSoFar)
+            {
+                _entries.reserve(static_cast<size_t>(std::min(numRecords, footerOffset /
+                                                                          kRecordHeaderLength)));
+            }
+            for (uint64_t ii = 0; okSoFar && (numBlocks > ii); ++ii)
+            {
+                uint64_t blockOffset = readFixed64(footer + kFooterHeaderLength + (ii * 8));
+
+                okSoFar = ((kFileHeaderLength <= blockOffset) && (footerOffset > blockOffset) &&
+                           ((blockOffset + kIndexHeaderLength) <= footerOffset));
+                if (okSoFar)
+                {
+                    const uint8_t * block = _base + blockOffset;
+                    uint64_t        numEntries = readFixed32(block + 4);
+                    const uint8_t * walker = block + kIndexHeaderLength;
+
+                    okSoFar = ((kIndexMarker == readFixed32(block)) &&
+                               ((blockOffset + kIndexHeaderLength +
+                                 (numEntries * kIndexEntryLength)) <= footerOffset));
+                    for (uint64_t jj = 0; okSoFar && (numEntries > jj);
+                         ++jj, walker += kIndexEntryLength)
+                    {
+                        BlobRecordingEntry entry;
+
+                        entry._timeStamp = static_cast<int64_t>(readFixed64(walker));
+                        entry._offset = readFixed64(walker + 8);
+                        okSoFar = (_entries.empty() ||
+                                   (_entries.back()._timeStamp <= entry._timeStamp));
+                        _entries.push_back(entry);
+                    }
+                }
+            }
+            if (okSoFar && (_entries.size() == numRecords))
+            {
+                _dataEnd = footerOffset;
+            }
+            else
+            {
+                okSoFar = false;
+                _entries.clear();
+            }
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingReader::loadFooter
+
+bool
+BlobRecordingReader::open(const YarpString & filePath)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("filePath = ", filePath); //####
+    bool okSoFar = false;
+
+    close();
+#if MAC_OR_LINUX_
+    _fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+    if (0 <= _fileDescriptor)
+    {
+        struct stat fileInfo;
+
+        if ((0 == fstat(_fileDescriptor, &fileInfo)) &&
+            (static_cast<off_t>(kFileHeaderLength) <= fileInfo.st_size))
+        {
+            void * mapped = mmap(NULL, static_cast<size_t>(fileInfo.st_size), PROT_READ,
+                                 MAP_SHARED, _fileDescriptor, 0);
+
+            if (MAP_FAILED != mapped)
+            {
+                _base = static_cast<const uint8_t *>(mapped);
+                _fileSize = static_cast<uint64_t>(fileInfo.st_size);
+                // Playback walks the file in order, so let the system read ahead.
+                madvise(mapped, static_cast<size_t>(_fileSize), MADV_SEQUENTIAL);
+            }
+        }
+    }
+#else // ! MAC_OR_LINUX_
+    _fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (INVALID_HANDLE_VALUE != _fileHandle)
+    {
+        LARGE_INTEGER fileSize;
+
+        if (GetFileSizeEx(_fileHandle, &fileSize) &&
+            (static_cast<LONGLONG>(kFileHeaderLength) <= fileSize.QuadPart))
+        {
+            _mapHandle = CreateFileMapping(_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (_mapHandle)
+            {
+                _base = static_cast<const uint8_t *>(MapViewOfFile(_mapHandle, FILE_MAP_READ, 0, 0,
+                                                                   0));
+                if (_base)
+                {
+                    _fileSize = static_cast<uint64_t>(fileSize.QuadPart);
+                }
+            }
+        }
+    }
+#endif // ! MAC_OR_LINUX_
+    if (_base && (! memcmp(_base, kFileMagic, kMagicLength)))
+    {
+        if (! loadFooter())
+        {
+            scanRecords();
+            _wasRecovered = true;
+        }
+        okSoFar = true;
+    }
+    else
+    {
+        close();
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // BlobRecordingReader::open
+
+void
+BlobRecordingReader::scanRecords(void)
+{
+    ODL_OBJENTER(); //####
+    uint64_t position = kFileHeaderLength;
+
+    _entries.clear();
+    for (bool keepGoing = true; keepGoing && ((position + 8) <= _fileSize); )
+    {
+        const uint8_t * walker = _base + position;
+        uint32_t        marker = readFixed32(walker);
+        uint64_t        blockLength;
+
+        keepGoing = false;
+        if (kRecordMarker == marker)
+        {
+            blockLength = kRecordHeaderLength + readFixed32(walker + 4);
+            if ((position + blockLength) <= _fileSize)
+            {
+                BlobRecordingEntry entry;
+
+                // Only the record header is touched; the blob itself is left on disk.
+                entry._timeStamp = static_cast<int64_t>(readFixed64(walker + 8));
+                entry._offset = position;
+                if (_entries.empty() || (_entries.back()._timeStamp <= entry._timeStamp))
+                {
+                    _entries.push_back(entry);
+                    position += blockLength;
+                    keepGoing = true;
+                }
+            }
+        }
+        else if (kIndexMarker == marker)
+        {
+            blockLength = kIndexHeaderLength + (readFixed32(walker + 4) * kIndexEntryLength);
+            if ((position + blockLength) <= _fileSize)
+            {
+                position += blockLength;
+                keepGoing = true;
+            }
+        }
+    }
+    _dataEnd = position;
+    ODL_LL2("_entries.size() = ", _entries.size(), "_dataEnd = ", _dataEnd); //####
+    ODL_OBJEXIT(); //####
+} // BlobRecordingReader::scanRecords
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,354 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mBlobRecording.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declarations for reading and writing recordings of binary blobs.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMBlobRecording_HPP_))
+# define MpMBlobRecording_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# include <vector>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declarations for reading and writing recordings of binary blobs.
+
+ A recording starts with a fixed header, followed by a sequence of records, each of which holds a
+ marker, the length of the blob, the time at which the blob was received and the bytes of the blob.
+ After every few records, an index block is written that holds the time and location of each record
+ since the previous index block. When the recording is closed, a footer listing the index blocks
+ and a fixed-size trailer locating the footer are added to the end of the file. A recording that
+ was not closed, because of a crash, can still be read by scanning the records from the start. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace RecordBlob
+    {
+        /*! @brief The location of a record within a recording. */
+        struct BlobRecordingEntry
+        {
+            /*! @brief The time at which the blob was received, in microseconds. */
+            int64_t _timeStamp;
+
+            /*! @brief The offset in the file of the start of the record. */
+            uint64_t _offset;
+
+        }; // BlobRecordingEntry
+
+        /*! @brief A sequence of record locations. */
+        typedef std::vector<BlobRecordingEntry> BlobRecordingEntryVector;
+
+        /*! @brief A class to write blobs to a recording. */
+        class BlobRecordingWriter
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            BlobRecordingWriter(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~BlobRecordingWriter(void);
+
+            /*! @brief Add a blob to the recording.
+             @param[in] timeStamp The time at which the blob was received, in microseconds.
+             @param[in] data The bytes of the blob.
+             @param[in] length The number of bytes in the blob.
+             @returns @c true if the blob was added and @c false otherwise. */
+            bool
+            addRecord(const int64_t timeStamp,
+                      const void *  data,
+                      const size_t  length);
+
+            /*! @brief Finish the recording and release the file.
+             @returns @c true if the index and trailer were written and @c false otherwise. */
+            bool
+            close(void);
+
+            /*! @brief Create a new recording, replacing any existing file.
+             @param[in] filePath The path to the file.
+             @param[out] why The error code, if the file could not be created.
+             @returns @c true if the recording was created and @c false otherwise. */
+            bool
+            open(const YarpString & filePath,
+                 int &              why);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            BlobRecordingWriter(const BlobRecordingWriter & other);
+
+            /*! @brief Finish the recording and release the file, without locking.
+             @returns @c true if the index and trailer were written and @c false otherwise. */
+            bool
+            closeFile(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            BlobRecordingWriter &
+            operator =(const BlobRecordingWriter & other);
+
+            /*! @brief Write the locations of the records added since the previous index block.
+             @returns @c true if the index block was written and @c false otherwise. */
+            bool
+            writeIndexBlock(void);
+
+            /*! @brief Write a sequence of bytes at the end of the recording, removing anything that
+             was partially written if the write fails.
+             @param[in] data The bytes to be written.
+             @param[in] length The number of bytes to be written.
+             @returns @c true if the bytes were written and @c false otherwise. */
+            bool
+            writeBytes(const void * data,
+                       const size_t length);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock used to serialize writes and the closing of the file. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The locations of the records that are not yet covered by an index block. */
+            BlobRecordingEntryVector _pending;
+
+            /*! @brief The locations of the index blocks. */
+            std::vector<uint64_t> _blockOffsets;
+
+            /*! @brief The file being written to. */
+            FILE * _outFile;
+
+            /*! @brief The time of the most recent record. */
+            int64_t _lastTime;
+
+            /*! @brief The offset of the end of the file. */
+            uint64_t _position;
+
+            /*! @brief The number of records in the recording. */
+            uint64_t _numRecords;
+
+            /*! @brief The number of bytes written since the previous index block. */
+            size_t _bytesSinceIndex;
+
+        }; // BlobRecordingWriter
+
+        /*! @brief A class to read blobs from a recording, by mapping the file into memory. */
+        class BlobRecordingReader
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            BlobRecordingReader(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~BlobRecordingReader(void);
+
+            /*! @brief Release the file. */
+            void
+            close(void);
+
+            /*! @brief Return the number of records in the recording.
+             @returns The number of records in the recording. */
+            inline size_t
+            count(void)
+            const
+            {
+                return _entries.size();
+            } // count
+
+            /*! @brief Return the index of the first record received at or after a given time.
+             @param[in] timeStamp The time of interest, in microseconds.
+             @returns The index of the first record received at or after the time, or the number
+             of records if there is no such record. */
+            size_t
+            findRecord(const int64_t timeStamp)
+            const;
+
+            /*! @brief Return the time of the first record in the recording.
+             @returns The time of the first record in the recording or zero if there are no
+             records. */
+            inline int64_t
+            firstTime(void)
+            const
+            {
+                return (_entries.empty() ? 0 : _entries.front()._timeStamp);
+            } // firstTime
+
+            /*! @brief Return a record from the recording. The bytes of the blob are not copied
+             and remain valid until the file is released.
+             @param[in] index The index of the record.
+             @param[out] timeStamp The time at which the blob was received, in microseconds.
+             @param[out] data The bytes of the blob.
+             @param[out] length The number of bytes in the blob.
+             @returns @c true if the record is valid and @c false otherwise. */
+            bool
+            getRecord(const size_t   index,
+                      int64_t &      timeStamp,
+                      const char * & data,
+                      size_t &       length)
+            const;
+
+            /*! @brief Return the time of the last record in the recording.
+             @returns The time of the last record in the recording or zero if there are no
+             records. */
+            inline int64_t
+            lastTime(void)
+            const
+            {
+                return (_entries.empty() ? 0 : _entries.back()._timeStamp);
+            } // lastTime
+
+            /*! @brief Map a recording into memory and load its index.
+             @param[in] filePath The path to the file.
+             @returns @c true if the file is a recording and @c false otherwise. */
+            bool
+            open(const YarpString & filePath);
+
+            /*! @brief Return @c true if the index was rebuilt by scanning the records.
+             @returns @c true if the recording was not closed properly and @c false otherwise. */
+            inline bool
+            wasRecovered(void)
+            const
+            {
+                return _wasRecovered;
+            } // wasRecovered
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            BlobRecordingReader(const BlobRecordingReader & other);
+
+            /*! @brief Load the index using the footer of the recording.
+             @returns @c true if the footer and all the index blocks were valid and @c false
+             otherwise. */
+            bool
+            loadFooter(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            BlobRecordingReader &
+            operator =(const BlobRecordingReader & other);
+
+            /*! @brief Build the index by walking the records from the start of the recording,
+             stopping at the first incomplete record. */
+            void
+            scanRecords(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The locations of the records, in time order. */
+            BlobRecordingEntryVector _entries;
+
+            /*! @brief The start of the mapped file. */
+            const uint8_t * _base;
+
+            /*! @brief The offset of the byte following the last record. */
+            uint64_t _dataEnd;
+
+            /*! @brief The size of the mapped file. */
+            uint64_t _fileSize;
+
+# if MAC_OR_LINUX_
+            /*! @brief The descriptor of the mapped file. */
+            int _fileDescriptor;
+# else // ! MAC_OR_LINUX_
+            /*! @brief The handle of the mapped file. */
+            void * _fileHandle;
+
+            /*! @brief The handle of the file mapping. */
+            void * _mapHandle;
+# endif // ! MAC_OR_LINUX_
+
+            /*! @brief @c true if the index was rebuilt by scanning the records and @c false
+             otherwise. */
+            bool _wasRecovered;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+#  if MAC_OR_LINUX_
+            char _filler[3];
+#  else // ! MAC_OR_LINUX_
+            char _filler[7];
+#  endif // ! MAC_OR_LINUX_
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // BlobRecordingReader
+
+    } // RecordBlob
+
+} // MplusM
+
+#endif // ! defined(MpMBlobRecording_HPP_)
@@ -0,0 +1,699 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mBlobRecordingTest.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The test driver for the unit tests of blob recordings.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mBlobRecording.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <cstdio>
+#include <vector>
+
+#if MAC_OR_LINUX_
+# include <unistd.h>
+#else // ! MAC_OR_LINUX_
+# include <fcntl.h>
+# include <io.h>
+# include <share.h>
+# include <sys/stat.h>
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The test driver for the unit tests of blob recordings. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::RecordBlob;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The default number of blobs to record in a test; enough for several index blocks. */
+static const int kDefaultRecordCount = 3000;
+
+/*! @brief The interval between test blobs, in microseconds. */
+static const int64_t kRecordInterval = 8333;
+
+/*! @brief The time of the first test blob, in microseconds. */
+static const int64_t kFirstRecordTime = 1000000;
+
+/*! @brief The number of bytes in the file header of a recording. */
+static const long kFileHeaderLength = 16;
+
+/*! @brief The number of bytes in a record header. */
+static const long kRecordHeaderLength = 16;
+
+/*! @brief The number of bytes in the trailer of a recording. */
+static const long kTrailerLength = 16;
+
+/*! @brief The number of bytes in the header of an index block. */
+static const long kIndexHeaderLength = 8;
+
+/*! @brief The number of bytes in the footer header, before the offsets of the index blocks. */
+static const long kFooterHeaderLength = 16;
+
+/*! @brief The file used to hold the test recording. */
+#define TEST_RECORDING_PATH_ "blobrecording_test.blb"
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the number of bytes in a test blob.
+ @param[in] index The sequence number of the blob.
+ @returns The number of bytes in the blob. */
+static size_t
+blobLength(const int index)
+{
+    return static_cast<size_t>(1 + ((index * 37) % 500));
+} // blobLength
+
+/*! @brief Return a byte of a test blob.
+ @param[in] index The sequence number of the blob.
+ @param[in] position The position of the byte within the blob.
+ @returns A byte of the blob. */
+static char
+blobByte(const int    index,
+         const size_t position)
+{
+    return static_cast<char>((index + (position * 7)) & 0x00FF);
+} // blobByte
+
+/*! @brief Check that a recording holds exactly the expected test blobs.
+ @param[in] reader The recording to be checked.
+ @param[in] numRecords The number of expected blobs.
+ @returns @c true if the expected blobs were found and @c false otherwise. */
+static bool
+checkTestRecords(const BlobRecordingReader & reader,
+                 const int                   numRecords)
+{
+    ODL_ENTER(); //####
+    ODL_P1("reader = ", &reader); //####
+    ODL_LL1("numRecords = ", numRecords); //####
+    bool okSoFar = (static_cast<size_t>(numRecords) == reader.count());
+
+    for (int ii = 0; okSoFar && (numRecords > ii); ++ii)
+    {
+        const char * data;
+        int64_t      timeStamp;
+        size_t       length;
+
+        okSoFar = (reader.getRecord(static_cast<size_t>(ii), timeStamp, data, length) &&
+                   ((kFirstRecordTime + (ii * kRecordInterval)) == timeStamp) &&
+                   (blobLength(ii) == length));
+        for (size_t jj = 0; okSoFar && (length > jj); ++jj)
+        {
+            okSoFar = (blobByte(ii, jj) == data[jj]);
+        }
+        if (okSoFar)
+        {
+            // A time between two blobs finds the later one.
+            okSoFar = (static_cast<size_t>(ii) == reader.findRecord(timeStamp)) &&
+                      (static_cast<size_t>(ii) == reader.findRecord(timeStamp -
+                                                                    (kRecordInterval / 2)));
+        }
+    }
+    if (okSoFar)
+    {
+        okSoFar = (reader.count() == reader.findRecord(kFirstRecordTime +
+                                                       (numRecords * kRecordInterval)));
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // checkTestRecords
+
+/*! @brief Return the size of a file.
+ @param[in] filePath The path to the file.
+ @returns The size of the file or @c -1 if it could not be opened. */
+static long
+getFileSize(const char * filePath)
+{
+    ODL_ENTER(); //####
+    ODL_S1("filePath = ", filePath); //####
+    long   result = -1;
+    FILE * aFile;
+
+#if MAC_OR_LINUX_
+    aFile = fopen(filePath, "rb");
+#else // ! MAC_OR_LINUX_
+    if (fopen_s(&aFile, filePath, "rb"))
+    {
+        aFile = NULL;
+    }
+#endif // ! MAC_OR_LINUX_
+    if (aFile)
+    {
+        fseek(aFile, 0, SEEK_END);
+        result = ftell(aFile);
+        fclose(aFile);
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // getFileSize
+
+/*! @brief Return the record count from the test arguments.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns The record count, or the default if it was not provided or not valid. */
+static int
+getRecordCount(const int argc,
+               char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = kDefaultRecordCount;
+
+    if (0 < argc)
+    {
+        const char * startPtr = *argv;
+        char *       endPtr;
+        int          value = strtol(startPtr, &endPtr, 10);
+
+        if ((startPtr != endPtr) && (! *endPtr) && (1 < value))
+        {
+            result = value;
+        }
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // getRecordCount
+
+/*! @brief Read a 64-bit value, stored least significant byte first, from a file.
+ @param[in] filePath The path to the file.
+ @param[in] offset The position of the value in the file.
+ @param[out] value The value that was read.
+ @returns @c true if the value was read and @c false otherwise. */
+static bool
+readTestValue(const char * filePath,
+              const long   offset,
+              uint64_t &   value)
+{
+    ODL_ENTER(); //####
+    ODL_S1("filePath = ", filePath); //####
+    ODL_LL1("offset = ", offset); //####
+    ODL_P1("value = ", &value); //####
+    bool          okSoFar = false;
+    FILE *        aFile;
+    unsigned char bytes[8];
+
+#if MAC_OR_LINUX_
+    aFile = fopen(filePath, "rb");
+#else // ! MAC_OR_LINUX_
+    if (fopen_s(&aFile, filePath, "rb"))
+    {
+        aFile = NULL;
+    }
+#endif // ! MAC_OR_LINUX_
+    if (aFile)
+    {
+        okSoFar = ((0 == fseek(aFile, offset, SEEK_SET)) &&
+                   (1 == fread(bytes, sizeof(bytes), 1, aFile)));
+        fclose(aFile);
+    }
+    if (okSoFar)
+    {
+        value = 0;
+        for (int ii = 7; ii >= 0; --ii)
+        {
+            value = (value << 8) | bytes[ii];
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // readTestValue
+
+/*! @brief Discard the end of a file.
+ @param[in] filePath The path to the file.
+ @param[in] newSize The new size of the file.
+ @returns @c true if the file was shortened and @c false otherwise. */
+static bool
+truncateTestFile(const char * filePath,
+                 const long   newSize)
+{
+    ODL_ENTER(); //####
+    ODL_S1("filePath = ", filePath); //####
+    ODL_LL1("newSize = ", newSize); //####
+    bool okSoFar;
+
+#if MAC_OR_LINUX_
+    okSoFar = (0 == truncate(filePath, newSize));
+#else // ! MAC_OR_LINUX_
+    int handle;
+
+    okSoFar = (0 == _sopen_s(&handle, filePath, _O_RDWR | _O_BINARY, _SH_DENYNO,
+                             _S_IREAD | _S_IWRITE));
+    if (okSoFar)
+    {
+        okSoFar = (0 == _chsize_s(handle, newSize));
+        _close(handle);
+    }
+#endif // ! MAC_OR_LINUX_
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // truncateTestFile
+
+/*! @brief Overwrite part of a file.
+ @param[in] filePath The path to the file.
+ @param[in] offset The position in the file of the bytes to be replaced.
+ @param[in] data The replacement bytes.
+ @param[in] length The number of bytes to be replaced.
+ @returns @c true if the bytes were replaced and @c false otherwise. */
+static bool
+writeTestBytes(const char * filePath,
+               const long   offset,
+               const char * data,
+               const size_t length)
+{
+    ODL_ENTER(); //####
+    ODL_S1("filePath = ", filePath); //####
+    ODL_LL2("offset = ", offset, "length = ", length); //####
+    ODL_P1("data = ", data); //####
+    bool   okSoFar = false;
+    FILE * aFile;
+
+#if MAC_OR_LINUX_
+    aFile = fopen(filePath, "r+b");
+#else // ! MAC_OR_LINUX_
+    if (fopen_s(&aFile, filePath, "r+b"))
+    {
+        aFile = NULL;
+    }
+#endif // ! MAC_OR_LINUX_
+    if (aFile)
+    {
+        okSoFar = ((0 == fseek(aFile, offset, SEEK_SET)) &&
+                   (1 == fwrite(data, length, 1, aFile)));
+        if (0 != fclose(aFile))
+        {
+            okSoFar = false;
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // writeTestBytes
+
+/*! @brief Record test blobs and close the recording.
+ @param[in] numRecords The number of blobs to be recorded.
+ @returns @c true if the recording was written and @c false otherwise. */
+static bool
+writeTestRecording(const int numRecords)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("numRecords = ", numRecords); //####
+    bool                okSoFar;
+    int                 why;
+    BlobRecordingWriter writer;
+
+    remove(TEST_RECORDING_PATH_);
+    okSoFar = writer.open(TEST_RECORDING_PATH_, why);
+    for (int ii = 0; okSoFar && (numRecords > ii); ++ii)
+    {
+        std::vector<char> blob(blobLength(ii));
+
+        for (size_t jj = 0, mm = blob.size(); mm > jj; ++jj)
+        {
+            blob[jj] = blobByte(ii, jj);
+        }
+        okSoFar = writer.addRecord(kFirstRecordTime + (ii * kRecordInterval), &blob[0],
+                                   blob.size());
+    }
+    if (okSoFar)
+    {
+        okSoFar = writer.close();
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // writeTestRecording
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 01 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestClosedRecording(const char * launchPath,
+                      const int    argc,
+                      char * *     argv) // read back a closed recording
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int numRecords = getRecordCount(argc, argv);
+
+        if (writeTestRecording(numRecords))
+        {
+            BlobRecordingReader reader;
+
+            // A closed recording is read through its footer, without walking the records.
+            if (reader.open(TEST_RECORDING_PATH_) && (! reader.wasRecovered()) &&
+                checkTestRecords(reader, numRecords) &&
+                (kFirstRecordTime == reader.firstTime()) &&
+                ((kFirstRecordTime + ((numRecords - 1) * kRecordInterval)) == reader.lastTime()))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (reader.open(TEST_RECORDING_PATH_) && " //####
+                        "(! reader.wasRecovered()) && checkTestRecords(reader, " //####
+                        "numRecords) && ...)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (writeTestRecording(numRecords))"); //####
+        }
+        remove(TEST_RECORDING_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestClosedRecording
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 02 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestTornRecording(const char * launchPath,
+                    const int    argc,
+                    char * *     argv) // recover a recording that was not closed
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int  numRecords = getRecordCount(argc, argv);
+        long lastRecordOffset = -1;
+
+        if (writeTestRecording(numRecords))
+        {
+            BlobRecordingReader reader;
+            const char *        firstData;
+            const char *        lastData;
+            int64_t             timeStamp;
+            size_t              length;
+
+            // The records are laid out in order, so the position of the last record follows from
+            // where its bytes are mapped relative to those of the first record.
+            if (reader.open(TEST_RECORDING_PATH_) &&
+                reader.getRecord(0, timeStamp, firstData, length) &&
+                reader.getRecord(numRecords - 1, timeStamp, lastData, length))
+            {
+                lastRecordOffset = kFileHeaderLength + static_cast<long>(lastData - firstData);
+            }
+        }
+        // Cut the recording part way through its last blob, as a crash during a write would, which
+        // also removes the last index block, the footer and the trailer.
+        if ((0 < lastRecordOffset) &&
+            truncateTestFile(TEST_RECORDING_PATH_,
+                             lastRecordOffset + static_cast<long>(blobLength(numRecords - 1) / 2)))
+        {
+            BlobRecordingReader reader;
+
+            if (reader.open(TEST_RECORDING_PATH_) && reader.wasRecovered() &&
+                checkTestRecords(reader, numRecords - 1))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (reader.open(TEST_RECORDING_PATH_) && " //####
+                        "reader.wasRecovered() && checkTestRecords(reader, " //####
+                        "numRecords - 1))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((0 < lastRecordOffset) && truncateTestFile(...))"); //####
+        }
+        remove(TEST_RECORDING_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestTornRecording
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 03 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestDamagedIndex(const char * launchPath,
+                   const int    argc,
+                   char * *     argv) // recover a recording with a damaged index or trailer
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        if (0 < argc)
+        {
+            YarpString damage(*argv);
+            int        numRecords = getRecordCount(argc - 1, argv + 1);
+            long       fileSize;
+            bool       okSoFar = writeTestRecording(numRecords);
+
+            fileSize = getFileSize(TEST_RECORDING_PATH_);
+            if (okSoFar && (damage == "trailer"))
+            {
+                // The magic value at the very end of the file no longer matches.
+                okSoFar = writeTestBytes(TEST_RECORDING_PATH_, fileSize - 1, "?", 1);
+            }
+            else if (okSoFar && (damage == "index"))
+            {
+                uint64_t footerOffset;
+                uint64_t blockOffset;
+
+                // Give the first entry of the first index block a time later than the entry
+                // after it, so that the index is no longer in time order.
+                okSoFar = (readTestValue(TEST_RECORDING_PATH_, fileSize - kTrailerLength,
+                                         footerOffset) &&
+                           readTestValue(TEST_RECORDING_PATH_,
+                                         static_cast<long>(footerOffset) + kFooterHeaderLength,
+                                         blockOffset) &&
+                           writeTestBytes(TEST_RECORDING_PATH_,
+                                          static_cast<long>(blockOffset) + kIndexHeaderLength,
+                                          "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x7F", 8));
+            }
+            else
+            {
+                okSoFar = false;
+            }
+            if (okSoFar)
+            {
+                BlobRecordingReader reader;
+
+                // The damaged index is not trusted; the records are walked instead, and they are
+                // all intact.
+                if (reader.open(TEST_RECORDING_PATH_) && reader.wasRecovered() &&
+                    checkTestRecords(reader, numRecords))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (reader.open(TEST_RECORDING_PATH_) && " //####
+                            "reader.wasRecovered() && checkTestRecords(reader, " //####
+                            "numRecords))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (okSoFar)"); //####
+            }
+            remove(TEST_RECORDING_PATH_);
+        }
+        else
+        {
+            ODL_LOG("! (0 < argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestDamagedIndex
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for unit tests of blob recordings.
+
+ The first argument is the test number. The third test takes the part of the recording to be
+ damaged, 'trailer' or 'index', and each test takes an optional number of blobs to be recorded.
+ Output depends on the test being run.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        Initialize(progName);
+        if (0 < --argc)
+        {
+            const char * startPtr = argv[1];
+            char *       endPtr;
+            int          selector = strtol(startPtr, &endPtr, 10);
+
+            ODL_LL1("selector <- ", selector); //####
+            if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+            {
+                switch (selector)
+                {
+                    case 1 :
+                        result = doTestClosedRecording(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 2 :
+                        result = doTestTornRecording(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 3 :
+                        result = doTestDamagedIndex(*argv, argc - 1, argv + 2);
+                        break;
+
+                    default :
+                        break;
+
+                }
+                if (result)
+                {
+                    ODL_LL1("%%%%%%% unit test failure = ", result); //####
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 < --argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // main
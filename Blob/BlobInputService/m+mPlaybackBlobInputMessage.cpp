@@ -0,0 +1,159 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mPlaybackBlobInputMessage.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a message that sends a blob without copying it.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mPlaybackBlobInputMessage.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a message that sends a blob without copying it. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::PlaybackBlob;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of bytes preceding the blob; the list tag, the list length, the blob tag and
+ the blob length. */
+static const size_t kMessageHeaderLength = 4 * 4;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PlaybackBlobInputMessage::PlaybackBlobInputMessage(void) :
+    inherited(), _data(NULL), _length(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // PlaybackBlobInputMessage::PlaybackBlobInputMessage
+
+PlaybackBlobInputMessage::~PlaybackBlobInputMessage(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // PlaybackBlobInputMessage::~PlaybackBlobInputMessage
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+size_t
+PlaybackBlobInputMessage::getMessageSize(void)
+const
+{
+    ODL_OBJENTER(); //####
+    size_t result = kMessageHeaderLength + _length;
+
+    ODL_OBJEXIT_LL(result); //####
+    return result;
+} // PlaybackBlobInputMessage::getMessageSize
+
+void
+PlaybackBlobInputMessage::setBlob(const char * data,
+                                  const size_t length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("data = ", data); //####
+    ODL_LL1("length = ", length); //####
+    _data = data;
+    _length = length;
+    ODL_OBJEXIT(); //####
+} // PlaybackBlobInputMessage::setBlob
+
+bool
+PlaybackBlobInputMessage::write(yarp::os::ConnectionWriter & connection)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("connection = ", &connection); //####
+    bool result;
+
+    if (connection.isTextMode())
+    {
+        // Text connections need the usual conversion, which requires a copy of the blob.
+        yarp::os::Bottle asBottle;
+        void *           rawData = static_cast<void *>(const_cast<char *>(_data));
+
+        asBottle.add(yarp::os::Value(rawData, static_cast<int>(_length)));
+        result = asBottle.write(connection);
+    }
+    else
+    {
+        // The blob is handed to the connection by reference, so it is not copied.
+        connection.appendInt(BOTTLE_TAG_LIST);
+        connection.appendInt(1);
+        connection.appendInt(BOTTLE_TAG_BLOB);
+        connection.appendInt(static_cast<int>(_length));
+        connection.appendExternalBlock(_data, _length);
+        result = true;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PlaybackBlobInputMessage::write
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,368 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mPlaybackBlobInputService.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the Playback Blob input service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mPlaybackBlobInputService.hpp"
+#include "m+mPlaybackBlobInputRequests.hpp"
+#include "m+mPlaybackBlobInputThread.hpp"
+
+#include <m+m/m+mEndpoint.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the Playback %Blob input service. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::PlaybackBlob;
+using namespace MplusM::RecordBlob;
+using std::cerr;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PlaybackBlobInputService::PlaybackBlobInputService(const YarpString &                  inputPath,
+                                                   const Utilities::DescriptorVector & argumentList,
+                                                   const YarpString &                  launchPath,
+                                                   const int                           argc,
+                                                   char * *                            argv,
+                                                   const YarpString &                  tag,
+                                                   const YarpString &
+                                                                            serviceEndpointName,
+                                                   const YarpString &
+                                                                            servicePortNumber) :
+    inherited(argumentList, launchPath, argc, argv, tag, true,
+              MpM_PLAYBACKBLOBINPUT_CANONICAL_NAME_, PLAYBACKBLOBINPUT_SERVICE_DESCRIPTION_, "",
+              serviceEndpointName, servicePortNumber),
+    _recording(), _generator(NULL), _inPath(inputPath), _endTime(0), _speed(1), _startTime(0),
+    _loopPlayback(false)
+{
+    ODL_ENTER(); //####
+    ODL_S4s("launchPath = ", launchPath, "inputPath = ", inputPath, "tag = ", tag, //####
+            "serviceEndpointName = ", serviceEndpointName); //####
+    ODL_S1s("servicePortNumber = ", servicePortNumber); //####
+    ODL_P2("argumentList = ", &argumentList, "argv = ", argv); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_EXIT_P(this); //####
+} // PlaybackBlobInputService::PlaybackBlobInputService
+
+PlaybackBlobInputService::~PlaybackBlobInputService(void)
+{
+    ODL_OBJENTER(); //####
+    stopStreams();
+    _recording.close();
+    ODL_OBJEXIT(); //####
+} // PlaybackBlobInputService::~PlaybackBlobInputService
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+PlaybackBlobInputService::configure(const yarp::os::Bottle & details)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("details = ", &details); //####
+    bool result = false;
+
+    try
+    {
+        if (4 <= details.size())
+        {
+            yarp::os::Value firstValue(details.get(0));
+            yarp::os::Value secondValue(details.get(1));
+            yarp::os::Value thirdValue(details.get(2));
+            yarp::os::Value fourthValue(details.get(3));
+
+            if (firstValue.isDouble() && secondValue.isDouble() && thirdValue.isDouble() &&
+                fourthValue.isInt())
+            {
+                double firstNumber = firstValue.asDouble();
+                double secondNumber = secondValue.asDouble();
+                double thirdNumber = thirdValue.asDouble();
+                int    fourthNumber = fourthValue.asInt();
+
+                if ((0 < firstNumber) && (0 <= secondNumber) &&
+                    ((0 == thirdNumber) || (secondNumber < thirdNumber)))
+                {
+                    std::stringstream buff;
+
+                    _speed = firstNumber;
+                    _startTime = secondNumber;
+                    _endTime = thirdNumber;
+                    _loopPlayback = (0 != fourthNumber);
+                    ODL_D3("_speed <- ", _speed, "_startTime <- ", _startTime, //####
+                           "_endTime <- ", _endTime); //####
+                    ODL_B1("_loopPlayback <- ", _loopPlayback); //####
+                    buff << "Input file path is '" << _inPath.c_str() << "', speed is " <<
+                            _speed << ", playback starts at " << _startTime << " and ends at ";
+                    if (0 < _endTime)
+                    {
+                        buff << _endTime;
+                    }
+                    else
+                    {
+                        buff << "the end of the recording";
+                    }
+                    buff << ", playback does " << (_loopPlayback ? "loop" : "not loop");
+                    setExtraInformation(buff.str());
+                    result = true;
+                }
+                else
+                {
+                    cerr << "One or more inputs are out of range." << endl;
+                }
+            }
+            else
+            {
+                cerr << "One or more inputs have the wrong type." << endl;
+            }
+        }
+        else
+        {
+            cerr << "Missing input(s)." << endl;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PlaybackBlobInputService::configure
+
+bool
+PlaybackBlobInputService::getConfiguration(yarp::os::Bottle & details)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("details = ", &details); //####
+    bool result = true;
+
+    details.clear();
+    details.addDouble(_speed);
+    details.addDouble(_startTime);
+    details.addDouble(_endTime);
+    details.addInt(_loopPlayback ? 1 : 0);
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PlaybackBlobInputService::getConfiguration
+
+bool
+PlaybackBlobInputService::setUpStreamDescriptions(void)
+{
+    ODL_OBJENTER(); //####
+    bool               result = true;
+    ChannelDescription description;
+    YarpString         rootName(getEndpoint().getName() + "/");
+
+    _outDescriptions.clear();
+    description._portName = rootName + "output";
+    description._portProtocol = "b";
+    description._protocolDescription = "A binary blob";
+    _outDescriptions.push_back(description);
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PlaybackBlobInputService::setUpStreamDescriptions
+
+bool
+PlaybackBlobInputService::shutDownOutputStreams(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = inherited::shutDownOutputStreams();
+
+    if (_generator)
+    {
+        _generator->clearOutputChannel();
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // PlaybackBlobInputService::shutDownOutputStreams
+
+bool
+PlaybackBlobInputService::startService(void)
+{
+    ODL_OBJENTER(); //####
+    try
+    {
+        if (! isStarted())
+        {
+            inherited::startService();
+            if (isStarted())
+            {
+                if (_recording.open(_inPath))
+                {
+                    if (_recording.wasRecovered())
+                    {
+                        cerr << "Recording '" << _inPath.c_str() << "' was not closed properly; " <<
+                                _recording.count() << " records were recovered." << endl;
+                    }
+                }
+                else
+                {
+                    cerr << "Could not open recording '" << _inPath.c_str() << "'." << endl;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (isStarted())"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(isStarted()); //####
+    return isStarted();
+} // PlaybackBlobInputService::startService
+
+void
+PlaybackBlobInputService::startStreams(void)
+{
+    ODL_OBJENTER(); //####
+    try
+    {
+        if (! isActive())
+        {
+            // The playback range is relative to the first record of the recording.
+            int64_t baseTime = _recording.firstTime();
+            int64_t startOffset = static_cast<int64_t>(_startTime * 1000000.0);
+            size_t  firstIndex = _recording.findRecord(baseTime + startOffset);
+            size_t  lastIndex;
+
+            if (0 < _endTime)
+            {
+                lastIndex = _recording.findRecord(baseTime +
+                                                  static_cast<int64_t>(_endTime * 1000000.0));
+            }
+            else
+            {
+                lastIndex = _recording.count();
+            }
+            if (firstIndex < lastIndex)
+            {
+                _generator = new PlaybackBlobInputThread(getOutletStream(0), _recording,
+                                                         firstIndex, lastIndex, _speed,
+                                                         _loopPlayback);
+                if (_generator->start())
+                {
+                    setActive();
+                }
+                else
+                {
+                    cerr << "Could not start auxiliary thread." << endl;
+                    delete _generator;
+                    _generator = NULL;
+                }
+            }
+            else
+            {
+                cerr << "There are no records in the requested range." << endl;
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // PlaybackBlobInputService::startStreams
+
+void
+PlaybackBlobInputService::stopStreams(void)
+{
+    ODL_OBJENTER(); //####
+    try
+    {
+        if (isActive())
+        {
+            _generator->stop();
+            for ( ; _generator->isRunning(); )
+            {
+                ConsumeSomeTime(IO_SERVICE_DELAY_FACTOR_);
+            }
+            delete _generator;
+            _generator = NULL;
+            clearActive();
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // PlaybackBlobInputService::stopStreams
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
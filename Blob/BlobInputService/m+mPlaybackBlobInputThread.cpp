@@ -0,0 +1,240 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mPlaybackBlobInputThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for an output-generating thread for m+m.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mPlaybackBlobInputThread.hpp"
+#include "m+mBlobRecording.hpp"
+#include "m+mPlaybackBlobInputMessage.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for an output-generating thread for m+m. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::PlaybackBlob;
+using namespace MplusM::RecordBlob;
+using std::cerr;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The longest time to wait for the next record before checking for a stop request, in
+ seconds. */
+static const double kMaximumWait = 0.1;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PlaybackBlobInputThread::PlaybackBlobInputThread(Common::GeneralChannel *    outChannel,
+                                                 const BlobRecordingReader & recording,
+                                                 const size_t                firstIndex,
+                                                 const size_t                lastIndex,
+                                                 const double                speed,
+                                                 const bool                  loopPlayback) :
+    inherited(), _recording(recording), _outChannel(outChannel), _firstIndex(firstIndex),
+    _lastIndex(lastIndex), _speed(speed), _startTime(0), _loopPlayback(loopPlayback)
+{
+    ODL_ENTER(); //####
+    ODL_P2("outChannel = ", outChannel, "recording = ", &recording); //####
+    ODL_LL2("firstIndex = ", firstIndex, "lastIndex = ", lastIndex); //####
+    ODL_D1("speed = ", speed); //####
+    ODL_B1("loopPlayback = ", loopPlayback); //####
+    ODL_EXIT_P(this); //####
+} // PlaybackBlobInputThread::PlaybackBlobInputThread
+
+PlaybackBlobInputThread::~PlaybackBlobInputThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // PlaybackBlobInputThread::~PlaybackBlobInputThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+PlaybackBlobInputThread::clearOutputChannel(void)
+{
+    ODL_OBJENTER(); //####
+    _outChannel = NULL;
+    ODL_OBJEXIT(); //####
+} // PlaybackBlobInputThread::clearOutputChannel
+
+void
+PlaybackBlobInputThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    bool                     atEnd = false;
+    int64_t                  baseTime = 0;
+    size_t                   nextIndex = _firstIndex;
+    PlaybackBlobInputMessage message;
+
+    if (_firstIndex < _recording.count())
+    {
+        const char * data;
+        size_t       length;
+
+        _recording.getRecord(_firstIndex, baseTime, data, length);
+    }
+    for ( ; (! atEnd) && (! isStopping()); )
+    {
+        if (nextIndex < _lastIndex)
+        {
+            const char * data;
+            int64_t      timeStamp;
+            size_t       length;
+
+            if (_recording.getRecord(nextIndex, timeStamp, data, length))
+            {
+                // The send times are derived from the start of the playback, rather than from the
+                // previous send, so that delays in sending do not accumulate.
+                double dueTime = _startTime + ((timeStamp - baseTime) / (1000000.0 * _speed));
+                double waitTime = dueTime - yarp::os::Time::now();
+
+                if (0 < waitTime)
+                {
+                    yarp::os::Time::delay((waitTime < kMaximumWait) ? waitTime : kMaximumWait);
+                }
+                else
+                {
+                    GeneralChannel * outChannel = _outChannel;
+
+                    if (outChannel && outChannel->writesDirectly())
+                    {
+                        // The blob is written from the mapped file, without copying it.
+                        message.setBlob(data, length);
+                        if (outChannel->write(message))
+                        {
+                            if (outChannel->metricsAreEnabled())
+                            {
+                                outChannel->updateSendCounters(message.getMessageSize());
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! (outChannel->write(message))"); //####
+#if defined(MpM_StallOnSendProblem)
+                            Stall();
+#endif // defined(MpM_StallOnSendProblem)
+                        }
+                    }
+                    else if (outChannel)
+                    {
+                        // The channel has to see the message as a bottle, so the blob is copied.
+                        yarp::os::Bottle asBottle;
+                        void *           rawData = static_cast<void *>(const_cast<char *>(data));
+
+                        asBottle.add(yarp::os::Value(rawData, static_cast<int>(length)));
+                        if (! outChannel->writeBottle(asBottle))
+                        {
+                            ODL_LOG("(! outChannel->writeBottle(asBottle))"); //####
+#if defined(MpM_StallOnSendProblem)
+                            Stall();
+#endif // defined(MpM_StallOnSendProblem)
+                        }
+                    }
+                    ++nextIndex;
+                }
+            }
+            else
+            {
+                ++nextIndex;
+            }
+        }
+        else if (_loopPlayback)
+        {
+            nextIndex = _firstIndex;
+            _startTime = yarp::os::Time::now();
+        }
+        else
+        {
+            cerr << "All data sent." << endl;
+            atEnd = true;
+        }
+    }
+    // If we get here, the data was only sent once, without loopback...
+    for ( ; (! isStopping()); )
+    {
+        ConsumeSomeTime();
+    }
+    ODL_OBJEXIT(); //####
+} // PlaybackBlobInputThread::run
+
+bool
+PlaybackBlobInputThread::threadInit(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = true;
+
+    _startTime = yarp::os::Time::now();
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PlaybackBlobInputThread::threadInit
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
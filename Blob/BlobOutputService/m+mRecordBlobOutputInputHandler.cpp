@@ -38,6 +38,7 @@
 //--------------------------------------------------------------------------------------------------
 
 #include "m+mRecordBlobOutputInputHandler.hpp"
+#include "m+mBlobRecording.hpp"
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -85,7 +86,7 @@ using std::endl;
 #endif // defined(__APPLE__)
 
 RecordBlobOutputInputHandler::RecordBlobOutputInputHandler(void) :
-    inherited(), _outFile(NULL)
+    inherited(), _writer(NULL)
 {
     ODL_ENTER(); //####
     ODL_EXIT_P(this); //####
@@ -124,9 +125,9 @@ RecordBlobOutputInputHandler::handleInput(const yarp::os::Bottle &     input,
 
     try
     {
-        if (_outFile)
+        if (_writer)
         {
-            ODL_LOG("(_outFile)"); //####
+            ODL_LOG("(_writer)"); //####
             if (1 == input.size())
             {
                 yarp::os::Value & firstTopValue = input.get(0);
@@ -138,13 +139,10 @@ RecordBlobOutputInputHandler::handleInput(const yarp::os::Bottle &     input,
 
                     if ((0 < numBytes) && asBytes)
                     {
-                        size_t retVal = fwrite(asBytes, numBytes, 1, _outFile);
+                        int64_t timeStamp =
+                                    static_cast<int64_t>(yarp::os::Time::now() * 1000000.0);
 
-                        if (retVal == numBytes)
-                        {
-                            fflush(_outFile);
-                        }
-                        else
+                        if (! _writer->addRecord(timeStamp, asBytes, numBytes))
                         {
                             cerr << "Write error" << endl; //!!!!
                         }
@@ -178,13 +176,13 @@ RecordBlobOutputInputHandler::handleInput(const yarp::os::Bottle &     input,
 #endif // ! MAC_OR_LINUX_
 
 void
-RecordBlobOutputInputHandler::setFile(FILE * outFile)
+RecordBlobOutputInputHandler::setWriter(BlobRecordingWriter * writer)
 {
     ODL_OBJENTER(); //####
-    ODL_P1("outFile = ", outFile); //####
-    _outFile = outFile;
+    ODL_P1("writer = ", writer); //####
+    _writer = writer;
     ODL_OBJEXIT(); //####
-} // RecordBlobOutputInputHandler::setFile
+} // RecordBlobOutputInputHandler::setWriter
 
 #if defined(__APPLE__)
 # pragma mark Global functions
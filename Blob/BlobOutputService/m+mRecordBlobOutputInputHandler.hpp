@@ -58,6 +58,8 @@ namespace MplusM
 {
     namespace RecordBlob
     {
+        class BlobRecordingWriter;
+
         /*! @brief A handler for partially-structured input data.
 
          The data is expected to be in the form of arbitrary YARP messages. */
@@ -81,10 +83,10 @@ namespace MplusM
             virtual
             ~RecordBlobOutputInputHandler(void);
 
-            /*! @brief Set the file to be written to.
-             @param[in] outFile The file to be written to. */
+            /*! @brief Set the recording to be written to.
+             @param[in] writer The recording to be written to. */
             void
-            setFile(FILE * outFile);
+            setWriter(BlobRecordingWriter * writer);
 
         protected :
 
@@ -118,8 +120,8 @@ namespace MplusM
 
         private :
 
-            /*! @brief The file that is to be written to. */
-            FILE * _outFile;
+            /*! @brief The recording that is to be written to. */
+            BlobRecordingWriter * _writer;
 
         }; // RecordBlobOutputInputHandler
 
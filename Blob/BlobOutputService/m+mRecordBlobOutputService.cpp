@@ -98,7 +98,7 @@ RecordBlobOutputService::RecordBlobOutputService(const Utilities::DescriptorVect
                                                                              servicePortNumber) :
     inherited(argumentList, launchPath, argc, argv, tag, true, MpM_RECORDBLOBOUTPUT_CANONICAL_NAME_,
               RECORDBLOBOUTPUT_SERVICE_DESCRIPTION_, "", serviceEndpointName, servicePortNumber),
-    _outFile(NULL), _inHandler(new RecordBlobOutputInputHandler)
+    _writer(), _inHandler(new RecordBlobOutputInputHandler)
 {
     ODL_ENTER(); //####
     ODL_P2("argumentList = ", &argumentList, "argv = ", argv); //####
@@ -224,29 +224,18 @@ RecordBlobOutputService::startStreams(void)
         {
             int why;
 
-#if MAC_OR_LINUX_
-            _outFile = fopen(_outPath.c_str(), "w");
-            why = errno;
-#else // ! MAC_OR_LINUX_
-            why = fopen_s(&_outFile, _outPath.c_str(), "w");
-            if (why)
-            {
-                _outFile = NULL;
-            }
-#endif // ! MAC_OR_LINUX_
-            if (_outFile)
+            if (_writer.open(_outPath, why))
             {
                 if (_inHandler)
                 {
-                    _inHandler->setFile(_outFile);
+                    _inHandler->setWriter(&_writer);
                     _inHandler->setChannel(getInletStream(0));
                     getInletStream(0)->setReader(*_inHandler);
                     setActive();
                 }
                 else
                 {
-                    fclose(_outFile);
-                    _outFile = NULL;
+                    _writer.close();
                 }
             }
             else
@@ -274,10 +263,13 @@ RecordBlobOutputService::stopStreams(void)
         {
             if (_inHandler)
             {
-                _inHandler->setFile(NULL);
+                _inHandler->setWriter(NULL);
+            }
+            if (! _writer.close())
+            {
+                cerr << "Could not complete the index for file '" << _outPath.c_str() << "'." <<
+                        endl;
             }
-            fclose(_outFile);
-            _outFile = NULL;
             clearActive();
         }
     }
@@ -39,6 +39,8 @@
 #if (! defined(MpMRecordBlobOutputService_HPP_))
 # define MpMRecordBlobOutputService_HPP_ /* Header guard */
 
+# include "m+mBlobRecording.hpp"
+
 # include <m+m/m+mBaseOutputService.hpp>
 
 # if defined(__APPLE__)
@@ -160,8 +162,8 @@ namespace MplusM
             /*! @brief The path to the output file used for recording. */
             YarpString _outPath;
 
-            /*! @brief The file output to be written to. */
-            FILE * _outFile;
+            /*! @brief The recording to be written to. */
+            BlobRecordingWriter _writer;
 
             /*! @brief The handler for input data. */
             RecordBlobOutputInputHandler * _inHandler;
@@ -44,12 +44,18 @@
 #include "m+mTest10Service.hpp"
 #include "m+mTest11Service.hpp"
 #include "m+mTest12Service.hpp"
+#include "m+mTest15Producer.hpp"
+#include "m+mTest16Handler.hpp"
+#include "m+mTest18Handler.hpp"
 
 #include <m+m/m+mClientChannel.hpp>
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mGeneralChannel.hpp>
+#include <m+m/m+mMessageCompressor.hpp>
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mServiceRequest.hpp>
 #include <m+m/m+mServiceResponse.hpp>
+#include <m+m/m+mStringBuffer.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -83,6 +89,10 @@ using std::endl;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The result of a test case that can't be run in this build, which the test driver
+ reports as skipped. */
+static const int kSkippedTestResult = 77;
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -91,6 +101,30 @@ using std::endl;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Create a compressed message from its parts, so that damaged messages can be made.
+ @param[in] method The compression method to be recorded in the message.
+ @param[in] length The uncompressed size to be recorded in the message.
+ @param[in] data The compressed data.
+ @param[in] dataLength The number of bytes of compressed data.
+ @param[out] frame The compressed message. */
+static void
+doCreateCompressedFrame(const int          method,
+                        const int          length,
+                        const char *       data,
+                        const int          dataLength,
+                        yarp::os::Bottle & frame)
+{
+    ODL_ENTER(); //####
+    ODL_LL3("method = ", method, "length = ", length, "dataLength = ", dataLength); //####
+    ODL_P2("data = ", data, "frame = ", &frame); //####
+    frame.clear();
+    frame.addString(MpM_COMPRESSED_MESSAGE_MARKER_);
+    frame.addInt(method);
+    frame.addInt(length);
+    frame.add(yarp::os::Value(const_cast<char *>(data), dataLength));
+    ODL_EXIT(); //####
+} // doCreateCompressedFrame
+
 /*! @brief Create an endpoint for a test.
  @param[in] argc The number of arguments in 'argv'.
  @param[in] argv The arguments to be used with the endpoint constructor.
@@ -247,6 +281,26 @@ doDestroyTestChannel(Endpoint &      anEndpoint,
     doDestroyTestChannel(anEndpoint.getName(), theChannel);
 } // doDestroyTestChannel
 
+/*! @brief Write a message holding a single value to a channel.
+ @param[in] outChannel The channel to be written to.
+ @param[in] value The value to be sent.
+ @returns @c true if the message was written and @c false otherwise. */
+static bool
+doPostTestValue(GeneralChannel & outChannel,
+                const int        value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("outChannel = ", &outChannel); //####
+    ODL_LL1("value = ", value); //####
+    bool             result;
+    yarp::os::Bottle message;
+
+    message.addInt(value);
+    result = outChannel.write(message);
+    ODL_EXIT_B(result); //####
+    return result;
+} // doPostTestValue
+
 #if defined(__APPLE__)
 # pragma mark *** Test Case 01 ***
 #endif // defined(__APPLE__)
@@ -1674,119 +1728,1189 @@ doTestRequestEchoFromServiceWithRequestHandlerAndInfo(const char * launchPath,
     return result;
 } // doTestRequestEchoFromServiceWithRequestHandlerAndInfo
 
-/*! @brief The signal handler to catch requests to stop the service.
- @param[in] signal The signal being handled. */
-static void
-catchSignal(int signal)
+#if defined(__APPLE__)
+# pragma mark *** Test Case 13 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestConvertMessageToJSON(const char * launchPath,
+                           const int    argc,
+                           char * *     argv) // convert message to JSON
 {
+#if MAC_OR_LINUX_
+# pragma unused(launchPath)
+#endif // MAC_OR_LINUX_
     ODL_ENTER(); //####
-    ODL_LL1("signal = ", signal); //####
-    std::stringstream buff;
-    YarpString        message("Exiting due to signal ");
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
 
-    buff << signal;
-    message += buff.str();
-    message += " = ";
-    message += NameOfSignal(signal);
-    MpM_ERROR_(message.c_str());
-    ODL_EXIT_EXIT(1); //####
-    yarp::os::exit(1);
-} // catchSignal
+    try
+    {
+        if (2 == argc)
+        {
+            static const char    kValueTag[] = ", \"value\" : ";
+            static const char    kTrailer[] = " }\n";
+            YarpString           converted;
+            yarp::os::Bottle     input(argv[0]);
+#if defined(MpM_UseCustomStringBuffer)
+            Common::StringBuffer outBuffer;
+            size_t               outLength;
+
+            Utilities::ConvertMessageToJSON(outBuffer, input);
+            converted = YarpString(outBuffer.getString(outLength), outLength);
+#else // ! defined(MpM_UseCustomStringBuffer)
+            std::stringstream    outBuffer;
+
+            Utilities::ConvertMessageToJSON(outBuffer, input);
+            converted = outBuffer.str().c_str();
+#endif // ! defined(MpM_UseCustomStringBuffer)
+            ODL_S1s("converted <- ", converted); //####
+            size_t valueStart = converted.find(kValueTag);
+            size_t trailerLength = sizeof(kTrailer) - 1;
+
+            if ((YarpString::npos != valueStart) && (converted.length() > trailerLength))
+            {
+                valueStart += sizeof(kValueTag) - 1;
+                YarpString value(converted.substr(valueStart,
+                                                  converted.length() - valueStart - trailerLength));
+
+                ODL_S2("value = ", value.c_str(), "expected = ", argv[1]); //####
+                if (value == argv[1])
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (value == argv[1])"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((YarpString::npos != valueStart) && " //####
+                        "(converted.length() > trailerLength))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (2 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestConvertMessageToJSON
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
 
 #if defined(__APPLE__)
-# pragma mark Global functions
+# pragma mark *** Test Case 14 ***
 #endif // defined(__APPLE__)
 
-/*! @brief The entry point for unit tests of the m+m common classes.
-
- The first argument is the test number, the second argument is the name of the channel to be used
- with the test, the optional third argument is the machine to connect to and the optional fourth
- argument is the port number to be used. Output depends on the test being run.
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
  @param[in] argc The number of arguments in 'argv'.
- @param[in] argv The arguments to be used with the unit tests.
- @returns @c 0 on a successful test and @c 1 on failure. */
-int
-main(int      argc,
-     char * * argv)
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestSendViaMulticastGroup(const char * launchPath,
+                            const int    argc,
+                            char * *     argv) // send via multicast group
 {
-    YarpString progName(*argv);
-
-    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
-             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
-             kODLoggingOptionWriteToStderr); //####
-    ODL_ENTER(); //####
 #if MAC_OR_LINUX_
-    SetUpLogger(progName);
+# pragma unused(launchPath)
 #endif // MAC_OR_LINUX_
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
     int result = 1;
 
     try
     {
-        Utilities::SetUpGlobalStatusReporter();
-        Utilities::CheckForNameServerReporter();
-        if (Utilities::CheckForValidNetwork())
+        if (2 == argc)
         {
-            yarp::os::Network yarp; // This is necessary to establish any connections to the YARP
-                                    // infrastructure
-
-            Initialize(progName);
-            if (0 < --argc)
+            static const int  kMessageCount = 50;
+            const char *      startPtr = argv[1];
+            char *            endPtr;
+            int               port = static_cast<int>(strtol(startPtr, &endPtr, 10));
+            GeneralChannel    inChannel(false);
+            GeneralChannel    outChannel(true);
+            MulticastCounters inCounters;
+            MulticastCounters outCounters;
+            Test03Handler     handler;
+            YarpString        address(argv[0]);
+
+            inChannel.setReader(handler);
+            if ((startPtr != endPtr) && (! *endPtr) && inChannel.setMulticastGroup(address, port) &&
+                outChannel.setMulticastGroup(address, port))
             {
-                const char * startPtr = argv[1];
-                char *       endPtr;
-                int          selector = strtol(startPtr, &endPtr, 10);
+                // Give the receiver a chance to join the group before anything is sent.
+                ConsumeSomeTime(20.0);
+                for (int ii = 0; kMessageCount > ii; ++ii)
+                {
+                    yarp::os::Bottle message;
 
-                if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+                    message.addInt(ii);
+                    message.addString("howdi");
+                    outChannel.write(message);
+                }
+                for (int ii = 0; 50 > ii; ++ii)
                 {
-                    SetSignalHandlers(catchSignal);
-                    switch (selector)
+                    inChannel.getMulticastCounters(inCounters);
+                    if (kMessageCount <= inCounters._received)
                     {
-                        case 0 :
-                            // Just used to validate the random number seed.
-                            result = 0;
-                            break;
+                        break;
+                    }
 
-                        case 1 :
-                            result = doTestCreateEndpoint(*argv, argc - 1, argv + 2);
-                            break;
+                    ConsumeSomeTime();
+                }
+                outChannel.getMulticastCounters(outCounters);
+                ODL_LL3("sent = ", outCounters._sent, "received = ", inCounters._received, //####
+                        "lost = ", inCounters._lost); //####
+                if ((kMessageCount == outCounters._sent) &&
+                    (kMessageCount == inCounters._received) && (! inCounters._lost) &&
+                    (! inCounters._late))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! ((kMessageCount == outCounters._sent) && " //####
+                            "(kMessageCount == inCounters._received) && " //####
+                            "(! inCounters._lost) && (! inCounters._late))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((startPtr != endPtr) && (! *endPtr) && " //####
+                        "inChannel.setMulticastGroup(address, port) && " //####
+                        "outChannel.setMulticastGroup(address, port))"); //####
+            }
+            inChannel.setMulticastGroup("", 0);
+            outChannel.setMulticastGroup("", 0);
+        }
+        else
+        {
+            ODL_LOG("! (2 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestSendViaMulticastGroup
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
 
-                        case 2 :
-                            result = doTestConnectToEndpoint(*argv, argc - 1, argv + 2);
-                            break;
+#if defined(__APPLE__)
+# pragma mark *** Test Case 15 ***
+#endif // defined(__APPLE__)
 
-                        case 3 :
-                            result = doTestWriteToEndpoint(*argv, argc - 1, argv + 2);
-                            break;
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestPipelineQueue(const char * launchPath,
+                    const int    argc,
+                    char * *     argv) // pipeline queue
+{
+#if MAC_OR_LINUX_
+# pragma unused(launchPath)
+#endif // MAC_OR_LINUX_
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
 
-                        case 4 :
-                            result = doTestEchoFromEndpointWithReader(*argv, argc - 1, argv + 2);
-                            break;
+    try
+    {
+        if (2 == argc)
+        {
+            const char * capacityPtr = argv[0];
+            const char * countPtr = argv[1];
+            char *       capacityEnd;
+            char *       countEnd;
+            int          capacity = static_cast<int>(strtol(capacityPtr, &capacityEnd, 10));
+            int          count = static_cast<int>(strtol(countPtr, &countEnd, 10));
+
+            if ((capacityPtr != capacityEnd) && (! *capacityEnd) && (0 < capacity) &&
+                (countPtr != countEnd) && (! *countEnd) && (0 < count))
+            {
+                bool           okSoFar;
+                int            filled = 0;
+                PipelineQueue  queue(capacity);
+                Test15Producer producer(queue, count);
 
-                        case 5 :
-                            result = doTestEchoFromEndpointWithReaderCreator(*argv, argc - 1,
-                                                                             argv + 2);
-                            break;
+                // A full queue must refuse a message, and the messages must come back in order.
+                for (bool added = true; added; )
+                {
+                    yarp::os::Bottle * message = new yarp::os::Bottle;
 
-                        case 6 :
-                            result = doTestCreateRequest(*argv, argc - 1, argv + 2);
-                            break;
+                    message->addInt(filled);
+                    added = queue.push(message);
+                    if (added)
+                    {
+                        ++filled;
+                    }
+                    else
+                    {
+                        delete message;
+                    }
+                }
+                ODL_LL1("filled = ", filled); //####
+                okSoFar = ((capacity <= filled) && ((2 * capacity) > filled) &&
+                           (static_cast<size_t>(filled) == queue.depth()));
+                for (int ii = 0; okSoFar && (filled > ii); ++ii)
+                {
+                    yarp::os::Bottle * message = queue.pop();
 
-                        case 7 :
-                            result = doTestCreateResponse(*argv, argc - 1, argv + 2);
-                            break;
+                    okSoFar = (message && (ii == message->get(0).asInt()));
+                    delete message;
+                }
+                if (okSoFar && queue.isEmpty() && producer.start())
+                {
+                    // Drain the queue from this thread while the producer fills it.
+                    double deadline = yarp::os::Time::now() + 60.0;
+                    int    expected = 0;
 
-                        case 8 :
-                            result = doTestRequestEchoFromEndpoint(*argv, argc - 1, argv + 2);
-                            break;
+                    for ( ; okSoFar && (count > expected) && (yarp::os::Time::now() < deadline); )
+                    {
+                        yarp::os::Bottle * message = queue.pop();
 
-                        case 9 :
-                            result = doTestRequestEchoFromServiceUsingDefaultWithReader(*argv,
-                                                                                        argc - 1,
-                                                                                        argv + 2);
-                            break;
+                        if (message)
+                        {
+                            okSoFar = (expected == message->get(0).asInt());
+                            ++expected;
+                            delete message;
+                        }
+                        else
+                        {
+                            yarp::os::Time::yield();
+                        }
+                    }
+                    producer.stop();
+                    ODL_LL2("expected = ", expected, "fullCount = ", //####
+                            producer.fullCount()); //####
+                    if (okSoFar && (count == expected) && queue.isEmpty())
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (okSoFar && (count == expected) && queue.isEmpty())"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (okSoFar && queue.isEmpty() && producer.start())"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((capacityPtr != capacityEnd) && (! *capacityEnd) && " //####
+                        "(0 < capacity) && (countPtr != countEnd) && (! *countEnd) && " //####
+                        "(0 < count))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (2 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestPipelineQueue
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
 
-                        case 10 :
-                            result =
+#if defined(__APPLE__)
+# pragma mark *** Test Case 16 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestBatchMessages(const char * launchPath,
+                    const int    argc,
+                    char * *     argv) // batch messages
+{
+#if MAC_OR_LINUX_
+# pragma unused(launchPath)
+#endif // MAC_OR_LINUX_
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        if (1 == argc)
+        {
+            static const int kMessageCount = 100;
+            YarpString       flushBy(argv[0]);
+            bool             bySize = (flushBy == "size");
+            GeneralChannel   inChannel(false);
+            GeneralChannel   outChannel(true);
+            Test16Handler    handler;
+            YarpString       inName(GetRandomChannelName("_test_/batchmessages_in_"));
+            YarpString       outName(GetRandomChannelName("_test_/batchmessages_out_"));
+
+            handler.setChannel(&inChannel);
+            handler.enableMetrics();
+            inChannel.enableMetrics();
+            inChannel.setReader(handler);
+            // A small batch size with a long delay only flushes full batches, while a large batch
+            // size with a short delay only flushes batches that have waited.
+            if ((bySize || (flushBy == "delay")) &&
+                inChannel.openWithRetries(inName, STANDARD_WAIT_TIME_) &&
+                outChannel.openWithRetries(outName, STANDARD_WAIT_TIME_) &&
+                Utilities::NetworkConnectWithRetries(outName, inName, STANDARD_WAIT_TIME_) &&
+                outChannel.setBatching(bySize ? 256 : 1000000, bySize ? 60.0 : 0.5))
+            {
+                bool                 inOrder = false;
+                bool                 okSoFar = true;
+                double               deadline;
+                int                  received = 0;
+                MessageBatchCounters batchCounters;
+                SendReceiveCounters  inCounters;
+
+                for (int ii = 0; okSoFar && (kMessageCount > ii); ++ii)
+                {
+                    yarp::os::Bottle message;
+
+                    message.addInt(ii);
+                    message.addString("howdi");
+                    okSoFar = outChannel.write(message);
+                }
+                // Only a full batch can have been written before the delay has passed.
+                okSoFar = (okSoFar && outChannel.getBatchCounters(batchCounters) &&
+                           (bySize ? (0 < batchCounters._frames) : (0 == batchCounters._frames)));
+                if (okSoFar && bySize)
+                {
+                    // Stopping the batcher writes the partial batch that is still waiting.
+                    okSoFar = outChannel.setBatching(0, 0);
+                }
+                deadline = yarp::os::Time::now() + 10.0;
+                for ( ; okSoFar && (kMessageCount > received) &&
+                     (yarp::os::Time::now() < deadline); )
+                {
+                    received = handler.count(inOrder);
+                    if (kMessageCount > received)
+                    {
+                        ConsumeSomeTime();
+                    }
+                }
+                if (okSoFar && (! bySize))
+                {
+                    okSoFar = (outChannel.getBatchCounters(batchCounters) &&
+                               (0 < batchCounters._frames) && (! batchCounters._failed) &&
+                               (kMessageCount == (batchCounters._direct +
+                                                  batchCounters._messages)));
+                }
+                inChannel.getSendReceiveCounters(inCounters);
+                ODL_LL3("received = ", received, "inMessages = ", inCounters.inMessages(), //####
+                        "frames = ", batchCounters._frames); //####
+                if (okSoFar && inOrder && (kMessageCount == received) &&
+                    (kMessageCount == static_cast<int>(inCounters.inMessages())))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (okSoFar && inOrder && (kMessageCount == received) && " //####
+                            "(kMessageCount == static_cast<int>(inCounters.inMessages())))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((bySize || (flushBy == \"delay\")) && " //####
+                        "inChannel.openWithRetries(inName, STANDARD_WAIT_TIME_) && " //####
+                        "outChannel.openWithRetries(outName, STANDARD_WAIT_TIME_) && " //####
+                        "Utilities::NetworkConnectWithRetries(outName, inName, " //####
+                        "STANDARD_WAIT_TIME_) && outChannel.setBatching(bySize ? 256 : " //####
+                        "1000000, bySize ? 60.0 : 0.5))"); //####
+            }
+            outChannel.setBatching(0, 0);
+        }
+        else
+        {
+            ODL_LOG("! (1 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestBatchMessages
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 17 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestCompressMessages(const char * launchPath,
+                       const int    argc,
+                       char * *     argv) // compress messages
+{
+#if MAC_OR_LINUX_
+# pragma unused(launchPath)
+#endif // MAC_OR_LINUX_
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        CompressionMethod method;
+
+        if ((1 == argc) && MessageCompressor::ParseCompressionMethod(argv[0], method) &&
+            (kCompressionMethodNone != method))
+        {
+            static const size_t kThreshold = 1024;
+            MessageCompressor   compressor(method, kThreshold);
+            yarp::os::Bottle    frame;
+            yarp::os::Bottle    largeMessage;
+            yarp::os::Bottle    restored;
+            yarp::os::Bottle    smallMessage;
+            size_t              uncompressedSize = 0;
+
+            smallMessage.addString("howdi");
+            for (int ii = 0; 200 > ii; ++ii)
+            {
+                largeMessage.addInt(ii);
+                largeMessage.addString("howdi");
+            }
+            if (MessageCompressor::IsAvailable())
+            {
+                if (compressor.open("") &&
+                    (! compressor.compress(smallMessage, frame, uncompressedSize)) &&
+                    compressor.compress(largeMessage, frame, uncompressedSize) &&
+                    (kThreshold <= uncompressedSize))
+                {
+                    size_t restoredSize = 0;
+
+                    if (MessageCompressor::Decompress(frame, restored, restoredSize) &&
+                        (uncompressedSize == restoredSize) &&
+                        (restored.toString() == largeMessage.toString()))
+                    {
+                        yarp::os::Value & data = frame.get(3);
+                        const char *      compressed = data.asBlob();
+                        int               compressedLength =
+                                                        static_cast<int>(data.asBlobLength());
+                        int               length = frame.get(2).asInt();
+                        std::vector<char> noise(64, '\xFF');
+                        yarp::os::Bottle  damaged;
+
+                        // A wrong uncompressed size, a size past the limit, truncated data and
+                        // data that is not compressed at all must all be rejected.
+                        result = 0;
+                        doCreateCompressedFrame(method, length + 1, compressed, compressedLength,
+                                                damaged);
+                        if (MessageCompressor::Decompress(damaged, restored, restoredSize))
+                        {
+                            ODL_LOG("(MessageCompressor::Decompress(damaged, restored, " //####
+                                    "restoredSize))"); //####
+                            result = 1;
+                        }
+                        doCreateCompressedFrame(method, 0x7FFFFFFF, compressed, compressedLength,
+                                                damaged);
+                        if (MessageCompressor::Decompress(damaged, restored, restoredSize))
+                        {
+                            ODL_LOG("(MessageCompressor::Decompress(damaged, restored, " //####
+                                    "restoredSize))"); //####
+                            result = 1;
+                        }
+                        doCreateCompressedFrame(method, length, compressed, compressedLength / 2,
+                                                damaged);
+                        if (MessageCompressor::Decompress(damaged, restored, restoredSize))
+                        {
+                            ODL_LOG("(MessageCompressor::Decompress(damaged, restored, " //####
+                                    "restoredSize))"); //####
+                            result = 1;
+                        }
+                        doCreateCompressedFrame(method, length, &noise[0],
+                                                static_cast<int>(noise.size()), damaged);
+                        if (MessageCompressor::Decompress(damaged, restored, restoredSize))
+                        {
+                            ODL_LOG("(MessageCompressor::Decompress(damaged, restored, " //####
+                                    "restoredSize))"); //####
+                            result = 1;
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! (MessageCompressor::Decompress(frame, restored, " //####
+                                "restoredSize) && (uncompressedSize == restoredSize) && " //####
+                                "(restored.toString() == largeMessage.toString()))"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (compressor.open(\"\") && " //####
+                            "(! compressor.compress(smallMessage, frame, " //####
+                            "uncompressedSize)) && compressor.compress(largeMessage, " //####
+                            "frame, uncompressedSize) && (kThreshold <= " //####
+                            "uncompressedSize))"); //####
+                }
+            }
+            else if (! compressor.compress(largeMessage, frame, uncompressedSize))
+            {
+                // Without compression support, messages are always sent as is.
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("(compressor.compress(largeMessage, frame, uncompressedSize))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((1 == argc) && MessageCompressor::ParseCompressionMethod(argv[0], " //####
+                    "method) && (kCompressionMethodNone != method))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestCompressMessages
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 18 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestOutputQueuePolicy(const char * launchPath,
+                        const int    argc,
+                        char * *     argv) // output queue policy
+{
+#if MAC_OR_LINUX_
+# pragma unused(launchPath)
+#endif // MAC_OR_LINUX_
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        OutputQueuePolicy policy;
+
+        if ((1 == argc) && GeneralChannel::ParseOutputQueuePolicy(argv[0], policy))
+        {
+            static const int kCapacity = 3;
+            static const int kMessageCount = 7;
+            // The messages that get through when the writer is held up by the first message and
+            // the other six are posted to a queue with room for three.
+            static const int kBlockValues[] = { 0, 1, 2, 3, 4, 5, 6 };
+            static const int kConflateValues[] = { 0, 1, 2, 6 };
+            static const int kDropNewestValues[] = { 0, 1, 2, 3 };
+            static const int kDropOldestValues[] = { 0, 4, 5, 6 };
+            const int *      expectedValues;
+            int              expectedCount;
+            int              toPost;
+            GeneralChannel   inChannel(false);
+            GeneralChannel   outChannel(true);
+            Test18Handler    handler;
+            YarpString       inName(GetRandomChannelName("_test_/outputqueue_in_"));
+            YarpString       outName(GetRandomChannelName("_test_/outputqueue_out_"));
+
+            switch (policy)
+            {
+                case kOutputQueuePolicyBlock :
+                    expectedValues = kBlockValues;
+                    break;
+
+                case kOutputQueuePolicyConflate :
+                    expectedValues = kConflateValues;
+                    break;
+
+                case kOutputQueuePolicyDropOldest :
+                    expectedValues = kDropOldestValues;
+                    break;
+
+                default :
+                    expectedValues = kDropNewestValues;
+                    break;
+
+            }
+            // Only as many messages as will fit in the queue are posted while the writer is held
+            // up if posting to a full queue waits, and then none are lost; otherwise, only the
+            // message that is holding up the writer and those in the queue get through.
+            if (kOutputQueuePolicyBlock == policy)
+            {
+                expectedCount = kMessageCount;
+                toPost = kCapacity + 1;
+            }
+            else
+            {
+                expectedCount = kCapacity + 1;
+                toPost = kMessageCount;
+            }
+            handler.setChannel(&inChannel);
+            inChannel.setReader(handler);
+            if (inChannel.openWithRetries(inName, STANDARD_WAIT_TIME_) &&
+                outChannel.openWithRetries(outName, STANDARD_WAIT_TIME_) &&
+                Utilities::NetworkConnectWithRetries(outName, inName, STANDARD_WAIT_TIME_) &&
+                outChannel.setOutputQueue(kCapacity, policy))
+            {
+                bool                okSoFar = doPostTestValue(outChannel, 0);
+                double              deadline;
+                OutputQueueCounters counters;
+                std::vector<int>    values;
+
+                if (okSoFar)
+                {
+                    // Wait for the first message to reach the reader and hold up the writer.
+                    deadline = yarp::os::Time::now() + 10.0;
+                    for (handler.received(values); values.empty() &&
+                         (yarp::os::Time::now() < deadline); handler.received(values))
+                    {
+                        ConsumeSomeTime();
+                    }
+                    okSoFar = (1 == values.size());
+                }
+                for (int ii = 1; okSoFar && (toPost > ii); ++ii)
+                {
+                    okSoFar = doPostTestValue(outChannel, ii);
+                }
+                // The queue is full and the writer is waiting for the reader, so the counters
+                // can't change until the reader is released.
+                okSoFar = (okSoFar && outChannel.getOutputQueueCounters(counters) &&
+                           (kCapacity == static_cast<int>(counters._depth)) &&
+                           (kCapacity == static_cast<int>(counters._maximumDepth)) &&
+                           ((toPost - kCapacity - 1) == counters._dropped) &&
+                           (! counters._written));
+                handler.release();
+                for (int ii = toPost; okSoFar && (kMessageCount > ii); ++ii)
+                {
+                    okSoFar = doPostTestValue(outChannel, ii);
+                }
+                deadline = yarp::os::Time::now() + 10.0;
+                for (bool done = false; okSoFar && (! done) &&
+                     (yarp::os::Time::now() < deadline); )
+                {
+                    okSoFar = outChannel.getOutputQueueCounters(counters);
+                    done = (expectedCount <= (counters._written + counters._failed));
+                    if (! done)
+                    {
+                        ConsumeSomeTime();
+                    }
+                }
+                // A message is only counted as written once the reader has handled it, so all the
+                // values are in.
+                handler.received(values);
+                ODL_LL4("received = ", values.size(), "written = ", counters._written, //####
+                        "dropped = ", counters._dropped, "failed = ", counters._failed); //####
+                if (okSoFar && (expectedCount == static_cast<int>(values.size())) &&
+                    std::equal(values.begin(), values.end(), expectedValues) &&
+                    (expectedCount == counters._written) && (! counters._failed) &&
+                    (! counters._depth) &&
+                    (kCapacity == static_cast<int>(counters._maximumDepth)) &&
+                    ((kMessageCount - expectedCount) == counters._dropped))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (okSoFar && (expectedCount == static_cast<int>(" //####
+                            "values.size())) && std::equal(values.begin(), " //####
+                            "values.end(), expectedValues) && (expectedCount == " //####
+                            "counters._written) && (! counters._failed) && " //####
+                            "(! counters._depth) && (kCapacity == " //####
+                            "static_cast<int>(counters._maximumDepth)) && " //####
+                            "((kMessageCount - expectedCount) == counters._dropped))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (inChannel.openWithRetries(inName, STANDARD_WAIT_TIME_) && " //####
+                        "outChannel.openWithRetries(outName, STANDARD_WAIT_TIME_) && " //####
+                        "Utilities::NetworkConnectWithRetries(outName, inName, " //####
+                        "STANDARD_WAIT_TIME_) && outChannel.setOutputQueue(kCapacity, " //####
+                        "policy))"); //####
+            }
+            // The writer can't stop while the reader is holding it up.
+            handler.release();
+            outChannel.setOutputQueue(0, policy);
+        }
+        else
+        {
+            ODL_LOG("! ((1 == argc) && GeneralChannel::ParseOutputQueuePolicy(argv[0], " //####
+                    "policy))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestOutputQueuePolicy
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 19 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestSendViaSharedMemory(const char * launchPath,
+                          const int    argc,
+                          char * *     argv) // send via shared memory
+{
+#if MAC_OR_LINUX_
+# pragma unused(launchPath,argv)
+#endif // MAC_OR_LINUX_
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        if (0 == argc)
+        {
+            static const int kMessageCount = 100;
+            GeneralChannel   inChannel(false);
+            GeneralChannel   outChannel(true);
+            Test16Handler    handler;
+            YarpString       inName(GetRandomChannelName("_test_/sharedmemory_in_"));
+            YarpString       outName(GetRandomChannelName("_test_/sharedmemory_out_"));
+
+            handler.setChannel(&inChannel);
+            inChannel.setReader(handler);
+            if (inChannel.openWithRetries(inName, STANDARD_WAIT_TIME_) &&
+                outChannel.openWithRetries(outName, STANDARD_WAIT_TIME_) &&
+                Utilities::NetworkConnectWithRetries(outName, inName, STANDARD_WAIT_TIME_))
+            {
+                bool          inOrder = false;
+                bool          okSoFar;
+                double        deadline;
+                int           received = 0;
+                ChannelVector inputs;
+                ChannelVector outputs;
+
+                // Both channels are in this process, so the connection uses shared memory if the
+                // transport is enabled.
+                okSoFar = (Utilities::GatherPortConnections(outName, inputs, outputs,
+                                                            Utilities::kInputAndOutputOutput,
+                                                            true) &&
+                           (1 == outputs.size()) && (outputs[0]._portName == inName));
+                if (okSoFar)
+                {
+                    ODL_LL1("portMode = ", outputs[0]._portMode); //####
+#if defined(MpM_UseSharedMemoryTransport)
+                    okSoFar = (kChannelModeOther == outputs[0]._portMode);
+#else // ! defined(MpM_UseSharedMemoryTransport)
+                    okSoFar = (kChannelModeTCP == outputs[0]._portMode);
+#endif // ! defined(MpM_UseSharedMemoryTransport)
+                }
+                for (int ii = 0; okSoFar && (kMessageCount > ii); ++ii)
+                {
+                    okSoFar = doPostTestValue(outChannel, ii);
+                }
+                deadline = yarp::os::Time::now() + 10.0;
+                for ( ; okSoFar && (kMessageCount > received) &&
+                     (yarp::os::Time::now() < deadline); )
+                {
+                    received = handler.count(inOrder);
+                    if (kMessageCount > received)
+                    {
+                        ConsumeSomeTime();
+                    }
+                }
+                if (okSoFar && inOrder && (kMessageCount == received))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (okSoFar && inOrder && (kMessageCount == received))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (inChannel.openWithRetries(inName, STANDARD_WAIT_TIME_) && " //####
+                        "outChannel.openWithRetries(outName, STANDARD_WAIT_TIME_) && " //####
+                        "Utilities::NetworkConnectWithRetries(outName, inName, " //####
+                        "STANDARD_WAIT_TIME_))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestSendViaSharedMemory
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 20 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success, @c kSkippedTestResult if m+m was built without message compression and
+ @c 1 on failure. */
+static int
+doTestSendCompressedMessages(const char * launchPath,
+                             const int    argc,
+                             char * *     argv) // send compressed messages
+{
+#if MAC_OR_LINUX_
+# pragma unused(launchPath)
+#endif // MAC_OR_LINUX_
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        CompressionMethod method;
+
+        if ((1 == argc) && MessageCompressor::ParseCompressionMethod(argv[0], method) &&
+            (kCompressionMethodNone != method))
+        {
+            if (MessageCompressor::IsAvailable())
+            {
+                static const int    kMessageCount = 100;
+                static const size_t kThreshold = 1024;
+                GeneralChannel      inChannel(false);
+                GeneralChannel      outChannel(true);
+                Test16Handler       handler;
+                YarpString          inName(GetRandomChannelName("_test_/compressed_in_"));
+                YarpString          outName(GetRandomChannelName("_test_/compressed_out_"));
+
+                handler.setChannel(&inChannel);
+                handler.enableMetrics();
+                inChannel.enableMetrics();
+                inChannel.setReader(handler);
+                outChannel.enableMetrics();
+                if (inChannel.openWithRetries(inName, STANDARD_WAIT_TIME_) &&
+                    outChannel.openWithRetries(outName, STANDARD_WAIT_TIME_) &&
+                    Utilities::NetworkConnectWithRetries(outName, inName, STANDARD_WAIT_TIME_) &&
+                    outChannel.setCompression(method, kThreshold))
+                {
+                    bool                inOrder = false;
+                    bool                okSoFar = true;
+                    double              deadline;
+                    int                 received = 0;
+                    std::vector<char>   noise(64, '\xFF');
+                    yarp::os::Bottle    damaged;
+                    SendReceiveCounters inCounters;
+                    SendReceiveCounters outCounters;
+
+                    // Every other message is large enough to be compressed.
+                    for (int ii = 0; okSoFar && (kMessageCount > ii); ++ii)
+                    {
+                        yarp::os::Bottle message;
+
+                        message.addInt(ii);
+                        for (int jj = 0, mm = ((ii & 1) ? 200 : 1); mm > jj; ++jj)
+                        {
+                            message.addString("howdi");
+                        }
+                        okSoFar = outChannel.writeBottle(message);
+                    }
+                    // A compressed message that can't be restored is counted but not delivered;
+                    // it is too small to be compressed again on the way out.
+                    doCreateCompressedFrame(method, 1000, &noise[0],
+                                            static_cast<int>(noise.size()), damaged);
+                    okSoFar = (okSoFar && outChannel.writeBottle(damaged));
+                    deadline = yarp::os::Time::now() + 10.0;
+                    for ( ; okSoFar && ((kMessageCount > received) ||
+                                        (! inChannel.undecodableMessages())) &&
+                         (yarp::os::Time::now() < deadline); )
+                    {
+                        received = handler.count(inOrder);
+                        if ((kMessageCount > received) || (! inChannel.undecodableMessages()))
+                        {
+                            ConsumeSomeTime();
+                        }
+                    }
+                    inChannel.getSendReceiveCounters(inCounters);
+                    outChannel.getSendReceiveCounters(outCounters);
+                    ODL_LL3("received = ", received, "inMessages = ", //####
+                            inCounters.inMessages(), "undecodable = ", //####
+                            inChannel.undecodableMessages()); //####
+                    ODL_LL2("inBytes = ", inCounters.inBytes(), //####
+                            "inUncompressedBytes = ", inCounters.inUncompressedBytes()); //####
+                    if (okSoFar && inOrder && (kMessageCount == received) &&
+                        (1 == inChannel.undecodableMessages()) &&
+                        ((kMessageCount + 1) == static_cast<int>(inCounters.inMessages())) &&
+                        (inCounters.inBytes() < inCounters.inUncompressedBytes()) &&
+                        ((kMessageCount + 1) == static_cast<int>(outCounters.outMessages())) &&
+                        (outCounters.outBytes() < outCounters.outUncompressedBytes()))
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (okSoFar && inOrder && (kMessageCount == received) && " //####
+                                "(1 == inChannel.undecodableMessages()) && " //####
+                                "((kMessageCount + 1) == static_cast<int>(" //####
+                                "inCounters.inMessages())) && (inCounters.inBytes() < " //####
+                                "inCounters.inUncompressedBytes()) && ((kMessageCount + " //####
+                                "1) == static_cast<int>(outCounters.outMessages())) && " //####
+                                "(outCounters.outBytes() < " //####
+                                "outCounters.outUncompressedBytes()))"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (inChannel.openWithRetries(inName, STANDARD_WAIT_TIME_) && " //####
+                            "outChannel.openWithRetries(outName, STANDARD_WAIT_TIME_) && " //####
+                            "Utilities::NetworkConnectWithRetries(outName, inName, " //####
+                            "STANDARD_WAIT_TIME_) && outChannel.setCompression(method, " //####
+                            "kThreshold))"); //####
+                }
+            }
+            else
+            {
+                // Without compression support, there is nothing to send compressed.
+                ODL_LOG("! (MessageCompressor::IsAvailable())"); //####
+                result = kSkippedTestResult;
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((1 == argc) && MessageCompressor::ParseCompressionMethod(argv[0], " //####
+                    "method) && (kCompressionMethodNone != method))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestSendCompressedMessages
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+/*! @brief The signal handler to catch requests to stop the service.
+ @param[in] signal The signal being handled. */
+static void
+catchSignal(int signal)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("signal = ", signal); //####
+    std::stringstream buff;
+    YarpString        message("Exiting due to signal ");
+
+    buff << signal;
+    message += buff.str();
+    message += " = ";
+    message += NameOfSignal(signal);
+    MpM_ERROR_(message.c_str());
+    ODL_EXIT_EXIT(1); //####
+    yarp::os::exit(1);
+} // catchSignal
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for unit tests of the m+m common classes.
+
+ The first argument is the test number, the second argument is the name of the channel to be used
+ with the test, the optional third argument is the machine to connect to and the optional fourth
+ argument is the port number to be used. Output depends on the test being run.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the unit tests.
+ @returns @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        Utilities::SetUpGlobalStatusReporter();
+        Utilities::CheckForNameServerReporter();
+        if (Utilities::CheckForValidNetwork())
+        {
+            yarp::os::Network yarp; // This is necessary to establish any connections to the YARP
+                                    // infrastructure
+
+            Initialize(progName);
+            if (0 < --argc)
+            {
+                const char * startPtr = argv[1];
+                char *       endPtr;
+                int          selector = strtol(startPtr, &endPtr, 10);
+
+                if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+                {
+                    SetSignalHandlers(catchSignal);
+                    switch (selector)
+                    {
+                        case 0 :
+                            // Just used to validate the random number seed.
+                            result = 0;
+                            break;
+
+                        case 1 :
+                            result = doTestCreateEndpoint(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 2 :
+                            result = doTestConnectToEndpoint(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 3 :
+                            result = doTestWriteToEndpoint(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 4 :
+                            result = doTestEchoFromEndpointWithReader(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 5 :
+                            result = doTestEchoFromEndpointWithReaderCreator(*argv, argc - 1,
+                                                                             argv + 2);
+                            break;
+
+                        case 6 :
+                            result = doTestCreateRequest(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 7 :
+                            result = doTestCreateResponse(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 8 :
+                            result = doTestRequestEchoFromEndpoint(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 9 :
+                            result = doTestRequestEchoFromServiceUsingDefaultWithReader(*argv,
+                                                                                        argc - 1,
+                                                                                        argv + 2);
+                            break;
+
+                        case 10 :
+                            result =
                             doTestRequestEchoFromServiceUsingDefaultWithReaderCreator(*argv,
                                                                                       argc - 1,
                                                                                       argv + 2);
@@ -1803,6 +2927,38 @@ main(int      argc,
                                                                                        argv + 2);
                             break;
 
+                        case 13 :
+                            result = doTestConvertMessageToJSON(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 14 :
+                            result = doTestSendViaMulticastGroup(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 15 :
+                            result = doTestPipelineQueue(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 16 :
+                            result = doTestBatchMessages(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 17 :
+                            result = doTestCompressMessages(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 18 :
+                            result = doTestOutputQueuePolicy(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 19 :
+                            result = doTestSendViaSharedMemory(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 20 :
+                            result = doTestSendCompressedMessages(*argv, argc - 1, argv + 2);
+                            break;
+
                         default :
                             break;
 
@@ -0,0 +1,133 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest15Producer.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that fills a pipeline queue for the unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMTest15Producer_HPP_))
+# define MpMTest15Producer_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mPipelineQueue.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that fills a pipeline queue for the unit tests. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Test
+    {
+        /*! @brief A thread that adds numbered messages to a pipeline queue, retrying when the queue
+         is full. */
+        class Test15Producer : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] queue The queue to be filled.
+             @param[in] count The number of messages to add. */
+            Test15Producer(Common::PipelineQueue & queue,
+                           const int               count);
+
+            /*! @brief The destructor. */
+            virtual
+            ~Test15Producer(void);
+
+            /*! @brief Return the number of times that the queue was found to be full.
+             @returns The number of times that the queue was found to be full. */
+            inline int
+            fullCount(void)
+            const
+            {
+                return _fullCount;
+            } // fullCount
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            Test15Producer(const Test15Producer & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            Test15Producer &
+            operator =(const Test15Producer & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The queue to be filled. */
+            Common::PipelineQueue & _queue;
+
+            /*! @brief The number of messages to add. */
+            int _count;
+
+            /*! @brief The number of times that the queue was found to be full. */
+            int _fullCount;
+
+        }; // Test15Producer
+
+    } // Test
+
+} // MplusM
+
+#endif // ! defined(MpMTest15Producer_HPP_)
@@ -0,0 +1,169 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest18Handler.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for an input handler that stalls for the unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mTest18Handler.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for an input handler that stalls for the unit tests. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Test;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+Test18Handler::Test18Handler(void) :
+    inherited(), _values(), _lock(), _gate(0), _stalled(true)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // Test18Handler::Test18Handler
+
+Test18Handler::~Test18Handler(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // Test18Handler::~Test18Handler
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+Test18Handler::handleInput(const yarp::os::Bottle &     input,
+                           const YarpString &           senderChannel,
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           const size_t                 numBytes)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(senderChannel,replyMechanism,numBytes)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_L1("numBytes = ", numBytes); //####
+    bool result = ((0 < input.size()) && input.get(0).isInt());
+    bool stalled;
+
+    _lock.lock();
+    _values.push_back(result ? input.get(0).asInt() : -1);
+    stalled = _stalled;
+    _lock.unlock();
+    // The sender is not acknowledged until the handler returns, so holding up the handler
+    // stalls the writer of the channel.
+    if (stalled)
+    {
+        _gate.wait();
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // Test18Handler::handleInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+void
+Test18Handler::received(std::vector<int> & values)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("values = ", &values); //####
+    _lock.lock();
+    values = _values;
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // Test18Handler::received
+
+void
+Test18Handler::release(void)
+{
+    ODL_OBJENTER(); //####
+    bool wasStalled;
+
+    _lock.lock();
+    wasStalled = _stalled;
+    _stalled = false;
+    _lock.unlock();
+    if (wasStalled)
+    {
+        _gate.post();
+    }
+    ODL_OBJEXIT(); //####
+} // Test18Handler::release
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
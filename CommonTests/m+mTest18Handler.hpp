@@ -0,0 +1,150 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest18Handler.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for an input handler that stalls for the unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMTest18Handler_HPP_))
+# define MpMTest18Handler_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseInputHandler.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for an input handler that stalls for the unit tests. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Test
+    {
+        /*! @brief A test input handler that records the messages that it receives and holds up
+         the channel after the first one until it is released. */
+        class Test18Handler : public Common::BaseInputHandler
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseInputHandler inherited;
+
+        public :
+
+            /*! @brief The constructor. */
+            Test18Handler(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~Test18Handler(void);
+
+            /*! @brief Return the values of the messages that have been received.
+             @param[out] values The first value of each message, in the order received. */
+            void
+            received(std::vector<int> & values);
+
+            /*! @brief Let the stalled message and all the messages after it through. */
+            void
+            release(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            Test18Handler(const Test18Handler & other);
+
+            /*! @brief Process partially-structured input data.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @returns @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleInput(const yarp::os::Bottle &     input,
+                        const YarpString &           senderChannel,
+                        yarp::os::ConnectionWriter * replyMechanism,
+                        const size_t                 numBytes);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            Test18Handler &
+            operator =(const Test18Handler & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The first value of each message, in the order received. */
+            std::vector<int> _values;
+
+            /*! @brief The contention lock used to guard the values. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Signalled when the handler is released. */
+            yarp::os::Semaphore _gate;
+
+            /*! @brief @c true if the handler has not been released and @c false otherwise. */
+            bool _stalled;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // Test18Handler
+
+    } // Test
+
+} // MplusM
+
+#endif // ! defined(MpMTest18Handler_HPP_)
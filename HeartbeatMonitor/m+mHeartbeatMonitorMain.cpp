@@ -0,0 +1,467 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mHeartbeatMonitorMain.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The main application for the heartbeat monitor utility.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <m+m/m+mAddressArgumentDescriptor.hpp>
+#include <m+m/m+mHeartbeatPacket.hpp>
+#include <m+m/m+mPortArgumentDescriptor.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <poll.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+
+/*! @file
+ @brief A utility application to display the activity of services that send heartbeats. */
+
+/*! @dir HeartbeatMonitor
+ @brief The set of files that implement the Heartbeat Monitor application. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The most recent heartbeat from a service. */
+struct ServiceState
+{
+    /*! @brief The activity of the channels of the service. */
+    HeartbeatChannelVector _channels;
+
+    /*! @brief The time at which the most recent heartbeat arrived. */
+    double _lastSeen;
+
+    /*! @brief The time, in seconds, between heartbeats from the service. */
+    double _interval;
+
+    /*! @brief The number of heartbeats that did not arrive. */
+    int64_t _lost;
+
+    /*! @brief The sequence number of the most recent heartbeat. */
+    uint32_t _sequence;
+
+    /*! @brief @c true if the service is active and @c false otherwise. */
+    bool _started;
+
+    /*! @brief @c true if some channels were left out of the most recent heartbeat and @c false
+     otherwise. */
+    bool _truncated;
+
+}; // ServiceState
+
+/*! @brief The most recent heartbeat from each service. */
+typedef std::map<YarpString, ServiceState> ServiceStateMap;
+
+/*! @brief The time, in milliseconds, to wait for a heartbeat before checking for a report or an
+ exit request. */
+static const int kPollTime = 100;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Release a socket.
+ @param[in,out] aSocket The socket to be released. */
+static void
+closeSocket(SOCKET & aSocket)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aSocket = ", &aSocket); //####
+    if (INVALID_SOCKET != aSocket)
+    {
+#if MAC_OR_LINUX_
+        ::close(aSocket);
+#else // ! MAC_OR_LINUX_
+        closesocket(aSocket);
+#endif // ! MAC_OR_LINUX_
+        aSocket = INVALID_SOCKET;
+    }
+    ODL_EXIT(); //####
+} // closeSocket
+
+/*! @brief Create a UDP socket to receive heartbeats.
+ @param[in] port The port that the heartbeats are sent to.
+ @param[in] group The multicast group that the heartbeats are sent to, or '0.0.0.0' if the
+ heartbeats are sent to this machine.
+ @returns The new socket, or @c INVALID_SOCKET if the socket could not be created. */
+static SOCKET
+createListenSocket(const int          port,
+                   const YarpString & group)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("port = ", port); //####
+    ODL_S1s("group = ", group); //####
+    struct in_addr groupAddress;
+    SOCKET         result = INVALID_SOCKET;
+
+#if MAC_OR_LINUX_
+    if (0 < inet_pton(AF_INET, group.c_str(), &groupAddress))
+#else // ! MAC_OR_LINUX_
+    if (0 < InetPton(AF_INET, group.c_str(), &groupAddress))
+#endif // ! MAC_OR_LINUX_
+    {
+        result = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    }
+    if (INVALID_SOCKET != result)
+    {
+        int                reuse = 1;
+        struct sockaddr_in localAddress;
+
+        // Several monitors on the same machine can listen to the same multicast group.
+        setsockopt(result, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&reuse),
+                   sizeof(reuse));
+        memset(&localAddress, 0, sizeof(localAddress));
+        localAddress.sin_family = AF_INET;
+        localAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+        localAddress.sin_port = htons(static_cast<u_short>(port));
+        if (0 == bind(result, reinterpret_cast<struct sockaddr *>(&localAddress),
+                      sizeof(localAddress)))
+        {
+            if (IN_MULTICAST(ntohl(groupAddress.s_addr)))
+            {
+                struct ip_mreq request;
+
+                memset(&request, 0, sizeof(request));
+                request.imr_interface.s_addr = htonl(INADDR_ANY);
+                request.imr_multiaddr = groupAddress;
+                if (0 != setsockopt(result, IPPROTO_IP, IP_ADD_MEMBERSHIP,
+                                    reinterpret_cast<const char *>(&request), sizeof(request)))
+                {
+                    ODL_LOG("(0 != setsockopt(result, IPPROTO_IP, IP_ADD_MEMBERSHIP, " //####
+                            "reinterpret_cast<const char *>(&request), " //####
+                            "sizeof(request)))"); //####
+                    closeSocket(result);
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 == bind(result, reinterpret_cast<struct sockaddr *>" //####
+                    "(&localAddress), sizeof(localAddress)))"); //####
+            closeSocket(result);
+        }
+    }
+    ODL_EXIT_L(static_cast<long>(result)); //####
+    return result;
+} // createListenSocket
+
+/*! @brief Record a heartbeat.
+ @param[in,out] services The most recent heartbeat from each service.
+ @param[in] packet The heartbeat that arrived.
+ @param[in] now The time at which the heartbeat arrived. */
+static void
+recordHeartbeat(ServiceStateMap &       services,
+                const HeartbeatPacket & packet,
+                const double            now)
+{
+    ODL_ENTER(); //####
+    ODL_P2("services = ", &services, "packet = ", &packet); //####
+    ODL_D1("now = ", now); //####
+    ServiceStateMap::iterator match(services.find(packet.serviceName()));
+
+    if (services.end() == match)
+    {
+        ServiceState newState;
+
+        newState._lost = 0;
+        match = services.insert(ServiceStateMap::value_type(packet.serviceName(),
+                                                            newState)).first;
+    }
+    else if (packet.sequence() > match->second._sequence)
+    {
+        // A heartbeat with a lower sequence number means that the service was restarted.
+        match->second._lost += packet.sequence() - match->second._sequence - 1;
+    }
+    match->second._channels = packet.channels();
+    match->second._lastSeen = now;
+    match->second._interval = packet.interval();
+    match->second._sequence = packet.sequence();
+    match->second._started = packet.isStarted();
+    match->second._truncated = packet.wasTruncated();
+    ODL_EXIT(); //####
+} // recordHeartbeat
+
+/*! @brief Display the activity of each service.
+ @param[in] services The most recent heartbeat from each service.
+ @param[in] now The current time. */
+static void
+reportServices(const ServiceStateMap & services,
+               const double            now)
+{
+    ODL_ENTER(); //####
+    ODL_P1("services = ", &services); //####
+    ODL_D1("now = ", now); //####
+    char buffer1[DATE_TIME_BUFFER_SIZE_];
+    char buffer2[DATE_TIME_BUFFER_SIZE_];
+
+    Utilities::GetDateAndTime(buffer1, sizeof(buffer1), buffer2, sizeof(buffer2));
+    cout << buffer1 << " " << buffer2 << endl;
+    if (0 < services.size())
+    {
+        for (ServiceStateMap::const_iterator walker(services.begin()); services.end() != walker;
+             ++walker)
+        {
+            const ServiceState & aState = walker->second;
+            double               interval = std::max(aState._interval, 0.001);
+
+            cout << "  " << SanitizeString(walker->first, true).c_str();
+            if ((now - aState._lastSeen) > (HEARTBEAT_STALE_INTERVALS_ * interval))
+            {
+                cout << " [unresponsive for " << static_cast<int>(now - aState._lastSeen) <<
+                        "s]";
+            }
+            else if (aState._started)
+            {
+                cout << " [active]";
+            }
+            else
+            {
+                cout << " [stopped]";
+            }
+            if (0 < aState._lost)
+            {
+                cout << " lost=" << aState._lost;
+            }
+            if (aState._truncated)
+            {
+                cout << " (some channels not shown)";
+            }
+            cout << endl;
+            for (HeartbeatChannelVector::const_iterator channelWalker(aState._channels.begin());
+                 aState._channels.end() != channelWalker; ++channelWalker)
+            {
+                const HeartbeatChannel & aChannel = *channelWalker;
+
+                cout << "    " << SanitizeString(aChannel._name, true).c_str() << " in: " <<
+                        (aChannel._inMessages / interval) << " msg/s " <<
+                        (aChannel._inBytes / interval) << " B/s out: " <<
+                        (aChannel._outMessages / interval) << " msg/s " <<
+                        (aChannel._outBytes / interval) << " B/s";
+                if (0 < aChannel._queueDepth)
+                {
+                    cout << " queued: " << aChannel._queueDepth;
+                }
+                cout << endl;
+            }
+        }
+    }
+    else
+    {
+        cout << "  No heartbeats received." << endl;
+    }
+    ODL_EXIT(); //####
+} // reportServices
+
+/*! @brief Receive heartbeats and display the activity of the services until interrupted.
+ @param[in] aSocket The socket that receives the heartbeats. */
+static void
+monitorHeartbeats(SOCKET aSocket)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("aSocket = ", aSocket); //####
+    uint8_t         buffer[HEARTBEAT_MAXIMUM_PACKET_SIZE_ + 1];
+    double          reportTime = yarp::os::Time::now() + HEARTBEAT_INTERVAL_;
+    HeartbeatPacket packet;
+    ServiceStateMap services;
+
+    for (StartRunning(); IsRunning(); )
+    {
+        double now;
+        int    res;
+#if MAC_OR_LINUX_
+        pollfd    pollSet[1];
+#else // ! MAC_OR_LINUX_
+        WSAPOLLFD pollSet[1];
+#endif // ! MAC_OR_LINUX_
+
+        pollSet[0].fd = aSocket;
+        pollSet[0].events = POLLIN;
+        pollSet[0].revents = 0;
+#if MAC_OR_LINUX_
+        res = poll(pollSet, 1, kPollTime);
+#else // ! MAC_OR_LINUX_
+        res = WSAPoll(pollSet, 1, kPollTime);
+#endif // ! MAC_OR_LINUX_
+        now = yarp::os::Time::now();
+        if ((0 < res) && (pollSet[0].revents & POLLIN))
+        {
+            int length = static_cast<int>(recv(aSocket, reinterpret_cast<char *>(buffer),
+                                               sizeof(buffer), 0));
+
+            if ((0 < length) && packet.decode(buffer, static_cast<size_t>(length)))
+            {
+                recordHeartbeat(services, packet, now);
+            }
+        }
+        if (reportTime <= now)
+        {
+            reportServices(services, now);
+            reportTime = now + HEARTBEAT_INTERVAL_;
+        }
+    }
+    ODL_EXIT(); //####
+} // monitorHeartbeats
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for displaying the activity of services that send heartbeats.
+
+ The first argument is the port that the heartbeats are sent to and the second, optional, argument
+ is the multicast group that the heartbeats are sent to. If the group is not specified, the
+ heartbeats that are sent to this machine are displayed. Services send heartbeats when they are
+ started with the '--heartbeat address:port' option; the activity of each service is reported
+ every second, until the application is interrupted.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the application.
+ @returns @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    Utilities::PortArgumentDescriptor    firstArg("port", T_("The port to receive heartbeats on"),
+                                                  Utilities::kArgModeRequired, 12345, false);
+    Utilities::AddressArgumentDescriptor secondArg("group",
+                                                   T_("The multicast group to join, or 0.0.0.0 "
+                                                      "to receive unicast heartbeats"),
+                                                   Utilities::kArgModeOptional, "0.0.0.0");
+    Utilities::DescriptorVector          argumentList;
+    OutputFlavour                        flavour; // ignored
+
+    argumentList.push_back(&firstArg);
+    argumentList.push_back(&secondArg);
+    if (Utilities::ProcessStandardUtilitiesOptions(argc, argv, argumentList,
+                                                   "Display the activity of services that send "
+                                                   "heartbeats", 2026, STANDARD_COPYRIGHT_NAME_,
+                                                   flavour, true))
+    {
+        try
+        {
+            bool    okSoFar;
+#if (! MAC_OR_LINUX_)
+            WORD    wVersionRequested = MAKEWORD(2, 2);
+            WSADATA ww;
+#endif // ! MAC_OR_LINUX_
+
+#if MAC_OR_LINUX_
+            okSoFar = true;
+#else // ! MAC_OR_LINUX_
+            if (WSAStartup(wVersionRequested, &ww))
+            {
+                okSoFar = false;
+            }
+            else if ((2 == LOBYTE(ww.wVersion)) && (2 == HIBYTE(ww.wVersion)))
+            {
+                okSoFar = true;
+            }
+            else
+            {
+                okSoFar = false;
+            }
+#endif // ! MAC_OR_LINUX_
+            if (okSoFar)
+            {
+                SOCKET listenSocket = createListenSocket(firstArg.getCurrentValue(),
+                                                         secondArg.getCurrentValue());
+
+                if (INVALID_SOCKET == listenSocket)
+                {
+                    ODL_LOG("(INVALID_SOCKET == listenSocket)"); //####
+                    cerr << "Could not listen for heartbeats on port " <<
+                            firstArg.getCurrentValue() << "." << endl;
+                }
+                else
+                {
+                    SetSignalHandlers(SignalRunningStop);
+                    monitorHeartbeats(listenSocket);
+                    closeSocket(listenSocket);
+                }
+            }
+            else
+            {
+                ODL_LOG("! (okSoFar)"); //####
+                cerr << "Could not initialize the network." << endl;
+            }
+#if (! MAC_OR_LINUX_)
+            WSACleanup();
+#endif // ! MAC_OR_LINUX_
+        }
+        catch (...)
+        {
+            ODL_LOG("Exception caught"); //####
+        }
+    }
+    ODL_EXIT_L(0); //####
+    return 0;
+} // main
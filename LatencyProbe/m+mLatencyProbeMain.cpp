@@ -0,0 +1,479 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mLatencyProbeMain.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   A utility application to measure the round-trip times to one or more services.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <m+m/m+mChannelArgumentDescriptor.hpp>
+#include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mIntArgumentDescriptor.hpp>
+#include <m+m/m+mRequests.hpp>
+#include <m+m/m+mServiceRequest.hpp>
+#include <m+m/m+mServiceResponse.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+
+/*! @file
+ @brief A utility application to measure the round-trip times to one or more services. */
+
+/*! @dir LatencyProbe
+ @brief The set of files that implement the Latency Probe application. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The default number of requests to send to each service. */
+#define DEFAULT_PROBE_COUNT_ 100
+
+/*! @brief A set of round-trip times. */
+typedef std::vector<double> SampleVector;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the value at a given percentile of a sorted set of samples.
+ @param[in] samples The sorted samples.
+ @param[in] percentile The percentile to be returned, from 0 to 100.
+ @returns The value at the given percentile, using the nearest-rank method. */
+static double
+getPercentile(const SampleVector & samples,
+              const int            percentile)
+{
+    size_t rank = ((samples.size() * percentile) + 99) / 100;
+
+    if (0 < rank)
+    {
+        --rank;
+    }
+    return samples[rank];
+} // getPercentile
+
+/*! @brief Send a sequence of 'timestamp' requests to a service and record the round-trip times.
+
+ A single connection is used for all the requests, so that the measurements reflect the cost of
+ a request on an established connection, as seen by a client of the service.
+ @param[in] serviceChannelName The channel for the service.
+ @param[in] count The number of requests to send.
+ @param[out] samples The round-trip times, in seconds, of the successful requests.
+ @returns @c true if the service could be contacted and @c false otherwise. */
+static bool
+probeService(const YarpString & serviceChannelName,
+             const int          count,
+             SampleVector &     samples)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("serviceChannelName = ", serviceChannelName); //####
+    ODL_LL1("count = ", count); //####
+    ODL_P1("samples = ", &samples); //####
+    bool            result = false;
+    YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                               BUILD_NAME_("latencyprobe_",
+                                                           DEFAULT_CHANNEL_ROOT_)));
+    ClientChannel * newChannel = new ClientChannel;
+
+    samples.clear();
+    if (newChannel)
+    {
+        if (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
+        {
+            if (Utilities::NetworkConnectWithRetries(aName, serviceChannelName,
+                                                     STANDARD_WAIT_TIME_, false))
+            {
+                // The first request is not measured, as it includes any lazy setup of the
+                // connection.
+                for (int ii = 0; (count >= ii) && IsRunning(); ++ii)
+                {
+                    yarp::os::Bottle parameters;
+
+                    parameters.addInt(ii);
+                    ServiceRequest  request(MpM_TIMESTAMP_REQUEST_, parameters);
+                    ServiceResponse response;
+                    double          sendTime = yarp::os::Time::now();
+
+                    if (request.send(*newChannel, response))
+                    {
+                        double elapsed = yarp::os::Time::now() - sendTime;
+
+                        // Check that the request was echoed back, with the time appended.
+                        if ((2 == response.count()) && response.element(0).isInt() &&
+                            (ii == response.element(0).asInt()) &&
+                            response.element(1).isDouble())
+                        {
+                            result = true;
+                            if (0 < ii)
+                            {
+                                samples.push_back(elapsed);
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! ((2 == response.count()) && " //####
+                                    "response.element(0).isInt() && " //####
+                                    "(ii == response.element(0).asInt()) && " //####
+                                    "response.element(1).isDouble())"); //####
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! (request.send(*newChannel, response))"); //####
+                    }
+                }
+#if defined(MpM_DoExplicitDisconnect)
+                if (! Utilities::NetworkDisconnectWithRetries(aName, serviceChannelName,
+                                                              STANDARD_WAIT_TIME_))
+                {
+                    ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(aName, " //####
+                            "serviceChannelName, STANDARD_WAIT_TIME_))"); //####
+                }
+#endif // defined(MpM_DoExplicitDisconnect)
+            }
+            else
+            {
+                ODL_LOG("! (Utilities::NetworkConnectWithRetries(aName, " //####
+                        "serviceChannelName, STANDARD_WAIT_TIME_, false))"); //####
+            }
+#if defined(MpM_DoExplicitClose)
+            newChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+        }
+        else
+        {
+            ODL_LOG("! (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+        }
+        BaseChannel::RelinquishChannel(newChannel);
+    }
+    else
+    {
+        ODL_LOG("! (newChannel)"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // probeService
+
+/*! @brief Report the distribution of the round-trip times for a service.
+ @param[in] serviceChannelName The channel for the service.
+ @param[in,out] samples The round-trip times, in seconds, for the service.
+ @param[in] flavour The format for the output. */
+static void
+reportSamples(const YarpString &  serviceChannelName,
+              SampleVector &      samples,
+              const OutputFlavour flavour)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("serviceChannelName = ", serviceChannelName); //####
+    ODL_P1("samples = ", &samples); //####
+    double maxValue = 0;
+    double minValue = 0;
+    double p50Value = 0;
+    double p99Value = 0;
+
+    if (0 < samples.size())
+    {
+        std::sort(samples.begin(), samples.end());
+        minValue = samples.front() * 1000.0;
+        p50Value = getPercentile(samples, 50) * 1000.0;
+        p99Value = getPercentile(samples, 99) * 1000.0;
+        maxValue = samples.back() * 1000.0;
+    }
+    switch (flavour)
+    {
+        case kOutputFlavourJSON :
+            cout << T_("{ " CHAR_DOUBLEQUOTE_ "ServicePort" CHAR_DOUBLEQUOTE_ ": "
+                       CHAR_DOUBLEQUOTE_) <<
+                    SanitizeString(serviceChannelName).c_str() << T_(CHAR_DOUBLEQUOTE_ ", ");
+            cout << T_(CHAR_DOUBLEQUOTE_ "Samples" CHAR_DOUBLEQUOTE_ ": ") << samples.size();
+            if (0 < samples.size())
+            {
+                cout << T_(", " CHAR_DOUBLEQUOTE_ "MinMs" CHAR_DOUBLEQUOTE_ ": ") << minValue;
+                cout << T_(", " CHAR_DOUBLEQUOTE_ "P50Ms" CHAR_DOUBLEQUOTE_ ": ") << p50Value;
+                cout << T_(", " CHAR_DOUBLEQUOTE_ "P99Ms" CHAR_DOUBLEQUOTE_ ": ") << p99Value;
+                cout << T_(", " CHAR_DOUBLEQUOTE_ "MaxMs" CHAR_DOUBLEQUOTE_ ": ") << maxValue;
+            }
+            cout << " }";
+            break;
+
+        case kOutputFlavourTabs :
+            cout << SanitizeString(serviceChannelName, true).c_str() << "\t" << samples.size();
+            if (0 < samples.size())
+            {
+                cout << "\t" << minValue << "\t" << p50Value << "\t" << p99Value << "\t" <<
+                        maxValue;
+            }
+            break;
+
+        case kOutputFlavourNormal :
+            cout << SanitizeString(serviceChannelName, true).c_str() << endl;
+            if (0 < samples.size())
+            {
+                cout << "  Samples: " << samples.size() << endl;
+                cout << "  Minimum: " << minValue << " ms" << endl;
+                cout << "  Median:  " << p50Value << " ms" << endl;
+                cout << "  99th:    " << p99Value << " ms" << endl;
+                cout << "  Maximum: " << maxValue << " ms";
+            }
+            else
+            {
+                cout << "  No responses received.";
+            }
+            break;
+
+        default :
+            break;
+
+    }
+    ODL_EXIT(); //####
+} // reportSamples
+
+/*! @brief Set up the environment and perform the operation.
+ @param[in] channelName The primary channel for the service.
+ @param[in] count The number of requests to send to each service.
+ @param[in] flavour The format for the output. */
+static void
+setUpAndGo(const YarpString &  channelName,
+           const int           count,
+           const OutputFlavour flavour)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("channelName = ", channelName); //####
+    ODL_LL1("count = ", count); //####
+    YarpString       channelNameRequest(MpM_REQREP_DICT_CHANNELNAME_KEY_ ":");
+    YarpStringVector services;
+
+    if (0 < channelName.length())
+    {
+        channelNameRequest += channelName;
+    }
+    else
+    {
+        channelNameRequest += "*";
+    }
+    if (Utilities::GetServiceNamesFromCriteria(channelNameRequest, services))
+    {
+        int matchesCount = static_cast<int>(services.size());
+
+        if (0 < matchesCount)
+        {
+            bool sawResponse = false;
+
+            if (kOutputFlavourJSON == flavour)
+            {
+                cout << "[ ";
+            }
+            for (int ii = 0; (ii < matchesCount) && IsRunning(); ++ii)
+            {
+                YarpString   aMatch = services[ii];
+                SampleVector samples;
+
+                if (probeService(aMatch, count, samples))
+                {
+                    if (sawResponse)
+                    {
+                        switch (flavour)
+                        {
+                            case kOutputFlavourTabs :
+                                cout << endl;
+                                break;
+
+                            case kOutputFlavourJSON :
+                                cout << "," << endl;
+                                break;
+
+                            case kOutputFlavourNormal :
+                                cout << endl << endl;
+                                break;
+
+                            default :
+                                break;
+
+                        }
+                    }
+                    sawResponse = true;
+                    reportSamples(aMatch, samples, flavour);
+                }
+            }
+            if (kOutputFlavourJSON == flavour)
+            {
+                cout << " ]";
+            }
+            if (sawResponse)
+            {
+                cout << endl;
+            }
+            else
+            {
+                switch (flavour)
+                {
+                    case kOutputFlavourJSON :
+                    case kOutputFlavourTabs :
+                        break;
+
+                    case kOutputFlavourNormal :
+                        cout << "No matching service found." << endl;
+                        break;
+
+                    default :
+                        break;
+
+                }
+            }
+        }
+        else
+        {
+            switch (flavour)
+            {
+                case kOutputFlavourJSON :
+                case kOutputFlavourTabs :
+                    break;
+
+                case kOutputFlavourNormal :
+                    cout << "No services found." << endl;
+                    break;
+
+                default :
+                    break;
+
+            }
+        }
+    }
+    ODL_EXIT(); //####
+} // setUpAndGo
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for measuring the round-trip times to services.
+
+ The first, optional, argument is the name of the channel for the service. If the channel is not
+ specified, all service channels will be probed. The second, optional, argument is the number of
+ requests to send to each service. Standard output will receive the minimum, median, 99th
+ percentile and maximum round-trip times for each service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the application.
+ @returns @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    Utilities::ChannelArgumentDescriptor firstArg("channelName", "Channel name for the service",
+                                                  Utilities::kArgModeOptional, "");
+    Utilities::IntArgumentDescriptor     secondArg("count", T_("Number of requests per service"),
+                                                   Utilities::kArgModeOptional,
+                                                   DEFAULT_PROBE_COUNT_, true, 1, false, 0);
+    Utilities::DescriptorVector          argumentList;
+    OutputFlavour                        flavour;
+
+    argumentList.push_back(&firstArg);
+    argumentList.push_back(&secondArg);
+    if (Utilities::ProcessStandardUtilitiesOptions(argc, argv, argumentList,
+                                                   "Measure round-trip times to services", 2026,
+                                                   STANDARD_COPYRIGHT_NAME_, flavour))
+    {
+        try
+        {
+            Utilities::SetUpGlobalStatusReporter();
+            Utilities::CheckForNameServerReporter();
+            if (Utilities::CheckForValidNetwork())
+            {
+                yarp::os::Network yarp; // This is necessary to establish any connections to the
+                                        // YARP infrastructure
+
+                Initialize(progName);
+                if (Utilities::CheckForRegistryService())
+                {
+                    YarpString channelName(firstArg.getCurrentValue());
+
+                    StartRunning();
+                    SetSignalHandlers(SignalRunningStop);
+                    setUpAndGo(channelName, secondArg.getCurrentValue(), flavour);
+                }
+                else
+                {
+                    ODL_LOG("! (Utilities::CheckForRegistryService())"); //####
+                    MpM_FAIL_(MSG_REGISTRY_NOT_RUNNING);
+                }
+            }
+            else
+            {
+                ODL_LOG("! (Utilities::CheckForValidNetwork())"); //####
+                MpM_FAIL_(MSG_YARP_NOT_RUNNING);
+            }
+            Utilities::ShutDownGlobalStatusReporter();
+        }
+        catch (...)
+        {
+            ODL_LOG("Exception caught"); //####
+        }
+        yarp::os::Network::fini();
+    }
+    ODL_EXIT_L(0); //####
+    return 0;
+} // main
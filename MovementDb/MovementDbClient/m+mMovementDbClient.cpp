@@ -75,6 +75,55 @@ using namespace MplusM::MovementDb;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Extract the rows from the response to a query request.
+ @param[in] response The response from the service.
+ @param[out] rows The rows that were returned.
+ @param[out] more @c true if there are more rows to be retrieved and @c false otherwise.
+ @returns @c true if the response held rows and @c false otherwise. */
+static bool
+getQueryRows(const ServiceResponse & response,
+             yarp::os::Bottle &      rows,
+             bool &                  more)
+{
+    ODL_ENTER(); //####
+    ODL_P3("response = ", &response, "rows = ", &rows, "more = ", &more); //####
+    bool okSoFar = false;
+
+    rows.clear();
+    more = false;
+    if (MpM_EXPECTED_QUERY_RESPONSE_SIZE_ == response.count())
+    {
+        yarp::os::Value theValue = response.element(0);
+        yarp::os::Value theRows = response.element(1);
+        yarp::os::Value theFlag = response.element(2);
+
+        if (theValue.isString() && theRows.isList() && theFlag.isInt())
+        {
+            if (theValue.toString() == MpM_OK_RESPONSE_)
+            {
+                rows = *theRows.asList();
+                more = (0 != theFlag.asInt());
+                okSoFar = true;
+            }
+            else
+            {
+                ODL_LOG("! (theValue.toString() == MpM_OK_RESPONSE_)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (theValue.isString() && theRows.isList() && theFlag.isInt())"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (MpM_EXPECTED_QUERY_RESPONSE_SIZE_ == response.count())"); //####
+        ODL_S1s("response = ", response.asString()); //####
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // getQueryRows
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -150,6 +199,205 @@ MovementDbClient::addFileToDb(const YarpString & filePath)
     return okSoFar;
 } // MovementDbClient::addFileToDb
 
+bool
+MovementDbClient::listSeries(const YarpString & dataTrack,
+                             yarp::os::Bottle & seriesList)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("dataTrack = ", dataTrack); //####
+    ODL_P1("seriesList = ", &seriesList); //####
+    bool okSoFar = false;
+
+    try
+    {
+        yarp::os::Bottle parameters;
+        ServiceResponse  response;
+
+        reconnectIfDisconnected();
+        seriesList.clear();
+        if (0 < dataTrack.length())
+        {
+            parameters.addString(dataTrack);
+        }
+        if (send(MpM_LISTSERIES_REQUEST_, parameters, response))
+        {
+            if (MpM_EXPECTED_LISTSERIES_RESPONSE_SIZE_ == response.count())
+            {
+                yarp::os::Value theValue = response.element(0);
+                yarp::os::Value theList = response.element(1);
+
+                if (theValue.isString() && theList.isList())
+                {
+                    if (theValue.toString() == MpM_OK_RESPONSE_)
+                    {
+                        seriesList = *theList.asList();
+                        okSoFar = true;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (theValue.toString() == MpM_OK_RESPONSE_)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (theValue.isString() && theList.isList())"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (MpM_EXPECTED_LISTSERIES_RESPONSE_SIZE_ == response.count())"); //####
+                ODL_S1s("response = ", response.asString()); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (send(MpM_LISTSERIES_REQUEST_, parameters, response))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbClient::listSeries
+
+bool
+MovementDbClient::queryDownsampled(const YarpString & dataTrack,
+                                   const YarpString & subject,
+                                   const YarpString & segment,
+                                   const double       startTime,
+                                   const double       endTime,
+                                   const double       bucketWidth,
+                                   yarp::os::Bottle & rows,
+                                   bool &             more,
+                                   const int          maxRows)
+{
+    ODL_OBJENTER(); //####
+    ODL_S3s("dataTrack = ", dataTrack, "subject = ", subject, "segment = ", segment); //####
+    ODL_D3("startTime = ", startTime, "endTime = ", endTime, "bucketWidth = ", //####
+           bucketWidth); //####
+    ODL_P2("rows = ", &rows, "more = ", &more); //####
+    ODL_LL1("maxRows = ", maxRows); //####
+    bool okSoFar = false;
+
+    try
+    {
+        yarp::os::Bottle parameters;
+        ServiceResponse  response;
+
+        reconnectIfDisconnected();
+        parameters.addString(dataTrack);
+        parameters.addString(subject);
+        parameters.addString(segment);
+        parameters.addDouble(startTime);
+        parameters.addDouble(endTime);
+        parameters.addDouble(bucketWidth);
+        if (0 < maxRows)
+        {
+            parameters.addInt(maxRows);
+        }
+        if (send(MpM_QUERYDOWNSAMPLED_REQUEST_, parameters, response))
+        {
+            okSoFar = getQueryRows(response, rows, more);
+        }
+        else
+        {
+            ODL_LOG("! (send(MpM_QUERYDOWNSAMPLED_REQUEST_, parameters, response))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbClient::queryDownsampled
+
+bool
+MovementDbClient::queryNext(yarp::os::Bottle & rows,
+                            bool &             more)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("rows = ", &rows, "more = ", &more); //####
+    bool okSoFar = false;
+
+    try
+    {
+        yarp::os::Bottle parameters;
+        ServiceResponse  response;
+
+        reconnectIfDisconnected();
+        if (send(MpM_QUERYNEXT_REQUEST_, parameters, response))
+        {
+            okSoFar = getQueryRows(response, rows, more);
+        }
+        else
+        {
+            ODL_LOG("! (send(MpM_QUERYNEXT_REQUEST_, parameters, response))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbClient::queryNext
+
+bool
+MovementDbClient::queryRange(const YarpString & dataTrack,
+                             const YarpString & subject,
+                             const YarpString & segment,
+                             const double       startTime,
+                             const double       endTime,
+                             yarp::os::Bottle & rows,
+                             bool &             more,
+                             const int          maxRows)
+{
+    ODL_OBJENTER(); //####
+    ODL_S3s("dataTrack = ", dataTrack, "subject = ", subject, "segment = ", segment); //####
+    ODL_D2("startTime = ", startTime, "endTime = ", endTime); //####
+    ODL_P2("rows = ", &rows, "more = ", &more); //####
+    ODL_LL1("maxRows = ", maxRows); //####
+    bool okSoFar = false;
+
+    try
+    {
+        yarp::os::Bottle parameters;
+        ServiceResponse  response;
+
+        reconnectIfDisconnected();
+        parameters.addString(dataTrack);
+        parameters.addString(subject);
+        parameters.addString(segment);
+        parameters.addDouble(startTime);
+        parameters.addDouble(endTime);
+        if (0 < maxRows)
+        {
+            parameters.addInt(maxRows);
+        }
+        if (send(MpM_QUERYRANGE_REQUEST_, parameters, response))
+        {
+            okSoFar = getQueryRows(response, rows, more);
+        }
+        else
+        {
+            ODL_LOG("! (send(MpM_QUERYRANGE_REQUEST_, parameters, response))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbClient::queryRange
+
 bool
 MovementDbClient::setDataTrackForDb(const YarpString & dataTrack)
 {
@@ -310,6 +558,113 @@ MovementDbClient::stopDbConnection(void)
     return okSoFar;
 } // MovementDbClient::stopDbConnection
 
+bool
+MovementDbClient::startIngest(const YarpString & dataTrack,
+                              const YarpString & sourceChannel,
+                              YarpString &       ingestChannel)
+{
+    ODL_OBJENTER(); //####
+    ODL_S2s("dataTrack = ", dataTrack, "sourceChannel = ", sourceChannel); //####
+    ODL_P1("ingestChannel = ", &ingestChannel); //####
+    bool okSoFar = false;
+
+    try
+    {
+        yarp::os::Bottle parameters;
+        ServiceResponse  response;
+
+        reconnectIfDisconnected();
+        parameters.addString(dataTrack);
+        parameters.addString(sourceChannel);
+        if (send(MpM_INGEST_REQUEST_, parameters, response))
+        {
+            if (MpM_EXPECTED_INGEST_RESPONSE_SIZE_ == response.count())
+            {
+                yarp::os::Value theValue = response.element(0);
+                yarp::os::Value theChannel = response.element(1);
+
+                if (theValue.isString() && theChannel.isString())
+                {
+                    okSoFar = (theValue.toString() == MpM_OK_RESPONSE_);
+                    if (okSoFar)
+                    {
+                        ingestChannel = theChannel.toString();
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (theValue.isString() && theChannel.isString())"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (MpM_EXPECTED_INGEST_RESPONSE_SIZE_ == response.count())"); //####
+                ODL_S1s("response = ", response.asString()); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (send(MpM_INGEST_REQUEST_, parameters, response))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbClient::startIngest
+
+bool
+MovementDbClient::stopIngest(const YarpString & sourceChannel)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("sourceChannel = ", sourceChannel); //####
+    bool okSoFar = false;
+
+    try
+    {
+        yarp::os::Bottle parameters;
+        ServiceResponse  response;
+
+        reconnectIfDisconnected();
+        parameters.addString(sourceChannel);
+        if (send(MpM_STOPINGEST_REQUEST_, parameters, response))
+        {
+            if (MpM_EXPECTED_STOPINGEST_RESPONSE_SIZE_ == response.count())
+            {
+                yarp::os::Value theValue = response.element(0);
+
+                if (theValue.isString())
+                {
+                    okSoFar = (theValue.toString() == MpM_OK_RESPONSE_);
+                }
+                else
+                {
+                    ODL_LOG("! (theValue.isString())"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (MpM_EXPECTED_STOPINGEST_RESPONSE_SIZE_ == response.count())"); //####
+                ODL_S1s("response = ", response.asString()); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (send(MpM_STOPINGEST_REQUEST_, parameters, response))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbClient::stopIngest
+
 
 #if defined(__APPLE__)
 # pragma mark Global functions
@@ -83,6 +83,92 @@ namespace MplusM
             bool
             addFileToDb(const YarpString & filePath);
 
+            /*! @brief Ask the movement database service to add the movement data from a channel
+             as it arrives.
+             @param[in] dataTrack The data track for the samples.
+             @param[in] sourceChannel The channel that provides the movement data.
+             @param[out] ingestChannel The name of the service channel that receives the data.
+             @returns @c true if the service connected to the channel and @c false otherwise. */
+            bool
+            startIngest(const YarpString & dataTrack,
+                        const YarpString & sourceChannel,
+                        YarpString &       ingestChannel);
+
+            /*! @brief Ask the movement database service to stop adding the movement data from a
+             channel.
+             @param[in] sourceChannel The channel that provides the movement data.
+             @returns @c true if the channel was being added and @c false otherwise. */
+            bool
+            stopIngest(const YarpString & sourceChannel);
+
+            /*! @brief Retrieve the series that are stored by the movement database service.
+             @param[in] dataTrack The data track to be listed, or an empty string for all data
+             tracks.
+             @param[out] seriesList The series, each as a list of the data track, subject,
+             segment, number of values, number of samples and first and last times.
+             @returns @c true if the series were retrieved successfully and @c false otherwise. */
+            bool
+            listSeries(const YarpString & dataTrack,
+                       yarp::os::Bottle & seriesList);
+
+            /*! @brief Start a query that returns the mean of the samples of a series in buckets
+             of equal width.
+             @param[in] dataTrack The data track of the series.
+             @param[in] subject The subject of the series.
+             @param[in] segment The segment of the series.
+             @param[in] startTime The start of the time range, in milliseconds.
+             @param[in] endTime The end of the time range, in milliseconds.
+             @param[in] bucketWidth The width of each bucket, in milliseconds.
+             @param[out] rows The first piece of the result, each row being a list of the bucket
+             start time, the number of samples in the bucket and the mean values.
+             @param[out] more @c true if there are more rows to be retrieved with queryNext and
+             @c false otherwise.
+             @param[in] maxRows The maximum number of rows in each piece of the result, or zero to
+             use the service default.
+             @returns @c true if the query was started successfully and @c false otherwise. */
+            bool
+            queryDownsampled(const YarpString & dataTrack,
+                             const YarpString & subject,
+                             const YarpString & segment,
+                             const double       startTime,
+                             const double       endTime,
+                             const double       bucketWidth,
+                             yarp::os::Bottle & rows,
+                             bool &             more,
+                             const int          maxRows = 0);
+
+            /*! @brief Retrieve the next piece of the result of the active query.
+             @param[out] rows The next piece of the result.
+             @param[out] more @c true if there are more rows to be retrieved and @c false
+             otherwise.
+             @returns @c true if the rows were retrieved successfully and @c false otherwise. */
+            bool
+            queryNext(yarp::os::Bottle & rows,
+                      bool &             more);
+
+            /*! @brief Start a query that returns the samples of a series within a time range.
+             @param[in] dataTrack The data track of the series.
+             @param[in] subject The subject of the series.
+             @param[in] segment The segment of the series.
+             @param[in] startTime The start of the time range, in milliseconds.
+             @param[in] endTime The end of the time range, in milliseconds.
+             @param[out] rows The first piece of the result, each row being a list of the sample
+             time and the sample values.
+             @param[out] more @c true if there are more rows to be retrieved with queryNext and
+             @c false otherwise.
+             @param[in] maxRows The maximum number of rows in each piece of the result, or zero to
+             use the service default.
+             @returns @c true if the query was started successfully and @c false otherwise. */
+            bool
+            queryRange(const YarpString & dataTrack,
+                       const YarpString & subject,
+                       const YarpString & segment,
+                       const double       startTime,
+                       const double       endTime,
+                       yarp::os::Bottle & rows,
+                       bool &             more,
+                       const int          maxRows = 0);
+
             /*! @brief Set the active data track.
              @param[in] dataTrack The data track to use with subsequent files.
              @returns @c true if the data track was successfully set and @c false otherwise. */
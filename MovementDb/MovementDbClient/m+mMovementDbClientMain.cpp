@@ -43,6 +43,8 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#include <sstream>
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -91,10 +93,128 @@ displayCommands(void)
     cout << "  + - request a file path adn add it to the database" << endl;
     cout << "  d - set the data track" << endl;
     cout << "  e - set the e-mail address" << endl;
+    cout << "  i - add the movement data from a channel as it arrives" << endl;
+    cout << "  l - list the stored series" << endl;
     cout << "  q - quit the application" << endl;
+    cout << "  r - query a range of a stored series" << endl;
+    cout << "  s - stop adding the movement data from a channel" << endl;
     ODL_EXIT(); //####
 } // displayCommands
 
+/*! @brief Request a query of a stored series and display the result.
+ @param[in] aClient The client to use to communicate with the service. */
+static void
+doQuery(MovementDbClient * aClient)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aClient = ", aClient); //####
+    std::string inputLine;
+
+    cout << "data track, subject, segment, start time, end time [, bucket width]: ";
+    cout.flush();
+    if (getline(cin, inputLine))
+    {
+        std::istringstream inputStream(inputLine);
+        std::string        dataTrack;
+        std::string        subject;
+        std::string        segment;
+        double             startTime;
+        double             endTime;
+        double             bucketWidth = 0;
+
+        if (inputStream >> dataTrack >> subject >> segment >> startTime >> endTime)
+        {
+            bool             more;
+            bool             okSoFar;
+            int              rowCount = 0;
+            yarp::os::Bottle rows;
+
+            inputStream >> bucketWidth;
+            if (0 < bucketWidth)
+            {
+                okSoFar = aClient->queryDownsampled(dataTrack.c_str(), subject.c_str(),
+                                                    segment.c_str(), startTime, endTime,
+                                                    bucketWidth, rows, more);
+            }
+            else
+            {
+                okSoFar = aClient->queryRange(dataTrack.c_str(), subject.c_str(),
+                                              segment.c_str(), startTime, endTime, rows, more);
+            }
+            for (bool keepGoing = okSoFar; keepGoing; )
+            {
+                // Display each piece of the result as it arrives.
+                for (int ii = 0, mm = rows.size(); mm > ii; ++ii)
+                {
+                    cout << rows.get(ii).toString().c_str() << endl;
+                }
+                rowCount += rows.size();
+                keepGoing = (more && IsRunning());
+                if (keepGoing)
+                {
+                    okSoFar = keepGoing = aClient->queryNext(rows, more);
+                }
+            }
+            if (okSoFar)
+            {
+                cout << rowCount << " rows retrieved." << endl;
+            }
+            else
+            {
+                ODL_LOG("! (okSoFar)"); //####
+                MpM_FAIL_("Problem querying the database.");
+                cout << "Query failed." << endl;
+            }
+        }
+        else
+        {
+            cout << "Invalid query." << endl;
+        }
+    }
+    ODL_EXIT(); //####
+} // doQuery
+
+/*! @brief Request that the movement data from a channel be added as it arrives.
+ @param[in] aClient The client to use to communicate with the service. */
+static void
+doStartIngest(MovementDbClient * aClient)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aClient = ", aClient); //####
+    std::string inputLine;
+
+    cout << "data track, source channel: ";
+    cout.flush();
+    if (getline(cin, inputLine))
+    {
+        std::istringstream inputStream(inputLine);
+        std::string        dataTrack;
+        std::string        sourceChannel;
+
+        if (inputStream >> dataTrack >> sourceChannel)
+        {
+            YarpString ingestChannel;
+
+            if (aClient->startIngest(dataTrack.c_str(), sourceChannel.c_str(), ingestChannel))
+            {
+                cout << "Channel connected to " << ingestChannel.c_str() << "." << endl;
+            }
+            else
+            {
+                ODL_LOG("! (aClient->startIngest(dataTrack.c_str(), " //####
+                        "sourceChannel.c_str(), ingestChannel))"); //####
+                MpM_FAIL_("Problem connecting the channel to the database.");
+                cout << "Channel not connected." << endl;
+            }
+        }
+        else
+        {
+            cout << "Invalid channel." << endl;
+        }
+    }
+    ODL_EXIT(); //####
+} // doStartIngest
+
 /*! @brief Set up the environment and perform the operation. */
 #if defined(MpM_ReportOnConnections)
 static void
@@ -127,7 +247,7 @@ setUpAndGo(void)
                     std::string inputLine;
                     YarpString  inputString;
 
-                    cout << "Operation: [? + d e q]? ";
+                    cout << "Operation: [? + d e i l q r s]? ";
                     cout.flush();
                     if (getline(cin, inputLine))
                     {
@@ -195,6 +315,38 @@ setUpAndGo(void)
                                 }
                                 break;
 
+                            case 'i' :
+                            case 'I' :
+                                doStartIngest(aClient);
+                                break;
+
+                            case 'l' :
+                            case 'L' :
+                                cout << "data track (empty for all): ";
+                                cout.flush();
+                                getline(cin, inputLine);
+                                inputString = inputLine.c_str();
+                                {
+                                    yarp::os::Bottle seriesList;
+
+                                    if (aClient->listSeries(inputString, seriesList))
+                                    {
+                                        for (int ii = 0, mm = seriesList.size(); mm > ii; ++ii)
+                                        {
+                                            cout << seriesList.get(ii).toString().c_str() << endl;
+                                        }
+                                        cout << seriesList.size() << " series stored." << endl;
+                                    }
+                                    else
+                                    {
+                                        ODL_LOG("! (aClient->listSeries(inputString, " //####
+                                                "seriesList))"); //####
+                                        MpM_FAIL_("Problem listing the series in the database.");
+                                        cout << "Series not listed." << endl;
+                                    }
+                                }
+                                break;
+
                             case 'q' :
                             case 'Q' :
                                 cout << "Exiting" << endl;
@@ -207,6 +359,29 @@ setUpAndGo(void)
                                 StopRunning();
                                 break;
 
+                            case 'r' :
+                            case 'R' :
+                                doQuery(aClient);
+                                break;
+
+                            case 's' :
+                            case 'S' :
+                                cout << "stop adding from channel: ";
+                                cout.flush();
+                                getline(cin, inputLine);
+                                inputString = inputLine.c_str();
+                                if (aClient->stopIngest(inputString))
+                                {
+                                    cout << "Channel disconnected." << endl;
+                                }
+                                else
+                                {
+                                    ODL_LOG("! (aClient->stopIngest(inputString))"); //####
+                                    MpM_FAIL_("Problem disconnecting the channel.");
+                                    cout << "Channel not disconnected." << endl;
+                                }
+                                break;
+
                             case '?' :
                                 // Help
                                 displayCommands();
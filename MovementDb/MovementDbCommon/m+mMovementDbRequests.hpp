@@ -61,20 +61,48 @@
 # define MpM_MOVEMENTDB_CANONICAL_NAME_ "MovementDb"
 
 /*! @brief The name for the 'addfile' request. */
-# define MpM_ADDFILE_REQUEST_       "addfile"
+# define MpM_ADDFILE_REQUEST_          "addfile"
+
+/*! @brief The name for the 'ingest' request. */
+# define MpM_INGEST_REQUEST_           "ingest"
+
+/*! @brief The name for the 'listseries' request. */
+# define MpM_LISTSERIES_REQUEST_       "listseries"
+
+/*! @brief The name for the 'querydownsampled' request. */
+# define MpM_QUERYDOWNSAMPLED_REQUEST_ "querydownsampled"
+
+/*! @brief The name for the 'querynext' request. */
+# define MpM_QUERYNEXT_REQUEST_        "querynext"
+
+/*! @brief The name for the 'queryrange' request. */
+# define MpM_QUERYRANGE_REQUEST_       "queryrange"
 
 /*! @brief The name for the 'setdatatrack' request. */
-# define MpM_SETDATATRACK_REQUEST_  "setdatatrack"
+# define MpM_SETDATATRACK_REQUEST_     "setdatatrack"
 
 /*! @brief The name for the 'setemail' request. */
-# define MpM_SETEMAIL_REQUEST_      "setemail"
+# define MpM_SETEMAIL_REQUEST_         "setemail"
 
 /*! @brief The name for the 'stopdb' request. */
-# define MpM_STOPDB_REQUEST_        "stopdb"
+# define MpM_STOPDB_REQUEST_           "stopdb"
+
+/*! @brief The name for the 'stopingest' request. */
+# define MpM_STOPINGEST_REQUEST_       "stopingest"
 
 /*! @brief The number of elements expected in the output of an 'addfile' request. */
 # define MpM_EXPECTED_ADDFILE_RESPONSE_SIZE_      1
 
+/*! @brief The number of elements expected in the output of an 'ingest' request. */
+# define MpM_EXPECTED_INGEST_RESPONSE_SIZE_       2
+
+/*! @brief The number of elements expected in the output of a 'listseries' request. */
+# define MpM_EXPECTED_LISTSERIES_RESPONSE_SIZE_   2
+
+/*! @brief The number of elements expected in the output of a 'queryrange', 'querydownsampled' or
+ 'querynext' request. */
+# define MpM_EXPECTED_QUERY_RESPONSE_SIZE_        3
+
 /*! @brief The number of elements expected in the output of a 'setdatatrack' request. */
 # define MpM_EXPECTED_SETDATATRACK_RESPONSE_SIZE_ 1
 
@@ -84,4 +112,38 @@
 /*! @brief The number of elements expected in the output of a 'stopdb' request. */
 # define MpM_EXPECTED_STOPDB_RESPONSE_SIZE_       1
 
+/*! @brief The number of elements expected in the output of a 'stopingest' request. */
+# define MpM_EXPECTED_STOPINGEST_RESPONSE_SIZE_   1
+
+/*! @brief The number of rows returned in each reply to a query, if not specified. */
+# define MpM_MOVEMENTDB_DEFAULT_ROWS_PER_REPLY_ 500
+
+/*! @brief The largest number of rows that will be returned in a reply to a query. */
+# define MpM_MOVEMENTDB_MAXIMUM_ROWS_PER_REPLY_ 10000
+
+/*! @brief The metrics key for the number of live samples waiting to be added. */
+# define MpM_MOVEMENTDB_QUEUEDEPTH_      "queueDepth"
+
+/*! @brief The metrics key for the number of live samples discarded because too many were
+ waiting. */
+# define MpM_MOVEMENTDB_DROPPED_         "dropped"
+
+/*! @brief The metrics key for the number of live samples that the store did not accept. */
+# define MpM_MOVEMENTDB_REJECTED_        "rejected"
+
+/*! @brief The metrics key for the number of live samples added to the store. */
+# define MpM_MOVEMENTDB_SAMPLES_         "samples"
+
+/*! @brief The metrics key for the number of groups that could not be written to the journal. */
+# define MpM_MOVEMENTDB_GROUPSFAILED_    "groupsFailed"
+
+/*! @brief The metrics key for the largest number of live samples added as a single group. */
+# define MpM_MOVEMENTDB_LARGESTGROUP_    "largestGroup"
+
+/*! @brief The metrics key for the mean time, in seconds, spent in adding a group. */
+# define MpM_MOVEMENTDB_MEANCOMMITTIME_  "meanCommitTime"
+
+/*! @brief The metrics key for the longest time, in seconds, spent in adding a group. */
+# define MpM_MOVEMENTDB_MAXCOMMITTIME_   "maxCommitTime"
+
 #endif // ! defined(MpMMovementDbRequests_HPP_)
@@ -81,7 +81,7 @@ using namespace MplusM::MovementDb;
 #endif // defined(__APPLE__)
 
 MovementDbContext::MovementDbContext(void) :
-    inherited()
+    inherited(), _dataTrack(), _emailAddress(), _query(), _queryIsActive(false)
 {
     ODL_ENTER(); //####
     ODL_EXIT_P(this); //####
@@ -39,6 +39,8 @@
 #if (! defined(MpMMovementDbContext_HPP_))
 # define MpMMovementDbContext_HPP_ /* Header guard */
 
+# include "m+mMovementStore.hpp"
+
 # include <m+m/m+mBaseContext.hpp>
 
 # if defined(__APPLE__)
@@ -92,6 +94,21 @@ namespace MplusM
                 return _emailAddress;
             } // emailAddress
 
+            /*! @brief An accessor for the active query. */
+            inline MovementQuery &
+            query(void)
+            {
+                return _query;
+            } // query
+
+            /*! @brief An accessor for the flag that indicates that the active query has more
+             rows. */
+            inline bool &
+            queryIsActive(void)
+            {
+                return _queryIsActive;
+            } // queryIsActive
+
         protected :
 
         private :
@@ -118,6 +135,22 @@ namespace MplusM
             /*! @brief The e-mail address to use. */
             YarpString _emailAddress;
 
+            /*! @brief The active query, which records how far the query has progressed. */
+            MovementQuery _query;
+
+            /*! @brief @c true if the active query has more rows and @c false otherwise. */
+            bool _queryIsActive;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
         }; // MovementDbContext
 
     } // MovementDb
@@ -38,15 +38,29 @@
 
 #include "m+mMovementDbService.hpp"
 #include "m+mAddFileRequestHandler.hpp"
+#include "m+mIngestRequestHandler.hpp"
+#include "m+mListSeriesRequestHandler.hpp"
 #include "m+mMovementDbContext.hpp"
 #include "m+mMovementDbRequests.hpp"
+#include "m+mMovementIngest.hpp"
+#include "m+mMovementIngestInputHandler.hpp"
+#include "m+mMovementIngestThread.hpp"
+#include "m+mQueryDownsampledRequestHandler.hpp"
+#include "m+mQueryNextRequestHandler.hpp"
+#include "m+mQueryRangeRequestHandler.hpp"
 #include "m+mSetDataTrackRequestHandler.hpp"
 #include "m+mSetEmailRequestHandler.hpp"
 #include "m+mStopDbRequestHandler.hpp"
+#include "m+mStopIngestRequestHandler.hpp"
+
+#include <m+m/m+mSendReceiveCounters.hpp>
+#include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#include <sstream>
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -91,24 +105,47 @@ MovementDbService::MovementDbService(const YarpString & launchPath,
                                      char * *           argv,
                                      const YarpString & tag,
                                      const YarpString & databaseServerAddress,
+                                     const YarpString & storePath,
                                      const YarpString & serviceEndpointName,
                                      const YarpString & servicePortNumber) :
     inherited(kServiceKindNormal, launchPath, argc, argv, tag, true, MpM_MOVEMENTDB_CANONICAL_NAME_,
               MOVEMENTDB_SERVICE_DESCRIPTION_,
               "addfile - add a file to the database\n"
+              "ingest - add the movement data from a channel as it arrives\n"
+              "listseries - list the stored series\n"
+              "querydownsampled - start a query for the bucketed means of a series\n"
+              "querynext - continue the active query\n"
+              "queryrange - start a query for the samples of a series\n"
               "setdatatrack - set the data track for the files being added\n"
               "setemail - set the e-mail address for the files being added\n"
-              "stopdb - stop the database", serviceEndpointName,
-              servicePortNumber), _databaseAddress(databaseServerAddress), _addFileHandler(NULL),
-    _setDataTrackHandler(NULL), _setEmailHandler(NULL), _stopDbHandler(NULL)
+              "stopdb - stop the database\n"
+              "stopingest - stop adding the movement data from a channel", serviceEndpointName,
+              servicePortNumber), _databaseAddress(databaseServerAddress), _store(), _ingestLock(),
+    _ingestChannels(), _ingester(NULL), _ingestCount(0), _addFileHandler(NULL),
+    _ingestHandler(NULL), _listSeriesHandler(NULL), _queryDownsampledHandler(NULL),
+    _queryNextHandler(NULL), _queryRangeHandler(NULL), _setDataTrackHandler(NULL),
+    _setEmailHandler(NULL), _stopDbHandler(NULL), _stopIngestHandler(NULL)
 {
     ODL_ENTER(); //####
     ODL_S4s("launchPath = ", launchPath, "tag = ", tag, "databaseServerAddress = ", //####
-            databaseServerAddress, "serviceEndpointName = ", serviceEndpointName); //####
-    ODL_S1s("servicePortNumber = ", servicePortNumber); //####
+            databaseServerAddress, "storePath = ", storePath); //####
+    ODL_S2s("serviceEndpointName = ", serviceEndpointName, "servicePortNumber = ", //####
+            servicePortNumber); //####
     ODL_LL1("argc = ", argc); //####
     ODL_P1("argv = ", argv); //####
-    setExtraInformation(YarpString("Database address is '") + _databaseAddress + YarpString("'"));
+    if (_store.open(storePath))
+    {
+        setExtraInformation(YarpString("Database address is '") + _databaseAddress +
+                            YarpString("', movement data is in '") + storePath +
+                            YarpString("'"));
+    }
+    else
+    {
+        ODL_LOG("! (_store.open(storePath))"); //####
+        setExtraInformation(YarpString("Database address is '") + _databaseAddress +
+                            YarpString("', movement data file '") + storePath +
+                            YarpString("' could not be opened"));
+    }
     attachRequestHandlers();
     ODL_EXIT_P(this); //####
 } // MovementDbService::MovementDbService
@@ -117,6 +154,8 @@ MovementDbService::~MovementDbService(void)
 {
     ODL_OBJENTER(); //####
     detachRequestHandlers();
+    stopAllIngest();
+    _store.close();
     ODL_OBJEXIT(); //####
 } // MovementDbService::~MovementDbService
 
@@ -128,11 +167,6 @@ bool
 MovementDbService::addFileToDb(const YarpString & key,
                                const YarpString & filePath)
 {
-#if (! defined(ODL_ENABLE_LOGGING_))
-# if MAC_OR_LINUX_
-#  pragma unused(filePath)
-# endif // MAC_OR_LINUX_
-#endif // ! defined(ODL_ENABLE_LOGGING_)
     ODL_OBJENTER(); //####
     ODL_S2s("key = ", key, "filePath = ", filePath); //####
     bool okSoFar = false;
@@ -146,9 +180,25 @@ MovementDbService::addFileToDb(const YarpString & key,
             context = new MovementDbContext;
             addContext(key, context);
         }
-        // Add file using context->dataTrack(), context->emailAddress() and filePath.
-        // TBD!!!!
-        okSoFar = true;
+        if (_store.isOpen())
+        {
+            IngestCounts counts;
+
+            // The e-mail address is retained in the context for when ownership is tracked.
+            okSoFar = AddRecordingToStore(_store, context->dataTrack(), filePath, counts);
+            if (okSoFar)
+            {
+                ODL_LL3("counts._numFrames = ", counts._numFrames, "counts._numSamples = ", //####
+                        counts._numSamples, "counts._numRejected = ", //####
+                        counts._numRejected); //####
+                // Make the new samples durable before reporting success.
+                okSoFar = _store.flush();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_store.isOpen())"); //####
+        }
     }
     catch (...)
     {
@@ -166,20 +216,36 @@ MovementDbService::attachRequestHandlers(void)
     try
     {
         _addFileHandler = new AddFileRequestHandler(*this);
+        _ingestHandler = new IngestRequestHandler(*this);
+        _listSeriesHandler = new ListSeriesRequestHandler(*this);
+        _queryDownsampledHandler = new QueryDownsampledRequestHandler(*this);
+        _queryNextHandler = new QueryNextRequestHandler(*this);
+        _queryRangeHandler = new QueryRangeRequestHandler(*this);
         _setDataTrackHandler = new SetDataTrackRequestHandler(*this);
         _setEmailHandler = new SetEmailRequestHandler(*this);
         _stopDbHandler = new StopDbRequestHandler(*this);
-        if (_addFileHandler && _setDataTrackHandler && _setEmailHandler && _stopDbHandler)
+        _stopIngestHandler = new StopIngestRequestHandler(*this);
+        if (_addFileHandler && _ingestHandler && _listSeriesHandler && _queryDownsampledHandler &&
+            _queryNextHandler && _queryRangeHandler && _setDataTrackHandler && _setEmailHandler &&
+            _stopDbHandler && _stopIngestHandler)
         {
             registerRequestHandler(_addFileHandler);
+            registerRequestHandler(_ingestHandler);
+            registerRequestHandler(_listSeriesHandler);
+            registerRequestHandler(_queryDownsampledHandler);
+            registerRequestHandler(_queryNextHandler);
+            registerRequestHandler(_queryRangeHandler);
             registerRequestHandler(_setDataTrackHandler);
             registerRequestHandler(_setEmailHandler);
             registerRequestHandler(_stopDbHandler);
+            registerRequestHandler(_stopIngestHandler);
         }
         else
         {
-            ODL_LOG("! (_addFileHandler && _setDataTrackHandler && _setEmailHandler && " //####
-                    " _stopDbHandler)"); //####
+            ODL_LOG("! (_addFileHandler && _ingestHandler && _listSeriesHandler && " //####
+                    "_queryDownsampledHandler && _queryNextHandler && _queryRangeHandler && " //####
+                    "_setDataTrackHandler && _setEmailHandler && _stopDbHandler && " //####
+                    "_stopIngestHandler)"); //####
         }
     }
     catch (...)
@@ -190,6 +256,73 @@ MovementDbService::attachRequestHandlers(void)
     ODL_OBJEXIT(); //####
 } // MovementDbService::attachRequestHandlers
 
+void
+MovementDbService::closeIngestChannel(const YarpString & sourceChannel,
+                                      IngestChannel &    anEntry)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("sourceChannel = ", sourceChannel); //####
+    ODL_P1("anEntry = ", &anEntry); //####
+    try
+    {
+        if (anEntry._channel)
+        {
+            if (! Utilities::NetworkDisconnectWithRetries(sourceChannel, anEntry._channel->name(),
+                                                          STANDARD_WAIT_TIME_))
+            {
+                ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(sourceChannel, " //####
+                        "anEntry._channel->name(), STANDARD_WAIT_TIME_))"); //####
+            }
+#if defined(MpM_DoExplicitClose)
+            anEntry._channel->close();
+#endif // defined(MpM_DoExplicitClose)
+            BaseChannel::RelinquishChannel(anEntry._channel);
+            anEntry._channel = NULL;
+        }
+        delete anEntry._handler;
+        anEntry._handler = NULL;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // MovementDbService::closeIngestChannel
+
+bool
+MovementDbService::continueQuery(const YarpString & key,
+                                 yarp::os::Bottle & rows,
+                                 bool &             more)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("key = ", key); //####
+    ODL_P2("rows = ", &rows, "more = ", &more); //####
+    bool okSoFar = false;
+
+    try
+    {
+        MovementDbContext * context = (MovementDbContext *) findContext(key);
+
+        if (context && context->queryIsActive())
+        {
+            okSoFar = fetchQueryRows(context->query(), rows, more);
+            context->queryIsActive() = (okSoFar && more);
+        }
+        else
+        {
+            ODL_LOG("! (context && context->queryIsActive())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbService::continueQuery
+
 void
 MovementDbService::detachRequestHandlers(void)
 {
@@ -202,6 +335,36 @@ MovementDbService::detachRequestHandlers(void)
             delete _addFileHandler;
             _addFileHandler = NULL;
         }
+        if (_ingestHandler)
+        {
+            unregisterRequestHandler(_ingestHandler);
+            delete _ingestHandler;
+            _ingestHandler = NULL;
+        }
+        if (_listSeriesHandler)
+        {
+            unregisterRequestHandler(_listSeriesHandler);
+            delete _listSeriesHandler;
+            _listSeriesHandler = NULL;
+        }
+        if (_queryDownsampledHandler)
+        {
+            unregisterRequestHandler(_queryDownsampledHandler);
+            delete _queryDownsampledHandler;
+            _queryDownsampledHandler = NULL;
+        }
+        if (_queryNextHandler)
+        {
+            unregisterRequestHandler(_queryNextHandler);
+            delete _queryNextHandler;
+            _queryNextHandler = NULL;
+        }
+        if (_queryRangeHandler)
+        {
+            unregisterRequestHandler(_queryRangeHandler);
+            delete _queryRangeHandler;
+            _queryRangeHandler = NULL;
+        }
         if (_setDataTrackHandler)
         {
             unregisterRequestHandler(_setDataTrackHandler);
@@ -220,6 +383,12 @@ MovementDbService::detachRequestHandlers(void)
             delete _stopDbHandler;
             _stopDbHandler = NULL;
         }
+        if (_stopIngestHandler)
+        {
+            unregisterRequestHandler(_stopIngestHandler);
+            delete _stopIngestHandler;
+            _stopIngestHandler = NULL;
+        }
     }
     catch (...)
     {
@@ -229,6 +398,149 @@ MovementDbService::detachRequestHandlers(void)
     ODL_OBJEXIT(); //####
 } // MovementDbService::detachRequestHandlers
 
+bool
+MovementDbService::fetchQueryRows(MovementQuery &    query,
+                                  yarp::os::Bottle & rows,
+                                  bool &             more)
+{
+    ODL_OBJENTER(); //####
+    ODL_P3("query = ", &query, "rows = ", &rows, "more = ", &more); //####
+    bool okSoFar = false;
+
+    try
+    {
+        MovementRowVector found;
+
+        rows.clear();
+        okSoFar = _store.fetchRows(query, found, more);
+        if (okSoFar)
+        {
+            for (MovementRowVector::const_iterator walker(found.begin()); found.end() != walker;
+                 ++walker)
+            {
+                yarp::os::Bottle & aRow = rows.addList();
+
+                // Times are reported in milliseconds, as in the recorded files.
+                aRow.addDouble(walker->_time / 1000.0);
+                if (0 < query._bucketWidth)
+                {
+                    aRow.addInt(static_cast<int>(walker->_count));
+                }
+                for (std::vector<double>::const_iterator inner(walker->_values.begin());
+                     walker->_values.end() != inner; ++inner)
+                {
+                    aRow.addDouble(*inner);
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (okSoFar)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbService::fetchQueryRows
+
+void
+MovementDbService::fillInSecondaryInputChannelsList(ChannelVector & channels)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("channels = ", &channels); //####
+    inherited::fillInSecondaryInputChannelsList(channels);
+    _ingestLock.lock();
+    for (IngestChannelMap::const_iterator walker(_ingestChannels.begin());
+         _ingestChannels.end() != walker; ++walker)
+    {
+        GeneralChannel * aChannel = walker->second._channel;
+
+        if (aChannel)
+        {
+            ODL_S1s("aChannel = ", aChannel->name()); //####
+            ChannelDescription descriptor;
+
+            descriptor._portName = aChannel->name();
+            descriptor._portProtocol = aChannel->protocol();
+            descriptor._portMode = kChannelModeTCP;
+            descriptor._protocolDescription = aChannel->protocolDescription();
+            channels.push_back(descriptor);
+        }
+    }
+    _ingestLock.unlock();
+    ODL_OBJEXIT(); //####
+} // MovementDbService::fillInSecondaryInputChannelsList
+
+void
+MovementDbService::gatherMetrics(yarp::os::Bottle & metrics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("metrics = ", &metrics); //####
+    inherited::gatherMetrics(metrics);
+    _ingestLock.lock();
+    if (_ingester)
+    {
+        MovementIngestStatistics statistics;
+
+        _ingester->getStatistics(statistics);
+        // The frames received are counted as input and the journal writes as output.
+        SendReceiveCounters counters(0, static_cast<size_t>(statistics._framesQueued), 0,
+                                     static_cast<size_t>(statistics._groupsCommitted));
+
+        counters.addToList(metrics, getEndpoint().getName() + "/ingest");
+        yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+        if (props)
+        {
+            props->put(MpM_MOVEMENTDB_QUEUEDEPTH_, static_cast<int>(statistics._queueDepth));
+            props->put(MpM_MOVEMENTDB_SAMPLES_, static_cast<int>(statistics._samplesAdded));
+            props->put(MpM_MOVEMENTDB_DROPPED_, static_cast<int>(statistics._samplesDropped));
+            props->put(MpM_MOVEMENTDB_REJECTED_, static_cast<int>(statistics._samplesRejected));
+            props->put(MpM_MOVEMENTDB_GROUPSFAILED_, static_cast<int>(statistics._groupsFailed));
+            props->put(MpM_MOVEMENTDB_LARGESTGROUP_, static_cast<int>(statistics._largestGroup));
+            props->put(MpM_MOVEMENTDB_MEANCOMMITTIME_, statistics._meanCommitTime);
+            props->put(MpM_MOVEMENTDB_MAXCOMMITTIME_, statistics._maxCommitTime);
+        }
+    }
+    _ingestLock.unlock();
+    ODL_OBJEXIT(); //####
+} // MovementDbService::gatherMetrics
+
+bool
+MovementDbService::getSeriesList(const YarpString &         dataTrack,
+                                 MovementSeriesInfoVector & seriesList)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("dataTrack = ", dataTrack); //####
+    ODL_P1("seriesList = ", &seriesList); //####
+    bool okSoFar = false;
+
+    try
+    {
+        seriesList.clear();
+        if (_store.isOpen())
+        {
+            _store.getSeriesList(dataTrack, seriesList);
+            okSoFar = true;
+        }
+        else
+        {
+            ODL_LOG("! (_store.isOpen())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbService::getSeriesList
+
 bool
 MovementDbService::setDataTrack(const YarpString & key,
                                 const YarpString & dataTrack)
@@ -287,6 +599,189 @@ MovementDbService::setEmailAddress(const YarpString & key,
     return okSoFar;
 } // MovementDbService::setEmailAddress
 
+bool
+MovementDbService::startIngest(const YarpString & dataTrack,
+                               const YarpString & sourceChannel,
+                               YarpString &       ingestChannel)
+{
+    ODL_OBJENTER(); //####
+    ODL_S2s("dataTrack = ", dataTrack, "sourceChannel = ", sourceChannel); //####
+    ODL_P1("ingestChannel = ", &ingestChannel); //####
+    bool okSoFar = false;
+
+    try
+    {
+        _ingestLock.lock();
+        if (_store.isOpen() && (_ingestChannels.end() == _ingestChannels.find(sourceChannel)))
+        {
+            if (! _ingester)
+            {
+                _ingester = new MovementIngestThread(_store, MOVEMENTDB_INGEST_COMMIT_INTERVAL_,
+                                                     MOVEMENTDB_INGEST_MAX_PENDING_SAMPLES_);
+                if (! _ingester->start())
+                {
+                    ODL_LOG("(! _ingester->start())"); //####
+                    delete _ingester;
+                    _ingester = NULL;
+                }
+            }
+            if (_ingester)
+            {
+                IngestChannel     newEntry;
+                std::stringstream channelName;
+
+                channelName << getEndpoint().getName().c_str() << "/ingest" << ++_ingestCount;
+                ingestChannel = channelName.str().c_str();
+                newEntry._channel = new GeneralChannel(false);
+                newEntry._handler = new MovementIngestInputHandler(*_ingester, dataTrack);
+                if (newEntry._channel->openWithRetries(ingestChannel, STANDARD_WAIT_TIME_))
+                {
+                    if (metricsAreEnabled())
+                    {
+                        newEntry._channel->enableMetrics();
+                    }
+                    else
+                    {
+                        newEntry._channel->disableMetrics();
+                    }
+                    newEntry._handler->setChannel(newEntry._channel);
+                    newEntry._channel->setReader(*newEntry._handler);
+                    if (Utilities::NetworkConnectWithRetries(sourceChannel, ingestChannel,
+                                                             STANDARD_WAIT_TIME_))
+                    {
+                        _ingestChannels[sourceChannel] = newEntry;
+                        okSoFar = true;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (Utilities::NetworkConnectWithRetries(sourceChannel, " //####
+                                "ingestChannel, STANDARD_WAIT_TIME_))"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (newEntry._channel->openWithRetries(ingestChannel, " //####
+                            "STANDARD_WAIT_TIME_))"); //####
+                }
+                if (! okSoFar)
+                {
+                    BaseChannel::RelinquishChannel(newEntry._channel);
+                    delete newEntry._handler;
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_store.isOpen() && (_ingestChannels.end() == " //####
+                    "_ingestChannels.find(sourceChannel)))"); //####
+        }
+        _ingestLock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbService::startIngest
+
+bool
+MovementDbService::startQuery(const YarpString &    key,
+                              const MovementQuery & query,
+                              yarp::os::Bottle &    rows,
+                              bool &                more)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("key = ", key); //####
+    ODL_P3("query = ", &query, "rows = ", &rows, "more = ", &more); //####
+    bool okSoFar = false;
+
+    try
+    {
+        MovementDbContext * context = (MovementDbContext *) findContext(key);
+
+        if (! context)
+        {
+            context = new MovementDbContext;
+            addContext(key, context);
+        }
+        context->query() = query;
+        okSoFar = fetchQueryRows(context->query(), rows, more);
+        context->queryIsActive() = (okSoFar && more);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbService::startQuery
+
+void
+MovementDbService::stopAllIngest(void)
+{
+    ODL_OBJENTER(); //####
+    try
+    {
+        _ingestLock.lock();
+        for (IngestChannelMap::iterator walker(_ingestChannels.begin());
+             _ingestChannels.end() != walker; ++walker)
+        {
+            closeIngestChannel(walker->first, walker->second);
+        }
+        _ingestChannels.clear();
+        if (_ingester)
+        {
+            // The thread adds the samples that are waiting before it finishes.
+            _ingester->stop();
+            delete _ingester;
+            _ingester = NULL;
+        }
+        _ingestLock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // MovementDbService::stopAllIngest
+
+bool
+MovementDbService::stopIngest(const YarpString & sourceChannel)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("sourceChannel = ", sourceChannel); //####
+    bool okSoFar = false;
+
+    try
+    {
+        _ingestLock.lock();
+        IngestChannelMap::iterator match(_ingestChannels.find(sourceChannel));
+
+        if (_ingestChannels.end() != match)
+        {
+            closeIngestChannel(match->first, match->second);
+            _ingestChannels.erase(match);
+            okSoFar = true;
+        }
+        else
+        {
+            ODL_LOG("! (_ingestChannels.end() != match)"); //####
+        }
+        _ingestLock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDbService::stopIngest
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
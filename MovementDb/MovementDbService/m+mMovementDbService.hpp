@@ -39,7 +39,10 @@
 #if (! defined(MpMMovementDbService_HPP_))
 # define MpMMovementDbService_HPP_ /* Header guard */
 
+# include "m+mMovementStore.hpp"
+
 # include <m+m/m+mBaseService.hpp>
+# include <m+m/m+mGeneralChannel.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -58,14 +61,29 @@
 /*! @brief The description of the service. */
 # define MOVEMENTDB_SERVICE_DESCRIPTION_ T_("Movement database service")
 
+/*! @brief The time, in seconds, that live samples are gathered before they are added to the
+ store. */
+# define MOVEMENTDB_INGEST_COMMIT_INTERVAL_ (ONE_SECOND_DELAY_ / 100)
+
+/*! @brief The maximum number of live samples that can be waiting to be added to the store. */
+# define MOVEMENTDB_INGEST_MAX_PENDING_SAMPLES_ 100000
+
 namespace MplusM
 {
     namespace MovementDb
     {
         class AddFileRequestHandler;
+        class IngestRequestHandler;
+        class ListSeriesRequestHandler;
+        class MovementIngestInputHandler;
+        class MovementIngestThread;
+        class QueryDownsampledRequestHandler;
+        class QueryNextRequestHandler;
+        class QueryRangeRequestHandler;
         class SetDataTrackRequestHandler;
         class SetEmailRequestHandler;
         class StopDbRequestHandler;
+        class StopIngestRequestHandler;
 
         /*! @brief The movement database service. */
         class MovementDbService : public Common::BaseService
@@ -79,6 +97,20 @@ namespace MplusM
             /*! @brief The class that this class is derived from. */
             typedef BaseService inherited;
 
+            /*! @brief A channel that is receiving live movement data. */
+            struct IngestChannel
+            {
+                /*! @brief The channel that receives the data. */
+                Common::GeneralChannel * _channel;
+
+                /*! @brief The handler for the data. */
+                MovementIngestInputHandler * _handler;
+
+            }; // IngestChannel
+
+            /*! @brief A mapping from source channel names to the channels receiving their data. */
+            typedef std::map<YarpString, IngestChannel> IngestChannelMap;
+
         public :
 
             /*! @brief The constructor.
@@ -87,6 +119,7 @@ namespace MplusM
              @param[in] argv The arguments passed to the executable used to launch the service.
              @param[in] tag The modifier for the service name and port names.
              @param[in] databaseServerAddress The IP address of the database server.
+             @param[in] storePath The path to the file holding the movement data.
              @param[in] serviceEndpointName The YARP name to be assigned to the new service.
              @param[in] servicePortNumber The port being used by the service. */
             MovementDbService(const YarpString & launchPath,
@@ -94,6 +127,7 @@ namespace MplusM
                               char * *           argv,
                               const YarpString & tag,
                               const YarpString & databaseServerAddress,
+                              const YarpString & storePath,
                               const YarpString & serviceEndpointName,
                               const YarpString & servicePortNumber = "");
 
@@ -109,6 +143,35 @@ namespace MplusM
             addFileToDb(const YarpString & key,
                         const YarpString & filePath);
 
+            /*! @brief Return the next rows of the active query for a client.
+             @param[in] key The client-provided key.
+             @param[out] rows The rows, each a list of a time followed by values.
+             @param[out] more @c true if there are more rows to follow and @c false otherwise.
+             @returns @c true if the client has an active query and @c false otherwise. */
+            bool
+            continueQuery(const YarpString & key,
+                          yarp::os::Bottle & rows,
+                          bool &             more);
+
+            /*! @brief Fill in a list of secondary input channels for the service.
+             @param[in,out] channels The list of channels to be filled in. */
+            virtual void
+            fillInSecondaryInputChannelsList(Common::ChannelVector & channels);
+
+            /*! @brief Fill in the metrics for the service.
+             @param[in,out] metrics The gathered metrics. */
+            virtual void
+            gatherMetrics(yarp::os::Bottle & metrics);
+
+            /*! @brief Return descriptions of the stored series.
+             @param[in] dataTrack The data track of interest, or an empty string for all data
+             tracks.
+             @param[out] seriesList The descriptions of the matching series.
+             @returns @c true if the store is available and @c false otherwise. */
+            bool
+            getSeriesList(const YarpString &         dataTrack,
+                          MovementSeriesInfoVector & seriesList);
+
             /*! @brief Set the active data track.
              @param[in] key The client-provided key.
              @param[in] dataTrack The data track to use with subsequent files.
@@ -125,6 +188,40 @@ namespace MplusM
             setEmailAddress(const YarpString & key,
                             const YarpString & emailAddress);
 
+            /*! @brief Start adding the movement data from a channel to the store as it arrives.
+
+             A new input channel is opened and the source channel is connected to it. The samples
+             of each message are timed by their arrival and are added to the store in groups, so
+             that a single journal write covers all the messages received in a short interval.
+             @param[in] dataTrack The data track for the samples.
+             @param[in] sourceChannel The channel that provides the movement data.
+             @param[out] ingestChannel The name of the channel that receives the data.
+             @returns @c true if the channels were connected and @c false otherwise. */
+            bool
+            startIngest(const YarpString & dataTrack,
+                        const YarpString & sourceChannel,
+                        YarpString &       ingestChannel);
+
+            /*! @brief Start a query for a client and return its first rows.
+
+             Any previous query for the client is abandoned.
+             @param[in] key The client-provided key.
+             @param[in] query The query to be performed.
+             @param[out] rows The rows, each a list of a time followed by values.
+             @param[out] more @c true if there are more rows to follow and @c false otherwise.
+             @returns @c true if the series was found and @c false otherwise. */
+            bool
+            startQuery(const YarpString &    key,
+                       const MovementQuery & query,
+                       yarp::os::Bottle &    rows,
+                       bool &                more);
+
+            /*! @brief Stop adding the movement data from a channel to the store.
+             @param[in] sourceChannel The channel that provides the movement data.
+             @returns @c true if the channel was being ingested and @c false otherwise. */
+            bool
+            stopIngest(const YarpString & sourceChannel);
+
         protected :
 
         private :
@@ -137,6 +234,23 @@ namespace MplusM
             void
             attachRequestHandlers(void);
 
+            /*! @brief Disconnect and release a channel that is receiving live movement data.
+             @param[in] sourceChannel The channel that provides the movement data.
+             @param[in,out] anEntry The channel to be released. */
+            void
+            closeIngestChannel(const YarpString & sourceChannel,
+                               IngestChannel &    anEntry);
+
+            /*! @brief Return the next rows of a query.
+             @param[in,out] query The query to be performed.
+             @param[out] rows The rows, each a list of a time followed by values.
+             @param[out] more @c true if there are more rows to follow and @c false otherwise.
+             @returns @c true if the series was found and @c false otherwise. */
+            bool
+            fetchQueryRows(MovementQuery &    query,
+                           yarp::os::Bottle & rows,
+                           bool &             more);
+
             /*! @brief Disable the standard request handlers. */
             void
             detachRequestHandlers(void);
@@ -147,6 +261,11 @@ namespace MplusM
             MovementDbService &
             operator =(const MovementDbService & other);
 
+            /*! @brief Stop adding live movement data to the store and add any samples that are
+             waiting. */
+            void
+            stopAllIngest(void);
+
         public :
 
         protected :
@@ -156,9 +275,39 @@ namespace MplusM
             /*! @brief The IP address of the backend database server. */
             YarpString _databaseAddress;
 
+            /*! @brief The storage for the movement data. */
+            MovementStore _store;
+
+            /*! @brief The contention lock for the ingest channels. */
+            yarp::os::Mutex _ingestLock;
+
+            /*! @brief The channels receiving live movement data. */
+            IngestChannelMap _ingestChannels;
+
+            /*! @brief The thread that adds live samples to the store. */
+            MovementIngestThread * _ingester;
+
+            /*! @brief The number of ingest channels that have been opened. */
+            size_t _ingestCount;
+
             /*! @brief The request handler for the 'addfile' request. */
             AddFileRequestHandler * _addFileHandler;
 
+            /*! @brief The request handler for the 'ingest' request. */
+            IngestRequestHandler * _ingestHandler;
+
+            /*! @brief The request handler for the 'listseries' request. */
+            ListSeriesRequestHandler * _listSeriesHandler;
+
+            /*! @brief The request handler for the 'querydownsampled' request. */
+            QueryDownsampledRequestHandler * _queryDownsampledHandler;
+
+            /*! @brief The request handler for the 'querynext' request. */
+            QueryNextRequestHandler * _queryNextHandler;
+
+            /*! @brief The request handler for the 'queryrange' request. */
+            QueryRangeRequestHandler * _queryRangeHandler;
+
             /*! @brief The request handler for the 'setdatatrack' request. */
             SetDataTrackRequestHandler * _setDataTrackHandler;
 
@@ -168,6 +317,9 @@ namespace MplusM
             /*! @brief The request handler for the 'stop' request. */
             StopDbRequestHandler * _stopDbHandler;
 
+            /*! @brief The request handler for the 'stopingest' request. */
+            StopIngestRequestHandler * _stopIngestHandler;
+
         }; // MovementDbService
 
     } // MovementDb
@@ -40,6 +40,7 @@
 
 #include <m+m/m+mAddressArgumentDescriptor.hpp>
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mFilePathArgumentDescriptor.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -81,6 +82,14 @@ using std::endl;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief Define the root of the temporary file directory. */
+#if MAC_OR_LINUX_
+# define TEMP_ROOT_ kDirectorySeparator + "tmp"
+#else // ! MAC_OR_LINUX_
+# define TEMP_ROOT_ YarpString("C:") + kDirectorySeparator + "Windows" + kDirectorySeparator + \
+                    "Temp"
+#endif // ! MAC_OR_LINUX_
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -90,8 +99,9 @@ using std::endl;
 #endif // defined(__APPLE__)
 
 /*! @brief Set up the environment and start the movement database service.
- @param[in] databaseAddress The IP address of the database server to be connected to.
  @param[in] progName The path to the executable.
+ @param[in] databaseAddress The IP address of the database server to be connected to.
+ @param[in] storePath The path to the file holding the movement data.
  @param[in] argc The number of arguments in 'argv'.
  @param[in] argv The arguments to be used with the movement database service.
  @param[in] tag The modifier for the service name and port names.
@@ -102,6 +112,7 @@ using std::endl;
 static void
 setUpAndGo(const YarpString & progName,
            const YarpString & databaseAddress,
+           const YarpString & storePath,
            const int          argc,
            char * *           argv,
            const YarpString & tag,
@@ -112,12 +123,13 @@ setUpAndGo(const YarpString & progName,
     ODL_ENTER(); //####
     ODL_S4s("databaseAddress = ", databaseAddress, "progName = ", progName, "tag = ", tag, //####
             "serviceEndpointName = ", serviceEndpointName); //####
-    ODL_S1s("servicePortNumber = ", servicePortNumber); //####
+    ODL_S2s("servicePortNumber = ", servicePortNumber, "storePath = ", storePath); //####
     ODL_LL1("argc = ", argc); //####
     ODL_P1("argv = ", argv); //####
     ODL_B1("reportOnExit = ", reportOnExit); //####
     MovementDbService * aService = new MovementDbService(progName, argc, argv, tag, databaseAddress,
-                                                         serviceEndpointName, servicePortNumber);
+                                                         storePath, serviceEndpointName,
+                                                         servicePortNumber);
 
     if (aService)
     {
@@ -170,7 +182,8 @@ setUpAndGo(const YarpString & progName,
 
 /*! @brief The entry point for running the Movement Database service.
 
- The first argument is the IP address of the database server to be connected to.
+ The first argument is the IP address of the database server to be connected to and the second
+ argument is the path to the file holding the movement data.
  @param[in] argc The number of arguments in 'argv'.
  @param[in] argv The arguments to be used with the Movement Database service.
  @returns @c 0 on a successful test and @c 1 on failure. */
@@ -201,12 +214,18 @@ main(int      argc,
         YarpString                           serviceEndpointName;
         YarpString                           servicePortNumber;
         YarpString                           tag;
-        Utilities::AddressArgumentDescriptor firstArg("dbAddress", "Network address for database",
-                                                      Utilities::kArgModeRequired,
-                                                      SELF_ADDRESS_IPADDR_);
-        Utilities::DescriptorVector          argumentList;
+        Utilities::AddressArgumentDescriptor  firstArg("dbAddress", "Network address for database",
+                                                       Utilities::kArgModeRequired,
+                                                       SELF_ADDRESS_IPADDR_);
+        Utilities::FilePathArgumentDescriptor secondArg("storePath",
+                                                        T_("Path to the movement data file"),
+                                                        Utilities::kArgModeOptional,
+                                                        TEMP_ROOT_ + kDirectorySeparator +
+                                                        "movementdb", ".mdb", true);
+        Utilities::DescriptorVector           argumentList;
 
         argumentList.push_back(&firstArg);
+        argumentList.push_back(&secondArg);
         if (ProcessStandardServiceOptions(argc, argv, argumentList, MOVEMENTDB_SERVICE_DESCRIPTION_,
                                           "", 2014, STANDARD_COPYRIGHT_NAME_, goWasSet,
                                           reportEndpoint, reportOnExit, tag, serviceEndpointName,
@@ -228,9 +247,10 @@ main(int      argc,
                 else if (Utilities::CheckForRegistryService())
                 {
                     YarpString databaseAddress(firstArg.getCurrentValue());
+                    YarpString storePath(secondArg.getCurrentValue());
 
-                    setUpAndGo(databaseAddress, progName, argc, argv, tag, serviceEndpointName,
-                               servicePortNumber, reportOnExit);
+                    setUpAndGo(progName, databaseAddress, storePath, argc, argv, tag,
+                               serviceEndpointName, servicePortNumber, reportOnExit);
                 }
                 else
                 {
@@ -0,0 +1,1255 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mMovementDbTest.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The test driver for the unit tests of the movement store.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMovementIngest.hpp"
+#include "m+mMovementIngestThread.hpp"
+#include "m+mMovementStore.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <cmath>
+#include <cstdio>
+
+#if MAC_OR_LINUX_
+# include <unistd.h>
+#else // ! MAC_OR_LINUX_
+# include <fcntl.h>
+# include <io.h>
+# include <share.h>
+# include <sys/stat.h>
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The test driver for the unit tests of the movement store. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::MovementDb;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The default number of samples to store in a test. */
+static const int kDefaultSampleCount = 5000;
+
+/*! @brief The number of values in each test sample. */
+static const size_t kValuesPerSample = 7;
+
+/*! @brief The interval between test samples, in microseconds. */
+static const int64_t kSampleInterval = 8333;
+
+/*! @brief The file used to hold the test store. */
+#define TEST_STORE_PATH_ "movementdb_test.mdb"
+
+/*! @brief The file used to hold the test recording. */
+#define TEST_RECORDING_PATH_ "movementdb_test.json"
+
+/*! @brief The file used to hold the journal of the test store. */
+#define TEST_JOURNAL_PATH_ TEST_STORE_PATH_ ".wal"
+
+/*! @brief The file used to hold a copy of the test store. */
+#define TEST_COPY_PATH_ "movementdb_copy.mdb"
+
+/*! @brief The file used to hold a copy of the journal of the test store. */
+#define TEST_COPY_JOURNAL_PATH_ TEST_COPY_PATH_ ".wal"
+
+/*! @brief The number of samples in each group added to the journal. */
+static const int kSamplesPerGroup = 120;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the sample count from the test arguments.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns The sample count, or the default if it was not provided or not valid. */
+static int
+getSampleCount(const int argc,
+               char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = kDefaultSampleCount;
+
+    if (0 < argc)
+    {
+        const char * startPtr = *argv;
+        char *       endPtr;
+        int          value = strtol(startPtr, &endPtr, 10);
+
+        if ((startPtr != endPtr) && (! *endPtr) && (0 < value))
+        {
+            result = value;
+        }
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // getSampleCount
+
+/*! @brief Return a value of a test sample.
+ @param[in] index The sequence number of the sample.
+ @param[in] column The position of the value within the sample.
+ @returns A value of the sample. */
+static double
+makeValue(const int    index,
+          const size_t column)
+{
+    double result;
+
+    if ((kValuesPerSample - 1) == column)
+    {
+        // A value that rarely changes, as with the rotation of a stationary segment.
+        result = ((index / 100) % 2) ? 1.0 : 0.5;
+    }
+    else
+    {
+        result = 100.0 * sin((index * 0.01) + column);
+    }
+    return result;
+} // makeValue
+
+/*! @brief Add test samples to a store.
+ @param[in] store The store to be added to.
+ @param[in] firstIndex The sequence number of the first sample to be added.
+ @param[in] numSamples The number of samples to be added.
+ @returns @c true if the samples were added and @c false otherwise. */
+static bool
+addTestSamples(MovementStore & store,
+               const int       firstIndex,
+               const int       numSamples)
+{
+    ODL_ENTER(); //####
+    ODL_P1("store = ", &store); //####
+    ODL_LL2("firstIndex = ", firstIndex, "numSamples = ", numSamples); //####
+    bool okSoFar = true;
+
+    for (int ii = firstIndex, last = firstIndex + numSamples; okSoFar && (last > ii); ++ii)
+    {
+        double values[kValuesPerSample];
+
+        for (size_t jj = 0; kValuesPerSample > jj; ++jj)
+        {
+            values[jj] = makeValue(ii, jj);
+        }
+        okSoFar = store.addSample("track", "subject", "segment", ii * kSampleInterval, values,
+                                  kValuesPerSample);
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // addTestSamples
+
+/*! @brief Add test samples to a store in groups, through the journal.
+ @param[in] store The store to be added to.
+ @param[in] firstIndex The sequence number of the first sample to be added.
+ @param[in] numSamples The number of samples to be added.
+ @returns @c true if the samples were added and @c false otherwise. */
+static bool
+addTestSampleGroups(MovementStore & store,
+                    const int       firstIndex,
+                    const int       numSamples)
+{
+    ODL_ENTER(); //####
+    ODL_P1("store = ", &store); //####
+    ODL_LL2("firstIndex = ", firstIndex, "numSamples = ", numSamples); //####
+    bool                 okSoFar = true;
+    MovementSampleVector samples;
+
+    for (int ii = firstIndex, last = firstIndex + numSamples; okSoFar && (last > ii); )
+    {
+        size_t numRejected;
+
+        samples.clear();
+        for (int jj = 0; (kSamplesPerGroup > jj) && (last > ii); ++jj, ++ii)
+        {
+            samples.push_back(MovementSample());
+            MovementSample & aSample = samples.back();
+
+            aSample._dataTrack = "track";
+            aSample._subject = "subject";
+            aSample._segment = "segment";
+            aSample._time = ii * kSampleInterval;
+            for (size_t kk = 0; kValuesPerSample > kk; ++kk)
+            {
+                aSample._values.push_back(makeValue(ii, kk));
+            }
+        }
+        okSoFar = (store.addSamples(samples, numRejected) && (0 == numRejected));
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // addTestSampleGroups
+
+/*! @brief Add a segment, in the form sent by the Vicon input service, to a list of segments.
+ @param[in,out] segments The list of segments.
+ @param[in] segmentName The name of the segment.
+ @param[in] firstValue The first value of the segment. */
+static void
+addTestSegment(yarp::os::Bottle & segments,
+               const char *       segmentName,
+               const double       firstValue)
+{
+    ODL_ENTER(); //####
+    ODL_P1("segments = ", &segments); //####
+    ODL_S1("segmentName = ", segmentName); //####
+    ODL_D1("firstValue = ", firstValue); //####
+    yarp::os::Bottle & aSegment = segments.addList();
+
+    aSegment.addString(segmentName);
+    yarp::os::Bottle & segmentValues = aSegment.addList();
+
+    segmentValues.addDouble(firstValue);
+    for (size_t ii = 1; kValuesPerSample > ii; ++ii)
+    {
+        segmentValues.addDouble(static_cast<double>(ii));
+    }
+    ODL_EXIT(); //####
+} // addTestSegment
+
+/*! @brief Make a copy of a file.
+ @param[in] fromPath The path to the file to be copied.
+ @param[in] toPath The path to the copy.
+ @returns @c true if the file was copied and @c false otherwise. */
+static bool
+copyFile(const char * fromPath,
+         const char * toPath)
+{
+    ODL_ENTER(); //####
+    ODL_S2("fromPath = ", fromPath, "toPath = ", toPath); //####
+    bool   okSoFar = false;
+    FILE * inFile;
+    FILE * outFile;
+
+#if MAC_OR_LINUX_
+    inFile = fopen(fromPath, "rb");
+    outFile = fopen(toPath, "wb");
+#else // ! MAC_OR_LINUX_
+    if (fopen_s(&inFile, fromPath, "rb"))
+    {
+        inFile = NULL;
+    }
+    if (fopen_s(&outFile, toPath, "wb"))
+    {
+        outFile = NULL;
+    }
+#endif // ! MAC_OR_LINUX_
+    if (inFile && outFile)
+    {
+        char   buffer[10240];
+        size_t numRead;
+
+        okSoFar = true;
+        for ( ; okSoFar && (0 < (numRead = fread(buffer, 1, sizeof(buffer), inFile))); )
+        {
+            okSoFar = (numRead == fwrite(buffer, 1, numRead, outFile));
+        }
+    }
+    if (inFile)
+    {
+        fclose(inFile);
+    }
+    if (outFile)
+    {
+        fclose(outFile);
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // copyFile
+
+/*! @brief Set up a query for the test series.
+ @param[out] query The query to be set up.
+ @param[in] startTime The earliest time of interest.
+ @param[in] endTime The latest time of interest.
+ @param[in] bucketWidth The width of each bucket, or zero for the stored samples.
+ @param[in] maxRows The maximum number of rows to return in each piece. */
+static void
+setUpQuery(MovementQuery & query,
+           const int64_t   startTime,
+           const int64_t   endTime,
+           const int64_t   bucketWidth,
+           const size_t    maxRows)
+{
+    query._dataTrack = "track";
+    query._subject = "subject";
+    query._segment = "segment";
+    query._startTime = startTime;
+    query._endTime = endTime;
+    query._bucketWidth = bucketWidth;
+    query._maxRows = maxRows;
+} // setUpQuery
+
+/*! @brief Check that a query returns exactly the expected test samples.
+ @param[in] store The store to be queried.
+ @param[in] firstIndex The sequence number of the first expected sample.
+ @param[in] numSamples The number of expected samples.
+ @param[in] maxRows The maximum number of rows to return in each piece.
+ @returns @c true if the expected samples were returned and @c false otherwise. */
+static bool
+checkTestSamples(MovementStore & store,
+                 const int       firstIndex,
+                 const int       numSamples,
+                 const size_t    maxRows)
+{
+    ODL_ENTER(); //####
+    ODL_P1("store = ", &store); //####
+    ODL_LL3("firstIndex = ", firstIndex, "numSamples = ", numSamples, "maxRows = ", //####
+            maxRows); //####
+    bool              okSoFar = true;
+    bool              more = true;
+    int               index = firstIndex;
+    MovementQuery     query;
+    MovementRowVector rows;
+
+    setUpQuery(query, firstIndex * kSampleInterval,
+               ((firstIndex + numSamples) * kSampleInterval) - 1, 0, maxRows);
+    for ( ; okSoFar && more; )
+    {
+        okSoFar = (store.fetchRows(query, rows, more) && (maxRows >= rows.size()));
+        for (MovementRowVector::const_iterator walker(rows.begin());
+             okSoFar && (rows.end() != walker); ++walker, ++index)
+        {
+            okSoFar = ((index * kSampleInterval) == walker->_time) &&
+                      (kValuesPerSample == walker->_values.size());
+            for (size_t jj = 0; okSoFar && (kValuesPerSample > jj); ++jj)
+            {
+                // The compression is lossless, so the values must be identical.
+                okSoFar = (makeValue(index, jj) == walker->_values[jj]);
+            }
+        }
+    }
+    if (okSoFar)
+    {
+        okSoFar = ((firstIndex + numSamples) == index);
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // checkTestSamples
+
+/*! @brief Return the size of a file.
+ @param[in] filePath The path to the file.
+ @returns The size of the file or @c -1 if it could not be opened. */
+static long
+getFileSize(const char * filePath)
+{
+    ODL_ENTER(); //####
+    ODL_S1("filePath = ", filePath); //####
+    long   result = -1;
+    FILE * aFile;
+
+#if MAC_OR_LINUX_
+    aFile = fopen(filePath, "rb");
+#else // ! MAC_OR_LINUX_
+    if (fopen_s(&aFile, filePath, "rb"))
+    {
+        aFile = NULL;
+    }
+#endif // ! MAC_OR_LINUX_
+    if (aFile)
+    {
+        fseek(aFile, 0, SEEK_END);
+        result = ftell(aFile);
+        fclose(aFile);
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // getFileSize
+
+/*! @brief Discard the end of a file.
+ @param[in] filePath The path to the file.
+ @param[in] newSize The new size of the file.
+ @returns @c true if the file was shortened and @c false otherwise. */
+static bool
+truncateTestFile(const char * filePath,
+                 const long   newSize)
+{
+    ODL_ENTER(); //####
+    ODL_S1("filePath = ", filePath); //####
+    ODL_LL1("newSize = ", newSize); //####
+    bool okSoFar;
+
+#if MAC_OR_LINUX_
+    okSoFar = (0 == truncate(filePath, newSize));
+#else // ! MAC_OR_LINUX_
+    int handle;
+
+    okSoFar = (0 == _sopen_s(&handle, filePath, _O_RDWR | _O_BINARY, _SH_DENYNO,
+                             _S_IREAD | _S_IWRITE));
+    if (okSoFar)
+    {
+        okSoFar = (0 == _chsize_s(handle, newSize));
+        _close(handle);
+    }
+#endif // ! MAC_OR_LINUX_
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // truncateTestFile
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 01 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestRangeQueryInPieces(const char * launchPath,
+                         const int    argc,
+                         char * *     argv) // range query in pieces
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int           numSamples = getSampleCount(argc, argv);
+        MovementStore store;
+
+        remove(TEST_STORE_PATH_);
+        if (store.open(TEST_STORE_PATH_))
+        {
+            // Sealed chunks and the open chunk are both searched, and the pieces do not line up
+            // with the chunks.
+            if (addTestSamples(store, 0, numSamples) &&
+                checkTestSamples(store, 0, numSamples, 333) &&
+                checkTestSamples(store, numSamples / 3, numSamples / 2, 1000))
+            {
+                MovementQuery     query;
+                MovementRowVector rows;
+                bool              more;
+                double            values[kValuesPerSample] = { 0 };
+
+                // A sample that is out of time order or has the wrong number of values is
+                // rejected and a series that is not present is not found.
+                setUpQuery(query, 0, 0, 0, 10);
+                query._segment = "missing";
+                if ((! store.addSample("track", "subject", "segment", 0, values,
+                                       kValuesPerSample)) &&
+                    (! store.addSample("track", "subject", "segment",
+                                       (numSamples + 1) * kSampleInterval, values,
+                                       kValuesPerSample - 1)) &&
+                    (! store.fetchRows(query, rows, more)))
+                {
+                    result = 0;
+                }
+            }
+            store.close();
+        }
+        else
+        {
+            ODL_LOG("! (store.open(TEST_STORE_PATH_))"); //####
+        }
+        remove(TEST_STORE_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestRangeQueryInPieces
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 02 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestDownsampledQuery(const char * launchPath,
+                       const int    argc,
+                       char * *     argv) // downsampled query in pieces
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int           numSamples = getSampleCount(argc, argv);
+        MovementStore store;
+
+        remove(TEST_STORE_PATH_);
+        if (store.open(TEST_STORE_PATH_) && addTestSamples(store, 0, numSamples))
+        {
+            const int64_t     startTime = 12345;
+            const int64_t     bucketWidth = 100000;
+            bool              okSoFar = true;
+            bool              more = true;
+            int64_t           expectedStart = startTime;
+            size_t            samplesSeen = 0;
+            size_t            samplesExpected = 0;
+            MovementQuery     query;
+            MovementRowVector rows;
+
+            setUpQuery(query, startTime, numSamples * kSampleInterval, bucketWidth, 7);
+            for ( ; okSoFar && more; )
+            {
+                okSoFar = (store.fetchRows(query, rows, more) && (7 >= rows.size()));
+                for (MovementRowVector::const_iterator walker(rows.begin());
+                     okSoFar && (rows.end() != walker); ++walker)
+                {
+                    double sum = 0;
+                    int    firstIndex = static_cast<int>((walker->_time + kSampleInterval - 1) /
+                                                         kSampleInterval);
+
+                    // Every bucket holds samples, since the buckets are wider than the sample
+                    // interval, and the bucket mean is the mean of the samples in the bucket.
+                    okSoFar = (expectedStart == walker->_time) && (0 < walker->_count);
+                    for (size_t ii = 0; okSoFar && (walker->_count > ii); ++ii)
+                    {
+                        sum += makeValue(firstIndex + static_cast<int>(ii), 0);
+                    }
+                    if (okSoFar)
+                    {
+                        okSoFar = (1e-9 > fabs((sum / walker->_count) - walker->_values[0]));
+                    }
+                    expectedStart += bucketWidth;
+                    samplesSeen += walker->_count;
+                }
+            }
+            for (int ii = 0; numSamples > ii; ++ii)
+            {
+                if (startTime <= (ii * kSampleInterval))
+                {
+                    ++samplesExpected;
+                }
+            }
+            if (okSoFar && (samplesExpected == samplesSeen))
+            {
+                result = 0;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (store.open(TEST_STORE_PATH_) && addTestSamples(store, 0, " //####
+                    "numSamples))"); //####
+        }
+        store.close();
+        remove(TEST_STORE_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestDownsampledQuery
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 03 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestReopenStore(const char * launchPath,
+                  const int    argc,
+                  char * *     argv) // rebuild the index when reopened
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int  numSamples = getSampleCount(argc, argv);
+        bool okSoFar = false;
+
+        remove(TEST_STORE_PATH_);
+        {
+            MovementStore store;
+
+            okSoFar = (store.open(TEST_STORE_PATH_) && addTestSamples(store, 0, numSamples));
+            // Closing the store seals the partially-filled chunk.
+        }
+        if (okSoFar)
+        {
+            MovementStore            store;
+            MovementSeriesInfoVector seriesList;
+
+            okSoFar = false;
+            if (store.open(TEST_STORE_PATH_))
+            {
+                store.getSeriesList("", seriesList);
+                if ((1 == seriesList.size()) &&
+                    (static_cast<size_t>(numSamples) == seriesList[0]._numSamples) &&
+                    (kValuesPerSample == seriesList[0]._numColumns) &&
+                    (((numSamples - 1) * kSampleInterval) == seriesList[0]._lastTime))
+                {
+                    // Samples added after reopening follow on from those already stored.
+                    okSoFar = (addTestSamples(store, numSamples, numSamples / 2) &&
+                               checkTestSamples(store, 0, numSamples + (numSamples / 2), 1000));
+                }
+            }
+            if (okSoFar)
+            {
+                store.getSeriesList("other", seriesList);
+                okSoFar = (0 == seriesList.size());
+            }
+        }
+        if (okSoFar)
+        {
+            result = 0;
+        }
+        remove(TEST_STORE_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestReopenStore
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 04 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestInterruptedWrite(const char * launchPath,
+                       const int    argc,
+                       char * *     argv) // recover from an incomplete last record
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int  numSamples = getSampleCount(argc, argv);
+        int  sealedSamples = static_cast<int>((numSamples / MovementStore::kMaxSamplesPerChunk) *
+                                              MovementStore::kMaxSamplesPerChunk);
+        bool okSoFar = false;
+
+        remove(TEST_STORE_PATH_);
+        {
+            MovementStore store;
+
+            okSoFar = (store.open(TEST_STORE_PATH_) && addTestSamples(store, 0, numSamples));
+        }
+        if (okSoFar && (sealedSamples < numSamples))
+        {
+            long fileSize = getFileSize(TEST_STORE_PATH_);
+
+            // Chop the end off the last record, which holds the samples that did not fill a
+            // chunk, as if the writer had been stopped part way through.
+            okSoFar = truncateTestFile(TEST_STORE_PATH_, fileSize - 3);
+            if (okSoFar)
+            {
+                MovementStore            store;
+                MovementSeriesInfoVector seriesList;
+
+                okSoFar = false;
+                if (store.open(TEST_STORE_PATH_))
+                {
+                    store.getSeriesList("track", seriesList);
+                    if ((1 == seriesList.size()) &&
+                        (static_cast<size_t>(sealedSamples) == seriesList[0]._numSamples))
+                    {
+                        // The damaged record is discarded, so the lost samples can be added
+                        // again.
+                        okSoFar = (addTestSamples(store, sealedSamples,
+                                                  numSamples - sealedSamples) &&
+                                   checkTestSamples(store, 0, numSamples, 500));
+                    }
+                }
+            }
+        }
+        if (okSoFar)
+        {
+            result = 0;
+        }
+        remove(TEST_STORE_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestInterruptedWrite
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 05 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestAddRecording(const char * launchPath,
+                   const int    argc,
+                   char * *     argv) // add a recorded file
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int    numFrames = getSampleCount(argc, argv);
+        FILE * outFile;
+
+#if MAC_OR_LINUX_
+        outFile = fopen(TEST_RECORDING_PATH_, "w");
+#else // ! MAC_OR_LINUX_
+        if (fopen_s(&outFile, TEST_RECORDING_PATH_, "w"))
+        {
+            outFile = NULL;
+        }
+#endif // ! MAC_OR_LINUX_
+        if (outFile)
+        {
+            MovementStore store;
+
+            // Write frames in the form produced by recording the Vicon input service.
+            fputs("[\n", outFile);
+            for (int ii = 0; numFrames > ii; ++ii)
+            {
+                fprintf(outFile, "%s{ \"time\" : %.3f, \"value\" : [ [ \"Fred\", { \"head\" : "
+                        "[ %d, 2, 3, 0, 0, 0, 1 ], \"hand\" : [ 1.5, %d, 3, 0, 0, 0, 1 ] } ], "
+                        "[ \"Wilma\", { \"foot\" : [ 1, 2, 3, 4, 5, 6, 7 ] } ] ] }\n",
+                        ii ? "," : "", 1000 + (ii * 8.333), ii, -ii);
+            }
+            fputs("]\n", outFile);
+            fclose(outFile);
+            remove(TEST_STORE_PATH_);
+            if (store.open(TEST_STORE_PATH_))
+            {
+                IngestCounts counts;
+
+                if (AddRecordingToStore(store, "session", TEST_RECORDING_PATH_, counts) &&
+                    (static_cast<size_t>(numFrames) == counts._numFrames) &&
+                    (static_cast<size_t>(numFrames * 3) == counts._numSamples) &&
+                    (0 == counts._numRejected))
+                {
+                    MovementSeriesInfoVector seriesList;
+                    MovementQuery            query;
+                    MovementRowVector        rows;
+                    bool                     more;
+
+                    store.getSeriesList("session", seriesList);
+                    query._dataTrack = "session";
+                    query._subject = "Fred";
+                    query._segment = "hand";
+                    query._startTime = 0;
+                    query._endTime = 2000000;
+                    query._bucketWidth = 0;
+                    query._maxRows = 1;
+                    if ((3 == seriesList.size()) && store.fetchRows(query, rows, more) &&
+                        (1 == rows.size()) && (1000000 == rows[0]._time) &&
+                        (7 == rows[0]._values.size()) && (1.5 == rows[0]._values[0]) &&
+                        (more == (1 < numFrames)))
+                    {
+                        // Adding the same recording again is rejected, as the samples are not
+                        // later than those already stored.
+                        if (AddRecordingToStore(store, "session", TEST_RECORDING_PATH_, counts)
+                            && (0 == counts._numSamples) &&
+                            (static_cast<size_t>(numFrames * 3) == counts._numRejected))
+                        {
+                            result = 0;
+                        }
+                    }
+                }
+                store.close();
+            }
+            else
+            {
+                ODL_LOG("! (store.open(TEST_STORE_PATH_))"); //####
+            }
+            remove(TEST_STORE_PATH_);
+            remove(TEST_RECORDING_PATH_);
+        }
+        else
+        {
+            ODL_LOG("! (outFile)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestAddRecording
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 06 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestJournalRecovery(const char * launchPath,
+                      const int    argc,
+                      char * *     argv) // recover journalled samples
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int  numSamples = getSampleCount(argc, argv);
+        bool okSoFar = false;
+
+        remove(TEST_STORE_PATH_);
+        remove(TEST_JOURNAL_PATH_);
+        {
+            MovementStore store;
+
+            if (store.open(TEST_STORE_PATH_) && addTestSampleGroups(store, 0, numSamples))
+            {
+                // Samples are visible to queries as soon as they are added, and the files are
+                // copied while the store is still open, as if the service had stopped abruptly.
+                okSoFar = (checkTestSamples(store, 0, numSamples, 1000) &&
+                           copyFile(TEST_STORE_PATH_, TEST_COPY_PATH_) &&
+                           copyFile(TEST_JOURNAL_PATH_, TEST_COPY_JOURNAL_PATH_));
+            }
+        }
+        if (okSoFar)
+        {
+            MovementStore store;
+
+            // The samples that were not sealed into chunks are recovered from the journal, and
+            // adding them again is rejected.
+            okSoFar = (store.open(TEST_COPY_PATH_) &&
+                       checkTestSamples(store, 0, numSamples, 1000) &&
+                       (! addTestSampleGroups(store, numSamples - 1, 1)) &&
+                       addTestSampleGroups(store, numSamples, numSamples / 2) &&
+                       checkTestSamples(store, 0, numSamples + (numSamples / 2), 1000));
+        }
+        if (okSoFar)
+        {
+            result = 0;
+        }
+        remove(TEST_STORE_PATH_);
+        remove(TEST_JOURNAL_PATH_);
+        remove(TEST_COPY_PATH_);
+        remove(TEST_COPY_JOURNAL_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestJournalRecovery
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 07 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestInterruptedJournal(const char * launchPath,
+                         const int    argc,
+                         char * *     argv) // recover from an incomplete journal record
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int  numSamples = getSampleCount(argc, argv);
+        int  lastGroupSize = numSamples % kSamplesPerGroup;
+        bool okSoFar = false;
+
+        if (0 == lastGroupSize)
+        {
+            lastGroupSize = kSamplesPerGroup;
+        }
+        remove(TEST_STORE_PATH_);
+        remove(TEST_JOURNAL_PATH_);
+        {
+            MovementStore store;
+
+            if (store.open(TEST_STORE_PATH_) && addTestSampleGroups(store, 0, numSamples))
+            {
+                okSoFar = (copyFile(TEST_STORE_PATH_, TEST_COPY_PATH_) &&
+                           copyFile(TEST_JOURNAL_PATH_, TEST_COPY_JOURNAL_PATH_));
+            }
+        }
+        if (okSoFar)
+        {
+            MovementStore            store;
+            MovementSeriesInfoVector seriesList;
+
+            // Chop the end off the last journal record, as if the writer had been stopped part
+            // way through; only the last group is lost.
+            okSoFar = (truncateTestFile(TEST_COPY_JOURNAL_PATH_,
+                                        getFileSize(TEST_COPY_JOURNAL_PATH_) - 3) &&
+                       store.open(TEST_COPY_PATH_));
+            if (okSoFar)
+            {
+                store.getSeriesList("track", seriesList);
+                okSoFar = ((1 == seriesList.size()) &&
+                           (static_cast<size_t>(numSamples - lastGroupSize) ==
+                            seriesList[0]._numSamples) &&
+                           addTestSampleGroups(store, numSamples - lastGroupSize,
+                                               lastGroupSize) &&
+                           checkTestSamples(store, 0, numSamples, 1000));
+            }
+        }
+        if (okSoFar)
+        {
+            result = 0;
+        }
+        remove(TEST_STORE_PATH_);
+        remove(TEST_JOURNAL_PATH_);
+        remove(TEST_COPY_PATH_);
+        remove(TEST_COPY_JOURNAL_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestInterruptedJournal
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 08 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestLiveFrames(const char * launchPath,
+                 const int    argc,
+                 char * *     argv) // add live frames in groups
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int           numFrames = getSampleCount(argc, argv);
+        MovementStore store;
+
+        remove(TEST_STORE_PATH_);
+        remove(TEST_JOURNAL_PATH_);
+        if (store.open(TEST_STORE_PATH_))
+        {
+            bool                     okSoFar = true;
+            MovementIngestStatistics statistics;
+            MovementIngestThread     ingester(store, 0.002, numFrames * 3);
+
+            if (ingester.start())
+            {
+                MovementSampleVector samples;
+
+                // Send frames in the form produced by the Vicon input service.
+                for (int ii = 0; okSoFar && (numFrames > ii); ++ii)
+                {
+                    yarp::os::Bottle   frame;
+                    yarp::os::Bottle & fred = frame.addList();
+
+                    fred.addString("Fred");
+                    yarp::os::Bottle & fredSegments = fred.addList();
+
+                    addTestSegment(fredSegments, "head", ii);
+                    addTestSegment(fredSegments, "hand", -ii);
+                    yarp::os::Bottle & wilma = frame.addList();
+
+                    wilma.addString("Wilma");
+                    yarp::os::Bottle & wilmaSegments = wilma.addList();
+
+                    addTestSegment(wilmaSegments, "foot", 1);
+                    AddFrameToSamples(frame, "live", ii * kSampleInterval, samples);
+                    okSoFar = ((3 == samples.size()) && ingester.addFrame(samples));
+                }
+                // Stopping the thread adds the samples that are still waiting.
+                ingester.stop();
+            }
+            else
+            {
+                ODL_LOG("! (ingester.start())"); //####
+                okSoFar = false;
+            }
+            ingester.getStatistics(statistics);
+            if (okSoFar && (numFrames == statistics._framesQueued) &&
+                ((numFrames * 3) == statistics._samplesAdded) &&
+                (0 == statistics._samplesDropped) && (0 == statistics._samplesRejected) &&
+                (0 < statistics._groupsCommitted) && (0 == statistics._groupsFailed))
+            {
+                MovementSeriesInfoVector seriesList;
+                MovementQuery            query;
+                MovementRowVector        rows;
+                bool                     more;
+
+                // The frames produce the same series as a recording of them would.
+                store.getSeriesList("live", seriesList);
+                query._dataTrack = "live";
+                query._subject = "Fred";
+                query._segment = "hand";
+                query._startTime = 0;
+                query._endTime = numFrames * kSampleInterval;
+                query._bucketWidth = 0;
+                query._maxRows = numFrames + 1;
+                if ((3 == seriesList.size()) && store.fetchRows(query, rows, more) &&
+                    (static_cast<size_t>(numFrames) == rows.size()) && (! more) &&
+                    (7 == rows.back()._values.size()) &&
+                    ((1 - numFrames) == rows.back()._values[0]))
+                {
+                    result = 0;
+                }
+            }
+            store.close();
+        }
+        else
+        {
+            ODL_LOG("! (store.open(TEST_STORE_PATH_))"); //####
+        }
+        remove(TEST_STORE_PATH_);
+        remove(TEST_JOURNAL_PATH_);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestLiveFrames
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for unit tests of the movement store.
+
+ The first argument is the test number and the optional second argument is the number of samples
+ to be stored. Output depends on the test being run.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        Initialize(progName);
+        if (0 < --argc)
+        {
+            const char * startPtr = argv[1];
+            char *       endPtr;
+            int          selector = strtol(startPtr, &endPtr, 10);
+
+            ODL_LL1("selector <- ", selector); //####
+            if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+            {
+                switch (selector)
+                {
+                    case 1 :
+                        result = doTestRangeQueryInPieces(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 2 :
+                        result = doTestDownsampledQuery(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 3 :
+                        result = doTestReopenStore(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 4 :
+                        result = doTestInterruptedWrite(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 5 :
+                        result = doTestAddRecording(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 6 :
+                        result = doTestJournalRecovery(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 7 :
+                        result = doTestInterruptedJournal(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 8 :
+                        result = doTestLiveFrames(*argv, argc - 1, argv + 2);
+                        break;
+
+                    default :
+                        break;
+
+                }
+                if (result)
+                {
+                    ODL_LL1("%%%%%%% unit test failure = ", result); //####
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 < --argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // main
@@ -0,0 +1,652 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mMovementIngest.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The function definitions for adding recorded movement data to the movement store.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMovementIngest.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include "rapidjson/document.h"
+
+#include <cmath>
+#include <sstream>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The function definitions for adding recorded movement data to the movement store. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::MovementDb;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The information needed while flattening a frame. */
+struct FlattenState
+{
+    /*! @brief The store to be added to, or @c NULL if the samples are being gathered. */
+    MovementStore * _store;
+
+    /*! @brief The gathered samples, if there is no store. */
+    MovementSampleVector * _samples;
+
+    /*! @brief The data track for the samples. */
+    const YarpString * _dataTrack;
+
+    /*! @brief The results of the operation, if there is a store. */
+    IngestCounts * _counts;
+
+    /*! @brief The values of the current sample. */
+    std::vector<double> _values;
+
+    /*! @brief The time of the frame, in microseconds. */
+    int64_t _frameTime;
+
+}; // FlattenState
+
+/*! @brief The segment name to use for a value that is not within an object. */
+#define DEFAULT_SEGMENT_NAME_ "value"
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Add a sample to the store, or to the gathered samples if there is no store.
+ @param[in,out] state The information needed while flattening a frame.
+ @param[in] subject The subject for the sample.
+ @param[in] path The segment name for the sample. */
+static void
+addSampleToStore(FlattenState &     state,
+                 const YarpString & subject,
+                 const YarpString & path)
+{
+    ODL_ENTER(); //####
+    ODL_P1("state = ", &state); //####
+    ODL_S2s("subject = ", subject, "path = ", path); //####
+    YarpString segment(path.length() ? path : DEFAULT_SEGMENT_NAME_);
+
+    if (state._store)
+    {
+        if (state._store->addSample(*state._dataTrack, subject, segment, state._frameTime,
+                                    &state._values[0], state._values.size()))
+        {
+            ++state._counts->_numSamples;
+        }
+        else
+        {
+            ++state._counts->_numRejected;
+        }
+    }
+    else
+    {
+        state._samples->push_back(MovementSample());
+        MovementSample & newSample = state._samples->back();
+
+        newSample._dataTrack = *state._dataTrack;
+        newSample._subject = subject;
+        newSample._segment = segment;
+        newSample._time = state._frameTime;
+        newSample._values = state._values;
+    }
+    ODL_EXIT(); //####
+} // addSampleToStore
+
+/*! @brief Return @c true if a JSON value can be stored as a number.
+ @param[in] aValue The value to be checked.
+ @returns @c true if the value can be stored as a number and @c false otherwise. */
+static bool
+isNumeric(const rapidjson::Value & aValue)
+{
+    return (aValue.IsNumber() || aValue.IsBool());
+} // isNumeric
+
+/*! @brief Return @c true if a YARP value can be stored as a number.
+ @param[in] aValue The value to be checked.
+ @returns @c true if the value can be stored as a number and @c false otherwise. */
+static bool
+isNumeric(const yarp::os::Value & aValue)
+{
+    return (aValue.isInt() || aValue.isDouble() || aValue.isBool());
+} // isNumeric
+
+/*! @brief Append a component to a segment name.
+ @param[in] path The segment name to be extended.
+ @param[in] component The component to be appended.
+ @returns The extended segment name. */
+static YarpString
+joinPath(const YarpString & path,
+         const YarpString & component)
+{
+    YarpString result(path);
+
+    if (result.length())
+    {
+        result += "/";
+    }
+    result += component;
+    return result;
+} // joinPath
+
+/*! @brief Return the number held by a JSON value.
+ @param[in] aValue The value to be converted.
+ @returns The number held by the value. */
+static double
+numericValue(const rapidjson::Value & aValue)
+{
+    double result;
+
+    if (aValue.IsBool())
+    {
+        result = (aValue.GetBool() ? 1 : 0);
+    }
+    else
+    {
+        result = aValue.GetDouble();
+    }
+    return result;
+} // numericValue
+
+/*! @brief Return the number held by a YARP value.
+ @param[in] aValue The value to be converted.
+ @returns The number held by the value. */
+static double
+numericValue(const yarp::os::Value & aValue)
+{
+    double result;
+
+    if (aValue.isBool())
+    {
+        result = (aValue.asBool() ? 1 : 0);
+    }
+    else
+    {
+        result = aValue.asDouble();
+    }
+    return result;
+} // numericValue
+
+/*! @brief Convert a JSON value into samples and add them to the store.
+ @param[in,out] state The information needed while flattening a frame.
+ @param[in] aValue The value to be processed.
+ @param[in] subject The subject for the samples.
+ @param[in] path The segment name for the samples. */
+static void
+flattenValue(FlattenState &           state,
+             const rapidjson::Value & aValue,
+             const YarpString &       subject,
+             const YarpString &       path);
+
+/*! @brief Convert an element of a JSON array into samples and add them to the store.
+ @param[in,out] state The information needed while flattening a frame.
+ @param[in] anElement The element to be processed.
+ @param[in] subject The subject for the samples.
+ @param[in] path The segment name for the samples.
+ @param[in] index The position of the element within the array. */
+static void
+flattenElement(FlattenState &           state,
+               const rapidjson::Value & anElement,
+               const YarpString &       subject,
+               const YarpString &       path,
+               const size_t             index)
+{
+    ODL_ENTER(); //####
+    ODL_P2("state = ", &state, "anElement = ", &anElement); //####
+    ODL_S2s("subject = ", subject, "path = ", path); //####
+    ODL_LL1("index = ", index); //####
+    if (anElement.IsArray() && (0 < anElement.Size()) && anElement[0].IsString())
+    {
+        // The element names itself.
+        flattenValue(state, anElement, subject, path);
+    }
+    else
+    {
+        std::stringstream component;
+
+        component << index;
+        flattenValue(state, anElement, subject, joinPath(path, component.str().c_str()));
+    }
+    ODL_EXIT(); //####
+} // flattenElement
+
+static void
+flattenValue(FlattenState &           state,
+             const rapidjson::Value & aValue,
+             const YarpString &       subject,
+             const YarpString &       path)
+{
+    ODL_ENTER(); //####
+    ODL_P2("state = ", &state, "aValue = ", &aValue); //####
+    ODL_S2s("subject = ", subject, "path = ", path); //####
+    if (isNumeric(aValue))
+    {
+        state._values.assign(1, numericValue(aValue));
+        addSampleToStore(state, subject, path);
+    }
+    else if (aValue.IsArray())
+    {
+        rapidjson::SizeType numElements = aValue.Size();
+        bool                allNumeric = (0 < numElements);
+
+        for (rapidjson::SizeType ii = 0; allNumeric && (ii < numElements); ++ii)
+        {
+            allNumeric = isNumeric(aValue[ii]);
+        }
+        if (allNumeric)
+        {
+            state._values.resize(numElements);
+            for (rapidjson::SizeType ii = 0; ii < numElements; ++ii)
+            {
+                state._values[ii] = numericValue(aValue[ii]);
+            }
+            addSampleToStore(state, subject, path);
+        }
+        else if ((0 < numElements) && aValue[0].IsString())
+        {
+            YarpString tag(aValue[0].GetString());
+
+            for (rapidjson::SizeType ii = 1; ii < numElements; ++ii)
+            {
+                const YarpString & newSubject = (subject.length() ? subject : tag);
+                YarpString         newPath(subject.length() ? joinPath(path, tag) : path);
+
+                if (2 == numElements)
+                {
+                    flattenValue(state, aValue[ii], newSubject, newPath);
+                }
+                else
+                {
+                    flattenElement(state, aValue[ii], newSubject, newPath, ii - 1);
+                }
+            }
+        }
+        else
+        {
+            for (rapidjson::SizeType ii = 0; ii < numElements; ++ii)
+            {
+                flattenElement(state, aValue[ii], subject, path, ii);
+            }
+        }
+    }
+    else if (aValue.IsObject())
+    {
+        for (rapidjson::Value::ConstMemberIterator walker(aValue.MemberBegin());
+             aValue.MemberEnd() != walker; ++walker)
+        {
+            flattenValue(state, walker->value, subject, joinPath(path, walker->name.GetString()));
+        }
+    }
+    // Strings and nulls carry no samples.
+    ODL_EXIT(); //####
+} // flattenValue
+
+/*! @brief Convert a YARP value into samples.
+ @param[in,out] state The information needed while flattening a frame.
+ @param[in] aValue The value to be processed.
+ @param[in] subject The subject for the samples.
+ @param[in] path The segment name for the samples. */
+static void
+flattenValue(FlattenState &          state,
+             const yarp::os::Value & aValue,
+             const YarpString &      subject,
+             const YarpString &      path);
+
+/*! @brief Convert a YARP list into samples.
+
+ The list is treated in the same way as the JSON value that RecordAsJSON would have written for
+ it, so that live and recorded frames produce the same series.
+ @param[in,out] state The information needed while flattening a frame.
+ @param[in] aList The list to be processed.
+ @param[in] subject The subject for the samples.
+ @param[in] path The segment name for the samples.
+ @param[in] isMessage @c true if the list is a complete message, which RecordAsJSON always
+ writes as an array. */
+static void
+flattenList(FlattenState &           state,
+            const yarp::os::Bottle & aList,
+            const YarpString &       subject,
+            const YarpString &       path,
+            const bool               isMessage = false);
+
+/*! @brief Convert a list of key-value pairs into samples.
+ @param[in,out] state The information needed while flattening a frame.
+ @param[in] pairs The key-value pairs to be processed.
+ @param[in] subject The subject for the samples.
+ @param[in] path The segment name for the samples. */
+static void
+flattenPairs(FlattenState &           state,
+             const yarp::os::Bottle & pairs,
+             const YarpString &       subject,
+             const YarpString &       path)
+{
+    ODL_ENTER(); //####
+    ODL_P2("state = ", &state, "pairs = ", &pairs); //####
+    ODL_S2s("subject = ", subject, "path = ", path); //####
+    for (int ii = 0, mm = pairs.size(); mm > ii; ++ii)
+    {
+        yarp::os::Bottle * aPair = pairs.get(ii).asList();
+
+        if (aPair && (2 == aPair->size()))
+        {
+            flattenValue(state, aPair->get(1), subject,
+                         joinPath(path, aPair->get(0).toString()));
+        }
+    }
+    ODL_EXIT(); //####
+} // flattenPairs
+
+/*! @brief Convert an element of a YARP list into samples.
+ @param[in,out] state The information needed while flattening a frame.
+ @param[in] anElement The element to be processed.
+ @param[in] subject The subject for the samples.
+ @param[in] path The segment name for the samples.
+ @param[in] index The position of the element within the list. */
+static void
+flattenElement(FlattenState &          state,
+               const yarp::os::Value & anElement,
+               const YarpString &      subject,
+               const YarpString &      path,
+               const size_t            index)
+{
+    ODL_ENTER(); //####
+    ODL_P2("state = ", &state, "anElement = ", &anElement); //####
+    ODL_S2s("subject = ", subject, "path = ", path); //####
+    ODL_LL1("index = ", index); //####
+    yarp::os::Bottle * asList = (anElement.isList() ? anElement.asList() : NULL);
+
+    if (asList && (0 < asList->size()) && asList->get(0).isString())
+    {
+        // The element names itself.
+        flattenList(state, *asList, subject, path);
+    }
+    else
+    {
+        std::stringstream component;
+
+        component << index;
+        flattenValue(state, anElement, subject, joinPath(path, component.str().c_str()));
+    }
+    ODL_EXIT(); //####
+} // flattenElement
+
+static void
+flattenList(FlattenState &           state,
+            const yarp::os::Bottle & aList,
+            const YarpString &       subject,
+            const YarpString &       path,
+            const bool               isMessage)
+{
+    ODL_ENTER(); //####
+    ODL_P2("state = ", &state, "aList = ", &aList); //####
+    ODL_S2s("subject = ", subject, "path = ", path); //####
+    ODL_B1("isMessage = ", isMessage); //####
+    int                numElements = aList.size();
+    bool               allNumeric = (0 < numElements);
+    yarp::os::Property asDict;
+
+    for (int ii = 0; allNumeric && (numElements > ii); ++ii)
+    {
+        allNumeric = isNumeric(aList.get(ii));
+    }
+    if (allNumeric)
+    {
+        state._values.resize(numElements);
+        for (int ii = 0; numElements > ii; ++ii)
+        {
+            state._values[ii] = numericValue(aList.get(ii));
+        }
+        addSampleToStore(state, subject, path);
+    }
+    else if ((! isMessage) && ListIsReallyDictionary(aList, asDict))
+    {
+        // RecordAsJSON writes such a list as an object.
+        flattenPairs(state, aList, subject, path);
+    }
+    else if ((0 < numElements) && aList.get(0).isString())
+    {
+        YarpString tag(aList.get(0).toString());
+
+        for (int ii = 1; numElements > ii; ++ii)
+        {
+            const YarpString & newSubject = (subject.length() ? subject : tag);
+            YarpString         newPath(subject.length() ? joinPath(path, tag) : path);
+
+            if (2 == numElements)
+            {
+                flattenValue(state, aList.get(ii), newSubject, newPath);
+            }
+            else
+            {
+                flattenElement(state, aList.get(ii), newSubject, newPath, ii - 1);
+            }
+        }
+    }
+    else
+    {
+        for (int ii = 0; numElements > ii; ++ii)
+        {
+            flattenElement(state, aList.get(ii), subject, path, ii);
+        }
+    }
+    ODL_EXIT(); //####
+} // flattenList
+
+static void
+flattenValue(FlattenState &          state,
+             const yarp::os::Value & aValue,
+             const YarpString &      subject,
+             const YarpString &      path)
+{
+    ODL_ENTER(); //####
+    ODL_P2("state = ", &state, "aValue = ", &aValue); //####
+    ODL_S2s("subject = ", subject, "path = ", path); //####
+    if (isNumeric(aValue))
+    {
+        state._values.assign(1, numericValue(aValue));
+        addSampleToStore(state, subject, path);
+    }
+    else if (aValue.isList())
+    {
+        yarp::os::Bottle * asList = aValue.asList();
+
+        if (asList)
+        {
+            flattenList(state, *asList, subject, path);
+        }
+    }
+    else if (aValue.isDict())
+    {
+        yarp::os::Property * asDict = aValue.asDict();
+
+        if (asDict)
+        {
+            // The entries of a dictionary are only available as a list of key-value pairs.
+            yarp::os::Bottle pairs(asDict->toString());
+
+            flattenPairs(state, pairs, subject, path);
+        }
+    }
+    // Strings carry no samples.
+    ODL_EXIT(); //####
+} // flattenValue
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+void
+MovementDb::AddFrameToSamples(const yarp::os::Bottle & frame,
+                              const YarpString &       dataTrack,
+                              const int64_t            frameTime,
+                              MovementSampleVector &   samples)
+{
+    ODL_ENTER(); //####
+    ODL_P2("frame = ", &frame, "samples = ", &samples); //####
+    ODL_S1s("dataTrack = ", dataTrack); //####
+    ODL_LL1("frameTime = ", frameTime); //####
+    FlattenState state;
+
+    state._store = NULL;
+    state._samples = &samples;
+    state._dataTrack = &dataTrack;
+    state._counts = NULL;
+    state._frameTime = frameTime;
+    // A message with a single value is recorded as that value, rather than as a list.
+    if (1 == frame.size())
+    {
+        flattenValue(state, frame.get(0), "", "");
+    }
+    else
+    {
+        flattenList(state, frame, "", "", true);
+    }
+    ODL_EXIT(); //####
+} // MovementDb::AddFrameToSamples
+
+bool
+MovementDb::AddRecordingToStore(MovementStore &    store,
+                                const YarpString & dataTrack,
+                                const YarpString & filePath,
+                                IngestCounts &     counts)
+{
+    ODL_ENTER(); //####
+    ODL_P2("store = ", &store, "counts = ", &counts); //####
+    ODL_S2s("dataTrack = ", dataTrack, "filePath = ", filePath); //####
+    bool   okSoFar = false;
+    FILE * inFile;
+
+    counts._numFrames = counts._numSamples = counts._numRejected = 0;
+#if MAC_OR_LINUX_
+    inFile = fopen(filePath.c_str(), "r");
+#else // ! MAC_OR_LINUX_
+    if (fopen_s(&inFile, filePath.c_str(), "r"))
+    {
+        inFile = NULL;
+    }
+#endif // ! MAC_OR_LINUX_
+    if (inFile)
+    {
+        YarpString          dataSource;
+        char                buffer[10240];
+        size_t              numRead;
+        rapidjson::Document jsonData;
+
+        for ( ; ! feof(inFile); )
+        {
+            numRead = fread(buffer, 1, sizeof(buffer), inFile);
+            if (numRead)
+            {
+                dataSource.append(buffer, numRead);
+            }
+            else if (ferror(inFile))
+            {
+                break;
+            }
+
+        }
+        fclose(inFile);
+        jsonData.Parse<rapidjson::kParseFullPrecisionFlag>(dataSource.c_str());
+        if (jsonData.HasParseError())
+        {
+            ODL_LOG("(jsonData.HasParseError())"); //####
+        }
+        else if (jsonData.IsArray())
+        {
+            FlattenState state;
+
+            state._store = &store;
+            state._samples = NULL;
+            state._dataTrack = &dataTrack;
+            state._counts = &counts;
+            okSoFar = true;
+            for (rapidjson::Value::ConstValueIterator walker(jsonData.Begin());
+                 jsonData.End() != walker; ++walker)
+            {
+                const rapidjson::Value & aFrame(*walker);
+
+                if (aFrame.IsObject() && aFrame.HasMember("time") && aFrame.HasMember("value") &&
+                    aFrame["time"].IsNumber())
+                {
+                    // Convert from milliseconds to microseconds.
+                    state._frameTime = static_cast<int64_t>(floor((aFrame["time"].GetDouble() *
+                                                                   1000) + 0.5));
+                    flattenValue(state, aFrame["value"], "", "");
+                    ++counts._numFrames;
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (jsonData.IsArray())"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (inFile)"); //####
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementDb::AddRecordingToStore
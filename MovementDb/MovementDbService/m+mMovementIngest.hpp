@@ -0,0 +1,111 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mMovementIngest.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The function declarations for adding recorded movement data to the movement store.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMMovementIngest_HPP_))
+# define MpMMovementIngest_HPP_ /* Header guard */
+
+# include "m+mMovementStore.hpp"
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The function declarations for adding recorded movement data to the movement store. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace MovementDb
+    {
+        /*! @brief The results of adding movement data to the store. */
+        struct IngestCounts
+        {
+            /*! @brief The number of frames that were processed. */
+            size_t _numFrames;
+
+            /*! @brief The number of samples that were added to the store. */
+            size_t _numSamples;
+
+            /*! @brief The number of samples that were not added to the store, because they were
+             out of time order or had the wrong number of values for their series. */
+            size_t _numRejected;
+
+        }; // IngestCounts
+
+        /*! @brief Convert a received message into samples.
+
+         The message is flattened in the same way as the frames of a recording file, so that the
+         samples match those that would be added from a recording of the same message.
+         @param[in] frame The received message.
+         @param[in] dataTrack The data track for the samples.
+         @param[in] frameTime The time of the message, in microseconds.
+         @param[in,out] samples The list that the samples are to be appended to. */
+        void
+        AddFrameToSamples(const yarp::os::Bottle & frame,
+                          const YarpString &       dataTrack,
+                          const int64_t            frameTime,
+                          MovementSampleVector &   samples);
+
+        /*! @brief Add the samples from a recording file to the store.
+
+         The file is expected to be in the form written by the RecordAsJSON output service - an
+         array of objects, each with a @c time in milliseconds and a @c value holding the frame.
+         Each frame is flattened into samples: a list that starts with a string names the subject
+         for the rest of the list (or adds a level to the segment name, if a subject is already
+         known), the keys of an object are joined with '/' to form the segment name and a list of
+         numbers, or a single number, provides the values for the sample.
+         @param[in] store The store to be added to.
+         @param[in] dataTrack The data track for the samples.
+         @param[in] filePath The path to the file.
+         @param[out] counts The results of the operation.
+         @returns @c true if the file was read and @c false otherwise. */
+        bool
+        AddRecordingToStore(MovementStore &    store,
+                            const YarpString & dataTrack,
+                            const YarpString & filePath,
+                            IngestCounts &     counts);
+
+    } // MovementDb
+
+} // MplusM
+
+#endif // ! defined(MpMMovementIngest_HPP_)
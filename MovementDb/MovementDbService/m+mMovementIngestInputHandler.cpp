@@ -0,0 +1,162 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mMovementIngestInputHandler.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the input handler used by the movement database service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMovementIngestInputHandler.hpp"
+#include "m+mMovementIngest.hpp"
+#include "m+mMovementIngestThread.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <cmath>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the input handler used by the movement database service. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::MovementDb;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+MovementIngestInputHandler::MovementIngestInputHandler(MovementIngestThread & ingester,
+                                                       const YarpString &     dataTrack) :
+    inherited(), _samples(), _dataTrack(dataTrack), _ingester(ingester), _lastFrameTime(0)
+{
+    ODL_ENTER(); //####
+    ODL_P1("ingester = ", &ingester); //####
+    ODL_S1s("dataTrack = ", dataTrack); //####
+    ODL_EXIT_P(this); //####
+} // MovementIngestInputHandler::MovementIngestInputHandler
+
+MovementIngestInputHandler::~MovementIngestInputHandler(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // MovementIngestInputHandler::~MovementIngestInputHandler
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+MovementIngestInputHandler::handleInput(const yarp::os::Bottle &     input,
+                                        const YarpString &           senderChannel,
+                                        yarp::os::ConnectionWriter * replyMechanism,
+                                        const size_t                 numBytes)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(senderChannel,replyMechanism,numBytes)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_L1("numBytes = ", numBytes); //####
+    bool result = true;
+
+    try
+    {
+        int64_t frameTime = static_cast<int64_t>(floor((yarp::os::Time::now() * 1e6) + 0.5));
+
+        // The samples of a series must be in increasing time order, even if two frames arrive
+        // within the resolution of the clock.
+        if (frameTime <= _lastFrameTime)
+        {
+            frameTime = _lastFrameTime + 1;
+        }
+        _lastFrameTime = frameTime;
+        AddFrameToSamples(input, _dataTrack, frameTime, _samples);
+        if (! _samples.empty())
+        {
+            if (! _ingester.addFrame(_samples))
+            {
+                ODL_LOG("(! _ingester.addFrame(_samples))"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MovementIngestInputHandler::handleInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
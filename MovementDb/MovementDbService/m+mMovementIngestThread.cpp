@@ -0,0 +1,257 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mMovementIngestThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the thread that adds live samples to the movement store.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMovementIngestThread.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the thread that adds live samples to the movement store. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::MovementDb;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+MovementIngestThread::MovementIngestThread(MovementStore & store,
+                                           const double    commitInterval,
+                                           const size_t    maxPendingSamples) :
+    inherited(), _lock(), _wakeUp(0), _pending(), _store(store), _commitTimeSum(0),
+    _commitInterval(commitInterval), _maxPendingSamples(maxPendingSamples ? maxPendingSamples : 1)
+{
+    ODL_ENTER(); //####
+    ODL_P1("store = ", &store); //####
+    ODL_D1("commitInterval = ", commitInterval); //####
+    ODL_LL1("maxPendingSamples = ", maxPendingSamples); //####
+    resetStatistics();
+    ODL_EXIT_P(this); //####
+} // MovementIngestThread::MovementIngestThread
+
+MovementIngestThread::~MovementIngestThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // MovementIngestThread::~MovementIngestThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+MovementIngestThread::addFrame(MovementSampleVector & samples)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("samples = ", &samples); //####
+    bool   result;
+    bool   wakeThread = false;
+    size_t numSamples = samples.size();
+
+    _lock.lock();
+    if (_maxPendingSamples < (_pending.size() + numSamples))
+    {
+        ODL_LOG("(_maxPendingSamples < (_pending.size() + numSamples))"); //####
+        _statistics._samplesDropped += numSamples;
+        result = false;
+    }
+    else
+    {
+        ++_statistics._framesQueued;
+        _statistics._samplesQueued += numSamples;
+        if (_pending.empty())
+        {
+            // Only signal when the buffer stops being empty, so that the semaphore count stays
+            // small.
+            wakeThread = (0 < numSamples);
+            _pending.swap(samples);
+        }
+        else
+        {
+            _pending.insert(_pending.end(), samples.begin(), samples.end());
+        }
+        result = true;
+    }
+    _lock.unlock();
+    samples.clear();
+    if (wakeThread)
+    {
+        _wakeUp.post();
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MovementIngestThread::addFrame
+
+void
+MovementIngestThread::commitPending(MovementSampleVector & group)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("group = ", &group); //####
+    group.clear();
+    _lock.lock();
+    _pending.swap(group);
+    _lock.unlock();
+    if (! group.empty())
+    {
+        size_t numRejected = 0;
+        double startTime = yarp::os::Time::now();
+        bool   committed = _store.addSamples(group, numRejected);
+        double commitTime = yarp::os::Time::now() - startTime;
+
+        _lock.lock();
+        _commitTimeSum += commitTime;
+        if (_statistics._maxCommitTime < commitTime)
+        {
+            _statistics._maxCommitTime = commitTime;
+        }
+        if (committed)
+        {
+            ++_statistics._groupsCommitted;
+            _statistics._samplesAdded += group.size() - numRejected;
+            _statistics._samplesRejected += numRejected;
+            if (_statistics._largestGroup < group.size())
+            {
+                _statistics._largestGroup = group.size();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (committed)"); //####
+            ++_statistics._groupsFailed;
+            _statistics._samplesRejected += group.size();
+        }
+        _lock.unlock();
+    }
+    ODL_OBJEXIT(); //####
+} // MovementIngestThread::commitPending
+
+void
+MovementIngestThread::getStatistics(MovementIngestStatistics & statistics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("statistics = ", &statistics); //####
+    _lock.lock();
+    int64_t numCommits = _statistics._groupsCommitted + _statistics._groupsFailed;
+
+    statistics = _statistics;
+    statistics._queueDepth = _pending.size();
+    if (0 < numCommits)
+    {
+        statistics._meanCommitTime = _commitTimeSum / numCommits;
+    }
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // MovementIngestThread::getStatistics
+
+void
+MovementIngestThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _wakeUp.post();
+    ODL_OBJEXIT(); //####
+} // MovementIngestThread::onStop
+
+void
+MovementIngestThread::resetStatistics(void)
+{
+    ODL_OBJENTER(); //####
+    _lock.lock();
+    _statistics._queueDepth = _statistics._largestGroup = 0;
+    _statistics._framesQueued = _statistics._samplesQueued = _statistics._samplesDropped = 0;
+    _statistics._samplesAdded = _statistics._samplesRejected = 0;
+    _statistics._groupsCommitted = _statistics._groupsFailed = 0;
+    _statistics._meanCommitTime = _statistics._maxCommitTime = 0;
+    _commitTimeSum = 0;
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // MovementIngestThread::resetStatistics
+
+void
+MovementIngestThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    MovementSampleVector group;
+
+    for ( ; ! isStopping(); )
+    {
+        _wakeUp.wait();
+        if ((! isStopping()) && (0 < _commitInterval))
+        {
+            // Let the other channels catch up, so that their frames share the journal write.
+            yarp::os::Time::delay(_commitInterval);
+        }
+        commitPending(group);
+    }
+    // Add whatever is still waiting, so that stopping the ingest doesn't lose data.
+    commitPending(group);
+    ODL_OBJEXIT(); //####
+} // MovementIngestThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
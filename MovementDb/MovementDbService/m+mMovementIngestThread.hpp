@@ -0,0 +1,213 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mMovementIngestThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the thread that adds live samples to the movement store.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMMovementIngestThread_HPP_))
+# define MpMMovementIngestThread_HPP_ /* Header guard */
+
+# include "m+mMovementStore.hpp"
+
+# include <m+m/m+mBaseThread.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the thread that adds live samples to the movement store. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace MovementDb
+    {
+        /*! @brief A snapshot of the activity of the ingest thread. */
+        struct MovementIngestStatistics
+        {
+            /*! @brief The number of samples currently waiting to be added. */
+            size_t _queueDepth;
+
+            /*! @brief The largest number of samples that have been added as a single group. */
+            size_t _largestGroup;
+
+            /*! @brief The number of frames accepted. */
+            int64_t _framesQueued;
+
+            /*! @brief The number of samples accepted. */
+            int64_t _samplesQueued;
+
+            /*! @brief The number of samples discarded because too many were waiting. */
+            int64_t _samplesDropped;
+
+            /*! @brief The number of samples added to the store. */
+            int64_t _samplesAdded;
+
+            /*! @brief The number of samples that the store did not accept. */
+            int64_t _samplesRejected;
+
+            /*! @brief The number of groups written to the journal. */
+            int64_t _groupsCommitted;
+
+            /*! @brief The number of groups that could not be written to the journal. */
+            int64_t _groupsFailed;
+
+            /*! @brief The mean time, in seconds, spent in adding a group. */
+            double _meanCommitTime;
+
+            /*! @brief The longest time, in seconds, spent in adding a group. */
+            double _maxCommitTime;
+
+        }; // MovementIngestStatistics
+
+        /*! @brief A thread that adds live samples to the movement store.
+
+         The input handlers append the samples of each frame to a pending buffer without waiting
+         on the store. When the buffer stops being empty the thread waits for the commit interval,
+         so that the frames from all the ingest channels that arrive in that time share a single
+         journal write, and then adds them with MovementStore::addSamples. Queries are not held up
+         by the journal write, as the store is only locked while each group is applied. */
+        class MovementIngestThread : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] store The store to be added to.
+             @param[in] commitInterval The time, in seconds, to gather samples before they are
+             added to the store.
+             @param[in] maxPendingSamples The maximum number of samples that can be waiting. */
+            MovementIngestThread(MovementStore & store,
+                                 const double    commitInterval,
+                                 const size_t    maxPendingSamples);
+
+            /*! @brief The destructor. */
+            virtual
+            ~MovementIngestThread(void);
+
+            /*! @brief Add the samples of a frame to the pending buffer.
+
+             This never waits for the store. If the buffer is full, the whole frame is discarded,
+             so that the samples of each series stay in time order.
+             @param[in,out] samples The samples of the frame, which are moved to the buffer.
+             @returns @c true if the frame was accepted and @c false if it was discarded. */
+            bool
+            addFrame(MovementSampleVector & samples);
+
+            /*! @brief Retrieve the activity of the thread.
+             @param[out] statistics The activity of the thread. */
+            void
+            getStatistics(MovementIngestStatistics & statistics);
+
+            /*! @brief Reset the activity of the thread. */
+            void
+            resetStatistics(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            MovementIngestThread(const MovementIngestThread & other);
+
+            /*! @brief Add the pending samples to the store as a single group.
+             @param[in,out] group Scratch space for the samples being added. */
+            void
+            commitPending(MovementSampleVector & group);
+
+            /*! @brief Called when the thread is being asked to stop. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            MovementIngestThread &
+            operator =(const MovementIngestThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock for the pending buffer and the activity. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Signalled when the pending buffer stops being empty. */
+            yarp::os::Semaphore _wakeUp;
+
+            /*! @brief The samples waiting to be added. */
+            MovementSampleVector _pending;
+
+            /*! @brief The store to be added to. */
+            MovementStore & _store;
+
+            /*! @brief The activity of the thread. */
+            MovementIngestStatistics _statistics;
+
+            /*! @brief The sum of the commit times, used to calculate the mean. */
+            double _commitTimeSum;
+
+            /*! @brief The time to gather samples before they are added to the store. */
+            double _commitInterval;
+
+            /*! @brief The maximum number of samples that can be waiting. */
+            size_t _maxPendingSamples;
+
+        }; // MovementIngestThread
+
+    } // MovementDb
+
+} // MplusM
+
+#endif // ! defined(MpMMovementIngestThread_HPP_)
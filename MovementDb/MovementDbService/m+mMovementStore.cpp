@@ -0,0 +1,2095 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mMovementStore.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the storage used by the movement database service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMovementStore.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if MAC_OR_LINUX_
+# include <unistd.h>
+#else // ! MAC_OR_LINUX_
+# include <io.h>
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the storage used by the movement database service. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::MovementDb;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The location of a sealed chunk in the file. */
+struct MovementStore::ChunkDescriptor
+{
+    /*! @brief The time of the first sample in the chunk. */
+    int64_t _firstTime;
+
+    /*! @brief The time of the last sample in the chunk. */
+    int64_t _lastTime;
+
+    /*! @brief The offset in the file of the contents of the chunk record. */
+    int64_t _payloadOffset;
+
+    /*! @brief The number of bytes in the contents of the chunk record. */
+    size_t _payloadLength;
+
+    /*! @brief The number of samples in the chunk. */
+    size_t _count;
+
+}; // MovementStore::ChunkDescriptor
+
+/*! @brief The samples of a sealed chunk, after decompression. */
+struct MovementStore::DecodedChunk
+{
+    /*! @brief The series that the chunk belongs to. */
+    SeriesEntry * _series;
+
+    /*! @brief The index of the chunk within the series. */
+    size_t _chunkIndex;
+
+    /*! @brief The sample times. */
+    std::vector<int64_t> _times;
+
+    /*! @brief The sample values, a row at a time. */
+    std::vector<double> _values;
+
+}; // MovementStore::DecodedChunk
+
+/*! @brief The index information for a series. */
+struct MovementStore::SeriesEntry
+{
+    /*! @brief The identifier of the series within the file. */
+    size_t _id;
+
+    /*! @brief The data track that the series belongs to. */
+    YarpString _dataTrack;
+
+    /*! @brief The subject that the series belongs to. */
+    YarpString _subject;
+
+    /*! @brief The segment that the series describes. */
+    YarpString _segment;
+
+    /*! @brief The number of values in each sample. */
+    size_t _numColumns;
+
+    /*! @brief The number of samples in the series. */
+    size_t _numSamples;
+
+    /*! @brief The time of the first sample in the series. */
+    int64_t _firstTime;
+
+    /*! @brief The time of the last sample in the series. */
+    int64_t _lastTime;
+
+    /*! @brief The sealed chunks of the series, in time order. */
+    std::vector<ChunkDescriptor> _chunks;
+
+    /*! @brief The times of the samples that have not been sealed. */
+    std::vector<int64_t> _openTimes;
+
+    /*! @brief The values of the samples that have not been sealed, a row at a time. */
+    std::vector<double> _openValues;
+
+}; // MovementStore::SeriesEntry
+
+/*! @brief The progress of a query through the samples of a series. */
+struct QueryState
+{
+    /*! @brief The query being answered. */
+    MovementQuery * _query;
+
+    /*! @brief The rows that have been produced. */
+    MovementRowVector * _rows;
+
+    /*! @brief The sums of the values for the current bucket of a downsampled query. */
+    std::vector<double> _sums;
+
+    /*! @brief The start of the current bucket of a downsampled query. */
+    int64_t _bucketStart;
+
+    /*! @brief The time at which the query is to be resumed. */
+    int64_t _resumeTime;
+
+    /*! @brief The number of samples in the current bucket of a downsampled query. */
+    size_t _bucketCount;
+
+    /*! @brief The number of values in each sample. */
+    size_t _numColumns;
+
+    /*! @brief @c true if there are rows following those produced. */
+    bool _more;
+
+    /*! @brief @c true if no more samples are needed. */
+    bool _done;
+
+}; // QueryState
+
+/*! @brief The kinds of records in the file. */
+enum RecordKind
+{
+    /*! @brief The record defines a series. */
+    kRecordKindSeries = 1,
+
+    /*! @brief The record holds a chunk of samples. */
+    kRecordKindChunk = 2,
+
+    /*! @brief The record holds a group of journalled samples. */
+    kRecordKindSamples = 3,
+
+    /*! @brief Force the size to be 1 byte. */
+    kRecordKindUnknown = 0xFF
+
+}; // RecordKind
+
+/*! @brief The bytes at the start of the file. */
+static const char kFileMagic[] = "MpMMDB01";
+
+/*! @brief The number of bytes at the start of the file. */
+static const size_t kFileMagicLength = sizeof(kFileMagic) - 1;
+
+/*! @brief The bytes at the start of the journal. */
+static const char kJournalMagic[] = "MpMMDJ01";
+
+/*! @brief The number of bytes at the start of the journal. */
+static const size_t kJournalMagicLength = sizeof(kJournalMagic) - 1;
+
+/*! @brief The suffix added to the path of the store to form the path of the journal. */
+#define JOURNAL_SUFFIX_ ".wal"
+
+/*! @brief The size of the journal at which the open chunks are sealed so that the journal can be
+ emptied. */
+static const int64_t kMaxJournalBytes = 4 * 1024 * 1024;
+
+/*! @brief The number of bytes in the header of each record: kind, payload length and payload
+ checksum. */
+static const size_t kRecordHeaderLength = 9;
+
+/*! @brief The number of bytes needed to hold the fixed part of the contents of a chunk record. */
+static const size_t kChunkHeaderMaxLength = 40;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Accumulate bits into a byte string, most significant bit first. */
+class BitWriter
+{
+public :
+
+    /*! @brief The constructor.
+     @param[in,out] output The byte string to be added to. */
+    explicit
+    BitWriter(std::string & output) :
+        _output(output), _accumulator(0), _numBits(0)
+    {
+    } // BitWriter
+
+    /*! @brief Write out any incomplete byte. */
+    void
+    finish(void)
+    {
+        if (0 < _numBits)
+        {
+            _output += static_cast<char>(_accumulator << (8 - _numBits));
+            _accumulator = 0;
+            _numBits = 0;
+        }
+    } // finish
+
+    /*! @brief Add bits.
+     @param[in] value The bits to be added, in the low-order part of the value.
+     @param[in] count The number of bits to be added. */
+    void
+    writeBits(const uint64_t value,
+              const int      count)
+    {
+        for (int ii = count - 1; 0 <= ii; --ii)
+        {
+            _accumulator = static_cast<uint8_t>((_accumulator << 1) | ((value >> ii) & 1));
+            if (8 == ++_numBits)
+            {
+                _output += static_cast<char>(_accumulator);
+                _accumulator = 0;
+                _numBits = 0;
+            }
+        }
+    } // writeBits
+
+private :
+
+    /*! @brief The byte string to be added to. */
+    std::string & _output;
+
+    /*! @brief The bits of the incomplete byte. */
+    uint8_t _accumulator;
+
+    /*! @brief The number of bits in the incomplete byte. */
+    int _numBits;
+
+}; // BitWriter
+
+/*! @brief Retrieve bits from a byte string, most significant bit first. */
+class BitReader
+{
+public :
+
+    /*! @brief The constructor.
+     @param[in] start The first byte to be read.
+     @param[in] end The byte following the last byte to be read. */
+    BitReader(const uint8_t * start,
+              const uint8_t * end) :
+        _cursor(start), _end(end), _bitOffset(0), _overrun(false)
+    {
+    } // BitReader
+
+    /*! @brief Return @c true if an attempt was made to read past the end of the bytes.
+     @returns @c true if an attempt was made to read past the end of the bytes. */
+    bool
+    overrun(void)
+    const
+    {
+        return _overrun;
+    } // overrun
+
+    /*! @brief Retrieve bits.
+     @param[in] count The number of bits to be retrieved.
+     @returns The bits, in the low-order part of the value. */
+    uint64_t
+    readBits(const int count)
+    {
+        uint64_t result = 0;
+
+        for (int ii = 0; ii < count; ++ii)
+        {
+            if (_cursor < _end)
+            {
+                result = (result << 1) | ((*_cursor >> (7 - _bitOffset)) & 1);
+                if (8 == ++_bitOffset)
+                {
+                    _bitOffset = 0;
+                    ++_cursor;
+                }
+            }
+            else
+            {
+                _overrun = true;
+                result <<= 1;
+            }
+        }
+        return result;
+    } // readBits
+
+private :
+
+    /*! @brief The byte being read. */
+    const uint8_t * _cursor;
+
+    /*! @brief The byte following the last byte to be read. */
+    const uint8_t * _end;
+
+    /*! @brief The next bit to be read within the current byte. */
+    int _bitOffset;
+
+    /*! @brief @c true if an attempt was made to read past the end of the bytes. */
+    bool _overrun;
+
+}; // BitReader
+
+/*! @brief Add a 32-bit value to a byte string, least significant byte first.
+ @param[in,out] output The byte string to be added to.
+ @param[in] value The value to be added. */
+static void
+appendFixed32(std::string & output,
+              const uint32_t value)
+{
+    for (int ii = 0; ii < 4; ++ii)
+    {
+        output += static_cast<char>((value >> (8 * ii)) & 0x00FF);
+    }
+} // appendFixed32
+
+/*! @brief Add a 64-bit value to a byte string, least significant byte first.
+ @param[in,out] output The byte string to be added to.
+ @param[in] value The value to be added. */
+static void
+appendFixed64(std::string &  output,
+              const uint64_t value)
+{
+    for (int ii = 0; ii < 8; ++ii)
+    {
+        output += static_cast<char>((value >> (8 * ii)) & 0x00FF);
+    }
+} // appendFixed64
+
+/*! @brief Add a variable-length unsigned value to a byte string.
+ @param[in,out] output The byte string to be added to.
+ @param[in] value The value to be added. */
+static void
+appendVarint(std::string & output,
+             uint64_t      value)
+{
+    for ( ; 0x007F < value; value >>= 7)
+    {
+        output += static_cast<char>(0x0080 | (value & 0x007F));
+    }
+    output += static_cast<char>(value);
+} // appendVarint
+
+/*! @brief Add a length-prefixed string to a byte string.
+ @param[in,out] output The byte string to be added to.
+ @param[in] value The value to be added. */
+static void
+appendString(std::string &      output,
+             const YarpString & value)
+{
+    appendVarint(output, value.length());
+    output.append(value.c_str(), value.length());
+} // appendString
+
+/*! @brief Return a checksum for a sequence of bytes, using the FNV-1a algorithm.
+ @param[in] data The bytes to be processed.
+ @param[in] length The number of bytes to be processed.
+ @returns The checksum for the bytes. */
+static uint32_t
+computeChecksum(const void * data,
+                const size_t length)
+{
+    const uint8_t * walker = static_cast<const uint8_t *>(data);
+    uint32_t        result = 0x811C9DC5;
+
+    for (size_t ii = 0; ii < length; ++ii)
+    {
+        result = (result ^ walker[ii]) * 0x01000193;
+    }
+    return result;
+} // computeChecksum
+
+/*! @brief Retrieve a 32-bit value stored least significant byte first.
+ @param[in] data The bytes holding the value.
+ @returns The value. */
+static uint32_t
+readFixed32(const uint8_t * data)
+{
+    return (static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+            (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24));
+} // readFixed32
+
+/*! @brief Retrieve a 64-bit value stored least significant byte first.
+ @param[in] data The bytes holding the value.
+ @returns The value. */
+static uint64_t
+readFixed64(const uint8_t * data)
+{
+    uint64_t result = 0;
+
+    for (int ii = 7; ii >= 0; --ii)
+    {
+        result = (result << 8) | data[ii];
+    }
+    return result;
+} // readFixed64
+
+/*! @brief Retrieve a variable-length unsigned value.
+ @param[in,out] cursor The location of the value, which is advanced past the value.
+ @param[in] end The byte following the last byte that can be read.
+ @param[out] value The value.
+ @returns @c true if the value was complete and @c false otherwise. */
+static bool
+readVarint(const uint8_t * & cursor,
+           const uint8_t *   end,
+           uint64_t &        value)
+{
+    value = 0;
+    for (int shift = 0; (cursor < end) && (64 > shift); shift += 7)
+    {
+        uint8_t aByte = *cursor++;
+
+        value |= (static_cast<uint64_t>(aByte & 0x007F) << shift);
+        if (! (aByte & 0x0080))
+        {
+            return true;
+        }
+
+    }
+    return false;
+} // readVarint
+
+/*! @brief Retrieve a length-prefixed string.
+ @param[in,out] cursor The location of the string, which is advanced past the string.
+ @param[in] end The byte following the last byte that can be read.
+ @param[out] value The string.
+ @returns @c true if the string was complete and @c false otherwise. */
+static bool
+readString(const uint8_t * & cursor,
+           const uint8_t *   end,
+           YarpString &      value)
+{
+    uint64_t length;
+    bool     okSoFar = readVarint(cursor, end, length);
+
+    if (okSoFar && (length <= static_cast<uint64_t>(end - cursor)))
+    {
+        value = YarpString(reinterpret_cast<const char *>(cursor), static_cast<size_t>(length));
+        cursor += length;
+    }
+    else
+    {
+        okSoFar = false;
+    }
+    return okSoFar;
+} // readString
+
+/*! @brief Map a signed value to an unsigned value so that small magnitudes stay small.
+ @param[in] value The value to be mapped.
+ @returns The mapped value. */
+static inline uint64_t
+zigZagEncode(const int64_t value)
+{
+    return ((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+} // zigZagEncode
+
+/*! @brief Recover a signed value that was mapped by zigZagEncode().
+ @param[in] value The mapped value.
+ @returns The original value. */
+static inline int64_t
+zigZagDecode(const uint64_t value)
+{
+    return static_cast<int64_t>((value >> 1) ^ (~ (value & 1) + 1));
+} // zigZagDecode
+
+/*! @brief Return the number of leading zero bits in a non-zero value.
+ @param[in] value The value to be examined.
+ @returns The number of leading zero bits. */
+static inline int
+countLeadingZeroes(const uint64_t value)
+{
+#if defined(__GNUC__)
+    return __builtin_clzll(value);
+#else // ! defined(__GNUC__)
+    int result = 0;
+
+    for (uint64_t mask = (static_cast<uint64_t>(1) << 63); ! (value & mask); mask >>= 1)
+    {
+        ++result;
+    }
+    return result;
+#endif // ! defined(__GNUC__)
+} // countLeadingZeroes
+
+/*! @brief Return the number of trailing zero bits in a non-zero value.
+ @param[in] value The value to be examined.
+ @returns The number of trailing zero bits. */
+static inline int
+countTrailingZeroes(const uint64_t value)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(value);
+#else // ! defined(__GNUC__)
+    int result = 0;
+
+    for (uint64_t mask = 1; ! (value & mask); mask <<= 1)
+    {
+        ++result;
+    }
+    return result;
+#endif // ! defined(__GNUC__)
+} // countTrailingZeroes
+
+/*! @brief Return the bits of a double.
+ @param[in] value The value to be converted.
+ @returns The bits of the value. */
+static inline uint64_t
+doubleToBits(const double value)
+{
+    uint64_t result;
+
+    memcpy(&result, &value, sizeof(result));
+    return result;
+} // doubleToBits
+
+/*! @brief Return the double with the given bits.
+ @param[in] value The bits to be converted.
+ @returns The double with the bits. */
+static inline double
+bitsToDouble(const uint64_t value)
+{
+    double result;
+
+    memcpy(&result, &value, sizeof(result));
+    return result;
+} // bitsToDouble
+
+/*! @brief Compress a column of values, using the XOR encoding from the Gorilla time-series
+ database.
+
+ Each value is XORed with the previous one; an unchanged value takes a single bit, and a value
+ whose changed bits fall within the window of the previous change takes two bits plus the window.
+ @param[in,out] output The byte string to be added to.
+ @param[in] values The values, a row at a time.
+ @param[in] numRows The number of rows.
+ @param[in] numColumns The number of values in each row.
+ @param[in] column The column to be compressed. */
+static void
+encodeColumn(std::string &  output,
+             const double * values,
+             const size_t   numRows,
+             const size_t   numColumns,
+             const size_t   column)
+{
+    BitWriter writer(output);
+    uint64_t  previous = 0;
+    int       prevLeading = -1;
+    int       prevTrailing = 0;
+
+    for (size_t ii = 0; ii < numRows; ++ii)
+    {
+        uint64_t current = doubleToBits(values[(ii * numColumns) + column]);
+
+        if (0 == ii)
+        {
+            writer.writeBits(current, 64);
+        }
+        else
+        {
+            uint64_t delta = current ^ previous;
+
+            if (0 == delta)
+            {
+                writer.writeBits(0, 1);
+            }
+            else
+            {
+                int leading = std::min(countLeadingZeroes(delta), 31);
+                int trailing = countTrailingZeroes(delta);
+
+                writer.writeBits(1, 1);
+                if ((0 <= prevLeading) && (leading >= prevLeading) && (trailing >= prevTrailing))
+                {
+                    writer.writeBits(0, 1);
+                    writer.writeBits(delta >> prevTrailing, 64 - prevLeading - prevTrailing);
+                }
+                else
+                {
+                    int significant = 64 - leading - trailing;
+
+                    writer.writeBits(1, 1);
+                    writer.writeBits(leading, 5);
+                    // A width of 64 is stored as zero, since a width of zero never occurs.
+                    writer.writeBits(significant & 0x003F, 6);
+                    writer.writeBits(delta >> trailing, significant);
+                    prevLeading = leading;
+                    prevTrailing = trailing;
+                }
+            }
+        }
+        previous = current;
+    }
+    writer.finish();
+} // encodeColumn
+
+/*! @brief Decompress a column of values that was compressed by encodeColumn().
+ @param[in] start The first byte of the compressed column.
+ @param[in] end The byte following the last byte of the compressed column.
+ @param[out] values The values, a row at a time.
+ @param[in] numRows The number of rows.
+ @param[in] numColumns The number of values in each row.
+ @param[in] column The column to be decompressed.
+ @returns @c true if the column was decompressed and @c false otherwise. */
+static bool
+decodeColumn(const uint8_t * start,
+             const uint8_t * end,
+             double *        values,
+             const size_t    numRows,
+             const size_t    numColumns,
+             const size_t    column)
+{
+    BitReader reader(start, end);
+    uint64_t  previous = 0;
+    int       prevLeading = 0;
+    int       prevTrailing = 0;
+
+    for (size_t ii = 0; (ii < numRows) && (! reader.overrun()); ++ii)
+    {
+        if (0 == ii)
+        {
+            previous = reader.readBits(64);
+        }
+        else if (reader.readBits(1))
+        {
+            if (reader.readBits(1))
+            {
+                int significant;
+
+                prevLeading = static_cast<int>(reader.readBits(5));
+                significant = static_cast<int>(reader.readBits(6));
+                if (0 == significant)
+                {
+                    significant = 64;
+                }
+                prevTrailing = 64 - prevLeading - significant;
+                if (0 > prevTrailing)
+                {
+                    return false;
+                }
+
+            }
+            previous ^= (reader.readBits(64 - prevLeading - prevTrailing) << prevTrailing);
+        }
+        values[(ii * numColumns) + column] = bitsToDouble(previous);
+    }
+    return (! reader.overrun());
+} // decodeColumn
+
+/*! @brief Compress a set of sample times.
+
+ The first time is stored as is, the second as the difference from the first and the rest as the
+ change in the difference, so that regularly-spaced samples take a single byte each.
+ @param[in,out] output The byte string to be added to.
+ @param[in] times The times to be compressed.
+ @param[in] numRows The number of times. */
+static void
+encodeTimes(std::string &   output,
+            const int64_t * times,
+            const size_t    numRows)
+{
+    int64_t prevDelta = 0;
+
+    for (size_t ii = 0; ii < numRows; ++ii)
+    {
+        if (0 == ii)
+        {
+            appendVarint(output, zigZagEncode(times[0]));
+        }
+        else
+        {
+            int64_t delta = times[ii] - times[ii - 1];
+
+            appendVarint(output, zigZagEncode(delta - prevDelta));
+            prevDelta = delta;
+        }
+    }
+} // encodeTimes
+
+/*! @brief Decompress a set of sample times that was compressed by encodeTimes().
+ @param[in] start The first byte of the compressed times.
+ @param[in] end The byte following the last byte of the compressed times.
+ @param[out] times The times.
+ @param[in] numRows The number of times.
+ @returns @c true if the times were decompressed and @c false otherwise. */
+static bool
+decodeTimes(const uint8_t * start,
+            const uint8_t * end,
+            int64_t *       times,
+            const size_t    numRows)
+{
+    const uint8_t * cursor = start;
+    int64_t         delta = 0;
+
+    for (size_t ii = 0; ii < numRows; ++ii)
+    {
+        uint64_t encoded;
+
+        if (! readVarint(cursor, end, encoded))
+        {
+            return false;
+        }
+
+        if (0 == ii)
+        {
+            times[0] = zigZagDecode(encoded);
+        }
+        else
+        {
+            delta += zigZagDecode(encoded);
+            times[ii] = times[ii - 1] + delta;
+        }
+    }
+    return true;
+} // decodeTimes
+
+/*! @brief Return the name used to index a series.
+ @param[in] dataTrack The data track of the series.
+ @param[in] subject The subject of the series.
+ @param[in] segment The segment of the series.
+ @returns The name used to index the series. */
+static YarpString
+makeSeriesKey(const YarpString & dataTrack,
+              const YarpString & subject,
+              const YarpString & segment)
+{
+    YarpString result(dataTrack);
+
+    // Use a separator that cannot appear in a name that was provided as text.
+    result += '\0';
+    result += subject;
+    result += '\0';
+    result += segment;
+    return result;
+} // makeSeriesKey
+
+/*! @brief Emit the current bucket of a downsampled query.
+ @param[in,out] state The progress of the query. */
+static void
+emitBucket(QueryState & state)
+{
+    MovementRow aRow;
+
+    aRow._time = state._bucketStart;
+    aRow._count = state._bucketCount;
+    aRow._values.resize(state._numColumns);
+    for (size_t ii = 0; ii < state._numColumns; ++ii)
+    {
+        aRow._values[ii] = state._sums[ii] / state._bucketCount;
+        state._sums[ii] = 0;
+    }
+    state._rows->push_back(aRow);
+    state._bucketCount = 0;
+    // Resume with the bucket after this one.
+    state._resumeTime = state._bucketStart + state._query->_bucketWidth;
+} // emitBucket
+
+/*! @brief Add the samples from a chunk to the result of a query.
+ @param[in,out] state The progress of the query.
+ @param[in] times The times of the samples.
+ @param[in] values The values of the samples, a row at a time.
+ @param[in] numRows The number of samples. */
+static void
+processSamples(QueryState &    state,
+               const int64_t * times,
+               const double *  values,
+               const size_t    numRows)
+{
+    MovementQuery & query = *state._query;
+    const int64_t * firstRow = std::lower_bound(times, times + numRows, query._startTime);
+
+    for (size_t ii = static_cast<size_t>(firstRow - times); (! state._done) && (ii < numRows);
+         ++ii)
+    {
+        int64_t        sampleTime = times[ii];
+        const double * sampleValues = values + (ii * state._numColumns);
+
+        if (sampleTime > query._endTime)
+        {
+            state._done = true;
+        }
+        else if (0 < query._bucketWidth)
+        {
+            int64_t bucketStart = query._startTime +
+                                  (((sampleTime - query._startTime) / query._bucketWidth) *
+                                   query._bucketWidth);
+
+            if ((0 < state._bucketCount) && (bucketStart != state._bucketStart))
+            {
+                // There is always room for the pending bucket, since the piece is ended as soon
+                // as it is full.
+                emitBucket(state);
+                if (state._rows->size() >= query._maxRows)
+                {
+                    state._more = state._done = true;
+                    state._resumeTime = bucketStart;
+                    break;
+                }
+
+            }
+            if (0 == state._bucketCount)
+            {
+                state._bucketStart = bucketStart;
+            }
+            for (size_t jj = 0; jj < state._numColumns; ++jj)
+            {
+                state._sums[jj] += sampleValues[jj];
+            }
+            ++state._bucketCount;
+        }
+        else if (state._rows->size() >= query._maxRows)
+        {
+            state._more = state._done = true;
+        }
+        else
+        {
+            MovementRow aRow;
+
+            aRow._time = sampleTime;
+            aRow._count = 1;
+            aRow._values.assign(sampleValues, sampleValues + state._numColumns);
+            state._rows->push_back(aRow);
+            state._resumeTime = sampleTime + 1;
+        }
+    }
+} // processSamples
+
+/*! @brief Return the size of a file.
+ @param[in] aFile The file to be examined.
+ @returns The size of the file. */
+static int64_t
+getFileSize(FILE * aFile)
+{
+#if MAC_OR_LINUX_
+    fseeko(aFile, 0, SEEK_END);
+    return static_cast<int64_t>(ftello(aFile));
+#else // ! MAC_OR_LINUX_
+    _fseeki64(aFile, 0, SEEK_END);
+    return _ftelli64(aFile);
+#endif // ! MAC_OR_LINUX_
+} // getFileSize
+
+/*! @brief Move to a location in a file.
+ @param[in] aFile The file to be positioned.
+ @param[in] offset The location in the file.
+ @returns @c true if the file was positioned and @c false otherwise. */
+static bool
+seekInFile(FILE *        aFile,
+           const int64_t offset)
+{
+#if MAC_OR_LINUX_
+    return (0 == fseeko(aFile, static_cast<off_t>(offset), SEEK_SET));
+#else // ! MAC_OR_LINUX_
+    return (0 == _fseeki64(aFile, offset, SEEK_SET));
+#endif // ! MAC_OR_LINUX_
+} // seekInFile
+
+/*! @brief Discard the end of a file.
+ @param[in] aFile The file to be shortened.
+ @param[in] newSize The new size of the file.
+ @returns @c true if the file was shortened and @c false otherwise. */
+static bool
+truncateFile(FILE *        aFile,
+             const int64_t newSize)
+{
+    fflush(aFile);
+#if MAC_OR_LINUX_
+    return (0 == ftruncate(fileno(aFile), static_cast<off_t>(newSize)));
+#else // ! MAC_OR_LINUX_
+    return (0 == _chsize_s(_fileno(aFile), newSize));
+#endif // ! MAC_OR_LINUX_
+} // truncateFile
+
+/*! @brief Open a file for reading and writing, creating it if it does not exist.
+ @param[in] filePath The path to the file.
+ @returns The open file or @c NULL if the file could not be opened. */
+static FILE *
+openForUpdate(const YarpString & filePath)
+{
+    FILE * result;
+
+#if MAC_OR_LINUX_
+    result = fopen(filePath.c_str(), "r+b");
+    if (! result)
+    {
+        result = fopen(filePath.c_str(), "w+b");
+    }
+#else // ! MAC_OR_LINUX_
+    if (fopen_s(&result, filePath.c_str(), "r+b"))
+    {
+        if (fopen_s(&result, filePath.c_str(), "w+b"))
+        {
+            result = NULL;
+        }
+    }
+#endif // ! MAC_OR_LINUX_
+    return result;
+} // openForUpdate
+
+/*! @brief Force the data already handed to the operating system for a file to disk.
+
+ Unlike syncFile(), this does not touch the stream, so it can be done without holding the lock
+ that protects the stream.
+ @param[in] descriptor The file descriptor of the file to be written.
+ @returns @c true if the file was written and @c false otherwise. */
+static bool
+syncDescriptor(const int descriptor)
+{
+#if MAC_OR_LINUX_
+    return (0 == fsync(descriptor));
+#else // ! MAC_OR_LINUX_
+    return (0 == _commit(descriptor));
+#endif // ! MAC_OR_LINUX_
+} // syncDescriptor
+
+/*! @brief Force the contents of a file to disk.
+ @param[in] aFile The file to be written.
+ @returns @c true if the file was written and @c false otherwise. */
+static bool
+syncFile(FILE * aFile)
+{
+#if MAC_OR_LINUX_
+    return ((0 == fflush(aFile)) && syncDescriptor(fileno(aFile)));
+#else // ! MAC_OR_LINUX_
+    return ((0 == fflush(aFile)) && syncDescriptor(_fileno(aFile)));
+#endif // ! MAC_OR_LINUX_
+} // syncFile
+
+/*! @brief Append a record to a file.
+ @param[in] aFile The file to be written.
+ @param[in,out] fileSize The size of the file, which is updated if the record is written.
+ @param[in] recordKind The kind of record.
+ @param[in] payload The contents of the record.
+ @param[out] payloadOffset The offset in the file of the contents of the record.
+ @returns @c true if the record was written and @c false otherwise. */
+static bool
+writeRecord(FILE *              aFile,
+            int64_t &           fileSize,
+            const uint8_t       recordKind,
+            const std::string & payload,
+            int64_t &           payloadOffset)
+{
+    ODL_ENTER(); //####
+    ODL_P3("aFile = ", aFile, "fileSize = ", &fileSize, "payloadOffset = ", //####
+           &payloadOffset); //####
+    ODL_LL2("recordKind = ", recordKind, "payload.length() = ", payload.length()); //####
+    bool        okSoFar = false;
+    std::string header;
+
+    header += static_cast<char>(recordKind);
+    appendFixed32(header, static_cast<uint32_t>(payload.length()));
+    appendFixed32(header, computeChecksum(payload.data(), payload.length()));
+    if (seekInFile(aFile, fileSize) && (1 == fwrite(header.data(), header.length(), 1, aFile)) &&
+        (1 == fwrite(payload.data(), payload.length(), 1, aFile)) && (0 == fflush(aFile)))
+    {
+        payloadOffset = fileSize + kRecordHeaderLength;
+        fileSize = payloadOffset + payload.length();
+        okSoFar = true;
+    }
+    else
+    {
+        ODL_LOG("! (seekInFile(aFile, fileSize) && (1 == fwrite(header.data(), " //####
+                "header.length(), 1, aFile)) && (1 == fwrite(payload.data(), " //####
+                "payload.length(), 1, aFile)) && (0 == fflush(aFile)))"); //####
+        // Drop anything that was partially written, so that later records are readable.
+        truncateFile(aFile, fileSize);
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // writeRecord
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+MovementStore::MovementStore(void) :
+    _journalLock(), _lock(), _filePath(), _journalPath(), _seriesList(), _seriesMap(),
+    _lastDecoded(NULL), _file(NULL), _journal(NULL), _fileSize(0), _journalSize(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // MovementStore::MovementStore
+
+MovementStore::~MovementStore(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    ODL_OBJEXIT(); //####
+} // MovementStore::~MovementStore
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+MovementStore::addSample(const YarpString & dataTrack,
+                         const YarpString & subject,
+                         const YarpString & segment,
+                         const int64_t      sampleTime,
+                         const double *     values,
+                         const size_t       numValues)
+{
+    ODL_OBJENTER(); //####
+    ODL_S3s("dataTrack = ", dataTrack, "subject = ", subject, "segment = ", segment); //####
+    ODL_LL2("sampleTime = ", sampleTime, "numValues = ", numValues); //####
+    ODL_P1("values = ", values); //####
+    bool okSoFar = false;
+
+    try
+    {
+        _lock.lock();
+        if (_file && values && (0 < numValues))
+        {
+            bool          created;
+            SeriesEntry * entry = findSeries(dataTrack, subject, segment, numValues, created);
+
+            okSoFar = (entry && appendToSeries(*entry, sampleTime, values, numValues));
+        }
+        else
+        {
+            ODL_LOG("! (_file && values && (0 < numValues))"); //####
+        }
+        _lock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        _lock.unlock();
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::addSample
+
+bool
+MovementStore::addSamples(const MovementSampleVector & samples,
+                          size_t &                     numRejected)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("samples = ", &samples, "numRejected = ", &numRejected); //####
+    bool okSoFar = false;
+    bool storeLocked = false;
+
+    try
+    {
+        bool                       anyCreated = false;
+        bool                       haveStore;
+        int                        fileDescriptor = -1;
+        size_t                     numToWrite = 0;
+        std::string                payload;
+        std::string                body;
+        std::vector<SeriesEntry *> entries(samples.size(), NULL);
+        int64_t                    payloadOffset;
+
+        numRejected = 0;
+        // The journal lock keeps the groups in the journal in the same order as they are applied,
+        // while the store itself is only locked to find the series and to apply the samples, so
+        // that queries do not wait for the journal to reach the disk.
+        _journalLock.lock();
+        _lock.lock();
+        storeLocked = true;
+        haveStore = (_file && _journal);
+        if (haveStore)
+        {
+            // The series are found first, so that the journal can refer to them by identifier.
+            for (size_t ii = 0; ii < samples.size(); ++ii)
+            {
+                const MovementSample & aSample = samples[ii];
+                size_t                 numValues = aSample._values.size();
+
+                if (0 < numValues)
+                {
+                    bool          created = false;
+                    SeriesEntry * entry = findSeries(aSample._dataTrack, aSample._subject,
+                                                     aSample._segment, numValues, created);
+
+                    anyCreated |= created;
+                    if (entry && (entry->_numColumns == numValues))
+                    {
+                        entries[ii] = entry;
+                        appendVarint(body, entry->_id);
+                        appendVarint(body, zigZagEncode(aSample._time));
+                        for (size_t jj = 0; jj < numValues; ++jj)
+                        {
+                            appendFixed64(body, doubleToBits(aSample._values[jj]));
+                        }
+                        ++numToWrite;
+                    }
+                }
+            }
+            if (anyCreated)
+            {
+                haveStore = (0 == fflush(_file));
+#if MAC_OR_LINUX_
+                fileDescriptor = fileno(_file);
+#else // ! MAC_OR_LINUX_
+                fileDescriptor = _fileno(_file);
+#endif // ! MAC_OR_LINUX_
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_file && _journal)"); //####
+        }
+        _lock.unlock();
+        storeLocked = false;
+        if (haveStore)
+        {
+            appendVarint(payload, numToWrite);
+            payload += body;
+            // A series definition must be on disk before a journal record that refers to it; the
+            // whole group is then committed with a single write.
+            okSoFar = (((! anyCreated) || syncDescriptor(fileDescriptor)) &&
+                       writeRecord(_journal, _journalSize, kRecordKindSamples, payload,
+                                   payloadOffset) && syncFile(_journal));
+        }
+        if (okSoFar)
+        {
+            _lock.lock();
+            storeLocked = true;
+            for (size_t ii = 0; ii < samples.size(); ++ii)
+            {
+                SeriesEntry * entry = entries[ii];
+
+                if ((! entry) || (! appendToSeries(*entry, samples[ii]._time,
+                                                   &samples[ii]._values[0],
+                                                   samples[ii]._values.size())))
+                {
+                    ++numRejected;
+                }
+            }
+            if (kMaxJournalBytes <= _journalSize)
+            {
+                okSoFar = checkpoint();
+            }
+            _lock.unlock();
+            storeLocked = false;
+        }
+        else
+        {
+            ODL_LOG("! (okSoFar)"); //####
+            numRejected = samples.size();
+        }
+        _journalLock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        if (storeLocked)
+        {
+            _lock.unlock();
+        }
+        _journalLock.unlock();
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::addSamples
+
+bool
+MovementStore::appendToSeries(SeriesEntry &  entry,
+                              const int64_t  sampleTime,
+                              const double * values,
+                              const size_t   numValues)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("entry = ", &entry, "values = ", values); //####
+    ODL_LL2("sampleTime = ", sampleTime, "numValues = ", numValues); //####
+    bool okSoFar = false;
+
+    if ((entry._numColumns == numValues) &&
+        ((0 == entry._numSamples) || (sampleTime > entry._lastTime)))
+    {
+        if (0 == entry._numSamples)
+        {
+            entry._firstTime = sampleTime;
+        }
+        entry._lastTime = sampleTime;
+        ++entry._numSamples;
+        entry._openTimes.push_back(sampleTime);
+        entry._openValues.insert(entry._openValues.end(), values, values + numValues);
+        if (kMaxSamplesPerChunk <= entry._openTimes.size())
+        {
+            okSoFar = sealChunk(entry);
+        }
+        else
+        {
+            okSoFar = true;
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((entry._numColumns == numValues) && ((0 == entry._numSamples) || " //####
+                "(sampleTime > entry._lastTime)))"); //####
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::appendToSeries
+
+bool
+MovementStore::checkpoint(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = true;
+
+    for (SeriesVector::iterator walker(_seriesList.begin()); _seriesList.end() != walker;
+         ++walker)
+    {
+        SeriesEntry * entry = *walker;
+
+        if ((0 < entry->_openTimes.size()) && (! sealChunk(*entry)))
+        {
+            okSoFar = false;
+        }
+    }
+    // The journal can only be emptied once everything that it holds is safely in the file.
+    if (okSoFar && _journal && (static_cast<int64_t>(kJournalMagicLength) < _journalSize))
+    {
+        okSoFar = syncFile(_file) && truncateFile(_journal, kJournalMagicLength) &&
+                  syncFile(_journal);
+        if (okSoFar)
+        {
+            _journalSize = kJournalMagicLength;
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::checkpoint
+
+void
+MovementStore::close(void)
+{
+    ODL_OBJENTER(); //####
+    try
+    {
+        if (_file)
+        {
+            bool flushed = flush();
+
+            _journalLock.lock();
+            _lock.lock();
+            fclose(_file);
+            _file = NULL;
+            if (_journal)
+            {
+                fclose(_journal);
+                _journal = NULL;
+                // An empty journal is not needed when the store is reopened.
+                if (flushed)
+                {
+                    remove(_journalPath.c_str());
+                }
+            }
+            discardIndex();
+            _lock.unlock();
+            _journalLock.unlock();
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // MovementStore::close
+
+const MovementStore::DecodedChunk *
+MovementStore::decodeChunk(SeriesEntry & entry,
+                           const size_t  chunkIndex)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("entry = ", &entry); //####
+    ODL_LL1("chunkIndex = ", chunkIndex); //####
+    DecodedChunk * result = NULL;
+
+    try
+    {
+        if (_lastDecoded && (&entry == _lastDecoded->_series) &&
+            (chunkIndex == _lastDecoded->_chunkIndex))
+        {
+            result = _lastDecoded;
+        }
+        else
+        {
+            const ChunkDescriptor & descriptor = entry._chunks[chunkIndex];
+            std::vector<uint8_t>    payload(descriptor._payloadLength);
+            bool                    okSoFar = (seekInFile(_file, descriptor._payloadOffset) &&
+                                               (1 == fread(&payload[0], payload.size(), 1,
+                                                           _file)));
+
+            if (okSoFar)
+            {
+                const uint8_t * cursor = &payload[0];
+                const uint8_t * end = cursor + payload.size();
+                size_t          numRows = descriptor._count;
+                uint64_t        fieldValue;
+
+                if (! _lastDecoded)
+                {
+                    _lastDecoded = new DecodedChunk;
+                }
+                _lastDecoded->_series = NULL;
+                _lastDecoded->_times.resize(numRows);
+                _lastDecoded->_values.resize(numRows * entry._numColumns);
+                // Skip the series identifier, the count and the time range, which are already
+                // known.
+                for (int ii = 0; okSoFar && (ii < 4); ++ii)
+                {
+                    okSoFar = readVarint(cursor, end, fieldValue);
+                }
+                if (okSoFar)
+                {
+                    okSoFar = (readVarint(cursor, end, fieldValue) &&
+                               (fieldValue <= static_cast<uint64_t>(end - cursor)) &&
+                               decodeTimes(cursor, cursor + fieldValue,
+                                           &_lastDecoded->_times[0], numRows));
+                    cursor += (okSoFar ? fieldValue : 0);
+                }
+                for (size_t ii = 0; okSoFar && (ii < entry._numColumns); ++ii)
+                {
+                    okSoFar = (readVarint(cursor, end, fieldValue) &&
+                               (fieldValue <= static_cast<uint64_t>(end - cursor)) &&
+                               decodeColumn(cursor, cursor + fieldValue,
+                                            &_lastDecoded->_values[0], numRows,
+                                            entry._numColumns, ii));
+                    cursor += (okSoFar ? fieldValue : 0);
+                }
+                if (okSoFar)
+                {
+                    _lastDecoded->_series = &entry;
+                    _lastDecoded->_chunkIndex = chunkIndex;
+                    result = _lastDecoded;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (okSoFar)"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // MovementStore::decodeChunk
+
+void
+MovementStore::discardIndex(void)
+{
+    ODL_OBJENTER(); //####
+    for (SeriesVector::iterator walker(_seriesList.begin()); _seriesList.end() != walker;
+         ++walker)
+    {
+        delete *walker;
+    }
+    _seriesList.clear();
+    _seriesMap.clear();
+    delete _lastDecoded;
+    _lastDecoded = NULL;
+    ODL_OBJEXIT(); //####
+} // MovementStore::discardIndex
+
+bool
+MovementStore::fetchRows(MovementQuery &     query,
+                         MovementRowVector & rows,
+                         bool &              more)
+{
+    ODL_OBJENTER(); //####
+    ODL_P3("query = ", &query, "rows = ", &rows, "more = ", &more); //####
+    bool okSoFar = false;
+
+    try
+    {
+        rows.clear();
+        more = false;
+        _lock.lock();
+        if (_file)
+        {
+            SeriesMap::iterator match(_seriesMap.find(makeSeriesKey(query._dataTrack,
+                                                                    query._subject,
+                                                                    query._segment)));
+
+            if (_seriesMap.end() != match)
+            {
+                SeriesEntry & entry = *match->second;
+                QueryState    state;
+
+                okSoFar = true;
+                if (0 == query._maxRows)
+                {
+                    query._maxRows = 1;
+                }
+                state._query = &query;
+                state._rows = &rows;
+                state._sums.assign(entry._numColumns, 0);
+                state._bucketStart = state._resumeTime = query._startTime;
+                state._bucketCount = 0;
+                state._numColumns = entry._numColumns;
+                state._more = false;
+                state._done = (query._startTime > query._endTime);
+                for (size_t ii = 0; okSoFar && (! state._done) && (ii < entry._chunks.size());
+                     ++ii)
+                {
+                    const ChunkDescriptor & descriptor = entry._chunks[ii];
+
+                    if (descriptor._firstTime > query._endTime)
+                    {
+                        state._done = true;
+                    }
+                    else if (descriptor._lastTime >= query._startTime)
+                    {
+                        const DecodedChunk * decoded = decodeChunk(entry, ii);
+
+                        if (decoded)
+                        {
+                            processSamples(state, &decoded->_times[0], &decoded->_values[0],
+                                           decoded->_times.size());
+                        }
+                        else
+                        {
+                            ODL_LOG("! (decoded)"); //####
+                            okSoFar = false;
+                        }
+                    }
+                }
+                if (okSoFar && (! state._done) && (0 < entry._openTimes.size()))
+                {
+                    processSamples(state, &entry._openTimes[0], &entry._openValues[0],
+                                   entry._openTimes.size());
+                }
+                if (0 < state._bucketCount)
+                {
+                    // The final bucket of the piece.
+                    emitBucket(state);
+                }
+                if (okSoFar)
+                {
+                    more = state._more;
+                    query._startTime = state._resumeTime;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (_seriesMap.end() != match)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_file)"); //####
+        }
+        _lock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        _lock.unlock();
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::fetchRows
+
+MovementStore::SeriesEntry *
+MovementStore::findSeries(const YarpString & dataTrack,
+                          const YarpString & subject,
+                          const YarpString & segment,
+                          const size_t       numValues,
+                          bool &             created)
+{
+    ODL_OBJENTER(); //####
+    ODL_S3s("dataTrack = ", dataTrack, "subject = ", subject, "segment = ", segment); //####
+    ODL_LL1("numValues = ", numValues); //####
+    ODL_P1("created = ", &created); //####
+    YarpString          key(makeSeriesKey(dataTrack, subject, segment));
+    SeriesMap::iterator match(_seriesMap.find(key));
+    SeriesEntry *       entry;
+
+    created = false;
+    if (_seriesMap.end() == match)
+    {
+        std::string payload;
+        int64_t     payloadOffset;
+
+        entry = new SeriesEntry;
+        entry->_id = _seriesList.size();
+        entry->_dataTrack = dataTrack;
+        entry->_subject = subject;
+        entry->_segment = segment;
+        entry->_numColumns = numValues;
+        entry->_numSamples = 0;
+        entry->_firstTime = entry->_lastTime = 0;
+        appendVarint(payload, entry->_id);
+        appendString(payload, dataTrack);
+        appendString(payload, subject);
+        appendString(payload, segment);
+        appendVarint(payload, numValues);
+        if (writeRecord(_file, _fileSize, kRecordKindSeries, payload, payloadOffset))
+        {
+            _seriesList.push_back(entry);
+            _seriesMap[key] = entry;
+            created = true;
+        }
+        else
+        {
+            ODL_LOG("! (writeRecord(_file, _fileSize, kRecordKindSeries, payload, " //####
+                    "payloadOffset))"); //####
+            delete entry;
+            entry = NULL;
+        }
+    }
+    else
+    {
+        entry = match->second;
+    }
+    ODL_OBJEXIT_P(entry); //####
+    return entry;
+} // MovementStore::findSeries
+
+bool
+MovementStore::flush(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = true;
+
+    try
+    {
+        _journalLock.lock();
+        _lock.lock();
+        if (_file)
+        {
+            okSoFar = checkpoint();
+        }
+        _lock.unlock();
+        _journalLock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        _lock.unlock();
+        _journalLock.unlock();
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::flush
+
+void
+MovementStore::getSeriesList(const YarpString &         dataTrack,
+                             MovementSeriesInfoVector & seriesList)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("dataTrack = ", dataTrack); //####
+    ODL_P1("seriesList = ", &seriesList); //####
+    try
+    {
+        seriesList.clear();
+        _lock.lock();
+        for (SeriesVector::const_iterator walker(_seriesList.begin());
+             _seriesList.end() != walker; ++walker)
+        {
+            const SeriesEntry & entry = **walker;
+
+            if ((0 == dataTrack.length()) || (dataTrack == entry._dataTrack))
+            {
+                MovementSeriesInfo info;
+
+                info._dataTrack = entry._dataTrack;
+                info._subject = entry._subject;
+                info._segment = entry._segment;
+                info._numColumns = entry._numColumns;
+                info._numSamples = entry._numSamples;
+                info._numChunks = entry._chunks.size();
+                info._firstTime = entry._firstTime;
+                info._lastTime = entry._lastTime;
+                seriesList.push_back(info);
+            }
+        }
+        _lock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        _lock.unlock();
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // MovementStore::getSeriesList
+
+int64_t
+MovementStore::getJournalBytes(void)
+{
+    ODL_OBJENTER(); //####
+    int64_t result;
+
+    _journalLock.lock();
+    result = _journalSize;
+    _journalLock.unlock();
+    ODL_OBJEXIT_LL(result); //####
+    return result;
+} // MovementStore::getJournalBytes
+
+int64_t
+MovementStore::getStoredBytes(void)
+{
+    ODL_OBJENTER(); //####
+    int64_t result;
+
+    _lock.lock();
+    result = _fileSize;
+    _lock.unlock();
+    ODL_OBJEXIT_LL(result); //####
+    return result;
+} // MovementStore::getStoredBytes
+
+bool
+MovementStore::open(const YarpString & filePath)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("filePath = ", filePath); //####
+    bool okSoFar = false;
+
+    try
+    {
+        close();
+        _journalLock.lock();
+        _lock.lock();
+        _file = openForUpdate(filePath);
+        if (_file)
+        {
+            char   magic[kFileMagicLength];
+            size_t numRead = fread(magic, 1, sizeof(magic), _file);
+
+            _filePath = filePath;
+            if (0 == numRead)
+            {
+                // A new file.
+                okSoFar = seekInFile(_file, 0) &&
+                          (1 == fwrite(kFileMagic, kFileMagicLength, 1, _file)) &&
+                          (0 == fflush(_file));
+                _fileSize = kFileMagicLength;
+            }
+            else if ((sizeof(magic) == numRead) && (! memcmp(magic, kFileMagic, sizeof(magic))))
+            {
+                int64_t validSize;
+
+                _fileSize = getFileSize(_file);
+                validSize = readIndex();
+
+                okSoFar = ((validSize == _fileSize) || truncateFile(_file, validSize));
+                _fileSize = validSize;
+            }
+            else
+            {
+                ODL_LOG("! ((sizeof(magic) == numRead) && " //####
+                        "(! memcmp(magic, kFileMagic, sizeof(magic))))"); //####
+            }
+            if (okSoFar)
+            {
+                _journalPath = filePath + JOURNAL_SUFFIX_;
+                _journal = openForUpdate(_journalPath);
+                okSoFar = (_journal && replayJournal());
+            }
+            if (! okSoFar)
+            {
+                if (_journal)
+                {
+                    fclose(_journal);
+                    _journal = NULL;
+                }
+                fclose(_file);
+                _file = NULL;
+                discardIndex();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_file)"); //####
+        }
+        _lock.unlock();
+        _journalLock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        _lock.unlock();
+        _journalLock.unlock();
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::open
+
+int64_t
+MovementStore::readIndex(void)
+{
+    ODL_OBJENTER(); //####
+    int64_t validSize = kFileMagicLength;
+
+    try
+    {
+        uint8_t              header[kRecordHeaderLength];
+        std::vector<uint8_t> payload;
+        int64_t              offset = kFileMagicLength;
+        int64_t              lastChunkStart = -1;
+        uint32_t             lastChunkChecksum = 0;
+        bool                 okSoFar = true;
+
+        // Only the record headers and the fixed part of each chunk record are read, so that
+        // opening a large store is quick; since records are only ever appended, just the last
+        // chunk record needs its checksum verified to catch an interrupted write.
+        for ( ; okSoFar && seekInFile(_file, offset) &&
+             (1 == fread(header, sizeof(header), 1, _file)); )
+        {
+            uint32_t        payloadLength = readFixed32(header + 1);
+            uint32_t        checksum = readFixed32(header + 5);
+            int64_t         payloadOffset = offset + kRecordHeaderLength;
+            size_t          toRead = payloadLength;
+            const uint8_t * cursor;
+            const uint8_t * end;
+            uint64_t        seriesId;
+
+            if (kRecordKindChunk == header[0])
+            {
+                toRead = std::min(toRead, kChunkHeaderMaxLength);
+            }
+            payload.resize(std::max(toRead, static_cast<size_t>(1)));
+            if ((0 < toRead) && (1 != fread(&payload[0], toRead, 1, _file)))
+            {
+                break;
+            }
+
+            cursor = &payload[0];
+            end = cursor + toRead;
+            okSoFar = readVarint(cursor, end, seriesId);
+            if (kRecordKindSeries == header[0])
+            {
+                uint64_t      numColumns;
+                SeriesEntry * entry = new SeriesEntry;
+
+                entry->_id = static_cast<size_t>(seriesId);
+                entry->_numSamples = 0;
+                entry->_firstTime = entry->_lastTime = 0;
+                okSoFar = (okSoFar && (computeChecksum(&payload[0], toRead) == checksum) &&
+                           (_seriesList.size() == seriesId) &&
+                           readString(cursor, end, entry->_dataTrack) &&
+                           readString(cursor, end, entry->_subject) &&
+                           readString(cursor, end, entry->_segment) &&
+                           readVarint(cursor, end, numColumns) && (0 < numColumns));
+                if (okSoFar)
+                {
+                    entry->_numColumns = static_cast<size_t>(numColumns);
+                    _seriesList.push_back(entry);
+                    _seriesMap[makeSeriesKey(entry->_dataTrack, entry->_subject,
+                                             entry->_segment)] = entry;
+                }
+                else
+                {
+                    delete entry;
+                }
+            }
+            else if (kRecordKindChunk == header[0])
+            {
+                uint64_t count;
+                uint64_t firstTime;
+                uint64_t lastTime;
+
+                okSoFar = (okSoFar && (seriesId < _seriesList.size()) &&
+                           readVarint(cursor, end, count) && (0 < count) &&
+                           readVarint(cursor, end, firstTime) &&
+                           readVarint(cursor, end, lastTime));
+                if (okSoFar)
+                {
+                    SeriesEntry &   entry = *_seriesList[static_cast<size_t>(seriesId)];
+                    ChunkDescriptor descriptor;
+
+                    descriptor._firstTime = zigZagDecode(firstTime);
+                    descriptor._lastTime = zigZagDecode(lastTime);
+                    descriptor._payloadOffset = payloadOffset;
+                    descriptor._payloadLength = payloadLength;
+                    descriptor._count = static_cast<size_t>(count);
+                    if (0 == entry._numSamples)
+                    {
+                        entry._firstTime = descriptor._firstTime;
+                    }
+                    entry._lastTime = descriptor._lastTime;
+                    entry._numSamples += descriptor._count;
+                    entry._chunks.push_back(descriptor);
+                    lastChunkStart = offset;
+                    lastChunkChecksum = checksum;
+                }
+            }
+            else
+            {
+                okSoFar = false;
+            }
+            if (okSoFar && ((payloadOffset + payloadLength) <= _fileSize))
+            {
+                offset = validSize = payloadOffset + payloadLength;
+            }
+            else
+            {
+                okSoFar = false;
+            }
+        }
+        if (static_cast<int64_t>(kFileMagicLength) > validSize)
+        {
+            validSize = kFileMagicLength;
+        }
+        if (0 <= lastChunkStart)
+        {
+            SeriesEntry *     lastEntry = NULL;
+            ChunkDescriptor * lastChunk = NULL;
+
+            // Find the chunk that was read last, which is the last chunk of its series.
+            for (SeriesVector::iterator walker(_seriesList.begin()); _seriesList.end() != walker;
+                 ++walker)
+            {
+                SeriesEntry * entry = *walker;
+
+                if ((0 < entry->_chunks.size()) &&
+                    ((lastChunkStart + static_cast<int64_t>(kRecordHeaderLength)) ==
+                     entry->_chunks.back()._payloadOffset))
+                {
+                    lastEntry = entry;
+                    lastChunk = &entry->_chunks.back();
+                    break;
+                }
+
+            }
+            if (lastChunk)
+            {
+                bool valid = ((lastChunk->_payloadOffset +
+                               static_cast<int64_t>(lastChunk->_payloadLength)) <= validSize);
+
+                if (valid)
+                {
+                    payload.resize(std::max(lastChunk->_payloadLength, static_cast<size_t>(1)));
+                    valid = (seekInFile(_file, lastChunk->_payloadOffset) &&
+                             (1 == fread(&payload[0], lastChunk->_payloadLength, 1, _file)) &&
+                             (computeChecksum(&payload[0], lastChunk->_payloadLength) ==
+                              lastChunkChecksum));
+                }
+                if (! valid)
+                {
+                    ODL_LOG("! (valid)"); //####
+                    lastEntry->_numSamples -= lastChunk->_count;
+                    lastEntry->_chunks.pop_back();
+                    if (0 < lastEntry->_chunks.size())
+                    {
+                        lastEntry->_lastTime = lastEntry->_chunks.back()._lastTime;
+                    }
+                    else
+                    {
+                        lastEntry->_firstTime = lastEntry->_lastTime = 0;
+                    }
+                    validSize = std::min(validSize, lastChunkStart);
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_LL(validSize); //####
+    return validSize;
+} // MovementStore::readIndex
+
+bool
+MovementStore::replayJournal(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = false;
+
+    try
+    {
+        char   magic[kJournalMagicLength];
+        size_t numRead = fread(magic, 1, sizeof(magic), _journal);
+
+        if (0 == numRead)
+        {
+            // A new journal.
+            okSoFar = seekInFile(_journal, 0) &&
+                      (1 == fwrite(kJournalMagic, kJournalMagicLength, 1, _journal)) &&
+                      syncFile(_journal);
+            _journalSize = kJournalMagicLength;
+        }
+        else if ((sizeof(magic) == numRead) && (! memcmp(magic, kJournalMagic, sizeof(magic))))
+        {
+            uint8_t              header[kRecordHeaderLength];
+            std::vector<uint8_t> payload;
+            int64_t              offset = kJournalMagicLength;
+            int64_t              journalSize = getFileSize(_journal);
+
+            // The journal is small, so every record is read in full and checked. Samples that
+            // were sealed into a chunk before the journal was last emptied are not later than the
+            // last sample of their series, so they are rejected rather than added twice.
+            for (bool keepGoing = true; keepGoing && seekInFile(_journal, offset) &&
+                 (1 == fread(header, sizeof(header), 1, _journal)); )
+            {
+                uint32_t        payloadLength = readFixed32(header + 1);
+                const uint8_t * cursor;
+                const uint8_t * end;
+                uint64_t        numSamples = 0;
+
+                keepGoing = ((kRecordKindSamples == header[0]) && (0 < payloadLength));
+                if (keepGoing)
+                {
+                    payload.resize(payloadLength);
+                    keepGoing = ((1 == fread(&payload[0], payloadLength, 1, _journal)) &&
+                                 (computeChecksum(&payload[0], payloadLength) ==
+                                  readFixed32(header + 5)));
+                }
+                if (keepGoing)
+                {
+                    cursor = &payload[0];
+                    end = cursor + payloadLength;
+                    keepGoing = readVarint(cursor, end, numSamples);
+                }
+                for (uint64_t ii = 0; keepGoing && (ii < numSamples); ++ii)
+                {
+                    uint64_t seriesId;
+                    uint64_t encodedTime;
+
+                    keepGoing = (readVarint(cursor, end, seriesId) &&
+                                 (seriesId < _seriesList.size()) &&
+                                 readVarint(cursor, end, encodedTime));
+                    if (keepGoing)
+                    {
+                        SeriesEntry &       entry = *_seriesList[static_cast<size_t>(seriesId)];
+                        std::vector<double> values(entry._numColumns);
+
+                        keepGoing = ((8 * entry._numColumns) <= static_cast<size_t>(end - cursor));
+                        for (size_t jj = 0; keepGoing && (jj < entry._numColumns); ++jj)
+                        {
+                            values[jj] = bitsToDouble(readFixed64(cursor));
+                            cursor += 8;
+                        }
+                        if (keepGoing)
+                        {
+                            appendToSeries(entry, zigZagDecode(encodedTime), &values[0],
+                                           entry._numColumns);
+                        }
+                    }
+                }
+                if (keepGoing)
+                {
+                    offset += kRecordHeaderLength + payloadLength;
+                }
+            }
+            okSoFar = ((offset == journalSize) || truncateFile(_journal, offset));
+            _journalSize = offset;
+        }
+        else
+        {
+            ODL_LOG("! ((sizeof(magic) == numRead) && " //####
+                    "(! memcmp(magic, kJournalMagic, sizeof(magic))))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::replayJournal
+
+bool
+MovementStore::sealChunk(SeriesEntry & entry)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("entry = ", &entry); //####
+    bool okSoFar = false;
+
+    try
+    {
+        size_t numRows = entry._openTimes.size();
+
+        if (0 < numRows)
+        {
+            std::string     payload;
+            std::string     column;
+            ChunkDescriptor descriptor;
+
+            descriptor._firstTime = entry._openTimes.front();
+            descriptor._lastTime = entry._openTimes.back();
+            descriptor._count = numRows;
+            appendVarint(payload, entry._id);
+            appendVarint(payload, numRows);
+            appendVarint(payload, zigZagEncode(descriptor._firstTime));
+            appendVarint(payload, zigZagEncode(descriptor._lastTime));
+            encodeTimes(column, &entry._openTimes[0], numRows);
+            appendVarint(payload, column.length());
+            payload += column;
+            for (size_t ii = 0; ii < entry._numColumns; ++ii)
+            {
+                column.clear();
+                encodeColumn(column, &entry._openValues[0], numRows, entry._numColumns, ii);
+                appendVarint(payload, column.length());
+                payload += column;
+            }
+            descriptor._payloadLength = payload.length();
+            if (writeRecord(_file, _fileSize, kRecordKindChunk, payload,
+                            descriptor._payloadOffset))
+            {
+                entry._chunks.push_back(descriptor);
+                entry._openTimes.clear();
+                entry._openValues.clear();
+                okSoFar = true;
+            }
+            else
+            {
+                ODL_LOG("! (writeRecord(_file, _fileSize, kRecordKindChunk, payload, " //####
+                        "descriptor._payloadOffset))"); //####
+            }
+        }
+        else
+        {
+            okSoFar = true;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MovementStore::sealChunk
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,435 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mMovementStore.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the storage used by the movement database service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMMovementStore_HPP_))
+# define MpMMovementStore_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# include <map>
+# include <vector>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the storage used by the movement database service. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace MovementDb
+    {
+        /*! @brief The description of a stored series. */
+        struct MovementSeriesInfo
+        {
+            /*! @brief The data track that the series belongs to. */
+            YarpString _dataTrack;
+
+            /*! @brief The subject that the series belongs to. */
+            YarpString _subject;
+
+            /*! @brief The segment that the series describes. */
+            YarpString _segment;
+
+            /*! @brief The number of values in each sample. */
+            size_t _numColumns;
+
+            /*! @brief The number of samples in the series. */
+            size_t _numSamples;
+
+            /*! @brief The number of sealed chunks holding the series. */
+            size_t _numChunks;
+
+            /*! @brief The time of the first sample, in microseconds. */
+            int64_t _firstTime;
+
+            /*! @brief The time of the last sample, in microseconds. */
+            int64_t _lastTime;
+
+        }; // MovementSeriesInfo
+
+        /*! @brief A set of series descriptions. */
+        typedef std::vector<MovementSeriesInfo> MovementSeriesInfoVector;
+
+        /*! @brief A row returned from a query. */
+        struct MovementRow
+        {
+            /*! @brief The time of the row, in microseconds; for a downsampled query this is the
+             start of the bucket. */
+            int64_t _time;
+
+            /*! @brief The number of samples that contributed to the row. */
+            size_t _count;
+
+            /*! @brief The values of the row; for a downsampled query these are the means of the
+             contributing samples. */
+            std::vector<double> _values;
+
+        }; // MovementRow
+
+        /*! @brief A set of query rows. */
+        typedef std::vector<MovementRow> MovementRowVector;
+
+        /*! @brief The parameters of a query, which also record how far the query has progressed.
+
+         A query is answered a piece at a time; after each piece, @c _startTime is advanced past
+         the rows that have been returned so that the query can be resumed. */
+        struct MovementQuery
+        {
+            /*! @brief The data track to be searched. */
+            YarpString _dataTrack;
+
+            /*! @brief The subject to be searched. */
+            YarpString _subject;
+
+            /*! @brief The segment to be searched. */
+            YarpString _segment;
+
+            /*! @brief The earliest time of interest, in microseconds. */
+            int64_t _startTime;
+
+            /*! @brief The latest time of interest, in microseconds. */
+            int64_t _endTime;
+
+            /*! @brief The width of each bucket for a downsampled query, in microseconds, or zero
+             for a query that returns the stored samples. */
+            int64_t _bucketWidth;
+
+            /*! @brief The maximum number of rows to return in each piece. */
+            size_t _maxRows;
+
+        }; // MovementQuery
+
+        /*! @brief A sample to be added to the store. */
+        struct MovementSample
+        {
+            /*! @brief The data track for the sample. */
+            YarpString _dataTrack;
+
+            /*! @brief The subject for the sample. */
+            YarpString _subject;
+
+            /*! @brief The segment for the sample. */
+            YarpString _segment;
+
+            /*! @brief The time of the sample, in microseconds. */
+            int64_t _time;
+
+            /*! @brief The values of the sample. */
+            std::vector<double> _values;
+
+        }; // MovementSample
+
+        /*! @brief A set of samples. */
+        typedef std::vector<MovementSample> MovementSampleVector;
+
+        /*! @brief The storage for movement samples.
+
+         Samples are organized as series, identified by a data track, a subject and a segment. Each
+         series is held in chunks of up to @c kMaxSamplesPerChunk samples; a chunk stores its
+         timestamps as delta-of-delta varints and each of its value columns as XOR-compressed
+         doubles. Sealed chunks are appended to a single log file, together with the definitions of
+         the series that they belong to, and the in-memory index is rebuilt from the chunk headers
+         when the file is opened. Samples that have not yet filled a chunk are kept in memory, so
+         that they are visible to queries, until the chunk is sealed or the store is flushed.
+
+         Samples that arrive continuously are added in groups with addSamples, which first
+         appends each group to a journal file beside the store and forces it to disk. The journal
+         is replayed when the store is opened, so that samples that had not yet been sealed into
+         a chunk survive a crash, and it is emptied whenever all the open chunks are sealed. */
+        class MovementStore
+        {
+        public :
+
+            /*! @brief The maximum number of samples in a chunk. */
+            static const size_t kMaxSamplesPerChunk = 1024;
+
+        protected :
+
+        private :
+
+            struct ChunkDescriptor;
+            struct DecodedChunk;
+            struct SeriesEntry;
+
+            /*! @brief A mapping from series names to series. */
+            typedef std::map<YarpString, SeriesEntry *> SeriesMap;
+
+            /*! @brief A set of series, in order of definition. */
+            typedef std::vector<SeriesEntry *> SeriesVector;
+
+        public :
+
+            /*! @brief The constructor. */
+            MovementStore(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~MovementStore(void);
+
+            /*! @brief Add a sample to a series, creating the series if necessary.
+
+             Samples must be added to a series in increasing time order and must have the same
+             number of values as the series.
+             @param[in] dataTrack The data track for the sample.
+             @param[in] subject The subject for the sample.
+             @param[in] segment The segment for the sample.
+             @param[in] sampleTime The time of the sample, in microseconds.
+             @param[in] values The values of the sample.
+             @param[in] numValues The number of values in the sample.
+             @returns @c true if the sample was added and @c false otherwise. */
+            bool
+            addSample(const YarpString & dataTrack,
+                      const YarpString & subject,
+                      const YarpString & segment,
+                      const int64_t      sampleTime,
+                      const double *     values,
+                      const size_t       numValues);
+
+            /*! @brief Add a group of samples to the store, creating series as necessary.
+
+             The group is written to the journal, with a single write that is forced to disk,
+             before the samples become visible to queries. As with addSample, the samples of a
+             series must be in increasing time order and have the same number of values as the
+             series.
+             @param[in] samples The samples to be added.
+             @param[out] numRejected The number of samples that were not added.
+             @returns @c true if the group was written to the journal and @c false otherwise. */
+            bool
+            addSamples(const MovementSampleVector & samples,
+                       size_t &                     numRejected);
+
+            /*! @brief Close the store, after sealing any partially-filled chunks. */
+            void
+            close(void);
+
+            /*! @brief Return the next piece of the result of a query.
+
+             On return, the query is updated so that another call will return the following piece.
+             @param[in,out] query The query to be answered.
+             @param[out] rows The rows of the piece.
+             @param[out] more @c true if there are rows following this piece and @c false
+             otherwise.
+             @returns @c true if the series was found and @c false otherwise. */
+            bool
+            fetchRows(MovementQuery &     query,
+                      MovementRowVector & rows,
+                      bool &              more);
+
+            /*! @brief Seal any partially-filled chunks and write them to the file, then empty the
+             journal.
+             @returns @c true if all the chunks were written and @c false otherwise. */
+            bool
+            flush(void);
+
+            /*! @brief Return the path of the file holding the store.
+             @returns The path of the file holding the store. */
+            inline const YarpString &
+            getFilePath(void)
+            const
+            {
+                return _filePath;
+            } // getFilePath
+
+            /*! @brief Return descriptions of the stored series.
+             @param[in] dataTrack The data track of interest, or an empty string for all data
+             tracks.
+             @param[out] seriesList The descriptions of the matching series. */
+            void
+            getSeriesList(const YarpString &         dataTrack,
+                          MovementSeriesInfoVector & seriesList);
+
+            /*! @brief Return the number of bytes in the journal, including the journal header.
+             @returns The number of bytes in the journal. */
+            int64_t
+            getJournalBytes(void);
+
+            /*! @brief Return the number of bytes written to the file, including the file header.
+             @returns The number of bytes written to the file. */
+            int64_t
+            getStoredBytes(void);
+
+            /*! @brief Return @c true if the store has an open file.
+             @returns @c true if the store has an open file and @c false otherwise. */
+            inline bool
+            isOpen(void)
+            const
+            {
+                return (NULL != _file);
+            } // isOpen
+
+            /*! @brief Open the file holding the store, creating it if it does not exist, and
+             rebuild the index from it.
+
+             If the file ends with an incomplete record, such as one left by a crash, the file is
+             truncated to the last complete record. Any samples in the journal are then added
+             again.
+             @param[in] filePath The path to the file.
+             @returns @c true if the file was opened and @c false otherwise. */
+            bool
+            open(const YarpString & filePath);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            MovementStore(const MovementStore & other);
+
+            /*! @brief Add a sample to a series.
+             @param[in] entry The series to be added to.
+             @param[in] sampleTime The time of the sample, in microseconds.
+             @param[in] values The values of the sample.
+             @param[in] numValues The number of values in the sample.
+             @returns @c true if the sample was added and @c false otherwise. */
+            bool
+            appendToSeries(SeriesEntry &  entry,
+                           const int64_t  sampleTime,
+                           const double * values,
+                           const size_t   numValues);
+
+            /*! @brief Seal all the partially-filled chunks, force the file to disk and empty the
+             journal.
+             @returns @c true if the chunks were written and the journal emptied and @c false
+             otherwise. */
+            bool
+            checkpoint(void);
+
+            /*! @brief Decode a sealed chunk, reusing the most recently decoded chunk if possible.
+             @param[in] entry The series that the chunk belongs to.
+             @param[in] chunkIndex The index of the chunk within the series.
+             @returns The decoded chunk or @c NULL if the chunk could not be read. */
+            const DecodedChunk *
+            decodeChunk(SeriesEntry & entry,
+                        const size_t  chunkIndex);
+
+            /*! @brief Forget all the series. */
+            void
+            discardIndex(void);
+
+            /*! @brief Return the series for a sample, creating the series if necessary.
+             @param[in] dataTrack The data track for the sample.
+             @param[in] subject The subject for the sample.
+             @param[in] segment The segment for the sample.
+             @param[in] numValues The number of values in the sample.
+             @param[out] created Set to @c true if the series was created.
+             @returns The series or @c NULL if the series could not be created. */
+            SeriesEntry *
+            findSeries(const YarpString & dataTrack,
+                       const YarpString & subject,
+                       const YarpString & segment,
+                       const size_t       numValues,
+                       bool &             created);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            MovementStore &
+            operator =(const MovementStore & other);
+
+            /*! @brief Read the index information from the records in the file.
+             @returns The offset in the file following the last complete record. */
+            int64_t
+            readIndex(void);
+
+            /*! @brief Add the samples held in the journal to the series.
+             If the journal ends with an incomplete record, the journal is truncated to the last
+             complete record.
+             @returns @c true if the journal was read and @c false otherwise. */
+            bool
+            replayJournal(void);
+
+            /*! @brief Seal the open chunk of a series and write it to the file.
+             @param[in] entry The series whose open chunk is to be sealed.
+             @returns @c true if the chunk was written and @c false otherwise. */
+            bool
+            sealChunk(SeriesEntry & entry);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock used to keep writes to the journal in order; when both
+             locks are needed, it is taken before the lock that protects the store. */
+            yarp::os::Mutex _journalLock;
+
+            /*! @brief The contention lock used to protect the store. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The path to the file holding the store. */
+            YarpString _filePath;
+
+            /*! @brief The path to the journal. */
+            YarpString _journalPath;
+
+            /*! @brief The series, in order of definition. */
+            SeriesVector _seriesList;
+
+            /*! @brief The series, by name. */
+            SeriesMap _seriesMap;
+
+            /*! @brief The most recently decoded chunk. */
+            DecodedChunk * _lastDecoded;
+
+            /*! @brief The file holding the store. */
+            FILE * _file;
+
+            /*! @brief The journal of samples that have not been sealed. */
+            FILE * _journal;
+
+            /*! @brief The size of the file. */
+            int64_t _fileSize;
+
+            /*! @brief The size of the journal. */
+            int64_t _journalSize;
+
+        }; // MovementStore
+
+    } // MovementDb
+
+} // MplusM
+
+#endif // ! defined(MpMMovementStore_HPP_)
@@ -0,0 +1,259 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mQueryRangeRequestHandler.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the request handler for a 'queryrange' request.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mQueryRangeRequestHandler.hpp"
+#include "m+mMovementDbRequests.hpp"
+#include "m+mMovementDbService.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the request handler for a 'queryrange' request. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::MovementDb;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The protocol version number for the 'queryrange' request. */
+#define QUERYRANGE_REQUEST_VERSION_NUMBER_ "1.0"
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+QueryRangeRequestHandler::QueryRangeRequestHandler(MovementDbService & service) :
+    inherited(MpM_QUERYRANGE_REQUEST_, service)
+{
+    ODL_ENTER(); //####
+    ODL_P1("service = ", &service); //####
+    ODL_EXIT_P(this); //####
+} // QueryRangeRequestHandler::QueryRangeRequestHandler
+
+QueryRangeRequestHandler::~QueryRangeRequestHandler(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // QueryRangeRequestHandler::~QueryRangeRequestHandler
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+QueryRangeRequestHandler::fillInDescription(const YarpString &   request,
+                                             yarp::os::Property & info)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("request = ", request); //####
+    ODL_P1("info = ", &info); //####
+    try
+    {
+        info.put(MpM_REQREP_DICT_REQUEST_KEY_, request);
+        info.put(MpM_REQREP_DICT_INPUT_KEY_, MpM_REQREP_STRING_ MpM_REQREP_STRING_
+                 MpM_REQREP_STRING_ MpM_REQREP_NUMBER_ MpM_REQREP_NUMBER_ MpM_REQREP_INT_
+                 MpM_REQREP_0_OR_1_);
+        info.put(MpM_REQREP_DICT_OUTPUT_KEY_, MpM_REQREP_STRING_ MpM_REQREP_LIST_START_
+                 MpM_REQREP_LIST_START_ MpM_REQREP_DOUBLE_ MpM_REQREP_DOUBLE_
+                 MpM_REQREP_1_OR_MORE_ MpM_REQREP_LIST_END_ MpM_REQREP_0_OR_MORE_
+                 MpM_REQREP_LIST_END_ MpM_REQREP_INT_);
+        info.put(MpM_REQREP_DICT_VERSION_KEY_, QUERYRANGE_REQUEST_VERSION_NUMBER_);
+        info.put(MpM_REQREP_DICT_DETAILS_KEY_, T_("Start a query for the samples of a series\n"
+                                                  "Input: the data track, subject and segment of "
+                                                  "the series, the start and end times in "
+                                                  "milliseconds and an optional maximum number of "
+                                                  "rows per reply\n"
+                                                  "Output: OK, a list of rows, each the time of a "
+                                                  "sample followed by its values, and 1 if the "
+                                                  "'querynext' request will return more rows, or "
+                                                  "FAILED and a description of the problem"));
+        yarp::os::Value    keywords;
+        yarp::os::Bottle * asList = keywords.asList();
+
+        asList->addString(request);
+        info.put(MpM_REQREP_DICT_KEYWORDS_KEY_, keywords);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // QueryRangeRequestHandler::fillInDescription
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+QueryRangeRequestHandler::processRequest(const YarpString &           request,
+                                          const yarp::os::Bottle &     restOfInput,
+                                          const YarpString &           senderChannel,
+                                          yarp::os::ConnectionWriter * replyMechanism)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(request)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
+            "senderChannel = ", senderChannel); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    bool result = true;
+
+    try
+    {
+        // Parse the series and time range.
+        _response.clear();
+        if ((5 <= restOfInput.size()) && (6 >= restOfInput.size()))
+        {
+            yarp::os::Value dataTrackValue(restOfInput.get(0));
+            yarp::os::Value subjectValue(restOfInput.get(1));
+            yarp::os::Value segmentValue(restOfInput.get(2));
+            yarp::os::Value startValue(restOfInput.get(3));
+            yarp::os::Value endValue(restOfInput.get(4));
+            bool            okSoFar = (dataTrackValue.isString() && subjectValue.isString() &&
+                                       segmentValue.isString() &&
+                                       (startValue.isInt() || startValue.isDouble()) &&
+                                       (endValue.isInt() || endValue.isDouble()));
+            MovementQuery   query;
+
+            query._bucketWidth = 0;
+            query._maxRows = MpM_MOVEMENTDB_DEFAULT_ROWS_PER_REPLY_;
+            if (okSoFar && (6 == restOfInput.size()))
+            {
+                yarp::os::Value maxRowsValue(restOfInput.get(5));
+
+                if (maxRowsValue.isInt() && (0 < maxRowsValue.asInt()))
+                {
+                    query._maxRows = static_cast<size_t>(std::min(maxRowsValue.asInt(),
+                                                        MpM_MOVEMENTDB_MAXIMUM_ROWS_PER_REPLY_));
+                }
+                else
+                {
+                    okSoFar = false;
+                }
+            }
+            if (okSoFar)
+            {
+                MovementDbService & theService = static_cast<MovementDbService &>(_service);
+                yarp::os::Bottle    rows;
+                bool                more;
+
+                query._dataTrack = dataTrackValue.toString();
+                query._subject = subjectValue.toString();
+                query._segment = segmentValue.toString();
+                // Convert from milliseconds to microseconds.
+                query._startTime = static_cast<int64_t>(floor((startValue.asDouble() * 1000) +
+                                                              0.5));
+                query._endTime = static_cast<int64_t>(floor((endValue.asDouble() * 1000) + 0.5));
+                if (theService.startQuery(senderChannel, query, rows, more))
+                {
+                    _response.addString(MpM_OK_RESPONSE_);
+                    _response.addList() = rows;
+                    _response.addInt(more ? 1 : 0);
+                }
+                else
+                {
+                    ODL_LOG("! (theService.startQuery(senderChannel, query, rows, more))"); //####
+                    _response.addString(MpM_FAILED_RESPONSE_);
+                    _response.addString("Unknown series");
+                }
+            }
+            else
+            {
+                ODL_LOG("! (okSoFar)"); //####
+                _response.addString(MpM_FAILED_RESPONSE_);
+                _response.addString("Invalid arguments");
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((5 <= restOfInput.size()) && (6 >= restOfInput.size()))"); //####
+            _response.addString(MpM_FAILED_RESPONSE_);
+            _response.addString("Missing or extra arguments to request");
+        }
+        sendResponse(replyMechanism);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // QueryRangeRequestHandler::processRequest
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,275 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetBlobFrameSink.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a receiver of NatNet frames that produces blob text.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mNatNetBlobFrameSink.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a receiver of %NatNet frames that produces blob text. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::NatNet;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+NatNetBlobFrameSink::NatNetBlobFrameSink(void) :
+    inherited(), _translationScale(1), _numSkeletons(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // NatNetBlobFrameSink::NatNetBlobFrameSink
+
+NatNetBlobFrameSink::~NatNetBlobFrameSink(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::~NatNetBlobFrameSink
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+NatNetBlobFrameSink::abandonFrame(void)
+{
+    ODL_OBJENTER(); //####
+#if defined(MpM_UseCustomStringBuffer)
+    _outBuffer.reset();
+#else // ! defined(MpM_UseCustomStringBuffer)
+    _outBuffer.str("");
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    _numSkeletons = 0;
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::abandonFrame
+
+void
+NatNetBlobFrameSink::addBone(const NatNetBodyData & bone)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("bone = ", &bone); //####
+#if defined(MpM_UseCustomStringBuffer)
+    _outBuffer.addLong(bone._id).addTab();
+    _outBuffer.addDouble(bone._x * _translationScale).addTab();
+    _outBuffer.addDouble(bone._y * _translationScale).addTab();
+    _outBuffer.addDouble(bone._z * _translationScale).addTab();
+    _outBuffer.addDouble(bone._qx).addTab();
+    _outBuffer.addDouble(bone._qy).addTab();
+    _outBuffer.addDouble(bone._qz).addTab();
+    _outBuffer.addDouble(bone._qw).addString(LINE_END_);
+#else // ! defined(MpM_UseCustomStringBuffer)
+    _outBuffer << bone._id << "\t" << (bone._x * _translationScale) << "\t" <<
+                (bone._y * _translationScale) << "\t" << (bone._z * _translationScale) << "\t" <<
+                bone._qx << "\t" << bone._qy << "\t" << bone._qz << "\t" << bone._qw << LINE_END_;
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::addBone
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+void
+NatNetBlobFrameSink::addRigidBody(const NatNetBodyData & body)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(body)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_P1("body = ", &body); //####
+    // Rigid bodies that are not part of a skeleton are not sent.
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::addRigidBody
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+bool
+NatNetBlobFrameSink::endFrame(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = (0 < _numSkeletons);
+
+#if defined(MpM_UseCustomStringBuffer)
+    _outBuffer.addString("END" LINE_END_);
+#else // ! defined(MpM_UseCustomStringBuffer)
+    _outBuffer << "END" LINE_END_;
+    _outString = _outBuffer.str();
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // NatNetBlobFrameSink::endFrame
+
+void
+NatNetBlobFrameSink::endSkeleton(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::endSkeleton
+
+const char *
+NatNetBlobFrameSink::getMessage(size_t & length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("length = ", &length); //####
+    const char * result;
+
+#if defined(MpM_UseCustomStringBuffer)
+    result = _outBuffer.getString(length);
+#else // ! defined(MpM_UseCustomStringBuffer)
+    result = _outString.c_str();
+    length = _outString.length();
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // NatNetBlobFrameSink::getMessage
+
+void
+NatNetBlobFrameSink::setScale(const double newScale)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1("newScale = ", newScale); //####
+    _translationScale = newScale;
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::setScale
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+void
+NatNetBlobFrameSink::startFrame(const int frameNumber)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(frameNumber)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_LL1("frameNumber = ", frameNumber); //####
+#if defined(MpM_UseCustomStringBuffer)
+    _outBuffer.reset();
+#else // ! defined(MpM_UseCustomStringBuffer)
+    _outBuffer.str("");
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    _numSkeletons = 0;
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::startFrame
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+void
+NatNetBlobFrameSink::startSkeleton(const int skeletonIndex,
+                                   const int skeletonID,
+                                   const int numBones)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(skeletonID)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_LL3("skeletonIndex = ", skeletonIndex, "skeletonID = ", skeletonID, //####
+            "numBones = ", numBones); //####
+#if defined(MpM_UseCustomStringBuffer)
+    _outBuffer.addLong(skeletonIndex).addTab().addLong(numBones).addString(LINE_END_);
+#else // ! defined(MpM_UseCustomStringBuffer)
+    _outBuffer << skeletonIndex << "\t" << numBones << LINE_END_;
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::startSkeleton
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+void
+NatNetBlobFrameSink::startSkeletons(const int numSkeletons)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("numSkeletons = ", numSkeletons); //####
+    _numSkeletons = numSkeletons;
+#if defined(MpM_UseCustomStringBuffer)
+    _outBuffer.addLong(numSkeletons).addString(LINE_END_);
+#else // ! defined(MpM_UseCustomStringBuffer)
+    _outBuffer << numSkeletons << LINE_END_;
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    ODL_OBJEXIT(); //####
+} // NatNetBlobFrameSink::startSkeletons
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
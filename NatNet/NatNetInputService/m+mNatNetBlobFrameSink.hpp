@@ -0,0 +1,194 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetBlobFrameSink.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a receiver of NatNet frames that produces blob text.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMNatNetBlobFrameSink_HPP_))
+# define MpMNatNetBlobFrameSink_HPP_ /* Header guard */
+
+# include "m+mNatNetFrameSink.hpp"
+
+# include <m+m/m+mStringBuffer.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a receiver of %NatNet frames that produces blob text. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace NatNet
+    {
+        /*! @brief A receiver of %NatNet frames that writes the skeletons of each frame as the text
+         that is sent by the %NatNet blob input service.
+
+         The text holds the number of skeletons, followed by the index and bone count of each
+         skeleton and a line per bone, and is terminated by 'END'. Frames without skeletons produce
+         no output. */
+        class NatNetBlobFrameSink : public NatNetFrameSink
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef NatNetFrameSink inherited;
+
+        public :
+
+            /*! @brief The constructor. */
+            NatNetBlobFrameSink(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~NatNetBlobFrameSink(void);
+
+            /*! @brief Discard a partially-delivered frame. */
+            virtual void
+            abandonFrame(void);
+
+            /*! @brief Add a bone to the current skeleton.
+             @param[in] bone The position and orientation of the bone. */
+            virtual void
+            addBone(const NatNetBodyData & bone);
+
+            /*! @brief Add a rigid body to the frame.
+             @param[in] body The position and orientation of the rigid body. */
+            virtual void
+            addRigidBody(const NatNetBodyData & body);
+
+            /*! @brief Complete the frame.
+             @returns @c true if the frame has produced output to be sent and @c false
+             otherwise. */
+            virtual bool
+            endFrame(void);
+
+            /*! @brief Complete the current skeleton. */
+            virtual void
+            endSkeleton(void);
+
+            /*! @brief Return the text for the most recently completed frame.
+             @param[out] length The number of bytes in the text.
+             @returns The text for the most recently completed frame. */
+            const char *
+            getMessage(size_t & length);
+
+            /*! @brief Set the translation scale.
+             @param[in] newScale The scale factor for translation values. */
+            void
+            setScale(const double newScale);
+
+            /*! @brief Begin a new frame.
+             @param[in] frameNumber The number of the frame. */
+            virtual void
+            startFrame(const int frameNumber);
+
+            /*! @brief Begin a new skeleton.
+             @param[in] skeletonIndex The position of the skeleton in the frame.
+             @param[in] skeletonID The identifier for the skeleton.
+             @param[in] numBones The number of bones in the skeleton. */
+            virtual void
+            startSkeleton(const int skeletonIndex,
+                          const int skeletonID,
+                          const int numBones);
+
+            /*! @brief Begin the skeletons of the frame.
+             @param[in] numSkeletons The number of skeletons in the frame. */
+            virtual void
+            startSkeletons(const int numSkeletons);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            NatNetBlobFrameSink(const NatNetBlobFrameSink & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            NatNetBlobFrameSink &
+            operator =(const NatNetBlobFrameSink & other);
+
+        public :
+
+        protected :
+
+        private :
+
+# if defined(MpM_UseCustomStringBuffer)
+            /*! @brief The buffer to hold the output data. */
+            Common::StringBuffer _outBuffer;
+# else // ! defined(MpM_UseCustomStringBuffer)
+            /*! @brief The buffer to hold the output data. */
+            std::stringstream _outBuffer;
+
+            /*! @brief The text for the most recently completed frame. */
+            std::string _outString;
+# endif // ! defined(MpM_UseCustomStringBuffer)
+
+            /*! @brief The translation scale to be used. */
+            double _translationScale;
+
+            /*! @brief The number of skeletons in the current frame. */
+            int _numSkeletons;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // NatNetBlobFrameSink
+
+    } // NatNet
+
+} // MplusM
+
+#endif // ! defined(MpMNatNetBlobFrameSink_HPP_)
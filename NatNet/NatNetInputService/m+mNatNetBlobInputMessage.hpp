@@ -0,0 +1,135 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetBlobInputMessage.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a message that sends a blob without copying it.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMNatNetBlobInputMessage_HPP_))
+# define MpMNatNetBlobInputMessage_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a message that sends a blob without copying it. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace NatNet
+    {
+        /*! @brief A message holding a single blob, which is written directly from the memory that
+         holds it.
+
+         The message has the same form on the wire as a bottle containing just the blob. */
+        class NatNetBlobInputMessage : public yarp::os::PortWriter
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef yarp::os::PortWriter inherited;
+
+        public :
+
+            /*! @brief The constructor. */
+            NatNetBlobInputMessage(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~NatNetBlobInputMessage(void);
+
+            /*! @brief Return the number of bytes that will be sent for the message.
+             @returns The number of bytes that will be sent for the message. */
+            size_t
+            getMessageSize(void)
+            const;
+
+            /*! @brief Set the blob to be sent. The bytes of the blob must remain valid until the
+             message has been written.
+             @param[in] data The bytes of the blob.
+             @param[in] length The number of bytes in the blob. */
+            void
+            setBlob(const char * data,
+                    const size_t length);
+
+            /*! @brief Write the message to a connection.
+             @param[in] connection The connection to be written to.
+             @returns @c true if the message was written and @c false otherwise. */
+            virtual bool
+            write(yarp::os::ConnectionWriter & connection);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            NatNetBlobInputMessage(const NatNetBlobInputMessage & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            NatNetBlobInputMessage &
+            operator =(const NatNetBlobInputMessage & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The bytes of the blob. */
+            const char * _data;
+
+            /*! @brief The number of bytes in the blob. */
+            size_t _length;
+
+        }; // NatNetBlobInputMessage
+
+    } // NatNet
+
+} // MplusM
+
+#endif // ! defined(MpMNatNetBlobInputMessage_HPP_)
@@ -69,6 +69,11 @@ using namespace MplusM::NatNet;
 /*! @brief The connection mode for the client object. */
 #define NATNET_CONNECTION_MODE_ 0 /* 0=multicast, 1=unicast */
 
+#if (! defined(MpM_UseNatNetSDK))
+/*! @brief The number of seconds to wait for packets before checking if the thread is stopping. */
+static const double kPacketWaitTime = 0.1;
+#endif // ! defined(MpM_UseNatNetSDK)
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -77,7 +82,7 @@ using namespace MplusM::NatNet;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_UseNatNetSDK)
 /*! @brief Process a received frame of data.
 @param[in] aFrame The data to be processed.
 @param[in] userData The initially supplied data for this callback. */
@@ -91,105 +96,57 @@ dataReceived(sFrameOfMocapData * aFrame,
 
     if (aFrame && theThread)
     {
-        double scale = theThread->translationScale();
-        int    numSkeletons = aFrame->nSkeletons;
-
-        if (0 < numSkeletons)
-        {
-# if defined(MpM_UseCustomStringBuffer)
-            Common::StringBuffer & outBuffer = theThread->getOutputBuffer();
-# else // ! defined(MpM_UseCustomStringBuffer)
-            std::stringstream      outBuffer;
-# endif // ! defined(MpM_UseCustomStringBuffer)
-
-            // Write out the number of skeletons == bodies.
-# if defined(MpM_UseCustomStringBuffer)
-            outBuffer.reset().addLong(static_cast<int>(numSkeletons)).addString(LINE_END_);
-# else // ! defined(MpM_UseCustomStringBuffer)
-            outBuffer << numSkeletons << LINE_END_;
-# endif // ! defined(MpM_UseCustomStringBuffer)
-            for (int ii = 0; numSkeletons > ii; ++ii)
-            {
-                sSkeletonData &  aSkel = aFrame->Skeletons[ii];
-                int              numBones = aSkel.nRigidBodies;
-
-# if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addLong(ii).addTab().addLong(numBones).addString(LINE_END_);
-# else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << ii << "\t" << numBones << LINE_END_;
-# endif // ! defined(MpM_UseCustomStringBuffer)
-                for (int jj = 0; numBones > jj; ++jj)
-                {
-                    sRigidBodyData & aBone = aSkel.RigidBodyData[jj];
-
-# if defined(MpM_UseCustomStringBuffer)
-                    outBuffer.addLong(aBone.ID).addTab();
-                    outBuffer.addDouble(aBone.x * scale).addTab();
-                    outBuffer.addDouble(aBone.y * scale).addTab();
-                    outBuffer.addDouble(aBone.z * scale).addTab();
-                    outBuffer.addDouble(aBone.qx).addTab();
-                    outBuffer.addDouble(aBone.qy).addTab();
-                    outBuffer.addDouble(aBone.qz).addTab();
-                    outBuffer.addDouble(aBone.qw).addString(LINE_END_);
-# else // ! defined(MpM_UseCustomStringBuffer)
-                    outBuffer << aBone.ID << "\t" << (aBone.x * scale) << "\t" <<
-                    (aBone.y * scale) << "\t" << (aBone.z * scale) << "\t" <<
-                    aBone.qx << "\t" << aBone.qy << "\t" << aBone.qz << "\t" <<
-                    aBone.qw << LINE_END_;
-# endif // ! defined(MpM_UseCustomStringBuffer)
-                }
-            }
-# if defined(MpM_UseCustomStringBuffer)
-            outBuffer.addString("END" LINE_END_);
-# else // ! defined(MpM_UseCustomStringBuffer)
-            outBuffer << "END" LINE_END_;
-# endif // ! defined(MpM_UseCustomStringBuffer)
-            const char * outString;
-            size_t       outLength;
-# if (! defined(MpM_UseCustomStringBuffer))
-            std::string  buffAsString(outBuffer.str());
-# endif // ! defined(MpM_UseCustomStringBuffer)
-
-# if defined(MpM_UseCustomStringBuffer)
-            outString = outBuffer.getString(outLength);
-# else // ! defined(MpM_UseCustomStringBuffer)
-            outString = bufAsString.c_str();
-            outLength = bufAsString.length();
-# endif // ! defined(MpM_UseCustomStringBuffer)
-            if (outString && outLength)
-            {
-                theThread->sendMessage(outString, outLength);
-            }
-        }
+        theThread->processFrame(*aFrame);
     }
     ODL_EXIT(); //####
 } // dataReceived
-#endif // ! defined(MpM_BuildDummyServices)
 
-#if (! MAC_OR_LINUX_)
-# pragma warning(push)
-# pragma warning(disable: 4100)
-#endif // ! MAC_OR_LINUX_
+# if (! MAC_OR_LINUX_)
+#  pragma warning(push)
+#  pragma warning(disable: 4100)
+# endif // ! MAC_OR_LINUX_
 static void __cdecl
 messageReceived(int    messageType,
                 char * message)
 {
-#if ((! defined(ODL_ENABLE_LOGGING_)) || (! defined(REPORT_NATNET_MESSAGES_)))
-# if MAC_OR_LINUX_
-#  pragma unused(messageType,message)
-# endif // MAC_OR_LINUX_
-#endif // (! defined(ODL_ENABLE_LOGGING_)) || (! defined(REPORT_NATNET_MESSAGES_))
+# if ((! defined(ODL_ENABLE_LOGGING_)) || (! defined(REPORT_NATNET_MESSAGES_)))
+#  if MAC_OR_LINUX_
+#   pragma unused(messageType,message)
+#  endif // MAC_OR_LINUX_
+# endif // (! defined(ODL_ENABLE_LOGGING_)) || (! defined(REPORT_NATNET_MESSAGES_))
     ODL_ENTER(); //####
     ODL_LL1("messageType = ", messageType); //####
     ODL_S1("message = ", message); //####
-#if defined(REPORT_NATNET_MESSAGES_)
+# if defined(REPORT_NATNET_MESSAGES_)
     std::cerr << messageType << ": " << message << std::endl;
-#endif // defined(REPORT_NATNET_MESSAGES_)
+# endif // defined(REPORT_NATNET_MESSAGES_)
     ODL_EXIT(); //####
 } // messageReceived
-#if (! MAC_OR_LINUX_)
-# pragma warning(pop)
-#endif // ! MAC_OR_LINUX_
+# if (! MAC_OR_LINUX_)
+#  pragma warning(pop)
+# endif // ! MAC_OR_LINUX_
+#else // ! defined(MpM_UseNatNetSDK)
+/*! @brief Process a received packet.
+ @param[in] data The bytes of the packet.
+ @param[in] length The number of bytes in the packet.
+ @param[in] handlerStuff The thread that is receiving the packets. */
+static void
+packetReceived(const char * data,
+               const size_t length,
+               void *       handlerStuff)
+{
+    ODL_ENTER(); //####
+    ODL_P2("data = ", data, "handlerStuff = ", handlerStuff); //####
+    ODL_LL1("length = ", length); //####
+    NatNetBlobInputThread * theThread = reinterpret_cast<NatNetBlobInputThread *>(handlerStuff);
+
+    if (theThread)
+    {
+        theThread->processPacket(data, length);
+    }
+    ODL_EXIT(); //####
+} // packetReceived
+#endif // ! defined(MpM_UseNatNetSDK)
 
 #if defined(__APPLE__)
 # pragma mark Class methods
@@ -203,36 +160,35 @@ NatNetBlobInputThread::NatNetBlobInputThread(Common::GeneralChannel * outChannel
                                              const YarpString &       name,
                                              const int                commandPort,
                                              const int                dataPort) :
-    inherited(), _outChannel(outChannel), _address(name), _translationScale(1),
+    inherited(), _outChannel(outChannel), _address(name),
+#if defined(MpM_UseNatNetSDK)
+    _client(NULL),
+#endif // defined(MpM_UseNatNetSDK)
     _commandPort(commandPort), _dataPort(dataPort)
-#if (! defined(MpM_BuildDummyServices))
-    , _client(NULL)
-#endif // ! defined(MpM_BuildDummyServices)
 {
     ODL_ENTER(); //####
     ODL_P1("outChannel = ", outChannel); //####
     ODL_S1s("name = ", name); //####
     ODL_LL2("commandPort = ", commandPort, "dataPort = ", dataPort); //####
-#if defined(MpM_BuildDummyServices)
-    strncpy(_clientIPAddress, "", sizeof(_clientIPAddress) - 1);
-    strncpy(_serverIPAddress, "", sizeof(_serverIPAddress) - 1);
-#else // ! defined(MpM_BuildDummyServices)
+#if defined(MpM_UseNatNetSDK)
     strcpy_s(_clientIPAddress, sizeof(_clientIPAddress) - 1, "");
     strcpy_s(_serverIPAddress, sizeof(_serverIPAddress) - 1, "");
-#endif // ! defined(MpM_BuildDummyServices)
+#endif // defined(MpM_UseNatNetSDK)
     ODL_EXIT_P(this); //####
 } // NatNetBlobInputThread::NatNetBlobInputThread
 
 NatNetBlobInputThread::~NatNetBlobInputThread(void)
 {
     ODL_OBJENTER(); //####
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_UseNatNetSDK)
     if (_client)
     {
         _client->Uninitialize();
         delete _client;
     }
-#endif // ! defined(MpM_BuildDummyServices)
+#else // ! defined(MpM_UseNatNetSDK)
+    _receiver.close();
+#endif // ! defined(MpM_UseNatNetSDK)
     ODL_OBJEXIT(); //####
 } // NatNetBlobInputThread::~NatNetBlobInputThread
 
@@ -248,6 +204,34 @@ NatNetBlobInputThread::clearOutputChannel(void)
     ODL_OBJEXIT(); //####
 } // NatNetBlobInputThread::clearOutputChannel
 
+#if defined(MpM_UseNatNetSDK)
+void
+NatNetBlobInputThread::processFrame(const sFrameOfMocapData & aFrame)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aFrame = ", &aFrame); //####
+    if (_frameSink.deliverSDKFrame(aFrame))
+    {
+        sendFrame();
+    }
+    ODL_OBJEXIT(); //####
+} // NatNetBlobInputThread::processFrame
+#else // ! defined(MpM_UseNatNetSDK)
+void
+NatNetBlobInputThread::processPacket(const char * data,
+                                     const size_t length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("data = ", data); //####
+    ODL_LL1("length = ", length); //####
+    if (kNatNetDecodeFrameReady == _decoder.decodePacket(data, length, _frameSink))
+    {
+        sendFrame();
+    }
+    ODL_OBJEXIT(); //####
+} // NatNetBlobInputThread::processPacket
+#endif // ! defined(MpM_UseNatNetSDK)
+
 void
 NatNetBlobInputThread::run(void)
 {
@@ -256,14 +240,24 @@ NatNetBlobInputThread::run(void)
     {
         for ( ; ! isStopping(); )
         {
+#if defined(MpM_UseNatNetSDK)
             ConsumeSomeTime();
+#else // ! defined(MpM_UseNatNetSDK)
+            // All the packets that have arrived are decoded and sent before waiting again.
+            if (0 > _receiver.receivePackets(packetReceived, this, kPacketWaitTime))
+            {
+                ODL_LOG("(0 > _receiver.receivePackets(packetReceived, this, " //####
+                        "kPacketWaitTime))"); //####
+                ConsumeSomeTime();
+            }
+#endif // ! defined(MpM_UseNatNetSDK)
         }
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_UseNatNetSDK)
         if (_client)
         {
             _client->SetDataCallback(NULL, NULL);
         }
-#endif // ! defined(MpM_BuildDummyServices)
+#endif // defined(MpM_UseNatNetSDK)
     }
     catch (...)
     {
@@ -274,36 +268,63 @@ NatNetBlobInputThread::run(void)
 } // NatNetBlobInputThread::run
 
 void
-NatNetBlobInputThread::sendMessage(const char * message,
-                                   const size_t length)
+NatNetBlobInputThread::sendFrame(void)
 {
     ODL_OBJENTER(); //####
-    ODL_S1("message = ", message); //####
+    GeneralChannel * outChannel = _outChannel;
 
-    if (_outChannel)
+    if (outChannel)
     {
-        void *          rawString = static_cast<void *>(const_cast<char *>(message));
-        yarp::os::Value blobValue(rawString, static_cast<int>(length));
+        size_t       length;
+        const char * data = _frameSink.getMessage(length);
 
-        _messageBottle.clear();
-        _messageBottle.add(blobValue);
-        if (! _outChannel->write(_messageBottle))
+        if (data && length)
         {
-            ODL_LOG("(! _outChannel->write(_messageBottle))"); //####
+            if (outChannel->writesDirectly())
+            {
+                // The blob is written from the output buffer, without copying it.
+                _message.setBlob(data, length);
+                if (outChannel->write(_message))
+                {
+                    if (outChannel->metricsAreEnabled())
+                    {
+                        outChannel->updateSendCounters(_message.getMessageSize());
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (outChannel->write(_message))"); //####
 #if defined(MpM_StallOnSendProblem)
-            Stall();
+                    Stall();
 #endif // defined(MpM_StallOnSendProblem)
+                }
+            }
+            else
+            {
+                // The channel has to see the message as a bottle, so the blob is copied.
+                yarp::os::Bottle asBottle;
+                void *           rawData = static_cast<void *>(const_cast<char *>(data));
+
+                asBottle.add(yarp::os::Value(rawData, static_cast<int>(length)));
+                if (! outChannel->writeBottle(asBottle))
+                {
+                    ODL_LOG("(! outChannel->writeBottle(asBottle))"); //####
+#if defined(MpM_StallOnSendProblem)
+                    Stall();
+#endif // defined(MpM_StallOnSendProblem)
+                }
+            }
         }
     }
     ODL_OBJEXIT(); //####
-} // NatNetBlobInputThread::sendMessage
+} // NatNetBlobInputThread::sendFrame
 
 void
 NatNetBlobInputThread::setScale(const double newScale)
 {
     ODL_OBJENTER(); //####
     ODL_D1("newScale = ", newScale); //####
-    _translationScale = newScale;
+    _frameSink.setScale(newScale);
     ODL_OBJEXIT(); //####
 } // NatNetBlobInputThread::setScale
 
@@ -315,7 +336,7 @@ NatNetBlobInputThread::threadInit(void)
 
     try
     {
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_UseNatNetSDK)
         _client = new NatNetClient(NATNET_CONNECTION_MODE_);
         ODL_P1("_client <- ", _client); //####
         if (_client)
@@ -381,7 +402,25 @@ NatNetBlobInputThread::threadInit(void)
         {
             result = false;
         }
-#endif // ! defined(MpM_BuildDummyServices)
+#else // ! defined(MpM_UseNatNetSDK)
+        if (_receiver.open(_address, _commandPort, _dataPort))
+        {
+            // The description of the server includes the protocol version for the frames; until
+            // it arrives, the most recent version is assumed.
+            if (! _receiver.requestServerDescription())
+            {
+                ODL_LOG("(! _receiver.requestServerDescription())"); //####
+                std::cerr << "Could not ask Natural Point NatNet device for its description." <<
+                        std::endl;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_receiver.open(_address, _commandPort, _dataPort))"); //####
+            std::cerr << "Could not listen for Natural Point NatNet device." << std::endl;
+            result = false;
+        }
+#endif // ! defined(MpM_UseNatNetSDK)
     }
     catch (...)
     {
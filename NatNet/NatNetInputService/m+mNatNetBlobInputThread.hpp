@@ -39,14 +39,19 @@
 #if (! defined(MpMNatNetBlobInputThread_HPP_))
 # define MpMNatNetBlobInputThread_HPP_ /* Header guard */
 
-# include <m+m/m+mBaseThread.hpp>
-# include <m+m/m+mGeneralChannel.hpp>
-# include <m+m/m+mStringBuffer.hpp>
+# include "m+mNatNetBlobFrameSink.hpp"
+# include "m+mNatNetBlobInputMessage.hpp"
 
-# if (! defined(MpM_BuildDummyServices))
+# if defined(MpM_UseNatNetSDK)
 #  include <NatNetTypes.h>
 #  include <NatNetClient.h>
-# endif // ! defined(MpM_BuildDummyServices)
+# else // ! defined(MpM_UseNatNetSDK)
+#  include "m+mNatNetFrameDecoder.hpp"
+#  include "m+mNatNetPacketReceiver.hpp"
+# endif // ! defined(MpM_UseNatNetSDK)
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mGeneralChannel.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -98,38 +103,27 @@ namespace MplusM
             void
             clearOutputChannel(void);
 
-# if defined(MpM_UseCustomStringBuffer)
-            /*! @brief Provide access to the output buffer.
+# if defined(MpM_UseNatNetSDK)
+            /*! @brief Process a frame received by the Natural Point %NatNet SDK.
              This is meant to be used by the data received callback.
-             @returns The output buffer. */
-            inline Common::StringBuffer &
-            getOutputBuffer(void)
-            {
-                return _outBuffer;
-            } // getOutputBuffer
-# endif // defined(MpM_UseCustomStringBuffer)
-
-            /*! @brief Send a message via the output channel.
-             @param[in] message The message to send.
-             @param[in] length The length of the message. */
+             @param[in] aFrame The frame to be processed. */
+            void
+            processFrame(const sFrameOfMocapData & aFrame);
+# else // ! defined(MpM_UseNatNetSDK)
+            /*! @brief Process a packet received from the Natural Point %NatNet device.
+             This is meant to be used by the packet handler.
+             @param[in] data The bytes of the packet.
+             @param[in] length The number of bytes in the packet. */
             void
-            sendMessage(const char * message,
-                        const size_t length);
+            processPacket(const char * data,
+                          const size_t length);
+# endif // ! defined(MpM_UseNatNetSDK)
 
             /*! @brief Set the translation scale.
              @param[in] newScale The scale factor for translation values. */
             void
             setScale(const double newScale);
 
-            /*! @brief Return the translation scale.
-             @returns The translation scale. */
-            inline double
-            translationScale(void)
-            const
-            {
-                return _translationScale;
-            } // translationScale
-
         protected :
 
         private :
@@ -148,6 +142,10 @@ namespace MplusM
             virtual void
             run(void);
 
+            /*! @brief Send the most recently completed frame via the output channel. */
+            void
+            sendFrame(void);
+
             /*! @brief The thread initialization method.
              @returns @c true if the thread is ready to run. */
             virtual bool
@@ -165,33 +163,35 @@ namespace MplusM
             /*! @brief The address of the Natural Point %NatNet device. */
             YarpString _address;
 
-            /*! @brief The translation scale to be used. */
-            double _translationScale;
+            /*! @brief The receiver for the contents of each frame, which produces the output
+             data. */
+            NatNetBlobFrameSink _frameSink;
 
-            /*! @brief The command port of the Natural Point %NatNet device. */
-            int _commandPort;
+            /*! @brief The message used to send the output data without copying it. */
+            NatNetBlobInputMessage _message;
 
-            /*! @brief The command port of the Natural Point %NatNet device. */
-            int _dataPort;
-
-# if (! defined(MpM_BuildDummyServices))
+# if defined(MpM_UseNatNetSDK)
             /*! @brief The connection to the Natural Point %NatNet device. */
             NatNetClient * _client;
-# endif // ! defined(MpM_BuildDummyServices)
-
-# if defined(MpM_UseCustomStringBuffer)
-            /*! @brief The buffer to hold the output data. */
-            Common::StringBuffer _outBuffer;
-# endif // defined(MpM_UseCustomStringBuffer)
-
-            /*! @brief The %Bottle to use send the output data. */
-            yarp::os::Bottle _messageBottle;
 
             /*! @brief The local copy of the client IP address. */
             char _clientIPAddress[IPADDRESS_BUFFER_SIZE];
 
             /*! @brief The local copy of the server IP address. */
             char _serverIPAddress[IPADDRESS_BUFFER_SIZE];
+# else // ! defined(MpM_UseNatNetSDK)
+            /*! @brief The decoder for the packets from the Natural Point %NatNet device. */
+            NatNetFrameDecoder _decoder;
+
+            /*! @brief The receiver for the packets from the Natural Point %NatNet device. */
+            NatNetPacketReceiver _receiver;
+# endif // ! defined(MpM_UseNatNetSDK)
+
+            /*! @brief The command port of the Natural Point %NatNet device. */
+            int _commandPort;
+
+            /*! @brief The command port of the Natural Point %NatNet device. */
+            int _dataPort;
 
         }; // NatNetBlobInputThread
 
@@ -0,0 +1,252 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetBottleFrameSink.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a receiver of NatNet frames that produces bottles.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mNatNetBottleFrameSink.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a receiver of %NatNet frames that produces bottles. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::NatNet;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Add the position and orientation of a rigid body or bone to a dictionary.
+ @param[in,out] props The dictionary to be added to.
+ @param[in] body The position and orientation of the rigid body or bone. */
+static void
+putBodyData(yarp::os::Property &   props,
+            const NatNetBodyData & body)
+{
+    ODL_ENTER(); //####
+    ODL_P2("props = ", &props, "body = ", &body); //####
+    props.put("id", body._id);
+    props.put("x", body._x);
+    props.put("y", body._y);
+    props.put("z", body._z);
+    props.put("qx", body._qx);
+    props.put("qy", body._qy);
+    props.put("qz", body._qz);
+    props.put("qw", body._qw);
+    ODL_EXIT(); //####
+} // putBodyData
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+NatNetBottleFrameSink::NatNetBottleFrameSink(void) :
+    inherited(), _bones(NULL), _rigidBodies(NULL), _skeleton(NULL), _skeletons(NULL),
+    _numObjects(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // NatNetBottleFrameSink::NatNetBottleFrameSink
+
+NatNetBottleFrameSink::~NatNetBottleFrameSink(void)
+{
+    ODL_OBJENTER(); //####
+    abandonFrame();
+    ODL_OBJEXIT(); //####
+} // NatNetBottleFrameSink::~NatNetBottleFrameSink
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+NatNetBottleFrameSink::abandonFrame(void)
+{
+    ODL_OBJENTER(); //####
+    delete _bones;
+    _bones = NULL;
+    _message.clear();
+    _rigidBodies = _skeletons = NULL;
+    _skeleton = NULL;
+    _numObjects = 0;
+    ODL_OBJEXIT(); //####
+} // NatNetBottleFrameSink::abandonFrame
+
+void
+NatNetBottleFrameSink::addBone(const NatNetBodyData & bone)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("bone = ", &bone); //####
+    yarp::os::Bottle * bonesList = (_bones ? _bones->asList() : NULL);
+
+    if (bonesList)
+    {
+        putBodyData(bonesList->addDict(), bone);
+    }
+    ODL_OBJEXIT(); //####
+} // NatNetBottleFrameSink::addBone
+
+void
+NatNetBottleFrameSink::addRigidBody(const NatNetBodyData & body)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("body = ", &body); //####
+    ++_numObjects;
+    if (_rigidBodies && body._valid)
+    {
+        putBodyData(_rigidBodies->addDict(), body);
+    }
+    ODL_OBJEXIT(); //####
+} // NatNetBottleFrameSink::addRigidBody
+
+bool
+NatNetBottleFrameSink::endFrame(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = (0 < _numObjects);
+
+    _rigidBodies = _skeletons = NULL;
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // NatNetBottleFrameSink::endFrame
+
+void
+NatNetBottleFrameSink::endSkeleton(void)
+{
+    ODL_OBJENTER(); //####
+    if (_skeleton && _bones)
+    {
+        // The dictionary takes ownership of the list of bones.
+        _skeleton->put("bones", _bones);
+        _bones = NULL;
+    }
+    _skeleton = NULL;
+    ODL_OBJEXIT(); //####
+} // NatNetBottleFrameSink::endSkeleton
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+void
+NatNetBottleFrameSink::startFrame(const int frameNumber)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(frameNumber)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_LL1("frameNumber = ", frameNumber); //####
+    abandonFrame();
+    // Put the 'rigid' data in first.
+    _rigidBodies = &_message.addList();
+    ODL_OBJEXIT(); //####
+} // NatNetBottleFrameSink::startFrame
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+void
+NatNetBottleFrameSink::startSkeleton(const int skeletonIndex,
+                                     const int skeletonID,
+                                     const int numBones)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(skeletonIndex,numBones)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_LL3("skeletonIndex = ", skeletonIndex, "skeletonID = ", skeletonID, //####
+            "numBones = ", numBones); //####
+    if (_skeletons)
+    {
+        _skeleton = &_skeletons->addDict();
+        _skeleton->put("id", skeletonID);
+        delete _bones;
+        _bones = yarp::os::Value::makeList();
+    }
+    ODL_OBJEXIT(); //####
+} // NatNetBottleFrameSink::startSkeleton
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+void
+NatNetBottleFrameSink::startSkeletons(const int numSkeletons)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("numSkeletons = ", numSkeletons); //####
+    _numObjects += numSkeletons;
+    // Now add the 'skeleton' data.
+    _skeletons = &_message.addList();
+    ODL_OBJEXIT(); //####
+} // NatNetBottleFrameSink::startSkeletons
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
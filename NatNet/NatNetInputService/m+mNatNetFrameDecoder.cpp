@@ -0,0 +1,513 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetFrameDecoder.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a decoder of Natural Point NatNet packets.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mNatNetFrameDecoder.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a decoder of Natural Point %NatNet packets. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::NatNet;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The major version of the %NatNet protocol that is assumed until the server describes
+ itself. */
+static const int kDefaultVersionMajor = 3;
+
+/*! @brief The minor version of the %NatNet protocol that is assumed until the server describes
+ itself. */
+static const int kDefaultVersionMinor = 0;
+
+/*! @brief The number of bytes in the server name in a server description. */
+static const size_t kServerNameLength = 256;
+
+/*! @brief The number of bytes in a marker position. */
+static const size_t kMarkerSize = 3 * 4;
+
+/*! @brief The position within a packet as it is being decoded. */
+struct PacketCursor
+{
+    /*! @brief The next byte to be read. */
+    const unsigned char * _next;
+
+    /*! @brief The byte following the last byte that can be read. */
+    const unsigned char * _end;
+
+}; // PacketCursor
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the number of bytes remaining in a packet.
+ @param[in] cursor The position within the packet.
+ @returns The number of bytes remaining in the packet. */
+static inline size_t
+bytesRemaining(const PacketCursor & cursor)
+{
+    return static_cast<size_t>(cursor._end - cursor._next);
+} // bytesRemaining
+
+/*! @brief Read a little-endian 16-bit integer from a packet.
+ @param[in,out] cursor The position within the packet.
+ @param[out] value The value that was read.
+ @returns @c true if the value was read and @c false if the packet is too short. */
+static inline bool
+readInt16(PacketCursor & cursor,
+          int &          value)
+{
+    bool okSoFar = (2 <= bytesRemaining(cursor));
+
+    if (okSoFar)
+    {
+        value = static_cast<int16_t>(cursor._next[0] | (cursor._next[1] << 8));
+        cursor._next += 2;
+    }
+    return okSoFar;
+} // readInt16
+
+/*! @brief Read a little-endian 32-bit unsigned integer from a packet.
+ @param[in,out] cursor The position within the packet.
+ @param[out] value The value that was read.
+ @returns @c true if the value was read and @c false if the packet is too short. */
+static inline bool
+readUInt32(PacketCursor & cursor,
+           uint32_t &     value)
+{
+    bool okSoFar = (4 <= bytesRemaining(cursor));
+
+    if (okSoFar)
+    {
+        value = (static_cast<uint32_t>(cursor._next[0]) |
+                 (static_cast<uint32_t>(cursor._next[1]) << 8) |
+                 (static_cast<uint32_t>(cursor._next[2]) << 16) |
+                 (static_cast<uint32_t>(cursor._next[3]) << 24));
+        cursor._next += 4;
+    }
+    return okSoFar;
+} // readUInt32
+
+/*! @brief Read a little-endian 32-bit floating-point number from a packet.
+ @param[in,out] cursor The position within the packet.
+ @param[out] value The value that was read.
+ @returns @c true if the value was read and @c false if the packet is too short. */
+static inline bool
+readFloat(PacketCursor & cursor,
+          double &       value)
+{
+    uint32_t asBits;
+    bool     okSoFar = readUInt32(cursor, asBits);
+
+    if (okSoFar)
+    {
+        float asFloat;
+
+        memcpy(&asFloat, &asBits, sizeof(asFloat));
+        value = asFloat;
+    }
+    return okSoFar;
+} // readFloat
+
+/*! @brief Read a little-endian 32-bit integer from a packet.
+ @param[in,out] cursor The position within the packet.
+ @param[out] value The value that was read.
+ @returns @c true if the value was read and @c false if the packet is too short. */
+static inline bool
+readInt32(PacketCursor & cursor,
+          int &          value)
+{
+    uint32_t asBits;
+    bool     okSoFar = readUInt32(cursor, asBits);
+
+    if (okSoFar)
+    {
+        value = static_cast<int32_t>(asBits);
+    }
+    return okSoFar;
+} // readInt32
+
+/*! @brief Read the number of elements of a sequence from a packet and skip past the elements.
+ @param[in,out] cursor The position within the packet.
+ @param[in] elementSize The number of bytes in each element.
+ @param[out] count The number of elements.
+ @returns @c true if the elements were skipped and @c false if the packet is too short or the
+ number of elements is not valid. */
+static bool
+skipCountedElements(PacketCursor & cursor,
+                    const size_t   elementSize,
+                    int &          count)
+{
+    ODL_ENTER(); //####
+    ODL_P2("cursor = ", &cursor, "count = ", &count); //####
+    ODL_LL1("elementSize = ", elementSize); //####
+    bool okSoFar = readInt32(cursor, count);
+
+    if (okSoFar)
+    {
+        if ((0 <= count) && ((bytesRemaining(cursor) / elementSize) >= static_cast<size_t>(count)))
+        {
+            cursor._next += (count * elementSize);
+        }
+        else
+        {
+            okSoFar = false;
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // skipCountedElements
+
+/*! @brief Skip past a null-terminated string in a packet.
+ @param[in,out] cursor The position within the packet.
+ @returns @c true if the string was skipped and @c false if the string is not terminated. */
+static bool
+skipString(PacketCursor & cursor)
+{
+    ODL_ENTER(); //####
+    ODL_P1("cursor = ", &cursor); //####
+    const void * terminator = memchr(cursor._next, 0, bytesRemaining(cursor));
+    bool         okSoFar = (NULL != terminator);
+
+    if (okSoFar)
+    {
+        cursor._next = static_cast<const unsigned char *>(terminator) + 1;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // skipString
+
+/*! @brief Read a rigid body or bone from a packet.
+ @param[in,out] cursor The position within the packet.
+ @param[in] versionMajor The major version number of the %NatNet protocol.
+ @param[in] versionMinor The minor version number of the %NatNet protocol.
+ @param[out] body The rigid body or bone that was read.
+ @returns @c true if the rigid body or bone was read and @c false if the packet is too short or is
+ not valid. */
+static bool
+readBody(PacketCursor &   cursor,
+         const int        versionMajor,
+         const int        versionMinor,
+         NatNetBodyData & body)
+{
+    ODL_ENTER(); //####
+    ODL_P2("cursor = ", &cursor, "body = ", &body); //####
+    ODL_LL2("versionMajor = ", versionMajor, "versionMinor = ", versionMinor); //####
+    bool okSoFar = (readInt32(cursor, body._id) && readFloat(cursor, body._x) &&
+                    readFloat(cursor, body._y) && readFloat(cursor, body._z) &&
+                    readFloat(cursor, body._qx) && readFloat(cursor, body._qy) &&
+                    readFloat(cursor, body._qz) && readFloat(cursor, body._qw));
+
+    body._valid = true;
+    if (okSoFar && (3 > versionMajor))
+    {
+        int numMarkers;
+
+        // Earlier versions of the protocol list the markers of each rigid body.
+        okSoFar = skipCountedElements(cursor, kMarkerSize, numMarkers);
+        if (okSoFar && (2 <= versionMajor))
+        {
+            // Marker identifiers and sizes.
+            if ((bytesRemaining(cursor) / 8) >= static_cast<size_t>(numMarkers))
+            {
+                cursor._next += (numMarkers * 8);
+            }
+            else
+            {
+                okSoFar = false;
+            }
+        }
+    }
+    if (okSoFar && (2 <= versionMajor))
+    {
+        double meanError;
+
+        okSoFar = readFloat(cursor, meanError);
+    }
+    if (okSoFar && ((2 < versionMajor) || ((2 == versionMajor) && (6 <= versionMinor))))
+    {
+        int params;
+
+        okSoFar = readInt16(cursor, params);
+        if (okSoFar)
+        {
+            body._valid = (0 != (params & 0x01));
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // readBody
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+NatNetFrameDecoder::NatNetFrameDecoder(void) :
+    _framesDecoded(0), _packetsRejected(0), _versionMajor(kDefaultVersionMajor),
+    _versionMinor(kDefaultVersionMinor)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // NatNetFrameDecoder::NatNetFrameDecoder
+
+NatNetFrameDecoder::~NatNetFrameDecoder(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // NatNetFrameDecoder::~NatNetFrameDecoder
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+NatNetFrameDecoder::decodeFrame(const char *      data,
+                                const size_t      length,
+                                NatNetFrameSink & sink,
+                                bool &            hasOutput)
+{
+    ODL_OBJENTER(); //####
+    ODL_P3("data = ", data, "sink = ", &sink, "hasOutput = ", &hasOutput); //####
+    ODL_LL1("length = ", length); //####
+    bool         okSoFar;
+    int          frameNumber;
+    PacketCursor cursor;
+
+    hasOutput = false;
+    cursor._next = reinterpret_cast<const unsigned char *>(data);
+    cursor._end = cursor._next + length;
+    okSoFar = readInt32(cursor, frameNumber);
+    if (okSoFar)
+    {
+        int numMarkerSets;
+
+        sink.startFrame(frameNumber);
+        okSoFar = readInt32(cursor, numMarkerSets) && (0 <= numMarkerSets);
+        for (int ii = 0; okSoFar && (numMarkerSets > ii); ++ii)
+        {
+            int numMarkers;
+
+            okSoFar = (skipString(cursor) &&
+                       skipCountedElements(cursor, kMarkerSize, numMarkers));
+        }
+        if (okSoFar)
+        {
+            int numOtherMarkers;
+
+            okSoFar = skipCountedElements(cursor, kMarkerSize, numOtherMarkers);
+        }
+        if (okSoFar)
+        {
+            int numRigidBodies;
+
+            okSoFar = readInt32(cursor, numRigidBodies) && (0 <= numRigidBodies);
+            for (int ii = 0; okSoFar && (numRigidBodies > ii); ++ii)
+            {
+                NatNetBodyData aBody;
+
+                okSoFar = readBody(cursor, _versionMajor, _versionMinor, aBody);
+                if (okSoFar)
+                {
+                    sink.addRigidBody(aBody);
+                }
+            }
+        }
+        if (okSoFar)
+        {
+            int numSkeletons = 0;
+
+            // Skeletons were added after version 2.0 of the protocol.
+            if ((2 < _versionMajor) || ((2 == _versionMajor) && (0 < _versionMinor)))
+            {
+                okSoFar = readInt32(cursor, numSkeletons) && (0 <= numSkeletons);
+            }
+            if (okSoFar)
+            {
+                sink.startSkeletons(numSkeletons);
+            }
+            for (int ii = 0; okSoFar && (numSkeletons > ii); ++ii)
+            {
+                int numBones;
+                int skeletonID;
+
+                okSoFar = (readInt32(cursor, skeletonID) && readInt32(cursor, numBones) &&
+                           (0 <= numBones));
+                if (okSoFar)
+                {
+                    sink.startSkeleton(ii, skeletonID, numBones);
+                    for (int jj = 0; okSoFar && (numBones > jj); ++jj)
+                    {
+                        NatNetBodyData aBone;
+
+                        okSoFar = readBody(cursor, _versionMajor, _versionMinor, aBone);
+                        if (okSoFar)
+                        {
+                            sink.addBone(aBone);
+                        }
+                    }
+                    if (okSoFar)
+                    {
+                        sink.endSkeleton();
+                    }
+                }
+            }
+        }
+        // The labelled markers, force plates and timing information that follow are not used.
+        if (okSoFar)
+        {
+            hasOutput = sink.endFrame();
+        }
+        else
+        {
+            sink.abandonFrame();
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // NatNetFrameDecoder::decodeFrame
+
+NatNetDecodeResult
+NatNetFrameDecoder::decodePacket(const char *      data,
+                                 const size_t      length,
+                                 NatNetFrameSink & sink)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("data = ", data, "sink = ", &sink); //####
+    ODL_LL1("length = ", length); //####
+    NatNetDecodeResult result = kNatNetDecodeMalformed;
+
+    try
+    {
+        if (data && (NATNET_PACKET_HEADER_SIZE_ <= length))
+        {
+            const unsigned char * header = reinterpret_cast<const unsigned char *>(data);
+            int                   messageID = (header[0] | (header[1] << 8));
+            size_t                messageLength = (header[2] | (header[3] << 8));
+
+            if ((NATNET_PACKET_HEADER_SIZE_ + messageLength) <= length)
+            {
+                const char * body = data + NATNET_PACKET_HEADER_SIZE_;
+                bool         hasOutput;
+
+                switch (messageID)
+                {
+                    case NATNET_MESSAGE_FRAME_OF_DATA_ :
+                        if (decodeFrame(body, messageLength, sink, hasOutput))
+                        {
+                            ++_framesDecoded;
+                            result = (hasOutput ? kNatNetDecodeFrameReady : kNatNetDecodeNoOutput);
+                        }
+                        break;
+
+                    case NATNET_MESSAGE_PING_RESPONSE_ :
+                        // The server name and application version precede the protocol version.
+                        if ((kServerNameLength + 8) <= messageLength)
+                        {
+                            const unsigned char * version =
+                                    reinterpret_cast<const unsigned char *>(body) +
+                                    kServerNameLength + 4;
+
+                            if (0 < version[0])
+                            {
+                                setVersion(version[0], version[1]);
+                            }
+                            result = kNatNetDecodeNoOutput;
+                        }
+                        break;
+
+                    default :
+                        // Other messages are replies to commands, which are not used.
+                        result = kNatNetDecodeNoOutput;
+                        break;
+
+                }
+            }
+        }
+        if (kNatNetDecodeMalformed == result)
+        {
+            ++_packetsRejected;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_L(static_cast<int>(result)); //####
+    return result;
+} // NatNetFrameDecoder::decodePacket
+
+void
+NatNetFrameDecoder::setVersion(const int major,
+                               const int minor)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("major = ", major, "minor = ", minor); //####
+    _versionMajor = major;
+    _versionMinor = minor;
+    ODL_OBJEXIT(); //####
+} // NatNetFrameDecoder::setVersion
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
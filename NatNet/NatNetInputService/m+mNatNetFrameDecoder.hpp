@@ -0,0 +1,213 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetFrameDecoder.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a decoder of Natural Point NatNet packets.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMNatNetFrameDecoder_HPP_))
+# define MpMNatNetFrameDecoder_HPP_ /* Header guard */
+
+# include "m+mNatNetFrameSink.hpp"
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a decoder of Natural Point %NatNet packets. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The message identifier for a request for the server description. */
+# define NATNET_MESSAGE_PING_          0
+
+/*! @brief The message identifier for the server description. */
+# define NATNET_MESSAGE_PING_RESPONSE_ 1
+
+/*! @brief The message identifier for a frame of motion capture data. */
+# define NATNET_MESSAGE_FRAME_OF_DATA_ 7
+
+/*! @brief The number of bytes in a %NatNet packet header; the message identifier and the message
+ length. */
+# define NATNET_PACKET_HEADER_SIZE_    4
+
+namespace MplusM
+{
+    namespace NatNet
+    {
+        /*! @brief The outcome of decoding a packet. */
+        enum NatNetDecodeResult
+        {
+            /*! @brief The packet held a frame that has produced output. */
+            kNatNetDecodeFrameReady,
+
+            /*! @brief The packet was valid, but has produced no output. */
+            kNatNetDecodeNoOutput,
+
+            /*! @brief The packet was not a valid %NatNet packet. */
+            kNatNetDecodeMalformed
+
+        }; // NatNetDecodeResult
+
+        /*! @brief A decoder for the packets that a Natural Point %NatNet device sends.
+
+         Frames of data are decoded in place and the rigid bodies and skeletons are handed to a
+         frame sink as they are read, so that they can be written directly in the form needed for
+         output. The layout of a frame depends on the version of the %NatNet protocol, which is
+         taken from the server description when one is seen. */
+        class NatNetFrameDecoder
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            NatNetFrameDecoder(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~NatNetFrameDecoder(void);
+
+            /*! @brief Decode a packet.
+             @param[in] data The bytes of the packet.
+             @param[in] length The number of bytes in the packet.
+             @param[in,out] sink The receiver of the contents of a frame.
+             @returns The outcome of decoding the packet. */
+            NatNetDecodeResult
+            decodePacket(const char *      data,
+                         const size_t      length,
+                         NatNetFrameSink & sink);
+
+            /*! @brief Return the number of frames that have been decoded.
+             @returns The number of frames that have been decoded. */
+            inline int64_t
+            framesDecoded(void)
+            const
+            {
+                return _framesDecoded;
+            } // framesDecoded
+
+            /*! @brief Return the number of packets that could not be decoded.
+             @returns The number of packets that could not be decoded. */
+            inline int64_t
+            packetsRejected(void)
+            const
+            {
+                return _packetsRejected;
+            } // packetsRejected
+
+            /*! @brief Set the version of the %NatNet protocol to be decoded.
+             @param[in] major The major version number.
+             @param[in] minor The minor version number. */
+            void
+            setVersion(const int major,
+                       const int minor);
+
+            /*! @brief Return the major version number of the %NatNet protocol being decoded.
+             @returns The major version number of the %NatNet protocol being decoded. */
+            inline int
+            versionMajor(void)
+            const
+            {
+                return _versionMajor;
+            } // versionMajor
+
+            /*! @brief Return the minor version number of the %NatNet protocol being decoded.
+             @returns The minor version number of the %NatNet protocol being decoded. */
+            inline int
+            versionMinor(void)
+            const
+            {
+                return _versionMinor;
+            } // versionMinor
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            NatNetFrameDecoder(const NatNetFrameDecoder & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            NatNetFrameDecoder &
+            operator =(const NatNetFrameDecoder & other);
+
+            /*! @brief Decode a frame of data.
+             @param[in] data The bytes of the frame, following the packet header.
+             @param[in] length The number of bytes in the frame.
+             @param[in,out] sink The receiver of the contents of the frame.
+             @param[out] hasOutput @c true if the frame has produced output and @c false
+             otherwise.
+             @returns @c true if the frame was valid and @c false otherwise. */
+            bool
+            decodeFrame(const char *      data,
+                        const size_t      length,
+                        NatNetFrameSink & sink,
+                        bool &            hasOutput);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The number of frames that have been decoded. */
+            int64_t _framesDecoded;
+
+            /*! @brief The number of packets that could not be decoded. */
+            int64_t _packetsRejected;
+
+            /*! @brief The major version number of the %NatNet protocol. */
+            int _versionMajor;
+
+            /*! @brief The minor version number of the %NatNet protocol. */
+            int _versionMinor;
+
+        }; // NatNetFrameDecoder
+
+    } // NatNet
+
+} // MplusM
+
+#endif // ! defined(MpMNatNetFrameDecoder_HPP_)
@@ -0,0 +1,154 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetFrameSink.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the interface used to receive decoded NatNet frames.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mNatNetFrameSink.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the interface used to receive decoded %NatNet frames. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::NatNet;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+NatNetFrameSink::NatNetFrameSink(void)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // NatNetFrameSink::NatNetFrameSink
+
+NatNetFrameSink::~NatNetFrameSink(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // NatNetFrameSink::~NatNetFrameSink
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if defined(MpM_UseNatNetSDK)
+bool
+NatNetFrameSink::deliverSDKFrame(const sFrameOfMocapData & aFrame)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aFrame = ", &aFrame); //####
+    NatNetBodyData data;
+
+    startFrame(aFrame.iFrame);
+    for (int ii = 0; aFrame.nRigidBodies > ii; ++ii)
+    {
+        const sRigidBodyData & aBody = aFrame.RigidBodies[ii];
+
+        data._id = aBody.ID;
+        data._x = aBody.x;
+        data._y = aBody.y;
+        data._z = aBody.z;
+        data._qx = aBody.qx;
+        data._qy = aBody.qy;
+        data._qz = aBody.qz;
+        data._qw = aBody.qw;
+        data._valid = (0 != (aBody.params & 0x01));
+        addRigidBody(data);
+    }
+    startSkeletons(aFrame.nSkeletons);
+    for (int ii = 0; aFrame.nSkeletons > ii; ++ii)
+    {
+        const sSkeletonData & aSkel = aFrame.Skeletons[ii];
+
+        startSkeleton(ii, aSkel.skeletonID, aSkel.nRigidBodies);
+        for (int jj = 0; aSkel.nRigidBodies > jj; ++jj)
+        {
+            const sRigidBodyData & aBone = aSkel.RigidBodyData[jj];
+
+            data._id = aBone.ID;
+            data._x = aBone.x;
+            data._y = aBone.y;
+            data._z = aBone.z;
+            data._qx = aBone.qx;
+            data._qy = aBone.qy;
+            data._qz = aBone.qz;
+            data._qw = aBone.qw;
+            data._valid = true;
+            addBone(data);
+        }
+        endSkeleton();
+    }
+    bool result = endFrame();
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // NatNetFrameSink::deliverSDKFrame
+#endif // defined(MpM_UseNatNetSDK)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
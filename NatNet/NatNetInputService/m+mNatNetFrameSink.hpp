@@ -0,0 +1,195 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetFrameSink.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the interface used to receive decoded NatNet frames.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMNatNetFrameSink_HPP_))
+# define MpMNatNetFrameSink_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(MpM_UseNatNetSDK)
+#  include <NatNetTypes.h>
+# endif // defined(MpM_UseNatNetSDK)
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the interface used to receive decoded %NatNet frames. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace NatNet
+    {
+        /*! @brief The position and orientation of a rigid body or a bone. */
+        struct NatNetBodyData
+        {
+            /*! @brief The X position. */
+            double _x;
+
+            /*! @brief The Y position. */
+            double _y;
+
+            /*! @brief The Z position. */
+            double _z;
+
+            /*! @brief The X component of the orientation quaternion. */
+            double _qx;
+
+            /*! @brief The Y component of the orientation quaternion. */
+            double _qy;
+
+            /*! @brief The Z component of the orientation quaternion. */
+            double _qz;
+
+            /*! @brief The W component of the orientation quaternion. */
+            double _qw;
+
+            /*! @brief The identifier for the rigid body or bone. */
+            int _id;
+
+            /*! @brief @c true if the rigid body or bone was tracked in the frame and @c false
+             otherwise. */
+            bool _valid;
+
+        }; // NatNetBodyData
+
+        /*! @brief The receiver of the contents of frames from a Natural Point %NatNet device.
+
+         The contents of a frame are delivered in the order that they appear in the frame; the
+         rigid bodies, followed by the skeletons and their bones. */
+        class NatNetFrameSink
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            NatNetFrameSink(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~NatNetFrameSink(void);
+
+            /*! @brief Discard a partially-delivered frame. */
+            virtual void
+            abandonFrame(void) = 0;
+
+            /*! @brief Add a bone to the current skeleton.
+             @param[in] bone The position and orientation of the bone. */
+            virtual void
+            addBone(const NatNetBodyData & bone) = 0;
+
+            /*! @brief Add a rigid body to the frame.
+             @param[in] body The position and orientation of the rigid body. */
+            virtual void
+            addRigidBody(const NatNetBodyData & body) = 0;
+
+            /*! @brief Complete the frame.
+             @returns @c true if the frame has produced output to be sent and @c false
+             otherwise. */
+            virtual bool
+            endFrame(void) = 0;
+
+            /*! @brief Complete the current skeleton. */
+            virtual void
+            endSkeleton(void) = 0;
+
+            /*! @brief Begin a new frame.
+             @param[in] frameNumber The number of the frame. */
+            virtual void
+            startFrame(const int frameNumber) = 0;
+
+            /*! @brief Begin a new skeleton.
+             @param[in] skeletonIndex The position of the skeleton in the frame.
+             @param[in] skeletonID The identifier for the skeleton.
+             @param[in] numBones The number of bones in the skeleton. */
+            virtual void
+            startSkeleton(const int skeletonIndex,
+                          const int skeletonID,
+                          const int numBones) = 0;
+
+            /*! @brief Begin the skeletons of the frame.
+             @param[in] numSkeletons The number of skeletons in the frame. */
+            virtual void
+            startSkeletons(const int numSkeletons) = 0;
+
+# if defined(MpM_UseNatNetSDK)
+            /*! @brief Deliver a frame that was received by the Natural Point %NatNet SDK.
+             @param[in] aFrame The frame to be delivered.
+             @returns @c true if the frame has produced output to be sent and @c false
+             otherwise. */
+            bool
+            deliverSDKFrame(const sFrameOfMocapData & aFrame);
+# endif // defined(MpM_UseNatNetSDK)
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            NatNetFrameSink(const NatNetFrameSink & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            NatNetFrameSink &
+            operator =(const NatNetFrameSink & other);
+
+        public :
+
+        protected :
+
+        private :
+
+        }; // NatNetFrameSink
+
+    } // NatNet
+
+} // MplusM
+
+#endif // ! defined(MpMNatNetFrameSink_HPP_)
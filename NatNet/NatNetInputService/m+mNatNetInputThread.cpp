@@ -69,6 +69,11 @@ using namespace MplusM::NatNet;
 /*! @brief The connection mode for the client object. */
 #define NATNET_CONNECTION_MODE_ 0 /* 0=multicast, 1=unicast */
 
+#if (! defined(MpM_UseNatNetSDK))
+/*! @brief The number of seconds to wait for packets before checking if the thread is stopping. */
+static const double kPacketWaitTime = 0.1;
+#endif // ! defined(MpM_UseNatNetSDK)
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -77,7 +82,7 @@ using namespace MplusM::NatNet;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_UseNatNetSDK)
 /*! @brief Process a received frame of data.
 @param[in] aFrame The data to be processed.
 @param[in] userData The initially supplied data for this callback. */
@@ -91,96 +96,57 @@ dataReceived(sFrameOfMocapData * aFrame,
 
     if (aFrame && theThread)
     {
-        int numSkeletons = aFrame->nSkeletons;
-        int numRigid = aFrame->nRigidBodies;
-
-        if (0 < (numRigid + numSkeletons))
-        {
-            yarp::os::Bottle   message;
-            yarp::os::Bottle & rigidStuff = message.addList();
-
-            // Put the 'rigid' data in first
-            for (int ii = 0; numRigid > ii; ++ii)
-            {
-                sRigidBodyData & aBody = aFrame->RigidBodies[ii];
-
-                if (aBody.params & 0x01)
-                {
-                    // Valid data
-                    yarp::os::Property & bodyProps = rigidStuff.addDict();
-
-                    bodyProps.put("id", aBody.ID);
-                    bodyProps.put("x", aBody.x);
-                    bodyProps.put("y", aBody.y);
-                    bodyProps.put("z", aBody.z);
-                    bodyProps.put("qx", aBody.qx);
-                    bodyProps.put("qy", aBody.qy);
-                    bodyProps.put("qz", aBody.qz);
-                    bodyProps.put("qw", aBody.qw);
-                }
-            }
-            yarp::os::Bottle & skelStuff = message.addList();
-
-            // Now add the 'skeleton' data
-            for (int ii = 0; numSkeletons > ii; ++ii)
-            {
-                yarp::os::Value      bonesStuff;
-                sSkeletonData &      aSkel = aFrame->Skeletons[ii];
-                yarp::os::Property & skelProps = skelStuff.addDict();
-                int                  numBones = aSkel.nRigidBodies;
-                yarp::os::Bottle *   bonesList = bonesStuff.asList();
-
-                skelProps.put("id", aSkel.skeletonID);
-                if (bonesList)
-                {
-                    for (int jj = 0; numBones > jj; ++jj)
-                    {
-                        sRigidBodyData &     aBone = aSkel.RigidBodyData[jj];
-                        yarp::os::Property & boneProps = bonesList->addDict();
-
-                        boneProps.put("id", aBone.ID);
-                        boneProps.put("x", aBone.x);
-                        boneProps.put("y", aBone.y);
-                        boneProps.put("z", aBone.z);
-                        boneProps.put("qx", aBone.qx);
-                        boneProps.put("qy", aBone.qy);
-                        boneProps.put("qz", aBone.qz);
-                        boneProps.put("qw", aBone.qw);
-                    }
-                    skelProps.put("bones", bonesStuff);
-                }
-            }
-            theThread->sendMessage(message);
-        }
+        theThread->processFrame(*aFrame);
     }
     ODL_EXIT(); //####
 } // dataReceived
-#endif // ! defined(MpM_BuildDummyServices)
 
-#if (! MAC_OR_LINUX_)
-# pragma warning(push)
-# pragma warning(disable: 4100)
-#endif // ! MAC_OR_LINUX_
+# if (! MAC_OR_LINUX_)
+#  pragma warning(push)
+#  pragma warning(disable: 4100)
+# endif // ! MAC_OR_LINUX_
 static void __cdecl
 messageReceived(int    messageType,
                 char * message)
 {
-#if ((! defined(ODL_ENABLE_LOGGING_)) || (! defined(REPORT_NATNET_MESSAGES_)))
-# if MAC_OR_LINUX_
-#  pragma unused(messageType,message)
-# endif // MAC_OR_LINUX_
-#endif // (! defined(ODL_ENABLE_LOGGING_)) || (! defined(REPORT_NATNET_MESSAGES_))
+# if ((! defined(ODL_ENABLE_LOGGING_)) || (! defined(REPORT_NATNET_MESSAGES_)))
+#  if MAC_OR_LINUX_
+#   pragma unused(messageType,message)
+#  endif // MAC_OR_LINUX_
+# endif // (! defined(ODL_ENABLE_LOGGING_)) || (! defined(REPORT_NATNET_MESSAGES_))
     ODL_ENTER(); //####
     ODL_LL1("messageType = ", messageType); //####
     ODL_S1("message = ", message); //####
-#if defined(REPORT_NATNET_MESSAGES_)
+# if defined(REPORT_NATNET_MESSAGES_)
     std::cerr << messageType << ": " << message << std::endl;
-#endif // defined(REPORT_NATNET_MESSAGES_)
+# endif // defined(REPORT_NATNET_MESSAGES_)
     ODL_EXIT(); //####
 } // messageReceived
-#if (! MAC_OR_LINUX_)
-# pragma warning(pop)
-#endif // ! MAC_OR_LINUX_
+# if (! MAC_OR_LINUX_)
+#  pragma warning(pop)
+# endif // ! MAC_OR_LINUX_
+#else // ! defined(MpM_UseNatNetSDK)
+/*! @brief Process a received packet.
+ @param[in] data The bytes of the packet.
+ @param[in] length The number of bytes in the packet.
+ @param[in] handlerStuff The thread that is receiving the packets. */
+static void
+packetReceived(const char * data,
+               const size_t length,
+               void *       handlerStuff)
+{
+    ODL_ENTER(); //####
+    ODL_P2("data = ", data, "handlerStuff = ", handlerStuff); //####
+    ODL_LL1("length = ", length); //####
+    NatNetInputThread * theThread = reinterpret_cast<NatNetInputThread *>(handlerStuff);
+
+    if (theThread)
+    {
+        theThread->processPacket(data, length);
+    }
+    ODL_EXIT(); //####
+} // packetReceived
+#endif // ! defined(MpM_UseNatNetSDK)
 
 #if defined(__APPLE__)
 # pragma mark Class methods
@@ -194,36 +160,35 @@ NatNetInputThread::NatNetInputThread(Common::GeneralChannel * outChannel,
                                      const YarpString &       name,
                                      const int                commandPort,
                                      const int                dataPort) :
-    inherited(), _outChannel(outChannel), _address(name), _commandPort(commandPort),
-    _dataPort(dataPort)
-#if (! defined(MpM_BuildDummyServices))
-    , _client(NULL)
-#endif // ! defined(MpM_BuildDummyServices)
+    inherited(), _outChannel(outChannel), _address(name),
+#if defined(MpM_UseNatNetSDK)
+    _client(NULL),
+#endif // defined(MpM_UseNatNetSDK)
+    _commandPort(commandPort), _dataPort(dataPort)
 {
     ODL_ENTER(); //####
     ODL_P1("outChannel = ", outChannel); //####
     ODL_S1s("name = ", name); //####
     ODL_LL2("commandPort = ", commandPort, "dataPort = ", dataPort); //####
-#if defined(MpM_BuildDummyServices)
-    strncpy(_clientIPAddress, "", sizeof(_clientIPAddress) - 1);
-    strncpy(_serverIPAddress, "", sizeof(_serverIPAddress) - 1);
-#else // ! defined(MpM_BuildDummyServices)
+#if defined(MpM_UseNatNetSDK)
     strcpy_s(_clientIPAddress, sizeof(_clientIPAddress) - 1, "");
     strcpy_s(_serverIPAddress, sizeof(_serverIPAddress) - 1, "");
-#endif // ! defined(MpM_BuildDummyServices)
+#endif // defined(MpM_UseNatNetSDK)
     ODL_EXIT_P(this); //####
 } // NatNetInputThread::NatNetInputThread
 
 NatNetInputThread::~NatNetInputThread(void)
 {
     ODL_OBJENTER(); //####
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_UseNatNetSDK)
     if (_client)
     {
         _client->Uninitialize();
         delete _client;
     }
-#endif // ! defined(MpM_BuildDummyServices)
+#else // ! defined(MpM_UseNatNetSDK)
+    _receiver.close();
+#endif // ! defined(MpM_UseNatNetSDK)
     ODL_OBJEXIT(); //####
 } // NatNetInputThread::~NatNetInputThread
 
@@ -239,6 +204,34 @@ NatNetInputThread::clearOutputChannel(void)
     ODL_OBJEXIT(); //####
 } // NatNetInputThread::clearOutputChannel
 
+#if defined(MpM_UseNatNetSDK)
+void
+NatNetInputThread::processFrame(const sFrameOfMocapData & aFrame)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aFrame = ", &aFrame); //####
+    if (_frameSink.deliverSDKFrame(aFrame))
+    {
+        sendFrame();
+    }
+    ODL_OBJEXIT(); //####
+} // NatNetInputThread::processFrame
+#else // ! defined(MpM_UseNatNetSDK)
+void
+NatNetInputThread::processPacket(const char * data,
+                                 const size_t length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("data = ", data); //####
+    ODL_LL1("length = ", length); //####
+    if (kNatNetDecodeFrameReady == _decoder.decodePacket(data, length, _frameSink))
+    {
+        sendFrame();
+    }
+    ODL_OBJEXIT(); //####
+} // NatNetInputThread::processPacket
+#endif // ! defined(MpM_UseNatNetSDK)
+
 void
 NatNetInputThread::run(void)
 {
@@ -247,14 +240,24 @@ NatNetInputThread::run(void)
     {
         for ( ; ! isStopping(); )
         {
+#if defined(MpM_UseNatNetSDK)
             ConsumeSomeTime();
+#else // ! defined(MpM_UseNatNetSDK)
+            // All the packets that have arrived are decoded and sent before waiting again.
+            if (0 > _receiver.receivePackets(packetReceived, this, kPacketWaitTime))
+            {
+                ODL_LOG("(0 > _receiver.receivePackets(packetReceived, this, " //####
+                        "kPacketWaitTime))"); //####
+                ConsumeSomeTime();
+            }
+#endif // ! defined(MpM_UseNatNetSDK)
         }
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_UseNatNetSDK)
         if (_client)
         {
             _client->SetDataCallback(NULL, NULL);
         }
-#endif // ! defined(MpM_BuildDummyServices)
+#endif // defined(MpM_UseNatNetSDK)
     }
     catch (...)
     {
@@ -265,23 +268,25 @@ NatNetInputThread::run(void)
 } // NatNetInputThread::run
 
 void
-NatNetInputThread::sendMessage(yarp::os::Bottle & message)
+NatNetInputThread::sendFrame(void)
 {
     ODL_OBJENTER(); //####
-    ODL_P1("message = ", &message); //####
+    GeneralChannel * outChannel = _outChannel;
 
-    if (_outChannel)
+    if (outChannel)
     {
-        if (! _outChannel->write(message))
+        yarp::os::Bottle & message = _frameSink.message();
+
+        if (! outChannel->write(message))
         {
-            ODL_LOG("(! _outChannel->write(message))"); //####
+            ODL_LOG("(! outChannel->write(message))"); //####
 #if defined(MpM_StallOnSendProblem)
             Stall();
 #endif // defined(MpM_StallOnSendProblem)
         }
     }
     ODL_OBJEXIT(); //####
-} // NatNetInputThread::sendMessage
+} // NatNetInputThread::sendFrame
 
 bool
 NatNetInputThread::threadInit(void)
@@ -291,7 +296,7 @@ NatNetInputThread::threadInit(void)
 
     try
     {
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_UseNatNetSDK)
         _client = new NatNetClient(NATNET_CONNECTION_MODE_);
         ODL_P1("_client <- ", _client); //####
         if (_client)
@@ -357,7 +362,25 @@ NatNetInputThread::threadInit(void)
         {
             result = false;
         }
-#endif // ! defined(MpM_BuildDummyServices)
+#else // ! defined(MpM_UseNatNetSDK)
+        if (_receiver.open(_address, _commandPort, _dataPort))
+        {
+            // The description of the server includes the protocol version for the frames; until
+            // it arrives, the most recent version is assumed.
+            if (! _receiver.requestServerDescription())
+            {
+                ODL_LOG("(! _receiver.requestServerDescription())"); //####
+                std::cerr << "Could not ask Natural Point NatNet device for its description." <<
+                        std::endl;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_receiver.open(_address, _commandPort, _dataPort))"); //####
+            std::cerr << "Could not listen for Natural Point NatNet device." << std::endl;
+            result = false;
+        }
+#endif // ! defined(MpM_UseNatNetSDK)
     }
     catch (...)
     {
@@ -39,13 +39,18 @@
 #if (! defined(MpMNatNetInputThread_HPP_))
 # define MpMNatNetInputThread_HPP_ /* Header guard */
 
-# include <m+m/m+mBaseThread.hpp>
-# include <m+m/m+mGeneralChannel.hpp>
+# include "m+mNatNetBottleFrameSink.hpp"
 
-# if (! defined(MpM_BuildDummyServices))
+# if defined(MpM_UseNatNetSDK)
 #  include <NatNetTypes.h>
 #  include <NatNetClient.h>
-# endif // ! defined(MpM_BuildDummyServices)
+# else // ! defined(MpM_UseNatNetSDK)
+#  include "m+mNatNetFrameDecoder.hpp"
+#  include "m+mNatNetPacketReceiver.hpp"
+# endif // ! defined(MpM_UseNatNetSDK)
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mGeneralChannel.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -97,10 +102,21 @@ namespace MplusM
             void
             clearOutputChannel(void);
 
-            /*! @brief Send a message via the output channel.
-             @param[in] message The message to send. */
+# if defined(MpM_UseNatNetSDK)
+            /*! @brief Process a frame received by the Natural Point %NatNet SDK.
+             This is meant to be used by the data received callback.
+             @param[in] aFrame The frame to be processed. */
             void
-            sendMessage(yarp::os::Bottle & message);
+            processFrame(const sFrameOfMocapData & aFrame);
+# else // ! defined(MpM_UseNatNetSDK)
+            /*! @brief Process a packet received from the Natural Point %NatNet device.
+             This is meant to be used by the packet handler.
+             @param[in] data The bytes of the packet.
+             @param[in] length The number of bytes in the packet. */
+            void
+            processPacket(const char * data,
+                          const size_t length);
+# endif // ! defined(MpM_UseNatNetSDK)
 
         protected :
 
@@ -120,6 +136,10 @@ namespace MplusM
             virtual void
             run(void);
 
+            /*! @brief Send the most recently completed frame via the output channel. */
+            void
+            sendFrame(void);
+
             /*! @brief The thread initialization method.
              @returns @c true if the thread is ready to run. */
             virtual bool
@@ -137,22 +157,32 @@ namespace MplusM
             /*! @brief The address of the Natural Point %NatNet device. */
             YarpString _address;
 
-            /*! @brief The command port of the Natural Point %NatNet device. */
-            int _commandPort;
-
-            /*! @brief The command port of the Natural Point %NatNet device. */
-            int _dataPort;
+            /*! @brief The receiver for the contents of each frame, which produces the output
+             data. */
+            NatNetBottleFrameSink _frameSink;
 
-# if (! defined(MpM_BuildDummyServices))
+# if defined(MpM_UseNatNetSDK)
             /*! @brief The connection to the Natural Point %NatNet device. */
             NatNetClient * _client;
-# endif // ! defined(MpM_BuildDummyServices)
 
             /*! @brief The local copy of the client IP address. */
             char _clientIPAddress[IPADDRESS_BUFFER_SIZE];
 
             /*! @brief The local copy of the server IP address. */
             char _serverIPAddress[IPADDRESS_BUFFER_SIZE];
+# else // ! defined(MpM_UseNatNetSDK)
+            /*! @brief The decoder for the packets from the Natural Point %NatNet device. */
+            NatNetFrameDecoder _decoder;
+
+            /*! @brief The receiver for the packets from the Natural Point %NatNet device. */
+            NatNetPacketReceiver _receiver;
+# endif // ! defined(MpM_UseNatNetSDK)
+
+            /*! @brief The command port of the Natural Point %NatNet device. */
+            int _commandPort;
+
+            /*! @brief The command port of the Natural Point %NatNet device. */
+            int _dataPort;
 
         }; // NatNetInputThread
 
@@ -0,0 +1,485 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetPacketReceiver.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a receiver of Natural Point NatNet packets.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mNatNetPacketReceiver.hpp"
+
+#include "m+mNatNetFrameDecoder.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <fcntl.h>
+# include <poll.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a receiver of Natural Point %NatNet packets. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::NatNet;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The largest packet that can be received. */
+static const size_t kMaxPacketSize = 65536;
+
+/*! @brief The number of packets that are read at a time. */
+static const size_t kPacketsPerBatch = 16;
+
+/*! @brief The size of the receive buffer to request for the data socket, so that bursts of frames
+ are not lost while a batch is being processed. */
+static const int kDataSocketBufferSize = 0x400000;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Release a socket.
+ @param[in,out] aSocket The socket to be released. */
+static void
+closeSocket(SOCKET & aSocket)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aSocket = ", &aSocket); //####
+    if (INVALID_SOCKET != aSocket)
+    {
+#if MAC_OR_LINUX_
+        ::close(aSocket);
+#else // ! MAC_OR_LINUX_
+        closesocket(aSocket);
+#endif // ! MAC_OR_LINUX_
+        aSocket = INVALID_SOCKET;
+    }
+    ODL_EXIT(); //####
+} // closeSocket
+
+/*! @brief Create a non-blocking UDP socket that is bound to a local port.
+ @param[in] port The local port to bind to, or zero for any port.
+ @param[in] shared @c true if other sockets may bind to the same port and @c false otherwise.
+ @returns The new socket, or @c INVALID_SOCKET if the socket could not be created. */
+static SOCKET
+createBoundSocket(const int  port,
+                  const bool shared)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("port = ", port); //####
+    ODL_B1("shared = ", shared); //####
+    SOCKET result = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+    if (INVALID_SOCKET != result)
+    {
+        struct sockaddr_in localAddress;
+
+        if (shared)
+        {
+            int reuse = 1;
+
+            setsockopt(result, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&reuse),
+                       sizeof(reuse));
+        }
+        memset(&localAddress, 0, sizeof(localAddress));
+        localAddress.sin_family = AF_INET;
+        localAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+        localAddress.sin_port = htons(static_cast<u_short>(port));
+        if (0 == bind(result, reinterpret_cast<struct sockaddr *>(&localAddress),
+                      sizeof(localAddress)))
+        {
+#if MAC_OR_LINUX_
+            fcntl(result, F_SETFL, fcntl(result, F_GETFL, 0) | O_NONBLOCK);
+#else // ! MAC_OR_LINUX_
+            u_long nonBlocking = 1;
+
+            ioctlsocket(result, FIONBIO, &nonBlocking);
+#endif // ! MAC_OR_LINUX_
+        }
+        else
+        {
+            ODL_LOG("! (0 == bind(result, reinterpret_cast<struct sockaddr *>" //####
+                    "(&localAddress), sizeof(localAddress)))"); //####
+            closeSocket(result);
+        }
+    }
+    ODL_EXIT_L(static_cast<long>(result)); //####
+    return result;
+} // createBoundSocket
+
+/*! @brief Convert a dotted IPv4 address into a network address.
+ @param[in] address The dotted address.
+ @param[out] result The network address.
+ @returns @c true if the address was valid and @c false otherwise. */
+static bool
+parseAddress(const YarpString & address,
+             struct in_addr &   result)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("address = ", address); //####
+    ODL_P1("result = ", &result); //####
+#if MAC_OR_LINUX_
+    bool okSoFar = (1 == inet_pton(AF_INET, address.c_str(), &result));
+#else // ! MAC_OR_LINUX_
+    bool okSoFar = (1 == InetPtonA(AF_INET, address.c_str(), &result));
+#endif // ! MAC_OR_LINUX_
+
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // parseAddress
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+NatNetPacketReceiver::NatNetPacketReceiver(void) :
+    _buffer(kMaxPacketSize * kPacketsPerBatch),
+#if defined(__linux__)
+    _headers(kPacketsPerBatch), _vectors(kPacketsPerBatch),
+#endif // defined(__linux__)
+    _batchesReceived(0), _packetsReceived(0), _commandSocket(INVALID_SOCKET),
+    _dataSocket(INVALID_SOCKET), _haveServer(false)
+{
+    ODL_ENTER(); //####
+    memset(&_serverAddress, 0, sizeof(_serverAddress));
+#if defined(__linux__)
+    // The headers always describe the same buffers, so they only need to be set up once.
+    memset(&_headers[0], 0, _headers.size() * sizeof(_headers[0]));
+    for (size_t ii = 0; kPacketsPerBatch > ii; ++ii)
+    {
+        _vectors[ii].iov_base = &_buffer[ii * kMaxPacketSize];
+        _vectors[ii].iov_len = kMaxPacketSize;
+        _headers[ii].msg_hdr.msg_iov = &_vectors[ii];
+        _headers[ii].msg_hdr.msg_iovlen = 1;
+    }
+#endif // defined(__linux__)
+    ODL_EXIT_P(this); //####
+} // NatNetPacketReceiver::NatNetPacketReceiver
+
+NatNetPacketReceiver::~NatNetPacketReceiver(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    ODL_OBJEXIT(); //####
+} // NatNetPacketReceiver::~NatNetPacketReceiver
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+NatNetPacketReceiver::close(void)
+{
+    ODL_OBJENTER(); //####
+    closeSocket(_commandSocket);
+    closeSocket(_dataSocket);
+    _haveServer = false;
+    ODL_OBJEXIT(); //####
+} // NatNetPacketReceiver::close
+
+bool
+NatNetPacketReceiver::open(const YarpString & serverAddress,
+                           const int          commandPort,
+                           const int          dataPort,
+                           const YarpString & multicastAddress)
+{
+    ODL_OBJENTER(); //####
+    ODL_S2s("serverAddress = ", serverAddress, "multicastAddress = ", multicastAddress); //####
+    ODL_LL2("commandPort = ", commandPort, "dataPort = ", dataPort); //####
+    bool okSoFar = true;
+
+    try
+    {
+        close();
+        _dataSocket = createBoundSocket(dataPort, true);
+        if (INVALID_SOCKET == _dataSocket)
+        {
+            ODL_LOG("(INVALID_SOCKET == _dataSocket)"); //####
+            std::cerr << "Could not bind to NatNet data port " << dataPort << "." << std::endl;
+            okSoFar = false;
+        }
+        else
+        {
+            int bufferSize = kDataSocketBufferSize;
+
+            setsockopt(_dataSocket, SOL_SOCKET, SO_RCVBUF,
+                       reinterpret_cast<const char *>(&bufferSize), sizeof(bufferSize));
+            if (0 < multicastAddress.length())
+            {
+                struct ip_mreq request;
+
+                memset(&request, 0, sizeof(request));
+                request.imr_interface.s_addr = htonl(INADDR_ANY);
+                if (parseAddress(multicastAddress, request.imr_multiaddr))
+                {
+                    if (0 != setsockopt(_dataSocket, IPPROTO_IP, IP_ADD_MEMBERSHIP,
+                                        reinterpret_cast<const char *>(&request),
+                                        sizeof(request)))
+                    {
+                        ODL_LOG("(0 != setsockopt(_dataSocket, IPPROTO_IP, " //####
+                                "IP_ADD_MEMBERSHIP, " //####
+                                "reinterpret_cast<const char *>(&request), " //####
+                                "sizeof(request)))"); //####
+                        std::cerr << "Could not join NatNet multicast group " <<
+                                multicastAddress.c_str() << "." << std::endl;
+                        okSoFar = false;
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (parseAddress(multicastAddress, request.imr_multiaddr))"); //####
+                    std::cerr << "Invalid NatNet multicast address '" <<
+                            multicastAddress.c_str() << "'." << std::endl;
+                    okSoFar = false;
+                }
+            }
+        }
+        if (okSoFar)
+        {
+            _commandSocket = createBoundSocket(0, false);
+            if (INVALID_SOCKET == _commandSocket)
+            {
+                ODL_LOG("(INVALID_SOCKET == _commandSocket)"); //####
+                std::cerr << "Could not create NatNet command socket." << std::endl;
+                okSoFar = false;
+            }
+        }
+        if (okSoFar && (0 < serverAddress.length()))
+        {
+            _serverAddress.sin_family = AF_INET;
+            _serverAddress.sin_port = htons(static_cast<u_short>(commandPort));
+            _haveServer = parseAddress(serverAddress, _serverAddress.sin_addr);
+            if (! _haveServer)
+            {
+                ODL_LOG("(! _haveServer)"); //####
+                std::cerr << "Invalid NatNet server address '" << serverAddress.c_str() << "'." <<
+                        std::endl;
+                okSoFar = false;
+            }
+        }
+        if (! okSoFar)
+        {
+            close();
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // NatNetPacketReceiver::open
+
+int
+NatNetPacketReceiver::receiveBatches(SOCKET              aSocket,
+                                     NatNetPacketHandler handler,
+                                     void *              handlerStuff)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("handlerStuff = ", handlerStuff); //####
+    int result = 0;
+
+    for (bool more = true; more; )
+    {
+        int count;
+
+#if defined(__linux__)
+        count = recvmmsg(aSocket, &_headers[0], static_cast<unsigned int>(kPacketsPerBatch),
+                         MSG_DONTWAIT, NULL);
+        for (int ii = 0; count > ii; ++ii)
+        {
+            handler(&_buffer[ii * kMaxPacketSize], _headers[ii].msg_len, handlerStuff);
+        }
+#else // ! defined(__linux__)
+        // Without recvmmsg(), the batch is read one packet at a time, until the socket is empty.
+        count = 0;
+        for (size_t ii = 0; kPacketsPerBatch > ii; ++ii)
+        {
+            char * packet = &_buffer[ii * kMaxPacketSize];
+            int    length = static_cast<int>(recvfrom(aSocket, packet,
+                                                      static_cast<int>(kMaxPacketSize), 0, NULL,
+                                                      NULL));
+
+            if (0 < length)
+            {
+                handler(packet, length, handlerStuff);
+                ++count;
+            }
+            else
+            {
+                break;
+            }
+        }
+#endif // ! defined(__linux__)
+        if (0 < count)
+        {
+            ++_batchesReceived;
+            _packetsReceived += count;
+            result += count;
+        }
+        // A full batch means that more packets might be waiting.
+        more = (static_cast<int>(kPacketsPerBatch) == count);
+    }
+    ODL_OBJEXIT_L(result); //####
+    return result;
+} // NatNetPacketReceiver::receiveBatches
+
+int
+NatNetPacketReceiver::receivePackets(NatNetPacketHandler handler,
+                                     void *              handlerStuff,
+                                     const double        timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("handlerStuff = ", handlerStuff); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    int result = 0;
+
+    try
+    {
+        if (handler && (INVALID_SOCKET != _dataSocket) && (INVALID_SOCKET != _commandSocket))
+        {
+            int       waitTime = static_cast<int>(timeToWait * 1000);
+            int       res;
+#if MAC_OR_LINUX_
+            pollfd    pollSet[2];
+#else // ! MAC_OR_LINUX_
+            WSAPOLLFD pollSet[2];
+#endif // ! MAC_OR_LINUX_
+
+            pollSet[0].fd = _dataSocket;
+            pollSet[0].events = POLLIN;
+            pollSet[0].revents = 0;
+            pollSet[1].fd = _commandSocket;
+            pollSet[1].events = POLLIN;
+            pollSet[1].revents = 0;
+#if MAC_OR_LINUX_
+            res = poll(pollSet, 2, waitTime);
+#else // ! MAC_OR_LINUX_
+            res = WSAPoll(pollSet, 2, waitTime);
+#endif // ! MAC_OR_LINUX_
+            if (0 < res)
+            {
+                if (pollSet[0].revents & POLLIN)
+                {
+                    result += receiveBatches(_dataSocket, handler, handlerStuff);
+                }
+                if (pollSet[1].revents & POLLIN)
+                {
+                    result += receiveBatches(_commandSocket, handler, handlerStuff);
+                }
+            }
+            else if (0 > res)
+            {
+#if MAC_OR_LINUX_
+                if (EINTR != errno)
+                {
+                    ODL_LOG("(EINTR != errno)"); //####
+                    result = -1;
+                }
+#else // ! MAC_OR_LINUX_
+                ODL_LOG("! (0 <= res)"); //####
+                result = -1;
+#endif // ! MAC_OR_LINUX_
+            }
+        }
+        else
+        {
+            ODL_LOG("! (handler && (INVALID_SOCKET != _dataSocket) && " //####
+                    "(INVALID_SOCKET != _commandSocket))"); //####
+            result = -1;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_L(result); //####
+    return result;
+} // NatNetPacketReceiver::receivePackets
+
+bool
+NatNetPacketReceiver::requestServerDescription(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = false;
+
+    if (_haveServer && (INVALID_SOCKET != _commandSocket))
+    {
+        static const char kPingName[] = "Ping";
+        char              request[NATNET_PACKET_HEADER_SIZE_ + sizeof(kPingName)];
+
+        request[0] = static_cast<char>(NATNET_MESSAGE_PING_ & 0x00FF);
+        request[1] = static_cast<char>((NATNET_MESSAGE_PING_ >> 8) & 0x00FF);
+        request[2] = static_cast<char>(sizeof(kPingName) & 0x00FF);
+        request[3] = static_cast<char>((sizeof(kPingName) >> 8) & 0x00FF);
+        memcpy(request + NATNET_PACKET_HEADER_SIZE_, kPingName, sizeof(kPingName));
+        okSoFar = (static_cast<int>(sizeof(request)) ==
+                   static_cast<int>(sendto(_commandSocket, request, sizeof(request), 0,
+                                           reinterpret_cast<struct sockaddr *>(&_serverAddress),
+                                           sizeof(_serverAddress))));
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // NatNetPacketReceiver::requestServerDescription
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,217 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetPacketReceiver.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a receiver of Natural Point NatNet packets.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMNatNetPacketReceiver_HPP_))
+# define MpMNatNetPacketReceiver_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if MAC_OR_LINUX_
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+# endif // MAC_OR_LINUX_
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a receiver of Natural Point %NatNet packets. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The multicast group that a Natural Point %NatNet device sends frames to by default. */
+# define NATNET_DEFAULT_MULTICAST_ADDRESS_ "239.255.42.99"
+
+namespace MplusM
+{
+    namespace NatNet
+    {
+        /*! @brief A function that processes a received packet.
+         @param[in] data The bytes of the packet.
+         @param[in] length The number of bytes in the packet.
+         @param[in] handlerStuff The private data for the function. */
+        typedef void
+        (*NatNetPacketHandler)
+            (const char * data,
+             const size_t length,
+             void *       handlerStuff);
+
+        /*! @brief A receiver for the packets that a Natural Point %NatNet device sends.
+
+         Frames arrive on the data port, usually via multicast, and replies to commands arrive on
+         the socket that sent the command. Packets that are waiting on a socket are read as a
+         batch; on Linux, a single recvmmsg() call reads the whole batch. */
+        class NatNetPacketReceiver
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            NatNetPacketReceiver(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~NatNetPacketReceiver(void);
+
+            /*! @brief Return the number of batches of packets that have been read.
+             @returns The number of batches of packets that have been read. */
+            inline int64_t
+            batchesReceived(void)
+            const
+            {
+                return _batchesReceived;
+            } // batchesReceived
+
+            /*! @brief Release the sockets. */
+            void
+            close(void);
+
+            /*! @brief Prepare to receive packets.
+             @param[in] serverAddress The IP address of the Natural Point %NatNet device; if
+             empty, no commands can be sent.
+             @param[in] commandPort The command port of the Natural Point %NatNet device.
+             @param[in] dataPort The port that frames are sent to.
+             @param[in] multicastAddress The multicast group that frames are sent to; if empty,
+             frames are expected to be sent directly.
+             @returns @c true if the sockets were set up and @c false otherwise. */
+            bool
+            open(const YarpString & serverAddress,
+                 const int          commandPort,
+                 const int          dataPort,
+                 const YarpString & multicastAddress = NATNET_DEFAULT_MULTICAST_ADDRESS_);
+
+            /*! @brief Return the number of packets that have been read.
+             @returns The number of packets that have been read. */
+            inline int64_t
+            packetsReceived(void)
+            const
+            {
+                return _packetsReceived;
+            } // packetsReceived
+
+            /*! @brief Wait for packets and process all the packets that are waiting.
+             @param[in] handler The function to process each packet.
+             @param[in] handlerStuff The private data for the function.
+             @param[in] timeToWait The number of seconds to wait for a packet to arrive.
+             @returns The number of packets that were processed, or @c -1 if the sockets could
+             not be read. */
+            int
+            receivePackets(NatNetPacketHandler handler,
+                           void *              handlerStuff,
+                           const double        timeToWait);
+
+            /*! @brief Ask the Natural Point %NatNet device to describe itself; the description
+             includes the version of the protocol that is being used for frames.
+             @returns @c true if the request was sent and @c false otherwise. */
+            bool
+            requestServerDescription(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            NatNetPacketReceiver(const NatNetPacketReceiver & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            NatNetPacketReceiver &
+            operator =(const NatNetPacketReceiver & other);
+
+            /*! @brief Process all the packets that are waiting on a socket.
+             @param[in] aSocket The socket to be read.
+             @param[in] handler The function to process each packet.
+             @param[in] handlerStuff The private data for the function.
+             @returns The number of packets that were processed. */
+            int
+            receiveBatches(SOCKET              aSocket,
+                           NatNetPacketHandler handler,
+                           void *              handlerStuff);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The space for a batch of packets. */
+            std::vector<char> _buffer;
+
+# if defined(__linux__)
+            /*! @brief The message headers for a batch of packets. */
+            std::vector<struct mmsghdr> _headers;
+
+            /*! @brief The buffer descriptions for a batch of packets. */
+            std::vector<struct iovec> _vectors;
+# endif // defined(__linux__)
+
+            /*! @brief The address of the command port of the Natural Point %NatNet device. */
+            struct sockaddr_in _serverAddress;
+
+            /*! @brief The number of batches of packets that have been read. */
+            int64_t _batchesReceived;
+
+            /*! @brief The number of packets that have been read. */
+            int64_t _packetsReceived;
+
+            /*! @brief The socket used to send commands and receive replies. */
+            SOCKET _commandSocket;
+
+            /*! @brief The socket used to receive frames. */
+            SOCKET _dataSocket;
+
+            /*! @brief @c true if commands can be sent and @c false otherwise. */
+            bool _haveServer;
+
+        }; // NatNetPacketReceiver
+
+    } // NatNet
+
+} // MplusM
+
+#endif // ! defined(MpMNatNetPacketReceiver_HPP_)
@@ -0,0 +1,976 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mNatNetReplayMain.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The main application for capturing and replaying NatNet packets.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mNatNetBlobFrameSink.hpp"
+#include "m+mNatNetBottleFrameSink.hpp"
+#include "m+mNatNetFrameDecoder.hpp"
+#include "m+mNatNetPacketReceiver.hpp"
+
+#include <m+m/m+mSimulatedSkeletons.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The main application for capturing and replaying %NatNet packets. */
+
+/*! @dir NatNetReplay
+ @brief The set of files that implement the %NatNet packet capture and replay application. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::NatNet;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief A captured packet. */
+struct CapturedPacket
+{
+    /*! @brief The time at which the packet arrived, in microseconds. */
+    int64_t _timeStamp;
+
+    /*! @brief The position of the packet in the capture data. */
+    size_t _offset;
+
+    /*! @brief The number of bytes in the packet. */
+    size_t _length;
+
+}; // CapturedPacket
+
+/*! @brief A sequence of captured packets. */
+typedef std::vector<CapturedPacket> CapturedPacketVector;
+
+/*! @brief The information needed to record packets as they arrive. */
+struct CaptureState
+{
+    /*! @brief The file that packets are written to. */
+    FILE * _captureFile;
+
+    /*! @brief The number of packets that have been written. */
+    int64_t _packetCount;
+
+    /*! @brief The number of bytes that have been written. */
+    int64_t _byteCount;
+
+    /*! @brief @c true if a write failed and @c false otherwise. */
+    bool _failed;
+
+}; // CaptureState
+
+/*! @brief The marker at the start of a capture file. */
+static const char kCaptureMagic[] = "MpMNNC01";
+
+/*! @brief The number of bytes in the marker at the start of a capture file. */
+static const size_t kCaptureMagicLength = sizeof(kCaptureMagic) - 1;
+
+/*! @brief The number of bytes preceding each packet in a capture file; the time stamp and the
+ length. */
+static const size_t kCaptureRecordHeaderLength = sizeof(int64_t) + sizeof(uint32_t);
+
+/*! @brief The default number of seconds to capture packets for. */
+static const int kDefaultCaptureSeconds = 10;
+
+/*! @brief The default port to send replayed packets to. */
+static const int kDefaultDataPort = 1511;
+
+/*! @brief The default number of times to decode the captured packets. */
+static const int kDefaultDecodeRepetitions = 100;
+
+/*! @brief The default address to send replayed packets to. */
+static const char * kDefaultReplayAddress = "127.0.0.1";
+
+/*! @brief The longest that the replay will wait at one time, in seconds, so that a gap in the
+ capture does not stall the replay. */
+static const double kMaximumReplayWait = 1.0;
+
+/*! @brief The number of seconds to wait for packets when capturing. */
+static const double kPacketWaitTime = 0.1;
+
+/*! @brief The largest message that can be sent in a %NatNet packet. */
+static const size_t kMaximumMessageLength = 0xFFFF;
+
+/*! @brief The default number of seconds to simulate a device for. */
+static const int kDefaultSimulateSeconds = 10;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Retrieve an optional non-negative integer argument.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @param[in] index The position of the argument of interest.
+ @param[in] defaultValue The value to use if the argument is missing or invalid.
+ @returns The value of the argument or the default value. */
+static int
+getIntArgument(const int argc,
+               char * *  argv,
+               const int index,
+               const int defaultValue)
+{
+    ODL_ENTER(); //####
+    ODL_LL2("argc = ", argc, "index = ", index); //####
+    ODL_P1("argv = ", argv); //####
+    int result = defaultValue;
+
+    if (index < argc)
+    {
+        const char * startPtr = argv[index];
+        char *       endPtr;
+        int          value = strtol(startPtr, &endPtr, 10);
+
+        if ((startPtr != endPtr) && (! *endPtr) && (0 <= value))
+        {
+            result = value;
+        }
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // getIntArgument
+
+/*! @brief Retrieve an optional non-negative floating-point argument.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @param[in] index The position of the argument of interest.
+ @param[in] defaultValue The value to use if the argument is missing or invalid.
+ @returns The value of the argument or the default value. */
+static double
+getDoubleArgument(const int    argc,
+                  char * *     argv,
+                  const int    index,
+                  const double defaultValue)
+{
+    ODL_ENTER(); //####
+    ODL_LL2("argc = ", argc, "index = ", index); //####
+    ODL_P1("argv = ", argv); //####
+    ODL_D1("defaultValue = ", defaultValue); //####
+    double result = defaultValue;
+
+    if (index < argc)
+    {
+        const char * startPtr = argv[index];
+        char *       endPtr;
+        double       value = strtod(startPtr, &endPtr);
+
+        if ((startPtr != endPtr) && (! *endPtr) && (0 <= value))
+        {
+            result = value;
+        }
+    }
+    ODL_EXIT_D(result); //####
+    return result;
+} // getDoubleArgument
+
+/*! @brief Append a 16-bit value to a packet, in little-endian order.
+ @param[in,out] packet The packet to be extended.
+ @param[in] value The value to be appended. */
+static void
+appendInt16(std::string & packet,
+            const int     value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("packet = ", &packet); //####
+    ODL_LL1("value = ", value); //####
+    packet += static_cast<char>(value & 0x0FF);
+    packet += static_cast<char>((value >> 8) & 0x0FF);
+    ODL_EXIT(); //####
+} // appendInt16
+
+/*! @brief Append a 32-bit value to a packet, in little-endian order.
+ @param[in,out] packet The packet to be extended.
+ @param[in] value The value to be appended. */
+static void
+appendInt32(std::string &  packet,
+            const uint32_t value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("packet = ", &packet); //####
+    ODL_LL1("value = ", value); //####
+    for (int ii = 0; 4 > ii; ++ii)
+    {
+        packet += static_cast<char>((value >> (8 * ii)) & 0x0FF);
+    }
+    ODL_EXIT(); //####
+} // appendInt32
+
+/*! @brief Append a 64-bit value to a packet, in little-endian order.
+ @param[in,out] packet The packet to be extended.
+ @param[in] value The value to be appended. */
+static void
+appendInt64(std::string &  packet,
+            const uint64_t value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("packet = ", &packet); //####
+    ODL_LL1("value = ", value); //####
+    appendInt32(packet, static_cast<uint32_t>(value & 0x0FFFFFFFF));
+    appendInt32(packet, static_cast<uint32_t>(value >> 32));
+    ODL_EXIT(); //####
+} // appendInt64
+
+/*! @brief Append a single-precision floating-point value to a packet, in little-endian order.
+ @param[in,out] packet The packet to be extended.
+ @param[in] value The value to be appended. */
+static void
+appendFloat(std::string & packet,
+            const double  value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("packet = ", &packet); //####
+    ODL_D1("value = ", value); //####
+    float    asFloat = static_cast<float>(value);
+    uint32_t asInt;
+
+    memcpy(&asInt, &asFloat, sizeof(asInt));
+    appendInt32(packet, asInt);
+    ODL_EXIT(); //####
+} // appendFloat
+
+/*! @brief Build a frame of data packet from a simulated frame.
+
+ The packet uses version 3.0 of the protocol, which is what the %NatNet input services expect
+ when the server has not described itself. Each subject becomes a skeleton and each segment
+ becomes a bone; there are no markers or unattached rigid bodies.
+ @param[in] source The source of the simulated frame.
+ @param[out] packet The packet.
+ @returns @c true if the frame fits in a packet and @c false otherwise. */
+static bool
+buildFramePacket(const SimulatedSkeletonSource & source,
+                 std::string &                   packet)
+{
+    ODL_ENTER(); //####
+    ODL_P2("source = ", &source, "packet = ", &packet); //####
+    const SimulatedSubjectVector & subjects = source.currentFrame();
+    double                         frameTime = ((0 < source.rate()) ?
+                                                (source.frameNumber() / source.rate()) : 0);
+
+    packet.clear();
+    appendInt16(packet, NATNET_MESSAGE_FRAME_OF_DATA_);
+    appendInt16(packet, 0); // The length is filled in below.
+    appendInt32(packet, static_cast<uint32_t>(source.frameNumber()));
+    appendInt32(packet, 0); // Marker sets
+    appendInt32(packet, 0); // Other markers
+    appendInt32(packet, 0); // Rigid bodies
+    appendInt32(packet, static_cast<uint32_t>(subjects.size()));
+    for (size_t ii = 0, numSubjects = subjects.size(); numSubjects > ii; ++ii)
+    {
+        const SimulatedSegmentVector & segments = subjects[ii]._segments;
+
+        appendInt32(packet, static_cast<uint32_t>(ii + 1));
+        appendInt32(packet, static_cast<uint32_t>(segments.size()));
+        for (size_t jj = 0, numSegments = segments.size(); numSegments > jj; ++jj)
+        {
+            const SimulatedSegment & aSegment = segments[jj];
+
+            appendInt32(packet, static_cast<uint32_t>(jj + 1));
+            for (int kk = 0; 3 > kk; ++kk)
+            {
+                appendFloat(packet, aSegment._translation[kk]);
+            }
+            for (int kk = 0; 4 > kk; ++kk)
+            {
+                appendFloat(packet, aSegment._rotation[kk]);
+            }
+            appendFloat(packet, 0); // Mean marker error
+            appendInt16(packet, (aSegment._occluded ? 0 : 1)); // Tracking valid
+        }
+    }
+    appendInt32(packet, 0); // Labelled markers
+    appendInt32(packet, 0); // Force plates
+    appendInt32(packet, 0); // Devices
+    appendInt32(packet, 0); // Timecode
+    appendInt32(packet, 0); // Timecode subframe
+    uint64_t timeAsInt;
+
+    memcpy(&timeAsInt, &frameTime, sizeof(timeAsInt));
+    appendInt64(packet, timeAsInt);
+    appendInt64(packet, 0); // Camera mid-exposure time stamp
+    appendInt64(packet, 0); // Data received time stamp
+    appendInt64(packet, 0); // Transmit time stamp
+    appendInt16(packet, 0); // Frame parameters
+    appendInt32(packet, 0); // End of data
+    size_t messageLength = packet.size() - NATNET_PACKET_HEADER_SIZE_;
+    bool   result = (kMaximumMessageLength >= messageLength);
+
+    if (result)
+    {
+        packet[2] = static_cast<char>(messageLength & 0x0FF);
+        packet[3] = static_cast<char>((messageLength >> 8) & 0x0FF);
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // buildFramePacket
+
+/*! @brief Close a socket that was used to send packets.
+ @param[in] sendSocket The socket to be closed. */
+static void
+closeSender(SOCKET sendSocket)
+{
+    ODL_ENTER(); //####
+    if (INVALID_SOCKET != sendSocket)
+    {
+#if MAC_OR_LINUX_
+        close(sendSocket);
+#else // ! MAC_OR_LINUX_
+        closesocket(sendSocket);
+#endif // ! MAC_OR_LINUX_
+    }
+    ODL_EXIT(); //####
+} // closeSender
+
+/*! @brief Create a socket for sending packets to an address and port.
+ @param[in] address The address to send to.
+ @param[in] port The port to send to.
+ @param[out] destination The address and port, in the form needed for sending.
+ @returns The socket or @c INVALID_SOCKET if the socket could not be created or the address was
+ not valid. */
+static SOCKET
+openSender(const char *         address,
+           const int            port,
+           struct sockaddr_in & destination)
+{
+    ODL_ENTER(); //####
+    ODL_S1("address = ", address); //####
+    ODL_LL1("port = ", port); //####
+    ODL_P1("destination = ", &destination); //####
+    SOCKET sendSocket = INVALID_SOCKET;
+
+    memset(&destination, 0, sizeof(destination));
+    destination.sin_family = AF_INET;
+    destination.sin_port = htons(static_cast<uint16_t>(port));
+#if MAC_OR_LINUX_
+    if (1 == inet_pton(AF_INET, address, &destination.sin_addr))
+#else // ! MAC_OR_LINUX_
+    if (1 == InetPtonA(AF_INET, address, &destination.sin_addr))
+#endif // ! MAC_OR_LINUX_
+    {
+        sendSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (INVALID_SOCKET == sendSocket)
+        {
+            ODL_LOG("(INVALID_SOCKET == sendSocket)"); //####
+            cerr << "Could not create a socket to send with." << endl;
+        }
+    }
+    else
+    {
+        ODL_LOG("! (1 == inet_pton(AF_INET, address, &destination.sin_addr))"); //####
+        cerr << "Invalid address '" << address << "'." << endl;
+    }
+    ODL_EXIT_L(static_cast<long>(sendSocket)); //####
+    return sendSocket;
+} // openSender
+
+/*! @brief Send a packet.
+ @param[in] sendSocket The socket to send with.
+ @param[in] destination The address and port to send to.
+ @param[in] data The bytes of the packet.
+ @param[in] length The number of bytes in the packet.
+ @returns @c true if the packet was sent and @c false otherwise. */
+static bool
+sendPacket(SOCKET                     sendSocket,
+           const struct sockaddr_in & destination,
+           const char *               data,
+           const size_t               length)
+{
+    ODL_ENTER(); //####
+    ODL_P2("destination = ", &destination, "data = ", data); //####
+    ODL_LL1("length = ", length); //####
+#if MAC_OR_LINUX_
+    bool result = (0 <= sendto(sendSocket, data, length, 0,
+                               reinterpret_cast<const struct sockaddr *>(&destination),
+                               sizeof(destination)));
+#else // ! MAC_OR_LINUX_
+    bool result = (0 <= sendto(sendSocket, data, static_cast<int>(length), 0,
+                               reinterpret_cast<const struct sockaddr *>(&destination),
+                               sizeof(destination)));
+#endif // ! MAC_OR_LINUX_
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // sendPacket
+
+/*! @brief Record a packet in the capture file.
+ @param[in] data The bytes of the packet.
+ @param[in] length The number of bytes in the packet.
+ @param[in] handlerStuff The state of the capture. */
+static void
+capturePacket(const char * data,
+              const size_t length,
+              void *       handlerStuff)
+{
+    ODL_ENTER(); //####
+    ODL_P2("data = ", data, "handlerStuff = ", handlerStuff); //####
+    ODL_LL1("length = ", length); //####
+    CaptureState * state = reinterpret_cast<CaptureState *>(handlerStuff);
+
+    if (state && (! state->_failed))
+    {
+        uint8_t  header[kCaptureRecordHeaderLength];
+        int64_t  timeStamp = static_cast<int64_t>(yarp::os::Time::now() * 1e6);
+        uint32_t recordLength = static_cast<uint32_t>(length);
+
+        // The header is written in little-endian order, so that captures can be moved between
+        // machines.
+        for (size_t ii = 0; sizeof(timeStamp) > ii; ++ii)
+        {
+            header[ii] = static_cast<uint8_t>(timeStamp >> (8 * ii));
+        }
+        for (size_t ii = 0; sizeof(recordLength) > ii; ++ii)
+        {
+            header[sizeof(timeStamp) + ii] = static_cast<uint8_t>(recordLength >> (8 * ii));
+        }
+        if ((1 == fwrite(header, sizeof(header), 1, state->_captureFile)) &&
+            (1 == fwrite(data, length, 1, state->_captureFile)))
+        {
+            ++state->_packetCount;
+            state->_byteCount += length;
+        }
+        else
+        {
+            ODL_LOG("! ((1 == fwrite(header, sizeof(header), 1, state->_captureFile)) && " //####
+                    "(1 == fwrite(data, length, 1, state->_captureFile)))"); //####
+            state->_failed = true;
+        }
+    }
+    ODL_EXIT(); //####
+} // capturePacket
+
+/*! @brief Read a capture file.
+ @param[in] fileName The path to the capture file.
+ @param[out] contents The bytes of the captured packets.
+ @param[out] packets The captured packets.
+ @returns @c true if the capture file was read and @c false otherwise. */
+static bool
+readCapture(const char *           fileName,
+            std::string &          contents,
+            CapturedPacketVector & packets)
+{
+    ODL_ENTER(); //####
+    ODL_S1("fileName = ", fileName); //####
+    ODL_P2("contents = ", &contents, "packets = ", &packets); //####
+    bool   okSoFar = false;
+    FILE * captureFile = fopen(fileName, "rb");
+
+    contents.clear();
+    packets.clear();
+    if (captureFile)
+    {
+        char buffer[BUFSIZ];
+
+        for (size_t numRead; 0 < (numRead = fread(buffer, 1, sizeof(buffer), captureFile)); )
+        {
+            contents.append(buffer, numRead);
+        }
+        fclose(captureFile);
+        okSoFar = ((kCaptureMagicLength <= contents.length()) &&
+                   (! memcmp(contents.data(), kCaptureMagic, kCaptureMagicLength)));
+        if (okSoFar)
+        {
+            const uint8_t * bytes = reinterpret_cast<const uint8_t *>(contents.data());
+            size_t          offset = kCaptureMagicLength;
+
+            for ( ; okSoFar && (contents.length() > offset); )
+            {
+                if ((contents.length() - offset) < kCaptureRecordHeaderLength)
+                {
+                    okSoFar = false;
+                }
+                else
+                {
+                    CapturedPacket aPacket;
+                    uint64_t       timeStamp = 0;
+                    uint32_t       recordLength = 0;
+
+                    for (size_t ii = 0; sizeof(timeStamp) > ii; ++ii)
+                    {
+                        timeStamp |= (static_cast<uint64_t>(bytes[offset + ii]) << (8 * ii));
+                    }
+                    offset += sizeof(timeStamp);
+                    for (size_t ii = 0; sizeof(recordLength) > ii; ++ii)
+                    {
+                        recordLength |= (static_cast<uint32_t>(bytes[offset + ii]) << (8 * ii));
+                    }
+                    offset += sizeof(recordLength);
+                    if ((contents.length() - offset) < recordLength)
+                    {
+                        okSoFar = false;
+                    }
+                    else
+                    {
+                        aPacket._timeStamp = static_cast<int64_t>(timeStamp);
+                        aPacket._offset = offset;
+                        aPacket._length = recordLength;
+                        packets.push_back(aPacket);
+                        offset += recordLength;
+                    }
+                }
+            }
+        }
+        if (! okSoFar)
+        {
+            ODL_LOG("(! okSoFar)"); //####
+            cerr << "'" << fileName << "' is not a valid capture file." << endl;
+        }
+    }
+    else
+    {
+        ODL_LOG("! (captureFile)"); //####
+        cerr << "Could not open '" << fileName << "'." << endl;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // readCapture
+
+/*! @brief Record the packets from a Natural Point %NatNet device.
+
+ The arguments are the capture file, the number of seconds to capture, the data port, and the
+ address and command port of the device. If the address of the device is provided, the device is
+ asked to describe itself, so that the protocol version appears in the capture.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @returns @c 0 on a successful run and @c 1 on failure. */
+static int
+doCapture(const int argc,
+          char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    if (0 < argc)
+    {
+        int                  seconds = getIntArgument(argc, argv, 1, kDefaultCaptureSeconds);
+        int                  dataPort = getIntArgument(argc, argv, 2, kDefaultDataPort);
+        YarpString           serverAddress((3 < argc) ? argv[3] : "");
+        int                  commandPort = getIntArgument(argc, argv, 4, dataPort - 1);
+        CaptureState         state;
+        NatNetPacketReceiver receiver;
+
+        state._captureFile = fopen(argv[0], "wb");
+        state._packetCount = state._byteCount = 0;
+        state._failed = false;
+        if (state._captureFile)
+        {
+            if ((1 == fwrite(kCaptureMagic, kCaptureMagicLength, 1, state._captureFile)) &&
+                receiver.open(serverAddress, commandPort, dataPort))
+            {
+                double endTime = yarp::os::Time::now() + seconds;
+
+                if (0 < serverAddress.length())
+                {
+                    receiver.requestServerDescription();
+                }
+                for ( ; (! state._failed) && (yarp::os::Time::now() < endTime); )
+                {
+                    if (0 > receiver.receivePackets(capturePacket, &state, kPacketWaitTime))
+                    {
+                        ODL_LOG("(0 > receiver.receivePackets(capturePacket, &state, " //####
+                                "kPacketWaitTime))"); //####
+                        state._failed = true;
+                    }
+                }
+                receiver.close();
+                cout << "Captured " << state._packetCount << " packets, " << state._byteCount <<
+                        " bytes, in " << receiver.batchesReceived() << " batches." << endl;
+                if (state._failed)
+                {
+                    ODL_LOG("(state._failed)"); //####
+                    cerr << "Capture stopped early." << endl;
+                }
+                else
+                {
+                    result = 0;
+                }
+            }
+            fclose(state._captureFile);
+        }
+        else
+        {
+            ODL_LOG("! (state._captureFile)"); //####
+            cerr << "Could not create '" << argv[0] << "'." << endl;
+        }
+    }
+    else
+    {
+        ODL_LOG("! (0 < argc)"); //####
+        cerr << "Missing capture file name." << endl;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doCapture
+
+/*! @brief Measure the decoding of a capture file.
+
+ The arguments are the capture file and the number of times to decode it. Each pass decodes all
+ the captured packets into both of the output forms used by the %NatNet input services.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @returns @c 0 on a successful run and @c 1 on failure. */
+static int
+doDecode(const int argc,
+         char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int                  result = 1;
+    std::string          contents;
+    CapturedPacketVector packets;
+
+    if ((0 < argc) && readCapture(argv[0], contents, packets))
+    {
+        int                   repetitions = getIntArgument(argc, argv, 1,
+                                                           kDefaultDecodeRepetitions);
+        NatNetBlobFrameSink   blobSink;
+        NatNetBottleFrameSink bottleSink;
+
+        for (int pass = 0; 2 > pass; ++pass)
+        {
+            NatNetFrameDecoder decoder;
+            NatNetFrameSink &  sink = (pass ? static_cast<NatNetFrameSink &>(bottleSink) :
+                                       static_cast<NatNetFrameSink &>(blobSink));
+            int64_t            framesReady = 0;
+            double             startTime = yarp::os::Time::now();
+
+            for (int ii = 0; repetitions > ii; ++ii)
+            {
+                for (size_t jj = 0, mm = packets.size(); mm > jj; ++jj)
+                {
+                    const CapturedPacket & aPacket = packets[jj];
+
+                    if (kNatNetDecodeFrameReady == decoder.decodePacket(contents.data() +
+                                                                        aPacket._offset,
+                                                                        aPacket._length, sink))
+                    {
+                        ++framesReady;
+                    }
+                }
+            }
+            double elapsed = yarp::os::Time::now() - startTime;
+            double perSecond = ((0 < elapsed) ? (decoder.framesDecoded() / elapsed) : 0);
+
+            cout << (pass ? "bottle" : "blob") << "\t" << decoder.framesDecoded() <<
+                    " frames\t" << framesReady << " sent\t" << decoder.packetsRejected() <<
+                    " rejected\t" << perSecond << " frames/s\tprotocol " <<
+                    decoder.versionMajor() << "." << decoder.versionMinor() << endl;
+        }
+        result = 0;
+    }
+    else if (0 >= argc)
+    {
+        ODL_LOG("(0 >= argc)"); //####
+        cerr << "Missing capture file name." << endl;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doDecode
+
+/*! @brief Send the packets in a capture file, with their original timing.
+
+ The arguments are the capture file, the address and port to send to, the speed relative to the
+ original timing and the number of times to send the capture. A speed of zero sends the packets as
+ quickly as possible.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @returns @c 0 on a successful run and @c 1 on failure. */
+static int
+doReplay(const int argc,
+         char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int                  result = 1;
+    std::string          contents;
+    CapturedPacketVector packets;
+
+    if ((0 < argc) && readCapture(argv[0], contents, packets))
+    {
+        const char *       address = ((1 < argc) ? argv[1] : kDefaultReplayAddress);
+        int                port = getIntArgument(argc, argv, 2, kDefaultDataPort);
+        double             speed = getDoubleArgument(argc, argv, 3, 1);
+        int                loops = getIntArgument(argc, argv, 4, 1);
+        struct sockaddr_in destination;
+        SOCKET             sendSocket = openSender(address, port, destination);
+
+        if ((INVALID_SOCKET != sendSocket) && (0 < packets.size()))
+        {
+            int64_t packetsSent = 0;
+            int64_t sendFailures = 0;
+            double  startTime = yarp::os::Time::now();
+
+            for (int ii = 0; loops > ii; ++ii)
+            {
+                double  loopStart = yarp::os::Time::now();
+                int64_t baseTime = packets[0]._timeStamp;
+
+                for (size_t jj = 0, mm = packets.size(); mm > jj; ++jj)
+                {
+                    const CapturedPacket & aPacket = packets[jj];
+
+                    if (0 < speed)
+                    {
+                        // The send times are derived from the start of the loop, rather than
+                        // from the previous send, so that delays in sending do not accumulate.
+                        double dueTime = loopStart + ((aPacket._timeStamp - baseTime) /
+                                                      (1e6 * speed));
+
+                        for (double waitTime; 0 < (waitTime = dueTime - yarp::os::Time::now()); )
+                        {
+                            yarp::os::Time::delay((waitTime < kMaximumReplayWait) ? waitTime :
+                                                  kMaximumReplayWait);
+                        }
+                    }
+                    if (sendPacket(sendSocket, destination, contents.data() + aPacket._offset,
+                                   aPacket._length))
+                    {
+                        ++packetsSent;
+                    }
+                    else
+                    {
+                        ++sendFailures;
+                    }
+                }
+            }
+            double elapsed = yarp::os::Time::now() - startTime;
+            double perSecond = ((0 < elapsed) ? (packetsSent / elapsed) : 0);
+
+            cout << "Sent " << packetsSent << " packets in " << elapsed << " seconds (" <<
+                    perSecond << " packets/s), " << sendFailures << " failed." << endl;
+            result = 0;
+        }
+        closeSender(sendSocket);
+    }
+    else if (0 >= argc)
+    {
+        ODL_LOG("(0 >= argc)"); //####
+        cerr << "Missing capture file name." << endl;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doReplay
+
+/*! @brief Send frames from a simulated device.
+
+ The arguments are the description of the simulated device, the number of seconds to send for,
+ and the address and port to send to. The description is either 'rate,subjects,segments', for
+ generated frames, or 'file[,rate]', for frames read from a file; each subject is sent as a
+ skeleton, with a bone for each segment.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @returns @c 0 on a successful run and @c 1 on failure. */
+static int
+doSimulate(const int argc,
+           char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int                     result = 1;
+    SimulatedSkeletonSource source;
+
+    if ((0 < argc) && source.configure(argv[0]))
+    {
+        int                seconds = getIntArgument(argc, argv, 1, kDefaultSimulateSeconds);
+        const char *       address = ((2 < argc) ? argv[2] : kDefaultReplayAddress);
+        int                port = getIntArgument(argc, argv, 3, kDefaultDataPort);
+        struct sockaddr_in destination;
+        SOCKET             sendSocket = openSender(address, port, destination);
+
+        if (INVALID_SOCKET != sendSocket)
+        {
+            int64_t     bytesSent = 0;
+            int64_t     packetsSent = 0;
+            int64_t     sendFailures = 0;
+            double      startTime = yarp::os::Time::now();
+            double      endTime = startTime + seconds;
+            std::string packet;
+
+            source.restart();
+            for (result = 0; (0 == result) && (yarp::os::Time::now() < endTime); )
+            {
+                source.waitForFrame();
+                if (buildFramePacket(source, packet))
+                {
+                    if (sendPacket(sendSocket, destination, packet.data(), packet.size()))
+                    {
+                        bytesSent += packet.size();
+                        ++packetsSent;
+                    }
+                    else
+                    {
+                        ++sendFailures;
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (buildFramePacket(source, packet))"); //####
+                    cerr << "The simulated frames are too large for a packet." << endl;
+                    result = 1;
+                }
+            }
+            double elapsed = yarp::os::Time::now() - startTime;
+            double perSecond = ((0 < elapsed) ? (packetsSent / elapsed) : 0);
+
+            cout << "Sent " << packetsSent << " frames (" << bytesSent << " bytes) in " <<
+                    elapsed << " seconds (" << perSecond << " frames/s), " <<
+                    source.framesMissed() << " missed, " << sendFailures << " failed." << endl;
+        }
+        closeSender(sendSocket);
+    }
+    else if (0 >= argc)
+    {
+        ODL_LOG("(0 >= argc)"); //####
+        cerr << "Missing simulated device description." << endl;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doSimulate
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for capturing and replaying the packets from a Natural Point %NatNet
+ device.
+
+ The first argument is the operation, one of 'capture', 'replay', 'decode' or 'simulate', and
+ the remaining arguments are specific to the operation:
+
+ capture file [seconds [dataPort [serverAddress [commandPort]]]]
+
+ replay file [address [port [speed [loops]]]]
+
+ decode file [repetitions]
+
+ simulate device [seconds [address [port]]]
+
+ A capture made from a live device can be replayed to the %NatNet input services, or decoded
+ repeatedly to measure the cost of decoding without a device being present. A simulated device
+ sends generated frames, at rates and sizes that a physical device might not provide.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @returns @c 0 on a successful run and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        Initialize(progName);
+        if (0 < --argc)
+        {
+            YarpString operation(argv[1]);
+
+            if (operation == "capture")
+            {
+                result = doCapture(argc - 1, argv + 2);
+            }
+            else if (operation == "decode")
+            {
+                result = doDecode(argc - 1, argv + 2);
+            }
+            else if (operation == "replay")
+            {
+                result = doReplay(argc - 1, argv + 2);
+            }
+            else if (operation == "simulate")
+            {
+                result = doSimulate(argc - 1, argv + 2);
+            }
+            else
+            {
+                cerr << "Unknown operation '" << operation.c_str() << "'." << endl;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 < --argc)"); //####
+            cerr << "Usage: " << progName.c_str() <<
+                    " capture|replay|decode file [arguments] or simulate device [arguments]" <<
+                    endl;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    yarp::os::Network::fini();
+    ODL_EXIT_L(result); //####
+    return result;
+} // main
@@ -98,7 +98,7 @@ OpenStageBlobInputService::OpenStageBlobInputService(const Utilities::Descriptor
                                                                              servicePortNumber) :
     inherited(argumentList, launchPath, argc, argv, tag, true,
               MpM_OPENSTAGEBLOBINPUT_CANONICAL_NAME_, OPENSTAGEBLOBINPUT_SERVICE_DESCRIPTION_, "",
-              serviceEndpointName, servicePortNumber), _eventThread(NULL),
+              serviceEndpointName, servicePortNumber), _latency(), _eventThread(NULL),
     _hostName(SELF_ADDRESS_NAME_), _translationScale(1), _hostPort(OPENSTAGEBLOBINPUT_DEFAULT_PORT_)
 {
     ODL_ENTER(); //####
@@ -187,6 +187,16 @@ OpenStageBlobInputService::configure(const yarp::os::Bottle & details)
     return result;
 } // OpenStageBlobInputService::configure
 
+void
+OpenStageBlobInputService::gatherMetrics(yarp::os::Bottle & metrics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("metrics = ", &metrics); //####
+    inherited::gatherMetrics(metrics);
+    _latency.addToList(metrics, getEndpoint().getName() + "/latency");
+    ODL_OBJEXIT(); //####
+} // OpenStageBlobInputService::gatherMetrics
+
 bool
 OpenStageBlobInputService::getConfiguration(yarp::os::Bottle & details)
 {
@@ -242,7 +252,9 @@ OpenStageBlobInputService::startStreams(void)
     {
         if (! isActive())
         {
-            _eventThread = new OpenStageBlobInputThread(getOutletStream(0), _hostName, _hostPort);
+            _latency.clear();
+            _eventThread = new OpenStageBlobInputThread(getOutletStream(0), _hostName, _hostPort,
+                                                        _latency);
             _eventThread->setScale(_translationScale);
             if (_eventThread->start())
             {
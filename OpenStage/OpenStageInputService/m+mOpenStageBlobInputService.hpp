@@ -40,6 +40,7 @@
 # define MpMOpenStageBlobInputService_HPP_ /* Header guard */
 
 # include <m+m/m+mBaseInputService.hpp>
+# include <m+m/m+mFrameLatencyTrace.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -105,6 +106,11 @@ namespace MplusM
             virtual bool
             configure(const yarp::os::Bottle & details);
 
+            /*! @brief Add the time taken to handle the frames to the service metrics.
+             @param[in,out] metrics The gathered metrics. */
+            virtual void
+            gatherMetrics(yarp::os::Bottle & metrics);
+
             /*! @brief Get the configuration of the input/output streams.
              @param[out] details The configuration information for the input/output streams.
              @returns @c true if the configuration was successfully retrieved and @c false
@@ -151,6 +157,9 @@ namespace MplusM
 
         private :
 
+            /*! @brief The record of the time taken to handle each frame. */
+            Common::FrameLatencyTrace _latency;
+
             /*! @brief The name of the Organic Motion %OpenStage %Blob device server. */
             YarpString _hostName;
 
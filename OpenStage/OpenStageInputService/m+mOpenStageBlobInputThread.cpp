@@ -86,6 +86,13 @@ using namespace om;
 /*! @brief The number if actor stream reports to buffer. */
 #define ACTOR_QUEUE_DEPTH_ 2
 
+/*! @brief The time, in milliseconds, to wait for an update from the device before checking if the
+ thread is stopping. */
+static const int kUpdateWaitTimeout = 100;
+
+/*! @brief The number of seconds in a device timestamp unit of 100 nanoseconds. */
+static const double kSecondsPerTimestampUnit = 1e-7;
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -102,16 +109,18 @@ using namespace om;
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
 
-OpenStageBlobInputThread::OpenStageBlobInputThread(Common::GeneralChannel * outChannel,
-                                                   const YarpString &       name,
-                                                   const int                port) :
-    inherited(), _address(name), _scale(1), _port(port), _outChannel(outChannel)
+OpenStageBlobInputThread::OpenStageBlobInputThread(Common::GeneralChannel *    outChannel,
+                                                   const YarpString &          name,
+                                                   const int                   port,
+                                                   Common::FrameLatencyTrace & latency) :
+    inherited(), _address(name), _latency(latency), _scale(1), _port(port),
+    _outChannel(outChannel)
 #if (! defined(MpM_BuildDummyServices))
     , _client(NULL), _actorStream(NULL), _actorViewJoint(NULL)
 #endif // ! defined(MpM_BuildDummyServices)
 {
     ODL_ENTER(); //####
-    ODL_P1("outChannel = ", outChannel); //####
+    ODL_P2("outChannel = ", outChannel, "latency = ", &latency); //####
     ODL_S1s("name = ", name); //####
     ODL_LL1("port = ", port); //####
     ODL_EXIT_P(this); //####
@@ -145,10 +154,23 @@ OpenStageBlobInputThread::processData(om::sdk2::ActorDataListConstPtr & actorDat
 
     if (0 < numActors)
     {
+        sdk2::TimeInfo     timeInfo = actorData->GetAt(0).timeInfo;
+        unsigned long long currentTimestamp;
+        double             frameAge = 0;
 # if (! defined(MpM_UseCustomStringBuffer))
-        std::stringstream outBuffer;
+        std::stringstream  outBuffer;
 # endif // ! defined(MpM_UseCustomStringBuffer)
 
+        // The current timestamp and the processing timestamp both come from the clock of the
+        // server, so their difference is the age of the frame.
+        if (_client->GetCurrentTimestamp(&currentTimestamp) &&
+            (currentTimestamp > timeInfo.timestampProcessed))
+        {
+            frameAge = (currentTimestamp - timeInfo.timestampProcessed) *
+                        kSecondsPerTimestampUnit;
+        }
+        _latency.frameArrived(timeInfo.frameId, frameAge);
+
         // Write out the number of actors == bodies.
 # if defined(MpM_UseCustomStringBuffer)
         _outBuffer.reset().addLong(static_cast<int>(numActors)).addString(LINE_END_);
@@ -242,6 +264,7 @@ OpenStageBlobInputThread::processData(om::sdk2::ActorDataListConstPtr & actorDat
 # else // ! defined(MpM_UseCustomStringBuffer)
         outBuffer << "END" LINE_END_;
 # endif // ! defined(MpM_UseCustomStringBuffer)
+        _latency.frameEncoded();
         if (_outChannel)
         {
             const char *     outString;
@@ -264,7 +287,11 @@ OpenStageBlobInputThread::processData(om::sdk2::ActorDataListConstPtr & actorDat
 
                 _messageBottle.clear();
                 _messageBottle.add(blobValue);
-                if (! _outChannel->write(_messageBottle))
+                if (_outChannel->write(_messageBottle))
+                {
+                    _latency.frameWritten();
+                }
+                else
                 {
                     ODL_LOG("(! _outChannel->write(_messageBottle))"); //####
 # if defined(MpM_StallOnSendProblem)
@@ -288,7 +315,9 @@ OpenStageBlobInputThread::run(void)
     for ( ; ! isStopping(); )
     {
 #if (! defined(MpM_BuildDummyServices))
-        if (_client->WaitAnyUpdateAll())
+        // Waiting for the update paces the thread to the device, so no further delay is needed;
+        // the timeout only bounds the time taken to notice that the thread is stopping.
+        if (_client->WaitAnyUpdateAll(kUpdateWaitTimeout))
         {
             // The streams are updated, now get the data.
             sdk2::ActorDataListConstPtr actorData;
@@ -296,8 +325,9 @@ OpenStageBlobInputThread::run(void)
             _actorStream->GetData(&actorData);
             processData(actorData);
         }
-#endif // ! defined(MpM_BuildDummyServices)
+#else // defined(MpM_BuildDummyServices)
         ConsumeSomeTime();
+#endif // defined(MpM_BuildDummyServices)
     }
     ODL_OBJEXIT(); //####
 } // OpenStageBlobInputThread::run
@@ -41,6 +41,7 @@
 # define MpMOpenStageBlobInputThread_HPP_ /* Header guard */
 
 # include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mFrameLatencyTrace.hpp>
 # include <m+m/m+mGeneralChannel.hpp>
 # include <m+m/m+mStringBuffer.hpp>
 
@@ -87,10 +88,12 @@ namespace MplusM
             /*! @brief The constructor.
              @param[in] outChannel The channel to send data bursts to.
              @param[in] name The host name to connect to the Organic Motion %OpenStage  server.
-             @param[in] port The host port to connect to the Organic Motion %OpenStage server. */
-            OpenStageBlobInputThread(Common::GeneralChannel * outChannel,
-                                     const YarpString &       name,
-                                     const int                port);
+             @param[in] port The host port to connect to the Organic Motion %OpenStage server.
+             @param[in] latency The record of the time taken to handle each frame. */
+            OpenStageBlobInputThread(Common::GeneralChannel *    outChannel,
+                                     const YarpString &          name,
+                                     const int                   port,
+                                     Common::FrameLatencyTrace & latency);
 
             /*! @brief The destructor. */
             virtual
@@ -148,6 +151,9 @@ namespace MplusM
             /*! @brief The address of the Organic Motion %OpenStage device. */
             YarpString _address;
 
+            /*! @brief The record of the time taken to handle each frame. */
+            Common::FrameLatencyTrace & _latency;
+
             /*! @brief The translation scale to be used. */
             double _scale;
 
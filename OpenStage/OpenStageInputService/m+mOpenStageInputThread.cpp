@@ -86,6 +86,10 @@ using namespace om;
 /*! @brief The number if actor stream reports to buffer. */
 #define ACTOR_QUEUE_DEPTH_ 2
 
+/*! @brief The time, in milliseconds, to wait for an update from the device before checking if the
+ thread is stopping. */
+static const int kUpdateWaitTimeout = 100;
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -256,7 +260,9 @@ OpenStageInputThread::run(void)
     for ( ; ! isStopping(); )
     {
 #if (! defined(MpM_BuildDummyServices))
-        if (_client->WaitAnyUpdateAll())
+        // Waiting for the update paces the thread to the device, so no further delay is needed;
+        // the timeout only bounds the time taken to notice that the thread is stopping.
+        if (_client->WaitAnyUpdateAll(kUpdateWaitTimeout))
         {
             // The streams are updated, now get the data.
             sdk2::ActorDataListConstPtr actorData;
@@ -264,8 +270,9 @@ OpenStageInputThread::run(void)
             _actorStream->GetData(&actorData);
             processData(actorData);
         }
-#endif // ! defined(MpM_BuildDummyServices)
+#else // defined(MpM_BuildDummyServices)
         ConsumeSomeTime();
+#endif // defined(MpM_BuildDummyServices)
     }
     ODL_OBJEXIT(); //####
 } // OpenStageInputThread::run
@@ -81,27 +81,20 @@ using std::endl;
 
 /*! @brief Report the connections for a given port.
  @param[in] flavour The format for the output.
- @param[in] portName The port to be inspected.
- @param[in] checker A function that provides for early exit from loops.
- @param[in] checkStuff The private data for the early exit function. */
+ @param[in] connections The gathered connections for the port. */
 static void
-reportConnections(const OutputFlavour flavour,
-                  const YarpString &  portName,
-                  CheckFunction       checker,
-                  void *              checkStuff)
+reportConnections(const OutputFlavour                 flavour,
+                  const Utilities::PortConnections & connections)
 {
     ODL_ENTER(); //####
-    ODL_S1s("portName = ", portName); //####
-    ODL_P1("checkStuff = ", checkStuff); //####
-    bool          sawInputs = false;
-    bool          sawOutputs = false;
-    ChannelVector inputs;
-    ChannelVector outputs;
-    YarpString    inputsAsString;
-    YarpString    outputsAsString;
-
-    Utilities::GatherPortConnections(portName, inputs, outputs, Utilities::kInputAndOutputBoth,
-                                     false, checker, checkStuff);
+    ODL_P1("connections = ", &connections); //####
+    bool                  sawInputs = false;
+    bool                  sawOutputs = false;
+    const ChannelVector & inputs = connections._inputs;
+    const ChannelVector & outputs = connections._outputs;
+    YarpString            inputsAsString;
+    YarpString            outputsAsString;
+
     if (0 < inputs.size())
     {
         for (ChannelVector::const_iterator walker(inputs.begin()); inputs.end() != walker; ++walker)
@@ -316,10 +309,14 @@ reportConnections(const OutputFlavour flavour,
                     cout << outputsAsString.c_str();
                 }
             }
-            else
+            else if (connections._answered)
             {
                 cout << "   No active connections." << endl;
             }
+            else
+            {
+                cout << "   Port did not report its connections." << endl;
+            }
             break;
 
         default :
@@ -332,16 +329,18 @@ reportConnections(const OutputFlavour flavour,
 /*! @brief Print out connection information for a port.
  @param[in] flavour The format for the output.
  @param[in] aDescriptor The attributes of the port of interest.
+ @param[in] connections The gathered connections for the port.
  @param[in] checkWithRegistry @c true if the %Registry Service is available for requests and
  @c false otherwise.
  @returns @c true if information was written out and @c false otherwise. */
 static bool
-reportPortStatus(const OutputFlavour               flavour,
-                 const Utilities::PortDescriptor & aDescriptor,
-                 const bool                        checkWithRegistry)
+reportPortStatus(const OutputFlavour                flavour,
+                 const Utilities::PortDescriptor &  aDescriptor,
+                 const Utilities::PortConnections & connections,
+                 const bool                         checkWithRegistry)
 {
     ODL_ENTER(); //####
-    ODL_P1("aDescriptor = ", &aDescriptor); //####
+    ODL_P2("aDescriptor = ", &aDescriptor, "connections = ", &connections); //####
     ODL_B1("checkWithRegistry = ", checkWithRegistry); //####
     bool       result;
     YarpString portName;
@@ -571,7 +570,7 @@ reportPortStatus(const OutputFlavour               flavour,
                 break;
 
         }
-        reportConnections(flavour, aDescriptor._portName, NULL, NULL);
+        reportConnections(flavour, connections);
         switch (flavour)
         {
             case kOutputFlavourTabs :
@@ -644,7 +643,27 @@ main(int      argc,
                 Utilities::RemoveStalePorts();
                 if (Utilities::GetDetectedPortList(ports, true))
                 {
-                    bool serviceRegistryPresent = Utilities::CheckListForRegistryService(ports);
+                    bool                             serviceRegistryPresent =
+                                                Utilities::CheckListForRegistryService(ports);
+                    Utilities::PortConnectionsVector graph;
+                    Utilities::PortVector            visiblePorts;
+                    YarpStringVector                 visiblePortNames;
+
+                    // Gather the connections for all the non-hidden ports at once, so that the
+                    // listing reflects a single snapshot of the connection graph.
+                    for (Utilities::PortVector::const_iterator walker(ports.begin());
+                         ports.end() != walker; ++walker)
+                    {
+                        if (strncmp(walker->_portName.c_str(), HIDDEN_CHANNEL_PREFIX_,
+                                    sizeof(HIDDEN_CHANNEL_PREFIX_) - 1))
+                        {
+                            visiblePorts.push_back(*walker);
+                            visiblePortNames.push_back(walker->_portName);
+                        }
+                    }
+                    Utilities::GatherConnectionGraph(visiblePortNames, graph,
+                                                     Utilities::kInputAndOutputBoth,
+                                                     STANDARD_WAIT_TIME_);
 
                     switch (flavour)
                     {
@@ -663,10 +682,9 @@ main(int      argc,
                             break;
 
                     }
-                    if (0 < ports.size())
+                    if (0 < visiblePorts.size())
                     {
-                        for (Utilities::PortVector::const_iterator walker(ports.begin());
-                             ports.end() != walker; ++walker)
+                        for (size_t ii = 0, mm = visiblePorts.size(); mm > ii; ++ii)
                         {
                             switch (flavour)
                             {
@@ -691,7 +709,8 @@ main(int      argc,
                                     break;
 
                             }
-                            found = reportPortStatus(flavour, *walker, serviceRegistryPresent);
+                            found = reportPortStatus(flavour, visiblePorts[ii], graph[ii],
+                                                     serviceRegistryPresent);
                         }
                     }
                     switch (flavour)
@@ -71,7 +71,7 @@ using namespace MplusM::Registry;
 #endif // defined(__APPLE__)
 
 /*! @brief The protocol version number for the 'ping' request. */
-#define PING_REQUEST_VERSION_NUMBER_ "1.0"
+#define PING_REQUEST_VERSION_NUMBER_ "1.1"
 
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
@@ -117,12 +117,15 @@ PingRequestHandler::fillInDescription(const YarpString &   request,
     try
     {
         info.put(MpM_REQREP_DICT_REQUEST_KEY_, request);
-        info.put(MpM_REQREP_DICT_INPUT_KEY_, MpM_REQREP_STRING_);
+        info.put(MpM_REQREP_DICT_INPUT_KEY_, MpM_REQREP_STRING_ MpM_REQREP_DOUBLE_
+                 MpM_REQREP_0_OR_1_);
         info.put(MpM_REQREP_DICT_OUTPUT_KEY_, MpM_REQREP_STRING_);
         info.put(MpM_REQREP_DICT_VERSION_KEY_, PING_REQUEST_VERSION_NUMBER_);
         info.put(MpM_REQREP_DICT_DETAILS_KEY_, T_("Update the last-pinged time for a service or "
                                                   "re-register it\n"
-                                                  "Input: the channel used by the service\n"
+                                                  "Input: the channel used by the service and, "
+                                                  "optionally, the round-trip time of its previous "
+                                                  "'ping'\n"
                                                   "Output: OK or FAILED, with a description of the "
                                                   "problem encountered"));
         yarp::os::Value    keywords;
@@ -158,13 +161,14 @@ PingRequestHandler::processRequest(const YarpString &           request,
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
     ODL_P1("replyMechanism = ", replyMechanism); //####
-    bool result = true;
+    bool             result = true;
+    yarp::os::Bottle response;
 
     try
     {
         // Validate the name as a channel name
-        _response.clear();
-        if (1 == restOfInput.size())
+        if ((1 == restOfInput.size()) ||
+            ((2 == restOfInput.size()) && restOfInput.get(1).isDouble()))
         {
             yarp::os::Value argument(restOfInput.get(0));
 
@@ -178,15 +182,22 @@ PingRequestHandler::processRequest(const YarpString &           request,
 
                     theService.reportStatusChange(argAsString,
                                                   RegistryService::kRegistryPingFromService);
+                    if (2 == restOfInput.size())
+                    {
+                        theService.setRoundTripTimeForChannel(argAsString,
+                                                              restOfInput.get(1).asDouble());
+                    }
                     if (theService.checkForExistingService(argAsString))
                     {
                         // This service is already known, so just update the last-checked time.
+                        response.addString(MpM_OK_RESPONSE_);
                         theService.updateCheckedTimeForChannel(argAsString);
                     }
                     else if (theService.checkForExistingService(argAsString))
                     {
                         // Second try - something happened with the first call.
                         // This service is already known, so just update the last-checked time.
+                        response.addString(MpM_OK_RESPONSE_);
                         theService.updateCheckedTimeForChannel(argAsString);
                     }
                     else
@@ -220,24 +231,24 @@ PingRequestHandler::processRequest(const YarpString &           request,
                                                                            ServiceResponse(reply)))
                                                 {
                                                     // Remember the response
-                                                    _response.addString(MpM_OK_RESPONSE_);
+                                                    response.addString(MpM_OK_RESPONSE_);
                                                 theService.updateCheckedTimeForChannel(argAsString);
                                                 }
                                                 else
                                                 {
                                                     ODL_LOG("! (theService.processList" //####
                                                             "Response(argAsString, reply))"); //####
-                                                    _response.addString(MpM_FAILED_RESPONSE_);
-                                                    _response.addString("Invalid response to "
-                                                                        "'list' request");
+                                                    response.addString(MpM_FAILED_RESPONSE_);
+                                                    response.addString("Invalid response to "
+                                                                       "'list' request");
                                                 }
                                             }
                                             else
                                             {
                                                 ODL_LOG("! (outChannel->" //####
                                                         "writeBottle(message2, reply))"); //####
-                                                _response.addString(MpM_FAILED_RESPONSE_);
-                                                _response.addString("Could not write to channel");
+                                                response.addString(MpM_FAILED_RESPONSE_);
+                                                response.addString("Could not write to channel");
 #if defined(MpM_StallOnSendProblem)
                                                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -247,17 +258,17 @@ PingRequestHandler::processRequest(const YarpString &           request,
                                         {
                                             ODL_LOG("! (theService.processNameResponse(" //####
                                                     "argAsString, reply))"); //####
-                                            _response.addString(MpM_FAILED_RESPONSE_);
-                                            _response.addString("Invalid response to 'name' "
-                                                                "request");
+                                            response.addString(MpM_FAILED_RESPONSE_);
+                                            response.addString("Invalid response to 'name' "
+                                                               "request");
                                         }
                                     }
                                     else
                                     {
                                         ODL_LOG("! (outChannel->writeBottle(message1, " //####
                                                 "reply))"); //####
-                                        _response.addString(MpM_FAILED_RESPONSE_);
-                                        _response.addString("Could not write to channel");
+                                        response.addString(MpM_FAILED_RESPONSE_);
+                                        response.addString("Could not write to channel");
 #if defined(MpM_StallOnSendProblem)
                                         Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -277,9 +288,9 @@ PingRequestHandler::processRequest(const YarpString &           request,
                                 {
                                     ODL_LOG("! (outChannel->addOutputWithRetries(" //####
                                             "argAsString, STANDARD_WAIT_TIME_))"); //####
-                                    _response.addString(MpM_FAILED_RESPONSE_);
-                                    _response.addString("Could not connect to channel");
-                                    _response.addString(argAsString);
+                                    response.addString(MpM_FAILED_RESPONSE_);
+                                    response.addString("Could not connect to channel");
+                                    response.addString(argAsString);
                                 }
 #if defined(MpM_DoExplicitClose)
                                 outChannel->close();
@@ -289,8 +300,8 @@ PingRequestHandler::processRequest(const YarpString &           request,
                             {
                                 ODL_LOG("! (outChannel->openWithRetries(aName, " //####
                                         "STANDARD_WAIT_TIME_))"); //####
-                                _response.addString(MpM_FAILED_RESPONSE_);
-                                _response.addString("Channel could not be opened");
+                                response.addString(MpM_FAILED_RESPONSE_);
+                                response.addString("Channel could not be opened");
                             }
                             BaseChannel::RelinquishChannel(outChannel);
                         }
@@ -303,24 +314,25 @@ PingRequestHandler::processRequest(const YarpString &           request,
                 else
                 {
                     ODL_LOG("! (Endpoint::CheckEndpointName(argAsString))"); //####
-                    _response.addString(MpM_FAILED_RESPONSE_);
-                    _response.addString("Invalid channel name");
+                    response.addString(MpM_FAILED_RESPONSE_);
+                    response.addString("Invalid channel name");
                 }
             }
             else
             {
                 ODL_LOG("! (argument.isString())"); //####
-                _response.addString(MpM_FAILED_RESPONSE_);
-                _response.addString("Invalid channel name");
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid channel name");
             }
         }
         else
         {
-            ODL_LOG("! (1 == restOfInput.size())"); //####
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Missing channel name or extra arguments to request");
+            ODL_LOG("! ((1 == restOfInput.size()) || ((2 == restOfInput.size()) && " //####
+                    "restOfInput.get(1).isDouble()))"); //####
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Missing channel name or extra arguments to request");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -60,7 +60,8 @@ namespace MplusM
 
         /*! @brief The 'ping' request handler.
 
-         The input is the name of a service channel and the output is either 'OK', which indicates
+         The input is the name of a service channel, optionally followed by the round-trip time of
+         the previous 'ping' from the service, and the output is either 'OK', which indicates
          success, or 'FAILED' followed with a description of the reason for failure. */
         class PingRequestHandler : public Common::BaseRequestHandler
         {
@@ -99,6 +100,17 @@ namespace MplusM
             fillInDescription(const YarpString &   request,
                               yarp::os::Property & info);
 
+            /*! @brief Return @c true if the handler keeps no per-request state in its members, so
+             that several requests can use it at once.
+             @returns @c true, as the response is built per call, so that slow requests to
+             unfamiliar channels don't hold up the requests behind them. */
+            virtual inline bool
+            isReentrant(void)
+            const
+            {
+                return true;
+            } // isReentrant
+
             /*! @brief The assignment operator.
              @param[in] other The object to be copied.
              @returns The updated object. */
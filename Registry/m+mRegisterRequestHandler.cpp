@@ -167,12 +167,12 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
     ODL_P1("replyMechanism = ", replyMechanism); //####
-    bool result = true;
+    bool             result = true;
+    yarp::os::Bottle response;
 
     try
     {
         // Validate the name as a channel name
-        _response.clear();
         if (1 == restOfInput.size())
         {
             yarp::os::Value argument(restOfInput.get(0));
@@ -216,7 +216,7 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
                                                                            ServiceResponse(reply)))
                                             {
                                                 // Remember the response
-                                                _response.addString(MpM_OK_RESPONSE_);
+                                                response.addString(MpM_OK_RESPONSE_);
                                                 // If we're registering the Registry Service, we
                                                 // don't care about timeouts!
                                                 if (argAsString != MpM_REGISTRY_ENDPOINT_NAME_)
@@ -228,17 +228,17 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
                                             {
                                                 ODL_LOG("! (theService.processList" //####
                                                         "Response(argAsString, reply))"); //####
-                                                _response.addString(MpM_FAILED_RESPONSE_);
-                                                _response.addString("Invalid response to '"
-                                                                    MpM_LIST_REQUEST_ "' request");
+                                                response.addString(MpM_FAILED_RESPONSE_);
+                                                response.addString("Invalid response to '"
+                                                                   MpM_LIST_REQUEST_ "' request");
                                             }
                                         }
                                         else
                                         {
                                             ODL_LOG("! (outChannel->writeBottle(message2, " //####
                                                     "reply))"); //####
-                                            _response.addString(MpM_FAILED_RESPONSE_);
-                                            _response.addString("Could not write to channel");
+                                            response.addString(MpM_FAILED_RESPONSE_);
+                                            response.addString("Could not write to channel");
 #if defined(MpM_StallOnSendProblem)
                                             Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -248,16 +248,16 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
                                     {
                                         ODL_LOG("! (theService.processNameResponse(" //####
                                                 "argAsString, reply))"); //####
-                                        _response.addString(MpM_FAILED_RESPONSE_);
-                                        _response.addString("Invalid response to '"
-                                                            MpM_NAME_REQUEST_ "' request");
+                                        response.addString(MpM_FAILED_RESPONSE_);
+                                        response.addString("Invalid response to '"
+                                                           MpM_NAME_REQUEST_ "' request");
                                     }
                                 }
                                 else
                                 {
                                     ODL_LOG("! (outChannel->writeBottle(message1, reply))"); //####
-                                    _response.addString(MpM_FAILED_RESPONSE_);
-                                    _response.addString("Could not write to channel");
+                                    response.addString(MpM_FAILED_RESPONSE_);
+                                    response.addString("Could not write to channel");
 #if defined(MpM_StallOnSendProblem)
                                     Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -277,9 +277,9 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
                             {
                                 ODL_LOG("! (outChannel->addOutputWithRetries(" //####
                                         "argAsString, STANDARD_WAIT_TIME_))"); //####
-                                _response.addString(MpM_FAILED_RESPONSE_);
-                                _response.addString("Could not connect to channel");
-                                _response.addString(argAsString);
+                                response.addString(MpM_FAILED_RESPONSE_);
+                                response.addString("Could not connect to channel");
+                                response.addString(argAsString);
                             }
 #if defined(MpM_DoExplicitClose)
                             outChannel->close();
@@ -289,8 +289,8 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
                         {
                             ODL_LOG("! (outChannel->openWithRetries(aName, " //####
                                     "STANDARD_WAIT_TIME_))"); //####
-                            _response.addString(MpM_FAILED_RESPONSE_);
-                            _response.addString("Channel could not be opened");
+                            response.addString(MpM_FAILED_RESPONSE_);
+                            response.addString("Channel could not be opened");
                         }
                         BaseChannel::RelinquishChannel(outChannel);
                     }
@@ -302,24 +302,24 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
                 else
                 {
                     ODL_LOG("! (Endpoint::CheckEndpointName(argAsString))"); //####
-                    _response.addString(MpM_FAILED_RESPONSE_);
-                    _response.addString("Invalid channel name");
+                    response.addString(MpM_FAILED_RESPONSE_);
+                    response.addString("Invalid channel name");
                 }
             }
             else
             {
                 ODL_LOG("! (argument.isString())"); //####
-                _response.addString(MpM_FAILED_RESPONSE_);
-                _response.addString("Invalid channel name");
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid channel name");
             }
         }
         else
         {
             ODL_LOG("! (1 == restOfInput.size())"); //####
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Missing channel name or extra arguments to request");
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Missing channel name or extra arguments to request");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
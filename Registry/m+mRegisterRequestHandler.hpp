@@ -104,6 +104,17 @@ namespace MplusM
             fillInDescription(const YarpString &   request,
                               yarp::os::Property & info);
 
+            /*! @brief Return @c true if the handler keeps no per-request state in its members, so
+             that several requests can use it at once.
+             @returns @c true, as the response is built per call, so that slow requests to
+             unfamiliar channels don't hold up the requests behind them. */
+            virtual inline bool
+            isReentrant(void)
+            const
+            {
+                return true;
+            } // isReentrant
+
             /*! @brief The assignment operator.
              @param[in] other The object to be copied.
              @returns The updated object. */
@@ -38,10 +38,12 @@
 
 #include "m+mRegistryService.hpp"
 #include "m+mColumnNameValidator.hpp"
+#include "m+mInstancesRequestHandler.hpp"
 #include "m+mMatchRequestHandler.hpp"
 #include "m+mPingRequestHandler.hpp"
 #include "m+mRegisterRequestHandler.hpp"
 #include "m+mRegistryCheckThread.hpp"
+#include "m+mRoundTripsRequestHandler.hpp"
 #include "m+mUnregisterRequestHandler.hpp"
 
 #include <m+m/m+mClientChannel.hpp>
@@ -967,6 +969,48 @@ setupCheckService(sqlite3_stmt * statement,
     return result;
 } // setupCheckService
 
+/*! @brief Bind the values that are to be gathered from the Services table for a canonical name.
+ @param[in] statement The prepared statement that is to be updated.
+ @param[in] stuff The source of data that is to be bound.
+ @returns The SQLite error from the bind operation. */
+static int
+setupGetInstances(sqlite3_stmt * statement,
+                  const void *   stuff)
+{
+    ODL_ENTER(); //####
+    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
+    int result = SQLITE_MISUSE;
+
+    try
+    {
+        int nameIndex = sqlite3_bind_parameter_index(statement, "@" NAME_C_);
+
+        if (0 < nameIndex)
+        {
+            const char * nameString = static_cast<const char *>(stuff);
+
+            ODL_S1("nameString <- ", nameString); //####
+            result = sqlite3_bind_text(statement, nameIndex, nameString,
+                                       static_cast<int>(strlen(nameString)), SQLITE_TRANSIENT);
+            if (SQLITE_OK != result)
+            {
+                ODL_S1("error description: ", sqlite3_errstr(result)); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 < nameIndex)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_LL(result);
+    return result;
+} // setupGetInstances
+
 /*! @brief Bind the values that are to be inserted into the Channels table.
  @param[in] statement The prepared statement that is to be updated.
  @param[in] stuff The source of data that is to be bound.
@@ -1488,15 +1532,18 @@ RegistryService::RegistryService(const YarpString & launchPath,
                                  const YarpString & servicePortNumber) :
     inherited(kServiceKindRegistry, launchPath, argc, argv, "", true, MpM_REGISTRY_CANONICAL_NAME_,
               REGISTRY_SERVICE_DESCRIPTION_,
+              "instances - return the channels for the services with the given canonical name\n"
               "match - return the channels for services matching the criteria provided\n"
               "ping - update the last-pinged information for a channel or record the information "
               "for a service on the given channel\n"
               "register - record the information for a service on the given channel\n"
+              "roundTrips - return the most recent round-trip times reported by the services\n"
               "unregister - remove the information for a service on the given channel",
               MpM_REGISTRY_ENDPOINT_NAME_, servicePortNumber), _db(NULL),
-    _validator(new ColumnNameValidator), _matchHandler(NULL), _pingHandler(NULL),
-    _statusChannel(NULL), _registerHandler(NULL), _unregisterHandler(NULL),
-    _checker(NULL), _inMemory(useInMemoryDb), _isActive(false)
+    _validator(new ColumnNameValidator), _instancesHandler(NULL), _matchHandler(NULL),
+    _pingHandler(NULL), _statusChannel(NULL), _registerHandler(NULL), _roundTripsHandler(NULL),
+    _unregisterHandler(NULL), _checker(NULL), _statusSequence(0), _inMemory(useInMemoryDb),
+    _isActive(false)
 {
     ODL_ENTER(); //####
     ODL_S2s("launchPath = ", launchPath, "servicePortNumber = ", servicePortNumber); //####
@@ -1513,6 +1560,7 @@ RegistryService::~RegistryService(void)
     ODL_OBJENTER(); //####
     detachRequestHandlers();
     _lastCheckedTime.clear();
+    _roundTripTimes.clear();
     if (_db)
     {
         sqlite3_close(_db);
@@ -1684,6 +1732,8 @@ RegistryService::attachRequestHandlers(void)
     ODL_OBJENTER(); //####
     try
     {
+        ODL_LOG("got here");
+        _instancesHandler = new InstancesRequestHandler(*this);
         ODL_LOG("got here");
         _matchHandler = new MatchRequestHandler(*this, _validator);
         ODL_LOG("got here");
@@ -1691,9 +1741,14 @@ RegistryService::attachRequestHandlers(void)
         ODL_LOG("got here");
         _registerHandler = new RegisterRequestHandler(*this);
         ODL_LOG("got here");
+        _roundTripsHandler = new RoundTripsRequestHandler(*this);
+        ODL_LOG("got here");
         _unregisterHandler = new UnregisterRequestHandler(*this);
-        if (_matchHandler && _pingHandler && _registerHandler && _unregisterHandler)
+        if (_instancesHandler && _matchHandler && _pingHandler && _registerHandler &&
+            _roundTripsHandler && _unregisterHandler)
         {
+            ODL_LOG("got here");
+            registerRequestHandler(_instancesHandler);
             ODL_LOG("got here");
             registerRequestHandler(_matchHandler);
             ODL_LOG("got here");
@@ -1701,12 +1756,14 @@ RegistryService::attachRequestHandlers(void)
             ODL_LOG("got here");
             registerRequestHandler(_registerHandler);
             ODL_LOG("got here");
+            registerRequestHandler(_roundTripsHandler);
+            ODL_LOG("got here");
             registerRequestHandler(_unregisterHandler);
         }
         else
         {
-            ODL_LOG("! (_matchHandler && _pingHandler && _registerHandler && " //####
-                    "_unregisterHandler)"); //####
+            ODL_LOG("! (_instancesHandler && _matchHandler && _pingHandler && " //####
+                    "_registerHandler && _roundTripsHandler && _unregisterHandler)"); //####
         }
     }
     catch (...)
@@ -1801,6 +1858,12 @@ RegistryService::detachRequestHandlers(void)
     ODL_OBJENTER(); //####
     try
     {
+        if (_instancesHandler)
+        {
+            unregisterRequestHandler(_instancesHandler);
+            delete _instancesHandler;
+            _instancesHandler = NULL;
+        }
         if (_matchHandler)
         {
             unregisterRequestHandler(_matchHandler);
@@ -1819,6 +1882,12 @@ RegistryService::detachRequestHandlers(void)
             delete _registerHandler;
             _registerHandler = NULL;
         }
+        if (_roundTripsHandler)
+        {
+            unregisterRequestHandler(_roundTripsHandler);
+            delete _roundTripsHandler;
+            _roundTripsHandler = NULL;
+        }
         if (_unregisterHandler)
         {
             unregisterRequestHandler(_unregisterHandler);
@@ -1858,6 +1927,56 @@ RegistryService::enableMetrics(void)
     ODL_OBJEXIT(); //####
 } // RegistryService::enableMetrics
 
+bool
+RegistryService::fillInInstances(const YarpString & serviceName,
+                                 yarp::os::Bottle & channels)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("serviceName = ", serviceName); //####
+    ODL_P1("channels = ", &channels); //####
+    bool okSoFar = false;
+
+    try
+    {
+        if (doBeginTransaction(_db))
+        {
+            static const char * getInstances = T_("SELECT DISTINCT " CHANNELNAME_C_ " FROM "
+                                                  SERVICES_T_ " WHERE " NAME_C_ " = @" NAME_C_
+                                                  " ORDER BY " CHANNELNAME_C_);
+
+            okSoFar = performSQLstatementWithSingleColumnResults(_db, channels, getInstances, 0,
+                                                                 setupGetInstances,
+                                                 static_cast<const void *>(serviceName.c_str()));
+            okSoFar = doEndTransaction(_db, okSoFar);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // RegistryService::fillInInstances
+
+void
+RegistryService::fillInRoundTripTimes(yarp::os::Bottle & times)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("times = ", &times); //####
+    _checkedTimeLock.lock();
+    for (TimeMap::const_iterator walker(_roundTripTimes.begin()); _roundTripTimes.end() != walker;
+         ++walker)
+    {
+        yarp::os::Bottle & aPair = times.addList();
+
+        aPair.addString(walker->first);
+        aPair.addDouble(walker->second);
+    }
+    _checkedTimeLock.unlock();
+    ODL_OBJEXIT(); //####
+} // RegistryService::fillInRoundTripTimes
+
 void
 RegistryService::fillInSecondaryOutputChannelsList(ChannelVector & channels)
 {
@@ -2198,6 +2317,7 @@ RegistryService::removeCheckedTimeForChannel(const YarpString & serviceChannelNa
     ODL_OBJENTER(); //####
     _checkedTimeLock.lock();
     _lastCheckedTime.erase(serviceChannelName);
+    _roundTripTimes.erase(serviceChannelName);
     _checkedTimeLock.unlock();
     ODL_OBJEXIT(); //####
 } // RegistryService::removeCheckedTimeForChannel
@@ -2344,6 +2464,10 @@ RegistryService::reportStatusChange(const YarpString &  channelName,
                 break;
 
         }
+        // The sequence number lets listeners, such as the discovery cache of a client, detect that
+        // they have missed a status change.
+        _statusLock.lock();
+        message.addInt(++_statusSequence);
         if (! _statusChannel->writeBottle(message))
         {
             ODL_LOG("(! _statusChannel->writeBottle(message))"); //####
@@ -2351,10 +2475,24 @@ RegistryService::reportStatusChange(const YarpString &  channelName,
             Stall();
 #endif // defined(MpM_StallOnSendProblem)
         }
+        _statusLock.unlock();
     }
     ODL_OBJEXIT(); //####
 } // RegistryService::reportStatusChange
 
+void
+RegistryService::setRoundTripTimeForChannel(const YarpString & serviceChannelName,
+                                            const double       roundTripTime)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("serviceChannelName = ", serviceChannelName); //####
+    ODL_D1("roundTripTime = ", roundTripTime); //####
+    _checkedTimeLock.lock();
+    _roundTripTimes[serviceChannelName] = roundTripTime;
+    _checkedTimeLock.unlock();
+    ODL_OBJEXIT(); //####
+} // RegistryService::setRoundTripTimeForChannel
+
 bool
 RegistryService::setUpDatabase(void)
 {
@@ -2441,7 +2579,7 @@ RegistryService::setUpStatusChannel(void)
             }
             if (_statusChannel->openWithRetries(outputName, STANDARD_WAIT_TIME_))
             {
-                _statusChannel->setProtocol("s+", "One or more strings");
+                _statusChannel->setProtocol("s+i", "One or more strings and a sequence number");
                 okSoFar = true;
             }
             else
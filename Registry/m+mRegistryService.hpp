@@ -68,10 +68,12 @@ namespace MplusM
     namespace Registry
     {
         class ColumnNameValidator;
+        class InstancesRequestHandler;
         class MatchRequestHandler;
         class PingRequestHandler;
         class RegisterRequestHandler;
         class RegistryCheckThread;
+        class RoundTripsRequestHandler;
         class UnregisterRequestHandler;
 
         /*! @brief The characteristics of a request. */
@@ -190,6 +192,21 @@ namespace MplusM
             virtual void
             enableMetrics(void);
 
+            /*! @brief Fill in the service channels that are registered under a canonical service
+             name.
+             @param[in] serviceName The canonical name shared by the instances.
+             @param[in,out] channels The list to be filled in with the service channels.
+             @returns @c true if the database was successfully searched and @c false otherwise. */
+            bool
+            fillInInstances(const YarpString & serviceName,
+                            yarp::os::Bottle & channels);
+
+            /*! @brief Fill in the most recent round-trip times reported by the services.
+             @param[in,out] times The list to be filled in with service channel and round-trip time
+             pairs. */
+            void
+            fillInRoundTripTimes(yarp::os::Bottle & times);
+
             /*! @brief Fill in a list of secondary output channels for the service.
              @param[in,out] channels The list of channels to be filled in. */
             virtual void
@@ -240,7 +257,7 @@ namespace MplusM
             processNameResponse(const YarpString &              channelName,
                                 const Common::ServiceResponse & response);
 
-            /*! @brief Remove the last checked time for a service channel.
+            /*! @brief Remove the last checked time and round-trip time for a service channel.
              @param[in] serviceChannelName The service channel that is being removed. */
             void
             removeCheckedTimeForChannel(const YarpString & serviceChannelName);
@@ -260,6 +277,13 @@ namespace MplusM
                                const ServiceStatus newStatus,
                                const YarpString &  details = "");
 
+            /*! @brief Record the most recent round-trip time reported by a service channel.
+             @param[in] serviceChannelName The service channel that is being updated.
+             @param[in] roundTripTime The round-trip time, in seconds. */
+            void
+            setRoundTripTimeForChannel(const YarpString & serviceChannelName,
+                                       const double       roundTripTime);
+
             /*! @brief Start processing requests.
              @returns @c true if the service was started and @c false if it was not. */
             virtual bool
@@ -359,15 +383,24 @@ namespace MplusM
             /*! @brief The last time that a channel 'checked-in'. */
             TimeMap _lastCheckedTime;
 
+            /*! @brief The most recent round-trip time reported by each channel. */
+            TimeMap _roundTripTimes;
+
             /*! @brief The contention lock used to avoid inconsistencies. */
             yarp::os::Mutex _checkedTimeLock;
 
+            /*! @brief The contention lock used to keep the status messages in sequence. */
+            yarp::os::Mutex _statusLock;
+
             /*! @brief The %Registry Service database. */
             sqlite3 * _db;
 
             /*! @brief The validator function object that the %Registry Service will use. */
             ColumnNameValidator * _validator;
 
+            /*! @brief The request handler for the 'instances' request. */
+            InstancesRequestHandler * _instancesHandler;
+
             /*! @brief The request handler for the 'match' request. */
             MatchRequestHandler * _matchHandler;
 
@@ -380,12 +413,19 @@ namespace MplusM
             /*! @brief The request handler for the 'register' request. */
             RegisterRequestHandler * _registerHandler;
 
+            /*! @brief The request handler for the 'roundTrips' request. */
+            RoundTripsRequestHandler * _roundTripsHandler;
+
             /*! @brief The request handler for the 'unregister' request. */
             UnregisterRequestHandler * _unregisterHandler;
 
             /*! @brief The object used to generate 'checks' for the service. */
             RegistryCheckThread * _checker;
 
+            /*! @brief The sequence number of the most recent status message, so that listeners
+             can detect missed messages. */
+            int _statusSequence;
+
             /*! @brief @c true if the database is in-memory and @c false if it is disk-based. */
             bool _inMemory;
 
@@ -398,7 +438,7 @@ namespace MplusM
 #  pragma clang diagnostic ignored "-Wunused-private-field"
 # endif // defined(__APPLE__)
             /*! @brief Filler to pad to alignment boundary */
-            char _filler[6];
+            char _filler[2];
 # if defined(__APPLE__)
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
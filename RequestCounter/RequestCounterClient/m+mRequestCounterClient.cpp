@@ -75,6 +75,36 @@ using namespace MplusM::RequestCounter;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Receive the response to an asynchronous poke of the service.
+ @param[in] correlationId The identifier of the request.
+ @param[in] response The response to the request.
+ @param[in] responseStuff Private data for the function. */
+static void
+pokeResponseReceived(const int                correlationId,
+                     const yarp::os::Bottle & response,
+                     void *                   responseStuff)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(correlationId,response,responseStuff)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_LL1("correlationId = ", correlationId); //####
+    ODL_S1s("response = ", response.toString()); //####
+    ODL_P1("responseStuff = ", responseStuff); //####
+    // The response carries no information; it only indicates that the service has handled the
+    // request.
+    ODL_EXIT(); //####
+} // pokeResponseReceived
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -180,6 +210,35 @@ RequestCounterClient::pokeService(void)
     return okSoFar;
 } // RequestCounterClient::pokeService
 
+bool
+RequestCounterClient::pokeServiceAsync(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = false;
+
+    try
+    {
+        yarp::os::Bottle parameters;
+
+        if (sendAsync("blarg_blerg_blirg_blorg_blurg", parameters, pokeResponseReceived))
+        {
+            okSoFar = true;
+        }
+        else
+        {
+            ODL_LOG("! (sendAsync(\"blarg_blerg_blirg_blorg_blurg\", parameters, " //####
+                    "pokeResponseReceived))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // RequestCounterClient::pokeServiceAsync
+
 bool
 RequestCounterClient::resetServiceCounters(void)
 {
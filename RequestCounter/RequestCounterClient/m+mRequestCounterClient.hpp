@@ -91,6 +91,12 @@ namespace MplusM
             bool
             pokeService(void);
 
+            /*! @brief Trigger the service counter, without waiting for the service to handle the
+             request.
+             @returns @c true if the request was sent and @c false otherwise. */
+            bool
+            pokeServiceAsync(void);
+
             /*! @brief Reset the service counters.
              @returns @c true if the service handled the request and @c false otherwise. */
             bool
@@ -38,6 +38,7 @@
 
 #include "m+mRequestCounterClient.hpp"
 
+#include <m+m/m+mIntArgumentDescriptor.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -128,16 +129,69 @@ reportTimeInReasonableUnits(const double measurement)
     cout << newValue << tag;
 } // reportTimeInReasonableUnits
 
-/*! @brief Set up the environment and perform the operation. */
+/*! @brief Send requests to the service, keeping no more than a given number of them in flight, and
+ report the sustained rate of requests.
+ @param[in] aClient The client to be used.
+ @param[in] count The number of requests to send.
+ @param[in] window The largest number of requests that can be waiting for responses.
+ @returns @c true if the service handled all the requests and @c false otherwise. */
+static bool
+pokeWithWindow(RequestCounterClient & aClient,
+               const int              count,
+               const int              window)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aClient = ", &aClient); //####
+    ODL_LL2("count = ", count, "window = ", window); //####
+    bool   okSoFar = aClient.resetServiceCounters();
+    double startTime = yarp::os::Time::now();
+
+    for (int ii = 0; okSoFar && (ii < count); ++ii)
+    {
+        // Wait for room in the window before sending the next request.
+        if (aClient.waitForAsyncRequests(window - 1, STANDARD_WAIT_TIME_))
+        {
+            okSoFar = aClient.pokeServiceAsync();
+        }
+        else
+        {
+            okSoFar = false;
+        }
+    }
+    if (okSoFar)
+    {
+        okSoFar = aClient.waitForAsyncRequests(0, STANDARD_WAIT_TIME_);
+    }
+    if (okSoFar)
+    {
+        double elapsedTime = yarp::os::Time::now() - startTime;
+
+        cout << "window = " << window << ", count = " << count << ", elapsed time = ";
+        reportTimeInReasonableUnits(elapsedTime);
+        if (0 < elapsedTime)
+        {
+            cout << ", requests per second = " << (count / elapsedTime);
+        }
+        cout << "." << endl;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // pokeWithWindow
+
+/*! @brief Set up the environment and perform the operation.
+ @param[in] window The largest number of requests to keep in flight, or zero if each request is
+ to be sent after the previous one has been handled. */
 #if defined(MpM_ReportOnConnections)
 static void
-setUpAndGo(ChannelStatusReporter * reporter)
+setUpAndGo(const int               window,
+           ChannelStatusReporter * reporter)
 #else // ! defined(MpM_ReportOnConnections)
 static void
-setUpAndGo(void)
+setUpAndGo(const int window)
 #endif // ! defined(MpM_ReportOnConnections)
 {
     ODL_ENTER(); //####
+    ODL_LL1("window = ", window); //####
 #if defined(MpM_ReportOnConnections)
     ODL_P1("reporter = ", reporter); //####
 #endif // defined(MpM_ReportOnConnections)
@@ -148,6 +202,11 @@ setUpAndGo(void)
 #if defined(MpM_ReportOnConnections)
         aClient->setReporter(*reporter, true);
 #endif // defined(MpM_ReportOnConnections)
+        // The service is looked up again for each set of requests, so the lookups are cached.
+        if (! SetUpDiscoveryCache())
+        {
+            ODL_LOG("(! SetUpDiscoveryCache())"); //####
+        }
         StartRunning();
         SetSignalHandlers(SignalRunningStop);
         for ( ; IsRunning(); )
@@ -166,7 +225,30 @@ setUpAndGo(void)
             {
                 if (aClient->connectToService())
                 {
-                    if (aClient->resetServiceCounters())
+                    if (0 < window)
+                    {
+                        // Report the rate for windows that double in size, up to the largest.
+                        for (int size = 1; ; size *= 2)
+                        {
+                            if (size > window)
+                            {
+                                size = window;
+                            }
+                            if (! pokeWithWindow(*aClient, count, size))
+                            {
+                                ODL_LOG("(! pokeWithWindow(*aClient, count, size))"); //####
+                                MpM_FAIL_("Problem poking the service.");
+                                break;
+                            }
+
+                            if (size == window)
+                            {
+                                break;
+                            }
+
+                        }
+                    }
+                    else if (aClient->resetServiceCounters())
                     {
                         for (int ii = 0; ii < count; ++ii)
                         {
@@ -225,6 +307,7 @@ setUpAndGo(void)
                 MpM_FAIL_(MSG_COULD_NOT_FIND_SERVICE);
             }
         }
+        ShutDownDiscoveryCache();
         delete aClient;
     }
     else
@@ -245,7 +328,9 @@ setUpAndGo(void)
 /*! @brief The entry point for communicating with the Request Counter service.
 
  Integers read from standard input will be sent to the service as the number of requests to
- simulate. Entering a zero will exit the program.
+ simulate. Entering a zero will exit the program. If a window size is given, the requests are sent
+ asynchronously, with up to that many requests in flight, and the sustained rate of requests is
+ reported.
  @param[in] argc The number of arguments in 'argv'.
  @param[in] argv The arguments to be used with the application.
  @returns @c 0 on a successful test and @c 1 on failure. */
@@ -267,9 +352,15 @@ main(int      argc,
 #endif // MAC_OR_LINUX_
     try
     {
-        Utilities::DescriptorVector argumentList;
-        OutputFlavour               flavour;
+        Utilities::IntArgumentDescriptor firstArg("window", T_("The largest number of requests "
+                                                               "to keep in flight, or zero to "
+                                                               "send one at a time"),
+                                                  Utilities::kArgModeOptional, 0, true, 0, false,
+                                                  0);
+        Utilities::DescriptorVector      argumentList;
+        OutputFlavour                    flavour;
 
+        argumentList.push_back(&firstArg);
         if (Utilities::ProcessStandardClientOptions(argc, argv, argumentList,
                                                     "The client for the Request Counter service",
                                                     2014, STANDARD_COPYRIGHT_NAME_, flavour, true))
@@ -290,9 +381,9 @@ main(int      argc,
                     if (Utilities::CheckForRegistryService())
                     {
 #if defined(MpM_ReportOnConnections)
-                        setUpAndGo(reporter);
+                        setUpAndGo(firstArg.getCurrentValue(), reporter);
 #else // ! defined(MpM_ReportOnConnections)
-                        setUpAndGo();
+                        setUpAndGo(firstArg.getCurrentValue());
 #endif // ! defined(MpM_ReportOnConnections)
                     }
                     else
@@ -0,0 +1,121 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mSendToMQMessageSink.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the destination of outbound SendToMQ messages.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMSendToMQMessageSink_HPP_))
+# define MpMSendToMQMessageSink_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the destination of outbound %SendToMQ messages. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace SendToMQ
+    {
+        /*! @brief The destination for messages that have been assembled by the sender thread.
+
+         The %SendToMQ output service delivers the messages to the ActiveMQ broker; the unit tests
+         use an in-process stand-in. */
+        class SendToMQMessageSink
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            inline
+            SendToMQMessageSink(void)
+            {
+            } // constructor
+
+            /*! @brief The destructor. */
+            virtual inline
+            ~SendToMQMessageSink(void)
+            {
+            } // destructor
+
+            /*! @brief Deliver a message to the broker.
+
+             This is called from the sender thread, never from the thread that received the input.
+             @param[in] aMessage The message to deliver.
+             @param[in] messageLength The length of the message.
+             @returns @c true if the message was delivered and @c false otherwise. */
+            virtual bool
+            deliverMessage(const std::string & aMessage,
+                           const size_t        messageLength) = 0;
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            SendToMQMessageSink(const SendToMQMessageSink & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            SendToMQMessageSink &
+            operator =(const SendToMQMessageSink & other);
+
+        public :
+
+        protected :
+
+        private :
+
+        }; // SendToMQMessageSink
+
+    } // SendToMQ
+
+} // MplusM
+
+#endif // ! defined(MpMSendToMQMessageSink_HPP_)
@@ -148,10 +148,8 @@ SendToMQOutputInputHandler::handleInput(const yarp::os::Bottle &     input,
             if (buffAsString.length())
             {
                 ODL_LOG("(buffAsString.length())"); //####
-                SendReceiveCounters toBeAdded(0, 0, outLength, 1);
-
+                // The auxiliary counters are updated when the message reaches the broker.
                 _owner.sendMessage(buffAsString, outLength);
-                _owner.incrementAuxiliaryCounters(toBeAdded);
             }
         }
     }
@@ -59,4 +59,37 @@
 /*! @brief The default port number to be used. */
 # define SENDTOMQOUTPUT_DEFAULT_PORT_ 61616
 
+/*! @brief The default maximum size, in bytes, of a combined broker message. */
+# define SENDTOMQOUTPUT_DEFAULT_BATCH_BYTES_ 65536
+
+/*! @brief The default maximum time, in seconds, that a record is held for a combined message. */
+# define SENDTOMQOUTPUT_DEFAULT_BATCH_LATENCY_ 0.05
+
+/*! @brief The default maximum number of records waiting to be sent. */
+# define SENDTOMQOUTPUT_DEFAULT_QUEUE_LENGTH_ 1000
+
+/*! @brief The metrics key for the number of records waiting to be sent. */
+# define MpM_SENDTOMQOUTPUT_QUEUEDEPTH_     "queueDepth"
+
+/*! @brief The metrics key for the largest number of records that have been waiting. */
+# define MpM_SENDTOMQOUTPUT_QUEUEHIGHWATER_ "queueHighWater"
+
+/*! @brief The metrics key for the number of records discarded because the queue was full. */
+# define MpM_SENDTOMQOUTPUT_DROPPED_        "dropped"
+
+/*! @brief The metrics key for the number of broker messages that could not be delivered. */
+# define MpM_SENDTOMQOUTPUT_FAILED_         "failed"
+
+/*! @brief The metrics key for the mean time from a record being queued to it being sent. */
+# define MpM_SENDTOMQOUTPUT_MEANLATENCY_    "meanLatency"
+
+/*! @brief The metrics key for the longest time from a record being queued to it being sent. */
+# define MpM_SENDTOMQOUTPUT_MAXLATENCY_     "maxLatency"
+
+/*! @brief The metrics key for the mean time spent in delivering a broker message. */
+# define MpM_SENDTOMQOUTPUT_MEANSENDTIME_   "meanSendTime"
+
+/*! @brief The metrics key for the longest time spent in delivering a broker message. */
+# define MpM_SENDTOMQOUTPUT_MAXSENDTIME_    "maxSendTime"
+
 #endif // ! defined(MpMSendToMQOutputRequests_HPP_)
@@ -121,7 +121,11 @@ inherited(argumentList, launchPath, argc, argv, tag, true, MpM_SENDTOMQOUTPUT_CA
           SENDTOMQOUTPUT_SERVICE_DESCRIPTION_, "", serviceEndpointName, servicePortNumber),
     _hostName(hostName), _password(userPassword), _userName(userName), _hostPort(hostPort),
     _inHandler(new SendToMQOutputInputHandler(*this)), _connection(NULL), _session(NULL),
-    _destination(NULL), _producer(NULL), _useQueue(false)
+    _destination(NULL), _producer(NULL), _sender(NULL),
+    _maxBatchLatency(SENDTOMQOUTPUT_DEFAULT_BATCH_LATENCY_),
+    _maxBatchBytes(SENDTOMQOUTPUT_DEFAULT_BATCH_BYTES_),
+    _maxQueueLength(SENDTOMQOUTPUT_DEFAULT_QUEUE_LENGTH_), _batchFormat(kBatchFormatNone),
+    _useQueue(false)
 {
     ODL_ENTER(); //####
     ODL_S4s("hostName = ", hostName, "userName = ", userName, "userPassword = ", //####
@@ -159,7 +163,49 @@ SendToMQOutputService::configure(const yarp::os::Bottle & details)
             yarp::os::Value firstValue(details.get(0));
             yarp::os::Value secondValue(details.get(1));
 
-            if (firstValue.isString() && secondValue.isInt())
+            bool            inRange = true;
+            bool            okSoFar = (firstValue.isString() && secondValue.isInt());
+
+            // The batching values are optional, to allow older configurations to be used.
+            if (okSoFar && (6 <= details.size()))
+            {
+                yarp::os::Value thirdValue(details.get(2));
+                yarp::os::Value fourthValue(details.get(3));
+                yarp::os::Value fifthValue(details.get(4));
+                yarp::os::Value sixthValue(details.get(5));
+
+                if (thirdValue.isInt() && fourthValue.isInt() && fifthValue.isDouble() &&
+                    sixthValue.isInt())
+                {
+                    int    thirdNumber = thirdValue.asInt();
+                    int    fourthNumber = fourthValue.asInt();
+                    double fifthNumber = fifthValue.asDouble();
+                    int    sixthNumber = sixthValue.asInt();
+
+                    if ((kBatchFormatNone <= thirdNumber) &&
+                        (kBatchFormatNewlineDelimited >= thirdNumber) && (0 < fourthNumber) &&
+                        (0 <= fifthNumber) && (0 < sixthNumber))
+                    {
+                        _batchFormat = static_cast<BatchFormat>(thirdNumber);
+                        _maxBatchBytes = static_cast<size_t>(fourthNumber);
+                        _maxBatchLatency = fifthNumber;
+                        _maxQueueLength = static_cast<size_t>(sixthNumber);
+                        ODL_LL3("_batchFormat <- ", _batchFormat, "_maxBatchBytes <- ", //####
+                                _maxBatchBytes, "_maxQueueLength <- ", _maxQueueLength); //####
+                        ODL_D1("_maxBatchLatency <- ", _maxBatchLatency); //####
+                    }
+                    else
+                    {
+                        cerr << "One or more inputs are out of range." << endl;
+                        inRange = okSoFar = false;
+                    }
+                }
+                else
+                {
+                    okSoFar = false;
+                }
+            }
+            if (okSoFar)
             {
                 int               secondNumber = secondValue.asInt();
                 std::stringstream buff;
@@ -172,11 +218,28 @@ SendToMQOutputService::configure(const yarp::os::Bottle & details)
                 buff << "Host name is '" << _hostName.c_str() << "', host port is " << _hostPort <<
                         ", user name is '" << _userName << "', topic/queue name is '" <<
                         _topicOrQueueName << "', send via " << (_useQueue ? "queue" : "topic") <<
-                        ".";
+                        ", batching is ";
+                switch (_batchFormat)
+                {
+                    case kBatchFormatJSONArray :
+                        buff << "JSON array";
+                        break;
+
+                    case kBatchFormatNewlineDelimited :
+                        buff << "newline-delimited";
+                        break;
+
+                    default :
+                        buff << "off";
+                        break;
+
+                }
+                buff << ", batch size is " << _maxBatchBytes << ", batch latency is " <<
+                        _maxBatchLatency << ", queue length is " << _maxQueueLength << ".";
                 setExtraInformation(buff.str());
                 result = true;
             }
-            else
+            else if (inRange)
             {
                 cerr << "One or more inputs have the wrong type." << endl;
             }
@@ -229,6 +292,10 @@ SendToMQOutputService::getConfiguration(yarp::os::Bottle & details)
     details.clear();
     details.addString(_topicOrQueueName);
     details.addInt(_useQueue ? 1 : 0);
+    details.addInt(_batchFormat);
+    details.addInt(static_cast<int>(_maxBatchBytes));
+    details.addDouble(_maxBatchLatency);
+    details.addInt(static_cast<int>(_maxQueueLength));
     ODL_OBJEXIT_B(result); //####
     return result;
 } // SendToMQOutputService::getConfiguration
@@ -239,6 +306,17 @@ SendToMQOutputService::deactivateConnection(void)
     ODL_ENTER(); //####
     clearActive();
     cerr << "connection is dead" << endl; //!!!!
+    _senderLock.lock();
+    SendToMQOutputThread * oldSender = _sender;
+
+    _sender = NULL;
+    _senderLock.unlock();
+    if (oldSender)
+    {
+        // Let the sender deliver what it is holding before the connection goes away.
+        oldSender->stop();
+        delete oldSender;
+    }
     if (_connection)
     {
         try
@@ -269,23 +347,26 @@ SendToMQOutputService::deactivateConnection(void)
     ODL_EXIT(); //####
 } // SendToMQOutputService::deactivateConnection
 
-void
-SendToMQOutputService::sendMessage(const std::string & aMessage,
-                                   const size_t        messageLength)
+bool
+SendToMQOutputService::deliverMessage(const std::string & aMessage,
+                                      const size_t        messageLength)
 {
     ODL_OBJENTER(); //####
     ODL_S1s("aMessage = ", aMessage); //####
     ODL_LL1("messageLength = ", messageLength); //####
+    bool result = false;
+
     try
     {
-        if (isActive())
+        if (_session && _producer)
         {
-            ODL_LOG("(isActive())"); //####
+            ODL_LOG("(_session && _producer)"); //####
             Common::SendReceiveCounters     newCount(0, 0, messageLength, 1);
             std::auto_ptr<cms::TextMessage> stuff(_session->createTextMessage(aMessage));
 
-            incrementAuxiliaryCounters(newCount);
             _producer->send(stuff.get());
+            incrementAuxiliaryCounters(newCount);
+            result = true;
         }
     }
     catch (cms::CMSException & ex)
@@ -297,8 +378,93 @@ SendToMQOutputService::sendMessage(const std::string & aMessage,
         ODL_LOG("Exception caught"); //####
         throw;
     }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SendToMQOutputService::deliverMessage
+
+void
+SendToMQOutputService::gatherMetrics(yarp::os::Bottle & metrics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("metrics = ", &metrics); //####
+    inherited::gatherMetrics(metrics);
+    _senderLock.lock();
+    if (_sender)
+    {
+        SendToMQOutputStatistics statistics;
+
+        _sender->getStatistics(statistics);
+        _senderLock.unlock();
+        SendReceiveCounters counters(statistics._bytesQueued,
+                                     static_cast<size_t>(statistics._recordsQueued),
+                                     statistics._bytesSent,
+                                     static_cast<size_t>(statistics._messagesSent));
+
+        counters.addToList(metrics, getEndpoint().getName() + "/sender");
+        yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+        if (props)
+        {
+            props->put(MpM_SENDTOMQOUTPUT_QUEUEDEPTH_, static_cast<int>(statistics._queueDepth));
+            props->put(MpM_SENDTOMQOUTPUT_QUEUEHIGHWATER_,
+                       static_cast<int>(statistics._queueHighWater));
+            props->put(MpM_SENDTOMQOUTPUT_DROPPED_, static_cast<int>(statistics._recordsDropped));
+            props->put(MpM_SENDTOMQOUTPUT_FAILED_, static_cast<int>(statistics._messagesFailed));
+            props->put(MpM_SENDTOMQOUTPUT_MEANLATENCY_, statistics._meanRecordLatency);
+            props->put(MpM_SENDTOMQOUTPUT_MAXLATENCY_, statistics._maxRecordLatency);
+            props->put(MpM_SENDTOMQOUTPUT_MEANSENDTIME_, statistics._meanSendTime);
+            props->put(MpM_SENDTOMQOUTPUT_MAXSENDTIME_, statistics._maxSendTime);
+        }
+    }
+    else
+    {
+        _senderLock.unlock();
+    }
+    ODL_OBJEXIT(); //####
+} // SendToMQOutputService::gatherMetrics
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+void
+SendToMQOutputService::sendMessage(const std::string & aMessage,
+                                   const size_t        messageLength)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(messageLength)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S1s("aMessage = ", aMessage); //####
+    ODL_LL1("messageLength = ", messageLength); //####
+    // The lock keeps deactivateConnection() from releasing the sender while the message is
+    // being added.
+    _senderLock.lock();
+    try
+    {
+        if (isActive() && _sender)
+        {
+            ODL_LOG("(isActive() && _sender)"); //####
+            if (! _sender->addRecord(aMessage))
+            {
+                ODL_LOG("(! _sender->addRecord(aMessage))"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        _senderLock.unlock();
+        throw;
+    }
+    _senderLock.unlock();
     ODL_OBJEXIT(); //####
 } // SendToMQOutputService::sendMessage
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
 
 bool
 SendToMQOutputService::setUpStreamDescriptions(void)
@@ -399,6 +565,27 @@ SendToMQOutputService::startStreams(void)
             {
                 ODL_LOG("(_producer)"); //####
                 _producer->setDeliveryMode(cms::DeliveryMode::NON_PERSISTENT);
+                SendToMQOutputThread * newSender = new SendToMQOutputThread(*this, _batchFormat,
+                                                                            _maxQueueLength,
+                                                                            _maxBatchBytes,
+                                                                            _maxBatchLatency);
+
+                if (newSender->start())
+                {
+                    _senderLock.lock();
+                    _sender = newSender;
+                    _senderLock.unlock();
+                }
+                else
+                {
+                    ODL_LOG("! (newSender->start())"); //####
+                    cerr << "Could not start sender thread." << endl;
+                    delete newSender;
+                }
+            }
+            if (_sender)
+            {
+                ODL_LOG("(_sender)"); //####
                 if (_inHandler)
                 {
                     _inHandler->setChannel(getInletStream(0));
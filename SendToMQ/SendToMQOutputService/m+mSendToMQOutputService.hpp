@@ -39,6 +39,9 @@
 #if (! defined(MpMSendToMQOutputService_HPP_))
 # define MpMSendToMQOutputService_HPP_ /* Header guard */
 
+# include "m+mSendToMQMessageSink.hpp"
+# include "m+mSendToMQOutputThread.hpp"
+
 # include <m+m/m+mBaseOutputService.hpp>
 # include <m+m/m+mUtilities.hpp>
 
@@ -76,8 +79,9 @@ namespace MplusM
     {
         class SendToMQOutputInputHandler;
 
-        /*! @brief The %Blob output service. */
-        class SendToMQOutputService : public Common::BaseOutputService
+        /*! @brief The %SendToMQ output service. */
+        class SendToMQOutputService : public Common::BaseOutputService,
+                                      public SendToMQMessageSink
         {
         public :
 
@@ -128,6 +132,16 @@ namespace MplusM
             void
             deactivateConnection(void);
 
+            /*! @brief Deliver a message to the broker.
+
+             This is called from the sender thread, never from the thread that received the input.
+             @param[in] aMessage The message to deliver.
+             @param[in] messageLength The length of the message.
+             @returns @c true if the message was delivered and @c false otherwise. */
+            virtual bool
+            deliverMessage(const std::string & aMessage,
+                           const size_t        messageLength);
+
             /*! @brief Turn off the send / receive metrics collecting. */
             virtual void
             disableMetrics(void);
@@ -136,6 +150,11 @@ namespace MplusM
             virtual void
             enableMetrics(void);
 
+            /*! @brief Fill in the metrics for the service.
+             @param[in,out] metrics The gathered metrics. */
+            virtual void
+            gatherMetrics(yarp::os::Bottle & metrics);
+
             /*! @brief Get the configuration of the input/output streams.
              @param[out] details The configuration information for the input/output streams.
              @returns @c true if the configuration was successfully retrieved and @c false
@@ -143,7 +162,9 @@ namespace MplusM
             virtual bool
             getConfiguration(yarp::os::Bottle & details);
 
-            /*! @brief Send a message via ActiveMQ.
+            /*! @brief Queue a message to be sent via ActiveMQ.
+
+             The message is sent by the sender thread, so this does not wait for the broker.
              @param[in] aMessage The message to send.
              @param[in] messageLength The length of the message. */
             void
@@ -217,6 +238,26 @@ namespace MplusM
             /*! @brief The message producer that works with the active session. */
             cms::MessageProducer * _producer;
 
+            /*! @brief The contention lock that keeps the sender thread from being released while
+             a message is being added to it. */
+            yarp::os::Mutex _senderLock;
+
+            /*! @brief The thread that delivers the queued messages to the broker. */
+            SendToMQOutputThread * _sender;
+
+            /*! @brief The maximum time, in seconds, that a message is held for a combined
+             message. */
+            double _maxBatchLatency;
+
+            /*! @brief The maximum size, in bytes, of a combined broker message. */
+            size_t _maxBatchBytes;
+
+            /*! @brief The maximum number of messages waiting to be sent. */
+            size_t _maxQueueLength;
+
+            /*! @brief How queued messages are combined into broker messages. */
+            BatchFormat _batchFormat;
+
             /*! @brief If @c true, use a queue for transmission else use a topic. */
             bool _useQueue;
 
@@ -225,7 +266,7 @@ namespace MplusM
 #  pragma clang diagnostic ignored "-Wunused-private-field"
 # endif // defined(__APPLE__)
             /*! @brief Filler to pad to alignment boundary */
-            char _filler[7];
+            char _filler[3];
 # if defined(__APPLE__)
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
@@ -41,7 +41,9 @@
 
 #include <m+m/m+mAddressArgumentDescriptor.hpp>
 #include <m+m/m+mBoolArgumentDescriptor.hpp>
+#include <m+m/m+mDoubleArgumentDescriptor.hpp>
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mIntArgumentDescriptor.hpp>
 #include <m+m/m+mPortArgumentDescriptor.hpp>
 
 //#include <odlEnable.h>
@@ -206,6 +208,29 @@ main(int      argc,
         Utilities::BoolArgumentDescriptor    sixthArg("isQueue",
                                                       T_("Send via a queue (versus a topic)"),
                                                       Utilities::kArgModeOptionalModifiable, false);
+        Utilities::IntArgumentDescriptor     seventhArg("batchFormat",
+                                                        T_("Combine messages: 0 = no, 1 = as a "
+                                                           "JSON array, 2 = one per line"),
+                                                        Utilities::kArgModeOptionalModifiable,
+                                                        kBatchFormatNone, true, kBatchFormatNone,
+                                                        true, kBatchFormatNewlineDelimited);
+        Utilities::IntArgumentDescriptor     eighthArg("batchBytes",
+                                                       T_("Maximum size of a combined message"),
+                                                       Utilities::kArgModeOptionalModifiable,
+                                                       SENDTOMQOUTPUT_DEFAULT_BATCH_BYTES_, true, 1,
+                                                       false, 0);
+        Utilities::DoubleArgumentDescriptor  ninthArg("batchLatency",
+                                                      T_("Maximum seconds to hold a message for "
+                                                         "combining"),
+                                                      Utilities::kArgModeOptionalModifiable,
+                                                      SENDTOMQOUTPUT_DEFAULT_BATCH_LATENCY_, true, 0,
+                                                      false, 0);
+        Utilities::IntArgumentDescriptor     tenthArg("queueLength",
+                                                      T_("Maximum number of messages waiting to be "
+                                                         "sent"),
+                                                      Utilities::kArgModeOptionalModifiable,
+                                                      SENDTOMQOUTPUT_DEFAULT_QUEUE_LENGTH_, true, 1,
+                                                      false, 0);
         Utilities::DescriptorVector          argumentList;
 
         argumentList.push_back(&firstArg);
@@ -214,6 +239,10 @@ main(int      argc,
         argumentList.push_back(&fourthArg);
         argumentList.push_back(&fifthArg);
         argumentList.push_back(&sixthArg);
+        argumentList.push_back(&seventhArg);
+        argumentList.push_back(&eighthArg);
+        argumentList.push_back(&ninthArg);
+        argumentList.push_back(&tenthArg);
         if (ProcessStandardServiceOptions(argc, argv, argumentList,
                                           SENDTOMQOUTPUT_SERVICE_DESCRIPTION_, "", 2015,
                                           STANDARD_COPYRIGHT_NAME_, goWasSet, reportEndpoint,
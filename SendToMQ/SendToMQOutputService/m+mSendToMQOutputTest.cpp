@@ -0,0 +1,670 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mSendToMQOutputTest.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The test driver for the unit tests of the SendToMQ sender thread.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mSendToMQMessageSink.hpp"
+#include "m+mSendToMQOutputThread.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The test driver for the unit tests of the %SendToMQ sender thread.
+
+ The tests use an in-process stand-in for the ActiveMQ broker, so that no broker is needed. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::SendToMQ;
+using std::cerr;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The default number of records to send in a test. */
+static const int kDefaultRecordCount = 100;
+
+/*! @brief An in-process stand-in for the ActiveMQ broker. */
+class StandInBroker : public SendToMQMessageSink
+{
+public :
+
+    /*! @brief The constructor.
+     @param[in] holdDeliveries @c true if each delivery waits for 'releaseDelivery' and @c false
+     otherwise. */
+    explicit
+    StandInBroker(const bool holdDeliveries = false) :
+        _lock(), _entered(0), _gate(0), _messages(), _holdDeliveries(holdDeliveries)
+    {
+    } // constructor
+
+    /*! @brief The destructor. */
+    virtual
+    ~StandInBroker(void)
+    {
+    } // destructor
+
+    /*! @brief Deliver a message to the broker.
+     @param[in] aMessage The message to deliver.
+     @param[in] messageLength The length of the message.
+     @returns @c true if the message was delivered and @c false otherwise. */
+    virtual bool
+    deliverMessage(const std::string & aMessage,
+                   const size_t        messageLength)
+    {
+        bool result = (aMessage.length() == messageLength);
+
+        if (_holdDeliveries)
+        {
+            _entered.post();
+            _gate.wait();
+        }
+        _lock.lock();
+        _messages.push_back(aMessage);
+        _lock.unlock();
+        return result;
+    } // deliverMessage
+
+    /*! @brief Return a copy of the messages that have been delivered.
+     @param[out] messages The messages that have been delivered. */
+    void
+    getMessages(std::vector<std::string> & messages)
+    {
+        _lock.lock();
+        messages = _messages;
+        _lock.unlock();
+    } // getMessages
+
+    /*! @brief Let the current and all following deliveries complete. */
+    void
+    releaseDeliveries(void)
+    {
+        _holdDeliveries = false;
+        _gate.post();
+    } // releaseDeliveries
+
+    /*! @brief Wait until a delivery has been started. */
+    void
+    waitForDelivery(void)
+    {
+        _entered.wait();
+    } // waitForDelivery
+
+protected :
+
+private :
+
+    /*! @brief The copy constructor.
+     @param[in] other The object to be copied. */
+    StandInBroker(const StandInBroker & other);
+
+    /*! @brief The assignment operator.
+     @param[in] other The object to be copied.
+     @returns The updated object. */
+    StandInBroker &
+    operator =(const StandInBroker & other);
+
+public :
+
+protected :
+
+private :
+
+    /*! @brief The contention lock for the delivered messages. */
+    yarp::os::Mutex _lock;
+
+    /*! @brief Signalled when a held delivery has started. */
+    yarp::os::Semaphore _entered;
+
+    /*! @brief Signalled to let a held delivery complete. */
+    yarp::os::Semaphore _gate;
+
+    /*! @brief The messages that have been delivered. */
+    std::vector<std::string> _messages;
+
+    /*! @brief @c true if each delivery waits for 'releaseDeliveries' and @c false otherwise. */
+    bool _holdDeliveries;
+
+}; // StandInBroker
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the record count from the test arguments.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns The record count, or the default if it was not provided or not valid. */
+static int
+getRecordCount(const int argc,
+               char * *  argv)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = kDefaultRecordCount;
+
+    if (0 < argc)
+    {
+        const char * startPtr = *argv;
+        char *       endPtr;
+        int          value = strtol(startPtr, &endPtr, 10);
+
+        if ((startPtr != endPtr) && (! *endPtr) && (0 < value))
+        {
+            result = value;
+        }
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // getRecordCount
+
+/*! @brief Create a record that looks like the output of the JSON conversion.
+ @param[in] index The sequence number for the record.
+ @returns A record. */
+static std::string
+makeRecord(const int index)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("index = ", index); //####
+    std::stringstream buff;
+
+    buff << "{ \"time\" : " << index << ", \"value\" : [ " << index << " ] }\n";
+    ODL_EXIT_s(buff.str()); //####
+    return buff.str();
+} // makeRecord
+
+/*! @brief Count the occurrences of a substring.
+ @param[in] aString The string to be searched.
+ @param[in] toFind The substring to be counted.
+ @returns The number of non-overlapping occurrences of the substring. */
+static size_t
+countOccurrences(const std::string & aString,
+                 const char *        toFind)
+{
+    ODL_ENTER(); //####
+    ODL_S2("aString = ", aString.c_str(), "toFind = ", toFind); //####
+    size_t result = 0;
+    size_t findLength = strlen(toFind);
+
+    for (size_t pos = aString.find(toFind); std::string::npos != pos;
+         pos = aString.find(toFind, pos + findLength))
+    {
+        ++result;
+    }
+    ODL_EXIT_LL(result); //####
+    return result;
+} // countOccurrences
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 01 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestBatchAsJSONArray(const char * launchPath,
+                       const int    argc,
+                       char * *     argv) // batch records as a JSON array
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        int                      numRecords = getRecordCount(argc, argv);
+        StandInBroker            broker;
+        SendToMQOutputThread *   sender = new SendToMQOutputThread(broker, kBatchFormatJSONArray,
+                                                                   numRecords, 1024 * 1024, 0.2);
+        SendToMQOutputStatistics statistics;
+        std::vector<std::string> messages;
+
+        if (sender->start())
+        {
+            size_t recordsSeen = 0;
+
+            result = 0;
+            for (int ii = 0; numRecords > ii; ++ii)
+            {
+                if (! sender->addRecord(makeRecord(ii)))
+                {
+                    ODL_LOG("(! sender->addRecord(makeRecord(ii)))"); //####
+                    result = 1;
+                }
+            }
+            sender->stop();
+            sender->getStatistics(statistics);
+            broker.getMessages(messages);
+            for (size_t ii = 0, mm = messages.size(); mm > ii; ++ii)
+            {
+                const std::string & aMessage = messages[ii];
+
+                if ((0 != aMessage.find("[ {")) ||
+                    ((aMessage.length() - 4) != aMessage.rfind("} ]\n")))
+                {
+                    ODL_S1s("bad message = ", aMessage); //####
+                    result = 1;
+                }
+                recordsSeen += countOccurrences(aMessage, "\"time\"");
+            }
+            if ((static_cast<size_t>(numRecords) != recordsSeen) ||
+                (messages.size() >= static_cast<size_t>(numRecords)) ||
+                (numRecords != statistics._recordsSent) ||
+                (static_cast<int64_t>(messages.size()) != statistics._messagesSent) ||
+                (0 != statistics._recordsDropped) || (0 != statistics._queueDepth))
+            {
+                ODL_LL2("recordsSeen = ", recordsSeen, "messages.size() = ", //####
+                        messages.size()); //####
+                result = 1;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (sender->start())"); //####
+        }
+        delete sender;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestBatchAsJSONArray
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 02 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestBatchAsLinesWithSizeLimit(const char * launchPath,
+                                const int    argc,
+                                char * *     argv) // batch records as lines, limited by size
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        const size_t             maxBatchBytes = 100;
+        int                      numRecords = getRecordCount(argc, argv);
+        StandInBroker            broker;
+        SendToMQOutputThread *   sender = new SendToMQOutputThread(broker,
+                                                                   kBatchFormatNewlineDelimited,
+                                                                   numRecords, maxBatchBytes,
+                                                                   0.2);
+        std::vector<std::string> messages;
+
+        if (sender->start())
+        {
+            size_t recordsSeen = 0;
+
+            result = 0;
+            for (int ii = 0; numRecords > ii; ++ii)
+            {
+                sender->addRecord(makeRecord(ii));
+            }
+            sender->stop();
+            broker.getMessages(messages);
+            for (size_t ii = 0, mm = messages.size(); mm > ii; ++ii)
+            {
+                const std::string & aMessage = messages[ii];
+                size_t              numLines = countOccurrences(aMessage, "\n");
+
+                // A single record is always sent, even if it exceeds the limit.
+                if ((1 < numLines) && (maxBatchBytes < aMessage.length()))
+                {
+                    ODL_S1s("oversized message = ", aMessage); //####
+                    result = 1;
+                }
+                recordsSeen += numLines;
+            }
+            if ((static_cast<size_t>(numRecords) != recordsSeen) ||
+                (messages.size() >= static_cast<size_t>(numRecords)))
+            {
+                ODL_LL2("recordsSeen = ", recordsSeen, "messages.size() = ", //####
+                        messages.size()); //####
+                result = 1;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (sender->start())"); //####
+        }
+        delete sender;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestBatchAsLinesWithSizeLimit
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 03 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestDropOldestWhenFull(const char * launchPath,
+                         const int    argc,
+                         char * *     argv) // a stalled broker doesn't block the input
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        const int                queueLength = 10;
+        int                      numRecords = getRecordCount(argc, argv);
+        StandInBroker            broker(true);
+        SendToMQOutputThread *   sender = new SendToMQOutputThread(broker, kBatchFormatNone,
+                                                                   queueLength, 1024, 0);
+        SendToMQOutputStatistics statistics;
+        std::vector<std::string> messages;
+
+        if ((queueLength < numRecords) && sender->start())
+        {
+            int numRejected = 0;
+
+            // The first record is taken by the sender, which then stalls in the broker.
+            sender->addRecord(makeRecord(0));
+            broker.waitForDelivery();
+            for (int ii = 1; numRecords >= ii; ++ii)
+            {
+                if (! sender->addRecord(makeRecord(ii)))
+                {
+                    ++numRejected;
+                }
+            }
+            sender->getStatistics(statistics);
+            broker.releaseDeliveries();
+            sender->stop();
+            broker.getMessages(messages);
+            if ((numRejected == (numRecords - queueLength)) &&
+                (numRejected == statistics._recordsDropped) &&
+                (queueLength == static_cast<int>(statistics._queueDepth)) &&
+                (queueLength == static_cast<int>(statistics._queueHighWater)) &&
+                ((queueLength + 1) == static_cast<int>(messages.size())))
+            {
+                // The newest records must be the ones that were kept.
+                result = 0;
+                if ((makeRecord(0) != messages[0]) ||
+                    (makeRecord(numRecords - queueLength + 1) != messages[1]) ||
+                    (makeRecord(numRecords) != messages[queueLength]))
+                {
+                    ODL_LOG("wrong records kept"); //####
+                    result = 1;
+                }
+            }
+            else
+            {
+                ODL_LL3("numRejected = ", numRejected, "_recordsDropped = ", //####
+                        statistics._recordsDropped, "messages.size() = ", //####
+                        messages.size()); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((queueLength < numRecords) && sender->start())"); //####
+        }
+        delete sender;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestDropOldestWhenFull
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 04 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on success and @c 1 on failure. */
+static int
+doTestBatchLatencyLimit(const char * launchPath,
+                        const int    argc,
+                        char * *     argv) // a partial batch is sent after the latency limit
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath,argc,argv)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_LL1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        const double             maxBatchLatency = 0.05;
+        StandInBroker            broker;
+        SendToMQOutputThread *   sender = new SendToMQOutputThread(broker, kBatchFormatJSONArray,
+                                                                   100, 1024 * 1024,
+                                                                   maxBatchLatency);
+        SendToMQOutputStatistics statistics;
+
+        if (sender->start())
+        {
+            sender->addRecord(makeRecord(1));
+            for (int ii = 0; 100 > ii; ++ii)
+            {
+                sender->getStatistics(statistics);
+                if (0 < statistics._messagesSent)
+                {
+                    break;
+                }
+                yarp::os::Time::delay(maxBatchLatency / 5);
+            }
+            // The record must have been sent without stopping the thread, but not before the
+            // latency limit.
+            if ((1 == statistics._messagesSent) &&
+                ((maxBatchLatency * 0.9) <= statistics._maxRecordLatency))
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LL1("_messagesSent = ", statistics._messagesSent); //####
+                ODL_D1("_maxRecordLatency = ", statistics._maxRecordLatency); //####
+            }
+            sender->stop();
+        }
+        else
+        {
+            ODL_LOG("! (sender->start())"); //####
+        }
+        delete sender;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // doTestBatchLatencyLimit
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for unit tests of the %SendToMQ sender thread.
+
+ The first argument is the test number and the optional second argument is the number of records
+ to be sent. Output depends on the test being run.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @returns @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        yarp::os::Network yarp; // This is necessary to set up the YARP thread support, but no
+                                // connections are made.
+
+        Initialize(progName);
+        if (0 < --argc)
+        {
+            const char * startPtr = argv[1];
+            char *       endPtr;
+            int          selector = strtol(startPtr, &endPtr, 10);
+
+            ODL_LL1("selector <- ", selector); //####
+            if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+            {
+                switch (selector)
+                {
+                    case 1 :
+                        result = doTestBatchAsJSONArray(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 2 :
+                        result = doTestBatchAsLinesWithSizeLimit(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 3 :
+                        result = doTestDropOldestWhenFull(*argv, argc - 1, argv + 2);
+                        break;
+
+                    case 4 :
+                        result = doTestBatchLatencyLimit(*argv, argc - 1, argv + 2);
+                        break;
+
+                    default :
+                        break;
+
+                }
+                if (result)
+                {
+                    ODL_LL1("%%%%%%% unit test failure = ", result); //####
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 < --argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    yarp::os::Network::fini();
+    ODL_EXIT_L(result); //####
+    return result;
+} // main
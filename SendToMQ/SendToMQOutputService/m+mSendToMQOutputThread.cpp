@@ -0,0 +1,396 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mSendToMQOutputThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the sender thread of the SendToMQ output service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mSendToMQOutputThread.hpp"
+#include "m+mSendToMQMessageSink.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the sender thread of the %SendToMQ output service. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::SendToMQ;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+SendToMQOutputThread::SendToMQOutputThread(SendToMQMessageSink & sink,
+                                           const BatchFormat     format,
+                                           const size_t          maxQueueLength,
+                                           const size_t          maxBatchBytes,
+                                           const double          maxBatchLatency) :
+    inherited(), _lock(), _wakeUp(0), _queue(), _sink(sink), _recordLatencySum(0),
+    _sendTimeSum(0), _maxBatchLatency(maxBatchLatency), _pendingBytes(0),
+    _maxBatchBytes(maxBatchBytes), _maxQueueLength(maxQueueLength ? maxQueueLength : 1),
+    _format(format)
+{
+    ODL_ENTER(); //####
+    ODL_P1("sink = ", &sink); //####
+    ODL_LL3("format = ", format, "maxQueueLength = ", maxQueueLength, "maxBatchBytes = ", //####
+            maxBatchBytes); //####
+    ODL_D1("maxBatchLatency = ", maxBatchLatency); //####
+    resetStatistics();
+    ODL_EXIT_P(this); //####
+} // SendToMQOutputThread::SendToMQOutputThread
+
+SendToMQOutputThread::~SendToMQOutputThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // SendToMQOutputThread::~SendToMQOutputThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+SendToMQOutputThread::addRecord(const std::string & aRecord)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("aRecord = ", aRecord); //####
+    bool   result = true;
+    bool   wakeSender;
+    size_t recordLength = aRecord.length();
+
+    _lock.lock();
+    if (_maxQueueLength <= _queue.size())
+    {
+        ODL_LOG("(_maxQueueLength <= _queue.size())"); //####
+        _pendingBytes -= _queue.front()._text.length();
+        _queue.pop_front();
+        ++_statistics._recordsDropped;
+        result = false;
+    }
+    wakeSender = _queue.empty();
+    _queue.push_back(QueuedRecord());
+    QueuedRecord & newRecord = _queue.back();
+
+    newRecord._text = aRecord;
+    newRecord._queueTime = yarp::os::Time::now();
+    _statistics._bytesQueued += recordLength;
+    ++_statistics._recordsQueued;
+    if (_statistics._queueHighWater < _queue.size())
+    {
+        _statistics._queueHighWater = _queue.size();
+    }
+    // Only signal on the transitions that change how long the sender will wait, so that the
+    // semaphore count stays small.
+    if ((_pendingBytes < _maxBatchBytes) && (_maxBatchBytes <= (_pendingBytes + recordLength)))
+    {
+        wakeSender = true;
+    }
+    _pendingBytes += recordLength;
+    _lock.unlock();
+    if (wakeSender)
+    {
+        _wakeUp.post();
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SendToMQOutputThread::addRecord
+
+size_t
+SendToMQOutputThread::assembleBatch(std::string & message,
+                                    double &      oldestTime,
+                                    double &      queueTimeSum)
+{
+    ODL_OBJENTER(); //####
+    ODL_P3("message = ", &message, "oldestTime = ", &oldestTime, "queueTimeSum = ", //####
+           &queueTimeSum); //####
+    size_t numRecords = 0;
+
+    message.clear();
+    oldestTime = queueTimeSum = 0;
+    _lock.lock();
+    if (! _queue.empty())
+    {
+        message.reserve(std::min(_pendingBytes, _maxBatchBytes) + 8);
+        if (kBatchFormatJSONArray == _format)
+        {
+            message += "[ ";
+        }
+        for ( ; ! _queue.empty(); )
+        {
+            QueuedRecord & aRecord = _queue.front();
+            size_t         recordLength = aRecord._text.length();
+
+            if (0 < numRecords)
+            {
+                if ((kBatchFormatNone == _format) ||
+                    (_maxBatchBytes < (message.length() + recordLength + 2)))
+                {
+                    break;
+                }
+            }
+            if (kBatchFormatNone == _format)
+            {
+                message.swap(aRecord._text);
+            }
+            else if (kBatchFormatJSONArray == _format)
+            {
+                size_t textLength = recordLength;
+
+                // The converted messages end with a newline, which is not needed within an array.
+                if ((0 < textLength) && ('\n' == aRecord._text[textLength - 1]))
+                {
+                    --textLength;
+                }
+                if (0 < numRecords)
+                {
+                    message += ", ";
+                }
+                message.append(aRecord._text, 0, textLength);
+            }
+            else
+            {
+                message += aRecord._text;
+                if ((0 == recordLength) || ('\n' != aRecord._text[recordLength - 1]))
+                {
+                    message += '\n';
+                }
+            }
+            if (0 == numRecords)
+            {
+                oldestTime = aRecord._queueTime;
+            }
+            queueTimeSum += aRecord._queueTime;
+            _pendingBytes -= recordLength;
+            _queue.pop_front();
+            ++numRecords;
+        }
+        if (kBatchFormatJSONArray == _format)
+        {
+            message += " ]\n";
+        }
+    }
+    _lock.unlock();
+    ODL_OBJEXIT_LL(numRecords); //####
+    return numRecords;
+} // SendToMQOutputThread::assembleBatch
+
+void
+SendToMQOutputThread::deliverBatch(const std::string & message,
+                                   const size_t        numRecords,
+                                   const double        oldestTime,
+                                   const double        queueTimeSum)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("message = ", message); //####
+    ODL_LL1("numRecords = ", numRecords); //####
+    ODL_D2("oldestTime = ", oldestTime, "queueTimeSum = ", queueTimeSum); //####
+    double startTime = yarp::os::Time::now();
+    bool   sent = _sink.deliverMessage(message, message.length());
+    double endTime = yarp::os::Time::now();
+    double sendTime = endTime - startTime;
+
+    _lock.lock();
+    _sendTimeSum += sendTime;
+    if (_statistics._maxSendTime < sendTime)
+    {
+        _statistics._maxSendTime = sendTime;
+    }
+    if (sent)
+    {
+        double longestLatency = endTime - oldestTime;
+
+        ++_statistics._messagesSent;
+        _statistics._recordsSent += numRecords;
+        _statistics._bytesSent += message.length();
+        _recordLatencySum += (numRecords * endTime) - queueTimeSum;
+        if (_statistics._maxRecordLatency < longestLatency)
+        {
+            _statistics._maxRecordLatency = longestLatency;
+        }
+    }
+    else
+    {
+        ODL_LOG("! (sent)"); //####
+        ++_statistics._messagesFailed;
+    }
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // SendToMQOutputThread::deliverBatch
+
+void
+SendToMQOutputThread::getStatistics(SendToMQOutputStatistics & statistics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("statistics = ", &statistics); //####
+    _lock.lock();
+    int64_t numSends = _statistics._messagesSent + _statistics._messagesFailed;
+
+    statistics = _statistics;
+    statistics._queueDepth = _queue.size();
+    if (0 < _statistics._recordsSent)
+    {
+        statistics._meanRecordLatency = _recordLatencySum / _statistics._recordsSent;
+    }
+    if (0 < numSends)
+    {
+        statistics._meanSendTime = _sendTimeSum / numSends;
+    }
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // SendToMQOutputThread::getStatistics
+
+void
+SendToMQOutputThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _wakeUp.post();
+    ODL_OBJEXIT(); //####
+} // SendToMQOutputThread::onStop
+
+void
+SendToMQOutputThread::resetStatistics(void)
+{
+    ODL_OBJENTER(); //####
+    _lock.lock();
+    _statistics._queueDepth = _statistics._queueHighWater = 0;
+    _statistics._bytesQueued = _statistics._recordsQueued = _statistics._recordsDropped = 0;
+    _statistics._recordsSent = 0;
+    _statistics._messagesSent = _statistics._messagesFailed = _statistics._bytesSent = 0;
+    _statistics._meanRecordLatency = _statistics._maxRecordLatency = 0;
+    _statistics._meanSendTime = _statistics._maxSendTime = 0;
+    _recordLatencySum = _sendTimeSum = 0;
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // SendToMQOutputThread::resetStatistics
+
+void
+SendToMQOutputThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    std::string message;
+    double      oldestTime;
+    double      queueTimeSum;
+
+    for ( ; ! isStopping(); )
+    {
+        double delay = timeUntilReady();
+
+        if (0 > delay)
+        {
+            _wakeUp.wait();
+        }
+        else if (0 < delay)
+        {
+            _wakeUp.waitWithTimeout(delay);
+        }
+        else
+        {
+            size_t numRecords = assembleBatch(message, oldestTime, queueTimeSum);
+
+            if (0 < numRecords)
+            {
+                deliverBatch(message, numRecords, oldestTime, queueTimeSum);
+            }
+        }
+    }
+    // Send whatever is still waiting, so that stopping the streams doesn't lose data.
+    for (size_t numRecords = assembleBatch(message, oldestTime, queueTimeSum); 0 < numRecords;
+         numRecords = assembleBatch(message, oldestTime, queueTimeSum))
+    {
+        deliverBatch(message, numRecords, oldestTime, queueTimeSum);
+    }
+    ODL_OBJEXIT(); //####
+} // SendToMQOutputThread::run
+
+double
+SendToMQOutputThread::timeUntilReady(void)
+{
+    ODL_OBJENTER(); //####
+    double result;
+
+    _lock.lock();
+    if (_queue.empty())
+    {
+        result = -1;
+    }
+    else if ((kBatchFormatNone == _format) || (_maxBatchBytes <= _pendingBytes))
+    {
+        result = 0;
+    }
+    else
+    {
+        result = _queue.front()._queueTime + _maxBatchLatency - yarp::os::Time::now();
+        if (0 > result)
+        {
+            result = 0;
+        }
+    }
+    _lock.unlock();
+    ODL_OBJEXIT_D(result); //####
+    return result;
+} // SendToMQOutputThread::timeUntilReady
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,298 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mSendToMQOutputThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the sender thread of the SendToMQ output service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMSendToMQOutputThread_HPP_))
+# define MpMSendToMQOutputThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# include <deque>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the sender thread of the %SendToMQ output service. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace SendToMQ
+    {
+        class SendToMQMessageSink;
+
+        /*! @brief How queued records are combined into a single broker message. */
+        enum BatchFormat
+        {
+            /*! @brief Each record is sent as its own broker message. */
+            kBatchFormatNone             = 0,
+
+            /*! @brief The records are sent as the elements of a JSON array. */
+            kBatchFormatJSONArray        = 1,
+
+            /*! @brief The records are sent one per line. */
+            kBatchFormatNewlineDelimited = 2,
+
+            /*! @brief Force the size to be 4 bytes. */
+            kBatchFormatUnknown          = 0x7FFFFFFF
+
+        }; // BatchFormat
+
+        /*! @brief A snapshot of the activity of the sender thread. */
+        struct SendToMQOutputStatistics
+        {
+            /*! @brief The number of records currently waiting to be sent. */
+            size_t _queueDepth;
+
+            /*! @brief The largest number of records that have been waiting to be sent. */
+            size_t _queueHighWater;
+
+            /*! @brief The number of bytes accepted into the queue. */
+            int64_t _bytesQueued;
+
+            /*! @brief The number of records accepted into the queue. */
+            int64_t _recordsQueued;
+
+            /*! @brief The number of records discarded because the queue was full. */
+            int64_t _recordsDropped;
+
+            /*! @brief The number of records delivered to the broker. */
+            int64_t _recordsSent;
+
+            /*! @brief The number of broker messages delivered. */
+            int64_t _messagesSent;
+
+            /*! @brief The number of broker messages that could not be delivered. */
+            int64_t _messagesFailed;
+
+            /*! @brief The number of bytes delivered to the broker. */
+            int64_t _bytesSent;
+
+            /*! @brief The mean time, in seconds, from a record being queued to it being sent. */
+            double _meanRecordLatency;
+
+            /*! @brief The longest time, in seconds, from a record being queued to it being sent. */
+            double _maxRecordLatency;
+
+            /*! @brief The mean time, in seconds, spent in delivering a broker message. */
+            double _meanSendTime;
+
+            /*! @brief The longest time, in seconds, spent in delivering a broker message. */
+            double _maxSendTime;
+
+        }; // SendToMQOutputStatistics
+
+        /*! @brief A thread that delivers queued records to the broker.
+
+         Records are added by the input handler without waiting on the broker. When the queue is
+         full, the oldest record is discarded so that the most recent data is retained. The thread
+         combines waiting records into a single broker message, limited by the number of bytes in
+         the message and by the time that the oldest record has been waiting. */
+        class SendToMQOutputThread : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+            /*! @brief A record waiting to be sent. */
+            struct QueuedRecord
+            {
+                /*! @brief The text of the record. */
+                std::string _text;
+
+                /*! @brief The time at which the record was queued. */
+                double _queueTime;
+
+            }; // QueuedRecord
+
+            /*! @brief The queue of records waiting to be sent. */
+            typedef std::deque<QueuedRecord> RecordQueue;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] sink The destination for the assembled messages.
+             @param[in] format How records are to be combined into broker messages.
+             @param[in] maxQueueLength The maximum number of records that can be waiting.
+             @param[in] maxBatchBytes The maximum size of a combined broker message.
+             @param[in] maxBatchLatency The maximum time, in seconds, that a record will be held
+             while a broker message is assembled. */
+            SendToMQOutputThread(SendToMQMessageSink & sink,
+                                 const BatchFormat     format,
+                                 const size_t          maxQueueLength,
+                                 const size_t          maxBatchBytes,
+                                 const double          maxBatchLatency);
+
+            /*! @brief The destructor. */
+            virtual
+            ~SendToMQOutputThread(void);
+
+            /*! @brief Add a record to the queue.
+
+             This never waits for the broker.
+             @param[in] aRecord The record to be sent.
+             @returns @c true if no record was discarded to make room and @c false otherwise. */
+            bool
+            addRecord(const std::string & aRecord);
+
+            /*! @brief Retrieve the activity of the thread.
+             @param[out] statistics The activity of the thread. */
+            void
+            getStatistics(SendToMQOutputStatistics & statistics);
+
+            /*! @brief Reset the activity of the thread. */
+            void
+            resetStatistics(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            SendToMQOutputThread(const SendToMQOutputThread & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            SendToMQOutputThread &
+            operator =(const SendToMQOutputThread & other);
+
+            /*! @brief Remove the next batch of records from the queue and combine them.
+             @param[out] message The combined records.
+             @param[out] oldestTime The time at which the oldest of the records was queued.
+             @param[out] queueTimeSum The sum of the times at which the records were queued.
+             @returns The number of records that were combined. */
+            size_t
+            assembleBatch(std::string & message,
+                          double &      oldestTime,
+                          double &      queueTimeSum);
+
+            /*! @brief Deliver a combined message and update the activity.
+             @param[in] message The combined records.
+             @param[in] numRecords The number of records in the message.
+             @param[in] oldestTime The time at which the oldest of the records was queued.
+             @param[in] queueTimeSum The sum of the times at which the records were queued. */
+            void
+            deliverBatch(const std::string & message,
+                         const size_t        numRecords,
+                         const double        oldestTime,
+                         const double        queueTimeSum);
+
+            /*! @brief Called when the thread is being asked to stop. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+            /*! @brief Determine how long to wait before the pending records must be sent.
+             @returns A negative value if the queue is empty, zero if the pending records should
+             be sent now, or the number of seconds to wait. */
+            double
+            timeUntilReady(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock for the queue and the activity. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Signalled when the thread has something to do. */
+            yarp::os::Semaphore _wakeUp;
+
+            /*! @brief The records waiting to be sent. */
+            RecordQueue _queue;
+
+            /*! @brief The destination for the assembled messages. */
+            SendToMQMessageSink & _sink;
+
+            /*! @brief The activity of the thread. */
+            SendToMQOutputStatistics _statistics;
+
+            /*! @brief The sum of the record latencies, used to calculate the mean. */
+            double _recordLatencySum;
+
+            /*! @brief The sum of the send times, used to calculate the mean. */
+            double _sendTimeSum;
+
+            /*! @brief The maximum time that a record will be held while a message is assembled. */
+            double _maxBatchLatency;
+
+            /*! @brief The number of bytes in the records that are waiting. */
+            size_t _pendingBytes;
+
+            /*! @brief The maximum size of a combined broker message. */
+            size_t _maxBatchBytes;
+
+            /*! @brief The maximum number of records that can be waiting. */
+            size_t _maxQueueLength;
+
+            /*! @brief How records are combined into broker messages. */
+            BatchFormat _format;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // SendToMQOutputThread
+
+    } // SendToMQ
+
+} // MplusM
+
+#endif // ! defined(MpMSendToMQOutputThread_HPP_)
@@ -83,11 +83,14 @@ static void
 setUpAndGo(const OutputFlavour flavour)
 {
     ODL_ENTER(); //####
-    bool             reported = false;
-    YarpStringVector services;
+    bool                        reported = false;
+    Utilities::RoundTripTimeMap roundTrips;
+    YarpStringVector            services;
 
     if (Utilities::GetServiceNames(services))
     {
+        // The round-trip times are optional - older Registry Services do not record them.
+        Utilities::GetRoundTripTimes(roundTrips, STANDARD_WAIT_TIME_);
         if (kOutputFlavourJSON == flavour)
         {
             cout << "[ ";
@@ -112,6 +115,7 @@ setUpAndGo(const OutputFlavour flavour)
                     YarpString kind;
                     YarpString outChannelNames;
                     YarpString requests;
+                    YarpString roundTrip;
                     YarpString serviceName;
                     YarpString servicePortName;
                     YarpString tag;
@@ -171,6 +175,13 @@ setUpAndGo(const OutputFlavour flavour)
                             inChannelNames += T_(CHAR_DOUBLEQUOTE_ ", " CHAR_DOUBLEQUOTE_ "Protocol"
                                                  CHAR_DOUBLEQUOTE_ ": " CHAR_DOUBLEQUOTE_);
                             inChannelNames += SanitizeString(iDescriptor._portProtocol);
+                            if (0 < iDescriptor._multicastGroup.length())
+                            {
+                                inChannelNames += T_(CHAR_DOUBLEQUOTE_ ", " CHAR_DOUBLEQUOTE_
+                                                     "Multicast" CHAR_DOUBLEQUOTE_ ": "
+                                                     CHAR_DOUBLEQUOTE_);
+                                inChannelNames += SanitizeString(iDescriptor._multicastGroup);
+                            }
                             inChannelNames += T_(CHAR_DOUBLEQUOTE_ " }");
                         }
                         else
@@ -185,6 +196,11 @@ setUpAndGo(const OutputFlavour flavour)
                                 inChannelNames += "{protocol=";
                                 inChannelNames += iDescriptor._portProtocol + "}";
                             }
+                            if (0 < iDescriptor._multicastGroup.length())
+                            {
+                                inChannelNames += "{multicast=";
+                                inChannelNames += iDescriptor._multicastGroup + "}";
+                            }
                         }
                         sawInputs = true;
                     }
@@ -212,6 +228,20 @@ setUpAndGo(const OutputFlavour flavour)
                                                   "Protocol" CHAR_DOUBLEQUOTE_ ": "
                                                   CHAR_DOUBLEQUOTE_);
                             outChannelNames += SanitizeString(oDescriptor._portProtocol);
+                            if (0 < oDescriptor._multicastGroup.length())
+                            {
+                                outChannelNames += T_(CHAR_DOUBLEQUOTE_ ", " CHAR_DOUBLEQUOTE_
+                                                      "Multicast" CHAR_DOUBLEQUOTE_ ": "
+                                                      CHAR_DOUBLEQUOTE_);
+                                outChannelNames += SanitizeString(oDescriptor._multicastGroup);
+                            }
+                            if (0 < oDescriptor._compression.length())
+                            {
+                                outChannelNames += T_(CHAR_DOUBLEQUOTE_ ", " CHAR_DOUBLEQUOTE_
+                                                      "Compression" CHAR_DOUBLEQUOTE_ ": "
+                                                      CHAR_DOUBLEQUOTE_);
+                                outChannelNames += SanitizeString(oDescriptor._compression);
+                            }
                             outChannelNames += T_(CHAR_DOUBLEQUOTE_ " }");
                         }
                         else
@@ -226,6 +256,16 @@ setUpAndGo(const OutputFlavour flavour)
                                 outChannelNames += "{protocol=";
                                 outChannelNames += oDescriptor._portProtocol + "}";
                             }
+                            if (0 < oDescriptor._multicastGroup.length())
+                            {
+                                outChannelNames += "{multicast=";
+                                outChannelNames += oDescriptor._multicastGroup + "}";
+                            }
+                            if (0 < oDescriptor._compression.length())
+                            {
+                                outChannelNames += "{compression=";
+                                outChannelNames += oDescriptor._compression + "}";
+                            }
                         }
                         sawOutputs = true;
                     }
@@ -279,6 +319,16 @@ setUpAndGo(const OutputFlavour flavour)
                     serviceName = SanitizeString(descriptor._serviceName,
                                                  kOutputFlavourJSON != flavour);
                     tag = SanitizeString(descriptor._tag, kOutputFlavourJSON != flavour);
+                    Utilities::RoundTripTimeMap::const_iterator match(roundTrips.find(*walker));
+
+                    if (roundTrips.end() != match)
+                    {
+                        std::stringstream buff;
+
+                        // Report the round-trip time in milliseconds.
+                        buff << (match->second * 1000.0);
+                        roundTrip = buff.str();
+                    }
                     switch (flavour)
                     {
                         case kOutputFlavourJSON :
@@ -309,6 +359,11 @@ setUpAndGo(const OutputFlavour flavour)
                             cout << T_(CHAR_DOUBLEQUOTE_ "Path" CHAR_DOUBLEQUOTE_ ": "
                                        CHAR_DOUBLEQUOTE_) << descriptor._path.c_str() <<
                                     T_(CHAR_DOUBLEQUOTE_ ", ");
+                            if (0 < roundTrip.length())
+                            {
+                                cout << T_(CHAR_DOUBLEQUOTE_ "RoundTripMs" CHAR_DOUBLEQUOTE_
+                                           ": ") << roundTrip.c_str() << ", ";
+                            }
                             cout << T_(CHAR_DOUBLEQUOTE_ "SecondaryInputs" CHAR_DOUBLEQUOTE_
                                        ": ") << inChannelNames.c_str() << ", ";
                             cout << T_(CHAR_DOUBLEQUOTE_ "SecondaryOutputs" CHAR_DOUBLEQUOTE_
@@ -328,7 +383,8 @@ setUpAndGo(const OutputFlavour flavour)
                             requests = SanitizeString(descriptor._requestsDescription, true);
                             cout << requests.c_str() << "\t" << descriptor._path.c_str() << "\t" <<
                                     inChannelNames.c_str() << "\t" << outChannelNames.c_str() <<
-                                    "\t" << clientChannelNames.c_str();
+                                    "\t" << clientChannelNames.c_str() << "\t" <<
+                                    roundTrip.c_str();
                             break;
 
                         case kOutputFlavourNormal :
@@ -346,6 +402,10 @@ setUpAndGo(const OutputFlavour flavour)
                             OutputDescription(cout, "Requests:          ",
                                               descriptor._requestsDescription);
                             cout << "Path:              " << descriptor._path.c_str() << endl;
+                            if (0 < roundTrip.length())
+                            {
+                                cout << "Round trip:        " << roundTrip.c_str() << " ms" << endl;
+                            }
                             if (0 < inChannelNames.size())
                             {
                                 OutputDescription(cout, "Secondary inputs:  ", inChannelNames);
@@ -0,0 +1,547 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mUnrealOutputClientMain.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The main application for measuring the latency of the Unreal output service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mUnrealFrameBuilder.hpp"
+
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <netinet/in.h>
+# include <netinet/tcp.h>
+# include <poll.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The main application for measuring the latency of the %Unreal output service. */
+
+/*! @dir UnrealOutputClient
+ @brief The set of files that implement the application for measuring the latency of the %Unreal
+ output service. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Unreal;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of sources that can appear in a frame, including the unused zero value. */
+static const int kNumSources = 3;
+
+/*! @brief A connection to the %Unreal output service. */
+struct ClientConnection
+{
+    /*! @brief The bytes that have been received and not yet processed. */
+    std::string _buffer;
+
+    /*! @brief The number of frames received. */
+    int64_t _framesReceived;
+
+    /*! @brief The number of frames that were skipped by the service, as shown by the sequence
+     numbers. */
+    int64_t _framesMissed;
+
+    /*! @brief The last sequence number seen for each source. */
+    uint32_t _lastSequence[kNumSources];
+
+    /*! @brief @c true if a frame has been seen for the source and @c false otherwise. */
+    bool _sourceSeen[kNumSources];
+
+    /*! @brief The socket that frames are read from. */
+    SOCKET _socket;
+
+    /*! @brief @c true if the connection has been closed and @c false otherwise. */
+    bool _closed;
+
+}; // ClientConnection
+
+/*! @brief A sequence of connections. */
+typedef std::vector<ClientConnection> ConnectionVector;
+
+/*! @brief A sequence of latencies, in microseconds. */
+typedef std::vector<int64_t> LatencyVector;
+
+/*! @brief The default address of the %Unreal output service. */
+static const char * kDefaultAddress = "127.0.0.1";
+
+/*! @brief The default number of simultaneous connections. */
+static const int kDefaultConnections = 1;
+
+/*! @brief The default port of the %Unreal output service. */
+static const int kDefaultPort = 9876;
+
+/*! @brief The default number of seconds to receive frames for. */
+static const int kDefaultSeconds = 10;
+
+/*! @brief The number of milliseconds to wait for frames at one time. */
+static const int kPollInterval = 100;
+
+/*! @brief The size of the buffer used to read from a connection. */
+static const size_t kReadBufferSize = 65536;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Retrieve an optional non-negative integer argument.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @param[in] index The position of the argument of interest.
+ @param[in] defaultValue The value to use if the argument is missing or invalid.
+ @returns The value of the argument or the default value. */
+static int
+getIntArgument(const int argc,
+               char * *  argv,
+               const int index,
+               const int defaultValue)
+{
+    ODL_ENTER(); //####
+    ODL_LL2("argc = ", argc, "index = ", index); //####
+    ODL_P1("argv = ", argv); //####
+    int result = defaultValue;
+
+    if (index < argc)
+    {
+        const char * startPtr = argv[index];
+        char *       endPtr;
+        int          value = strtol(startPtr, &endPtr, 10);
+
+        if ((startPtr != endPtr) && (! *endPtr) && (0 <= value))
+        {
+            result = value;
+        }
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // getIntArgument
+
+/*! @brief Read a 32-bit value, in little-endian order.
+ @param[in] data The bytes of the value.
+ @returns The value. */
+static uint32_t
+readInt32(const char * data)
+{
+    ODL_ENTER(); //####
+    ODL_P1("data = ", data); //####
+    uint32_t result = 0;
+
+    for (int ii = 3; 0 <= ii; --ii)
+    {
+        result = ((result << 8) | static_cast<uint8_t>(data[ii]));
+    }
+    ODL_EXIT_LL(result); //####
+    return result;
+} // readInt32
+
+/*! @brief Read a 64-bit value, in little-endian order.
+ @param[in] data The bytes of the value.
+ @returns The value. */
+static int64_t
+readInt64(const char * data)
+{
+    ODL_ENTER(); //####
+    ODL_P1("data = ", data); //####
+    uint64_t result = ((static_cast<uint64_t>(readInt32(data + 4)) << 32) | readInt32(data));
+
+    ODL_EXIT_LL(result); //####
+    return static_cast<int64_t>(result);
+} // readInt64
+
+/*! @brief Close a connection to the service.
+ @param[in,out] aConnection The connection to be closed. */
+static void
+closeConnection(ClientConnection & aConnection)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aConnection = ", &aConnection); //####
+    if (INVALID_SOCKET != aConnection._socket)
+    {
+#if MAC_OR_LINUX_
+        close(aConnection._socket);
+#else // ! MAC_OR_LINUX_
+        closesocket(aConnection._socket);
+#endif // ! MAC_OR_LINUX_
+        aConnection._socket = INVALID_SOCKET;
+    }
+    aConnection._closed = true;
+    ODL_EXIT(); //####
+} // closeConnection
+
+/*! @brief Open a connection to the service.
+ @param[in] address The address of the service.
+ @param[in] port The port of the service.
+ @param[out] aConnection The connection to be opened.
+ @returns @c true if the connection was opened and @c false otherwise. */
+static bool
+openConnection(const char *       address,
+               const int          port,
+               ClientConnection & aConnection)
+{
+    ODL_ENTER(); //####
+    ODL_S1("address = ", address); //####
+    ODL_LL1("port = ", port); //####
+    ODL_P1("aConnection = ", &aConnection); //####
+    bool               result = false;
+    int                noDelay = 1;
+    struct sockaddr_in destination;
+
+    aConnection._framesReceived = aConnection._framesMissed = 0;
+    for (int ii = 0; kNumSources > ii; ++ii)
+    {
+        aConnection._lastSequence[ii] = 0;
+        aConnection._sourceSeen[ii] = false;
+    }
+    aConnection._closed = false;
+    memset(&destination, 0, sizeof(destination));
+    destination.sin_family = AF_INET;
+    destination.sin_port = htons(static_cast<uint16_t>(port));
+#if MAC_OR_LINUX_
+    if (1 == inet_pton(AF_INET, address, &destination.sin_addr))
+#else // ! MAC_OR_LINUX_
+    if (1 == InetPtonA(AF_INET, address, &destination.sin_addr))
+#endif // ! MAC_OR_LINUX_
+    {
+        aConnection._socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (INVALID_SOCKET == aConnection._socket)
+        {
+            ODL_LOG("(INVALID_SOCKET == aConnection._socket)"); //####
+            cerr << "Could not create a socket." << endl;
+        }
+        else if (connect(aConnection._socket, reinterpret_cast<struct sockaddr *>(&destination),
+                         sizeof(destination)))
+        {
+            ODL_LOG("(connect(aConnection._socket, ...))"); //####
+            cerr << "Could not connect to " << address << ":" << port << "." << endl;
+            closeConnection(aConnection);
+        }
+        else
+        {
+            setsockopt(aConnection._socket, IPPROTO_TCP, TCP_NODELAY,
+                       reinterpret_cast<char *>(&noDelay), sizeof(noDelay));
+            result = true;
+        }
+    }
+    else
+    {
+        ODL_LOG("! (1 == inet_pton(AF_INET, address, &destination.sin_addr))"); //####
+        cerr << "Invalid address '" << address << "'." << endl;
+        aConnection._socket = INVALID_SOCKET;
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // openConnection
+
+/*! @brief Process the complete frames that have been received on a connection.
+
+ The latency of a frame is the time between the arrival of its data at the service and the
+ arrival of the frame here; this is only meaningful when the service and this application are
+ using the same clock.
+ @param[in,out] aConnection The connection that received the frames.
+ @param[in] arrivalTime The time at which the frames arrived, in microseconds since the epoch.
+ @param[in,out] latencies The latencies of the frames that have been received.
+ @returns @c true if the frames were valid and @c false otherwise. */
+static bool
+processFrames(ClientConnection & aConnection,
+              const int64_t      arrivalTime,
+              LatencyVector &    latencies)
+{
+    ODL_ENTER(); //####
+    ODL_P2("aConnection = ", &aConnection, "latencies = ", &latencies); //####
+    ODL_LL1("arrivalTime = ", arrivalTime); //####
+    bool   okSoFar = true;
+    size_t offset = 0;
+
+    for ( ; okSoFar && ((offset + UNREAL_FRAME_HEADER_SIZE_) <= aConnection._buffer.size()); )
+    {
+        const char * header = aConnection._buffer.data() + offset;
+        uint32_t     length = readInt32(header + 12);
+
+        if ((UNREAL_FRAME_MAGIC_ != readInt32(header)) || (UNREAL_FRAME_HEADER_SIZE_ > length))
+        {
+            ODL_LOG("((UNREAL_FRAME_MAGIC_ != readInt32(header)) || " //####
+                    "(UNREAL_FRAME_HEADER_SIZE_ > length))"); //####
+            cerr << "Not a binary frame; the service must be configured to send binary frames." <<
+                    endl;
+            okSoFar = false;
+        }
+        else if ((offset + length) <= aConnection._buffer.size())
+        {
+            int      source = (static_cast<uint8_t>(header[6]) |
+                               (static_cast<uint8_t>(header[7]) << 8));
+            uint32_t sequenceNumber = readInt32(header + 8);
+
+            if ((0 < source) && (kNumSources > source))
+            {
+                if (aConnection._sourceSeen[source])
+                {
+                    uint32_t expected = aConnection._lastSequence[source] + 1;
+
+                    aConnection._framesMissed += static_cast<uint32_t>(sequenceNumber - expected);
+                }
+                aConnection._lastSequence[source] = sequenceNumber;
+                aConnection._sourceSeen[source] = true;
+            }
+            latencies.push_back(arrivalTime - readInt64(header + 16));
+            ++aConnection._framesReceived;
+            offset += length;
+        }
+        else
+        {
+            break;
+        }
+    }
+    aConnection._buffer.erase(0, offset);
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // processFrames
+
+/*! @brief Report the distribution of the latencies.
+ @param[in,out] latencies The latencies of the frames that were received. */
+static void
+reportLatencies(LatencyVector & latencies)
+{
+    ODL_ENTER(); //####
+    ODL_P1("latencies = ", &latencies); //####
+    size_t count = latencies.size();
+
+    if (0 < count)
+    {
+        double sum = 0;
+
+        std::sort(latencies.begin(), latencies.end());
+        for (size_t ii = 0; count > ii; ++ii)
+        {
+            sum += latencies[ii];
+        }
+        cout << "latency (microseconds)\tmin " << latencies[0] << "\tmean " << (sum / count) <<
+                "\tp50 " << latencies[(count - 1) / 2] << "\tp99 " <<
+                latencies[((count - 1) * 99) / 100] << "\tmax " << latencies[count - 1] << endl;
+    }
+    else
+    {
+        cout << "No frames were received." << endl;
+    }
+    ODL_EXIT(); //####
+} // reportLatencies
+
+/*! @brief Receive frames from the service on a set of connections.
+ @param[in] address The address of the service.
+ @param[in] port The port of the service.
+ @param[in] seconds The number of seconds to receive frames for.
+ @param[in] numConnections The number of simultaneous connections to make.
+ @returns @c 0 on a successful run and @c 1 on failure. */
+static int
+receiveFrames(const char * address,
+              const int    port,
+              const int    seconds,
+              const int    numConnections)
+{
+    ODL_ENTER(); //####
+    ODL_S1("address = ", address); //####
+    ODL_LL3("port = ", port, "seconds = ", seconds, "numConnections = ", //####
+            numConnections); //####
+    int              result = 1;
+    bool             okSoFar = true;
+    ConnectionVector connections(numConnections);
+    LatencyVector    latencies;
+
+    for (int ii = 0; okSoFar && (numConnections > ii); ++ii)
+    {
+        okSoFar = openConnection(address, port, connections[ii]);
+    }
+    if (okSoFar)
+    {
+        char                    readBuffer[kReadBufferSize];
+        double                  endTime = yarp::os::Time::now() + seconds;
+        int                     numOpen = numConnections;
+#if MAC_OR_LINUX_
+        std::vector<pollfd>     pollSet(numConnections);
+#else // ! MAC_OR_LINUX_
+        std::vector<WSAPOLLFD>  pollSet(numConnections);
+#endif // ! MAC_OR_LINUX_
+
+        for ( ; (0 < numOpen) && (yarp::os::Time::now() < endTime); )
+        {
+            for (int ii = 0; numConnections > ii; ++ii)
+            {
+                pollSet[ii].fd = connections[ii]._socket;
+                pollSet[ii].events = (connections[ii]._closed ? 0 : POLLIN);
+                pollSet[ii].revents = 0;
+            }
+#if MAC_OR_LINUX_
+            poll(&pollSet[0], static_cast<nfds_t>(pollSet.size()), kPollInterval);
+#else // ! MAC_OR_LINUX_
+            WSAPoll(&pollSet[0], static_cast<ULONG>(pollSet.size()), kPollInterval);
+#endif // ! MAC_OR_LINUX_
+            int64_t arrivalTime = static_cast<int64_t>(yarp::os::Time::now() * 1e6);
+
+            for (int ii = 0; numConnections > ii; ++ii)
+            {
+                ClientConnection & aConnection = connections[ii];
+
+                if ((! aConnection._closed) && (pollSet[ii].revents & (POLLIN | POLLHUP | POLLERR)))
+                {
+#if MAC_OR_LINUX_
+                    ssize_t received = recv(aConnection._socket, readBuffer, sizeof(readBuffer),
+                                            0);
+#else // ! MAC_OR_LINUX_
+                    int     received = recv(aConnection._socket, readBuffer,
+                                            static_cast<int>(sizeof(readBuffer)), 0);
+#endif // ! MAC_OR_LINUX_
+
+                    if (0 < received)
+                    {
+                        aConnection._buffer.append(readBuffer, static_cast<size_t>(received));
+                        if (! processFrames(aConnection, arrivalTime, latencies))
+                        {
+                            closeConnection(aConnection);
+                            --numOpen;
+                        }
+                    }
+                    else
+                    {
+                        cerr << "Connection " << ii << " was closed by the service." << endl;
+                        closeConnection(aConnection);
+                        --numOpen;
+                    }
+                }
+            }
+        }
+        for (int ii = 0; numConnections > ii; ++ii)
+        {
+            ClientConnection & aConnection = connections[ii];
+
+            cout << "connection " << ii << "\t" << aConnection._framesReceived << " frames\t" <<
+                    aConnection._framesMissed << " missed" << endl;
+        }
+        reportLatencies(latencies);
+        result = 0;
+    }
+    for (int ii = 0; numConnections > ii; ++ii)
+    {
+        closeConnection(connections[ii]);
+    }
+    ODL_EXIT_L(result); //####
+    return result;
+} // receiveFrames
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for measuring the latency of the %Unreal output service.
+
+ The arguments are all optional:
+
+ [address [port [seconds [connections]]]]
+
+ The service must be configured to send binary frames. Each connection counts the frames that it
+ receives and the frames that were dropped by the service because the connection was not keeping
+ up; the latency, from the arrival of the data at the service to the arrival of the frame at this
+ application, is reported for all the connections together.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used.
+ @returns @c 0 on a successful run and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        const char * address = ((1 < argc) ? argv[1] : kDefaultAddress);
+        int          port = getIntArgument(argc, argv, 2, kDefaultPort);
+        int          seconds = getIntArgument(argc, argv, 3, kDefaultSeconds);
+        int          numConnections = getIntArgument(argc, argv, 4, kDefaultConnections);
+
+        Initialize(progName);
+        if (0 < numConnections)
+        {
+            result = receiveFrames(address, port, seconds, numConnections);
+        }
+        else
+        {
+            ODL_LOG("! (0 < numConnections)"); //####
+            cerr << "Usage: " << progName.c_str() << " [address [port [seconds [connections]]]]" <<
+                    endl;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    yarp::os::Network::fini();
+    ODL_EXIT_L(result); //####
+    return result;
+} // main
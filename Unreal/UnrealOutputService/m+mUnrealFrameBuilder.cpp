@@ -0,0 +1,307 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mUnrealFrameBuilder.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the builder of frames sent by the Unreal output service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mUnrealFrameBuilder.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the builder of frames sent by the %Unreal output service. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Unreal;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The position of the frame length in the header of a binary frame. */
+static const size_t kFrameLengthOffset = 12;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Append a 16-bit value to a frame, in little-endian order.
+ @param[in,out] frame The frame to be extended.
+ @param[in] value The value to be appended. */
+static void
+appendInt16(std::string &  frame,
+            const uint16_t value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("frame = ", &frame); //####
+    ODL_LL1("value = ", value); //####
+    frame += static_cast<char>(value & 0x0FF);
+    frame += static_cast<char>((value >> 8) & 0x0FF);
+    ODL_EXIT(); //####
+} // appendInt16
+
+/*! @brief Append a 32-bit value to a frame, in little-endian order.
+ @param[in,out] frame The frame to be extended.
+ @param[in] value The value to be appended. */
+static void
+appendInt32(std::string &  frame,
+            const uint32_t value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("frame = ", &frame); //####
+    ODL_LL1("value = ", value); //####
+    for (int ii = 0; 4 > ii; ++ii)
+    {
+        frame += static_cast<char>((value >> (8 * ii)) & 0x0FF);
+    }
+    ODL_EXIT(); //####
+} // appendInt32
+
+/*! @brief Append a 64-bit value to a frame, in little-endian order.
+ @param[in,out] frame The frame to be extended.
+ @param[in] value The value to be appended. */
+static void
+appendInt64(std::string &  frame,
+            const uint64_t value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("frame = ", &frame); //####
+    ODL_LL1("value = ", value); //####
+    appendInt32(frame, static_cast<uint32_t>(value & 0x0FFFFFFFF));
+    appendInt32(frame, static_cast<uint32_t>(value >> 32));
+    ODL_EXIT(); //####
+} // appendInt64
+
+/*! @brief Append a name to a frame, truncating it or padding it with zero bytes to the fixed
+ size of a name.
+ @param[in,out] frame The frame to be extended.
+ @param[in] name The name to be appended. */
+static void
+appendName(std::string &      frame,
+           const YarpString & name)
+{
+    ODL_ENTER(); //####
+    ODL_P1("frame = ", &frame); //####
+    ODL_S1s("name = ", name); //####
+    size_t nameLength = std::min(name.length(), static_cast<size_t>(UNREAL_FRAME_NAME_SIZE_ - 1));
+
+    frame.append(name.c_str(), nameLength);
+    frame.append(UNREAL_FRAME_NAME_SIZE_ - nameLength, '\0');
+    ODL_EXIT(); //####
+} // appendName
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+UnrealFrameBuilder::UnrealFrameBuilder(const UnrealFrameSource source) :
+    _source(source), _sequenceNumber(0), _binary(false)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("source = ", source); //####
+    ODL_EXIT_P(this); //####
+} // UnrealFrameBuilder::UnrealFrameBuilder
+
+UnrealFrameBuilder::~UnrealFrameBuilder(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // UnrealFrameBuilder::~UnrealFrameBuilder
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+UnrealFrameBuilder::addSegment(const YarpString & name,
+                               const double *     values)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("name = ", name); //####
+    ODL_P1("values = ", values); //####
+    if (_binary)
+    {
+        appendName(_binaryBuffer, name);
+        for (int ii = 0; UNREAL_FRAME_SEGMENT_VALUES_ > ii; ++ii)
+        {
+            float    asFloat = static_cast<float>(values[ii]);
+            uint32_t asInt;
+
+            memcpy(&asInt, &asFloat, sizeof(asInt));
+            appendInt32(_binaryBuffer, asInt);
+        }
+    }
+    else
+    {
+#if defined(MpM_UseCustomStringBuffer)
+        _textBuffer.addString(name);
+        for (int ii = 0; UNREAL_FRAME_SEGMENT_VALUES_ > ii; ++ii)
+        {
+            _textBuffer.addTab().addDouble(values[ii]);
+        }
+        _textBuffer.addString(LINE_END_);
+#else // ! defined(MpM_UseCustomStringBuffer)
+        _textBuffer << name.c_str();
+        for (int ii = 0; UNREAL_FRAME_SEGMENT_VALUES_ > ii; ++ii)
+        {
+            _textBuffer << "\t" << values[ii];
+        }
+        _textBuffer << LINE_END_;
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    }
+    ODL_OBJEXIT(); //####
+} // UnrealFrameBuilder::addSegment
+
+void
+UnrealFrameBuilder::addSubject(const YarpString & name,
+                               const int          numSegments)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("name = ", name); //####
+    ODL_LL1("numSegments = ", numSegments); //####
+    if (_binary)
+    {
+        appendName(_binaryBuffer, name);
+        appendInt32(_binaryBuffer, static_cast<uint32_t>(numSegments));
+        appendInt32(_binaryBuffer, 0);
+    }
+    else
+    {
+#if defined(MpM_UseCustomStringBuffer)
+        _textBuffer.addString(name).addTab().addLong(numSegments).addString("\t0" LINE_END_);
+#else // ! defined(MpM_UseCustomStringBuffer)
+        _textBuffer << name.c_str() << "\t" << numSegments << "\t0" LINE_END_;
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    }
+    ODL_OBJEXIT(); //####
+} // UnrealFrameBuilder::addSubject
+
+const char *
+UnrealFrameBuilder::finishFrame(size_t & length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("length = ", &length); //####
+    const char * result;
+
+    if (_binary)
+    {
+        uint32_t frameLength = static_cast<uint32_t>(_binaryBuffer.length());
+
+        // The length is only known now, so it is written into the space left in the header.
+        for (size_t ii = 0; 4 > ii; ++ii)
+        {
+            _binaryBuffer[kFrameLengthOffset + ii] = static_cast<char>((frameLength >> (8 * ii)) &
+                                                                       0x0FF);
+        }
+        ++_sequenceNumber;
+        result = _binaryBuffer.data();
+        length = _binaryBuffer.length();
+    }
+    else
+    {
+#if defined(MpM_UseCustomStringBuffer)
+        _textBuffer.addString("END" LINE_END_);
+        result = _textBuffer.getString(length);
+#else // ! defined(MpM_UseCustomStringBuffer)
+        _textBuffer << "END" LINE_END_;
+        _textString = _textBuffer.str();
+        result = _textString.c_str();
+        length = _textString.length();
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // UnrealFrameBuilder::finishFrame
+
+void
+UnrealFrameBuilder::startFrame(const bool binary,
+                               const int  numSubjects)
+{
+    ODL_OBJENTER(); //####
+    ODL_B1("binary = ", binary); //####
+    ODL_LL1("numSubjects = ", numSubjects); //####
+    _binary = binary;
+    if (_binary)
+    {
+        int64_t arrivalTime = static_cast<int64_t>(yarp::os::Time::now() * 1000000.0);
+
+        // Clearing the buffer retains its space, so frames of a similar size do not allocate.
+        _binaryBuffer.erase();
+        appendInt32(_binaryBuffer, UNREAL_FRAME_MAGIC_);
+        appendInt16(_binaryBuffer, UNREAL_FRAME_VERSION_);
+        appendInt16(_binaryBuffer, static_cast<uint16_t>(_source));
+        appendInt32(_binaryBuffer, _sequenceNumber);
+        appendInt32(_binaryBuffer, 0);
+        appendInt64(_binaryBuffer, static_cast<uint64_t>(arrivalTime));
+        appendInt32(_binaryBuffer, static_cast<uint32_t>(numSubjects));
+        appendInt32(_binaryBuffer, 0);
+    }
+    else
+    {
+#if defined(MpM_UseCustomStringBuffer)
+        _textBuffer.reset().addLong(numSubjects).addString(LINE_END_);
+#else // ! defined(MpM_UseCustomStringBuffer)
+        _textBuffer.str("");
+        _textBuffer << numSubjects << LINE_END_;
+#endif // ! defined(MpM_UseCustomStringBuffer)
+    }
+    ODL_OBJEXIT(); //####
+} // UnrealFrameBuilder::startFrame
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,222 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mUnrealFrameBuilder.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the builder of frames sent by the Unreal output service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMUnrealFrameBuilder_HPP_))
+# define MpMUnrealFrameBuilder_HPP_ /* Header guard */
+
+# include <m+m/m+mStringBuffer.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the builder of frames sent by the %Unreal output service.
+
+ A binary frame is made of fixed-size records, with all values in little-endian order:
+
+ - a header of UNREAL_FRAME_HEADER_SIZE_ bytes: the magic number (4 bytes), the format version (2
+ bytes), the source of the data (2 bytes), the sequence number (4 bytes), the number of bytes in the
+ frame, including the header (4 bytes), the time at which the data arrived at the service, in
+ microseconds since the epoch (8 bytes), the number of subjects (4 bytes) and 4 bytes of padding;
+ - for each subject, a record of UNREAL_FRAME_SUBJECT_SIZE_ bytes: the subject name, padded with
+ zero bytes (UNREAL_FRAME_NAME_SIZE_ bytes), the number of segments (4 bytes) and 4 bytes of
+ padding;
+ - for each segment of the subject, a record of UNREAL_FRAME_SEGMENT_SIZE_ bytes: the segment name,
+ padded with zero bytes (UNREAL_FRAME_NAME_SIZE_ bytes) and UNREAL_FRAME_SEGMENT_VALUES_
+ single-precision values; the translation followed by the rotation.
+
+ Each source numbers its frames separately, so that a client can detect frames that were dropped
+ because it was not keeping up. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The marker at the start of a binary frame; the characters 'MPMU'. */
+# define UNREAL_FRAME_MAGIC_          0x554D504D
+
+/*! @brief The version of the binary frame format. */
+# define UNREAL_FRAME_VERSION_        1
+
+/*! @brief The number of bytes in the header of a binary frame. */
+# define UNREAL_FRAME_HEADER_SIZE_    32
+
+/*! @brief The number of bytes reserved for a subject or segment name in a binary frame. */
+# define UNREAL_FRAME_NAME_SIZE_      32
+
+/*! @brief The number of values for each segment. */
+# define UNREAL_FRAME_SEGMENT_VALUES_ 7
+
+/*! @brief The number of bytes in a subject record of a binary frame. */
+# define UNREAL_FRAME_SUBJECT_SIZE_   (UNREAL_FRAME_NAME_SIZE_ + 8)
+
+/*! @brief The number of bytes in a segment record of a binary frame. */
+# define UNREAL_FRAME_SEGMENT_SIZE_   (UNREAL_FRAME_NAME_SIZE_ + (4 * UNREAL_FRAME_SEGMENT_VALUES_))
+
+namespace MplusM
+{
+    namespace Unreal
+    {
+        /*! @brief The source of the data in a frame. */
+        enum UnrealFrameSource
+        {
+            /*! @brief The data came from a %Leap Motion device. */
+            kUnrealFrameSourceLeap  = 1,
+
+            /*! @brief The data came from a Vicon DataStream device. */
+            kUnrealFrameSourceVicon = 2,
+
+            /*! @brief Force the size to be 4 bytes. */
+            kUnrealFrameSourceUnknown = 0x7FFFFFFF
+
+        }; // UnrealFrameSource
+
+        /*! @brief A builder for the frames sent by the %Unreal output service.
+
+         Frames are either in the original tab-separated text form or in the binary form described
+         above; the builder keeps its buffer between frames, so that a steady stream of frames does
+         not allocate memory. */
+        class UnrealFrameBuilder
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] source The source of the data in the frames. */
+            explicit
+            UnrealFrameBuilder(const UnrealFrameSource source);
+
+            /*! @brief The destructor. */
+            virtual
+            ~UnrealFrameBuilder(void);
+
+            /*! @brief Add a segment to the frame.
+             @param[in] name The name of the segment.
+             @param[in] values The translation and rotation of the segment; there are
+             UNREAL_FRAME_SEGMENT_VALUES_ values. */
+            void
+            addSegment(const YarpString & name,
+                       const double *     values);
+
+            /*! @brief Add a subject to the frame; its segments are to follow.
+             @param[in] name The name of the subject.
+             @param[in] numSegments The number of segments of the subject. */
+            void
+            addSubject(const YarpString & name,
+                       const int          numSegments);
+
+            /*! @brief Complete the frame.
+             @param[out] length The number of bytes in the frame.
+             @returns The bytes of the frame. */
+            const char *
+            finishFrame(size_t & length);
+
+            /*! @brief Start a new frame.
+             @param[in] binary @c true if the frame is to be in binary form and @c false if it is to
+             be in text form.
+             @param[in] numSubjects The number of subjects in the frame. */
+            void
+            startFrame(const bool binary,
+                       const int  numSubjects);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            UnrealFrameBuilder(const UnrealFrameBuilder & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            UnrealFrameBuilder &
+            operator =(const UnrealFrameBuilder & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The binary form of the frame. */
+            std::string _binaryBuffer;
+
+# if defined(MpM_UseCustomStringBuffer)
+            /*! @brief The text form of the frame. */
+            Common::StringBuffer _textBuffer;
+# else // ! defined(MpM_UseCustomStringBuffer)
+            /*! @brief The text form of the frame. */
+            std::stringstream _textBuffer;
+
+            /*! @brief The completed text form of the frame. */
+            std::string _textString;
+# endif // ! defined(MpM_UseCustomStringBuffer)
+
+            /*! @brief The source of the data in the frames. */
+            UnrealFrameSource _source;
+
+            /*! @brief The sequence number of the next binary frame. */
+            uint32_t _sequenceNumber;
+
+            /*! @brief @c true if the frame is in binary form and @c false otherwise. */
+            bool _binary;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // UnrealFrameBuilder
+
+    } // Unreal
+
+} // MplusM
+
+#endif // ! defined(MpMUnrealFrameBuilder_HPP_)
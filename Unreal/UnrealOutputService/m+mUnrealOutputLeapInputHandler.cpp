@@ -81,26 +81,18 @@ static const double kLeapScale = 1.0;
 #endif // defined(__APPLE__)
 
 /*! @brief Check the dictionary entry from the finger data.
- @param[in,out] outBuffer The destination character stream.
+ @param[in,out] builder The frame being built.
  @param[in] fingerProps The dictionary to be checked.
  @param[in] scale The translation scale to use.
  @param[out] okSoFar Set to @c false if an unexpected value appears. */
-#if defined(MpM_UseCustomStringBuffer)
 static void
-dumpFingerProps(Common::StringBuffer & outBuffer,
-                yarp::os::Property &   fingerProps,
-                const double           scale,
-                bool &                 okSoFar)
-#else // ! defined(MpM_UseCustomStringBuffer)
-static void
-dumpFingerProps(std::stringstream &  outBuffer,
+dumpFingerProps(UnrealFrameBuilder & builder,
                 yarp::os::Property & fingerProps,
                 const double         scale,
                 bool &               okSoFar)
-#endif // ! defined(MpM_UseCustomStringBuffer)
 {
     ODL_ENTER(); //####
-    ODL_P3("outBuffer = ", &outBuffer, "fingerProps = ", fingerProps, "okSoFar = ", //####
+    ODL_P3("builder = ", &builder, "fingerProps = ", fingerProps, "okSoFar = ", //####
            &okSoFar); //####
     ODL_D1("scale = ", scale); //####
     yarp::os::Value & fingerType(fingerProps.find("type"));
@@ -116,24 +108,19 @@ dumpFingerProps(std::stringstream &  outBuffer,
         if (positionData && (3 == positionData->size()) && directionData &&
             (3 == directionData->size()))
         {
-            cerr << "Segment = " << fingerTag.c_str() << endl; //!!!!
-#if defined(MpM_UseCustomStringBuffer)
-            outBuffer.addString(fingerTag);
-#else // ! defined(MpM_UseCustomStringBuffer)
-            outBuffer << fingerTag.c_str();
-#endif // ! defined(MpM_UseCustomStringBuffer)
+            double values[UNREAL_FRAME_SEGMENT_VALUES_];
+
             for (int jj = 0; okSoFar && (3 > jj); ++jj)
             {
-                double            aValue;
                 yarp::os::Value & anElement = positionData->get(jj);
 
                 if (anElement.isDouble())
                 {
-                    aValue = anElement.asDouble();
+                    values[jj] = anElement.asDouble();
                 }
                 else if (anElement.isInt())
                 {
-                    aValue = anElement.asInt();
+                    values[jj] = anElement.asInt();
                 }
                 else
                 {
@@ -142,49 +129,32 @@ dumpFingerProps(std::stringstream &  outBuffer,
                 }
                 if (okSoFar)
                 {
-                    aValue *= (scale * kLeapScale);
-#if defined(MpM_UseCustomStringBuffer)
-                    outBuffer.addTab().addDouble(aValue);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                    outBuffer << "\t" << aValue;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                    values[jj] *= (scale * kLeapScale);
                 }
             }
             for (int jj = 0; okSoFar && (3 > jj); ++jj)
             {
-                double            aValue;
                 yarp::os::Value & anElement = directionData->get(jj);
 
                 if (anElement.isDouble())
                 {
-                    aValue = anElement.asDouble();
+                    values[jj + 3] = anElement.asDouble();
                 }
                 else if (anElement.isInt())
                 {
-                    aValue = anElement.asInt();
+                    values[jj + 3] = anElement.asInt();
                 }
                 else
                 {
                     cerr << "Bad direction data" << endl; //!!!!
                     okSoFar = false;
                 }
-                if (okSoFar)
-                {
-#if defined(MpM_UseCustomStringBuffer)
-                    outBuffer.addTab().addDouble(aValue);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                    outBuffer << "\t" << aValue;
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                }
             }
             if (okSoFar)
             {
                 // Add a dummy 'w' value.
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addString("\t1" LINE_END_);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << "\t1" LINE_END_;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                values[6] = 1;
+                builder.addSegment(fingerTag, values);
             }
         }
         else
@@ -201,25 +171,18 @@ dumpFingerProps(std::stringstream &  outBuffer,
     ODL_EXIT(); //####
 } // dumpFingerProps
 
-/*! @brief Convert hand data into a character stream.
- @param[in,out] outBuffer The destination character stream.
+/*! @brief Add hand data to a frame.
+ @param[in,out] builder The frame being built.
  @param[in] handData The hand data to write out.
  @param[in] scale The translation scale to use.
  @returns @c true if the had data was properly structured and @c false otherwise. */
-#if defined(MpM_UseCustomStringBuffer)
-static bool
-dumpHandData(Common::StringBuffer & outBuffer,
-             yarp::os::Property &   handData,
-             const double           scale)
-#else // ! defined(MpM_UseCustomStringBuffer)
 static bool
-dumpHandData(std::stringstream &  outBuffer,
+dumpHandData(UnrealFrameBuilder & builder,
              yarp::os::Property & handData,
              const double         scale)
-#endif // ! defined(MpM_UseCustomStringBuffer)
 {
     ODL_ENTER(); //####
-    ODL_P2("outBuffer = ", &outBuffer, "handData = ", &handData); //####
+    ODL_P2("builder = ", &builder, "handData = ", &handData); //####
     ODL_D1("scale = ", scale); //####
     bool              okSoFar = true;
     yarp::os::Value & idValue(handData.find("id"));
@@ -235,13 +198,7 @@ dumpHandData(std::stringstream &  outBuffer,
         {
             int fingerCount = fingers->size();
 
-            cerr << "Subject = " << nameTag.c_str() << endl; //!!!!
-#if defined(MpM_UseCustomStringBuffer)
-            outBuffer.addString(nameTag).addTab().addLong(fingerCount).
-                addString("\t0" LINE_END_);
-#else // ! defined(MpM_UseCustomStringBuffer)
-            outBuffer << nameTag.c_str() << "\t" << fingerCount << "\t0" LINE_END_;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+            builder.addSubject(nameTag, fingerCount);
             for (int ii = 0; okSoFar && (fingerCount > ii); ++ii)
             {
                 yarp::os::Value & aFinger = fingers->get(ii);
@@ -252,7 +209,7 @@ dumpHandData(std::stringstream &  outBuffer,
 
                     if (fingerProps)
                     {
-                        dumpFingerProps(outBuffer, *fingerProps, scale, okSoFar);
+                        dumpFingerProps(builder, *fingerProps, scale, okSoFar);
                     }
                     else
                     {
@@ -270,7 +227,7 @@ dumpHandData(std::stringstream &  outBuffer,
 
                         if (ListIsReallyDictionary(*fingerList, fingerProps))
                         {
-                            dumpFingerProps(outBuffer, fingerProps, scale, okSoFar);
+                            dumpFingerProps(builder, fingerProps, scale, okSoFar);
                         }
                         else
                         {
@@ -315,7 +272,7 @@ dumpHandData(std::stringstream &  outBuffer,
 #endif // defined(__APPLE__)
 
 UnrealOutputLeapInputHandler::UnrealOutputLeapInputHandler(UnrealOutputService & owner) :
-    inherited(), _owner(owner), _scale(1.0), _outSocket(INVALID_SOCKET)
+    inherited(), _builder(kUnrealFrameSourceLeap), _owner(owner), _scale(1.0), _binary(false)
 {
     ODL_ENTER(); //####
     ODL_P1("owner = ", &owner); //####
@@ -357,145 +314,85 @@ UnrealOutputLeapInputHandler::handleInput(const yarp::os::Bottle &     input,
     {
         if (_owner.isActive())
         {
-            if (INVALID_SOCKET == _outSocket)
+            if (2 == input.size())
             {
-                cerr << "invalid socket" << endl; //!!!!
-            }
-            else
-            {
-                cerr << "got data" << endl; //!!!!
-                if (2 == input.size())
+                yarp::os::Value & firstTopValue = input.get(0);
+                yarp::os::Value & secondTopValue = input.get(1);
+
+                if (firstTopValue.isList() && secondTopValue.isList())
                 {
-                    yarp::os::Value & firstTopValue = input.get(0);
-                    yarp::os::Value & secondTopValue = input.get(1);
+                    yarp::os::Bottle * handList = firstTopValue.asList();
+                    yarp::os::Bottle * toolList = secondTopValue.asList();
 
-                    if (firstTopValue.isList() && secondTopValue.isList())
+                    if (handList && toolList)
                     {
-                        yarp::os::Bottle * handList = firstTopValue.asList();
-                        yarp::os::Bottle * toolList = secondTopValue.asList();
+                        int handCount = handList->size();
 
-                        if (handList && toolList)
+                        if (0 < handCount)
                         {
-                            int handCount = handList->size();
+                            bool okSoFar = true;
 
-                            if (0 < handCount)
+                            _builder.startFrame(_binary, handCount);
+                            for (int ii = 0; okSoFar && (handCount > ii); ++ii)
                             {
-                                bool              okSoFar = true;
-#if (! defined(MpM_UseCustomStringBuffer))
-                                std::stringstream outBuffer;
-#endif // ! defined(MpM_UseCustomStringBuffer)
-
-//                                cerr << "# hands = " << handCount << endl; //!!!!
-#if defined(MpM_UseCustomStringBuffer)
-                                _outBuffer.reset().addLong(handCount).addString(LINE_END_);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                                outBuffer << handCount << LINE_END_;
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                                for (int ii = 0; okSoFar && (handCount > ii); ++ii)
+                                yarp::os::Value & handValue = handList->get(ii);
+
+                                if (handValue.isDict())
                                 {
-                                    yarp::os::Value & handValue = handList->get(ii);
+                                    yarp::os::Property * handData = handValue.asDict();
 
-                                    if (handValue.isDict())
+                                    if (handData)
                                     {
-                                        yarp::os::Property * handData = handValue.asDict();
-
-                                        if (handData)
-                                        {
-#if defined(MpM_UseCustomStringBuffer)
-                                            okSoFar = dumpHandData(_outBuffer, *handData, _scale);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                                            okSoFar = dumpHandData(outBuffer, *handData, _scale);
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                                        }
-                                        else
-                                        {
-                                            cerr << "Bad hand data pointer" << endl; //!!!!
-                                            okSoFar = false;
-                                        }
+                                        okSoFar = dumpHandData(_builder, *handData, _scale);
                                     }
-                                    else if (handValue.isList())
+                                    else
                                     {
-                                        yarp::os::Bottle * asList = handValue.asList();
+                                        cerr << "Bad hand data pointer" << endl; //!!!!
+                                        okSoFar = false;
+                                    }
+                                }
+                                else if (handValue.isList())
+                                {
+                                    yarp::os::Bottle * asList = handValue.asList();
 
-                                        if (asList)
+                                    if (asList)
+                                    {
+                                        yarp::os::Property handData;
+
+                                        if (ListIsReallyDictionary(*asList, handData))
                                         {
-                                            yarp::os::Property handData;
-
-                                            if (ListIsReallyDictionary(*asList, handData))
-                                            {
-#if defined(MpM_UseCustomStringBuffer)
-                                                okSoFar = dumpHandData(_outBuffer, handData,
-                                                                       _scale);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                                                okSoFar = dumpHandData(outBuffer, handData, _scale);
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                                            }
-                                            else
-                                            {
-                                                cerr << "Hand value is not a dictionary" <<
-                                                        endl; //!!!!
-                                                okSoFar = false;
-                                            }
+                                            okSoFar = dumpHandData(_builder, handData, _scale);
                                         }
                                         else
                                         {
-                                            cerr << "Bad hand data pointer" << endl; //!!!!
+                                            cerr << "Hand value is not a dictionary" << endl; //!!!!
                                             okSoFar = false;
                                         }
                                     }
                                     else
                                     {
-                                        cerr << "Hand value is not a dictionary" << endl; //!!!!
+                                        cerr << "Bad hand data pointer" << endl; //!!!!
                                         okSoFar = false;
                                     }
                                 }
-                                if (okSoFar)
+                                else
                                 {
-#if defined(MpM_UseCustomStringBuffer)
-                                    _outBuffer.addString("END" LINE_END_);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                                    outBuffer << "END" LINE_END_;
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                                    const char * outString;
-                                    size_t       outLength;
-#if (! defined(MpM_UseCustomStringBuffer))
-                                    std::string  buffAsString(outBuffer.str());
-#endif // ! defined(MpM_UseCustomStringBuffer)
-
-#if defined(MpM_UseCustomStringBuffer)
-                                    outString = _outBuffer.getString(outLength);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                                    outString = buffAsString.c_str();
-                                    outLength = buffAsString.length();
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                                    if (outString && outLength)
-                                    {
-                                        int retVal = send(_outSocket, outString,
-                                                          static_cast<int>(outLength), 0);
-
-                                        cerr << "send--> " << retVal << endl; //!!!!
-                                        if (0 > retVal)
-                                        {
-                                            _owner.deactivateConnection();
-                                        }
-                                        else
-                                        {
-                                            SendReceiveCounters toBeAdded(0, 0, retVal, 1);
-
-                                            _owner.incrementAuxiliaryCounters(toBeAdded);
-                                        }
-                                    }
+                                    cerr << "Hand value is not a dictionary" << endl; //!!!!
+                                    okSoFar = false;
                                 }
                             }
-                        }
-                        else
-                        {
-                            cerr << "Bad hand or tool list pointer" << endl; //!!!!
+                            if (okSoFar)
+                            {
+                                size_t       outLength;
+                                const char * outString = _builder.finishFrame(outLength);
+
+                                _owner.sendFrame(outString, outLength);
+                            }
                         }
                     }
                     else
                     {
-                        cerr << "Input not just a list of hands and a list of tools" << endl; //!!!!
+                        cerr << "Bad hand or tool list pointer" << endl; //!!!!
                     }
                 }
                 else
@@ -503,6 +400,10 @@ UnrealOutputLeapInputHandler::handleInput(const yarp::os::Bottle &     input,
                     cerr << "Input not just a list of hands and a list of tools" << endl; //!!!!
                 }
             }
+            else
+            {
+                cerr << "Input not just a list of hands and a list of tools" << endl; //!!!!
+            }
         }
     }
     catch (...)
@@ -518,22 +419,22 @@ UnrealOutputLeapInputHandler::handleInput(const yarp::os::Bottle &     input,
 #endif // ! MAC_OR_LINUX_
 
 void
-UnrealOutputLeapInputHandler::setScale(const double newScale)
+UnrealOutputLeapInputHandler::setBinary(const bool useBinary)
 {
     ODL_OBJENTER(); //####
-    ODL_D1("newScale = ", newScale); //####
-    _scale = newScale;
+    ODL_B1("useBinary = ", useBinary); //####
+    _binary = useBinary;
     ODL_OBJEXIT(); //####
-} // UnrealOutputLeapInputHandler::setScale
+} // UnrealOutputLeapInputHandler::setBinary
 
 void
-UnrealOutputLeapInputHandler::setSocket(const SOCKET outSocket)
+UnrealOutputLeapInputHandler::setScale(const double newScale)
 {
     ODL_OBJENTER(); //####
-    ODL_L1("outSocket = ", outSocket); //####
-    _outSocket = outSocket;
+    ODL_D1("newScale = ", newScale); //####
+    _scale = newScale;
     ODL_OBJEXIT(); //####
-} // UnrealOutputLeapInputHandler::setSocket
+} // UnrealOutputLeapInputHandler::setScale
 
 #if defined(__APPLE__)
 # pragma mark Global functions
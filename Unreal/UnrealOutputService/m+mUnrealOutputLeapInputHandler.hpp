@@ -40,8 +40,9 @@
 #if (! defined(MpMUnrealOutputLeapInputHandler_HPP_))
 # define MpMUnrealOutputLeapInputHandler_HPP_ /* Header guard */
 
+# include "m+mUnrealFrameBuilder.hpp"
+
 # include <m+m/m+mBaseInputHandler.hpp>
-# include <m+m/m+mStringBuffer.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -86,16 +87,17 @@ namespace MplusM
             virtual
             ~UnrealOutputLeapInputHandler(void);
 
+            /*! @brief Set the form of the frames that are sent.
+             @param[in] useBinary @c true if frames are to be sent in binary form and @c false if
+             they are to be sent in text form. */
+            void
+            setBinary(const bool useBinary);
+
             /*! @brief Set the translation scale.
              @param[in] newScale The scale factor for translation values. */
             void
             setScale(const double newScale);
 
-            /*! @brief Set the network socket to be written to.
-             @param[in] outSocket The network socket to be written to. */
-            void
-            setSocket(const SOCKET outSocket);
-
         protected :
 
         private :
@@ -128,19 +130,27 @@ namespace MplusM
 
         private :
 
+            /*! @brief The builder for the output frames. */
+            UnrealFrameBuilder _builder;
+
             /*! @brief The service that this handler is connected to. */
             UnrealOutputService & _owner;
 
             /*! @brief The translation scale to be used. */
             double _scale;
 
-            /*! @brief The network socket that is to be written to. */
-            SOCKET _outSocket;
+            /*! @brief @c true if frames are sent in binary form and @c false otherwise. */
+            bool _binary;
 
-# if defined(MpM_UseCustomStringBuffer)
-            /*! @brief The buffer to hold the output data. */
-            Common::StringBuffer _outBuffer;
-# endif // defined(MpM_UseCustomStringBuffer)
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
 
         }; // UnrealOutputLeapInputHandler
 
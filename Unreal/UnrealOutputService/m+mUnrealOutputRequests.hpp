@@ -56,4 +56,17 @@
 /*! @brief The channel-independent name of the %Unreal output service. */
 # define MpM_UNREALOUTPUT_CANONICAL_NAME_ "UnrealOutput"
 
+/*! @brief The default maximum number of frames waiting to be sent to a client. */
+# define UNREALOUTPUT_DEFAULT_QUEUE_LENGTH_ 4
+
+/*! @brief The metrics key for the number of clients that are connected. */
+# define MpM_UNREALOUTPUT_CLIENTS_  "clients"
+
+/*! @brief The metrics key for the number of clients that have connected. */
+# define MpM_UNREALOUTPUT_ACCEPTED_ "accepted"
+
+/*! @brief The metrics key for the number of frames discarded because a client was not keeping
+ up. */
+# define MpM_UNREALOUTPUT_DROPPED_  "dropped"
+
 #endif // ! defined(MpMUnrealOutputRequests_HPP_)
@@ -0,0 +1,434 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mUnrealOutputSenderThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the thread that sends frames to the Unreal output clients.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mUnrealOutputSenderThread.hpp"
+#include "m+mUnrealOutputService.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_
+# include <fcntl.h>
+# include <netinet/in.h>
+# include <netinet/tcp.h>
+# include <poll.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the thread that sends frames to the %Unreal output clients. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Unreal;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of milliseconds to wait for a client to become ready, so that a request to
+ stop is noticed promptly. */
+static const int kPollInterval = 100;
+
+/*! @brief The size of the buffer used to discard data sent by a client. */
+static const size_t kDiscardBufferSize = 256;
+
+#if defined(MSG_NOSIGNAL)
+/*! @brief The flags for sending to a client; a client that has gone away must not raise a
+ signal. */
+static const int kSendFlags = MSG_NOSIGNAL;
+#else // ! defined(MSG_NOSIGNAL)
+/*! @brief The flags for sending to a client. */
+static const int kSendFlags = 0;
+#endif // ! defined(MSG_NOSIGNAL)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Close a network connection.
+ @param[in] aSocket The connection to be closed. */
+static void
+closeConnection(SOCKET aSocket)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("aSocket = ", aSocket); //####
+#if MAC_OR_LINUX_
+    shutdown(aSocket, SHUT_RDWR);
+    close(aSocket);
+#else // ! MAC_OR_LINUX_
+    shutdown(aSocket, SD_BOTH);
+    closesocket(aSocket);
+#endif // ! MAC_OR_LINUX_
+    ODL_EXIT(); //####
+} // closeConnection
+
+/*! @brief Return @c true if the last socket operation failed only because it would have waited.
+ @returns @c true if the last socket operation would have waited and @c false otherwise. */
+static bool
+wouldHaveWaited(void)
+{
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    bool result = ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno));
+#else // ! MAC_OR_LINUX_
+    bool result = (WSAEWOULDBLOCK == WSAGetLastError());
+#endif // ! MAC_OR_LINUX_
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // wouldHaveWaited
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+UnrealOutputSenderThread::UnrealOutputSenderThread(UnrealOutputService & owner,
+                                                   SOCKET                listenSocket,
+                                                   const size_t          maxQueueLength) :
+    inherited(), _lock(), _clients(), _owner(owner),
+    _maxQueueLength(maxQueueLength ? maxQueueLength : 1), _listenSocket(listenSocket)
+{
+    ODL_ENTER(); //####
+    ODL_P1("owner = ", &owner); //####
+    ODL_LL2("listenSocket = ", listenSocket, "maxQueueLength = ", maxQueueLength); //####
+    memset(&_statistics, 0, sizeof(_statistics));
+    ODL_EXIT_P(this); //####
+} // UnrealOutputSenderThread::UnrealOutputSenderThread
+
+UnrealOutputSenderThread::~UnrealOutputSenderThread(void)
+{
+    ODL_OBJENTER(); //####
+    for (ClientVector::iterator walker(_clients.begin()); _clients.end() != walker; ++walker)
+    {
+        closeConnection((*walker)->_socket);
+        delete *walker;
+    }
+    _clients.clear();
+    if (INVALID_SOCKET != _listenSocket)
+    {
+        closeConnection(_listenSocket);
+    }
+    ODL_OBJEXIT(); //####
+} // UnrealOutputSenderThread::~UnrealOutputSenderThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+UnrealOutputSenderThread::acceptClients(void)
+{
+    ODL_OBJENTER(); //####
+    for (SOCKET newSocket = accept(_listenSocket, NULL, NULL); INVALID_SOCKET != newSocket;
+         newSocket = accept(_listenSocket, NULL, NULL))
+    {
+        int           noDelay = 1;
+        ClientState * newClient = new ClientState;
+#if MAC_OR_LINUX_
+# if defined(SO_NOSIGPIPE)
+        int           noSignal = 1;
+# endif // defined(SO_NOSIGPIPE)
+#else // ! MAC_OR_LINUX_
+        u_long        nonBlocking = 1;
+#endif // ! MAC_OR_LINUX_
+
+        // Frames are small and time-sensitive, so they are not held back to be combined.
+        setsockopt(newSocket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<char *>(&noDelay),
+                   sizeof(noDelay));
+#if MAC_OR_LINUX_
+        fcntl(newSocket, F_SETFL, fcntl(newSocket, F_GETFL, 0) | O_NONBLOCK);
+# if defined(SO_NOSIGPIPE)
+        setsockopt(newSocket, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+# endif // defined(SO_NOSIGPIPE)
+#else // ! MAC_OR_LINUX_
+        ioctlsocket(newSocket, FIONBIO, &nonBlocking);
+#endif // ! MAC_OR_LINUX_
+        newClient->_sentOffset = 0;
+        newClient->_socket = newSocket;
+        newClient->_closed = false;
+        _lock.lock();
+        _clients.push_back(newClient);
+        ++_statistics._clientsAccepted;
+        _lock.unlock();
+    }
+    ODL_OBJEXIT(); //####
+} // UnrealOutputSenderThread::acceptClients
+
+void
+UnrealOutputSenderThread::addFrame(const char * data,
+                                   const size_t length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("data = ", data); //####
+    ODL_LL1("length = ", length); //####
+    _lock.lock();
+    ++_statistics._framesOffered;
+    for (ClientVector::iterator walker(_clients.begin()); _clients.end() != walker; ++walker)
+    {
+        ClientState & aClient = **walker;
+
+        if (! aClient._closed)
+        {
+            if (_maxQueueLength <= aClient._frames.size())
+            {
+                // A frame that has been partly sent must be completed, or the client would lose
+                // its place in the stream, so the oldest frame that has not been started is
+                // discarded.
+                FrameQueue::iterator stale(aClient._frames.begin());
+
+                if (0 < aClient._sentOffset)
+                {
+                    ++stale;
+                }
+                if (aClient._frames.end() != stale)
+                {
+                    aClient._frames.erase(stale);
+                    ++_statistics._framesDropped;
+                }
+            }
+            aClient._frames.push_back(std::string(data, length));
+            flushClient(aClient);
+        }
+    }
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // UnrealOutputSenderThread::addFrame
+
+void
+UnrealOutputSenderThread::discardInput(ClientState & aClient)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aClient = ", &aClient); //####
+    char discardBuffer[kDiscardBufferSize];
+
+    for ( ; ; )
+    {
+        int received = static_cast<int>(recv(aClient._socket, discardBuffer,
+                                             sizeof(discardBuffer), 0));
+
+        if (0 == received)
+        {
+            // The client has closed its end of the connection.
+            aClient._closed = true;
+            break;
+        }
+        if (0 > received)
+        {
+            if (! wouldHaveWaited())
+            {
+                aClient._closed = true;
+            }
+            break;
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // UnrealOutputSenderThread::discardInput
+
+void
+UnrealOutputSenderThread::flushClient(ClientState & aClient)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aClient = ", &aClient); //####
+    for ( ; (! aClient._closed) && (! aClient._frames.empty()); )
+    {
+        const std::string & aFrame = aClient._frames.front();
+        size_t              remaining = (aFrame.length() - aClient._sentOffset);
+#if MAC_OR_LINUX_
+        int                 sent = static_cast<int>(send(aClient._socket,
+                                                         aFrame.data() + aClient._sentOffset,
+                                                         remaining, kSendFlags));
+#else // ! MAC_OR_LINUX_
+        int                 sent = send(aClient._socket, aFrame.data() + aClient._sentOffset,
+                                        static_cast<int>(remaining), kSendFlags);
+#endif // ! MAC_OR_LINUX_
+
+        if (0 < sent)
+        {
+            aClient._sentOffset += sent;
+            if (aFrame.length() <= aClient._sentOffset)
+            {
+                SendReceiveCounters toBeAdded(0, 0, aFrame.length(), 1);
+
+                _owner.incrementAuxiliaryCounters(toBeAdded);
+                ++_statistics._framesSent;
+                _statistics._bytesSent += aFrame.length();
+                aClient._frames.pop_front();
+                aClient._sentOffset = 0;
+            }
+        }
+        else
+        {
+            if ((0 > sent) && (! wouldHaveWaited()))
+            {
+                aClient._closed = true;
+            }
+            break;
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // UnrealOutputSenderThread::flushClient
+
+void
+UnrealOutputSenderThread::getStatistics(UnrealOutputStatistics & statistics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("statistics = ", &statistics); //####
+    _lock.lock();
+    statistics = _statistics;
+    statistics._numClients = _clients.size();
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // UnrealOutputSenderThread::getStatistics
+
+void
+UnrealOutputSenderThread::removeClosedClients(void)
+{
+    ODL_OBJENTER(); //####
+    size_t kept = 0;
+
+    for (size_t ii = 0, mm = _clients.size(); mm > ii; ++ii)
+    {
+        ClientState * aClient = _clients[ii];
+
+        if (aClient->_closed)
+        {
+            closeConnection(aClient->_socket);
+            delete aClient;
+        }
+        else
+        {
+            _clients[kept++] = aClient;
+        }
+    }
+    _clients.resize(kept);
+    ODL_OBJEXIT(); //####
+} // UnrealOutputSenderThread::removeClosedClients
+
+void
+UnrealOutputSenderThread::run(void)
+{
+    ODL_OBJENTER(); //####
+#if MAC_OR_LINUX_
+    std::vector<pollfd> pollSet;
+#else // ! MAC_OR_LINUX_
+    std::vector<WSAPOLLFD> pollSet;
+#endif // ! MAC_OR_LINUX_
+
+    for ( ; ! isStopping(); )
+    {
+        size_t numClients;
+
+        // Only this thread adds or removes clients, so the clients that are polled are still in
+        // the same positions when the results are examined.
+        pollSet.resize(1);
+        pollSet[0].fd = _listenSocket;
+        pollSet[0].events = POLLIN;
+        pollSet[0].revents = 0;
+        _lock.lock();
+        numClients = _clients.size();
+        pollSet.resize(numClients + 1);
+        for (size_t ii = 0; numClients > ii; ++ii)
+        {
+            ClientState * aClient = _clients[ii];
+
+            pollSet[ii + 1].fd = aClient->_socket;
+            pollSet[ii + 1].events = (aClient->_frames.empty() ? POLLIN : (POLLIN | POLLOUT));
+            pollSet[ii + 1].revents = 0;
+        }
+        _lock.unlock();
+#if MAC_OR_LINUX_
+        poll(&pollSet[0], static_cast<nfds_t>(pollSet.size()), kPollInterval);
+#else // ! MAC_OR_LINUX_
+        WSAPoll(&pollSet[0], static_cast<ULONG>(pollSet.size()), kPollInterval);
+#endif // ! MAC_OR_LINUX_
+        _lock.lock();
+        for (size_t ii = 0; numClients > ii; ++ii)
+        {
+            ClientState & aClient = *_clients[ii];
+            short         events = pollSet[ii + 1].revents;
+
+            if (events & (POLLERR | POLLNVAL))
+            {
+                aClient._closed = true;
+            }
+            else
+            {
+                if (events & (POLLIN | POLLHUP))
+                {
+                    discardInput(aClient);
+                }
+                if (events & POLLOUT)
+                {
+                    flushClient(aClient);
+                }
+            }
+        }
+        removeClosedClients();
+        _lock.unlock();
+        if (pollSet[0].revents & POLLIN)
+        {
+            acceptClients();
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // UnrealOutputSenderThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
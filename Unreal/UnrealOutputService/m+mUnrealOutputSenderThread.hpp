@@ -0,0 +1,234 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mUnrealOutputSenderThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the thread that sends frames to the Unreal output clients.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMUnrealOutputSenderThread_HPP_))
+# define MpMUnrealOutputSenderThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# include <deque>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the thread that sends frames to the %Unreal output clients. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Unreal
+    {
+        class UnrealOutputService;
+
+        /*! @brief A snapshot of the activity of the sender thread. */
+        struct UnrealOutputStatistics
+        {
+            /*! @brief The number of clients that are connected. */
+            size_t _numClients;
+
+            /*! @brief The number of clients that have connected. */
+            int64_t _clientsAccepted;
+
+            /*! @brief The number of frames handed to the thread. */
+            int64_t _framesOffered;
+
+            /*! @brief The number of frames discarded because a client was not keeping up. */
+            int64_t _framesDropped;
+
+            /*! @brief The number of frames written to the clients. */
+            int64_t _framesSent;
+
+            /*! @brief The number of bytes written to the clients. */
+            int64_t _bytesSent;
+
+        }; // UnrealOutputStatistics
+
+        /*! @brief A thread that accepts %Unreal clients and writes frames to them.
+
+         Any number of clients can be connected at once. Each client has its own queue of frames,
+         and the sockets never block; when a client falls behind and its queue is full, its oldest
+         waiting frame is discarded, so that a slow client neither delays the other clients nor
+         the input handlers. Frames are written as soon as they are added, if the client can take
+         them, and otherwise by the thread when the client is ready. */
+        class UnrealOutputSenderThread : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+            /*! @brief The queue of frames waiting to be sent to a client. */
+            typedef std::deque<std::string> FrameQueue;
+
+            /*! @brief The state of a connected client. */
+            struct ClientState
+            {
+                /*! @brief The frames waiting to be sent. */
+                FrameQueue _frames;
+
+                /*! @brief The number of bytes of the first waiting frame that have been sent. */
+                size_t _sentOffset;
+
+                /*! @brief The connection to the client. */
+                SOCKET _socket;
+
+                /*! @brief @c true if the connection has failed or been closed and @c false
+                 otherwise. */
+                bool _closed;
+
+            }; // ClientState
+
+            /*! @brief The connected clients. */
+            typedef std::vector<ClientState *> ClientVector;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] owner The service that the thread sends for.
+             @param[in] listenSocket The socket that clients connect to; the thread takes ownership
+             of the socket.
+             @param[in] maxQueueLength The maximum number of frames that can be waiting for a
+             client. */
+            UnrealOutputSenderThread(UnrealOutputService & owner,
+                                     SOCKET                listenSocket,
+                                     const size_t          maxQueueLength);
+
+            /*! @brief The destructor. */
+            virtual
+            ~UnrealOutputSenderThread(void);
+
+            /*! @brief Add a frame to be sent to each connected client.
+
+             This never waits for a client.
+             @param[in] data The bytes of the frame.
+             @param[in] length The number of bytes in the frame. */
+            void
+            addFrame(const char * data,
+                     const size_t length);
+
+            /*! @brief Retrieve the activity of the thread.
+             @param[out] statistics The activity of the thread. */
+            void
+            getStatistics(UnrealOutputStatistics & statistics);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            UnrealOutputSenderThread(const UnrealOutputSenderThread & other);
+
+            /*! @brief Accept the clients that are waiting to connect. */
+            void
+            acceptClients(void);
+
+            /*! @brief Read and discard any data sent by a client, noting if it has disconnected.
+             @param[in,out] aClient The client to be read from. */
+            void
+            discardInput(ClientState & aClient);
+
+            /*! @brief Write as much of the waiting frames for a client as it can take.
+             @param[in,out] aClient The client to be written to. */
+            void
+            flushClient(ClientState & aClient);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            UnrealOutputSenderThread &
+            operator =(const UnrealOutputSenderThread & other);
+
+            /*! @brief Disconnect the clients that have failed or closed their connections. */
+            void
+            removeClosedClients(void);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock for the clients and the activity. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The connected clients. */
+            ClientVector _clients;
+
+            /*! @brief The service that the thread sends for. */
+            UnrealOutputService & _owner;
+
+            /*! @brief The activity of the thread. */
+            UnrealOutputStatistics _statistics;
+
+            /*! @brief The maximum number of frames that can be waiting for a client. */
+            size_t _maxQueueLength;
+
+            /*! @brief The socket that clients connect to. */
+            SOCKET _listenSocket;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // UnrealOutputSenderThread
+
+    } // Unreal
+
+} // MplusM
+
+#endif // ! defined(MpMUnrealOutputSenderThread_HPP_)
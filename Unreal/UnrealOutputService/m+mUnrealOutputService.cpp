@@ -39,6 +39,7 @@
 #include "m+mUnrealOutputService.hpp"
 #include "m+mUnrealOutputLeapInputHandler.hpp"
 #include "m+mUnrealOutputRequests.hpp"
+#include "m+mUnrealOutputSenderThread.hpp"
 #include "m+mUnrealOutputViconInputHandler.hpp"
 
 #include <m+m/m+mEndpoint.hpp>
@@ -47,6 +48,12 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#if MAC_OR_LINUX_
+# include <fcntl.h>
+# include <netinet/in.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -80,6 +87,78 @@ using std::endl;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Create a socket that listens for clients on a port.
+
+ The socket does not block, so that clients can be accepted as they arrive.
+ @param[in] port The port to listen on.
+ @returns The socket or @c INVALID_SOCKET if the socket could not be set up. */
+static SOCKET
+openListenSocket(const int port)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("port = ", port); //####
+    SOCKET             listenSocket = INVALID_SOCKET;
+    int                reuseAddress = 1;
+    struct sockaddr_in addr;
+#if (! MAC_OR_LINUX_)
+    WORD               wVersionRequested = MAKEWORD(2, 2);
+    WSADATA            ww;
+    u_long             nonBlocking = 1;
+#endif // ! MAC_OR_LINUX_
+
+#if (! MAC_OR_LINUX_)
+    if (WSAStartup(wVersionRequested, &ww))
+    {
+        cerr << "Could not start up WSA" << endl;
+        ODL_EXIT_L(static_cast<long>(listenSocket)); //####
+        return listenSocket;
+    }
+    if ((2 != LOBYTE(ww.wVersion)) || (2 != HIBYTE(ww.wVersion)))
+    {
+        cerr << "WSA version not available" << endl;
+        WSACleanup();
+        ODL_EXIT_L(static_cast<long>(listenSocket)); //####
+        return listenSocket;
+    }
+#endif // ! MAC_OR_LINUX_
+    listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (INVALID_SOCKET == listenSocket)
+    {
+        cerr << "Could not create socket." << endl;
+    }
+    else
+    {
+        // Allow the service to be restarted while connections from an earlier run are closing.
+        setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR,
+                   reinterpret_cast<char *>(&reuseAddress), sizeof(reuseAddress));
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (bind(listenSocket, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)))
+        {
+            cerr << "Could not bind to socket." << endl;
+#if MAC_OR_LINUX_
+            close(listenSocket);
+#else // ! MAC_OR_LINUX_
+            closesocket(listenSocket);
+#endif // ! MAC_OR_LINUX_
+            listenSocket = INVALID_SOCKET;
+        }
+        else
+        {
+#if MAC_OR_LINUX_
+            fcntl(listenSocket, F_SETFL, fcntl(listenSocket, F_GETFL, 0) | O_NONBLOCK);
+#else // ! MAC_OR_LINUX_
+            ioctlsocket(listenSocket, FIONBIO, &nonBlocking);
+#endif // ! MAC_OR_LINUX_
+            listen(listenSocket, SOMAXCONN);
+        }
+    }
+    ODL_EXIT_L(static_cast<long>(listenSocket)); //####
+    return listenSocket;
+} // openListenSocket
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -97,9 +176,9 @@ UnrealOutputService::UnrealOutputService(const Utilities::DescriptorVector & arg
                                          const YarpString &                  servicePortNumber) :
     inherited(argumentList, launchPath, argc, argv, tag, true, MpM_UNREALOUTPUT_CANONICAL_NAME_,
               UNREALOUTPUT_SERVICE_DESCRIPTION_, "", serviceEndpointName, servicePortNumber),
-    _translationScale(1.0), _outPort(9876), _networkSocket(INVALID_SOCKET),
-    _inLeapHandler(new UnrealOutputLeapInputHandler(*this)),
-    _inViconHandler(new UnrealOutputViconInputHandler(*this))
+    _translationScale(1.0), _senderLock(), _inLeapHandler(new UnrealOutputLeapInputHandler(*this)),
+    _inViconHandler(new UnrealOutputViconInputHandler(*this)), _sender(NULL),
+    _maxQueueLength(UNREALOUTPUT_DEFAULT_QUEUE_LENGTH_), _outPort(9876), _useBinary(false)
 {
     ODL_ENTER(); //####
     ODL_P2("argumentList = ", &argumentList, "argv = ", argv); //####
@@ -136,7 +215,39 @@ UnrealOutputService::configure(const yarp::os::Bottle & details)
             yarp::os::Value firstValue(details.get(0));
             yarp::os::Value secondValue(details.get(1));
 
-            if (firstValue.isInt() && secondValue.isDouble())
+            bool            inRange = true;
+            bool            okSoFar = (firstValue.isInt() && secondValue.isDouble());
+
+            // The frame form and queue length are optional, to allow older configurations to be
+            // used.
+            if (okSoFar && (4 <= details.size()))
+            {
+                yarp::os::Value thirdValue(details.get(2));
+                yarp::os::Value fourthValue(details.get(3));
+
+                if (thirdValue.isInt() && fourthValue.isInt())
+                {
+                    int fourthNumber = fourthValue.asInt();
+
+                    if (0 < fourthNumber)
+                    {
+                        _useBinary = (0 != thirdValue.asInt());
+                        _maxQueueLength = static_cast<size_t>(fourthNumber);
+                        ODL_B1("_useBinary <- ", _useBinary); //####
+                        ODL_LL1("_maxQueueLength <- ", _maxQueueLength); //####
+                    }
+                    else
+                    {
+                        cerr << "One or more inputs are out of range." << endl;
+                        inRange = okSoFar = false;
+                    }
+                }
+                else
+                {
+                    okSoFar = false;
+                }
+            }
+            if (okSoFar)
             {
                 std::stringstream buff;
 
@@ -145,11 +256,12 @@ UnrealOutputService::configure(const yarp::os::Bottle & details)
                 _translationScale = secondValue.asDouble();
                 ODL_D1("_translationScale <- ", _translationScale); //####
                 buff << "Output port is " << _outPort << ", translation scale is " <<
-                        _translationScale;
+                        _translationScale << ", frames are " << (_useBinary ? "binary" : "text") <<
+                        ", queue length is " << _maxQueueLength;
                 setExtraInformation(buff.str());
                 result = true;
             }
-            else
+            else if (inRange)
             {
                 cerr << "One or more inputs have the wrong type." << endl;
             }
@@ -173,26 +285,15 @@ UnrealOutputService::deactivateConnection(void)
 {
     ODL_ENTER(); //####
     clearActive();
-    cerr << "connection is dead" << endl; //!!!!
-    if (_inLeapHandler)
+    _senderLock.lock();
+    if (_sender)
     {
-        _inLeapHandler->setSocket(INVALID_SOCKET);
-    }
-    if (_inViconHandler)
-    {
-        _inViconHandler->setSocket(INVALID_SOCKET);
-    }
-    if (INVALID_SOCKET != _networkSocket)
-    {
-#if MAC_OR_LINUX_
-        shutdown(_networkSocket, SHUT_RDWR);
-        close(_networkSocket);
-#else // ! MAC_OR_LINUX_
-        shutdown(_networkSocket, SD_BOTH);
-        closesocket(_networkSocket);
-#endif // ! MAC_OR_LINUX_
-        _networkSocket = INVALID_SOCKET;
+        // Stopping the sender closes the client connections and the listening socket.
+        _sender->stop();
+        delete _sender;
+        _sender = NULL;
     }
+    _senderLock.unlock();
     ODL_EXIT(); //####
 } // UnrealOutputService::deactivateConnection
 
@@ -228,6 +329,35 @@ UnrealOutputService::enableMetrics(void)
     ODL_OBJEXIT(); //####
 } // UnrealOutputService::enableMetrics
 
+void
+UnrealOutputService::gatherMetrics(yarp::os::Bottle & metrics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("metrics = ", &metrics); //####
+    inherited::gatherMetrics(metrics);
+    _senderLock.lock();
+    if (_sender)
+    {
+        UnrealOutputStatistics statistics;
+
+        _sender->getStatistics(statistics);
+        SendReceiveCounters counters(0, 0, statistics._bytesSent,
+                                     static_cast<size_t>(statistics._framesSent));
+
+        counters.addToList(metrics, getEndpoint().getName() + "/clients");
+        yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+        if (props)
+        {
+            props->put(MpM_UNREALOUTPUT_CLIENTS_, static_cast<int>(statistics._numClients));
+            props->put(MpM_UNREALOUTPUT_ACCEPTED_, static_cast<int>(statistics._clientsAccepted));
+            props->put(MpM_UNREALOUTPUT_DROPPED_, static_cast<int>(statistics._framesDropped));
+        }
+    }
+    _senderLock.unlock();
+    ODL_OBJEXIT(); //####
+} // UnrealOutputService::gatherMetrics
+
 bool
 UnrealOutputService::getConfiguration(yarp::os::Bottle & details)
 {
@@ -238,10 +368,28 @@ UnrealOutputService::getConfiguration(yarp::os::Bottle & details)
     details.clear();
     details.addInt(_outPort);
     details.addDouble(_translationScale);
+    details.addInt(_useBinary ? 1 : 0);
+    details.addInt(static_cast<int>(_maxQueueLength));
     ODL_OBJEXIT_B(result); //####
     return result;
 } // UnrealOutputService::getConfiguration
 
+void
+UnrealOutputService::sendFrame(const char * data,
+                               const size_t length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("data = ", data); //####
+    ODL_LL1("length = ", length); //####
+    _senderLock.lock();
+    if (_sender)
+    {
+        _sender->addFrame(data, length);
+    }
+    _senderLock.unlock();
+    ODL_OBJEXIT(); //####
+} // UnrealOutputService::sendFrame
+
 bool
 UnrealOutputService::setUpStreamDescriptions(void)
 {
@@ -276,134 +424,36 @@ UnrealOutputService::startStreams(void)
     ODL_OBJENTER(); //####
     try
     {
-        if (! isActive())
+        if ((! isActive()) && _inLeapHandler && _inViconHandler)
         {
-            if (_inLeapHandler && _inViconHandler)
-            {
-#if MAC_OR_LINUX_
-                SOCKET listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-#else // ! MAC_OR_LINUX_
-                WORD    wVersionRequested = MAKEWORD(2, 2);
-                WSADATA ww;
-#endif // ! MAC_OR_LINUX_
+            SOCKET listenSocket = openListenSocket(_outPort);
 
-#if MAC_OR_LINUX_
-                if (INVALID_SOCKET == listenSocket)
-                {
-                    cerr << "Could not create socket." << endl;
-                }
-                else
-                {
-                    struct sockaddr_in addr;
-
-                    memset(&addr, 0, sizeof(addr));
-                    addr.sin_family = AF_INET;
-                    addr.sin_port = htons(_outPort);
-                    addr.sin_addr.s_addr = htonl(INADDR_ANY);
-                    if (bind(listenSocket, reinterpret_cast<struct sockaddr *>(&addr),
-                             sizeof(addr)))
-                    {
-                        cerr << "Could not bind to socket." << endl;
-                    }
-                    else
-                    {
-                        listen(listenSocket, SOMAXCONN);
-                        _networkSocket = accept(listenSocket, 0, 0);
-                        if (INVALID_SOCKET == _networkSocket)
-                        {
-                            cerr << "Could not accept connection." << endl;
-                        }
-                        else
-                        {
-                            _inLeapHandler->setSocket(_networkSocket);
-                            _inLeapHandler->setScale(_translationScale);
-                            _inLeapHandler->setChannel(getInletStream(0));
-                            getInletStream(0)->setReader(*_inLeapHandler);
-                            _inViconHandler->setSocket(_networkSocket);
-                            _inViconHandler->setScale(_translationScale);
-                            _inViconHandler->setChannel(getInletStream(1));
-                            getInletStream(1)->setReader(*_inViconHandler);
-                            setActive();
-                        }
-                    }
-                    close(listenSocket);
-                }
-#else // ! MAC_OR_LINUX_
-                if (WSAStartup(wVersionRequested, &ww))
+            if (INVALID_SOCKET != listenSocket)
+            {
+                _senderLock.lock();
+                // The sender thread owns the listening socket from here on.
+                _sender = new UnrealOutputSenderThread(*this, listenSocket, _maxQueueLength);
+                if (_sender->start())
                 {
-                    cerr << "Could not start up WSA" << endl;
+                    _senderLock.unlock();
+                    _inLeapHandler->setBinary(_useBinary);
+                    _inLeapHandler->setScale(_translationScale);
+                    _inLeapHandler->setChannel(getInletStream(0));
+                    getInletStream(0)->setReader(*_inLeapHandler);
+                    _inViconHandler->setBinary(_useBinary);
+                    _inViconHandler->setScale(_translationScale);
+                    _inViconHandler->setChannel(getInletStream(1));
+                    getInletStream(1)->setReader(*_inViconHandler);
+                    setActive();
                 }
                 else
                 {
-                    if ((2 == LOBYTE(ww.wVersion)) && (2 == HIBYTE(ww.wVersion)))
-                    {
-                        cerr << "creating socket" << endl; //!!!!
-                        SOCKET listenSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-
-                        if (INVALID_SOCKET == listenSocket)
-                        {
-                            cerr << "Could not create socket." << endl;
-                        }
-                        else
-                        {
-                            SOCKADDR_IN addr;
-
-                            addr.sin_family = AF_INET;
-                            addr.sin_port = htons(_outPort);
-                            addr.sin_addr.s_addr = htonl(INADDR_ANY);
-                            cerr << "binding to port" << endl; //!!!!
-                            if (SOCKET_ERROR == bind(listenSocket,
-                                                     reinterpret_cast<LPSOCKADDR>(&addr),
-                                                     sizeof(addr)))
-                            {
-                                cerr << "Could not bind to socket." << endl;
-                            }
-                            else
-                            {
-                                cerr << "listening for connection" << endl; //!!!!
-                                listen(listenSocket, SOMAXCONN);
-                                cerr << "accepting the connection" << endl; //!!!!
-                                _networkSocket = accept(listenSocket, 0, 0);
-                                if (INVALID_SOCKET == _networkSocket)
-                                {
-                                    cerr << "Could not accept connection." << endl;
-                                }
-                                else
-                                {
-                                    cerr << "connection is live" << endl; //!!!!
-                                    _inLeapHandler->setSocket(_networkSocket);
-                                    _inLeapHandler->setScale(_translationScale);
-                                    _inLeapHandler->setChannel(getInletStream(0));
-                                    getInletStream(0)->setReader(*_inLeapHandler);
-                                    _inViconHandler->setSocket(_networkSocket);
-                                    _inViconHandler->setScale(_translationScale);
-                                    _inViconHandler->setChannel(getInletStream(1));
-                                    getInletStream(1)->setReader(*_inViconHandler);
-                                    setActive();
-                                }
-                            }
-                            shutdown(listenSocket, SD_BOTH);
-                            closesocket(listenSocket);
-                        }
-                    }
-                    else
-                    {
-                        cerr << "WSA version not available" << endl;
-                        WSACleanup();
-                    }
+                    ODL_LOG("! (_sender->start())"); //####
+                    cerr << "Could not start sender thread." << endl;
+                    delete _sender;
+                    _sender = NULL;
+                    _senderLock.unlock();
                 }
-#endif // ! MAC_OR_LINUX_
-            }
-            else if (INVALID_SOCKET != _networkSocket)
-            {
-#if MAC_OR_LINUX_
-                shutdown(_networkSocket, SHUT_RDWR);
-                close(_networkSocket);
-#else // ! MAC_OR_LINUX_
-                shutdown(_networkSocket, SD_BOTH);
-                closesocket(_networkSocket);
-#endif // ! MAC_OR_LINUX_
-                _networkSocket = INVALID_SOCKET;
             }
         }
     }
@@ -68,6 +68,7 @@ namespace MplusM
     namespace Unreal
     {
         class UnrealOutputLeapInputHandler;
+        class UnrealOutputSenderThread;
         class UnrealOutputViconInputHandler;
 
         /*! @brief The %Unreal output service. */
@@ -122,6 +123,11 @@ namespace MplusM
             virtual void
             enableMetrics(void);
 
+            /*! @brief Add the metrics for the connected clients to the service metrics.
+             @param[in,out] metrics The gathered metrics. */
+            virtual void
+            gatherMetrics(yarp::os::Bottle & metrics);
+
             /*! @brief Get the configuration of the input/output streams.
              @param[out] details The configuration information for the input/output streams.
              @returns @c true if the configuration was successfully retrieved and @c false
@@ -129,6 +135,15 @@ namespace MplusM
             virtual bool
             getConfiguration(yarp::os::Bottle & details);
 
+            /*! @brief Send a frame to the connected clients.
+
+             This never waits for a client.
+             @param[in] data The bytes of the frame.
+             @param[in] length The number of bytes in the frame. */
+            void
+            sendFrame(const char * data,
+                      const size_t length);
+
             /*! @brief Start the input / output streams. */
             virtual void
             startStreams(void);
@@ -166,18 +181,38 @@ namespace MplusM
             /*! @brief The scale factor to apply to the translation data. */
             double _translationScale;
 
-            /*! @brief The output port number to be used. */
-            int _outPort;
-
-            /*! @brief The network port to write to. */
-            SOCKET _networkSocket;
+            /*! @brief The contention lock for the sender thread. */
+            yarp::os::Mutex _senderLock;
 
-            /*! @brief The handler for input Vicon DataStream data. */
+            /*! @brief The handler for input %Leap Motion data. */
             UnrealOutputLeapInputHandler * _inLeapHandler;
 
             /*! @brief The handler for input Vicon DataStream data. */
             UnrealOutputViconInputHandler * _inViconHandler;
 
+            /*! @brief The thread that accepts clients and writes frames to them. */
+            UnrealOutputSenderThread * _sender;
+
+            /*! @brief The maximum number of frames waiting to be sent to a client. */
+            size_t _maxQueueLength;
+
+            /*! @brief The output port number to be used. */
+            int _outPort;
+
+            /*! @brief @c true if frames are sent in binary form and @c false if they are sent in
+             text form. */
+            bool _useBinary;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[3];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
         }; // UnrealOutputService
 
     } // Unreal
@@ -38,8 +38,12 @@
 
 #include "m+mUnrealOutputService.hpp"
 
+#include "m+mUnrealOutputRequests.hpp"
+
+#include <m+m/m+mBoolArgumentDescriptor.hpp>
 #include <m+m/m+mDoubleArgumentDescriptor.hpp>
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mIntArgumentDescriptor.hpp>
 #include <m+m/m+mPortArgumentDescriptor.hpp>
 
 //#include <odlEnable.h>
@@ -139,7 +143,9 @@ setUpAndGo(const Utilities::DescriptorVector & argumentList,
 /*! @brief The entry point for running the %Unreal output service.
 
  The second, optional, argument is the translation scale factor and the first, optional, argument is
- the port to be written to.
+ the port to be written to. The third, optional, argument is @c 1 if frames are to be sent in the
+ binary form and the fourth, optional, argument is the number of frames that can be waiting for a
+ client before older frames are dropped.
  @param[in] argc The number of arguments in 'argv'.
  @param[in] argv The arguments to be used with the %Unreal output service.
  @returns @c 0 on a successful test and @c 1 on failure. */
@@ -177,10 +183,19 @@ main(int      argc,
         Utilities::DoubleArgumentDescriptor secondArg("scale", T_("Translation scale"),
                                                       Utilities::kArgModeOptionalModifiable, 1,
                                                       true, 0, false, 0);
+        Utilities::BoolArgumentDescriptor   thirdArg("binary", T_("Send frames in binary form"),
+                                                     Utilities::kArgModeOptionalModifiable, false);
+        Utilities::IntArgumentDescriptor    fourthArg("queueLength",
+                                                      T_("Maximum frames waiting for a client"),
+                                                      Utilities::kArgModeOptionalModifiable,
+                                                      UNREALOUTPUT_DEFAULT_QUEUE_LENGTH_, true, 1,
+                                                      false, 0);
         Utilities::DescriptorVector         argumentList;
 
         argumentList.push_back(&firstArg);
         argumentList.push_back(&secondArg);
+        argumentList.push_back(&thirdArg);
+        argumentList.push_back(&fourthArg);
         if (ProcessStandardServiceOptions(argc, argv, argumentList,
                                           UNREALOUTPUT_SERVICE_DESCRIPTION_, "", 2014,
                                           STANDARD_COPYRIGHT_NAME_, goWasSet, reportEndpoint,
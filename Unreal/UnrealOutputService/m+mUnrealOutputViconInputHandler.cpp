@@ -77,25 +77,18 @@ using std::endl;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
-/*! @brief Convert list of segments into a character stream.
- @param[in,out] outBuffer The destination character stream.
+/*! @brief Add a list of segments to a frame.
+ @param[in,out] builder The frame being built.
  @param[in] segmentsAsBottle The segments to write out.
  @param[in] scale The translation scale to use.
  @returns @c true if the segments were properly structured and @c false otherwise. */
-#if defined(MpM_UseCustomStringBuffer)
 static bool
-dumpSegments(Common::StringBuffer & outBuffer,
-             yarp::os::Bottle &     segmentsAsBottle,
-             const double           scale)
-#else // ! defined(MpM_UseCustomStringBuffer)
-static bool
-dumpSegments(std::stringstream & outBuffer,
-             yarp::os::Bottle &  segmentsAsBottle,
-             const double        scale)
-#endif // ! defined(MpM_UseCustomStringBuffer)
+dumpSegments(UnrealFrameBuilder & builder,
+             yarp::os::Bottle &   segmentsAsBottle,
+             const double         scale)
 {
     ODL_ENTER(); //####
-    ODL_P2("outBuffer = ", &outBuffer, "segmentsAsBottle = ", &segmentsAsBottle); //####
+    ODL_P2("builder = ", &builder, "segmentsAsBottle = ", &segmentsAsBottle); //####
     ODL_D1("scale = ", scale); //####
     bool okSoFar = true;
     int  numSegments = segmentsAsBottle.size();
@@ -120,51 +113,36 @@ dumpSegments(std::stringstream & outBuffer,
                         YarpString         keyString = keyValue.asString();
                         yarp::os::Bottle * valueList = valueValue.asList();
 
-#if defined(MpM_UseCustomStringBuffer)
-                        outBuffer.addString(keyString);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                        outBuffer << keyString.c_str();
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                        if (valueList && (7 == valueList->size()))
+                        if (valueList && (UNREAL_FRAME_SEGMENT_VALUES_ == valueList->size()))
                         {
-                            int numValues = valueList->size();
+                            double values[UNREAL_FRAME_SEGMENT_VALUES_];
 
-                            for (int jj = 0; okSoFar && (numValues > jj); ++jj)
+                            for (int jj = 0; okSoFar && (UNREAL_FRAME_SEGMENT_VALUES_ > jj); ++jj)
                             {
-                                double            elementAsDouble;
                                 yarp::os::Value & valueElement = valueList->get(jj);
 
                                 if (valueElement.isDouble())
                                 {
-                                    elementAsDouble = valueElement.asDouble();
+                                    values[jj] = valueElement.asDouble();
                                 }
                                 else if (valueElement.isInt())
                                 {
-                                    elementAsDouble = valueElement.asInt();
+                                    values[jj] = valueElement.asInt();
                                 }
                                 else
                                 {
                                     cerr << "value not an integer or a float" << endl; //!!!!
                                     okSoFar = false;
                                 }
-                                if (okSoFar)
+                                if (okSoFar && (3 > jj))
                                 {
-                                    if (3 > jj)
-                                    {
-                                        elementAsDouble *= scale;
-                                    }
-#if defined(MpM_UseCustomStringBuffer)
-                                    outBuffer.addTab().addDouble(elementAsDouble);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                                    outBuffer << "\t" << elementAsDouble;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                                    values[jj] *= scale;
                                 }
                             }
-#if defined(MpM_UseCustomStringBuffer)
-                            outBuffer.addString(LINE_END_);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                            outBuffer << LINE_END_;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                            if (okSoFar)
+                            {
+                                builder.addSegment(keyString, values);
+                            }
                         }
                         else
                         {
@@ -209,7 +187,7 @@ dumpSegments(std::stringstream & outBuffer,
 #endif // defined(__APPLE__)
 
 UnrealOutputViconInputHandler::UnrealOutputViconInputHandler(UnrealOutputService & owner) :
-    inherited(), _owner(owner), _scale(1.0), _outSocket(INVALID_SOCKET)
+    inherited(), _builder(kUnrealFrameSourceVicon), _owner(owner), _scale(1.0), _binary(false)
 {
     ODL_ENTER(); //####
     ODL_P1("owner = ", &owner); //####
@@ -251,204 +229,127 @@ UnrealOutputViconInputHandler::handleInput(const yarp::os::Bottle &     input,
     {
         if (_owner.isActive())
         {
-            if (INVALID_SOCKET == _outSocket)
-            {
-                cerr << "invalid socket" << endl; //!!!!
-            }
-            else
+            int numSubjects = input.size();
+
+            if (0 < numSubjects)
             {
-                int numSubjects = input.size();
+                bool okSoFar = true;
 
-                if (0 < numSubjects)
+                _builder.startFrame(_binary, numSubjects);
+                for (int ii = 0; okSoFar && (numSubjects > ii); ++ii)
                 {
-                    bool              okSoFar = true;
-#if (! defined(MpM_UseCustomStringBuffer))
-                    std::stringstream outBuffer;
-#endif // ! defined(MpM_UseCustomStringBuffer)
-
-//                    cerr << "# subjects = " << numSubjects << endl; //!!!!
-#if defined(MpM_UseCustomStringBuffer)
-                    _outBuffer.reset().addLong(numSubjects).addString(LINE_END_);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                    outBuffer << numSubjects << LINE_END_;
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                    for (int ii = 0; okSoFar && (numSubjects > ii); ++ii)
+                    yarp::os::Value & aValue = input.get(ii);
+
+                    if (aValue.isList())
                     {
-                        yarp::os::Value & aValue = input.get(ii);
+                        yarp::os::Bottle * asBottle = aValue.asList();
 
-                        if (aValue.isList())
+                        if (asBottle)
                         {
-                            yarp::os::Bottle * asBottle = aValue.asList();
-
-                            if (asBottle)
+                            if (2 == asBottle->size())
                             {
-                                if (2 == asBottle->size())
+                                yarp::os::Value & firstValue = asBottle->get(0);
+
+                                if (firstValue.isString())
                                 {
-                                    yarp::os::Value & firstValue = asBottle->get(0);
+                                    YarpString        subjName = firstValue.asString();
+                                    yarp::os::Value & secondValue = asBottle->get(1);
 
-                                    if (firstValue.isString())
+                                    if (secondValue.isDict())
                                     {
-                                        YarpString        subjName = firstValue.asString();
-                                        yarp::os::Value & secondValue = asBottle->get(1);
+                                        yarp::os::Property * segments = secondValue.asDict();
 
-                                        if (secondValue.isDict())
+                                        if (segments)
                                         {
-                                            yarp::os::Property * segments = secondValue.asDict();
-
-//                                            cerr << subjName.c_str() << endl; //!!!!
-                                            if (segments)
-                                            {
-                                                YarpString       segmentsAsString =
+                                            YarpString       segmentsAsString =
                                                                             segments->toString();
-//                                                cerr << ":" << segments->toString() << //!!!!
-//                                                        ":" << endl; //!!!!
-                                                yarp::os::Bottle segmentsAsBottle =
-                                                                                segmentsAsString;
+                                            yarp::os::Bottle segmentsAsBottle = segmentsAsString;
 
-                                                cerr << ":" << segmentsAsBottle.size() << ":" <<
-                                                        segmentsAsBottle.toString() << ":" <<
-                                                        endl; //!!!!
-#if defined(MpM_UseCustomStringBuffer)
-                                                _outBuffer.addString(subjName).addTab();
-                                                _outBuffer.addLong(segmentsAsBottle.size()).
-                                                    addString("\t0" LINE_END_);
-                                                okSoFar = dumpSegments(_outBuffer, segmentsAsBottle,
-                                                                       _scale);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                                                outBuffer << subjName.c_str() << "\t" <<
-                                                            segmentsAsBottle.size() <<
-                                                            "\t0" LINE_END_;
-                                                okSoFar = dumpSegments(outBuffer, segmentsAsBottle,
-                                                                       _scale);
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                                            }
-                                            else
-                                            {
-                                                cerr << "bad segments pointer" << endl; //!!!!
-                                                okSoFar = false;
-                                            }
+                                            _builder.addSubject(subjName,
+                                                                segmentsAsBottle.size());
+                                            okSoFar = dumpSegments(_builder, segmentsAsBottle,
+                                                                   _scale);
                                         }
-                                        else if (secondValue.isList())
+                                        else
+                                        {
+                                            cerr << "bad segments pointer" << endl; //!!!!
+                                            okSoFar = false;
+                                        }
+                                    }
+                                    else if (secondValue.isList())
+                                    {
+                                        yarp::os::Bottle * asList = secondValue.asList();
+
+                                        if (asList)
                                         {
-                                            yarp::os::Bottle * asList = secondValue.asList();
+                                            yarp::os::Property segments;
 
-                                            if (asList)
+                                            if (ListIsReallyDictionary(*asList, segments))
                                             {
-                                                yarp::os::Property segments;
-
-                                                if (ListIsReallyDictionary(*asList, segments))
-                                                {
-                                                    YarpString       segmentsAsString =
-                                                                                segments.toString();
-//                                                    cerr << ":" << segments->toString() << ":" <<
-//                                                            endl; //!!!!
-                                                    yarp::os::Bottle segmentsAsBottle =
+                                                YarpString       segmentsAsString =
+                                                                            segments.toString();
+                                                yarp::os::Bottle segmentsAsBottle =
                                                                                 segmentsAsString;
 
-                                                    cerr << ":" << segmentsAsBottle.size() << ":" <<
-                                                            segmentsAsBottle.toString() << ":" <<
-                                                            endl; //!!!!
-#if defined(MpM_UseCustomStringBuffer)
-                                                    _outBuffer.addString(subjName).addTab();
-                                                    _outBuffer.addLong(segmentsAsBottle.size()).
-                                                        addString("\t0" LINE_END_);
-                                                    okSoFar = dumpSegments(_outBuffer,
-                                                                           segmentsAsBottle,
-                                                                           _scale);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                                                    outBuffer << subjName.c_str() << "\t" <<
-                                                                segmentsAsBottle.size() <<
-                                                                "\t0" LINE_END_;
-                                                    okSoFar = dumpSegments(outBuffer,
-                                                                           segmentsAsBottle,
-                                                                           _scale);
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                                                }
-                                                else
-                                                {
-                                                    cerr << "not a dictionary" << endl; //!!!!
-                                                    okSoFar = false;
-                                                }
+                                                _builder.addSubject(subjName,
+                                                                    segmentsAsBottle.size());
+                                                okSoFar = dumpSegments(_builder, segmentsAsBottle,
+                                                                       _scale);
                                             }
                                             else
                                             {
-                                                cerr << "bad segments pointer" << endl; //!!!!
+                                                cerr << "not a dictionary" << endl; //!!!!
                                                 okSoFar = false;
                                             }
                                         }
                                         else
                                         {
-                                            cerr << "not a dictionary" << endl; //!!!!
+                                            cerr << "bad segments pointer" << endl; //!!!!
                                             okSoFar = false;
                                         }
                                     }
                                     else
                                     {
-                                        cerr << "not a string" << endl; //!!!!
+                                        cerr << "not a dictionary" << endl; //!!!!
                                         okSoFar = false;
                                     }
                                 }
                                 else
                                 {
-                                    cerr << "not 2 pieces in list" << endl; //!!!!
+                                    cerr << "not a string" << endl; //!!!!
                                     okSoFar = false;
                                 }
                             }
                             else
                             {
-                                cerr << "bad subject pointer" << endl; //!!!!
+                                cerr << "not 2 pieces in list" << endl; //!!!!
                                 okSoFar = false;
                             }
                         }
                         else
                         {
-                            cerr << "subject is not a list" << endl; //!!!!
+                            cerr << "bad subject pointer" << endl; //!!!!
                             okSoFar = false;
                         }
                     }
-                    if (okSoFar)
+                    else
                     {
-#if defined(MpM_UseCustomStringBuffer)
-                        _outBuffer.addString("END" LINE_END_);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                        outBuffer << "END" LINE_END_;
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                        const char * outString;
-                        size_t       outLength;
-#if (! defined(MpM_UseCustomStringBuffer))
-                        std::string  buffAsString(outBuffer.str());
-#endif // ! defined(MpM_UseCustomStringBuffer)
-
-#if defined(MpM_UseCustomStringBuffer)
-                        outString = _outBuffer.getString(outLength);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                        outString = buffAsString.c_str();
-                        outLength = buffAsString.length();
-#endif // ! defined(MpM_UseCustomStringBuffer)
-                        if (outString && outLength)
-                        {
-                            int retVal = send(_outSocket, outString,
-                                              static_cast<int>(outLength), 0);
-
-                            cerr << "send--> " << retVal << endl; //!!!!
-                            if (0 > retVal)
-                            {
-                                _owner.deactivateConnection();
-                            }
-                            else
-                            {
-                                SendReceiveCounters toBeAdded(0, 0, retVal, 1);
-
-                                _owner.incrementAuxiliaryCounters(toBeAdded);
-                            }
-                        }
+                        cerr << "subject is not a list" << endl; //!!!!
+                        okSoFar = false;
                     }
                 }
-                else
+                if (okSoFar)
                 {
-                    cerr << "no subjects" << endl; //!!!!
+                    size_t       outLength;
+                    const char * outString = _builder.finishFrame(outLength);
+
+                    _owner.sendFrame(outString, outLength);
                 }
             }
+            else
+            {
+                cerr << "no subjects" << endl; //!!!!
+            }
         }
     }
     catch (...)
@@ -464,22 +365,22 @@ UnrealOutputViconInputHandler::handleInput(const yarp::os::Bottle &     input,
 #endif // ! MAC_OR_LINUX_
 
 void
-UnrealOutputViconInputHandler::setScale(const double newScale)
+UnrealOutputViconInputHandler::setBinary(const bool useBinary)
 {
     ODL_OBJENTER(); //####
-    ODL_D1("newScale = ", newScale); //####
-    _scale = newScale;
+    ODL_B1("useBinary = ", useBinary); //####
+    _binary = useBinary;
     ODL_OBJEXIT(); //####
-} // UnrealOutputViconInputHandler::setScale
+} // UnrealOutputViconInputHandler::setBinary
 
 void
-UnrealOutputViconInputHandler::setSocket(const SOCKET outSocket)
+UnrealOutputViconInputHandler::setScale(const double newScale)
 {
     ODL_OBJENTER(); //####
-    ODL_L1("outSocket = ", outSocket); //####
-    _outSocket = outSocket;
+    ODL_D1("newScale = ", newScale); //####
+    _scale = newScale;
     ODL_OBJEXIT(); //####
-} // UnrealOutputViconInputHandler::setSocket
+} // UnrealOutputViconInputHandler::setScale
 
 #if defined(__APPLE__)
 # pragma mark Global functions
@@ -0,0 +1,637 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mSimulatedViconClient.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a simulated Vicon DataStream SDK client.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include <m+m/m+mSimulatedSkeletons.hpp>
+
+// Define the client methods here, rather than importing them from the SDK library.
+#define _EXPORTING /* */
+#include <Client.h>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a simulated Vicon DataStream SDK client.
+
+ The client provides the subset of the SDK that is used by the Vicon input services, with the
+ frames coming from a simulated device rather than from a Vicon server. The host name that is
+ passed to Connect() is used as the description of the simulated device. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace ViconDataStreamSDK::CPP;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+namespace ViconDataStreamSDK
+{
+    namespace CPP
+    {
+        /*! @brief The state of a simulated client. */
+        class ClientImpl
+        {
+        public :
+
+            /*! @brief The constructor. */
+            ClientImpl(void) :
+                _source(), _lastSegment(0), _lastSubject(0), _connected(false)
+            {
+            } // ClientImpl
+
+            /*! @brief Locate a segment of the current frame.
+             @param[in] subjectName The name of the subject.
+             @param[in] segmentName The name of the segment.
+             @param[out] result The status of the search.
+             @returns The segment, or @c NULL if it was not found. */
+            const Common::SimulatedSegment *
+            findSegment(const String & subjectName,
+                        const String & segmentName,
+                        Result::Enum & result);
+
+            /*! @brief Locate a subject of the current frame.
+             @param[in] subjectName The name of the subject.
+             @param[out] result The status of the search.
+             @returns The subject, or @c NULL if it was not found. */
+            const Common::SimulatedSubject *
+            findSubject(const String & subjectName,
+                        Result::Enum & result);
+
+            /*! @brief The source of the frames. */
+            Common::SimulatedSkeletonSource _source;
+
+            /*! @brief The index of the most recently requested segment; the segments of a
+             subject are normally requested in order, so this is checked first. */
+            size_t _lastSegment;
+
+            /*! @brief The index of the most recently requested subject; the subjects of a frame
+             are normally requested in order, so this is checked first. */
+            size_t _lastSubject;
+
+            /*! @brief @c true if the client is connected and @c false otherwise. */
+            bool _connected;
+
+        protected :
+
+        private :
+
+        }; // ClientImpl
+
+    } // CPP
+
+} // ViconDataStreamSDK
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+Client::Client(void) :
+    m_pClientImpl(new ClientImpl)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // Client::Client
+
+Client::~Client(void)
+{
+    ODL_OBJENTER(); //####
+    delete m_pClientImpl;
+    ODL_OBJEXIT(); //####
+} // Client::~Client
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+const Common::SimulatedSegment *
+ClientImpl::findSegment(const String & subjectName,
+                        const String & segmentName,
+                        Result::Enum & result)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("result = ", &result); //####
+    const Common::SimulatedSegment * aSegment = NULL;
+    const Common::SimulatedSubject * aSubject = findSubject(subjectName, result);
+
+    if (aSubject)
+    {
+        const Common::SimulatedSegmentVector & segments = aSubject->_segments;
+        std::string                            name(segmentName);
+
+        if ((segments.size() <= _lastSegment) || (segments[_lastSegment]._name != name.c_str()))
+        {
+            _lastSegment = segments.size();
+            for (size_t ii = 0, numSegments = segments.size(); numSegments > ii; ++ii)
+            {
+                if (segments[ii]._name == name.c_str())
+                {
+                    _lastSegment = ii;
+                    break;
+                }
+            }
+        }
+        if (segments.size() > _lastSegment)
+        {
+            aSegment = &segments[_lastSegment];
+        }
+        else
+        {
+            _lastSegment = 0;
+            result = Result::InvalidSegmentName;
+        }
+    }
+    ODL_OBJEXIT_P(aSegment); //####
+    return aSegment;
+} // ClientImpl::findSegment
+
+const Common::SimulatedSubject *
+ClientImpl::findSubject(const String & subjectName,
+                        Result::Enum & result)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("result = ", &result); //####
+    const Common::SimulatedSubject * aSubject = NULL;
+
+    if (_connected)
+    {
+        const Common::SimulatedSubjectVector & subjects = _source.currentFrame();
+        std::string                            name(subjectName);
+
+        if ((subjects.size() <= _lastSubject) || (subjects[_lastSubject]._name != name.c_str()))
+        {
+            _lastSubject = subjects.size();
+            for (size_t ii = 0, numSubjects = subjects.size(); numSubjects > ii; ++ii)
+            {
+                if (subjects[ii]._name == name.c_str())
+                {
+                    _lastSubject = ii;
+                    break;
+                }
+            }
+        }
+        if (subjects.size() > _lastSubject)
+        {
+            aSubject = &subjects[_lastSubject];
+            result = Result::Success;
+        }
+        else
+        {
+            _lastSubject = 0;
+            result = Result::InvalidSubjectName;
+        }
+    }
+    else
+    {
+        result = Result::NotConnected;
+    }
+    ODL_OBJEXIT_P(aSubject); //####
+    return aSubject;
+} // ClientImpl::findSubject
+
+Output_Connect
+Client::Connect(const String & HostName)
+{
+    ODL_OBJENTER(); //####
+    Output_Connect result;
+    std::string    description(HostName);
+    size_t         colonPos = description.rfind(':');
+
+    // Ignore the port number, if present.
+    if ((std::string::npos != colonPos) &&
+        (description.find_first_not_of("0123456789", colonPos + 1) == std::string::npos))
+    {
+        description.erase(colonPos);
+    }
+    if (m_pClientImpl->_connected)
+    {
+        result.Result = Result::ClientAlreadyConnected;
+    }
+    else if (m_pClientImpl->_source.configure(description.c_str()))
+    {
+        m_pClientImpl->_connected = true;
+        result.Result = Result::Success;
+    }
+    else
+    {
+        result.Result = Result::InvalidHostName;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::Connect
+
+Output_Disconnect
+Client::Disconnect(void)
+{
+    ODL_OBJENTER(); //####
+    Output_Disconnect result;
+
+    if (m_pClientImpl->_connected)
+    {
+        m_pClientImpl->_connected = false;
+        result.Result = Result::Success;
+    }
+    else
+    {
+        result.Result = Result::NotConnected;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::Disconnect
+
+Output_EnableMarkerData
+Client::EnableMarkerData(void)
+{
+    ODL_OBJENTER(); //####
+    Output_EnableMarkerData result;
+
+    result.Result = (m_pClientImpl->_connected ? Result::Success : Result::NotConnected);
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::EnableMarkerData
+
+Output_EnableSegmentData
+Client::EnableSegmentData(void)
+{
+    ODL_OBJENTER(); //####
+    Output_EnableSegmentData result;
+
+    result.Result = (m_pClientImpl->_connected ? Result::Success : Result::NotConnected);
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::EnableSegmentData
+
+Output_GetFrame
+Client::GetFrame(void)
+{
+    ODL_OBJENTER(); //####
+    Output_GetFrame result;
+
+    if (m_pClientImpl->_connected)
+    {
+        // As with a server that pushes frames, wait for the next frame to be available.
+        m_pClientImpl->_source.waitForFrame();
+        result.Result = Result::Success;
+    }
+    else
+    {
+        result.Result = Result::NotConnected;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetFrame
+
+Output_GetFrameNumber
+Client::GetFrameNumber(void)
+const
+{
+    ODL_OBJENTER(); //####
+    Output_GetFrameNumber result;
+
+    if (m_pClientImpl->_connected)
+    {
+        result.Result = Result::Success;
+        result.FrameNumber = static_cast<unsigned int>(m_pClientImpl->_source.frameNumber());
+    }
+    else
+    {
+        result.Result = Result::NotConnected;
+        result.FrameNumber = 0;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetFrameNumber
+
+Output_GetLatencyTotal
+Client::GetLatencyTotal(void)
+const
+{
+    ODL_OBJENTER(); //####
+    Output_GetLatencyTotal result;
+
+    if (m_pClientImpl->_connected)
+    {
+        // The latency of a simulated frame is the time since it was due.
+        result.Result = Result::Success;
+        result.Total = std::max(0.0, yarp::os::Time::now() -
+                                m_pClientImpl->_source.frameDueTime());
+    }
+    else
+    {
+        result.Result = Result::NotConnected;
+        result.Total = 0;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetLatencyTotal
+
+Output_GetSegmentCount
+Client::GetSegmentCount(const String & SubjectName)
+const
+{
+    ODL_OBJENTER(); //####
+    Output_GetSegmentCount           result;
+    const Common::SimulatedSubject * aSubject = m_pClientImpl->findSubject(SubjectName,
+                                                                           result.Result);
+
+    result.SegmentCount = (aSubject ? static_cast<unsigned int>(aSubject->_segments.size()) : 0);
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetSegmentCount
+
+Output_GetSegmentGlobalRotationQuaternion
+Client::GetSegmentGlobalRotationQuaternion(const String & SubjectName,
+                                           const String & SegmentName)
+const
+{
+    ODL_OBJENTER(); //####
+    Output_GetSegmentGlobalRotationQuaternion result;
+    const Common::SimulatedSegment *          aSegment =
+                                m_pClientImpl->findSegment(SubjectName, SegmentName, result.Result);
+
+    if (aSegment)
+    {
+        memcpy(result.Rotation, aSegment->_rotation, sizeof(result.Rotation));
+        result.Occluded = aSegment->_occluded;
+    }
+    else
+    {
+        memset(result.Rotation, 0, sizeof(result.Rotation));
+        result.Occluded = false;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetSegmentGlobalRotationQuaternion
+
+Output_GetSegmentGlobalTranslation
+Client::GetSegmentGlobalTranslation(const String & SubjectName,
+                                    const String & SegmentName)
+const
+{
+    ODL_OBJENTER(); //####
+    Output_GetSegmentGlobalTranslation result;
+    const Common::SimulatedSegment *   aSegment = m_pClientImpl->findSegment(SubjectName,
+                                                                             SegmentName,
+                                                                             result.Result);
+
+    if (aSegment)
+    {
+        memcpy(result.Translation, aSegment->_translation, sizeof(result.Translation));
+        result.Occluded = aSegment->_occluded;
+    }
+    else
+    {
+        memset(result.Translation, 0, sizeof(result.Translation));
+        result.Occluded = false;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetSegmentGlobalTranslation
+
+Output_GetSegmentLocalRotationQuaternion
+Client::GetSegmentLocalRotationQuaternion(const String & SubjectName,
+                                          const String & SegmentName)
+const
+{
+    ODL_OBJENTER(); //####
+    // The simulated segments are not arranged in a hierarchy, so the local and global values
+    // are the same.
+    Output_GetSegmentGlobalRotationQuaternion globalResult =
+                                    GetSegmentGlobalRotationQuaternion(SubjectName, SegmentName);
+    Output_GetSegmentLocalRotationQuaternion  result;
+
+    result.Result = globalResult.Result;
+    memcpy(result.Rotation, globalResult.Rotation, sizeof(result.Rotation));
+    result.Occluded = globalResult.Occluded;
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetSegmentLocalRotationQuaternion
+
+Output_GetSegmentLocalTranslation
+Client::GetSegmentLocalTranslation(const String & SubjectName,
+                                   const String & SegmentName)
+const
+{
+    ODL_OBJENTER(); //####
+    // The simulated segments are not arranged in a hierarchy, so the local and global values
+    // are the same.
+    Output_GetSegmentGlobalTranslation globalResult = GetSegmentGlobalTranslation(SubjectName,
+                                                                                  SegmentName);
+    Output_GetSegmentLocalTranslation  result;
+
+    result.Result = globalResult.Result;
+    memcpy(result.Translation, globalResult.Translation, sizeof(result.Translation));
+    result.Occluded = globalResult.Occluded;
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetSegmentLocalTranslation
+
+Output_GetSegmentName
+Client::GetSegmentName(const String &     SubjectName,
+                       const unsigned int SegmentIndex)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("SegmentIndex = ", SegmentIndex); //####
+    Output_GetSegmentName            result;
+    const Common::SimulatedSubject * aSubject = m_pClientImpl->findSubject(SubjectName,
+                                                                           result.Result);
+
+    if (aSubject)
+    {
+        if (aSubject->_segments.size() > SegmentIndex)
+        {
+            // The name refers to the storage of the segment, which is stable until the next
+            // frame is requested.
+            result.SegmentName = aSubject->_segments[SegmentIndex]._name.c_str();
+            m_pClientImpl->_lastSegment = SegmentIndex;
+        }
+        else
+        {
+            result.Result = Result::InvalidIndex;
+        }
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetSegmentName
+
+Output_GetSubjectCount
+Client::GetSubjectCount(void)
+const
+{
+    ODL_OBJENTER(); //####
+    Output_GetSubjectCount result;
+
+    if (m_pClientImpl->_connected)
+    {
+        result.Result = Result::Success;
+        result.SubjectCount =
+                        static_cast<unsigned int>(m_pClientImpl->_source.currentFrame().size());
+    }
+    else
+    {
+        result.Result = Result::NotConnected;
+        result.SubjectCount = 0;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetSubjectCount
+
+Output_GetSubjectName
+Client::GetSubjectName(const unsigned int SubjectIndex)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("SubjectIndex = ", SubjectIndex); //####
+    Output_GetSubjectName result;
+
+    if (m_pClientImpl->_connected)
+    {
+        const Common::SimulatedSubjectVector & subjects = m_pClientImpl->_source.currentFrame();
+
+        if (subjects.size() > SubjectIndex)
+        {
+            // The name refers to the storage of the subject, which is stable until the next
+            // frame is requested.
+            result.Result = Result::Success;
+            result.SubjectName = subjects[SubjectIndex]._name.c_str();
+            m_pClientImpl->_lastSubject = SubjectIndex;
+        }
+        else
+        {
+            result.Result = Result::InvalidIndex;
+        }
+    }
+    else
+    {
+        result.Result = Result::NotConnected;
+    }
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::GetSubjectName
+
+Output_IsConnected
+Client::IsConnected(void)
+const
+{
+    ODL_OBJENTER(); //####
+    Output_IsConnected result;
+
+    result.Connected = m_pClientImpl->_connected;
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::IsConnected
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+Output_SetAxisMapping
+Client::SetAxisMapping(const Direction::Enum XAxis,
+                       const Direction::Enum YAxis,
+                       const Direction::Enum ZAxis)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(XAxis,YAxis,ZAxis)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_LL3("XAxis = ", XAxis, "YAxis = ", YAxis, "ZAxis = ", ZAxis); //####
+    Output_SetAxisMapping result;
+
+    // The simulated frames are already expressed in the requested axes.
+    result.Result = Result::Success;
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::SetAxisMapping
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+Output_SetStreamMode
+Client::SetStreamMode(const StreamMode::Enum Mode)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(Mode)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_LL1("Mode = ", Mode); //####
+    Output_SetStreamMode result;
+
+    // Frames are always delivered as they become due, as with a server that pushes frames.
+    result.Result = (m_pClientImpl->_connected ? Result::Success : Result::NotConnected);
+    ODL_OBJEXIT(); //####
+    return result;
+} // Client::SetStreamMode
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
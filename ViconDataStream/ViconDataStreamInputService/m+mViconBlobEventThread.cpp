@@ -374,8 +374,11 @@ ViconBlobEventThread::run(void)
     ODL_OBJENTER(); //####
     for ( ; ! isStopping(); )
     {
-#if (! defined(MpM_BuildDummyServices))
-        cerr << "checking for a frame" << endl; //!!!!
+#if defined(MpM_BuildDummyServices)
+        ConsumeSomeTime();
+#else // ! defined(MpM_BuildDummyServices)
+        // In server push mode, GetFrame() waits for the next frame, so no further delay is
+        // needed after a frame has been processed; an extra delay would cap the frame rate.
         if (CPP::Result::Success == _viconClient.GetFrame().Result)
         {
             CPP::Output_GetSubjectCount o_gsubjc = _viconClient.GetSubjectCount();
@@ -390,7 +393,6 @@ ViconBlobEventThread::run(void)
             Utilities::GoToSleep(kLittleSleep);
         }
 #endif // ! defined(MpM_BuildDummyServices)
-        ConsumeSomeTime();
     }
     ODL_OBJEXIT(); //####
 } // ViconBlobEventThread::run
@@ -41,9 +41,9 @@
 
 # include <m+m/m+mConfig.hpp>
 
-# if (! defined(MpM_BuildDummyServices))
+# if (! (defined(MpM_BuildDummyServices) || defined(MpM_UseSimulatedDevices)))
 #  include "stdafx.h"
-# endif // ! defined(MpM_BuildDummyServices)
+# endif // ! (defined(MpM_BuildDummyServices) || defined(MpM_UseSimulatedDevices))
 
 # include <m+m/m+mBaseThread.hpp>
 # include <m+m/m+mGeneralChannel.hpp>
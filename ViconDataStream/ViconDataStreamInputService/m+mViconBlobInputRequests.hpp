@@ -60,4 +60,8 @@
 /*! @brief The default port number to be used. */
 # define VICONBLOBINPUT_DEFAULT_PORT_ 801
 
+/*! @brief The default description of the simulated device, which is used in place of the host
+ name when simulated devices are in use. */
+# define VICONBLOBINPUT_DEFAULT_SIMULATION_ "100,1,20"
+
 #endif // ! defined(MpMViconBlobInputRequests_HPP_)
@@ -43,6 +43,7 @@
 #include <m+m/m+mDoubleArgumentDescriptor.hpp>
 #include <m+m/m+mEndpoint.hpp>
 #include <m+m/m+mPortArgumentDescriptor.hpp>
+#include <m+m/m+mStringArgumentDescriptor.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -174,10 +175,17 @@ main(int      argc,
         Utilities::DoubleArgumentDescriptor  firstArg("scale", T_("Translation scale"),
                                                       Utilities::kArgModeOptionalModifiable, 1,
                                                       true, 0, false, 0);
+#if defined(MpM_UseSimulatedDevices)
+        Utilities::StringArgumentDescriptor  secondArg("device",
+                                                       T_("Description of the simulated device"),
+                                                       Utilities::kArgModeOptionalModifiable,
+                                                       VICONBLOBINPUT_DEFAULT_SIMULATION_);
+#else // ! defined(MpM_UseSimulatedDevices)
         Utilities::AddressArgumentDescriptor secondArg("hostname",
                                                        T_("IP address for the device server"),
                                                        Utilities::kArgModeOptionalModifiable,
                                                        SELF_ADDRESS_NAME_);
+#endif // ! defined(MpM_UseSimulatedDevices)
         Utilities::PortArgumentDescriptor    thirdArg("port", T_("Port for the device server"),
                                                       Utilities::kArgModeOptionalModifiable,
                                                       VICONBLOBINPUT_DEFAULT_PORT_, true);
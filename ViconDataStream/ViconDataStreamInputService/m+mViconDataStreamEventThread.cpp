@@ -102,17 +102,22 @@ static const int kLittleSleep = 200;
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
 
-ViconDataStreamEventThread::ViconDataStreamEventThread(Common::GeneralChannel * outChannel,
-                                                       const YarpString &       nameAndPort) :
+ViconDataStreamEventThread::ViconDataStreamEventThread(Common::GeneralChannel *    outChannel,
+                                                       const YarpString &          nameAndPort,
+                                                       Common::FrameLatencyTrace & latency,
+                                                       const bool                  addTiming,
+                                                       const YarpString &          recordPath) :
     inherited(),
 #if (! defined(MpM_BuildDummyServices))
     _viconClient(),
 #endif // ! defined(MpM_BuildDummyServices)
-    _nameAndPort(nameAndPort), _outChannel(outChannel)
+    _nameAndPort(nameAndPort), _recordPath(recordPath), _recordFile(NULL), _latency(latency),
+    _outChannel(outChannel), _addTiming(addTiming)
 {
     ODL_ENTER(); //####
-    ODL_P1("outChannel = ", outChannel); //####
-    ODL_S1s("nameAndPort = ", nameAndPort); //####
+    ODL_P2("outChannel = ", outChannel, "latency = ", &latency); //####
+    ODL_S2s("nameAndPort = ", nameAndPort, "recordPath = ", recordPath); //####
+    ODL_B1("addTiming = ", addTiming); //####
     ODL_EXIT_P(this); //####
 } // ViconDataStreamEventThread::ViconDataStreamEventThread
 
@@ -271,6 +276,17 @@ ViconDataStreamEventThread::processEventData(const unsigned int subjectCount)
                                     aDict.put(static_cast<std::string>(o_gsegn.SegmentName).c_str(),
                                               stuff);
                                 }
+                                if (_recordFile)
+                                {
+                                    fprintf(_recordFile,
+                                            "%s %s %.9g %.9g %.9g %.9g %.9g %.9g %.9g\n",
+                                            static_cast<std::string>(o_gsubjn.SubjectName).c_str(),
+                                            static_cast<std::string>(o_gsegn.SegmentName).c_str(),
+                                            o_gseggt.Translation[0], o_gseggt.Translation[1],
+                                            o_gseggt.Translation[2], o_gseggrq.Rotation[0],
+                                            o_gseggrq.Rotation[1], o_gseggrq.Rotation[2],
+                                            o_gseggrq.Rotation[3]);
+                                }
                             }
                         }
 # endif // ! defined(USE_SEGMENT_LOCAL_DATA_)
@@ -280,11 +296,25 @@ ViconDataStreamEventThread::processEventData(const unsigned int subjectCount)
         }
     }
 #endif // ! defined(MpM_BuildDummyServices)
+    if (_recordFile)
+    {
+        // A blank line ends the frame, in the form read by the simulated devices.
+        fputs("\n", _recordFile);
+    }
+    _latency.frameEncoded();
     if (_outChannel)
     {
         if (0 < message.size())
         {
-            if (! _outChannel->write(message))
+            if (_addTiming)
+            {
+                _latency.addToMessage(message);
+            }
+            if (_outChannel->write(message))
+            {
+                _latency.frameWritten();
+            }
+            else
             {
                 ODL_LOG("(! _outChannel->write(message))"); //####
 #if defined(MpM_StallOnSendProblem)
@@ -302,11 +332,27 @@ ViconDataStreamEventThread::run(void)
     ODL_OBJENTER(); //####
     for ( ; ! isStopping(); )
     {
-#if (! defined(MpM_BuildDummyServices))
+#if defined(MpM_BuildDummyServices)
+        ConsumeSomeTime();
+#else // ! defined(MpM_BuildDummyServices)
+        // In server push mode, GetFrame() waits for the next frame, so no further delay is
+        // needed after a frame has been processed; an extra delay would cap the frame rate.
         if (CPP::Result::Success == _viconClient.GetFrame().Result)
         {
+            CPP::Output_GetFrameNumber  o_gfn = _viconClient.GetFrameNumber();
+            CPP::Output_GetLatencyTotal o_glt = _viconClient.GetLatencyTotal();
             CPP::Output_GetSubjectCount o_gsubjc = _viconClient.GetSubjectCount();
-
+            // The total latency reported by the SDK is the age of the frame when it arrived.
+            double                      frameAge = ((CPP::Result::Success == o_glt.Result) ?
+                                                    o_glt.Total : 0);
+            unsigned int                frameNumber = ((CPP::Result::Success == o_gfn.Result) ?
+                                                       o_gfn.FrameNumber : 0);
+
+            _latency.frameArrived(frameNumber, frameAge);
+            if (_recordFile)
+            {
+                fprintf(_recordFile, "# frame %u latency %g\n", frameNumber, frameAge);
+            }
             if (CPP::Result::Success == o_gsubjc.Result)
             {
                 processEventData(o_gsubjc.SubjectCount);
@@ -317,7 +363,6 @@ ViconDataStreamEventThread::run(void)
             Utilities::GoToSleep(kLittleSleep);
         }
 #endif // ! defined(MpM_BuildDummyServices)
-        ConsumeSomeTime();
     }
     ODL_OBJEXIT(); //####
 } // ViconDataStreamEventThread::run
@@ -328,10 +373,39 @@ ViconDataStreamEventThread::threadInit(void)
     ODL_OBJENTER(); //####
     bool result = initializeConnection();
 
+    if (result && (0 < _recordPath.length()))
+    {
+#if MAC_OR_LINUX_
+        _recordFile = fopen(_recordPath.c_str(), "w");
+#else // ! MAC_OR_LINUX_
+        if (fopen_s(&_recordFile, _recordPath.c_str(), "w"))
+        {
+            _recordFile = NULL;
+        }
+#endif // ! MAC_OR_LINUX_
+        if (! _recordFile)
+        {
+            ODL_LOG("(! _recordFile)"); //####
+            cerr << "Could not open '" << _recordPath.c_str() << "' for recording." << endl;
+            result = false;
+        }
+    }
     ODL_OBJEXIT_B(result); //####
     return result;
 } // ViconDataStreamEventThread::threadInit
 
+void
+ViconDataStreamEventThread::threadRelease(void)
+{
+    ODL_OBJENTER(); //####
+    if (_recordFile)
+    {
+        fclose(_recordFile);
+        _recordFile = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // ViconDataStreamEventThread::threadRelease
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -41,11 +41,12 @@
 
 # include <m+m/m+mConfig.hpp>
 
-# if (! defined(MpM_BuildDummyServices))
+# if (! (defined(MpM_BuildDummyServices) || defined(MpM_UseSimulatedDevices)))
 #  include "stdafx.h"
-# endif // ! defined(MpM_BuildDummyServices)
+# endif // ! (defined(MpM_BuildDummyServices) || defined(MpM_UseSimulatedDevices))
 
 # include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mFrameLatencyTrace.hpp>
 # include <m+m/m+mGeneralChannel.hpp>
 
 # if (! defined(MpM_BuildDummyServices))
@@ -83,9 +84,18 @@ namespace MplusM
 
             /*! @brief The constructor.
              @param[in] outChannel The channel to send data bursts to.
-             @param[in] nameAndPort The host name and port to connect to the Vicon server. */
-            ViconDataStreamEventThread(Common::GeneralChannel * outChannel,
-                                       const YarpString &       nameAndPort);
+             @param[in] nameAndPort The host name and port to connect to the Vicon server.
+             @param[in] latency The record of the time taken to handle each frame.
+             @param[in] addTiming @c true if the timing of each frame is to be added to the
+             output and @c false otherwise.
+             @param[in] recordPath The path to a file to record the frames in, in the form used
+             by the simulated devices, or an empty string if the frames are not to be
+             recorded. */
+            ViconDataStreamEventThread(Common::GeneralChannel *    outChannel,
+                                       const YarpString &          nameAndPort,
+                                       Common::FrameLatencyTrace & latency,
+                                       const bool                  addTiming,
+                                       const YarpString &          recordPath);
 
             /*! @brief The destructor. */
             virtual
@@ -128,6 +138,10 @@ namespace MplusM
             virtual bool
             threadInit(void);
 
+            /*! @brief The thread termination method. */
+            virtual void
+            threadRelease(void);
+
         public :
 
         protected :
@@ -142,9 +156,32 @@ namespace MplusM
             /* @brief The host name and port to connect to the Vicon server. */
             YarpString _nameAndPort;
 
+            /*! @brief The path to the file to record the frames in. */
+            YarpString _recordPath;
+
+            /*! @brief The file that the frames are recorded in. */
+            FILE * _recordFile;
+
+            /*! @brief The record of the time taken to handle each frame. */
+            Common::FrameLatencyTrace & _latency;
+
             /*! @brief The channel to send data bursts to. */
             Common::GeneralChannel * _outChannel;
 
+            /*! @brief @c true if the timing of each frame is added to the output and @c false
+             otherwise. */
+            bool _addTiming;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
         }; // ViconDataStreamEventThread
 
     } // ViconDataStream
@@ -99,8 +99,9 @@ ViconDataStreamInputService::ViconDataStreamInputService(const Utilities::Descri
                                                                                 servicePortNumber) :
     inherited(argumentList, launchPath, argc, argv, tag, true,
               MpM_VICONDATASTREAMINPUT_CANONICAL_NAME_, VICONDATASTREAMINPUT_SERVICE_DESCRIPTION_,
-              "", serviceEndpointName, servicePortNumber), _eventThread(NULL),
-    _hostName(SELF_ADDRESS_NAME_), _hostPort(VICONDATASTREAMINPUT_DEFAULT_PORT_)
+              "", serviceEndpointName, servicePortNumber), _latency(),
+    _hostName(SELF_ADDRESS_NAME_), _recordPath(), _eventThread(NULL),
+    _hostPort(VICONDATASTREAMINPUT_DEFAULT_PORT_), _addTiming(false)
 {
     ODL_ENTER(); //####
     ODL_P2("argumentList = ", &argumentList, "argv = ", argv); //####
@@ -147,8 +148,27 @@ ViconDataStreamInputService::configure(const yarp::os::Bottle & details)
                     ODL_S1s("_hostName <- ", _hostName); //####
                     _hostPort = secondNumber;
                     ODL_LL1("_hostPort <- ", _hostPort); //####
+                    // The frame timing and recording are optional, to allow older configurations
+                    // to be used.
+                    if (4 <= details.size())
+                    {
+                        yarp::os::Value thirdValue(details.get(2));
+                        yarp::os::Value fourthValue(details.get(3));
+
+                        if (thirdValue.isInt() && fourthValue.isString())
+                        {
+                            _addTiming = (0 != thirdValue.asInt());
+                            ODL_B1("_addTiming <- ", _addTiming); //####
+                            _recordPath = fourthValue.asString();
+                            ODL_S1s("_recordPath <- ", _recordPath); //####
+                        }
+                    }
                     buff << "Host name is '" << _hostName.c_str() << "', host port is " <<
-                            _hostPort;
+                            _hostPort << ", frame timing is " << (_addTiming ? "on" : "off");
+                    if (0 < _recordPath.length())
+                    {
+                        buff << ", recording to '" << _recordPath.c_str() << "'";
+                    }
                     setExtraInformation(buff.str());
                     result = true;
                 }
@@ -177,6 +197,16 @@ ViconDataStreamInputService::configure(const yarp::os::Bottle & details)
     return result;
 } // ViconDataStreamInputService::configure
 
+void
+ViconDataStreamInputService::gatherMetrics(yarp::os::Bottle & metrics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("metrics = ", &metrics); //####
+    inherited::gatherMetrics(metrics);
+    _latency.addToList(metrics, getEndpoint().getName() + "/latency");
+    ODL_OBJEXIT(); //####
+} // ViconDataStreamInputService::gatherMetrics
+
 bool
 ViconDataStreamInputService::getConfiguration(yarp::os::Bottle & details)
 {
@@ -187,6 +217,8 @@ ViconDataStreamInputService::getConfiguration(yarp::os::Bottle & details)
     details.clear();
     details.addString(_hostName);
     details.addInt(_hostPort);
+    details.addInt(_addTiming ? 1 : 0);
+    details.addString(_recordPath);
     ODL_OBJEXIT_B(result); //####
     return result;
 } // ViconDataStreamInputService::getConfiguration
@@ -237,7 +269,9 @@ ViconDataStreamInputService::startStreams(void)
             std::stringstream nameAndPort;
 
             nameAndPort << _hostName.c_str() << ":" << _hostPort;
-            _eventThread = new ViconDataStreamEventThread(getOutletStream(0), nameAndPort.str());
+            _latency.clear();
+            _eventThread = new ViconDataStreamEventThread(getOutletStream(0), nameAndPort.str(),
+                                                          _latency, _addTiming, _recordPath);
             if (_eventThread->start())
             {
                 setActive();
@@ -276,6 +310,10 @@ ViconDataStreamInputService::stopStreams(void)
                 }
                 delete _eventThread;
                 _eventThread = NULL;
+                if (_addTiming)
+                {
+                    cerr << _latency.report().c_str();
+                }
             }
             clearActive();
         }
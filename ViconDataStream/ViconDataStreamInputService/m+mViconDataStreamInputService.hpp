@@ -40,6 +40,7 @@
 # define MpMViconDataStreamInputService_HPP_ /* Header guard */
 
 # include <m+m/m+mBaseInputService.hpp>
+# include <m+m/m+mFrameLatencyTrace.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -108,6 +109,11 @@ namespace MplusM
             virtual bool
             configure(const yarp::os::Bottle & details);
 
+            /*! @brief Add the time taken to handle the frames to the service metrics.
+             @param[in,out] metrics The gathered metrics. */
+            virtual void
+            gatherMetrics(yarp::os::Bottle & metrics);
+
             /*! @brief Get the configuration of the input/output streams.
              @param[out] details The configuration information for the input/output streams.
              @returns @c true if the configuration was successfully retrieved and @c false
@@ -154,15 +160,36 @@ namespace MplusM
 
         private :
 
+            /*! @brief The record of the time taken to handle each frame. */
+            Common::FrameLatencyTrace _latency;
+
             /*! @brief The name of the Vicon device server. */
             YarpString _hostName;
 
-            /*! @brief The port to connect to the Vicon device server. */
-            int _hostPort;
+            /*! @brief The path to a file to record the frames in, or an empty string if the
+             frames are not to be recorded. */
+            YarpString _recordPath;
 
             /*! @brief The event thread to use. */
             ViconDataStreamEventThread * _eventThread;
 
+            /*! @brief The port to connect to the Vicon device server. */
+            int _hostPort;
+
+            /*! @brief @c true if the timing of each frame is added to the output and @c false
+             otherwise. */
+            bool _addTiming;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[3];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
         }; // ViconDataStreamInputService
 
     } // ViconDataStream
@@ -40,8 +40,10 @@
 #include "m+mViconDataStreamInputService.hpp"
 
 #include <m+m/m+mAddressArgumentDescriptor.hpp>
+#include <m+m/m+mBoolArgumentDescriptor.hpp>
 #include <m+m/m+mEndpoint.hpp>
 #include <m+m/m+mPortArgumentDescriptor.hpp>
+#include <m+m/m+mStringArgumentDescriptor.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -145,7 +147,12 @@ setUpAndGo(const Utilities::DescriptorVector & argumentList,
 /*! @brief The entry point for running the Vicon DataStream input service.
 
  The second, optional, argument is the port for the Vicon device server and the first, optional,
- argument is the host name for the Vicon device server.
+ argument is the host name for the Vicon device server. The third, optional, argument is @c 1 if
+ the timing of each frame is to be added to the output and the fourth, optional, argument is the
+ path to a file to record the frames in.
+
+ A recording can be replayed by a service that is built with simulated devices, using the path to
+ the recording, optionally followed by a comma and the frame rate, as the device description.
  @param[in] argc The number of arguments in 'argv'.
  @param[in] argv The arguments to be used with the Vicon DataStream input service.
  @returns @c 0 on a successful test and @c 1 on failure. */
@@ -177,17 +184,33 @@ main(int      argc,
         YarpString                           serviceEndpointName;
         YarpString                           servicePortNumber;
         YarpString                           tag;
+#if defined(MpM_UseSimulatedDevices)
+        Utilities::StringArgumentDescriptor  firstArg("device",
+                                                      T_("Description of the simulated device"),
+                                                      Utilities::kArgModeOptionalModifiable,
+                                                      VICONDATASTREAMINPUT_DEFAULT_SIMULATION_);
+#else // ! defined(MpM_UseSimulatedDevices)
         Utilities::AddressArgumentDescriptor firstArg("hostname",
                                                       T_("IP address for the device server"),
                                                       Utilities::kArgModeOptionalModifiable,
                                                       SELF_ADDRESS_NAME_);
+#endif // ! defined(MpM_UseSimulatedDevices)
         Utilities::PortArgumentDescriptor    secondArg("port", T_("Port for the device server"),
                                                        Utilities::kArgModeOptionalModifiable,
                                                        VICONDATASTREAMINPUT_DEFAULT_PORT_, true);
+        Utilities::BoolArgumentDescriptor    thirdArg("timing",
+                                                      T_("Add the frame timing to the output"),
+                                                      Utilities::kArgModeOptionalModifiable,
+                                                      false);
+        Utilities::StringArgumentDescriptor  fourthArg("record",
+                                                       T_("File to record the frames in"),
+                                                       Utilities::kArgModeOptionalModifiable, "");
         Utilities::DescriptorVector          argumentList;
 
         argumentList.push_back(&firstArg);
         argumentList.push_back(&secondArg);
+        argumentList.push_back(&thirdArg);
+        argumentList.push_back(&fourthArg);
         if (ProcessStandardServiceOptions(argc, argv, argumentList,
                                           VICONDATASTREAMINPUT_SERVICE_DESCRIPTION_, "", 2014,
                                           STANDARD_COPYRIGHT_NAME_, goWasSet, reportEndpoint,
@@ -66,10 +66,41 @@ using namespace CommonVisuals;
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The number of values in each per-instance offset. */
+static const GLsizei kValuesPerOffset = 3;
+
 #if defined(__APPLE__)
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Determine how the instanced drawing functions are named in the active context.
+
+ Note that the function lookup can succeed even if the function is not supported, so the version
+ and the extensions of the context are checked instead.
+ @returns An empty string if instanced drawing is part of the OpenGL version, 'ARB' if it is
+ provided by an extension or @c NULL if it is not available. */
+static const char *
+getInstancingSuffix(void)
+{
+    ODL_ENTER(); //####
+    const char * result = NULL;
+    String       version(reinterpret_cast<const char *>(glGetString(GL_VERSION)));
+    int          major = version.getIntValue();
+    int          minor = version.fromFirstOccurrenceOf(".", false, false).getIntValue();
+
+    ODL_LL2("major = ", major, "minor = ", minor); //####
+    if ((3 < major) || ((3 == major) && (3 <= minor)))
+    {
+        result = "";
+    }
+    else if (OpenGLHelpers::isExtensionSupported("GL_ARB_instanced_arrays"))
+    {
+        result = "ARB";
+    }
+    ODL_EXIT_S(result); //####
+    return result;
+} // getInstancingSuffix
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -82,11 +113,14 @@ VertexBuffer::VertexBuffer(OpenGLContext &      context,
                            Array<Vertex> &      vertexList,
                            const juce::uint32 * indices,
                            const GLsizei        numIndices) :
-    _numIndices(numIndices), _context(context)
+    _drawElementsInstanced(NULL), _vertexAttribDivisor(NULL), _instanceBuffer(0),
+    _instanceCapacity(0), _numIndices(numIndices), _context(context)
 {
     ODL_ENTER(); //####
     ODL_P3("context = ", &_context, "vertexList = ", &vertexList, "indices = ", indices); //####
     ODL_LL1("numIndices = ", numIndices); //####
+    const char * suffix = getInstancingSuffix();
+
     _context.extensions.glGenBuffers(1, &_vertexBuffer);
     _context.extensions.glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
     _context.extensions.glBufferData(GL_ARRAY_BUFFER, vertexList.size() * sizeof(Vertex),
@@ -95,6 +129,20 @@ VertexBuffer::VertexBuffer(OpenGLContext &      context,
     _context.extensions.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBuffer);
     _context.extensions.glBufferData(GL_ELEMENT_ARRAY_BUFFER, numIndices * sizeof(*indices),
                                      indices, GL_STATIC_DRAW);
+    if (suffix)
+    {
+        String drawName(String("glDrawElementsInstanced") + suffix);
+        String divisorName(String("glVertexAttribDivisor") + suffix);
+
+        _drawElementsInstanced = reinterpret_cast<DrawElementsInstancedFunction>
+                                (OpenGLHelpers::getExtensionFunction(drawName.toRawUTF8()));
+        _vertexAttribDivisor = reinterpret_cast<VertexAttribDivisorFunction>
+                                (OpenGLHelpers::getExtensionFunction(divisorName.toRawUTF8()));
+        if (canDrawInstances())
+        {
+            _context.extensions.glGenBuffers(1, &_instanceBuffer);
+        }
+    }
     ODL_EXIT_P(this); //####
 } // VertexBuffer::VertexBuffer
 
@@ -103,6 +151,10 @@ VertexBuffer::~VertexBuffer(void)
     ODL_OBJENTER(); //####
     _context.extensions.glDeleteBuffers (1, &_vertexBuffer);
     _context.extensions.glDeleteBuffers (1, &_indexBuffer);
+    if (0 != _instanceBuffer)
+    {
+        _context.extensions.glDeleteBuffers(1, &_instanceBuffer);
+    }
     ODL_OBJEXIT(); //####
 } // VertexBuffer::~VertexBuffer
 
@@ -119,6 +171,43 @@ VertexBuffer::bind(void)
     ODL_OBJEXIT(); //####
 } // VertexBuffer::bind
 
+void
+VertexBuffer::drawInstances(const GLfloat * offsets,
+                            const GLsizei   numInstances,
+                            const GLuint    offsetAttribute)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("offsets = ", offsets); //####
+    ODL_LL2("numInstances = ", numInstances, "offsetAttribute = ", offsetAttribute); //####
+    if (canDrawInstances() && (0 < numInstances))
+    {
+        if (_instanceCapacity < numInstances)
+        {
+            // Leave room to grow, so that the buffer isn't resized every time.
+            _instanceCapacity = (2 * numInstances);
+        }
+        _context.extensions.glBindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+        // Replace the storage rather than overwrite it, so that the driver doesn't have to wait
+        // for the previous draw to finish with the old offsets.
+        _context.extensions.glBufferData(GL_ARRAY_BUFFER,
+                                         _instanceCapacity * kValuesPerOffset * sizeof(*offsets),
+                                         NULL, GL_STREAM_DRAW);
+        _context.extensions.glBufferSubData(GL_ARRAY_BUFFER, 0,
+                                            numInstances * kValuesPerOffset * sizeof(*offsets),
+                                            offsets);
+        _context.extensions.glVertexAttribPointer(offsetAttribute, kValuesPerOffset, GL_FLOAT,
+                                                  GL_FALSE, kValuesPerOffset * sizeof(*offsets),
+                                                  reinterpret_cast<GLvoid *>(0));
+        _context.extensions.glEnableVertexAttribArray(offsetAttribute);
+        _vertexAttribDivisor(offsetAttribute, 1);
+        _context.extensions.glBindBuffer(GL_ARRAY_BUFFER, _vertexBuffer);
+        _drawElementsInstanced(GL_TRIANGLES, _numIndices, GL_UNSIGNED_INT, 0, numInstances);
+        _vertexAttribDivisor(offsetAttribute, 0);
+        _context.extensions.glDisableVertexAttribArray(offsetAttribute);
+    }
+    ODL_OBJEXIT(); //####
+} // VertexBuffer::drawInstances
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
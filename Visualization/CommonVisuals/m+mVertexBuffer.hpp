@@ -52,10 +52,22 @@
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
 
+# if MAC_OR_LINUX_
+/*! @brief The calling convention for OpenGL functions that are looked up at run time. */
+#  define MpM_GL_CALLTYPE_ /* */
+# else // ! MAC_OR_LINUX_
+/*! @brief The calling convention for OpenGL functions that are looked up at run time. */
+#  define MpM_GL_CALLTYPE_ __stdcall
+# endif // ! MAC_OR_LINUX_
+
 namespace CommonVisuals
 {
     
-    /*! @brief A convenience class to hold vertices and their indices. */
+    /*! @brief A convenience class to hold vertices and their indices.
+
+     If the OpenGL implementation supports instanced drawing, many copies of the shape can be
+     drawn with a single call, each moved by an offset that is streamed into a per-instance
+     buffer. */
     class VertexBuffer
     {
     public :
@@ -87,6 +99,28 @@ namespace CommonVisuals
         void
         bind(void);
 
+        /*! @brief Return @c true if copies of the shape can be drawn with a single call.
+         @returns @c true if copies of the shape can be drawn with a single call and @c false
+         otherwise. */
+        inline bool
+        canDrawInstances(void)
+        const
+        {
+            return ((NULL != _drawElementsInstanced) && (NULL != _vertexAttribDivisor));
+        } // canDrawInstances
+
+        /*! @brief Draw copies of the shape with a single call, each moved by its own offset.
+
+         The buffers must have been bound and the per-vertex attributes enabled. The offsets are
+         copied into a buffer that is reused from call to call.
+         @param[in] offsets The offsets of the copies, as consecutive x, y and z values.
+         @param[in] numInstances The number of copies to draw.
+         @param[in] offsetAttribute The vertex attribute that receives the offset of each copy. */
+        void
+        drawInstances(const GLfloat * offsets,
+                      const GLsizei   numInstances,
+                      const GLuint    offsetAttribute);
+
         /*! @brief Return the number of indices.
          @returns The number of indices. */
         GLsizei
@@ -100,18 +134,38 @@ namespace CommonVisuals
     
     private :
         
+        /*! @brief The signature of glDrawElementsInstanced. */
+        typedef void (MpM_GL_CALLTYPE_ * DrawElementsInstancedFunction)
+            (GLenum mode, GLsizei count, GLenum type, const GLvoid * indices, GLsizei primcount);
+
+        /*! @brief The signature of glVertexAttribDivisor. */
+        typedef void (MpM_GL_CALLTYPE_ * VertexAttribDivisorFunction)
+            (GLuint index, GLuint divisor);
+
     public :
     
     protected :
     
     private :
         
+        /*! @brief The instanced drawing function, or @c NULL if it is not available. */
+        DrawElementsInstancedFunction _drawElementsInstanced;
+
+        /*! @brief The per-instance attribute function, or @c NULL if it is not available. */
+        VertexAttribDivisorFunction _vertexAttribDivisor;
+
         /*! @brief The OpenGL index for the vertices. */       
         GLuint _vertexBuffer;
 
         /*! @brief The OpenGL index for the vertex indices. */
         GLuint _indexBuffer;
 
+        /*! @brief The OpenGL index for the per-instance offsets. */
+        GLuint _instanceBuffer;
+
+        /*! @brief The number of offsets that the per-instance buffer can hold. */
+        GLsizei _instanceCapacity;
+
         /*! @brief The number of indices. */
         GLsizei _numIndices;
 
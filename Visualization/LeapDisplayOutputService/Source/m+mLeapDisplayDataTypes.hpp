@@ -114,6 +114,17 @@ namespace LeapDisplay
         
     }; // HandData
 
+    /*! @brief The information for both hands. */
+    struct HandPair
+    {
+        /*! @brief The information for the left hand. */
+        HandData _left;
+
+        /*! @brief The information for the right hand. */
+        HandData _right;
+
+    }; // HandPair
+
 } // LeapDisplay
 
 #endif // ! defined(mpmLeapDisplayDataTypes_HPP_)
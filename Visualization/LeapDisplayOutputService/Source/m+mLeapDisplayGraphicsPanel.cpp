@@ -99,6 +99,7 @@ static const String kVertexShaderSource =
     "attribute vec4 normal;\n"
     "attribute vec4 sourceColour;\n"
     "attribute vec2 texureCoordIn;\n"
+    "attribute vec3 instanceOffset;\n"
     "\n"
     "uniform vec4 offset;\n"
     "uniform mat4 projectionMatrix;\n"
@@ -118,7 +119,8 @@ static const String kVertexShaderSource =
     "\n"
     "    lightIntensity = dot(light, normal);\n"
     "\n"
-    "    gl_Position = (projectionMatrix * viewMatrix * (position + offset));\n"
+    "    gl_Position = (projectionMatrix * viewMatrix *\n"
+    "                   (position + offset + vec4(instanceOffset, 0.0)));\n"
     "}\n";
 
 /*! @brief The fragment shader source code. */
@@ -173,6 +175,47 @@ createAttribute(OpenGLContext &       context,
     return result;
 } // createAttribute
 
+/*! @brief Add the position of a finger tip to a list of positions, if it is valid.
+ @param[in,out] offsets The list of positions to be updated.
+ @param[in] stuff The finger tip information. */
+static void
+addOffset(Array<GLfloat> &  offsets,
+          const FingerTip & stuff)
+{
+    ODL_ENTER(); //####
+    ODL_P2("offsets = ", &offsets, "stuff = ", &stuff); //####
+    if (stuff._valid)
+    {
+        offsets.add(static_cast<GLfloat>(stuff._where.x));
+        offsets.add(static_cast<GLfloat>(stuff._where.y));
+        offsets.add(static_cast<GLfloat>(stuff._where.z));
+    }
+    ODL_EXIT(); //####
+} // addOffset
+
+/*! @brief Add the positions of the finger tips of a hand to the lists of positions for each shape.
+ @param[in] aHand The hand to be drawn.
+ @param[in,out] cubeOffsets The positions of the finger tips to be drawn as cubes.
+ @param[in,out] octahedronOffsets The positions of the finger tips to be drawn as octahedrons.
+ @param[in,out] tetrahedronOffsets The positions of the finger tips to be drawn as tetrahedrons. */
+static void
+addFingertips(const HandData & aHand,
+              Array<GLfloat> & cubeOffsets,
+              Array<GLfloat> & octahedronOffsets,
+              Array<GLfloat> & tetrahedronOffsets)
+{
+    ODL_ENTER(); //####
+    ODL_P4("aHand = ", &aHand, "cubeOffsets = ", &cubeOffsets, "octahedronOffsets = ", //####
+           &octahedronOffsets, "tetrahedronOffsets = ", &tetrahedronOffsets); //####
+    addOffset(cubeOffsets, aHand._palm);
+    addOffset(tetrahedronOffsets, aHand._thumb);
+    addOffset(octahedronOffsets, aHand._index);
+    addOffset(cubeOffsets, aHand._middle);
+    addOffset(octahedronOffsets, aHand._ring);
+    addOffset(tetrahedronOffsets, aHand._pinky);
+    ODL_EXIT(); //####
+} // addFingertips
+
 /*! @brief Create a Uniform from the shader program.
  @param[in] context The active OpenGL context.
  @param[in] shader The shader program containing the uniform.
@@ -369,78 +412,63 @@ GraphicsPanel::drawBackground(const float desktopScale)
 } // GraphicsPanel::drawBackground
 
 void
-GraphicsPanel::drawFingertip(const FingerTip & stuff,
-                             const Shape       theShape)
+GraphicsPanel::drawHands(const HandPair & hands)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("hands = ", &hands); //####
+    // Sort the finger tips by shape, so that each shape can be drawn with a single call.
+    _cubeOffsets.clearQuick();
+    _octahedronOffsets.clearQuick();
+    _tetrahedronOffsets.clearQuick();
+    addFingertips(hands._left, _cubeOffsets, _octahedronOffsets, _tetrahedronOffsets);
+    addFingertips(hands._right, _cubeOffsets, _octahedronOffsets, _tetrahedronOffsets);
+    drawShapes(kShapeCube, _cubeOffsets);
+    drawShapes(kShapeTetrahedron, _tetrahedronOffsets);
+    drawShapes(kShapeOctahedron, _octahedronOffsets);
+    ODL_OBJEXIT(); //####
+} // GraphicsPanel::drawHands
+
+void
+GraphicsPanel::drawShapes(const Shape            theShape,
+                          const Array<GLfloat> & offsets)
 {
     ODL_OBJENTER(); //####
-    ODL_P1("stuff = ", &stuff); //####
     ODL_LL1("theShape = ", theShape); //####
-    if (stuff._valid)
-    {
-        const Location & where = stuff._where;
-        VertexBuffer *   selected;
+    ODL_P1("offsets = ", &offsets); //####
+    int            numShapes = (offsets.size() / 3);
+    VertexBuffer * selected = ((0 < numShapes) ? selectShape(theShape) : NULL);
 
-        switch (theShape)
+    if (selected)
+    {
+        ODL_LOG("(selected)"); //####
+        selected->bind();
+        enableVertexAttributes();
+        if ((NULL != _instanceOffsetAttribute) && selected->canDrawInstances())
         {
-            case kShapeCube :
-                if (! _cubeData)
-                {
-                    setUpCube();
-                }
-                selected = _cubeData;
-                break;
-
-            case kShapeTetrahedron :
-                if (! _tetrahedronData)
-                {
-                    setUpTetrahedron();
-                }
-                selected = _tetrahedronData;
-                break;
-
-            case kShapeOctahedron :
-                if (! _octahedronData)
-                {
-                    setUpOctahedron();
-                }
-                selected = _octahedronData;
-                break;
-
-            default :
-                selected = NULL;
-                break;
-
+            // Each copy is moved by its per-instance offset, so the common offset is cleared.
+            if (NULL != _offsetUniform)
+            {
+                _offsetUniform->set(0.0f, 0.0f, 0.0f, 0.0f);
+            }
+            selected->drawInstances(offsets.getRawDataPointer(), numShapes,
+                                    _instanceOffsetAttribute->attributeID);
         }
-        if (selected)
+        else
         {
-            ODL_LOG("(selected)"); //####
-            if (NULL != _offsetUniform)
+            for (int ii = 0; numShapes > ii; ++ii)
             {
-                _offsetUniform->set(static_cast<float>(where.x), static_cast<float>(where.y),
-                                    static_cast<float>(where.z), 0.0f);
+                if (NULL != _offsetUniform)
+                {
+                    _offsetUniform->set(offsets[3 * ii], offsets[(3 * ii) + 1],
+                                        offsets[(3 * ii) + 2], 0.0f);
+                }
+                glDrawElements(GL_TRIANGLES, selected->numberOfIndices(), GL_UNSIGNED_INT, 0);
             }
-            selected->bind();
-            enableVertexAttributes();
-            glDrawElements(GL_TRIANGLES, selected->numberOfIndices(), GL_UNSIGNED_INT, 0);
-            disableVertexAttributes();
         }
+        disableVertexAttributes();
     }
     ODL_OBJEXIT(); //####
-} // GraphicsPanel::drawFingertip
-
-void
-GraphicsPanel::drawHand(const HandData & aHand)
-{
-    ODL_OBJENTER(); //####
-    ODL_P1("aHand = ", &aHand); //####
-    drawFingertip(aHand._palm, kShapeCube);
-    drawFingertip(aHand._thumb, kShapeTetrahedron);
-    drawFingertip(aHand._index, kShapeOctahedron);
-    drawFingertip(aHand._middle, kShapeCube);
-    drawFingertip(aHand._ring, kShapeOctahedron);
-    drawFingertip(aHand._pinky, kShapeTetrahedron);
-    ODL_OBJEXIT(); //####
-} // GraphicsPanel::drawHand
+} // GraphicsPanel::drawShapes
 
 void
 GraphicsPanel::enableVertexAttributes(void)
@@ -498,6 +526,7 @@ GraphicsPanel::freeContextObjects(void)
     _normalAttribute = NULL;
     _sourceColourAttribute = NULL;
     _textureCoordInAttribute = NULL;
+    _instanceOffsetAttribute = NULL;
     _texture.release();
     ODL_P4("_positionAttribute <- ", _positionAttribute, "_normalAttribute <- ", //####
            _normalAttribute, "_sourceColourAttribute <- ", _sourceColourAttribute, //####
@@ -568,13 +597,10 @@ GraphicsPanel::renderOpenGL(void)
     if (OpenGLHelpers::isContextActive())
     {
         const float desktopScale = static_cast<float>(_context.getRenderingScale());
-        HandData    leftCopy;
-        HandData    rightCopy;
         
-        _csect.enter();
-        memcpy(&leftCopy, &_leftHand, sizeof(leftCopy));
-        memcpy(&rightCopy, &_rightHand, sizeof(rightCopy));
-        _csect.exit();
+        // The read slot belongs to the renderer, so it can be drawn from without a copy; if no
+        // new data has arrived, the previous data is drawn again.
+        _hands.acquire();
         OpenGLHelpers::clear(Colours::lightblue); // FOR NOW
         setUpTexture();
         drawBackground(desktopScale);
@@ -610,8 +636,7 @@ GraphicsPanel::renderOpenGL(void)
             {
                 _lightPositionUniform->set(-15.0f, 10.0f, 15.0f, 0.0f);
             }
-            drawHand(leftCopy);
-            drawHand(rightCopy);
+            drawHands(_hands.readSlot());
             // Reset the element buffers so child Components draw correctly
             _context.extensions.glBindBuffer(GL_ARRAY_BUFFER, 0);
             _context.extensions.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
@@ -638,6 +663,48 @@ GraphicsPanel::resized(void)
     ODL_OBJEXIT(); //####
 } // GraphicsPanel::resized
 
+VertexBuffer *
+GraphicsPanel::selectShape(const Shape theShape)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("theShape = ", theShape); //####
+    VertexBuffer * result;
+
+    switch (theShape)
+    {
+        case kShapeCube :
+            if (! _cubeData)
+            {
+                setUpCube();
+            }
+            result = _cubeData;
+            break;
+
+        case kShapeTetrahedron :
+            if (! _tetrahedronData)
+            {
+                setUpTetrahedron();
+            }
+            result = _tetrahedronData;
+            break;
+
+        case kShapeOctahedron :
+            if (! _octahedronData)
+            {
+                setUpOctahedron();
+            }
+            result = _octahedronData;
+            break;
+
+        default :
+            result = NULL;
+            break;
+
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // GraphicsPanel::selectShape
+
 void
 GraphicsPanel::setShaderProgram(const String & vertexShader,
                                 const String & fragmentShader)
@@ -766,10 +833,11 @@ GraphicsPanel::updateFingerData(const HandData & leftHand,
 {
     ODL_OBJENTER(); //####
     ODL_P2("leftHand = ", &leftHand, "rightHand = ", &rightHand); //####
-    _csect.enter();
-    memcpy(&_leftHand, &leftHand, sizeof(_leftHand));
-    memcpy(&_rightHand, &rightHand, sizeof(_rightHand));
-    _csect.exit();
+    HandPair & slot = _hands.writeSlot();
+
+    memcpy(&slot._left, &leftHand, sizeof(slot._left));
+    memcpy(&slot._right, &rightHand, sizeof(slot._right));
+    _hands.publish();
     ODL_OBJEXIT(); //####
 } // GraphicsPanel::updateFingerData
 
@@ -792,6 +860,8 @@ GraphicsPanel::updateShader(void)
             _normalAttribute = createAttribute(_context, *_shaderProgram, "normal");
             _sourceColourAttribute = createAttribute(_context, *_shaderProgram, "sourceColour");
             _textureCoordInAttribute = createAttribute(_context, *_shaderProgram, "texureCoordIn");
+            _instanceOffsetAttribute = createAttribute(_context, *_shaderProgram,
+                                                       "instanceOffset");
             ODL_P4("_positionAttribute <- ", _positionAttribute, "_normalAttribute <- ", //####
                    _normalAttribute, "_sourceColourAttribute <- ", _sourceColourAttribute, //####
                    "_textureCoordInAttribute <- ", _textureCoordInAttribute); //####
@@ -43,6 +43,8 @@
 # include "m+mLeapDisplayDataTypes.hpp"
 # include "m+mVertexBuffer.hpp"
 
+# include <m+m/m+mLatestValueBuffer.hpp>
+
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -129,8 +131,9 @@ namespace LeapDisplay
 
         /*! @brief Update the finger data for each hand.
          
-         Note that the access to the data is guarded by a critical section, so this is meant to be
-         called from the input handler thread.
+         Note that the data is handed to the renderer through a latest-value buffer, so this is
+         meant to be called from the input handler thread and never waits for the renderer; data
+         that arrives faster than the display rate replaces what has not yet been drawn.
          @param[in] leftHand The new data for the left hand.
          @param[in] rightHand The new data for the right hand. */
         void
@@ -158,17 +161,19 @@ namespace LeapDisplay
         void
         drawBackground(const float desktopScale);
 
-        /*! @brief Draw the finger tips for a hand.
-         @param[in] stuff The finger tip information.
-         @param[in] theShape The shape to use when drawing. */
+        /*! @brief Draw the fingers of both hands.
+         @param[in] hands The hands to be drawn. */
         void
-        drawFingertip(const FingerTip & stuff,
-                      const Shape       theShape);
-        
-        /*! @brief Draw the fingers of a hand.
-         @param[in] aHand The hand to be drawn. */
+        drawHands(const HandPair & hands);
+
+        /*! @brief Draw copies of a shape.
+
+         If instanced drawing is available, all the copies are drawn with a single call.
+         @param[in] theShape The shape to draw.
+         @param[in] offsets The positions of the copies, as consecutive x, y and z values. */
         void
-        drawHand(const HandData & aHand);
+        drawShapes(const Shape            theShape,
+                   const Array<GLfloat> & offsets);
         
         /*! @brief Enable the active vertex attributes. */
         void
@@ -204,6 +209,12 @@ namespace LeapDisplay
         virtual void
         resized(void);
 
+        /*! @brief Return the vertex data for a shape, setting it up if needed.
+         @param[in] theShape The shape to use when drawing.
+         @returns The vertex data for the shape or @c NULL if the shape is not recognized. */
+        CommonVisuals::VertexBuffer *
+        selectShape(const Shape theShape);
+
         /*! @brief Set the shader program source strings.
          @param[in] vertexShader The source for the vertex shader.
          @param[in] fragmentShader The source for the fragment shader. */
@@ -237,9 +248,6 @@ namespace LeapDisplay
 
     private :
         
-        /*! @brief The access control for the finger coordinates. */
-        CriticalSection _csect;
-        
         /*! @brief The OpenGL rendering context. */
         OpenGLContext _context;
 
@@ -258,6 +266,15 @@ namespace LeapDisplay
         /*! @brief The vertex data for a tetrahedron. */
         Array<CommonVisuals::Vertex> _tetrahedronVertices;
         
+        /*! @brief The positions of the finger tips to be drawn as cubes. */
+        Array<GLfloat> _cubeOffsets;
+
+        /*! @brief The positions of the finger tips to be drawn as octahedrons. */
+        Array<GLfloat> _octahedronOffsets;
+
+        /*! @brief The positions of the finger tips to be drawn as tetrahedrons. */
+        Array<GLfloat> _tetrahedronOffsets;
+        
         /*! @brief The shader program to use for rendering. */
         ScopedPointer<OpenGLShaderProgram> _shaderProgram;
         
@@ -287,6 +304,9 @@ namespace LeapDisplay
         
         /*! @brief The vertex attribute for its texture coordinate. */
         ScopedPointer<OpenGLShaderProgram::Attribute> _textureCoordInAttribute;
+
+        /*! @brief The vertex attribute for the offset of each instance. */
+        ScopedPointer<OpenGLShaderProgram::Attribute> _instanceOffsetAttribute;
         
         /*! @brief The vertices, normals, colour and texture coordinates for a cube. */
         ScopedPointer<CommonVisuals::VertexBuffer> _cubeData;
@@ -297,11 +317,8 @@ namespace LeapDisplay
         /*! @brief The vertices, normals, colour and texture coordinates for a tetrahedron. */
         ScopedPointer<CommonVisuals::VertexBuffer> _tetrahedronData;
         
-        /*! @brief The most recent data for the left hand. */
-        HandData _leftHand;
-        
-        /*! @brief The most recent data for the right hand. */
-        HandData _rightHand;
+        /*! @brief The handoff of the finger data from the input handler to the renderer. */
+        MplusM::Common::LatestValueBuffer<HandPair> _hands;
         
         /*! @brief The source code for the fragment shader. */
         String _fragmentShaderSource;
@@ -170,10 +170,10 @@ LeapDisplayOutputService::startStreams(void)
     {
         if (! isActive())
         {
-            if (_inHandler)
+            // Only the newest finger data is drawn, so don't let the input back up behind the
+            // renderer.
+            if (_inHandler && attachInletHandler(0, *_inHandler, true))
             {
-                _inHandler->setChannel(getInletStream(0));
-                getInletStream(0)->setReader(*_inHandler);
                 setActive();
             }
         }
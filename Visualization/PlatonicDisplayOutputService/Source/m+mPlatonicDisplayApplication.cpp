@@ -117,6 +117,15 @@ static const char * kApplicationName = "m+mPlatonicDisplayOutputService";
 /*! @brief The number of milliseconds before a thread is force-killed. */
 static const int kThreadKillTime = 3000;
 
+/*! @brief The command-line option that requests a drawing benchmark. */
+static const char * kBenchmarkOption = "--benchmark";
+
+/*! @brief The number of seconds that a benchmark runs for, if not specified. */
+static const double kDefaultBenchmarkDuration = 10;
+
+/*! @brief The command-line option that disables instanced drawing in a benchmark. */
+static const char * kNoInstancingOption = "--noinstancing";
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -590,20 +599,16 @@ PlatonicDisplayApplication::getMainWindow(void)
     return result;
 } // PlatonicDisplayApplication::getMainWindow
 
-#if (! MAC_OR_LINUX_)
-# pragma warning(push)
-# pragma warning(disable: 4100)
-#endif // ! MAC_OR_LINUX_
 void
 PlatonicDisplayApplication::initialise(const String & commandLine)
 {
-#if (! defined(ODL_ENABLE_LOGGING_))
-# if MAC_OR_LINUX_
-#  pragma unused(commandLine)
-# endif // MAC_OR_LINUX_
-#endif // ! defined(ODL_ENABLE_LOGGING_)
     ODL_OBJENTER(); //####
     ODL_S1s("commandLine = ", commandLine.toStdString()); //####
+    int         benchmarkIndex;
+    StringArray arguments;
+
+    arguments.addTokens(commandLine, true);
+    benchmarkIndex = arguments.indexOf(kBenchmarkOption);
 #if MAC_OR_LINUX_
     Common::SetUpLogger(kApplicationName);
 #endif // MAC_OR_LINUX_
@@ -611,7 +616,29 @@ PlatonicDisplayApplication::initialise(const String & commandLine)
     Utilities::SetUpGlobalStatusReporter();
     Utilities::CheckForNameServerReporter();
     _mainWindow = new PlatonicDisplayWindow(kApplicationName);
-    if (Utilities::CheckForValidNetwork(true))
+    if (0 <= benchmarkIndex)
+    {
+        // A benchmark draws generated pixies, so no network or Registry Service is needed.
+        double duration = arguments[benchmarkIndex + 2].getDoubleValue();
+        int    numPixies = arguments[benchmarkIndex + 1].getIntValue();
+
+        if (0 >= duration)
+        {
+            duration = kDefaultBenchmarkDuration;
+        }
+        if ((0 < numPixies) && _graphicsPanel)
+        {
+            _graphicsPanel->startBenchmark(numPixies, duration,
+                                           ! arguments.contains(kNoInstancingOption));
+        }
+        else
+        {
+            cerr << "The " << kBenchmarkOption << " option requires a positive number of pixies." <<
+                    endl;
+            systemRequestedQuit();
+        }
+    }
+    else if (Utilities::CheckForValidNetwork(true))
     {
         _yarp = new yarp::os::Network; // This is necessary to establish any connections to the YARP
                                        // infrastructure.
@@ -666,9 +693,6 @@ PlatonicDisplayApplication::initialise(const String & commandLine)
     }
     ODL_OBJEXIT(); //####
 } // PlatonicDisplayApplication::initialise
-#if (! MAC_OR_LINUX_)
-# pragma warning(pop)
-#endif // ! MAC_OR_LINUX_
 
 bool
 PlatonicDisplayApplication::moreThanOneInstanceAllowed(void)
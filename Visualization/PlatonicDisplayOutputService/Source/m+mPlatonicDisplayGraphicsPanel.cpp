@@ -96,12 +96,16 @@ static const int kInitialPanelWidth = 512;
 /*! @brief The number of pixies to draw. */
 static const int kNumPixies = 1000;
 
+/*! @brief The largest coordinate of a pixie placed by the benchmark. */
+static const double kBenchmarkRange = 3.1;
+
 /*! @brief The vertex shader source code. */
 static const String kVertexShaderSource =
     "attribute vec4 position;\n"
     "attribute vec4 normal;\n"
     "attribute vec4 sourceColour;\n"
     "attribute vec2 texureCoordIn;\n"
+    "attribute vec3 instanceOffset;\n"
     "\n"
     "uniform vec4 offset;\n"
     "uniform mat4 projectionMatrix;\n"
@@ -121,7 +125,8 @@ static const String kVertexShaderSource =
     "\n"
     "    lightIntensity = dot(light, normal);\n"
     "\n"
-    "    gl_Position = (projectionMatrix * viewMatrix * (position + offset));\n"
+    "    gl_Position = (projectionMatrix * viewMatrix *\n"
+    "                   (position + offset + vec4(instanceOffset, 0.0)));\n"
     "}\n";
 
 /*! @brief The fragment shader source code. */
@@ -242,6 +247,21 @@ setVertexData(Array<Vertex> & vertexList,
     ODL_EXIT();
 } // setVertexData
 
+/*! @brief Add the position of a pixie to a set of offsets.
+ @param[in,out] offsets The offsets to be added to.
+ @param[in] where The position of the pixie. */
+static void
+addOffset(Array<GLfloat> & offsets,
+          const Location & where)
+{
+    ODL_ENTER(); //####
+    ODL_P2("offsets = ", &offsets, "where = ", &where); //####
+    offsets.add(static_cast<GLfloat>(where.x));
+    offsets.add(static_cast<GLfloat>(where.y));
+    offsets.add(static_cast<GLfloat>(where.z));
+    ODL_EXIT(); //####
+} // addOffset
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -253,7 +273,9 @@ setVertexData(Array<Vertex> & vertexList,
 GraphicsPanel::GraphicsPanel(ContentPanel * theContainer,
                              const int      startingWidth,
                              const int      startingHeight) :
-    inherited(), _container(theContainer), _rotation(0.0f), _scale(0.5f), _nextPixie(0)
+    inherited(), _container(theContainer), _rotation(0.0f), _scale(0.5f), _benchmarkStart(0),
+    _benchmarkDuration(0), _benchmarkFrames(0), _nextPixie(0), _benchmarkPixies(0),
+    _benchmarkPending(false), _benchmarkRunning(false), _useInstancing(true)
 {
     ODL_ENTER(); //####
     ODL_P1("theContainer = ", theContainer); //####
@@ -371,103 +393,89 @@ GraphicsPanel::drawBackground(const float desktopScale)
     ODL_OBJEXIT(); //####
 } // GraphicsPanel::drawBackground
 
-void
-GraphicsPanel::drawPixie(const Pixie & stuff,
-                         const Shape   theShape)
-{
-    ODL_OBJENTER(); //####
-    ODL_P1("stuff = ", &stuff); //####
-    ODL_LL1("theShape = ", theShape); //####
-    if (stuff._valid)
-    {
-        const Location & where = stuff._where;
-        VertexBuffer *   selected;
-
-        switch (theShape)
-        {
-            case kShapeCube :
-                if (! _cubeData)
-                {
-                    setUpCube();
-                }
-                selected = _cubeData;
-                break;
-
-            case kShapeTetrahedron :
-                if (! _tetrahedronData)
-                {
-                    setUpTetrahedron();
-                }
-                selected = _tetrahedronData;
-                break;
-
-            case kShapeOctahedron :
-                if (! _octahedronData)
-                {
-                    setUpOctahedron();
-                }
-                selected = _octahedronData;
-                break;
-
-            default :
-                selected = NULL;
-                break;
-
-        }
-        if (selected)
-        {
-            ODL_LOG("(selected)"); //####
-            if (NULL != _offsetUniform)
-            {
-                _offsetUniform->set(static_cast<float>(where.x), static_cast<float>(where.y),
-                                    static_cast<float>(where.z), 0.0f);
-            }
-            selected->bind();
-            enableVertexAttributes();
-            glDrawElements(GL_TRIANGLES, selected->numberOfIndices(), GL_UNSIGNED_INT, 0);
-            disableVertexAttributes();
-        }
-    }
-    ODL_OBJEXIT(); //####
-} // GraphicsPanel::drawPixie
-
 void
 GraphicsPanel::drawPixies(const Array<Pixie> & toBeDrawn)
 {
     ODL_OBJENTER(); //####
     ODL_P1("toBeDrawn = ", &toBeDrawn);
+    // Sort the pixies by shape, so that each shape can be drawn with a single call.
+    _cubeOffsets.clearQuick();
+    _octahedronOffsets.clearQuick();
+    _tetrahedronOffsets.clearQuick();
     for (int ii = 0, mm = toBeDrawn.size(); mm > ii; ++ii)
     {
-        const Pixie & aPixie = _pixies.getReference(ii);
+        const Pixie & aPixie = toBeDrawn.getReference(ii);
 
         if (aPixie._valid)
         {
-            Shape whichShape = kShapeCube;
-
             switch (ii % 3)
             {
                 case 0 :
-                    whichShape = kShapeCube;
+                    addOffset(_cubeOffsets, aPixie._where);
                     break;
 
                 case 1 :
-                    whichShape = kShapeTetrahedron;
+                    addOffset(_tetrahedronOffsets, aPixie._where);
                     break;
 
                 case 2 :
-                    whichShape = kShapeOctahedron;
+                    addOffset(_octahedronOffsets, aPixie._where);
                     break;
 
                 default :
                     break;
 
             }
-            drawPixie(aPixie, whichShape);
         }
     }
+    drawShapes(kShapeCube, _cubeOffsets);
+    drawShapes(kShapeTetrahedron, _tetrahedronOffsets);
+    drawShapes(kShapeOctahedron, _octahedronOffsets);
     ODL_OBJEXIT(); //####
 } // GraphicsPanel::drawPixies
 
+void
+GraphicsPanel::drawShapes(const Shape            theShape,
+                          const Array<GLfloat> & offsets)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("theShape = ", theShape); //####
+    ODL_P1("offsets = ", &offsets); //####
+    int            numShapes = (offsets.size() / 3);
+    VertexBuffer * selected = ((0 < numShapes) ? selectShape(theShape) : NULL);
+
+    if (selected)
+    {
+        ODL_LOG("(selected)"); //####
+        selected->bind();
+        enableVertexAttributes();
+        if (_useInstancing && (NULL != _instanceOffsetAttribute) && selected->canDrawInstances())
+        {
+            // Each copy is moved by its per-instance offset, so the common offset is cleared.
+            if (NULL != _offsetUniform)
+            {
+                _offsetUniform->set(0.0f, 0.0f, 0.0f, 0.0f);
+            }
+            selected->drawInstances(offsets.getRawDataPointer(), numShapes,
+                                    _instanceOffsetAttribute->attributeID);
+        }
+        else
+        {
+            for (int ii = 0; numShapes > ii; ++ii)
+            {
+                if (NULL != _offsetUniform)
+                {
+                    _offsetUniform->set(offsets[3 * ii], offsets[(3 * ii) + 1],
+                                        offsets[(3 * ii) + 2], 0.0f);
+                }
+                glDrawElements(GL_TRIANGLES, selected->numberOfIndices(), GL_UNSIGNED_INT, 0);
+            }
+        }
+        disableVertexAttributes();
+    }
+    ODL_OBJEXIT(); //####
+} // GraphicsPanel::drawShapes
+
 void
 GraphicsPanel::enableVertexAttributes(void)
 {
@@ -524,6 +532,7 @@ GraphicsPanel::freeContextObjects(void)
     _normalAttribute = NULL;
     _sourceColourAttribute = NULL;
     _textureCoordInAttribute = NULL;
+    _instanceOffsetAttribute = NULL;
     _texture.release();
     ODL_P4("_positionAttribute <- ", _positionAttribute, "_normalAttribute <- ", //####
            _normalAttribute, "_sourceColourAttribute <- ", _sourceColourAttribute, //####
@@ -587,6 +596,42 @@ GraphicsPanel::openGLContextClosing(void)
     ODL_OBJEXIT(); //####
 } // GraphicsPanel::openGLContextClosing
 
+void
+GraphicsPanel::publishPixieData(void)
+{
+    ODL_OBJENTER(); //####
+    Array<Pixie> & slot = _latestPixies.writeSlot();
+
+    // Reuse the storage of the slot, so that publishing doesn't allocate once it has filled up.
+    slot.clearQuick();
+    slot.addArray(_pixies);
+    _latestPixies.publish();
+    ODL_OBJEXIT(); //####
+} // GraphicsPanel::publishPixieData
+
+void
+GraphicsPanel::recordBenchmarkFrame(void)
+{
+    ODL_OBJENTER(); //####
+    double elapsed = ((Time::getMillisecondCounterHiRes() - _benchmarkStart) / 1000.0);
+
+    ++_benchmarkFrames;
+    if (_benchmarkDuration <= elapsed)
+    {
+        bool         instanced = (_useInstancing && (NULL != _instanceOffsetAttribute) &&
+                                  (NULL != _cubeData) && _cubeData->canDrawInstances());
+        const char * renderer = reinterpret_cast<const char *>(glGetString(GL_RENDERER));
+
+        cout << (renderer ? renderer : "unknown renderer") << ": " << _benchmarkPixies <<
+                " pixies, " << (instanced ? "instanced" : "individual") << " drawing, " <<
+                _benchmarkFrames << " frames in " << elapsed << " seconds = " <<
+                (_benchmarkFrames / elapsed) << " frames per second" << endl;
+        _benchmarkRunning = false;
+        JUCEApplication::quit();
+    }
+    ODL_OBJEXIT(); //####
+} // GraphicsPanel::recordBenchmarkFrame
+
 void
 GraphicsPanel::renderOpenGL(void)
 {
@@ -594,11 +639,19 @@ GraphicsPanel::renderOpenGL(void)
     if (OpenGLHelpers::isContextActive())
     {
         const float desktopScale = static_cast<float>(_context.getRenderingScale());
-        Array<Pixie> toBeDrawn;
 
-        _csect.enter();
-        toBeDrawn = _pixies;
-        _csect.exit();
+        if (_benchmarkPending)
+        {
+            // Don't wait for the display refresh, so that the frame rate reflects the drawing.
+            _context.setSwapInterval(0);
+            _benchmarkFrames = 0;
+            _benchmarkStart = Time::getMillisecondCounterHiRes();
+            _benchmarkPending = false;
+            _benchmarkRunning = true;
+        }
+        // The read slot belongs to the renderer, so it can be drawn from without a copy; if no
+        // new data has arrived, the previous data is drawn again.
+        _latestPixies.acquire();
         OpenGLHelpers::clear(Colours::lightblue); // FOR NOW
         setUpTexture();
         drawBackground(desktopScale);
@@ -634,7 +687,7 @@ GraphicsPanel::renderOpenGL(void)
             {
                 _lightPositionUniform->set(-15.0f, 10.0f, 15.0f, 0.0f);
             }
-            drawPixies(toBeDrawn);
+            drawPixies(_benchmarkRunning ? _benchmarkData : _latestPixies.readSlot());
             // Reset the element buffers so child Components draw correctly
             _context.extensions.glBindBuffer(GL_ARRAY_BUFFER, 0);
             _context.extensions.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
@@ -645,6 +698,10 @@ GraphicsPanel::renderOpenGL(void)
             }
 #endif // defined(DO_AUTOROTATE)
         }
+        if (_benchmarkRunning)
+        {
+            recordBenchmarkFrame();
+        }
     }
     else
     {
@@ -661,6 +718,48 @@ GraphicsPanel::resized(void)
     ODL_OBJEXIT(); //####
 } // GraphicsPanel::resized
 
+VertexBuffer *
+GraphicsPanel::selectShape(const Shape theShape)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("theShape = ", theShape); //####
+    VertexBuffer * result;
+
+    switch (theShape)
+    {
+        case kShapeCube :
+            if (! _cubeData)
+            {
+                setUpCube();
+            }
+            result = _cubeData;
+            break;
+
+        case kShapeTetrahedron :
+            if (! _tetrahedronData)
+            {
+                setUpTetrahedron();
+            }
+            result = _tetrahedronData;
+            break;
+
+        case kShapeOctahedron :
+            if (! _octahedronData)
+            {
+                setUpOctahedron();
+            }
+            result = _octahedronData;
+            break;
+
+        default :
+            result = NULL;
+            break;
+
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // GraphicsPanel::selectShape
+
 void
 GraphicsPanel::setShaderProgram(const String & vertexShader,
                                 const String & fragmentShader)
@@ -783,6 +882,34 @@ GraphicsPanel::setUpTexture(void)
     ODL_OBJEXIT(); //####
 } // GraphicsPanel::setUpTexture
 
+void
+GraphicsPanel::startBenchmark(const int    numPixies,
+                              const double duration,
+                              const bool   useInstancing)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("numPixies = ", numPixies); //####
+    ODL_D1("duration = ", duration); //####
+    ODL_B1("useInstancing = ", useInstancing); //####
+    Random randomizer;
+
+    _benchmarkData.clearQuick();
+    for (int ii = 0; numPixies > ii; ++ii)
+    {
+        double newX = (kBenchmarkRange * ((2.0 * randomizer.nextDouble()) - 1.0));
+        double newY = (kBenchmarkRange * ((2.0 * randomizer.nextDouble()) - 1.0));
+        double newZ = (kBenchmarkRange * ((2.0 * randomizer.nextDouble()) - 1.0));
+
+        _benchmarkData.add(Pixie(newX, newY, newZ));
+    }
+    _benchmarkPixies = numPixies;
+    _benchmarkDuration = duration;
+    _useInstancing = useInstancing;
+    // The renderer starts the timing, as the display refresh setting belongs to its thread.
+    _benchmarkPending = true;
+    ODL_OBJEXIT(); //####
+} // GraphicsPanel::startBenchmark
+
 void
 GraphicsPanel::updatePixieData(const double newX,
                                const double newY,
@@ -792,7 +919,6 @@ GraphicsPanel::updatePixieData(const double newX,
     ODL_D3("newX = ", newX, "newY = ", newY, "newZ = ", newZ); //####
     Pixie newValue(newX, newY, newZ);
 
-    _csect.enter();
     if (kNumPixies > _pixies.size())
     {
         _pixies.add(newValue);
@@ -803,7 +929,6 @@ GraphicsPanel::updatePixieData(const double newX,
         _nextPixie %= kNumPixies;
         ODL_LL1("_nextPixies <- ", _nextPixie); //####
     }
-    _csect.exit();
     ODL_OBJEXIT(); //####
 } // GraphicsPanel::updatePixieData
 
@@ -826,6 +951,8 @@ GraphicsPanel::updateShader(void)
             _normalAttribute = createAttribute(_context, *_shaderProgram, "normal");
             _sourceColourAttribute = createAttribute(_context, *_shaderProgram, "sourceColour");
             _textureCoordInAttribute = createAttribute(_context, *_shaderProgram, "texureCoordIn");
+            _instanceOffsetAttribute = createAttribute(_context, *_shaderProgram,
+                                                       "instanceOffset");
             ODL_P4("_positionAttribute <- ", _positionAttribute, "_normalAttribute <- ", //####
                    _normalAttribute, "_sourceColourAttribute <- ", _sourceColourAttribute, //####
                    "_textureCoordInAttribute <- ", _textureCoordInAttribute); //####
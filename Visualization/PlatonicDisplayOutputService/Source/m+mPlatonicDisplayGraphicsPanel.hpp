@@ -43,6 +43,8 @@
 # include "m+mPlatonicDisplayDataTypes.hpp"
 # include "m+mVertexBuffer.hpp"
 
+# include <m+m/m+mLatestValueBuffer.hpp>
+
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -123,14 +125,36 @@ namespace PlatonicDisplay
         virtual void
         openGLContextClosing(void);
 
+        /*! @brief Hand the pixie data to the renderer.
+
+         Note that the data is handed over through a latest-value buffer, so this is meant to be
+         called from the input handler thread once a message has been processed and never waits
+         for the renderer. */
+        void
+        publishPixieData(void);
+
         /*! @brief Called when hte next OpenGL frame should be rendered. */
         virtual void
         renderOpenGL(void);
 
+        /*! @brief Draw a fixed set of pixies as fast as possible and report the frame rate.
+
+         The pixies are placed at random and the input handler data is ignored. Once the time has
+         passed, the number of frames drawn per second is written to the standard output stream
+         and the application is asked to quit.
+         @param[in] numPixies The number of pixies to draw in each frame.
+         @param[in] duration The number of seconds to draw for.
+         @param[in] useInstancing @c true if each shape is to be drawn with a single call and
+         @c false if each pixie is to be drawn separately. */
+        void
+        startBenchmark(const int    numPixies,
+                       const double duration,
+                       const bool   useInstancing);
+
         /*! @brief Update the pixie data.
          
-         Note that the access to the data is guarded by a critical section, so this is meant to be
-         called from the input handler thread.
+         Note that the data is only seen by the renderer once it has been published, so this is
+         meant to be called from the input handler thread.
          @param[in] newX The new X coordinate.
          @param[in] newY The new Y coordinate.
          @param[in] newZ The new Z coordinate. */
@@ -160,18 +184,20 @@ namespace PlatonicDisplay
         void
         drawBackground(const float desktopScale);
 
-        /*! @brief Draw a pixie.
-         @param[in] stuff The pixie information.
-         @param[in] theShape The shape to use when drawing. */
-        void
-        drawPixie(const Pixie & stuff,
-                  const Shape   theShape);
-
         /*! @brief Draw some pixies.
          @param[in] toBeDrawn The pixies to draw. */
         void
         drawPixies(const Array<Pixie> & toBeDrawn);
 
+        /*! @brief Draw copies of a shape.
+
+         If instanced drawing is available, all the copies are drawn with a single call.
+         @param[in] theShape The shape to draw.
+         @param[in] offsets The positions of the copies, as consecutive x, y and z values. */
+        void
+        drawShapes(const Shape            theShape,
+                   const Array<GLfloat> & offsets);
+
         /*! @brief Enable the active vertex attributes. */
         void
         enableVertexAttributes(void);
@@ -202,10 +228,21 @@ namespace PlatonicDisplay
         virtual void
         mouseDrag(const MouseEvent & ee);
 
+        /*! @brief Record a frame drawn for the benchmark and report once the time has passed.
+         */
+        void
+        recordBenchmarkFrame(void);
+
         /*! @brief Called when the component size has been changed. */
         virtual void
         resized(void);
 
+        /*! @brief Return the vertex data for a shape, setting it up if needed.
+         @param[in] theShape The shape to use when drawing.
+         @returns The vertex data for the shape or @c NULL if the shape is not recognized. */
+        CommonVisuals::VertexBuffer *
+        selectShape(const Shape theShape);
+
         /*! @brief Set the shader program source strings.
          @param[in] vertexShader The source for the vertex shader.
          @param[in] fragmentShader The source for the fragment shader. */
@@ -239,9 +276,6 @@ namespace PlatonicDisplay
 
     private :
         
-        /*! @brief The access control for the finger coordinates. */
-        CriticalSection _csect;
-        
         /*! @brief The OpenGL rendering context. */
         OpenGLContext _context;
 
@@ -260,8 +294,23 @@ namespace PlatonicDisplay
         /*! @brief The vertex data for a tetrahedron. */
         Array<CommonVisuals::Vertex> _tetrahedronVertices;
 
-        /*! @brief The pixies to be drawn. */
+        /*! @brief The pixies being updated by the input handler. */
         Array<Pixie> _pixies;
+
+        /*! @brief The handoff of the pixies from the input handler to the renderer. */
+        MplusM::Common::LatestValueBuffer< Array<Pixie> > _latestPixies;
+
+        /*! @brief The pixies drawn for the benchmark. */
+        Array<Pixie> _benchmarkData;
+
+        /*! @brief The positions of the pixies to be drawn as cubes. */
+        Array<GLfloat> _cubeOffsets;
+
+        /*! @brief The positions of the pixies to be drawn as octahedrons. */
+        Array<GLfloat> _octahedronOffsets;
+
+        /*! @brief The positions of the pixies to be drawn as tetrahedrons. */
+        Array<GLfloat> _tetrahedronOffsets;
         
         /*! @brief The shader program to use for rendering. */
         ScopedPointer<OpenGLShaderProgram> _shaderProgram;
@@ -292,6 +341,9 @@ namespace PlatonicDisplay
         
         /*! @brief The vertex attribute for its texture coordinate. */
         ScopedPointer<OpenGLShaderProgram::Attribute> _textureCoordInAttribute;
+
+        /*! @brief The vertex attribute for the offset of each instance. */
+        ScopedPointer<OpenGLShaderProgram::Attribute> _instanceOffsetAttribute;
         
         /*! @brief The vertices, normals, colour and texture coordinates for a cube. */
         ScopedPointer<CommonVisuals::VertexBuffer> _cubeData;
@@ -317,8 +369,29 @@ namespace PlatonicDisplay
         /*! @brief The scaling factor to apply to the image. */
         float _scale;
 
+        /*! @brief The time, in milliseconds, when the benchmark started. */
+        double _benchmarkStart;
+
+        /*! @brief The number of seconds to run the benchmark for. */
+        double _benchmarkDuration;
+
+        /*! @brief The number of frames drawn for the benchmark. */
+        int64 _benchmarkFrames;
+
         /*! @brief The next pixie to be updated. */
         int _nextPixie;
+
+        /*! @brief The number of pixies drawn for the benchmark. */
+        int _benchmarkPixies;
+
+        /*! @brief @c true if the benchmark has been requested but has not started. */
+        bool _benchmarkPending;
+
+        /*! @brief @c true if the benchmark is running. */
+        bool _benchmarkRunning;
+
+        /*! @brief @c true if each shape is to be drawn with a single call, if possible. */
+        bool _useInstancing;
         
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GraphicsPanel)
 
@@ -215,6 +215,8 @@ PlatonicDisplayInputHandler::handleInput(const yarp::os::Bottle &     input,
 
                         }
                     }
+                    // Let the renderer see the whole message at once, rather than point by point.
+                    aPanel->publishPixieData();
                 }
             }
         }
@@ -0,0 +1,391 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mFilterPipelineMain.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The main application for running a chain of example services in one process.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mRandomBurstInputService.hpp"
+#include "m+mRecordIntegersOutputService.hpp"
+#include "m+mTruncateFloatFilterService.hpp"
+
+#include <m+m/m+mDoubleArgumentDescriptor.hpp>
+#include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mFilePathArgumentDescriptor.hpp>
+#include <m+m/m+mIntArgumentDescriptor.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The main application for running a chain of example services in one process. */
+
+/*! @dir FilterPipeline
+ @brief The set of files that implement the in-process example service chain. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Example;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The description of the application. */
+#define FILTERPIPELINE_DESCRIPTION_ T_("Random Burst, Truncate Float and Record Integers " \
+                                       "services in one process")
+
+/*! @brief The number of messages that can be waiting between two services. */
+static const size_t kLinkCapacity = 1024;
+
+/*! @brief The number of services in the chain. */
+static const size_t kStageCount = 3;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Start a service and register it, so that it is visible to the rest of the system.
+ @param[in] stage The service to be started.
+ @param[in] configuration The configuration for the service.
+ @returns @c true if the service was started, registered and configured and @c false
+ otherwise. */
+static bool
+startStage(BaseInputOutputService & stage,
+           const yarp::os::Bottle & configuration)
+{
+    ODL_ENTER(); //####
+    ODL_P2("stage = ", &stage, "configuration = ", &configuration); //####
+    bool result = false;
+
+    if (stage.startService())
+    {
+        YarpString channelName(stage.getEndpoint().getName());
+
+        ODL_S1s("channelName = ", channelName); //####
+        if (RegisterLocalService(channelName, stage))
+        {
+            stage.startPinger();
+            result = stage.configure(configuration);
+            if (! result)
+            {
+                ODL_LOG("! (stage.configure(configuration))"); //####
+                UnregisterLocalService(channelName, stage);
+                stage.stopService();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (RegisterLocalService(channelName, stage))"); //####
+            MpM_FAIL_(MSG_SERVICE_NOT_REGISTERED);
+            stage.stopService();
+        }
+    }
+    else
+    {
+        ODL_LOG("! (stage.startService())"); //####
+        MpM_FAIL_(MSG_SERVICE_NOT_STARTED);
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // startStage
+
+/*! @brief Stop a service that was started by startStage and unregister it.
+ @param[in] stage The service to be stopped.
+ @param[in] reportOnExit @c true if service metrics are to be reported and @c false otherwise. */
+static void
+stopStage(BaseInputOutputService & stage,
+          const bool               reportOnExit)
+{
+    ODL_ENTER(); //####
+    ODL_P1("stage = ", &stage); //####
+    ODL_B1("reportOnExit = ", reportOnExit); //####
+    YarpString channelName(stage.getEndpoint().getName());
+
+    stage.stopStreams();
+    UnregisterLocalService(channelName, stage);
+    if (reportOnExit)
+    {
+        yarp::os::Bottle metrics;
+
+        stage.gatherMetrics(metrics);
+        YarpString converted(Utilities::ConvertMetricsToString(metrics));
+
+        cout << channelName.c_str() << endl << converted.c_str() << endl;
+    }
+    stage.stopService();
+    ODL_EXIT(); //####
+} // stopStage
+
+/*! @brief Set up the services, link them together and run them until asked to stop.
+ @param[in] progName The path to the executable.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the application.
+ @param[in] tag The modifier for the service names and port names.
+ @param[in] modFlag The address-based modifier to apply to the tag value.
+ @param[in] burstPeriod The number of seconds between data bursts.
+ @param[in] burstSize The number of values in each data burst.
+ @param[in] recordPath The path to the output file.
+ @param[in] firstCore The processor core for the first linked service, or a negative number if
+ the services are not to be bound to cores.
+ @param[in] reportOnExit @c true if service metrics are to be reported on exit and @c false
+ otherwise. */
+static void
+setUpAndGo(const YarpString &       progName,
+           const int                argc,
+           char * *                 argv,
+           const YarpString &       tag,
+           const AddressTagModifier modFlag,
+           const double             burstPeriod,
+           const int                burstSize,
+           const YarpString &       recordPath,
+           const int                firstCore,
+           const bool               reportOnExit)
+{
+    ODL_ENTER(); //####
+    ODL_P1("argv = ", argv); //####
+    ODL_S3s("progName = ", progName, "tag = ", tag, "recordPath = ", recordPath); //####
+    ODL_LL3("argc = ", argc, "burstSize = ", burstSize, "firstCore = ", firstCore); //####
+    ODL_D1("burstPeriod = ", burstPeriod); //####
+    ODL_B1("reportOnExit = ", reportOnExit); //####
+    // The services are configured here rather than through prompts, so they have no arguments.
+    Utilities::DescriptorVector noArguments;
+    yarp::os::Bottle            configurations[kStageCount];
+    YarpString                  endpointNames[kStageCount];
+    YarpString                  stageTags[kStageCount];
+    BaseInputOutputService *    stages[kStageCount];
+    size_t                      started = 0;
+
+    stageTags[0] = stageTags[1] = stageTags[2] = tag;
+    AdjustEndpointName(DEFAULT_RANDOMBURSTINPUT_SERVICE_NAME_, modFlag, stageTags[0],
+                       endpointNames[0]);
+    AdjustEndpointName(DEFAULT_TRUNCATEFLOATFILTER_SERVICE_NAME_, modFlag, stageTags[1],
+                       endpointNames[1]);
+    AdjustEndpointName(DEFAULT_RECORDINTEGERSOUTPUT_SERVICE_NAME_, modFlag, stageTags[2],
+                       endpointNames[2],
+                       Utilities::GetFileNameBase(Utilities::GetFileNamePart(recordPath)));
+    stages[0] = new RandomBurstInputService(noArguments, progName, argc, argv, stageTags[0],
+                                            endpointNames[0], "");
+    stages[1] = new TruncateFloatFilterService(noArguments, progName, argc, argv, stageTags[1],
+                                               endpointNames[1], "");
+    stages[2] = new RecordIntegersOutputService(noArguments, progName, argc, argv, stageTags[2],
+                                                endpointNames[2], "");
+    configurations[0].addDouble(burstPeriod);
+    configurations[0].addInt(burstSize);
+    configurations[2].addString(recordPath);
+    for ( ; (kStageCount > started) && startStage(*stages[started], configurations[started]);
+         ++started)
+    {
+    }
+    if (kStageCount == started)
+    {
+        StartRunning();
+        SetSignalHandlers(SignalRunningStop);
+        // The downstream services must be ready for data before anything is sent to them, and
+        // each link thread runs the input handler of the service that it feeds.
+        stages[2]->startStreams();
+        stages[1]->startStreams();
+        if (stages[1]->linkOutlet(0, stages[2], 0, kLinkCapacity,
+                                  (0 <= firstCore) ? (firstCore + 1) : -1) &&
+            stages[0]->linkOutlet(0, stages[1], 0, kLinkCapacity, firstCore))
+        {
+            stages[0]->startStreams();
+            for ( ; IsRunning(); )
+            {
+                ConsumeSomeTime();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (stages[1]->linkOutlet(0, stages[2], 0, kLinkCapacity, " //####
+                    "(0 <= firstCore) ? (firstCore + 1) : -1) && " //####
+                    "stages[0]->linkOutlet(0, stages[1], 0, kLinkCapacity, " //####
+                    "firstCore))"); //####
+            cerr << "Could not link the services." << endl;
+        }
+        // The links refer to the input channels of the downstream services, so they must be
+        // removed before anything is stopped.
+        stages[0]->linkOutlet(0, NULL);
+        stages[1]->linkOutlet(0, NULL);
+    }
+    for ( ; 0 < started; --started)
+    {
+        stopStage(*stages[started - 1], reportOnExit);
+    }
+    for (size_t ii = 0; kStageCount > ii; ++ii)
+    {
+        delete stages[ii];
+    }
+    ODL_EXIT(); //####
+} // setUpAndGo
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for running the Random Burst, Truncate Float and Record Integers
+ services in one process.
+
+ The services are registered and their channels can be connected to as usual, but the data passes
+ from one service to the next without being sent over the network, and each linked service runs
+ on its own processor core. The first, optional, argument is the burst period, in seconds, the
+ second, optional, argument is the number of random values to generate in each burst, the third,
+ optional, argument is the path to the output file and the fourth, optional, argument is the
+ processor core for the Truncate Float service, with the Record Integers service using the next
+ core; a negative core leaves the services unbound.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the application.
+ @returns @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+#if defined(MpM_ServicesLogToStandardError)
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionWriteToStderr | //####
+             kODLoggingOptionEnableThreadSupport); //####
+#else // ! defined(MpM_ServicesLogToStandardError)
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport); //####
+#endif // ! defined(MpM_ServicesLogToStandardError)
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    try
+    {
+        AddressTagModifier                    modFlag = kModificationNone;
+        bool                                  goWasSet = false;
+        bool                                  reportEndpoint = false;
+        bool                                  reportOnExit = false;
+        YarpString                            serviceEndpointName;
+        YarpString                            servicePortNumber;
+        YarpString                            tag;
+        Utilities::DoubleArgumentDescriptor   firstArg("period", T_("Interval between bursts"),
+                                                       Utilities::kArgModeOptionalModifiable,
+                                                       0.1, true, 0, false, 0);
+        Utilities::IntArgumentDescriptor      secondArg("size", T_("Burst size"),
+                                                        Utilities::kArgModeOptionalModifiable, 1,
+                                                        true, 1, false, 0);
+        Utilities::FilePathArgumentDescriptor thirdArg("filePath", T_("Path to output file"),
+                                                       Utilities::kArgModeOptionalModifiable,
+                                                       TEMP_ROOT_ + kDirectorySeparator + "record_",
+                                                       ".txt", true, true);
+        Utilities::IntArgumentDescriptor      fourthArg("core", T_("First processor core"),
+                                                        Utilities::kArgModeOptionalModifiable, 0,
+                                                        true, -1, false, 0);
+        Utilities::DescriptorVector           argumentList;
+
+        argumentList.push_back(&firstArg);
+        argumentList.push_back(&secondArg);
+        argumentList.push_back(&thirdArg);
+        argumentList.push_back(&fourthArg);
+        if (ProcessStandardServiceOptions(argc, argv, argumentList, FILTERPIPELINE_DESCRIPTION_,
+                                          "", 2026, STANDARD_COPYRIGHT_NAME_, goWasSet,
+                                          reportEndpoint, reportOnExit, tag, serviceEndpointName,
+                                          servicePortNumber, modFlag,
+                                          static_cast<OptionsMask>(kSkipChannelOption |
+                                                                   kSkipEndpointOption |
+                                                                   kSkipGoOption |
+                                                                   kSkipPortOption)))
+        {
+            Utilities::SetUpGlobalStatusReporter();
+            Utilities::CheckForNameServerReporter();
+            if (Utilities::CheckForValidNetwork())
+            {
+                yarp::os::Network yarp; // This is necessary to establish any connections to the
+                                        // YARP infrastructure
+
+                Initialize(progName);
+                YarpString recordPath(thirdArg.getCurrentValue());
+
+                if (0 == recordPath.length())
+                {
+                    std::stringstream buff;
+
+                    buff << (TEMP_ROOT_ + kDirectorySeparator + "record_").c_str();
+                    buff << (Utilities::GetRandomHexString() + ".txt").c_str();
+                    recordPath = buff.str();
+                    ODL_S1s("recordPath <- ", recordPath); //####
+                }
+                if (Utilities::CheckForRegistryService())
+                {
+                    setUpAndGo(progName, argc, argv, tag, modFlag, firstArg.getCurrentValue(),
+                               secondArg.getCurrentValue(), recordPath,
+                               fourthArg.getCurrentValue(), reportOnExit);
+                }
+                else
+                {
+                    ODL_LOG("! (Utilities::CheckForRegistryService())"); //####
+                    MpM_FAIL_(MSG_REGISTRY_NOT_RUNNING);
+                }
+            }
+            else
+            {
+                ODL_LOG("! (Utilities::CheckForValidNetwork())"); //####
+                MpM_FAIL_(MSG_YARP_NOT_RUNNING);
+            }
+            Utilities::ShutDownGlobalStatusReporter();
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+    }
+    yarp::os::Network::fini();
+    ODL_EXIT_L(0); //####
+    return 0;
+} // main
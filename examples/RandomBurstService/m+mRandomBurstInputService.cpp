@@ -41,6 +41,7 @@
 #include "m+mRandomBurstInputThread.hpp"
 
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mGeneralChannel.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -97,7 +98,8 @@ RandomBurstInputService::RandomBurstInputService(const Utilities::DescriptorVect
                                                                              servicePortNumber) :
     inherited(argumentList, launchPath, argc, argv, tag, true, MpM_RANDOMBURSTINPUT_CANONICAL_NAME_,
               RANDOMBURSTINPUT_SERVICE_DESCRIPTION_, "", serviceEndpointName, servicePortNumber),
-    _generator(NULL), _burstPeriod(1), _burstSize(1)
+    _generator(NULL), _queuePolicyName("block"), _burstPeriod(1), _burstSize(1), _queueLength(0),
+    _queuePolicy(kOutputQueuePolicyBlock)
 {
     ODL_ENTER(); //####
     ODL_P2("argumentList = ", &argumentList, "argv = ", argv); //####
@@ -137,15 +139,59 @@ RandomBurstInputService::configure(const yarp::os::Bottle & details)
                 double firstNumber = firstValue.asDouble();
                 int    secondNumber = secondValue.asInt();
 
-                if ((0 < firstNumber) && (0 < secondNumber))
+                int               queueLength = 0;
+                OutputQueuePolicy queuePolicy = kOutputQueuePolicyBlock;
+                YarpString        queuePolicyName("block");
+                bool              okSoFar = ((0 < firstNumber) && (0 < secondNumber));
+
+                // The queue length and policy are optional, so that older configurations
+                // continue to be accepted.
+                if (okSoFar && (3 <= details.size()))
+                {
+                    yarp::os::Value thirdValue(details.get(2));
+
+                    if (thirdValue.isInt() && (0 <= thirdValue.asInt()))
+                    {
+                        queueLength = thirdValue.asInt();
+                    }
+                    else
+                    {
+                        okSoFar = false;
+                    }
+                }
+                if (okSoFar && (4 <= details.size()))
+                {
+                    yarp::os::Value fourthValue(details.get(3));
+
+                    if (fourthValue.isString())
+                    {
+                        queuePolicyName = fourthValue.toString();
+                        okSoFar = GeneralChannel::ParseOutputQueuePolicy(queuePolicyName,
+                                                                         queuePolicy);
+                    }
+                    else
+                    {
+                        okSoFar = false;
+                    }
+                }
+                if (okSoFar)
                 {
                     std::stringstream buff;
 
                     _burstPeriod = firstNumber;
                     _burstSize = secondNumber;
+                    _queueLength = queueLength;
+                    _queuePolicy = queuePolicy;
+                    _queuePolicyName = queuePolicyName;
                     ODL_D1("_burstPeriod <- ", _burstPeriod); //####
-                    ODL_LL1("_burstSize <- ", _burstSize); //####
+                    ODL_LL2("_burstSize <- ", _burstSize, "_queueLength <- ", _queueLength); //####
+                    ODL_S1s("_queuePolicyName <- ", _queuePolicyName); //####
                     buff << "Burst period is " << _burstPeriod << ", burst size is " << _burstSize;
+                    if (0 < _queueLength)
+                    {
+                        buff << ", queue length is " << _queueLength << ", queue policy is " <<
+                                _queuePolicyName.c_str();
+                    }
                     setExtraInformation(buff.str());
                     result = true;
                 }
@@ -183,6 +229,8 @@ RandomBurstInputService::getConfiguration(yarp::os::Bottle & details)
     details.clear();
     details.addDouble(_burstPeriod);
     details.addInt(_burstSize);
+    details.addInt(_queueLength);
+    details.addString(_queuePolicyName);
     ODL_OBJEXIT_B(result); //####
     return result;
 } // RandomBurstInputService::getConfiguration
@@ -226,6 +274,12 @@ RandomBurstInputService::startStreams(void)
     {
         if (! isActive())
         {
+            if (! setOutletQueue(0, static_cast<size_t>(_queueLength), _queuePolicy))
+            {
+                ODL_LOG("! (setOutletQueue(0, static_cast<size_t>(_queueLength), " //####
+                        "_queuePolicy))"); //####
+                cerr << "Could not set up the output queue." << endl;
+            }
             _generator = new RandomBurstInputThread(getOutletStream(0), _burstPeriod, _burstSize);
             if (_generator->start())
             {
@@ -154,12 +154,22 @@ namespace MplusM
             /*! @brief The output thread to use. */
             RandomBurstInputThread * _generator;
 
+            /*! @brief The name of the overflow policy for the output queue. */
+            YarpString _queuePolicyName;
+
             /*! @brief The number of seconds between data bursts. */
             double _burstPeriod;
 
             /*! @brief The number of values in each data burst. */
             int _burstSize;
 
+            /*! @brief The number of bursts that can be waiting to be sent, or zero if the bursts
+             are written directly. */
+            int _queueLength;
+
+            /*! @brief The overflow policy for the output queue. */
+            Common::OutputQueuePolicy _queuePolicy;
+
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunused-private-field"
@@ -41,6 +41,7 @@
 #include <m+m/m+mDoubleArgumentDescriptor.hpp>
 #include <m+m/m+mEndpoint.hpp>
 #include <m+m/m+mIntArgumentDescriptor.hpp>
+#include <m+m/m+mStringArgumentDescriptor.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -137,7 +138,10 @@ setUpAndGo(const Utilities::DescriptorVector & argumentList,
 /*! @brief The entry point for running the Random Burst input service.
 
  The second, optional, argument is the number of random values to generate in each burst and the
- first, optional, argument is the burst period, in seconds.
+ first, optional, argument is the burst period, in seconds. The third, optional, argument is the
+ number of bursts that can be waiting to be sent, with zero meaning that bursts are written
+ directly, and the fourth, optional, argument is what to do when the output queue is full - 'block',
+ 'conflate', 'newest' (discard the new burst) or 'oldest' (discard the oldest burst).
  @param[in] argc The number of arguments in 'argv'.
  @param[in] argv The arguments to be used with the Random Burst input service.
  @returns @c 0 on a successful test and @c 1 on failure. */
@@ -175,10 +179,18 @@ main(int      argc,
         Utilities::IntArgumentDescriptor    secondArg("size", T_("Burst size"),
                                                       Utilities::kArgModeOptionalModifiable, 1,
                                                       true, 1, false, 0);
+        Utilities::IntArgumentDescriptor    thirdArg("queue", T_("Output queue length"),
+                                                     Utilities::kArgModeOptionalModifiable, 0,
+                                                     true, 0, false, 0);
+        Utilities::StringArgumentDescriptor fourthArg("policy", T_("Output queue overflow policy"),
+                                                      Utilities::kArgModeOptionalModifiable,
+                                                      "block");
         Utilities::DescriptorVector         argumentList;
 
         argumentList.push_back(&firstArg);
         argumentList.push_back(&secondArg);
+        argumentList.push_back(&thirdArg);
+        argumentList.push_back(&fourthArg);
         if (ProcessStandardServiceOptions(argc, argv, argumentList,
                                           RANDOMBURSTINPUT_SERVICE_DESCRIPTION_, "", 2014,
                                           STANDARD_COPYRIGHT_NAME_, goWasSet, reportEndpoint,
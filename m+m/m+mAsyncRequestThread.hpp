@@ -0,0 +1,156 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mAsyncRequestThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that processes asynchronous requests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMAsyncRequestThread_HPP_))
+# define MpMAsyncRequestThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# include <deque>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that processes asynchronous requests. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class BaseService;
+
+        /*! @brief A request that was received as part of an 'async' request. */
+        struct AsyncRequest
+        {
+            /*! @brief The parameters for the request. */
+            yarp::os::Bottle _parameters;
+
+            /*! @brief The channel that the response is to be sent to. */
+            YarpString _replyChannel;
+
+            /*! @brief The name of the request. */
+            YarpString _request;
+
+            /*! @brief The channel that the request was received from. */
+            YarpString _senderChannel;
+
+            /*! @brief The client-provided identifier that is returned with the response. */
+            int _correlationId;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // AsyncRequest
+
+        /*! @brief The requests that are waiting to be processed. */
+        typedef std::deque<AsyncRequest> AsyncRequestQueue;
+
+        /*! @brief A thread that processes the requests queued by a service for asynchronous
+         handling.
+
+         A service has several of these threads, so that a request that takes a long time to process
+         does not hold back the responses to the requests that were sent after it. */
+        class AsyncRequestThread : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] service The service that queues the requests. */
+            explicit
+            AsyncRequestThread(BaseService & service);
+
+            /*! @brief The destructor. */
+            virtual
+            ~AsyncRequestThread(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            AsyncRequestThread(const AsyncRequestThread & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            AsyncRequestThread &
+            operator =(const AsyncRequestThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The service that queues the requests. */
+            BaseService & _service;
+
+        }; // AsyncRequestThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMAsyncRequestThread_HPP_)
@@ -39,6 +39,7 @@
 #include "m+mBaseChannel.hpp"
 
 #include <m+m/m+mBailOut.hpp>
+#include <m+m/m+mMessageCompressor.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -146,7 +147,8 @@ BaseChannel::RelinquishChannel(BaseChannel * theChannel)
 #endif // defined(__APPLE__)
 
 BaseChannel::BaseChannel(void) :
-    inherited(), _name(), _counters(), _metricsEnabled(false)
+    inherited(), _name(), _counters(), _compressor(NULL), _undecodableMessages(0),
+    _metricsEnabled(false)
 {
     ODL_ENTER(); //####
     ODL_EXIT_P(this); //####
@@ -155,6 +157,7 @@ BaseChannel::BaseChannel(void) :
 BaseChannel::~BaseChannel(void)
 {
     ODL_OBJENTER(); //####
+    delete _compressor;
     ODL_OBJEXIT(); //####
 } // BaseChannel::~BaseChannel
 
@@ -191,6 +194,47 @@ BaseChannel::close(void)
     ODL_OBJEXIT(); //####
 } // BaseChannel::close
 
+YarpString
+BaseChannel::compressionDescription(void)
+const
+{
+    ODL_OBJENTER(); //####
+    YarpString result;
+
+    if (_compressor)
+    {
+        result = _compressor->description();
+    }
+    ODL_OBJEXIT_s(result); //####
+    return result;
+} // BaseChannel::compressionDescription
+
+CompressionMethod
+BaseChannel::compressionMethod(void)
+const
+{
+    ODL_OBJENTER(); //####
+    CompressionMethod result = (_compressor ? _compressor->method() : kCompressionMethodNone);
+
+    ODL_OBJEXIT_L(static_cast<int>(result)); //####
+    return result;
+} // BaseChannel::compressionMethod
+
+void
+BaseChannel::countUndecodableMessage(void)
+{
+    ODL_OBJENTER(); //####
+    if (0 == _undecodableMessages++)
+    {
+        YarpString message("A compressed message on ");
+
+        message += _name + " could not be restored; the sender may use a compression method or "
+                   "dictionary that is not available here.";
+        MpM_WARNING_(message.c_str());
+    }
+    ODL_OBJEXIT(); //####
+} // BaseChannel::countUndecodableMessage
+
 void
 BaseChannel::disableMetrics(void)
 {
@@ -322,14 +366,52 @@ BaseChannel::openWithRetries(yarp::os::Contact & theContactInfo,
 # pragma warning(pop)
 #endif // ! MAC_OR_LINUX_
 
+bool
+BaseChannel::setCompression(const CompressionMethod method,
+                            const size_t            threshold,
+                            const YarpString &      dictionary)
+{
+    ODL_OBJENTER(); //####
+    ODL_L1("method = ", static_cast<int>(method)); //####
+    ODL_LL1("threshold = ", threshold); //####
+    ODL_S1s("dictionary = ", dictionary); //####
+    bool result = true;
+
+    delete _compressor;
+    _compressor = NULL;
+    if (kCompressionMethodNone != method)
+    {
+        _compressor = new MessageCompressor(method, threshold);
+        result = _compressor->open(dictionary);
+        if (! result)
+        {
+            ODL_LOG("(! result)"); //####
+            delete _compressor;
+            _compressor = NULL;
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseChannel::setCompression
+
 void
 BaseChannel::updateReceiveCounters(const size_t numBytes)
 {
     ODL_OBJENTER(); //####
     ODL_LL1("numBytes = ", numBytes); //####
+    updateReceiveCounters(numBytes, numBytes);
+    ODL_OBJEXIT(); //####
+} // BaseChannel::updateReceiveCounters
+
+void
+BaseChannel::updateReceiveCounters(const size_t numBytes,
+                                   const size_t uncompressedBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("numBytes = ", numBytes, "uncompressedBytes = ", uncompressedBytes); //####
     if (_metricsEnabled)
     {
-        _counters.incrementInCounters(numBytes);
+        _counters.incrementInCounters(numBytes, uncompressedBytes);
     }
     ODL_OBJEXIT(); //####
 } // BaseChannel::updateReceiveCounters
@@ -339,9 +421,19 @@ BaseChannel::updateSendCounters(const size_t numBytes)
 {
     ODL_OBJENTER(); //####
     ODL_LL1("numBytes = ", numBytes); //####
+    updateSendCounters(numBytes, numBytes);
+    ODL_OBJEXIT(); //####
+} // BaseChannel::updateSendCounters
+
+void
+BaseChannel::updateSendCounters(const size_t numBytes,
+                                const size_t uncompressedBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("numBytes = ", numBytes, "uncompressedBytes = ", uncompressedBytes); //####
     if (_metricsEnabled)
     {
-        _counters.incrementOutCounters(numBytes);
+        _counters.incrementOutCounters(numBytes, uncompressedBytes);
     }
     ODL_OBJEXIT(); //####
 } // BaseChannel::updateSendCounters
@@ -352,16 +444,12 @@ BaseChannel::writeBottle(yarp::os::Bottle & message)
     ODL_OBJENTER(); //####
     ODL_S1s("message = ", message.toString()); //####
     size_t messageSize = 0;
-
-    if (_metricsEnabled)
-    {
-        message.toBinary(&messageSize);
-    }
-    bool result = inherited::write(message);
+    size_t uncompressedSize = 0;
+    bool   result = writeWithCompression(message, messageSize, uncompressedSize);
 
     if (result && _metricsEnabled)
     {
-        updateSendCounters(messageSize);
+        updateSendCounters(messageSize, uncompressedSize);
     }
     ODL_OBJEXIT_B(result); //####
     return result;
@@ -394,6 +482,45 @@ BaseChannel::writeBottle(yarp::os::Bottle & message,
     return result;
 } // BaseChannel::writeBottle
 
+bool
+BaseChannel::writeWithCompression(yarp::os::Bottle & message,
+                                  size_t &           messageSize,
+                                  size_t &           uncompressedSize)
+{
+    ODL_OBJENTER(); //####
+    ODL_P3("message = ", &message, "messageSize = ", &messageSize, "uncompressedSize = ", //####
+           &uncompressedSize); //####
+    bool result;
+
+    messageSize = uncompressedSize = 0;
+    if (_compressor)
+    {
+        yarp::os::Bottle frame;
+
+        if (_compressor->compress(message, frame, uncompressedSize))
+        {
+            frame.toBinary(&messageSize);
+            result = inherited::write(frame);
+        }
+        else
+        {
+            messageSize = uncompressedSize;
+            result = inherited::write(message);
+        }
+    }
+    else
+    {
+        if (_metricsEnabled)
+        {
+            message.toBinary(&messageSize);
+        }
+        uncompressedSize = messageSize;
+        result = inherited::write(message);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseChannel::writeWithCompression
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -56,6 +56,8 @@ namespace MplusM
 {
     namespace Common
     {
+        class MessageCompressor;
+
         /*! @brief A convenience class to provide common resources for channels. */
         class BaseChannel : public yarp::os::Port
         {
@@ -81,6 +83,28 @@ namespace MplusM
             void
             close(void);
 
+            /*! @brief Returns how large messages written to the channel are compressed, for the
+             description of the channel.
+             @returns The compression method, followed by ':' and the identifier of the zstd
+             dictionary if one is used, or an empty string if messages are not compressed. */
+            YarpString
+            compressionDescription(void)
+            const;
+
+            /*! @brief Returns how large messages written to the channel are compressed.
+             @returns How large messages written to the channel are compressed. */
+            CompressionMethod
+            compressionMethod(void)
+            const;
+
+            /*! @brief Record a compressed message that arrived on the channel but could not be
+             restored.
+
+             The first such message is reported, as it usually means that the sender uses a
+             method or a dictionary that is not available here. */
+            void
+            countUndecodableMessage(void);
+
             /*! @brief Turn off the send / receive metrics collecting. */
             void
             disableMetrics(void);
@@ -135,16 +159,54 @@ namespace MplusM
             static void
             RelinquishChannel(BaseChannel * theChannel);
 
+            /*! @brief Set how large messages written to the channel are compressed.
+
+             This should be done before any messages are written to the channel.
+             @param[in] method How the messages are compressed; @c kCompressionMethodNone turns
+             off compression.
+             @param[in] threshold The smallest serialized size of a message that is compressed.
+             @param[in] dictionary The contents of a zstd dictionary, or an empty string if no
+             dictionary is to be used.
+             @returns @c true if the compression was set up and @c false otherwise. */
+            bool
+            setCompression(const CompressionMethod method,
+                           const size_t            threshold,
+                           const YarpString &      dictionary = "");
+
+            /*! @brief Returns the number of compressed messages that arrived on the channel but
+             could not be restored.
+             @returns The number of compressed messages that could not be restored. */
+            inline int64_t
+            undecodableMessages(void)
+            const
+            {
+                return _undecodableMessages;
+            } // undecodableMessages
+
             /*! @brief Update the receive counters for the channel.
              @param[in] numBytes The number of bytes received. */
             void
             updateReceiveCounters(const size_t numBytes);
 
+            /*! @brief Update the receive counters for a message that was compressed.
+             @param[in] numBytes The number of bytes received.
+             @param[in] uncompressedBytes The number of bytes after decompression. */
+            void
+            updateReceiveCounters(const size_t numBytes,
+                                  const size_t uncompressedBytes);
+
             /*! @brief Update the send counters for the channel.
              @param[in] numBytes The number of bytes sent. */
             void
             updateSendCounters(const size_t numBytes);
 
+            /*! @brief Update the send counters for a message that was compressed.
+             @param[in] numBytes The number of bytes sent.
+             @param[in] uncompressedBytes The number of bytes before compression. */
+            void
+            updateSendCounters(const size_t numBytes,
+                               const size_t uncompressedBytes);
+
             /*! @brief Write a message to the port.
              @param[in] message The message to write.
              @returns @c true if the message was successfully sent and @c false otherwise. */
@@ -161,6 +223,18 @@ namespace MplusM
 
         protected :
 
+            /*! @brief Write a message to the port, compressing it if it is large enough.
+             @param[in] message The message to write.
+             @param[out] messageSize The number of bytes written, if the metrics are enabled or
+             the message was compressed.
+             @param[out] uncompressedSize The number of bytes in the message before compression,
+             if the metrics are enabled or the message was compressed.
+             @returns @c true if the message was successfully sent and @c false otherwise. */
+            bool
+            writeWithCompression(yarp::os::Bottle & message,
+                                 size_t &           messageSize,
+                                 size_t &           uncompressedSize);
+
         private :
 
             /*! @brief The copy constructor.
@@ -185,6 +259,13 @@ namespace MplusM
             /*! @brief The send / receive counters. */
             SendReceiveCounters _counters;
 
+            /*! @brief The compressor for large messages, or @c NULL if messages are not
+             compressed. */
+            MessageCompressor * _compressor;
+
+            /*! @brief The number of compressed messages that could not be restored. */
+            int64_t _undecodableMessages;
+
             /*! @brief @c true if metrics are enabled and @c false otherwise. */
             bool _metricsEnabled;
 
@@ -39,7 +39,10 @@
 
 #include "m+mBaseClient.hpp"
 
+#include <m+m/m+mAsyncResponseHandler.hpp>
 #include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mDiscoveryCache.hpp>
+#include <m+m/m+mGeneralChannel.hpp>
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mServiceRequest.hpp>
 #include <m+m/m+mServiceResponse.hpp>
@@ -74,6 +77,9 @@ using namespace MplusM::Common;
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The cache of service lookups, if one has been set up. */
+static DiscoveryCache * lDiscoveryCache = NULL;
+
 #if defined(__APPLE__)
 # pragma mark Local functions
 #endif // defined(__APPLE__)
@@ -143,6 +149,97 @@ validateMatchResponse(const yarp::os::Bottle & response)
     return result;
 } // validateMatchResponse
 
+/*! @brief Ask the %Registry Service for the services that match the criteria.
+ @param[in] criteria The matching conditions.
+ @param[in] getNames @c true if service names are to be returned and @c false if service ports
+ are to be returned.
+ @param[in] checker A function that provides for early exit from loops.
+ @param[in] checkStuff The private data for the early exit function.
+ @returns A (possibly empty) list of matching service ports or service names. */
+static yarp::os::Bottle
+askRegistryForMatches(const YarpString & criteria,
+                      const bool         getNames,
+                      CheckFunction      checker,
+                      void *             checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("criteria = ", criteria); //####
+    ODL_B1("getNames = ", getNames); //####
+    ODL_P1("checkStuff = ", checkStuff); //####
+    yarp::os::Bottle result;
+
+    try
+    {
+        YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                   BUILD_NAME_("findmatch_",
+                                                               DEFAULT_CHANNEL_ROOT_)));
+        ClientChannel * newChannel = new ClientChannel;
+
+        if (newChannel)
+        {
+#if defined(MpM_ReportOnConnections)
+            newChannel->setReporter(*Utilities::GetGlobalStatusReporter());
+#endif // defined(MpM_ReportOnConnections)
+            if (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
+            {
+                if (Utilities::NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_,
+                                                         STANDARD_WAIT_TIME_, false, checker,
+                                                         checkStuff))
+                {
+                    yarp::os::Bottle parameters;
+
+                    parameters.addInt(getNames ? 1 : 0);
+                    parameters.addString(criteria);
+                    ServiceRequest  request(MpM_MATCH_REQUEST_, parameters);
+                    ServiceResponse response;
+
+                    if (request.send(*newChannel, response))
+                    {
+                        ODL_S1s("response <- ", response.asString()); //####
+                        result = validateMatchResponse(response.values());
+                    }
+                    else
+                    {
+                        ODL_LOG("! (request.send(*newChannel, response))"); //####
+                    }
+#if defined(MpM_DoExplicitDisconnect)
+                    if (! Utilities::NetworkDisconnectWithRetries(aName,
+                                                                  MpM_REGISTRY_ENDPOINT_NAME_,
+                                                                  STANDARD_WAIT_TIME_, checker,
+                                                                  checkStuff))
+                    {
+                        ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(aName, " //####
+                                "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, checker, " //####
+                                "checkStuff))"); //####
+                    }
+#endif // defined(MpM_DoExplicitDisconnect)
+                }
+                else
+                {
+                    ODL_LOG("! (Utilities::NetworkConnectWithRetries(aName, " //####
+                            "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, false, " //####
+                            "checker, checkStuff))"); //####
+                }
+#if defined(MpM_DoExplicitClose)
+                newChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+            }
+            else
+            {
+                ODL_LOG("! (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+            }
+            BaseChannel::RelinquishChannel(newChannel);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT(); //####
+    return result;
+} // askRegistryForMatches
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -152,8 +249,11 @@ validateMatchResponse(const yarp::os::Bottle & response)
 #endif // defined(__APPLE__)
 
 BaseClient::BaseClient(const YarpString & baseChannelName) :
-    _reporter(NULL), _channel(NULL), _baseChannelName(MpM_CLIENT_BASE_NAME_), _channelName(),
-    _serviceChannelName(), _clientOwnsChannel(true), _connected(false), _reportImmediately(false)
+    _asyncResponses(), _pendingAsyncRequests(), _extraInstances(), _outstandingCounts(),
+    _asyncLock(), _asyncResponseArrived(0), _asyncHandler(NULL), _asyncChannel(NULL),
+    _reporter(NULL), _channel(NULL), _asyncChannelName(), _baseChannelName(MpM_CLIENT_BASE_NAME_),
+    _channelName(), _serviceChannelName(), _nextInstance(0), _routing(kInstanceRoutingSticky),
+    _lastCorrelationId(0), _clientOwnsChannel(true), _connected(false), _reportImmediately(false)
 {
     ODL_ENTER(); //####
     ODL_S1s("baseChannelName = ", baseChannelName); //####
@@ -169,6 +269,8 @@ BaseClient::~BaseClient(void)
 {
     ODL_OBJENTER(); //####
     disconnectFromService();
+    releaseInstances();
+    releaseAsyncChannel();
     if (_clientOwnsChannel)
     {
         BaseChannel::RelinquishChannel(_channel);
@@ -181,6 +283,131 @@ BaseClient::~BaseClient(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+ClientChannel *
+BaseClient::channelForInstance(const size_t instance)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("instance = ", instance); //####
+    ClientChannel * result = _channel;
+
+    if ((0 < instance) && (instance <= _extraInstances.size()))
+    {
+        ServiceInstance & anInstance = _extraInstances[instance - 1];
+
+        if (anInstance._connected)
+        {
+            result = anInstance._channel;
+        }
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // BaseClient::channelForInstance
+
+bool
+BaseClient::completeAsyncRequest(const yarp::os::Bottle & input)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("input = ", input.toString()); //####
+    bool result = false;
+
+    try
+    {
+        if ((1 <= input.size()) && input.get(0).isInt())
+        {
+            int                                    correlationId = input.get(0).asInt();
+            PendingAsyncRequest                    pending;
+            PendingAsyncRequestMap::const_iterator match;
+            yarp::os::Bottle                       response(input.tail());
+
+            _asyncLock.lock();
+            match = _pendingAsyncRequests.find(correlationId);
+            if (_pendingAsyncRequests.end() != match)
+            {
+                pending = match->second;
+                result = true;
+            }
+            _asyncLock.unlock();
+            if (result)
+            {
+                // The response function is called before the request is removed, so that a
+                // request is only considered complete once its response has been dealt with.
+                if (pending._responder)
+                {
+                    pending._responder(correlationId, response, pending._responseStuff);
+                }
+                _asyncLock.lock();
+                _pendingAsyncRequests.erase(correlationId);
+                if ((pending._instance < _outstandingCounts.size()) &&
+                    (0 < _outstandingCounts[pending._instance]))
+                {
+                    --_outstandingCounts[pending._instance];
+                }
+                if (! pending._responder)
+                {
+                    _asyncResponses[correlationId] = response;
+                }
+                _asyncLock.unlock();
+                _asyncResponseArrived.post();
+            }
+            else
+            {
+                ODL_LOG("! (result)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((1 <= input.size()) && input.get(0).isInt())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseClient::completeAsyncRequest
+
+bool
+BaseClient::connectInstance(ServiceInstance & anInstance,
+                            CheckFunction     checker,
+                            void *            checkStuff)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("anInstance = ", &anInstance, "checkStuff = ", checkStuff); //####
+    try
+    {
+        if (! anInstance._channel)
+        {
+            anInstance._channelName = GetRandomChannelName(_baseChannelName);
+            anInstance._channel = new ClientChannel;
+            if (! anInstance._channel->openWithRetries(anInstance._channelName,
+                                                       STANDARD_WAIT_TIME_))
+            {
+                ODL_LOG("! (anInstance._channel->openWithRetries(anInstance._channelName, " //####
+                        "STANDARD_WAIT_TIME_))"); //####
+                BaseChannel::RelinquishChannel(anInstance._channel);
+                anInstance._channel = NULL;
+            }
+        }
+        if (anInstance._channel)
+        {
+            anInstance._connected =
+                        Utilities::NetworkConnectWithRetries(anInstance._channelName,
+                                                             anInstance._serviceChannelName,
+                                                             STANDARD_WAIT_TIME_, false, checker,
+                                                             checkStuff);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(anInstance._connected); //####
+    return anInstance._connected;
+} // BaseClient::connectInstance
+
 bool
 BaseClient::connectToService(CheckFunction checker,
                              void *        checkStuff)
@@ -213,6 +440,16 @@ BaseClient::connectToService(CheckFunction checker,
                                                              checkStuff))
                     {
                         _connected = true;
+                        // An additional instance that cannot be reached is left out of the
+                        // rotation, rather than failing the connection.
+                        for (size_t ii = 0, mm = _extraInstances.size(); mm > ii; ++ii)
+                        {
+                            if (! connectInstance(_extraInstances[ii], checker, checkStuff))
+                            {
+                                ODL_LOG("(! connectInstance(_extraInstances[ii], checker, " //####
+                                        "checkStuff))"); //####
+                            }
+                        }
                     }
                     else
                     {
@@ -242,6 +479,44 @@ BaseClient::connectToService(CheckFunction checker,
     return _connected;
 } // BaseClient::connectToService
 
+void
+BaseClient::disconnectInstance(ServiceInstance & anInstance,
+                               CheckFunction     checker,
+                               void *            checkStuff)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("anInstance = ", &anInstance, "checkStuff = ", checkStuff); //####
+    try
+    {
+        if (anInstance._connected && anInstance._channel)
+        {
+            yarp::os::Bottle parameters;
+            ServiceRequest   detachRequest(MpM_DETACH_REQUEST_, parameters);
+
+            if (! detachRequest.send(*anInstance._channel))
+            {
+                ODL_LOG("(! detachRequest.send(*anInstance._channel))"); //####
+            }
+            if (! Utilities::NetworkDisconnectWithRetries(anInstance._channelName,
+                                                          anInstance._serviceChannelName,
+                                                          STANDARD_WAIT_TIME_, checker,
+                                                          checkStuff))
+            {
+                ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(" //####
+                        "anInstance._channelName, anInstance._serviceChannelName, " //####
+                        "STANDARD_WAIT_TIME_, checker, checkStuff))"); //####
+            }
+        }
+        anInstance._connected = false;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // BaseClient::disconnectInstance
+
 bool
 BaseClient::disconnectFromService(CheckFunction checker,
                                   void *        checkStuff)
@@ -257,6 +532,10 @@ BaseClient::disconnectFromService(CheckFunction checker,
 #endif // defined(MpM_DoExplicitCheckForOK)
 
         reconnectIfDisconnected(checker, checkStuff);
+        for (size_t ii = 0, mm = _extraInstances.size(); mm > ii; ++ii)
+        {
+            disconnectInstance(_extraInstances[ii], checker, checkStuff);
+        }
 #if defined(MpM_DoExplicitCheckForOK)
         if (send(MpM_DETACH_REQUEST_, parameters, response))
         {
@@ -325,6 +604,7 @@ BaseClient::findService(const char *  criteria,
 
     try
     {
+        releaseInstances();
         yarp::os::Bottle candidates(FindMatchingServices(criteria, false, checker, checkStuff));
 
         ODL_S1s("candidates <- ", candidates.toString()); //####
@@ -347,6 +627,10 @@ BaseClient::findService(const char *  criteria,
                     {
                         _serviceChannelName = candidateList->get(0).toString();
                         ODL_S1s("_serviceChannelName <- ", _serviceChannelName);
+                        _routing = kInstanceRoutingSticky;
+                        _asyncLock.lock();
+                        _outstandingCounts.assign(1, 0);
+                        _asyncLock.unlock();
                         result = true;
                     }
                     else
@@ -383,6 +667,139 @@ BaseClient::findService(const char *  criteria,
     return result;
 } // BaseClient::findService
 
+bool
+BaseClient::findServiceInstances(const YarpString &          serviceName,
+                                 const InstanceRoutingPolicy policy,
+                                 const size_t                maxInstances,
+                                 CheckFunction               checker,
+                                 void *                      checkStuff)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("serviceName = ", serviceName); //####
+    ODL_LL2("policy = ", policy, "maxInstances = ", maxInstances); //####
+    ODL_P1("checkStuff = ", checkStuff); //####
+    bool result = false;
+
+    try
+    {
+        YarpStringVector channels;
+
+        releaseInstances();
+        if (Utilities::GetServiceInstances(serviceName, channels, STANDARD_WAIT_TIME_, checker,
+                                           checkStuff))
+        {
+            size_t count = channels.size();
+
+            if ((0 < maxInstances) && (maxInstances < count))
+            {
+                count = maxInstances;
+            }
+            if (0 < count)
+            {
+                if (kInstanceRoutingSticky == policy)
+                {
+                    // Spread the clients, rather than their requests, across the instances.
+                    size_t chosen = static_cast<size_t>(yarp::os::Random::uniform() * count);
+
+                    _serviceChannelName = channels[(chosen < count) ? chosen : 0];
+                }
+                else
+                {
+                    _serviceChannelName = channels[0];
+                    for (size_t ii = 1; count > ii; ++ii)
+                    {
+                        ServiceInstance anInstance;
+
+                        anInstance._channel = NULL;
+                        anInstance._serviceChannelName = channels[ii];
+                        anInstance._connected = false;
+                        _extraInstances.push_back(anInstance);
+                    }
+                }
+                ODL_S1s("_serviceChannelName <- ", _serviceChannelName); //####
+                _routing = policy;
+                _nextInstance = 0;
+                _asyncLock.lock();
+                _outstandingCounts.assign(1 + _extraInstances.size(), 0);
+                _asyncLock.unlock();
+                result = true;
+            }
+            else
+            {
+                ODL_LOG("! (0 < count)"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (Utilities::GetServiceInstances(serviceName, channels, " //####
+                    "STANDARD_WAIT_TIME_, checker, checkStuff))"); //####
+        }
+        if (! result)
+        {
+            _serviceChannelName = "";
+            ODL_S1s("_serviceChannelName <- ", _serviceChannelName); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseClient::findServiceInstances
+
+bool
+BaseClient::openAsyncChannel(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = (NULL != _asyncChannel);
+
+    try
+    {
+        if (! result)
+        {
+            _asyncChannelName = GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                     BUILD_NAME_("response_",
+                                                                 DEFAULT_CHANNEL_ROOT_));
+            _asyncChannel = new GeneralChannel(false);
+            _asyncHandler = new AsyncResponseHandler(*this);
+            if (_asyncChannel->openWithRetries(_asyncChannelName, STANDARD_WAIT_TIME_))
+            {
+                _asyncHandler->setChannel(_asyncChannel);
+                _asyncChannel->setReader(*_asyncHandler);
+                result = true;
+            }
+            else
+            {
+                ODL_LOG("! (_asyncChannel->openWithRetries(_asyncChannelName, " //####
+                        "STANDARD_WAIT_TIME_))"); //####
+                releaseAsyncChannel();
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseClient::openAsyncChannel
+
+size_t
+BaseClient::outstandingRequests(void)
+{
+    ODL_OBJENTER(); //####
+    size_t result;
+
+    _asyncLock.lock();
+    result = _pendingAsyncRequests.size();
+    _asyncLock.unlock();
+    ODL_OBJEXIT_LL(result); //####
+    return result;
+} // BaseClient::outstandingRequests
+
 void
 BaseClient::reconnectIfDisconnected(CheckFunction checker,
                                     void *        checkStuff)
@@ -403,9 +820,114 @@ BaseClient::reconnectIfDisconnected(CheckFunction checker,
     {
         ODL_LOG("(! connectToService(checker, checkStuff))"); //####
     }
+    for (size_t ii = 0, mm = _extraInstances.size(); mm > ii; ++ii)
+    {
+        ServiceInstance & anInstance = _extraInstances[ii];
+
+        // Only instances that are still in the rotation are reconnected.
+        if (anInstance._connected && (0 >= anInstance._channel->getOutputCount()))
+        {
+            if (! connectInstance(anInstance, checker, checkStuff))
+            {
+                ODL_LOG("(! connectInstance(anInstance, checker, checkStuff))"); //####
+            }
+        }
+    }
     ODL_OBJEXIT(); //####
 } // BaseClient::reconnectIfDisconnected
 
+void
+BaseClient::releaseAsyncChannel(void)
+{
+    ODL_OBJENTER(); //####
+    if (_asyncChannel)
+    {
+#if defined(MpM_DoExplicitClose)
+        _asyncChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+        BaseChannel::RelinquishChannel(_asyncChannel);
+        _asyncChannel = NULL;
+    }
+    delete _asyncHandler;
+    _asyncHandler = NULL;
+    ODL_OBJEXIT(); //####
+} // BaseClient::releaseAsyncChannel
+
+void
+BaseClient::releaseInstances(void)
+{
+    ODL_OBJENTER(); //####
+    for (size_t ii = 0, mm = _extraInstances.size(); mm > ii; ++ii)
+    {
+        ServiceInstance & anInstance = _extraInstances[ii];
+
+        disconnectInstance(anInstance, NULL, NULL);
+        if (anInstance._channel)
+        {
+#if defined(MpM_DoExplicitClose)
+            anInstance._channel->close();
+#endif // defined(MpM_DoExplicitClose)
+            BaseChannel::RelinquishChannel(anInstance._channel);
+            anInstance._channel = NULL;
+        }
+    }
+    _extraInstances.clear();
+    _nextInstance = 0;
+    ODL_OBJEXIT(); //####
+} // BaseClient::releaseInstances
+
+size_t
+BaseClient::selectInstance(void)
+{
+    ODL_OBJENTER(); //####
+    size_t result = 0;
+    size_t count = 1 + _extraInstances.size();
+
+    if (1 < count)
+    {
+        size_t fewest = 0;
+        bool   found = false;
+
+        if (kInstanceRoutingLeastOutstanding == _routing)
+        {
+            _asyncLock.lock();
+        }
+        // Starting with the instance after the previous choice spreads ties evenly.
+        for (size_t ii = 0; count > ii; ++ii)
+        {
+            size_t candidate = ((_nextInstance + ii) % count);
+
+            if ((0 == candidate) || _extraInstances[candidate - 1]._connected)
+            {
+                if (kInstanceRoutingLeastOutstanding == _routing)
+                {
+                    size_t outstanding = ((candidate < _outstandingCounts.size()) ?
+                                          _outstandingCounts[candidate] : 0);
+
+                    if ((! found) || (outstanding < fewest))
+                    {
+                        result = candidate;
+                        fewest = outstanding;
+                        found = true;
+                    }
+                }
+                else if (! found)
+                {
+                    result = candidate;
+                    found = true;
+                }
+            }
+        }
+        if (kInstanceRoutingLeastOutstanding == _routing)
+        {
+            _asyncLock.unlock();
+        }
+        _nextInstance = ((result + 1) % count);
+    }
+    ODL_OBJEXIT_LL(result); //####
+    return result;
+} // BaseClient::selectInstance
+
 bool
 BaseClient::send(const char *             request,
                  const yarp::os::Bottle & parameters)
@@ -422,7 +944,7 @@ BaseClient::send(const char *             request,
             {
                 ServiceRequest actualRequest(request, parameters);
 
-                result = actualRequest.send(*_channel);
+                result = actualRequest.send(*channelForInstance(selectInstance()));
             }
             else
             {
@@ -461,7 +983,7 @@ BaseClient::send(const char *             request,
             {
                 ServiceRequest actualRequest(request, parameters);
 
-                result = actualRequest.send(*_channel, response);
+                result = actualRequest.send(*channelForInstance(selectInstance()), response);
             }
             else
             {
@@ -482,6 +1004,84 @@ BaseClient::send(const char *             request,
     return result;
 } // BaseClient::send
 
+bool
+BaseClient::sendAsync(const char *             request,
+                      const yarp::os::Bottle & parameters,
+                      ResponseFunction         responder,
+                      void *                   responseStuff,
+                      int *                    correlationId)
+{
+    ODL_OBJENTER(); //####
+    ODL_S2("request = ", request, "parameters = ", parameters.toString().c_str()); //####
+    ODL_P2("responseStuff = ", responseStuff, "correlationId = ", correlationId); //####
+    bool result = false;
+
+    try
+    {
+        if (_connected)
+        {
+            if ((0 < _serviceChannelName.length()) && openAsyncChannel())
+            {
+                int                 newId;
+                PendingAsyncRequest pending;
+                yarp::os::Bottle    envelope;
+
+                pending._responder = responder;
+                pending._responseStuff = responseStuff;
+                pending._instance = selectInstance();
+                // The request is recorded before it is sent, as the response could arrive before
+                // the send completes.
+                _asyncLock.lock();
+                newId = ++_lastCorrelationId;
+                _pendingAsyncRequests[newId] = pending;
+                if (_outstandingCounts.size() <= pending._instance)
+                {
+                    _outstandingCounts.resize(pending._instance + 1, 0);
+                }
+                ++_outstandingCounts[pending._instance];
+                _asyncLock.unlock();
+                envelope.addString(_asyncChannelName);
+                envelope.addInt(newId);
+                envelope.addString(request);
+                envelope.append(parameters);
+                ServiceRequest actualRequest(MpM_ASYNC_REQUEST_, envelope);
+
+                result = actualRequest.send(*channelForInstance(pending._instance));
+                if (result)
+                {
+                    if (correlationId)
+                    {
+                        *correlationId = newId;
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (result)"); //####
+                    _asyncLock.lock();
+                    _pendingAsyncRequests.erase(newId);
+                    --_outstandingCounts[pending._instance];
+                    _asyncLock.unlock();
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((0 < _serviceChannelName.length()) && openAsyncChannel())"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_connected)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseClient::sendAsync
+
 void
 BaseClient::setChannel(ClientChannel * newChannel)
 {
@@ -521,6 +1121,120 @@ BaseClient::setReporter(ChannelStatusReporter & reporter,
     ODL_OBJEXIT(); //####
 } // BaseClient::setReporter
 
+bool
+BaseClient::waitForAsyncRequests(const size_t limit,
+                                 const double timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("limit = ", limit); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool   result = false;
+    double deadline = yarp::os::Time::now() + timeToWait;
+
+    try
+    {
+        for (bool keepWaiting = true; keepWaiting; )
+        {
+            _asyncLock.lock();
+            result = (limit >= _pendingAsyncRequests.size());
+            _asyncLock.unlock();
+            if (result)
+            {
+                keepWaiting = false;
+            }
+            else if (0 > timeToWait)
+            {
+                _asyncResponseArrived.wait();
+            }
+            else
+            {
+                double remaining = deadline - yarp::os::Time::now();
+
+                if (0 < remaining)
+                {
+                    _asyncResponseArrived.waitWithTimeout(remaining);
+                }
+                else
+                {
+                    keepWaiting = false;
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseClient::waitForAsyncRequests
+
+bool
+BaseClient::waitForAsyncResponse(const int         correlationId,
+                                 ServiceResponse & response,
+                                 const double      timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("correlationId = ", correlationId); //####
+    ODL_P1("response = ", &response); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool   result = false;
+    double deadline = yarp::os::Time::now() + timeToWait;
+
+    try
+    {
+        for (bool keepWaiting = true; keepWaiting; )
+        {
+            AsyncResponseMap::iterator match;
+
+            _asyncLock.lock();
+            match = _asyncResponses.find(correlationId);
+            if (_asyncResponses.end() == match)
+            {
+                // Stop if the request is not known.
+                keepWaiting = (_pendingAsyncRequests.end() !=
+                               _pendingAsyncRequests.find(correlationId));
+            }
+            else
+            {
+                response = match->second;
+                _asyncResponses.erase(match);
+                result = true;
+                keepWaiting = false;
+            }
+            _asyncLock.unlock();
+            if (keepWaiting)
+            {
+                if (0 > timeToWait)
+                {
+                    _asyncResponseArrived.wait();
+                }
+                else
+                {
+                    double remaining = deadline - yarp::os::Time::now();
+
+                    if (0 < remaining)
+                    {
+                        _asyncResponseArrived.waitWithTimeout(remaining);
+                    }
+                    else
+                    {
+                        keepWaiting = false;
+                    }
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseClient::waitForAsyncResponse
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -539,65 +1253,19 @@ Common::FindMatchingServices(const YarpString & criteria,
 
     try
     {
-        YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
-                                                   BUILD_NAME_("findmatch_",
-                                                               DEFAULT_CHANNEL_ROOT_)));
-        ClientChannel * newChannel = new ClientChannel;
+        int generation;
 
-        if (newChannel)
+        if (lDiscoveryCache && lDiscoveryCache->lookUp(criteria, getNames, result, generation))
         {
-#if defined(MpM_ReportOnConnections)
-            newChannel->setReporter(*Utilities::GetGlobalStatusReporter());
-#endif // defined(MpM_ReportOnConnections)
-            if (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
-            {
-                if (Utilities::NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_,
-                                                         STANDARD_WAIT_TIME_, false, checker,
-                                                         checkStuff))
-                {
-                    yarp::os::Bottle parameters;
-
-                    parameters.addInt(getNames ? 1 : 0);
-                    parameters.addString(criteria);
-                    ServiceRequest  request(MpM_MATCH_REQUEST_, parameters);
-                    ServiceResponse response;
-
-                    if (request.send(*newChannel, response))
-                    {
-                        ODL_S1s("response <- ", response.asString()); //####
-                        result = validateMatchResponse(response.values());
-                    }
-                    else
-                    {
-                        ODL_LOG("! (request.send(*newChannel, response))"); //####
-                    }
-#if defined(MpM_DoExplicitDisconnect)
-                    if (! Utilities::NetworkDisconnectWithRetries(aName,
-                                                                  MpM_REGISTRY_ENDPOINT_NAME_,
-                                                                  STANDARD_WAIT_TIME_, checker,
-                                                                  checkStuff))
-                    {
-                        ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(aName, " //####
-                                "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, checker, " //####
-                                "checkStuff))"); //####
-                    }
-#endif // defined(MpM_DoExplicitDisconnect)
-                }
-                else
-                {
-                    ODL_LOG("! (Utilities::NetworkConnectWithRetries(aName, " //####
-                            "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, false, " //####
-                            "checker, checkStuff))"); //####
-                }
-#if defined(MpM_DoExplicitClose)
-                newChannel->close();
-#endif // defined(MpM_DoExplicitClose)
-            }
-            else
+            ODL_S1s("result <- ", result.toString()); //####
+        }
+        else
+        {
+            result = askRegistryForMatches(criteria, getNames, checker, checkStuff);
+            if (lDiscoveryCache)
             {
-                ODL_LOG("! (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+                lDiscoveryCache->remember(criteria, getNames, result, generation);
             }
-            BaseChannel::RelinquishChannel(newChannel);
         }
     }
     catch (...)
@@ -608,3 +1276,37 @@ Common::FindMatchingServices(const YarpString & criteria,
     ODL_EXIT(); //####
     return result;
 } // Common::FindMatchingServices
+
+bool
+Common::SetUpDiscoveryCache(CheckFunction checker,
+                            void *        checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_P1("checkStuff = ", checkStuff); //####
+    bool result;
+
+    try
+    {
+        if (! lDiscoveryCache)
+        {
+            lDiscoveryCache = new DiscoveryCache;
+        }
+        result = lDiscoveryCache->subscribe(checker, checkStuff);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // Common::SetUpDiscoveryCache
+
+void
+Common::ShutDownDiscoveryCache(void)
+{
+    ODL_ENTER(); //####
+    delete lDiscoveryCache;
+    lDiscoveryCache = NULL;
+    ODL_EXIT(); //####
+} // Common::ShutDownDiscoveryCache
@@ -56,8 +56,10 @@ namespace MplusM
 {
     namespace Common
     {
+        class AsyncResponseHandler;
         class ChannelStatusReporter;
         class ClientChannel;
+        class GeneralChannel;
         class ServiceResponse;
 
         /*! @brief The minimal functionality required for an m+m client. */
@@ -69,6 +71,52 @@ namespace MplusM
 
         private :
 
+            /*! @brief The information kept for an asynchronous request that has not been
+             answered. */
+            struct PendingAsyncRequest
+            {
+                /*! @brief The function to be called with the response, or @c NULL if the response
+                 is to be held until it is retrieved. */
+                ResponseFunction _responder;
+
+                /*! @brief The private data for the response function. */
+                void * _responseStuff;
+
+                /*! @brief The instance of the service that the request was sent to. */
+                size_t _instance;
+
+            }; // PendingAsyncRequest
+
+            /*! @brief The information kept for an additional instance of the service. */
+            struct ServiceInstance
+            {
+                /*! @brief The channel used to send requests to the instance. */
+                ClientChannel * _channel;
+
+                /*! @brief The name of the channel used to send requests to the instance. */
+                YarpString _channelName;
+
+                /*! @brief The name of the service channel of the instance. */
+                YarpString _serviceChannelName;
+
+                /*! @brief @c true if the channel is connected to the instance and @c false
+                 otherwise. */
+                bool _connected;
+
+            }; // ServiceInstance
+
+            /*! @brief The responses that are being held until they are retrieved. */
+            typedef std::map<int, yarp::os::Bottle> AsyncResponseMap;
+
+            /*! @brief The asynchronous requests that have not been answered. */
+            typedef std::map<int, PendingAsyncRequest> PendingAsyncRequestMap;
+
+            /*! @brief The additional instances of the service. */
+            typedef std::vector<ServiceInstance> ServiceInstanceVector;
+
+            /*! @brief The number of unanswered asynchronous requests for each instance. */
+            typedef std::vector<size_t> OutstandingCountVector;
+
         public :
 
             /*! @brief The constructor.
@@ -80,6 +128,13 @@ namespace MplusM
             virtual
             ~BaseClient(void);
 
+            /*! @brief Complete an asynchronous request.
+             @param[in] input The identifier of the request, followed by its response.
+             @returns @c true if the response matched an outstanding request and @c false
+             otherwise. */
+            bool
+            completeAsyncRequest(const yarp::os::Bottle & input);
+
             /*! @brief Create a connection with the service.
              @param[in] checker A function that provides for early exit from loops.
              @param[in] checkStuff The private data for the early exit function.
@@ -111,6 +166,41 @@ namespace MplusM
                         CheckFunction checker = NULL,
                         void *        checkStuff = NULL);
 
+            /*! @brief Find the instances of a service and prepare to spread requests across them.
+
+             The %Registry Service groups the services that share a canonical name, such as
+             several copies of a service started with different tags. A client that relies on a
+             context kept by the service must use the sticky policy, which sends every request to
+             one instance, chosen at random so that the clients as a whole are spread across the
+             instances.
+             @param[in] serviceName The canonical name of the service.
+             @param[in] policy How requests are to be spread across the instances.
+             @param[in] maxInstances The largest number of instances to use, or zero to use all of
+             them.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function.
+             @returns @c true if at least one instance was found and @c false otherwise. */
+            bool
+            findServiceInstances(const YarpString &          serviceName,
+                                 const InstanceRoutingPolicy policy = kInstanceRoutingRoundRobin,
+                                 const size_t                maxInstances = 0,
+                                 CheckFunction               checker = NULL,
+                                 void *                      checkStuff = NULL);
+
+            /*! @brief Return the number of service instances that requests are spread across.
+             @returns The number of service instances that requests are spread across. */
+            inline size_t
+            instanceCount(void)
+            const
+            {
+                return ((0 < _serviceChannelName.length()) ? (1 + _extraInstances.size()) : 0);
+            } // instanceCount
+
+            /*! @brief Return the number of asynchronous requests that have not been answered.
+             @returns The number of asynchronous requests that have not been answered. */
+            size_t
+            outstandingRequests(void);
+
             /*! @brief Set the channel for the client to use.
              @param[in] newChannel The channel to be used. */
             void
@@ -124,6 +214,30 @@ namespace MplusM
             setReporter(ChannelStatusReporter & reporter,
                         const bool              andReportNow = false);
 
+            /*! @brief Wait until no more than a given number of asynchronous requests have not
+             been answered.
+             @param[in] limit The largest number of unanswered requests to accept.
+             @param[in] timeToWait The number of seconds to wait, or a negative value to wait
+             indefinitely.
+             @returns @c true if no more than the given number of requests are unanswered and
+             @c false if the time ran out. */
+            bool
+            waitForAsyncRequests(const size_t limit = 0,
+                                 const double timeToWait = -1);
+
+            /*! @brief Wait for the response to an asynchronous request that was sent without a
+             response function.
+             @param[in] correlationId The identifier of the request.
+             @param[out] response The response to the request.
+             @param[in] timeToWait The number of seconds to wait, or a negative value to wait
+             indefinitely.
+             @returns @c true if the response arrived and @c false if the request is not known or
+             the time ran out. */
+            bool
+            waitForAsyncResponse(const int         correlationId,
+                                 ServiceResponse & response,
+                                 const double      timeToWait = -1);
+
         protected :
 
             /*! @brief Re-establish the service connection if it has dropped.
@@ -153,30 +267,124 @@ namespace MplusM
                  const yarp::os::Bottle & parameters,
                  ServiceResponse &        response);
 
+            /*! @brief Send a request to the service associated with the client, without waiting
+             for the response.
+
+             The service processes asynchronous requests concurrently, so responses can arrive in
+             a different order than the requests were sent. If a response function is provided, it
+             is called when the response arrives; otherwise, the response is held until it is
+             retrieved with waitForAsyncResponse().
+             @param[in] request The name of the request.
+             @param[in] parameters The required parameters for the request.
+             @param[in] responder The function to be called with the response.
+             @param[in] responseStuff The private data for the response function.
+             @param[out] correlationId If non-@c NULL, the identifier of the request.
+             @returns @c true if the request was sent and @c false otherwise. */
+            bool
+            sendAsync(const char *             request,
+                      const yarp::os::Bottle & parameters,
+                      ResponseFunction         responder = NULL,
+                      void *                   responseStuff = NULL,
+                      int *                    correlationId = NULL);
+
         private :
 
             /*! @brief The copy constructor.
              @param[in] other The object to be copied. */
             BaseClient(const BaseClient & other);
 
+            /*! @brief Return the channel to be used for an instance of the service.
+             @param[in] instance The instance of interest, where zero is the primary instance.
+             @returns The channel to be used for the instance. */
+            ClientChannel *
+            channelForInstance(const size_t instance);
+
+            /*! @brief Connect an additional instance of the service.
+             @param[in,out] anInstance The instance to be connected.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function.
+             @returns @c true if the instance is connected and @c false otherwise. */
+            bool
+            connectInstance(ServiceInstance & anInstance,
+                            CheckFunction     checker,
+                            void *            checkStuff);
+
+            /*! @brief Detach from and disconnect an additional instance of the service.
+             @param[in,out] anInstance The instance to be disconnected.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function. */
+            void
+            disconnectInstance(ServiceInstance & anInstance,
+                               CheckFunction     checker,
+                               void *            checkStuff);
+
+            /*! @brief Open the channel used to receive responses to asynchronous requests, if it
+             is not already open.
+             @returns @c true if the channel is open and @c false otherwise. */
+            bool
+            openAsyncChannel(void);
+
             /*! @brief The assignment operator.
              @param[in] other The object to be copied.
              @returns The updated object. */
             BaseClient &
             operator =(const BaseClient & other);
 
+            /*! @brief Release the channel used to receive responses to asynchronous requests. */
+            void
+            releaseAsyncChannel(void);
+
+            /*! @brief Disconnect and release the additional instances of the service. */
+            void
+            releaseInstances(void);
+
+            /*! @brief Choose the instance of the service for the next request.
+             @returns The instance to be used, where zero is the primary instance. */
+            size_t
+            selectInstance(void);
+
         public :
 
         protected :
 
         private :
 
+            /*! @brief The responses that are being held until they are retrieved. */
+            AsyncResponseMap _asyncResponses;
+
+            /*! @brief The asynchronous requests that have not been answered. */
+            PendingAsyncRequestMap _pendingAsyncRequests;
+
+            /*! @brief The additional instances of the service, after the primary instance. */
+            ServiceInstanceVector _extraInstances;
+
+            /*! @brief The number of unanswered asynchronous requests for each instance, starting
+             with the primary instance. */
+            OutstandingCountVector _outstandingCounts;
+
+            /*! @brief The contention lock used to control access to the asynchronous request
+             information. */
+            yarp::os::Mutex _asyncLock;
+
+            /*! @brief The signal that a response to an asynchronous request has arrived. */
+            yarp::os::Semaphore _asyncResponseArrived;
+
+            /*! @brief The handler for responses to asynchronous requests. */
+            AsyncResponseHandler * _asyncHandler;
+
+            /*! @brief The channel used to receive responses to asynchronous requests. */
+            GeneralChannel * _asyncChannel;
+
             /*! @brief The channel status reporter that has been set for this channel. */
             ChannelStatusReporter * _reporter;
 
             /*! @brief The channel that the client uses for communication. */
             ClientChannel * _channel;
 
+            /*! @brief The name of the channel used to receive responses to asynchronous
+             requests. */
+            YarpString _asyncChannelName;
+
             /*! @brief The root name for the client channel. */
             YarpString _baseChannelName;
 
@@ -186,6 +394,15 @@ namespace MplusM
             /*! @brief The name of the service channel being used. */
             YarpString _serviceChannelName;
 
+            /*! @brief The instance to be considered first for the next request. */
+            size_t _nextInstance;
+
+            /*! @brief How requests are spread across the instances of the service. */
+            InstanceRoutingPolicy _routing;
+
+            /*! @brief The identifier of the most recent asynchronous request. */
+            int _lastCorrelationId;
+
             /*! @brief @c true if the client owns the channel and @c false otherwise. */
             bool _clientOwnsChannel;
 
@@ -222,6 +439,23 @@ namespace MplusM
                              CheckFunction      checker = NULL,
                              void *             checkStuff = NULL);
 
+        /*! @brief Set up a cache of service lookups for the process, so that repeated lookups
+         can be answered without asking the %Registry Service.
+
+         The cache is kept up to date from the status channel of the %Registry Service; a lookup
+         that is not in the cache, or that is made after a status message has been missed, is
+         passed on to the %Registry Service.
+         @param[in] checker A function that provides for early exit from loops.
+         @param[in] checkStuff The private data for the early exit function.
+         @returns @c true if the cache is receiving status messages and @c false otherwise. */
+        bool
+        SetUpDiscoveryCache(CheckFunction checker = NULL,
+                            void *        checkStuff = NULL);
+
+        /*! @brief Release the cache of service lookups for the process. */
+        void
+        ShutDownDiscoveryCache(void);
+
     } // Common
 
 } // MplusM
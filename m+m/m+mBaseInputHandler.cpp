@@ -39,6 +39,8 @@
 #include "m+mBaseInputHandler.hpp"
 
 #include <m+m/m+mBaseChannel.hpp>
+#include <m+m/m+mMessageBatchThread.hpp>
+#include <m+m/m+mMessageCompressor.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -99,6 +101,36 @@ BaseInputHandler::~BaseInputHandler(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+bool
+BaseInputHandler::deliverInput(const yarp::os::Bottle & input,
+                               const YarpString &       senderChannel)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("input = ", &input); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    bool result = true;
+
+    try
+    {
+        if (_canProcessInput)
+        {
+            // The message was never serialized, so only the message count is meaningful.
+            if (_metricsEnabled && _channel && _channel->metricsAreEnabled())
+            {
+                _channel->updateReceiveCounters(0);
+            }
+            result = handleInput(input, senderChannel, NULL, 0);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputHandler::deliverInput
+
 void
 BaseInputHandler::disableMetrics(void)
 {
@@ -131,15 +163,63 @@ BaseInputHandler::read(yarp::os::ConnectionReader & connection)
 #endif // defined(MpM_ReportContactDetails)
             yarp::os::Bottle aBottle;
             size_t           numBytes = connection.getSize();
+            size_t           uncompressedSize = numBytes;
+            bool             wasRead = aBottle.read(connection);
 
+            if (wasRead && MessageCompressor::IsCompressed(aBottle))
+            {
+                yarp::os::Bottle restored;
+
+                wasRead = MessageCompressor::Decompress(aBottle, restored, uncompressedSize);
+                if (wasRead)
+                {
+                    aBottle = restored;
+                }
+                else
+                {
+                    ODL_LOG("! (MessageCompressor::Decompress(aBottle, restored, " //####
+                            "uncompressedSize))"); //####
+                    uncompressedSize = numBytes;
+                    if (_channel)
+                    {
+                        _channel->countUndecodableMessage();
+                    }
+                }
+            }
             if (_metricsEnabled && _channel && _channel->metricsAreEnabled())
             {
-                _channel->updateReceiveCounters(numBytes);
+                _channel->updateReceiveCounters(numBytes, uncompressedSize);
             }
-            if (aBottle.read(connection))
+            if (wasRead)
             {
-                result = handleInput(aBottle, connection.getRemoteContact().getName(),
-                                     connection.getWriter(), numBytes);
+                if (MessageBatchThread::IsBatch(aBottle))
+                {
+                    // A batch is written without expecting a reply, and its size is shared among
+                    // the messages in it.
+                    int        count = aBottle.size() - 1;
+                    YarpString senderChannel(connection.getRemoteContact().getName());
+
+                    for (int ii = 1; count >= ii; ++ii)
+                    {
+                        yarp::os::Bottle * aMessage = aBottle.get(ii).asList();
+
+                        if (_metricsEnabled && _channel && _channel->metricsAreEnabled() &&
+                            (1 < ii))
+                        {
+                            _channel->updateReceiveCounters(0);
+                        }
+                        if (aMessage)
+                        {
+                            result = (handleInput(*aMessage, senderChannel, NULL,
+                                                  uncompressedSize / count) && result);
+                        }
+                    }
+                }
+                else
+                {
+                    result = handleInput(aBottle, connection.getRemoteContact().getName(),
+                                         connection.getWriter(), uncompressedSize);
+                }
             }
         }
     }
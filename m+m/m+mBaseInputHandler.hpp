@@ -79,6 +79,15 @@ namespace MplusM
             virtual
             ~BaseInputHandler(void);
 
+            /*! @brief Process partially-structured input data that was passed from within the
+             same process, rather than read from a connection.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @returns @c true if the input was correctly structured and successfully processed. */
+            bool
+            deliverInput(const yarp::os::Bottle & input,
+                         const YarpString &       senderChannel);
+
             /*! @brief Turn off the send / receive metrics collecting. */
             void
             disableMetrics(void);
@@ -47,6 +47,7 @@
 
 #include <m+m/m+mChannelStatusReporter.hpp>
 #include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mConflatingInputHandler.hpp>
 #include <m+m/m+mEndpoint.hpp>
 #include <m+m/m+mGeneralChannel.hpp>
 #include <m+m/m+mUtilities.hpp>
@@ -550,6 +551,82 @@ BaseInputOutputService::addOutStreamsFromDescriptions(const ChannelVector & desc
     return result;
 } // BaseInputOutputService::addOutStreamsFromDescriptions
 
+bool
+BaseInputOutputService::attachInletHandler(const size_t       index,
+                                           BaseInputHandler & handler,
+                                           const bool         conflate)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("index = ", index); //####
+    ODL_P1("handler = ", &handler); //####
+    ODL_B1("conflate = ", conflate); //####
+    bool result = false;
+
+    try
+    {
+        GeneralChannel * aChannel = ((_inStreams.size() > index) ? _inStreams[index] : NULL);
+
+        if (aChannel)
+        {
+            ConflatingInputHandler * oldConflater = NULL;
+            ConflatingInputHandler * newConflater = NULL;
+
+            if (_inConflaters.size() <= index)
+            {
+                _inConflaters.resize(index + 1, NULL);
+            }
+            oldConflater = _inConflaters[index];
+            if (conflate)
+            {
+                // Restarting the streams reconnects the same handler, so keep its thread.
+                if (oldConflater && (&oldConflater->target() == &handler))
+                {
+                    newConflater = oldConflater;
+                    oldConflater = NULL;
+                }
+                else
+                {
+                    newConflater = new ConflatingInputHandler(handler);
+                }
+                if (metricsAreEnabled())
+                {
+                    newConflater->enableMetrics();
+                }
+                else
+                {
+                    newConflater->disableMetrics();
+                }
+                newConflater->setChannel(aChannel);
+            }
+            handler.setChannel(aChannel);
+            if (newConflater)
+            {
+                aChannel->setReader(*newConflater);
+            }
+            else
+            {
+                aChannel->setReader(handler);
+            }
+            _inConflaters[index] = newConflater;
+            // The channel may still be delivering a message to the old conflater, so it is only
+            // released once the channels have been closed.
+            if (oldConflater)
+            {
+                oldConflater->stopProcessing();
+                _retiredConflaters.push_back(oldConflater);
+            }
+            result = true;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputOutputService::attachInletHandler
+
 void
 BaseInputOutputService::attachRequestHandlers(void)
 {
@@ -702,6 +779,16 @@ BaseInputOutputService::disableMetrics(void)
             }
         }
     }
+    for (ConflatingInputHandlerVector::const_iterator walker(_inConflaters.begin());
+         _inConflaters.end() != walker; ++walker)
+    {
+        ConflatingInputHandler * aConflater = *walker;
+
+        if (aConflater)
+        {
+            aConflater->disableMetrics();
+        }
+    }
     if (0 < _outStreams.size())
     {
         for (GeneralChannelVector::const_iterator walker(_outStreams.begin());
@@ -749,6 +836,16 @@ BaseInputOutputService::enableMetrics(void)
             }
         }
     }
+    for (ConflatingInputHandlerVector::const_iterator walker(_inConflaters.begin());
+         _inConflaters.end() != walker; ++walker)
+    {
+        ConflatingInputHandler * aConflater = *walker;
+
+        if (aConflater)
+        {
+            aConflater->enableMetrics();
+        }
+    }
     if (0 < _outStreams.size())
     {
         for (GeneralChannelVector::const_iterator walker(_outStreams.begin());
@@ -816,6 +913,7 @@ BaseInputOutputService::fillInSecondaryInputChannelsList(ChannelVector & channel
                 descriptor._portProtocol = aChannel->protocol();
                 descriptor._portMode = kChannelModeTCP;
                 descriptor._protocolDescription = aChannel->protocolDescription();
+                descriptor._multicastGroup = aChannel->multicastGroup();
                 channels.push_back(descriptor);
             }
         }
@@ -845,6 +943,8 @@ BaseInputOutputService::fillInSecondaryOutputChannelsList(ChannelVector & channe
                 descriptor._portProtocol = aChannel->protocol();
                 descriptor._portMode = kChannelModeTCP;
                 descriptor._protocolDescription = aChannel->protocolDescription();
+                descriptor._multicastGroup = aChannel->multicastGroup();
+                descriptor._compression = aChannel->compressionDescription();
                 channels.push_back(descriptor);
             }
         }
@@ -878,8 +978,34 @@ BaseInputOutputService::gatherMetrics(yarp::os::Bottle & metrics)
 
         if (aChannel)
         {
+            MulticastCounters multicastCounters;
+
             aChannel->getSendReceiveCounters(counters);
             counters.addToList(metrics, aChannel->name());
+            if (0 < aChannel->undecodableMessages())
+            {
+                yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+                if (props)
+                {
+                    props->put(MpM_DECOMPRESS_FAILED_,
+                               static_cast<int>(aChannel->undecodableMessages()));
+                }
+            }
+            if (aChannel->getMulticastCounters(multicastCounters))
+            {
+                yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+                if (props)
+                {
+                    props->put(MpM_MULTICAST_LATE_, static_cast<int>(multicastCounters._late));
+                    props->put(MpM_MULTICAST_LOST_, static_cast<int>(multicastCounters._lost));
+                    props->put(MpM_MULTICAST_RECEIVED_,
+                               static_cast<int>(multicastCounters._received));
+                    props->put(MpM_MULTICAST_SUPERSEDED_,
+                               static_cast<int>(multicastCounters._superseded));
+                }
+            }
         }
     }
     for (GeneralChannelVector::const_iterator walker(_outStreams.begin());
@@ -889,8 +1015,61 @@ BaseInputOutputService::gatherMetrics(yarp::os::Bottle & metrics)
 
         if (aChannel)
         {
+            MessageBatchCounters batchCounters;
+            MulticastCounters    multicastCounters;
+            OutputQueueCounters  queueCounters;
+            PipelineLinkCounters linkCounters;
+
             aChannel->getSendReceiveCounters(counters);
             counters.addToList(metrics, aChannel->name());
+            if (aChannel->getBatchCounters(batchCounters))
+            {
+                yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+                if (props)
+                {
+                    props->put(MpM_BATCH_DIRECT_, static_cast<int>(batchCounters._direct));
+                    props->put(MpM_BATCH_FAILED_, static_cast<int>(batchCounters._failed));
+                    props->put(MpM_BATCH_FRAMES_, static_cast<int>(batchCounters._frames));
+                    props->put(MpM_BATCH_MESSAGES_, static_cast<int>(batchCounters._messages));
+                }
+            }
+            if (aChannel->getMulticastCounters(multicastCounters))
+            {
+                yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+                if (props)
+                {
+                    props->put(MpM_MULTICAST_FAILED_, static_cast<int>(multicastCounters._failed));
+                    props->put(MpM_MULTICAST_SENT_, static_cast<int>(multicastCounters._sent));
+                }
+            }
+            if (aChannel->getOutputQueueCounters(queueCounters))
+            {
+                yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+                if (props)
+                {
+                    props->put(MpM_OUTPUTQUEUE_DEPTH_, static_cast<int>(queueCounters._depth));
+                    props->put(MpM_OUTPUTQUEUE_DROPPED_,
+                               static_cast<int>(queueCounters._dropped));
+                    props->put(MpM_OUTPUTQUEUE_FAILED_, static_cast<int>(queueCounters._failed));
+                    props->put(MpM_OUTPUTQUEUE_MAXDEPTH_,
+                               static_cast<int>(queueCounters._maximumDepth));
+                }
+            }
+            if (aChannel->getPipelineLinkCounters(linkCounters))
+            {
+                yarp::os::Property * props = metrics.get(metrics.size() - 1).asDict();
+
+                if (props)
+                {
+                    props->put(MpM_PIPELINE_DELIVERED_, static_cast<int>(linkCounters._delivered));
+                    props->put(MpM_PIPELINE_DEPTH_, static_cast<int>(linkCounters._depth));
+                    props->put(MpM_PIPELINE_STALLS_, static_cast<int>(linkCounters._stalls));
+                    props->put(MpM_PIPELINE_UNHANDLED_, static_cast<int>(linkCounters._unhandled));
+                }
+            }
         }
     }
     ODL_OBJEXIT(); //####
@@ -977,6 +1156,49 @@ const
     return result;
 } // BaseInputOutputService::getOutletStream
 
+bool
+BaseInputOutputService::linkOutlet(const size_t             index,
+                                   BaseInputOutputService * destination,
+                                   const size_t             inletIndex,
+                                   const size_t             capacity,
+                                   const int                core)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("destination = ", destination); //####
+    ODL_LL4("index = ", index, "inletIndex = ", inletIndex, "capacity = ", capacity, //####
+            "core = ", core); //####
+    bool result = false;
+
+    try
+    {
+        GeneralChannel * aChannel = ((_outStreams.size() > index) ? _outStreams[index] : NULL);
+
+        if (aChannel)
+        {
+            if (destination)
+            {
+                GeneralChannel * inChannel = destination->getInletStream(inletIndex);
+
+                if (inChannel)
+                {
+                    result = aChannel->setPipelineLink(inChannel, capacity, core);
+                }
+            }
+            else
+            {
+                result = aChannel->setPipelineLink(NULL, 0, -1);
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputOutputService::linkOutlet
+
 void
 BaseInputOutputService::performLaunch(const YarpString & helpText,
                                       const bool         goWasSet,
@@ -1259,6 +1481,149 @@ BaseInputOutputService::runService(const YarpString & helpText,
     ODL_OBJEXIT(); //####
 } // BaseInputOutputService::runService
 
+bool
+BaseInputOutputService::setInletMulticast(const size_t       index,
+                                          const YarpString & address,
+                                          const int          port,
+                                          const bool         latestOnly)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("index = ", index, "port = ", port); //####
+    ODL_S1s("address = ", address); //####
+    ODL_B1("latestOnly = ", latestOnly); //####
+    bool result = false;
+
+    try
+    {
+        GeneralChannel * aChannel = ((_inStreams.size() > index) ? _inStreams[index] : NULL);
+
+        if (aChannel)
+        {
+            result = aChannel->setMulticastGroup(address, port, latestOnly);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputOutputService::setInletMulticast
+
+bool
+BaseInputOutputService::setOutletBatching(const size_t index,
+                                          const size_t maximumBytes,
+                                          const double maximumDelay)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("index = ", index, "maximumBytes = ", maximumBytes); //####
+    ODL_D1("maximumDelay = ", maximumDelay); //####
+    bool result = false;
+
+    try
+    {
+        GeneralChannel * aChannel = ((_outStreams.size() > index) ? _outStreams[index] : NULL);
+
+        if (aChannel)
+        {
+            result = aChannel->setBatching(maximumBytes, maximumDelay);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputOutputService::setOutletBatching
+
+bool
+BaseInputOutputService::setOutletCompression(const size_t            index,
+                                             const CompressionMethod method,
+                                             const size_t            threshold,
+                                             const YarpString &      dictionary)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("index = ", index, "threshold = ", threshold); //####
+    ODL_L1("method = ", static_cast<int>(method)); //####
+    ODL_S1s("dictionary = ", dictionary); //####
+    bool result = false;
+
+    try
+    {
+        GeneralChannel * aChannel = ((_outStreams.size() > index) ? _outStreams[index] : NULL);
+
+        if (aChannel)
+        {
+            result = aChannel->setCompression(method, threshold, dictionary);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputOutputService::setOutletCompression
+
+bool
+BaseInputOutputService::setOutletMulticast(const size_t       index,
+                                           const YarpString & address,
+                                           const int          port)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("index = ", index, "port = ", port); //####
+    ODL_S1s("address = ", address); //####
+    bool result = false;
+
+    try
+    {
+        GeneralChannel * aChannel = ((_outStreams.size() > index) ? _outStreams[index] : NULL);
+
+        if (aChannel)
+        {
+            result = aChannel->setMulticastGroup(address, port);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputOutputService::setOutletMulticast
+
+bool
+BaseInputOutputService::setOutletQueue(const size_t            index,
+                                       const size_t            capacity,
+                                       const OutputQueuePolicy policy)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL3("index = ", index, "capacity = ", capacity, "policy = ", policy); //####
+    bool result = false;
+
+    try
+    {
+        GeneralChannel * aChannel = ((_outStreams.size() > index) ? _outStreams[index] : NULL);
+
+        if (aChannel)
+        {
+            result = aChannel->setOutputQueue(capacity, policy);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputOutputService::setOutletQueue
+
 bool
 BaseInputOutputService::setUpClientStreams(void)
 {
@@ -1335,6 +1700,26 @@ BaseInputOutputService::shutDownInputStreams(void)
         }
         _inStreams.clear();
     }
+    // The channels have been closed, so the conflaters are no longer being fed.
+    for (ConflatingInputHandlerVector::const_iterator walker(_inConflaters.begin());
+         _inConflaters.end() != walker; ++walker)
+    {
+        ConflatingInputHandler * aConflater = *walker;
+
+        if (aConflater)
+        {
+            ODL_P1("aConflater = ", aConflater); //####
+            delete aConflater;
+        }
+    }
+    _inConflaters.clear();
+    for (ConflatingInputHandlerVector::const_iterator walker(_retiredConflaters.begin());
+         _retiredConflaters.end() != walker; ++walker)
+    {
+        ODL_P1("retired conflater = ", *walker); //####
+        delete *walker;
+    }
+    _retiredConflaters.clear();
     ODL_EXIT_B(result); //####
     return result;
 } // BaseInputOutputService::shutDownInputStreams
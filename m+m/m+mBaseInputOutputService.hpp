@@ -62,9 +62,11 @@ namespace MplusM
     namespace Common
     {
         class ArgumentDescriptionsRequestHandler;
+        class BaseInputHandler;
         class ClientChannel;
         class ConfigurationRequestHandler;
         class ConfigureRequestHandler;
+        class ConflatingInputHandler;
         class GeneralChannel;
         class RestartStreamsRequestHandler;
         class StartStreamsRequestHandler;
@@ -205,6 +207,28 @@ namespace MplusM
                 return _active;
             } // isActive
 
+            /*! @brief Pass the messages written to an output channel directly to the input handler
+             of an input channel of a service in the same process.
+
+             The messages are passed from a separate thread, through a lock-free queue, without
+             being serialized; they are still written to the output channel if anything outside
+             the process is connected to it. The link must be removed before either service shuts
+             down its streams.
+             @param[in] index The index of the output channel.
+             @param[in] destination The service that receives the messages, or @c NULL if the
+             link is to be removed.
+             @param[in] inletIndex The index of the input channel of the receiving service.
+             @param[in] capacity The maximum number of messages that can be waiting.
+             @param[in] core The processor core for the thread that calls the input handler, or a
+             negative number if the thread is not to be bound to a core.
+             @returns @c true if the link was set up or removed and @c false otherwise. */
+            bool
+            linkOutlet(const size_t             index,
+                       BaseInputOutputService * destination,
+                       const size_t             inletIndex = 0,
+                       const size_t             capacity = 1024,
+                       const int                core = -1);
+
             /*! @brief Start the service and set up its configuration.
              @param[in] helpText The help text to be displayed.
              @param[in] goWasSet @c true if the service is to be started immediately.
@@ -248,6 +272,9 @@ namespace MplusM
             /*! @brief A set of client channels. */
             typedef std::vector<ClientChannel *> ClientChannelVector;
 
+            /*! @brief A set of input handlers that only pass on the newest input. */
+            typedef std::vector<ConflatingInputHandler *> ConflatingInputHandlerVector;
+
             /*! @brief A set of general channels. */
             typedef std::vector<GeneralChannel *> GeneralChannelVector;
 
@@ -269,6 +296,21 @@ namespace MplusM
             bool
             addOutStreamsFromDescriptions(const ChannelVector & descriptions);
 
+            /*! @brief Connect an input handler to an input channel.
+
+             If conflation is requested, the input handler is called from a separate thread and
+             only sees the newest message that arrived on the channel since it last finished; the
+             YARP reader thread never waits for it, but no replies are possible.
+             @param[in] index The index of the input channel.
+             @param[in] handler The input handler to be connected.
+             @param[in] conflate @c true if only the newest message is to be passed on and
+             @c false if every message is to be passed on.
+             @returns @c true if the input handler was connected and @c false otherwise. */
+            bool
+            attachInletHandler(const size_t       index,
+                               BaseInputHandler & handler,
+                               const bool         conflate = false);
+
             /*! @brief Indicate that the streams are not processing data. */
             inline void
             clearActive(void)
@@ -298,6 +340,25 @@ namespace MplusM
                 _active = true;
             } // setActive
 
+            /*! @brief Pass the messages sent to a multicast group to the input handler of an input
+             channel.
+
+             The channel joins the group directly, so the producer serializes and sends each
+             message once no matter how many consumers there are. The group is usually taken from
+             the channel description of the producer.
+             @param[in] index The index of the input channel.
+             @param[in] address The IPv4 address of the multicast group, or an empty string if the
+             channel is to leave the group.
+             @param[in] port The UDP port of the multicast group.
+             @param[in] latestOnly @c true if a message is to be discarded when a newer one is
+             waiting and @c false if every message is to be passed on.
+             @returns @c true if the group was joined or left and @c false otherwise. */
+            bool
+            setInletMulticast(const size_t       index,
+                              const YarpString & address,
+                              const int          port,
+                              const bool         latestOnly);
+
             /*! @brief Indicate that the service needs frequent calls to doIdle. */
             inline void
             setNeedsIdle(void)
@@ -305,6 +366,65 @@ namespace MplusM
                 _needsIdle = true;
             } // setNeedsIdle
 
+            /*! @brief Gather the small messages for an output channel into batches.
+
+             A message is written at once if the channel has been idle for the batching delay,
+             so batching only adds latency when messages are being written faster than that.
+             @param[in] index The index of the output channel.
+             @param[in] maximumBytes The serialized size at which a batch is written, or zero if
+             the messages are to be written on their own.
+             @param[in] maximumDelay The longest time, in seconds, that a message can wait in a
+             batch.
+             @returns @c true if the batching mode was set and @c false otherwise. */
+            bool
+            setOutletBatching(const size_t index,
+                              const size_t maximumBytes,
+                              const double maximumDelay);
+
+            /*! @brief Compress the large messages for an output channel.
+
+             Compressed messages describe how they were compressed, so the receiving services only
+             need to have added the same zstd dictionary, if one is used.
+             @param[in] index The index of the output channel.
+             @param[in] method How the messages are compressed; @c kCompressionMethodNone turns
+             off compression.
+             @param[in] threshold The smallest serialized size of a message that is compressed.
+             @param[in] dictionary The contents of a zstd dictionary, or an empty string if no
+             dictionary is to be used.
+             @returns @c true if the compression was set up and @c false otherwise. */
+            bool
+            setOutletCompression(const size_t            index,
+                                 const CompressionMethod method,
+                                 const size_t            threshold,
+                                 const YarpString &      dictionary = "");
+
+            /*! @brief Send the messages for an output channel to a multicast group.
+
+             The group is reported in the channel description, so that consumers can join it.
+             @param[in] index The index of the output channel.
+             @param[in] address The IPv4 address of the multicast group, or an empty string if the
+             channel is to stop sending to a group.
+             @param[in] port The UDP port of the multicast group.
+             @returns @c true if the group was set up or removed and @c false otherwise. */
+            bool
+            setOutletMulticast(const size_t       index,
+                               const YarpString & address,
+                               const int          port);
+
+            /*! @brief Write the messages for an output channel through a bounded queue.
+
+             The messages are written to the channel from a separate thread, so that the thread
+             that produces them does not wait for a slow reader unless the policy is to block.
+             @param[in] index The index of the output channel.
+             @param[in] capacity The maximum number of messages that can be waiting, or zero if
+             the messages are to be written directly.
+             @param[in] policy What to do with a message when the queue is full.
+             @returns @c true if the output mode was set and @c false otherwise. */
+            bool
+            setOutletQueue(const size_t            index,
+                           const size_t            capacity,
+                           const OutputQueuePolicy policy);
+
             /*! @brief Set up the client streams.
              @returns @c true if the channels were set up and @c false otherwise. */
             virtual bool
@@ -388,9 +508,16 @@ namespace MplusM
             /*! @brief The set of input channels. */
             GeneralChannelVector _inStreams;
 
+            /*! @brief The input handlers that pass on the newest input, by input channel. */
+            ConflatingInputHandlerVector _inConflaters;
+
             /*! @brief The set of output channels. */
             GeneralChannelVector _outStreams;
 
+            /*! @brief The input handlers that were replaced while their channels were open. They
+             are kept until the channels are closed, as a channel may still be using one. */
+            ConflatingInputHandlerVector _retiredConflaters;
+
             /*! @brief The descriptions of the arguments to be filled in by a calling application.
              */
             Utilities::DescriptorVector _argumentList;
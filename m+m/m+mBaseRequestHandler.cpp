@@ -85,7 +85,8 @@ using namespace MplusM::Common;
 
 BaseRequestHandler::BaseRequestHandler(const YarpString & request,
                                        BaseService &      service) :
-    _owner(NULL), _name(request), _service(service)
+    _owner(NULL), _name(request), _service(service), _statistics(), _lastResponseSize(0),
+    _measureResponse(false)
 {
     ODL_ENTER(); //####
     ODL_S1s("request = ", request); //####
@@ -115,12 +116,13 @@ BaseRequestHandler::sendOKResponse(yarp::os::ConnectionWriter * replyMechanism)
 
         _response.clear();
         _response.addString(MpM_OK_RESPONSE_);
-        if (_service.metricsAreEnabled())
+        if (_service.metricsAreEnabled() || _measureResponse)
         {
             _response.toBinary(&messageSize);
         }
         if (_response.write(*replyMechanism))
         {
+            _lastResponseSize = messageSize;
             _service.updateResponseCounters(messageSize);
         }
         else
@@ -144,11 +146,12 @@ BaseRequestHandler::sendResponse(yarp::os::ConnectionWriter * replyMechanism)
         ODL_LOG("(replyMechanism)"); //####
         if (_response.write(*replyMechanism))
         {
-            if (_service.metricsAreEnabled())
+            if (_service.metricsAreEnabled() || _measureResponse)
             {
                 size_t messageSize = 0;
 
                 _response.toBinary(&messageSize);
+                _lastResponseSize = messageSize;
                 _service.updateResponseCounters(messageSize);
             }
         }
@@ -163,6 +166,36 @@ BaseRequestHandler::sendResponse(yarp::os::ConnectionWriter * replyMechanism)
     ODL_OBJEXIT(); //####
 } // BaseRequestHandler::sendResponse
 
+void
+BaseRequestHandler::sendResponse(yarp::os::Bottle &           response,
+                                 yarp::os::ConnectionWriter * replyMechanism)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("response = ", &response, "replyMechanism = ", replyMechanism); //####
+    if (replyMechanism)
+    {
+        ODL_LOG("(replyMechanism)"); //####
+        if (response.write(*replyMechanism))
+        {
+            if (_service.metricsAreEnabled())
+            {
+                size_t messageSize = 0;
+
+                response.toBinary(&messageSize);
+                _service.updateResponseCounters(messageSize);
+            }
+        }
+        else
+        {
+            ODL_LOG("(! response.write(*replyMechanism))"); //####
+#if defined(MpM_StallOnSendProblem)
+            Stall();
+#endif // defined(MpM_StallOnSendProblem)
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // BaseRequestHandler::sendResponse
+
 void
 BaseRequestHandler::setOwner(RequestMap & owner)
 {
@@ -40,7 +40,7 @@
 #if (! defined(MpMBaseRequestHandler_HPP_))
 # define MpMBaseRequestHandler_HPP_ /* Header guard */
 
-# include <m+m/m+mCommon.hpp>
+# include <m+m/m+mRequestStatistics.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -103,6 +103,24 @@ namespace MplusM
 # endif // MAC_OR_LINUX_
             } // fillInDescription
 
+            /*! @brief Return @c true if the handler keeps no per-request state in its members, so
+             that several requests can use it at once.
+             @returns @c true if the handler does not need to be claimed before use and @c false
+             otherwise. */
+            virtual inline bool
+            isReentrant(void)
+            const
+            {
+                return false;
+            } // isReentrant
+
+            /*! @brief Claim the handler, so that only one request at a time can use it. */
+            inline void
+            lock(void)
+            {
+                _lock.lock();
+            } // lock
+
             /*! @brief Return the name of the request.
              @returns The name of the request. */
             inline const YarpString &
@@ -112,6 +130,16 @@ namespace MplusM
                 return _name;
             } // name
 
+            /*! @brief Return the size of the most recent response, if it was measured.
+             @returns The size of the most recent response, in bytes, or zero if it was not
+             measured. */
+            inline size_t
+            lastResponseSize(void)
+            const
+            {
+                return _lastResponseSize;
+            } // lastResponseSize
+
             /*! @brief Process a request.
              @param[in] request The actual request name.
              @param[in] restOfInput The arguments to the operation.
@@ -133,11 +161,47 @@ namespace MplusM
             void
             sendResponse(yarp::os::ConnectionWriter * replyMechanism);
 
+            /*! @brief Send a response that was built by the caller, rather than in the handler.
+
+             The size of the response is not remembered, as a reentrant handler may be in use by
+             several requests at once.
+             @param[in] response The response to be sent.
+             @param[in] replyMechanism The destination for the response. */
+            void
+            sendResponse(yarp::os::Bottle &           response,
+                         yarp::os::ConnectionWriter * replyMechanism);
+
             /*! @brief Connect the handler to a map.
              @param[in] owner The map that contains this handler. */
             void
             setOwner(RequestMap & owner);
 
+            /*! @brief Set whether the size of the next response is to be measured, even if metrics
+             are not enabled.
+             @param[in] measure @c true if the size of the next response is to be measured and
+             @c false otherwise. */
+            inline void
+            setResponseMeasurement(const bool measure)
+            {
+                _measureResponse = measure;
+                _lastResponseSize = 0;
+            } // setResponseMeasurement
+
+            /*! @brief Return the timing statistics for the request.
+             @returns The timing statistics for the request. */
+            inline RequestStatistics &
+            statistics(void)
+            {
+                return _statistics;
+            } // statistics
+
+            /*! @brief Release the handler, so that another request can use it. */
+            inline void
+            unlock(void)
+            {
+                _lock.unlock();
+            } // unlock
+
         protected :
 
             /*! @brief The object to use to hold the request response. */
@@ -167,9 +231,32 @@ namespace MplusM
 
         private :
 
+            /*! @brief The contention lock used to serialize use of the handler. */
+            yarp::os::Mutex _lock;
+
             /*! @brief The name of the request. */
             YarpString _name;
 
+            /*! @brief The timing statistics for the request. */
+            RequestStatistics _statistics;
+
+            /*! @brief The size of the most recent response, if it was measured. */
+            size_t _lastResponseSize;
+
+            /*! @brief @c true if the size of the next response is to be measured and @c false
+             otherwise. */
+            bool _measureResponse;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
         }; // BaseRequestHandler
 
     } // Common
@@ -38,18 +38,23 @@
 
 #include "m+mBaseService.hpp"
 #include "m+mArgumentsRequestHandler.hpp"
+#include "m+mAsyncRequestHandler.hpp"
 #include "m+mChannelsRequestHandler.hpp"
 #include "m+mClientsRequestHandler.hpp"
 #include "m+mDetachRequestHandler.hpp"
 #include "m+mExtraInfoRequestHandler.hpp"
+#include "m+mHeartbeatThread.hpp"
 #include "m+mInfoRequestHandler.hpp"
 #include "m+mListRequestHandler.hpp"
 #include "m+mMetricsRequestHandler.hpp"
 #include "m+mMetricsStateRequestHandler.hpp"
 #include "m+mNameRequestHandler.hpp"
 #include "m+mPingThread.hpp"
+#include "m+mRequestStatsRequestHandler.hpp"
 #include "m+mSetMetricsStateRequestHandler.hpp"
 #include "m+mStopRequestHandler.hpp"
+#include "m+mTimestampRequestHandler.hpp"
+#include "m+mTracesRequestHandler.hpp"
 
 #include <m+m/m+mBaseContext.hpp>
 #include <m+m/m+mClientChannel.hpp>
@@ -104,14 +109,164 @@ static const bool kMeasurementsOn = true;
 static const bool kMeasurementsOn = false;
 #endif // ! defined(MpM_MetricsInitiallyOn)
 
+/*! @brief The number of threads that process asynchronous requests for a service. */
+static const size_t kAsyncRequestThreadCount = 4;
+
+/*! @brief The maximum number of asynchronous requests that can be waiting to be processed for a
+ service. */
+static const size_t kMaxPendingAsyncRequests = 256;
+
+/*! @brief The major version of the 'ping' request that first accepted a round-trip time. */
+static const long kRoundTripPingMajorVersion = 1;
+
+/*! @brief The minor version of the 'ping' request that first accepted a round-trip time. */
+static const long kRoundTripPingMinorVersion = 1;
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The IPv4 address that services send their heartbeats to, or an empty string if they do
+ not send heartbeats. */
+static YarpString lHeartbeatAddress;
+
+/*! @brief The UDP port that services send their heartbeats to. */
+static int lHeartbeatPort = 0;
+
 #if defined(__APPLE__)
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Create a channel to send the responses to asynchronous requests and connect it to a
+ client.
+ @param[in] replyChannelName The channel of the client that receives the responses.
+ @param[in] metricsEnabled @c true if the channel is to gather metrics and @c false otherwise.
+ @returns The new channel or @c NULL if it could not be connected. */
+static ClientChannel *
+createAsyncReplyChannel(const YarpString & replyChannelName,
+                        const bool         metricsEnabled)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("replyChannelName = ", replyChannelName); //####
+    ODL_B1("metricsEnabled = ", metricsEnabled); //####
+    YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                               BUILD_NAME_("reply_", DEFAULT_CHANNEL_ROOT_)));
+    ClientChannel * result = new ClientChannel;
+
+    if (metricsEnabled)
+    {
+        result->enableMetrics();
+    }
+    else
+    {
+        result->disableMetrics();
+    }
+    if (! (result->openWithRetries(aName, STANDARD_WAIT_TIME_) &&
+           result->addOutputWithRetries(replyChannelName, STANDARD_WAIT_TIME_)))
+    {
+        ODL_LOG("! (result->openWithRetries(aName, STANDARD_WAIT_TIME_) && " //####
+                "result->addOutputWithRetries(replyChannelName, STANDARD_WAIT_TIME_))"); //####
+#if defined(MpM_DoExplicitClose)
+        result->close();
+#endif // defined(MpM_DoExplicitClose)
+        BaseChannel::RelinquishChannel(result);
+        result = NULL;
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // createAsyncReplyChannel
+
+/*! @brief Ask the %Registry Service whether its 'ping' request accepts a round-trip time.
+
+ Older versions of the %Registry Service reject a 'ping' with more than one argument, so the
+ version of the request is checked before the round-trip time is sent.
+ @param[in] channel The channel that is connected to the %Registry Service.
+ @returns @c true if the 'ping' request accepts a round-trip time and @c false otherwise. */
+static bool
+registryTakesRoundTrips(ClientChannel & channel)
+{
+    ODL_ENTER(); //####
+    ODL_P1("channel = ", &channel); //####
+    bool             result = false;
+    yarp::os::Bottle parameters(MpM_PING_REQUEST_);
+    ServiceRequest   request(MpM_INFO_REQUEST_, parameters);
+    ServiceResponse  response;
+
+    if (request.send(channel, response))
+    {
+        for (int ii = 0, howMany = response.count(); ii < howMany; ++ii)
+        {
+            yarp::os::Property asDict;
+            yarp::os::Value    element(response.element(ii));
+
+            if (element.isDict())
+            {
+                yarp::os::Property * propDict = element.asDict();
+
+                if (propDict)
+                {
+                    asDict = *propDict;
+                }
+            }
+            else if (element.isList())
+            {
+                yarp::os::Bottle * asList = element.asList();
+
+                if (asList)
+                {
+                    ListIsReallyDictionary(*asList, asDict);
+                }
+            }
+            if (asDict.check(MpM_REQREP_DICT_VERSION_KEY_))
+            {
+                YarpString   version(asDict.find(MpM_REQREP_DICT_VERSION_KEY_).toString());
+                const char * startPtr = version.c_str();
+                char *       endPtr;
+                long         major = strtol(startPtr, &endPtr, 10);
+                long         minor = 0;
+
+                ODL_S1s("version = ", version); //####
+                if ((startPtr != endPtr) && ('.' == *endPtr))
+                {
+                    minor = strtol(endPtr + 1, NULL, 10);
+                }
+                result = ((kRoundTripPingMajorVersion < major) ||
+                          ((kRoundTripPingMajorVersion == major) &&
+                           (kRoundTripPingMinorVersion <= minor)));
+            }
+        }
+    }
+    else
+    {
+        ODL_LOG("! (request.send(channel, response))"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // registryTakesRoundTrips
+
+/*! @brief Release a channel that was used to send the responses to asynchronous requests.
+ @param[in] service The service that used the channel.
+ @param[in] channel The channel to be released. */
+static void
+releaseAsyncReplyChannel(BaseService &   service,
+                         ClientChannel * channel)
+{
+    ODL_ENTER(); //####
+    ODL_P2("service = ", &service, "channel = ", channel); //####
+    if (channel)
+    {
+        SendReceiveCounters newCounters;
+
+#if defined(MpM_DoExplicitClose)
+        channel->close();
+#endif // defined(MpM_DoExplicitClose)
+        channel->getSendReceiveCounters(newCounters);
+        service.incrementAuxiliaryCounters(newCounters);
+        BaseChannel::RelinquishChannel(channel);
+    }
+    ODL_EXIT(); //####
+} // releaseAsyncReplyChannel
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -131,14 +286,19 @@ BaseService::BaseService(const ServiceKind  theKind,
                          const YarpString & requestsDescription,
                          const YarpString & serviceEndpointName,
                          const YarpString & servicePortNumber) :
-    _launchPath(launchPath), _contextsLock(), _requestHandlers(*this), _contexts(),
-    _description(description), _requestsDescription(requestsDescription), _tag(tag),
-    _auxCounters(), _argumentsHandler(NULL), _channelsHandler(NULL), _clientsHandler(NULL),
+    _launchPath(launchPath), _contextsLock(), _asyncLock(), _asyncRepliesLock(),
+    _asyncRequestsAvailable(0), _asyncRequests(), _asyncReplyChannels(), _asyncThreads(),
+    _requestHandlers(*this), _contexts(), _description(description),
+    _requestsDescription(requestsDescription), _tag(tag), _auxCounters(), _tracer(),
+    _argumentsHandler(NULL), _asyncHandler(NULL), _channelsHandler(NULL), _clientsHandler(NULL),
     _detachHandler(NULL), _extraInfoHandler(NULL), _infoHandler(NULL), _listHandler(NULL),
     _metricsHandler(NULL), _metricsStateHandler(NULL), _nameHandler(NULL),
-    _setMetricsStateHandler(NULL), _stopHandler(NULL), _endpoint(NULL), _handler(NULL),
-    _handlerCreator(NULL), _pinger(NULL), _kind(theKind), _metricsEnabled(kMeasurementsOn),
-    _started(false), _useMultipleHandlers(useMultipleHandlers)
+    _requestStatsHandler(NULL), _setMetricsStateHandler(NULL), _stopHandler(NULL),
+    _timestampHandler(NULL), _tracesHandler(NULL), _endpoint(NULL), _handler(NULL),
+    _handlerCreator(NULL), _heartbeat(NULL), _pinger(NULL), _lastPingRoundTrip(-1),
+    _kind(theKind), _asyncStopping(false), _metricsEnabled(kMeasurementsOn),
+    _registryPingChecked(false), _registryTakesRoundTrips(false), _started(false),
+    _useMultipleHandlers(useMultipleHandlers)
 {
     ODL_ENTER(); //####
     ODL_LL2("theKind = ", theKind, "argc = ", argc); //####
@@ -186,14 +346,19 @@ BaseService::BaseService(const ServiceKind  theKind,
                          const YarpString & canonicalName,
                          const YarpString & description,
                          const YarpString & requestsDescription) :
-    _launchPath(launchPath), _contextsLock(), _requestHandlers(*this), _contexts(),
-    _description(description), _requestsDescription(requestsDescription),
-    _serviceName(canonicalName), _tag(), _auxCounters(), _argumentsHandler(NULL),
+    _launchPath(launchPath), _contextsLock(), _asyncLock(), _asyncRepliesLock(),
+    _asyncRequestsAvailable(0), _asyncRequests(), _asyncReplyChannels(), _asyncThreads(),
+    _requestHandlers(*this), _contexts(), _description(description),
+    _requestsDescription(requestsDescription), _serviceName(canonicalName), _tag(),
+    _auxCounters(), _tracer(), _argumentsHandler(NULL), _asyncHandler(NULL),
     _channelsHandler(NULL), _clientsHandler(NULL), _detachHandler(NULL), _infoHandler(NULL),
     _listHandler(NULL), _metricsHandler(NULL), _metricsStateHandler(NULL), _nameHandler(NULL),
-    _setMetricsStateHandler(NULL), _stopHandler(NULL), _endpoint(NULL), _handler(NULL),
-    _handlerCreator(NULL), _pinger(NULL), _kind(theKind), _metricsEnabled(kMeasurementsOn),
-    _started(false), _useMultipleHandlers(useMultipleHandlers)
+    _requestStatsHandler(NULL), _setMetricsStateHandler(NULL), _stopHandler(NULL),
+    _timestampHandler(NULL), _tracesHandler(NULL), _endpoint(NULL), _handler(NULL),
+    _handlerCreator(NULL), _heartbeat(NULL), _pinger(NULL),
+    _lastPingRoundTrip(-1), _kind(theKind), _asyncStopping(false),
+    _metricsEnabled(kMeasurementsOn), _registryPingChecked(false),
+    _registryTakesRoundTrips(false), _started(false), _useMultipleHandlers(useMultipleHandlers)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -257,6 +422,59 @@ BaseService::~BaseService(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+bool
+BaseService::addAsyncRequest(const AsyncRequest & item)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("item = ", &item); //####
+    bool result = false;
+
+    try
+    {
+        _asyncLock.lock();
+        if ((! _asyncStopping) && _asyncThreads.empty())
+        {
+            for (size_t ii = 0; kAsyncRequestThreadCount > ii; ++ii)
+            {
+                AsyncRequestThread * aThread = new AsyncRequestThread(*this);
+
+                if (aThread->start())
+                {
+                    _asyncThreads.push_back(aThread);
+                }
+                else
+                {
+                    ODL_LOG("! (aThread->start())"); //####
+                    delete aThread;
+                }
+            }
+        }
+        // A client that sends requests faster than they can be processed is turned away rather
+        // than being allowed to use up the memory of the service.
+        if ((! _asyncStopping) && (! _asyncThreads.empty()) &&
+            (kMaxPendingAsyncRequests > _asyncRequests.size()))
+        {
+            _asyncRequests.push_back(item);
+            _asyncLock.unlock();
+            _asyncRequestsAvailable.post();
+            result = true;
+        }
+        else
+        {
+            ODL_LOG("! ((! _asyncStopping) && (! _asyncThreads.empty()) && " //####
+                    "(kMaxPendingAsyncRequests > _asyncRequests.size()))"); //####
+            _asyncLock.unlock();
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseService::addAsyncRequest
+
 void
 BaseService::addContext(const YarpString & key,
                         BaseContext *      context)
@@ -288,6 +506,7 @@ BaseService::attachRequestHandlers(void)
     try
     {
         _argumentsHandler = new ArgumentsRequestHandler(*this);
+        _asyncHandler = new AsyncRequestHandler(*this);
         _channelsHandler = new ChannelsRequestHandler(*this);
         _clientsHandler = new ClientsRequestHandler(*this);
         _detachHandler = new DetachRequestHandler(*this);
@@ -297,13 +516,18 @@ BaseService::attachRequestHandlers(void)
         _metricsHandler = new MetricsRequestHandler(*this);
         _metricsStateHandler = new MetricsStateRequestHandler(*this);
         _nameHandler = new NameRequestHandler(*this);
+        _requestStatsHandler = new RequestStatsRequestHandler(*this);
         _setMetricsStateHandler = new SetMetricsStateRequestHandler(*this);
         _stopHandler = new StopRequestHandler(*this);
-        if (_argumentsHandler && _channelsHandler && _clientsHandler && _detachHandler &&
-            _extraInfoHandler && _infoHandler && _listHandler && _metricsHandler &&
-            _metricsStateHandler && _nameHandler && _setMetricsStateHandler && _stopHandler)
+        _timestampHandler = new TimestampRequestHandler(*this);
+        _tracesHandler = new TracesRequestHandler(*this);
+        if (_argumentsHandler && _asyncHandler && _channelsHandler && _clientsHandler &&
+            _detachHandler && _extraInfoHandler && _infoHandler && _listHandler &&
+            _metricsHandler && _metricsStateHandler && _nameHandler && _requestStatsHandler &&
+            _setMetricsStateHandler && _stopHandler && _timestampHandler && _tracesHandler)
         {
             _requestHandlers.registerRequestHandler(_argumentsHandler);
+            _requestHandlers.registerRequestHandler(_asyncHandler);
             _requestHandlers.registerRequestHandler(_channelsHandler);
             _requestHandlers.registerRequestHandler(_clientsHandler);
             _requestHandlers.registerRequestHandler(_detachHandler);
@@ -313,15 +537,20 @@ BaseService::attachRequestHandlers(void)
             _requestHandlers.registerRequestHandler(_metricsHandler);
             _requestHandlers.registerRequestHandler(_metricsStateHandler);
             _requestHandlers.registerRequestHandler(_nameHandler);
+            _requestHandlers.registerRequestHandler(_requestStatsHandler);
             _requestHandlers.registerRequestHandler(_setMetricsStateHandler);
             _requestHandlers.registerRequestHandler(_stopHandler);
+            _requestHandlers.registerRequestHandler(_timestampHandler);
+            _requestHandlers.registerRequestHandler(_tracesHandler);
         }
         else
         {
-            ODL_LOG("! (_argumentsHandler && _channelsHandler && _clientsHandler && " //####
-                    "_detachHandler && _extraInfoHandler && _infoHandler && _listHandler && " //####
-                    "_metricsHandler && _metricsStateHandler && _nameHandler && " //####
-                    "_setMetricsStateHandler && _stopHandler)"); //####
+            ODL_LOG("! (_argumentsHandler && _asyncHandler && _channelsHandler && " //####
+                    "_clientsHandler && _detachHandler && _extraInfoHandler && " //####
+                    "_infoHandler && _listHandler && _metricsHandler && " //####
+                    "_metricsStateHandler && _nameHandler && _requestStatsHandler && " //####
+                    "_setMetricsStateHandler && _stopHandler && _timestampHandler && " //####
+                    "_tracesHandler)"); //####
         }
     }
     catch (...)
@@ -362,7 +591,19 @@ BaseService::detachClient(const YarpString & key)
     ODL_S1s("key = ", key); //####
     try
     {
+        ClientChannel * replyChannel = NULL;
+
         removeContext(key);
+        _asyncRepliesLock.lock();
+        AsyncReplyChannelMap::iterator match(_asyncReplyChannels.find(key));
+
+        if (_asyncReplyChannels.end() != match)
+        {
+            replyChannel = match->second.second;
+            _asyncReplyChannels.erase(match);
+        }
+        _asyncRepliesLock.unlock();
+        releaseAsyncReplyChannel(*this, replyChannel);
     }
     catch (...)
     {
@@ -384,6 +625,12 @@ BaseService::detachRequestHandlers(void)
             delete _argumentsHandler;
             _argumentsHandler = NULL;
         }
+        if (_asyncHandler)
+        {
+            _requestHandlers.unregisterRequestHandler(_asyncHandler);
+            delete _asyncHandler;
+            _asyncHandler = NULL;
+        }
         if (_channelsHandler)
         {
             _requestHandlers.unregisterRequestHandler(_channelsHandler);
@@ -438,6 +685,12 @@ BaseService::detachRequestHandlers(void)
             delete _nameHandler;
             _nameHandler = NULL;
         }
+        if (_requestStatsHandler)
+        {
+            _requestHandlers.unregisterRequestHandler(_requestStatsHandler);
+            delete _requestStatsHandler;
+            _requestStatsHandler = NULL;
+        }
         if (_setMetricsStateHandler)
         {
             _requestHandlers.unregisterRequestHandler(_setMetricsStateHandler);
@@ -450,6 +703,18 @@ BaseService::detachRequestHandlers(void)
             delete _stopHandler;
             _stopHandler = NULL;
         }
+        if (_timestampHandler)
+        {
+            _requestHandlers.unregisterRequestHandler(_timestampHandler);
+            delete _timestampHandler;
+            _timestampHandler = NULL;
+        }
+        if (_tracesHandler)
+        {
+            _requestHandlers.unregisterRequestHandler(_tracesHandler);
+            delete _tracesHandler;
+            _tracesHandler = NULL;
+        }
     }
     catch (...)
     {
@@ -528,6 +793,33 @@ BaseService::fillInSecondaryOutputChannelsList(ChannelVector & channels)
     ODL_OBJEXIT(); //####
 } // BaseService::fillInSecondaryOutputChannelsList
 
+ClientChannel *
+BaseService::findAsyncReplyChannel(const AsyncRequest & item,
+                                   ClientChannel * &    staleChannel)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("item = ", &item, "staleChannel = ", &staleChannel); //####
+    ClientChannel *                result = NULL;
+    AsyncReplyChannelMap::iterator match(_asyncReplyChannels.find(item._senderChannel));
+
+    staleChannel = NULL;
+    if (_asyncReplyChannels.end() != match)
+    {
+        if (match->second.first == item._replyChannel)
+        {
+            result = match->second.second;
+        }
+        else
+        {
+            // The client is using a different channel for its responses.
+            staleChannel = match->second.second;
+            _asyncReplyChannels.erase(match);
+        }
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // BaseService::findAsyncReplyChannel
+
 BaseContext *
 BaseService::findContext(const YarpString & key)
 {
@@ -580,6 +872,48 @@ BaseService::incrementAuxiliaryCounters(const SendReceiveCounters & additionalCo
     ODL_OBJEXIT(); //####
 } // BaseService::incrementAuxiliaryCounters
 
+bool
+BaseService::processNextAsyncRequest(void)
+{
+    ODL_OBJENTER(); //####
+    bool         gotOne = false;
+    bool         result;
+    AsyncRequest item;
+
+    try
+    {
+        _asyncRequestsAvailable.wait();
+        _asyncLock.lock();
+        result = (! _asyncStopping);
+        if (result && (! _asyncRequests.empty()))
+        {
+            item = _asyncRequests.front();
+            _asyncRequests.pop_front();
+            gotOne = true;
+        }
+        _asyncLock.unlock();
+        if (gotOne)
+        {
+            yarp::os::DummyConnector connector;
+            yarp::os::Bottle         response;
+
+            // The request is processed as if it had been sent directly, with the response
+            // captured so that it can be sent on with the identifier of the request.
+            processRequest(item._request, item._parameters, item._senderChannel,
+                           &connector.getWriter());
+            response.read(connector.getReader());
+            sendAsyncResponse(item, response);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseService::processNextAsyncRequest
+
 bool
 BaseService::processRequest(const YarpString &           request,
                             const yarp::os::Bottle &     restOfInput,
@@ -599,7 +933,52 @@ BaseService::processRequest(const YarpString &           request,
         if (handler)
         {
             ODL_LOG("(handler)"); //####
-            result = handler->processRequest(request, restOfInput, senderChannel, replyMechanism);
+            bool   measure = _metricsEnabled;
+            bool   reentrant = handler->isReentrant();
+            bool   sample = _tracer.shouldSample();
+            double startTime;
+
+            // Most handlers build their response in a member variable, so only one request at a
+            // time can use them, even when requests arrive on several connections or are being
+            // processed asynchronously. Reentrant handlers build their response per call, and
+            // don't remember its size.
+            if (! reentrant)
+            {
+                handler->lock();
+                handler->setResponseMeasurement(sample);
+            }
+            startTime = ((measure || sample) ? yarp::os::Time::now() : 0);
+            try
+            {
+                result = handler->processRequest(request, restOfInput, senderChannel,
+                                                 replyMechanism);
+            }
+            catch (...)
+            {
+                if (! reentrant)
+                {
+                    handler->unlock();
+                }
+                throw;
+            }
+            if (measure || sample)
+            {
+                double elapsed = yarp::os::Time::now() - startTime;
+
+                if (measure)
+                {
+                    handler->statistics().record(elapsed);
+                }
+                if (sample)
+                {
+                    _tracer.record(request, senderChannel, startTime, elapsed,
+                                   (reentrant ? 0 : handler->lastResponseSize()));
+                }
+            }
+            if (! reentrant)
+            {
+                handler->unlock();
+            }
         }
         else
         {
@@ -669,6 +1048,62 @@ BaseService::removeContext(const YarpString & key)
     ODL_OBJEXIT(); //####
 } // BaseService::removeContext
 
+void
+BaseService::sendAsyncResponse(const AsyncRequest &     item,
+                               const yarp::os::Bottle & response)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("item = ", &item, "response = ", &response); //####
+    try
+    {
+        ClientChannel *  newChannel = NULL;
+        ClientChannel *  replyChannel = NULL;
+        ClientChannel *  staleChannel = NULL;
+        yarp::os::Bottle message;
+
+        message.addInt(item._correlationId);
+        message.append(response);
+        _asyncRepliesLock.lock();
+        replyChannel = findAsyncReplyChannel(item, staleChannel);
+        if (! replyChannel)
+        {
+            // Connecting to the client can take a while, so the lock is not held for it.
+            _asyncRepliesLock.unlock();
+            releaseAsyncReplyChannel(*this, staleChannel);
+            newChannel = createAsyncReplyChannel(item._replyChannel, _metricsEnabled);
+            _asyncRepliesLock.lock();
+            // Another thread may have connected to the client in the meantime, in which case its
+            // channel is used and the new one is discarded.
+            replyChannel = findAsyncReplyChannel(item, staleChannel);
+            if (newChannel && (! replyChannel))
+            {
+                _asyncReplyChannels[item._senderChannel] = AsyncReplyChannel(item._replyChannel,
+                                                                             newChannel);
+                replyChannel = newChannel;
+                newChannel = NULL;
+            }
+        }
+        // The lock is held for the write so that the channel can't be released while it is in use
+        // and so that responses to the same client don't interleave.
+        if (replyChannel && (! replyChannel->writeBottle(message)))
+        {
+            ODL_LOG("(replyChannel && (! replyChannel->writeBottle(message)))"); //####
+#if defined(MpM_StallOnSendProblem)
+            Stall();
+#endif // defined(MpM_StallOnSendProblem)
+        }
+        _asyncRepliesLock.unlock();
+        releaseAsyncReplyChannel(*this, staleChannel);
+        releaseAsyncReplyChannel(*this, newChannel);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // BaseService::sendAsyncResponse
+
 bool
 BaseService::sendPingForChannel(const YarpString & channelName,
                                 CheckFunction      checker,
@@ -710,11 +1145,28 @@ BaseService::sendPingForChannel(const YarpString & channelName,
                                                          checkStuff))
                 {
                     yarp::os::Bottle parameters(channelName);
-                    ServiceRequest   request(MpM_PING_REQUEST_, parameters);
-                    ServiceResponse  response;
+
+                    // Report the round-trip time of the previous 'ping', so that the Registry
+                    // Service can record it, but only if the Registry Service understands it.
+                    if (0 <= _lastPingRoundTrip)
+                    {
+                        if (! _registryPingChecked)
+                        {
+                            _registryTakesRoundTrips = registryTakesRoundTrips(*newChannel);
+                            _registryPingChecked = true;
+                        }
+                        if (_registryTakesRoundTrips)
+                        {
+                            parameters.addDouble(_lastPingRoundTrip);
+                        }
+                    }
+                    ServiceRequest  request(MpM_PING_REQUEST_, parameters);
+                    ServiceResponse response;
+                    double          sendTime = yarp::os::Time::now();
 
                     if (request.send(*newChannel, response))
                     {
+                        _lastPingRoundTrip = yarp::os::Time::now() - sendTime;
                         // Check that we got a successful ping!
                         if (MpM_EXPECTED_PING_RESPONSE_SIZE_ == response.count())
                         {
@@ -740,6 +1192,12 @@ BaseService::sendPingForChannel(const YarpString & channelName,
                     {
                         ODL_LOG("! (request.send(*newChannel, response))"); //####
                     }
+                    if (! result)
+                    {
+                        // The Registry Service might have been replaced, so check its version
+                        // again before the next round-trip time is sent.
+                        _registryPingChecked = false;
+                    }
 #if defined(MpM_DoExplicitDisconnect)
                     if (! Utilities::NetworkDisconnectWithRetries(aName,
                                                                   MpM_REGISTRY_ENDPOINT_NAME_,
@@ -859,6 +1317,18 @@ BaseService::startService(void)
                 }
             }
         }
+        if (_started && (! _heartbeat) && (0 < lHeartbeatAddress.length()))
+        {
+            // The heartbeat reports the change in the counters, so they need to be kept.
+            enableMetrics();
+            _heartbeat = new HeartbeatThread(*this, lHeartbeatAddress, lHeartbeatPort);
+            if (! _heartbeat->start())
+            {
+                ODL_LOG("(! _heartbeat->start())"); //####
+                delete _heartbeat;
+                _heartbeat = NULL;
+            }
+        }
     }
     catch (...)
     {
@@ -886,10 +1356,53 @@ BaseService::startPinger(void)
     ODL_OBJEXIT(); //####
 } // BaseService::startPinger
 
+void
+BaseService::stopAsyncProcessing(void)
+{
+    ODL_OBJENTER(); //####
+    AsyncReplyChannelMap     replyChannels;
+    AsyncRequestThreadVector threads;
+
+    _asyncLock.lock();
+    _asyncStopping = true;
+    threads.swap(_asyncThreads);
+    _asyncRequests.clear();
+    _asyncLock.unlock();
+    // Each thread leaves as soon as it is woken, so one signal per thread is enough.
+    for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+    {
+        _asyncRequestsAvailable.post();
+    }
+    for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+    {
+        threads[ii]->stop();
+        delete threads[ii];
+    }
+    _asyncRepliesLock.lock();
+    replyChannels.swap(_asyncReplyChannels);
+    _asyncRepliesLock.unlock();
+    for (AsyncReplyChannelMap::iterator walker(replyChannels.begin());
+         replyChannels.end() != walker; ++walker)
+    {
+        releaseAsyncReplyChannel(*this, walker->second.second);
+    }
+    _asyncLock.lock();
+    _asyncStopping = false;
+    _asyncLock.unlock();
+    ODL_OBJEXIT(); //####
+} // BaseService::stopAsyncProcessing
+
 bool
 BaseService::stopService(void)
 {
     ODL_OBJENTER(); //####
+    if (_heartbeat)
+    {
+        ODL_LOG("(_heartbeat)"); //####
+        _heartbeat->stop();
+        delete _heartbeat;
+        _heartbeat = NULL;
+    }
     if (_pinger)
     {
         ODL_LOG("(_pinger)"); //####
@@ -897,6 +1410,7 @@ BaseService::stopService(void)
         delete _pinger;
         _pinger = NULL;
     }
+    stopAsyncProcessing();
     _started = false;
     ODL_OBJEXIT_B(! _started); //####
     return (! _started);
@@ -1138,6 +1652,7 @@ Common::ProcessStandardServiceOptions(const int                     argc,
         kOptionCHANNEL,
         kOptionENDPOINT,
         kOptionGO,
+        kOptionHEARTBEAT,
         kOptionHELP,
         kOptionINFO,
         kOptionMOD,
@@ -1180,6 +1695,10 @@ Common::ProcessStandardServiceOptions(const int                     argc,
                                               "used"));
     Option_::Descriptor goDescriptor(kOptionGO, 0, GO_OPTION_STRING_, "go", Option_::Arg::None,
                                      goPartText.c_str());
+    Option_::Descriptor heartbeatDescriptor(kOptionHEARTBEAT, 0, HEARTBEAT_OPTION_STRING_,
+                                            "heartbeat", Option_::Arg::Required,
+                                            T_("  --heartbeat, -" HEARTBEAT_OPTION_STRING_
+                                               "   Send heartbeats to the given address:port"));
     Option_::Descriptor helpDescriptor(kOptionHELP, 0, HELP_OPTION_STRING_, "help",
                                        Option_::Arg::None,
                                        T_("  --help, -" HELP_OPTION_STRING_
@@ -1235,8 +1754,8 @@ Common::ProcessStandardServiceOptions(const int                     argc,
         }
     }
     usageString += "\n\nOptions:";
-    // firstDescriptor, helpDescriptor, versionDescriptor, lastDescriptor
-    size_t descriptorCount = 4;
+    // firstDescriptor, heartbeatDescriptor, helpDescriptor, versionDescriptor, lastDescriptor
+    size_t descriptorCount = 5;
 
     if (! (skipOptions & kSkipArgsOption))
     {
@@ -1299,6 +1818,7 @@ Common::ProcessStandardServiceOptions(const int                     argc,
     {
         memcpy(usageWalker++, &goDescriptor, sizeof(goDescriptor));
     }
+    memcpy(usageWalker++, &heartbeatDescriptor, sizeof(heartbeatDescriptor));
     memcpy(usageWalker++, &helpDescriptor, sizeof(helpDescriptor));
     if (! (skipOptions & kSkipInfoOption))
     {
@@ -1374,7 +1894,7 @@ Common::ProcessStandardServiceOptions(const int                     argc,
         ODL_LOG("(options[kOptionINFO])"); //####
         bool needTab = true;
 
-        // Note that we don't report the 'h' and 'v' options, as they are not involved in
+        // Note that we don't report the 'b', 'h' and 'v' options, as they are not involved in
         // determining what choices to offer when launching a service.
         cout << (isAdapter ? "Adapter" : "Service");
         if (! (skipOptions & kSkipArgsOption))
@@ -1476,6 +1996,15 @@ Common::ProcessStandardServiceOptions(const int                     argc,
         {
             reportEndpoint = true;
         }
+        if (options[kOptionHEARTBEAT])
+        {
+            if (! SetHeartbeatDestination(options[kOptionHEARTBEAT].arg))
+            {
+                ODL_LOG("(! SetHeartbeatDestination(options[kOptionHEARTBEAT].arg))"); //####
+                cout << "Bad heartbeat destination." << endl;
+                keepGoing = false;
+            }
+        }
         if (options[kOptionMOD])
         {
             YarpString modArg = options[kOptionMOD].arg;
@@ -1688,6 +2217,51 @@ Common::RegisterLocalService(const YarpString & channelName,
     return result;
 } // Common::RegisterLocalService
 
+bool
+Common::SetHeartbeatDestination(const YarpString & destination)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("destination = ", destination); //####
+    bool okSoFar = false;
+
+    if (0 < destination.length())
+    {
+        size_t colonPos = destination.find(":");
+
+        if (YarpString::npos != colonPos)
+        {
+            YarpString     addressPart(destination.substr(0, colonPos));
+            YarpString     portPart(destination.substr(colonPos + 1));
+            const char *   startPtr = portPart.c_str();
+            char *         endPtr;
+            int            aPort = static_cast<int>(strtol(startPtr, &endPtr, 10));
+            struct in_addr rawAddress;
+
+            if ((startPtr != endPtr) && (! *endPtr) && Utilities::ValidPortNumber(aPort))
+            {
+#if MAC_OR_LINUX_
+                okSoFar = (0 < inet_pton(AF_INET, addressPart.c_str(), &rawAddress));
+#else // ! MAC_OR_LINUX_
+                okSoFar = (0 < InetPton(AF_INET, addressPart.c_str(), &rawAddress));
+#endif // ! MAC_OR_LINUX_
+            }
+            if (okSoFar)
+            {
+                lHeartbeatAddress = addressPart;
+                lHeartbeatPort = aPort;
+            }
+        }
+    }
+    else
+    {
+        lHeartbeatAddress = "";
+        lHeartbeatPort = 0;
+        okSoFar = true;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // Common::SetHeartbeatDestination
+
 bool
 Common::UnregisterLocalService(const YarpString & channelName,
                                BaseService &      service,
@@ -39,8 +39,10 @@
 #if (! defined(MpMBaseService_HPP_))
 # define MpMBaseService_HPP_ /* Header guard */
 
+# include <m+m/m+mAsyncRequestThread.hpp>
 # include <m+m/m+mBaseArgumentDescriptor.hpp>
 # include <m+m/m+mRequestMap.hpp>
+# include <m+m/m+mRequestTracer.hpp>
 # include <m+m/m+mSendReceiveCounters.hpp>
 
 # if defined(__APPLE__)
@@ -57,6 +59,9 @@
 /*! @brief The option character for the 'args' option. */
 # define ARGS_OPTION_STRING_ "a"
 
+/*! @brief The option character for the 'heartbeat' option. */
+# define HEARTBEAT_OPTION_STRING_ "b"
+
 /*! @brief The option character for the 'channel' option. */
 # define CHANNEL_OPTION_STRING_ "c"
 
@@ -87,7 +92,8 @@
 /*! @brief The option character for the 'version' option. */
 # define VERSION_OPTION_STRING_ "v"
 
-/*! @brief The full set of options, except for 'help' and 'version', which are always present. */
+/*! @brief The full set of options, except for 'heartbeat', 'help' and 'version', which are always
+ present. */
 # define ALL_OPTIONS_STRING_ T_(ARGS_OPTION_STRING_ CHANNEL_OPTION_STRING_ ENDPOINT_OPTION_STRING_ \
                                 GO_OPTION_STRING_ INFO_OPTION_STRING_ MOD_OPTION_STRING_ \
                                 PORT_OPTION_STRING_ REPORT_OPTION_STRING_ TAG_OPTION_STRING_)
@@ -97,23 +103,29 @@ namespace MplusM
     namespace Common
     {
         class ArgumentsRequestHandler;
+        class AsyncRequestHandler;
         class BaseContext;
         class BaseRequestHandler;
         class ChannelsRequestHandler;
+        class ClientChannel;
         class ClientsRequestHandler;
         class DetachRequestHandler;
         class Endpoint;
         class ExtraInfoRequestHandler;
+        class HeartbeatThread;
         class InfoRequestHandler;
         class ListRequestHandler;
         class MetricsRequestHandler;
         class MetricsStateRequestHandler;
         class NameRequestHandler;
         class PingThread;
+        class RequestStatsRequestHandler;
         class ServiceInputHandler;
         class ServiceInputHandlerCreator;
         class SetMetricsStateRequestHandler;
         class StopRequestHandler;
+        class TimestampRequestHandler;
+        class TracesRequestHandler;
 
         /*! @brief The modification values to be used with the service channel tag. */
         enum AddressTagModifier
@@ -182,6 +194,17 @@ namespace MplusM
 
         private :
 
+            /*! @brief The channel used to send the responses to asynchronous requests to a client,
+             along with the name of the client channel that it is connected to. */
+            typedef std::pair<YarpString, ClientChannel *> AsyncReplyChannel;
+
+            /*! @brief A mapping from client channel names to the channels used to send the
+             responses to their asynchronous requests. */
+            typedef std::map<YarpString, AsyncReplyChannel> AsyncReplyChannelMap;
+
+            /*! @brief The threads that process asynchronous requests. */
+            typedef std::vector<AsyncRequestThread *> AsyncRequestThreadVector;
+
             /*! @brief A mapping from strings to contexts. */
             typedef std::map<YarpString, BaseContext *> ContextMap;
 
@@ -242,6 +265,14 @@ namespace MplusM
             virtual
             ~BaseService(void);
 
+            /*! @brief Queue a request for asynchronous processing, starting the threads that
+             process such requests if they are not already running.
+             @param[in] item The request to be processed.
+             @returns @c true if the request was queued and @c false if the queue is full or the
+             requests can't be processed. */
+            bool
+            addAsyncRequest(const AsyncRequest & item);
+
             /*! @brief Return the description of the service.
              @returns The description of the service. */
             inline const YarpString &
@@ -358,6 +389,13 @@ namespace MplusM
                 return _metricsEnabled;
             } // metricsAreEnabled
 
+            /*! @brief Wait for a queued asynchronous request, process it and send its response
+             to the requesting client.
+             @returns @c true if the caller should continue waiting for requests and @c false if
+             the service is shutting down its asynchronous processing. */
+            bool
+            processNextAsyncRequest(void);
+
             /*! @brief Process partially-structured input data.
              @param[in] request The requested operation.
              @param[in] restOfInput The arguments for the operation.
@@ -379,6 +417,14 @@ namespace MplusM
                 return _requestsDescription;
             } // requestsDescription
 
+            /*! @brief Return the recorder of request spans for the service.
+             @returns The recorder of request spans for the service. */
+            inline RequestTracer &
+            requestTracer(void)
+            {
+                return _tracer;
+            } // requestTracer
+
             /*! @brief Send a 'ping' on behalf of a service.
              @param[in] channelName The service channel to report with the ping.
              @param[in] checker A function that provides for early exit from loops.
@@ -492,6 +538,18 @@ namespace MplusM
             void
             detachRequestHandlers(void);
 
+            /*! @brief Return the channel that is connected to the client of an asynchronous
+             request, removing the channel for the client if it is for a different destination.
+
+             The caller must hold the lock for the channels used to send asynchronous responses.
+             @param[in] item The request that was processed.
+             @param[out] staleChannel The channel that was removed, or @c NULL if none was
+             removed.
+             @returns The channel that is connected to the client or @c NULL if there is none. */
+            ClientChannel *
+            findAsyncReplyChannel(const AsyncRequest & item,
+                                  ClientChannel * &    staleChannel);
+
             /*! @brief Lock the data. */
             inline void
             lockContexts(void)
@@ -505,6 +563,18 @@ namespace MplusM
             BaseService &
             operator =(const BaseService & other);
 
+            /*! @brief Send the response to an asynchronous request to the requesting client.
+             @param[in] item The request that was processed.
+             @param[in] response The response to the request. */
+            void
+            sendAsyncResponse(const AsyncRequest &     item,
+                              const yarp::os::Bottle & response);
+
+            /*! @brief Stop the threads that process asynchronous requests and release the channels
+             used to send their responses. */
+            void
+            stopAsyncProcessing(void);
+
             /*! @brief Unlock the data. */
             inline void
             unlockContexts(void)
@@ -524,6 +594,24 @@ namespace MplusM
             /*! @brief The contention lock used to avoid inconsistencies. */
             yarp::os::Mutex _contextsLock;
 
+            /*! @brief The contention lock for the asynchronous request queue and threads. */
+            yarp::os::Mutex _asyncLock;
+
+            /*! @brief The contention lock for the channels used to send asynchronous responses. */
+            yarp::os::Mutex _asyncRepliesLock;
+
+            /*! @brief Signalled when an asynchronous request is queued. */
+            yarp::os::Semaphore _asyncRequestsAvailable;
+
+            /*! @brief The asynchronous requests that are waiting to be processed. */
+            AsyncRequestQueue _asyncRequests;
+
+            /*! @brief The channels used to send the responses to asynchronous requests. */
+            AsyncReplyChannelMap _asyncReplyChannels;
+
+            /*! @brief The threads that process asynchronous requests. */
+            AsyncRequestThreadVector _asyncThreads;
+
             /*! @brief The map between requests and request handlers. */
             RequestMap _requestHandlers;
 
@@ -552,9 +640,15 @@ namespace MplusM
             /*! @brief The auxiliary send / receive counters. */
             SendReceiveCounters _auxCounters;
 
+            /*! @brief The recorder of a sample of the requests to the service. */
+            RequestTracer _tracer;
+
             /*! @brief The request handler for the 'arguments' request. */
             ArgumentsRequestHandler * _argumentsHandler;
 
+            /*! @brief The request handler for the 'async' request. */
+            AsyncRequestHandler * _asyncHandler;
+
             /*! @brief The request handler for the 'channels' request. */
             ChannelsRequestHandler * _channelsHandler;
 
@@ -582,12 +676,21 @@ namespace MplusM
             /*! @brief The request handler for the 'name' request. */
             NameRequestHandler * _nameHandler;
 
+            /*! @brief The request handler for the 'requestStats' request. */
+            RequestStatsRequestHandler * _requestStatsHandler;
+
             /*! @brief The request handler for the 'setMetricsState' request. */
             SetMetricsStateRequestHandler * _setMetricsStateHandler;
 
             /*! @brief The request handler for the 'stop' request. */
             StopRequestHandler * _stopHandler;
 
+            /*! @brief The request handler for the 'timestamp' request. */
+            TimestampRequestHandler * _timestampHandler;
+
+            /*! @brief The request handler for the 'traces' request. */
+            TracesRequestHandler * _tracesHandler;
+
             /*! @brief The connection point for the service. */
             Endpoint * _endpoint;
 
@@ -597,15 +700,34 @@ namespace MplusM
             /*! @brief The input handler creator for the service. */
             ServiceInputHandlerCreator * _handlerCreator;
 
+            /*! @brief The object used to send heartbeats for the service. */
+            HeartbeatThread * _heartbeat;
+
             /*! @brief The object used to generate 'pings' for the service. */
             PingThread * _pinger;
 
+            /*! @brief The round-trip time, in seconds, of the most recent 'ping' to the %Registry
+             Service, or a negative value if no 'ping' has completed. */
+            double _lastPingRoundTrip;
+
             /*! @brief The kind of service. */
             ServiceKind _kind;
 
+            /*! @brief @c true if the asynchronous request threads are being stopped and @c false
+             otherwise. */
+            bool _asyncStopping;
+
             /*! @brief @c true if metrics are enabled and @c false otherwise. */
             bool _metricsEnabled;
 
+            /*! @brief @c true if the version of the %Registry Service 'ping' request has been
+             checked and @c false otherwise. */
+            bool _registryPingChecked;
+
+            /*! @brief @c true if the %Registry Service 'ping' request accepts a round-trip time and
+             @c false otherwise. */
+            bool _registryTakesRoundTrips;
+
             /*! @brief The current state of the service - @c true if active and @c false
              otherwise. */
             bool _started;
@@ -614,16 +736,6 @@ namespace MplusM
              @c false otherwise. */
             bool _useMultipleHandlers;
 
-# if defined(__APPLE__)
-#  pragma clang diagnostic push
-#  pragma clang diagnostic ignored "-Wunused-private-field"
-# endif // defined(__APPLE__)
-            /*! @brief Filler to pad to alignment boundary */
-            char _filler[1];
-# if defined(__APPLE__)
-#  pragma clang diagnostic pop
-# endif // defined(__APPLE__)
-
         }; // BaseService
 
         /*! @brief Update the endpoint name based on the provided arguments to the service.
@@ -649,6 +761,8 @@ namespace MplusM
         GetOurEffectiveAddress(NetworkAddress & ourAddress);
 
         /*! @brief Process the standard options for service executables.
+         The option '-b' / '--heartbeat' specifies the address and port, as 'address:port', to
+         which the service sends its heartbeats.
          The option '-c' / '--channel' displays the endpoint name after applying all other
          options and retunrs @c false.
          The option '-e' / '--endpoint' specifies the endpoint name to be used.
@@ -715,6 +829,18 @@ namespace MplusM
                              CheckFunction      checker = NULL,
                              void *             checkStuff = NULL);
 
+        /*! @brief Set the destination for the heartbeats of the services that are started after
+         this call.
+
+         A service with a heartbeat sends a summary of the activity of its channels to the
+         destination every HEARTBEAT_INTERVAL_ seconds; the destination can be a unicast or
+         multicast IPv4 address.
+         @param[in] destination The address and port, as 'address:port', or an empty string to not
+         send heartbeats.
+         @returns @c true if the destination was valid and @c false otherwise. */
+        bool
+        SetHeartbeatDestination(const YarpString & destination);
+
         /*! @brief Unregister a local service with a running %Registry Service.
          @param[in] channelName The channel provided by the service.
          @param[in] service The actual service being unregistered.
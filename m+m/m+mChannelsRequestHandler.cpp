@@ -67,7 +67,7 @@ using namespace MplusM::Common;
 #endif // defined(__APPLE__)
 
 /*! @brief The protocol version number for the 'channels' request. */
-#define CHANNELS_REQUEST_VERSION_NUMBER_ "1.0"
+#define CHANNELS_REQUEST_VERSION_NUMBER_ "1.2"
 
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
@@ -125,7 +125,9 @@ ChannelsRequestHandler::fillInDescription(const YarpString &   request,
                                                   "names, a list of secondary output channel names "
                                                   "and a list of secondary client channel names, "
                                                   "with protocols and protocol descriptions for "
-                                                  "the input and output channels"));
+                                                  "the input and output channels, followed by the "
+                                                  "multicast group of each channel that uses "
+                                                  "one"));
         yarp::os::Value    keywords;
         yarp::os::Bottle * asList = keywords.asList();
 
@@ -179,6 +181,15 @@ ChannelsRequestHandler::processRequest(const YarpString &           request,
                 newBottle.addString(aChannel._portName);
                 newBottle.addString(aChannel._portProtocol);
                 newBottle.addString(aChannel._protocolDescription);
+                if (0 < aChannel._compression.length())
+                {
+                    newBottle.addString(aChannel._multicastGroup);
+                    newBottle.addString(aChannel._compression);
+                }
+                else if (0 < aChannel._multicastGroup.length())
+                {
+                    newBottle.addString(aChannel._multicastGroup);
+                }
             }
         }
         // Note that we can't reuse the first list variable; we wind up with duplicate entries
@@ -197,6 +208,15 @@ ChannelsRequestHandler::processRequest(const YarpString &           request,
                 newBottle.addString(aChannel._portName);
                 newBottle.addString(aChannel._portProtocol);
                 newBottle.addString(aChannel._protocolDescription);
+                if (0 < aChannel._compression.length())
+                {
+                    newBottle.addString(aChannel._multicastGroup);
+                    newBottle.addString(aChannel._compression);
+                }
+                else if (0 < aChannel._multicastGroup.length())
+                {
+                    newBottle.addString(aChannel._multicastGroup);
+                }
             }
         }
         yarp::os::Bottle & aList3 = _response.addList();
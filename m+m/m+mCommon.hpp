@@ -356,6 +356,41 @@ namespace MplusM
 
         }; // ChannelMode
 
+        /*! @brief How the large messages written to a channel are compressed. */
+        enum CompressionMethod
+        {
+            /*! @brief The messages are not compressed. */
+            kCompressionMethodNone,
+
+            /*! @brief The messages are compressed with LZ4, which favours speed. */
+            kCompressionMethodLZ4,
+
+            /*! @brief The messages are compressed with zstd, which favours size. */
+            kCompressionMethodZstd,
+
+            /*! @brief Force the size to be 4 bytes. */
+            kCompressionMethodUnknown = 0x7FFFFFFF
+
+        }; // CompressionMethod
+
+        /*! @brief How a client spreads its requests across the instances of a service. */
+        enum InstanceRoutingPolicy
+        {
+            /*! @brief Send every request to one instance, chosen when the service is found. */
+            kInstanceRoutingSticky,
+
+            /*! @brief Send each request to the next instance in turn. */
+            kInstanceRoutingRoundRobin,
+
+            /*! @brief Send each request to the instance with the fewest unanswered asynchronous
+             requests. */
+            kInstanceRoutingLeastOutstanding,
+
+            /*! @brief Force the size to be 4 bytes. */
+            kInstanceRoutingUnknown = 0x7FFFFFFF
+
+        }; // InstanceRoutingPolicy
+
         /*! @brief The format for the output from command-line tools. */
         enum OutputFlavour
         {
@@ -374,6 +409,26 @@ namespace MplusM
 
         }; // OutputFlavour
 
+        /*! @brief What to do with a message for an output channel that has a full queue. */
+        enum OutputQueuePolicy
+        {
+            /*! @brief Wait until there is room in the queue. */
+            kOutputQueuePolicyBlock,
+
+            /*! @brief Replace the newest waiting message with the new message. */
+            kOutputQueuePolicyConflate,
+
+            /*! @brief Discard the oldest waiting message to make room for the new message. */
+            kOutputQueuePolicyDropOldest,
+
+            /*! @brief Discard the new message. */
+            kOutputQueuePolicyDropNewest,
+
+            /*! @brief Force the size to be 4 bytes. */
+            kOutputQueuePolicyUnknown = 0x7FFFFFFF
+
+        }; // OutputQueuePolicy
+
         /*! @brief The behavioural model for the service. */
         enum ServiceKind
         {
@@ -413,6 +468,14 @@ namespace MplusM
             /*! @brief The protocol description. */
             YarpString _protocolDescription;
 
+            /*! @brief The multicast group that the port sends to or receives from, as
+             'address:port', or an empty string if the port does not use a multicast group. */
+            YarpString _multicastGroup;
+
+            /*! @brief How large messages written to the port are compressed, as 'method' or
+             'method:dictionary', or an empty string if the port does not compress messages. */
+            YarpString _compression;
+
             /*! @brief The mode of the connection. */
             ChannelMode _portMode;
 
@@ -452,6 +515,16 @@ namespace MplusM
         (*CheckFunction)
             (void * stuff);
 
+        /*! @brief A function that receives the response to an asynchronous request.
+         @param[in] correlationId The identifier of the request.
+         @param[in] response The response to the request.
+         @param[in] responseStuff Private data for the function. */
+        typedef void
+        (*ResponseFunction)
+            (const int                correlationId,
+             const yarp::os::Bottle & response,
+             void *                   responseStuff);
+
         /*! @brief Dump out a description of the provided connection information to the log.
          @param[in] tag A unique string used to identify the call point for the output.
          @param[in] aContact The connection information to be reported. */
@@ -114,6 +114,12 @@
 
 /* #undef MpM_UseDiskDatabase */
 
+/* #undef MpM_UseMessageCompression */
+
+/* #undef MpM_UseNatNetSDK */
+
+/* #undef MpM_UseSimulatedDevices */
+
 /* #undef MpM_UseTestDatabase */
 
 /* #undef MpM_UseTimeoutsInRetryLoops */
@@ -0,0 +1,167 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mConflatingInputHandler.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for an input handler that only passes on the newest input.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mConflatingInputHandler.hpp"
+
+#include <m+m/m+mConflatingInputThread.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for an input handler that only passes on the newest input. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ConflatingInputHandler::ConflatingInputHandler(BaseInputHandler & target) :
+    inherited(), _target(target), _worker(new ConflatingInputThread(target))
+{
+    ODL_ENTER(); //####
+    ODL_P1("target = ", &target); //####
+    if (! _worker->start())
+    {
+        ODL_LOG("(! _worker->start())"); //####
+        delete _worker;
+        _worker = NULL;
+    }
+    ODL_EXIT_P(this); //####
+} // ConflatingInputHandler::ConflatingInputHandler
+
+ConflatingInputHandler::~ConflatingInputHandler(void)
+{
+    ODL_OBJENTER(); //####
+    stopProcessing();
+    if (_worker)
+    {
+        _worker->stop();
+        delete _worker;
+        _worker = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // ConflatingInputHandler::~ConflatingInputHandler
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+ConflatingInputHandler::getCounts(int64_t & numReceived,
+                                  int64_t & numDiscarded)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("numReceived = ", &numReceived, "numDiscarded = ", &numDiscarded); //####
+    if (_worker)
+    {
+        _worker->getCounts(numReceived, numDiscarded);
+    }
+    else
+    {
+        numReceived = numDiscarded = 0;
+    }
+    ODL_OBJEXIT(); //####
+} // ConflatingInputHandler::getCounts
+
+bool
+ConflatingInputHandler::handleInput(const yarp::os::Bottle &     input,
+                                    const YarpString &           senderChannel,
+                                    yarp::os::ConnectionWriter * replyMechanism,
+                                    const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_LL1("numBytes = ", numBytes); //####
+    bool result = true;
+
+    try
+    {
+        if (_worker)
+        {
+            _worker->post(input, senderChannel, numBytes);
+        }
+        else
+        {
+            // Without a thread, fall back to passing on every message directly.
+            result = _target.handleInput(input, senderChannel, replyMechanism, numBytes);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // ConflatingInputHandler::handleInput
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,150 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mConflatingInputHandler.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for an input handler that only passes on the newest input.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMConflatingInputHandler_HPP_))
+# define MpMConflatingInputHandler_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseInputHandler.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for an input handler that only passes on the newest input. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class ConflatingInputThread;
+
+        /*! @brief An input handler that only passes on the newest input.
+
+         The input is copied and handed to a separate thread that calls the target input handler,
+         so the YARP reader thread is never held up by the target. If more input arrives while the
+         target is still busy, only the newest is passed on and the rest is discarded. As the
+         connection is released before the target sees the input, no reply is possible. */
+        class ConflatingInputHandler : public BaseInputHandler
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseInputHandler inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] target The input handler that is to receive the newest input. */
+            explicit
+            ConflatingInputHandler(BaseInputHandler & target);
+
+            /*! @brief The destructor. */
+            virtual
+            ~ConflatingInputHandler(void);
+
+            /*! @brief Retrieve the number of messages that were received and the number that were
+             discarded because newer input arrived before they could be passed on.
+             @param[out] numReceived The number of messages that were received.
+             @param[out] numDiscarded The number of messages that were discarded. */
+            void
+            getCounts(int64_t & numReceived,
+                      int64_t & numDiscarded);
+
+            /*! @brief Process partially-structured input data.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @returns @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleInput(const yarp::os::Bottle &     input,
+                        const YarpString &           senderChannel,
+                        yarp::os::ConnectionWriter * replyMechanism,
+                        const size_t                 numBytes);
+
+            /*! @brief Return the input handler that receives the newest input.
+             @returns The input handler that receives the newest input. */
+            inline BaseInputHandler &
+            target(void)
+            const
+            {
+                return _target;
+            } // target
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            ConflatingInputHandler(const ConflatingInputHandler & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            ConflatingInputHandler &
+            operator =(const ConflatingInputHandler & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The input handler that receives the newest input. */
+            BaseInputHandler & _target;
+
+            /*! @brief The thread that passes the newest input to the target. */
+            ConflatingInputThread * _worker;
+
+        }; // ConflatingInputHandler
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMConflatingInputHandler_HPP_)
@@ -0,0 +1,164 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mConflatingInputThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the thread that delivers the newest input to a handler.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mConflatingInputThread.hpp"
+
+#include <m+m/m+mBaseInputHandler.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the thread that delivers the newest input to an input
+ handler. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ConflatingInputThread::ConflatingInputThread(BaseInputHandler & target) :
+    inherited(), _latest(), _wakeUp(0), _target(target)
+{
+    ODL_ENTER(); //####
+    ODL_P1("target = ", &target); //####
+    ODL_EXIT_P(this); //####
+} // ConflatingInputThread::ConflatingInputThread
+
+ConflatingInputThread::~ConflatingInputThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // ConflatingInputThread::~ConflatingInputThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+ConflatingInputThread::getCounts(int64_t & numPosted,
+                                 int64_t & numDiscarded)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("numPosted = ", &numPosted, "numDiscarded = ", &numDiscarded); //####
+    _latest.getCounts(numPosted, numDiscarded);
+    ODL_OBJEXIT(); //####
+} // ConflatingInputThread::getCounts
+
+void
+ConflatingInputThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _wakeUp.post();
+    ODL_OBJEXIT(); //####
+} // ConflatingInputThread::onStop
+
+void
+ConflatingInputThread::post(const yarp::os::Bottle & input,
+                            const YarpString &       senderChannel,
+                            const size_t             numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("input = ", &input); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_LL1("numBytes = ", numBytes); //####
+    ConflatedInput & slot = _latest.writeSlot();
+
+    slot._input = input;
+    slot._senderChannel = senderChannel;
+    slot._numBytes = numBytes;
+    // Only signal when there was nothing waiting, so that the semaphore count stays small; a
+    // message that replaces one that is still waiting is picked up by the earlier signal.
+    if (_latest.publish())
+    {
+        _wakeUp.post();
+    }
+    ODL_OBJEXIT(); //####
+} // ConflatingInputThread::post
+
+void
+ConflatingInputThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    for ( ; ! isStopping(); )
+    {
+        _wakeUp.wait();
+        if ((! isStopping()) && _latest.acquire())
+        {
+            ConflatedInput & latest = _latest.readSlot();
+
+            // The connection has been released by now, so no reply is possible.
+            _target.handleInput(latest._input, latest._senderChannel, NULL, latest._numBytes);
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // ConflatingInputThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
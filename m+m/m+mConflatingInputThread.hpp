@@ -0,0 +1,164 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mConflatingInputThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the thread that delivers the newest input to a handler.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMConflatingInputThread_HPP_))
+# define MpMConflatingInputThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mLatestValueBuffer.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the thread that delivers the newest input to an input
+ handler. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class BaseInputHandler;
+
+        /*! @brief An input message that is waiting to be delivered. */
+        struct ConflatedInput
+        {
+            /*! @brief The partially-structured input data. */
+            yarp::os::Bottle _input;
+
+            /*! @brief The name of the channel used to send the input data. */
+            YarpString _senderChannel;
+
+            /*! @brief The number of bytes that were available on the connection. */
+            size_t _numBytes;
+
+        }; // ConflatedInput
+
+        /*! @brief A thread that delivers the newest input message to an input handler.
+
+         Messages are handed over through a LatestValueBuffer, so the thread that posts them never
+         waits for the input handler; messages that arrive while the input handler is busy are
+         replaced by newer ones. */
+        class ConflatingInputThread : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] target The input handler that is to receive the messages. */
+            explicit
+            ConflatingInputThread(BaseInputHandler & target);
+
+            /*! @brief The destructor. */
+            virtual
+            ~ConflatingInputThread(void);
+
+            /*! @brief Retrieve the number of messages that were posted and the number that were
+             replaced before they could be delivered.
+             @param[out] numPosted The number of messages that were posted.
+             @param[out] numDiscarded The number of messages that were never delivered. */
+            void
+            getCounts(int64_t & numPosted,
+                      int64_t & numDiscarded);
+
+            /*! @brief Make a message the next one to be delivered.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] numBytes The number of bytes available on the connection. */
+            void
+            post(const yarp::os::Bottle & input,
+                 const YarpString &       senderChannel,
+                 const size_t             numBytes);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            ConflatingInputThread(const ConflatingInputThread & other);
+
+            /*! @brief Called when the thread is being asked to stop. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            ConflatingInputThread &
+            operator =(const ConflatingInputThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The handoff between the posting thread and this thread. */
+            LatestValueBuffer<ConflatedInput> _latest;
+
+            /*! @brief Signalled when a message is waiting to be delivered. */
+            yarp::os::Semaphore _wakeUp;
+
+            /*! @brief The input handler that is to receive the messages. */
+            BaseInputHandler & _target;
+
+        }; // ConflatingInputThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMConflatingInputThread_HPP_)
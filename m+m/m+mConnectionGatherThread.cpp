@@ -0,0 +1,141 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mConnectionGatherThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a thread that gathers port connections for m+m.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mConnectionGatherThread.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a thread that gathers port connections for m+m. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Utilities;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ConnectionGatherThread::ConnectionGatherThread(PortConnectionsVector & ports,
+                                               size_t &                nextPort,
+                                               yarp::os::Mutex &       portLock,
+                                               const InputOutputFlag   which,
+                                               const double            timeToWait) :
+    inherited(), _ports(ports), _nextPort(nextPort), _portLock(portLock),
+    _timeToWait(timeToWait), _which(which)
+{
+    ODL_ENTER(); //####
+    ODL_P3("ports = ", &ports, "nextPort = ", &nextPort, "portLock = ", &portLock); //####
+    ODL_L1("which = ", static_cast<int>(which)); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    ODL_EXIT_P(this); //####
+} // ConnectionGatherThread::ConnectionGatherThread
+
+ConnectionGatherThread::~ConnectionGatherThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // ConnectionGatherThread::~ConnectionGatherThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+ConnectionGatherThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    for ( ; ! isStopping(); )
+    {
+        size_t index;
+
+        _portLock.lock();
+        index = _nextPort;
+        if (_ports.size() > index)
+        {
+            ++_nextPort;
+        }
+        _portLock.unlock();
+        if (_ports.size() > index)
+        {
+            PortConnections & aPort = _ports[index];
+
+            aPort._answered = GatherPortConnections(aPort._portName, aPort._inputs,
+                                                    aPort._outputs, _which, true, NULL, NULL,
+                                                    _timeToWait);
+        }
+        else
+        {
+            break;
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // ConnectionGatherThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,149 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mConnectionGatherThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that gathers port connections for m+m.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMConnectionGatherThread_HPP_))
+# define MpMConnectionGatherThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mUtilities.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that gathers port connections for m+m. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Utilities
+    {
+        /*! @brief A convenience class to gather the connections of a set of ports.
+
+         Each thread repeatedly claims the next unclaimed port of the set and records the
+         connections for that port in the corresponding entry of the set; as each entry is only
+         written by the thread that claimed it, only the claiming needs to be locked. */
+        class ConnectionGatherThread : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in,out] ports The set of ports to be gathered.
+             @param[in,out] nextPort The index of the next unclaimed port.
+             @param[in] portLock The lock that protects the index of the next unclaimed port.
+             @param[in] which A flag to specify what is to be gathered.
+             @param[in] timeToWait The number of seconds allowed for each port. */
+            ConnectionGatherThread(PortConnectionsVector & ports,
+                                   size_t &                nextPort,
+                                   yarp::os::Mutex &       portLock,
+                                   const InputOutputFlag   which,
+                                   const double            timeToWait);
+
+            /*! @brief The destructor. */
+            virtual
+            ~ConnectionGatherThread(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            ConnectionGatherThread(const ConnectionGatherThread & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            ConnectionGatherThread &
+            operator =(const ConnectionGatherThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The set of ports to be gathered. */
+            PortConnectionsVector & _ports;
+
+            /*! @brief The index of the next unclaimed port. */
+            size_t & _nextPort;
+
+            /*! @brief The lock that protects the index of the next unclaimed port. */
+            yarp::os::Mutex & _portLock;
+
+            /*! @brief The number of seconds allowed for each port. */
+            double _timeToWait;
+
+            /*! @brief What is to be gathered. */
+            InputOutputFlag _which;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // ConnectionGatherThread
+
+    } // Utilities
+
+} // MplusM
+
+#endif // ! defined(MpMConnectionGatherThread_HPP_)
@@ -0,0 +1,422 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mDiscoveryCache.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a process-local cache of service lookups.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mDiscoveryCache.hpp"
+
+#include <m+m/m+mGeneralChannel.hpp>
+#include <m+m/m+mRequests.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a process-local cache of service lookups. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The prefix for the key of a lookup that returns service names. */
+static const char kNamesKeyPrefix = 'n';
+
+/*! @brief The prefix for the key of a lookup that returns service ports. */
+static const char kPortsKeyPrefix = 'p';
+
+/*! @brief The position of the status in a status message. */
+static const int kStatusIndex = 3;
+
+/*! @brief The position of the service channel in a status message about a service. */
+static const int kStatusChannelIndex = 4;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the key for a lookup.
+ @param[in] criteria The matching conditions.
+ @param[in] getNames @c true if service names are to be returned and @c false if service ports
+ are to be returned.
+ @returns The key for the lookup. */
+static YarpString
+makeKey(const YarpString & criteria,
+        const bool         getNames)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("criteria = ", criteria); //####
+    ODL_B1("getNames = ", getNames); //####
+    YarpString result(1, getNames ? kNamesKeyPrefix : kPortsKeyPrefix);
+
+    result += criteria;
+    ODL_EXIT_s(result); //####
+    return result;
+} // makeKey
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+DiscoveryCache::DiscoveryCache(void) :
+    inherited(), _entries(), _lock(), _channel(NULL), _channelName(), _generation(0),
+    _lastSequence(-1), _needsSubscription(true)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // DiscoveryCache::DiscoveryCache
+
+DiscoveryCache::~DiscoveryCache(void)
+{
+    ODL_OBJENTER(); //####
+    if (_channel)
+    {
+#if defined(MpM_DoExplicitClose)
+        _channel->close();
+#endif // defined(MpM_DoExplicitClose)
+        BaseChannel::RelinquishChannel(_channel);
+        _channel = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // DiscoveryCache::~DiscoveryCache
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+DiscoveryCache::forgetChannel(const YarpString & channelName)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("channelName = ", channelName); //####
+    ++_generation;
+    for (DiscoveryEntryMap::iterator walker(_entries.begin()); _entries.end() != walker; )
+    {
+        if (kPortsKeyPrefix == walker->first[0])
+        {
+            // A service that has gone away can only be dropped from a list of ports, since the
+            // remaining ports still match the criteria.
+            yarp::os::Bottle * oldList = walker->second.get(1).asList();
+
+            if (oldList)
+            {
+                yarp::os::Bottle newResponse;
+
+                newResponse.addString(MpM_OK_RESPONSE_);
+                yarp::os::Bottle & matches = newResponse.addList();
+
+                for (int ii = 0, mm = oldList->size(); mm > ii; ++ii)
+                {
+                    yarp::os::Value & aMatch = oldList->get(ii);
+
+                    if (aMatch.toString() != channelName)
+                    {
+                        matches.add(aMatch);
+                    }
+                }
+                walker->second = newResponse;
+                ++walker;
+            }
+            else
+            {
+                _entries.erase(walker++);
+            }
+        }
+        else
+        {
+            // The names of the services that are left cannot be determined here.
+            _entries.erase(walker++);
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // DiscoveryCache::forgetChannel
+
+void
+DiscoveryCache::forgetEverything(void)
+{
+    ODL_OBJENTER(); //####
+    ++_generation;
+    _entries.clear();
+    ODL_OBJEXIT(); //####
+} // DiscoveryCache::forgetEverything
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+DiscoveryCache::handleInput(const yarp::os::Bottle &     input,
+                            const YarpString &           senderChannel,
+                            yarp::os::ConnectionWriter * replyMechanism,
+                            const size_t                 numBytes)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(senderChannel,replyMechanism,numBytes)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_L1("numBytes = ", numBytes); //####
+    bool result = true;
+
+    try
+    {
+        int inputSize = input.size();
+
+        if (MpM_EXPECTED_REGISTRY_STATUS_SIZE_ <= inputSize)
+        {
+            yarp::os::Value lastValue(input.get(inputSize - 1));
+            YarpString      status(input.get(kStatusIndex).toString());
+
+            _lock.lock();
+            if (lastValue.isInt())
+            {
+                int sequence = lastValue.asInt();
+
+                // A gap in the sequence means that a status message was missed or that the
+                // %Registry Service was restarted, so nothing that is cached can be trusted.
+                if ((0 <= _lastSequence) && ((_lastSequence + 1) != sequence))
+                {
+                    ODL_LOG("((0 <= _lastSequence) && ((_lastSequence + 1) != sequence))"); //####
+                    forgetEverything();
+                }
+                _lastSequence = sequence;
+            }
+            if ((status == MpM_REGISTRY_STATUS_ADDING_) ||
+                (status == MpM_REGISTRY_STATUS_STARTING_) ||
+                (status == MpM_REGISTRY_STATUS_STOPPING_))
+            {
+                forgetEverything();
+            }
+            else if ((status == MpM_REGISTRY_STATUS_REMOVING_) ||
+                     (status == MpM_REGISTRY_STATUS_STALE_) ||
+                     (status == MpM_REGISTRY_STATUS_UNREGISTERING_))
+            {
+                if (kStatusChannelIndex < inputSize)
+                {
+                    forgetChannel(input.get(kStatusChannelIndex).toString());
+                }
+                else
+                {
+                    forgetEverything();
+                }
+            }
+            _lock.unlock();
+        }
+        else
+        {
+            ODL_LOG("! (MpM_EXPECTED_REGISTRY_STATUS_SIZE_ <= inputSize)"); //####
+            result = false;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // DiscoveryCache::handleInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+bool
+DiscoveryCache::lookUp(const YarpString & criteria,
+                       const bool         getNames,
+                       yarp::os::Bottle & result,
+                       int &              generation)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("criteria = ", criteria); //####
+    ODL_B1("getNames = ", getNames); //####
+    ODL_P2("result = ", &result, "generation = ", &generation); //####
+    bool found = false;
+
+    try
+    {
+        _lock.lock();
+        if (_channel && (0 < _channel->getInputCount()))
+        {
+            DiscoveryEntryMap::const_iterator match(_entries.find(makeKey(criteria,
+                                                                          getNames)));
+
+            if (_entries.end() != match)
+            {
+                result = match->second;
+                found = true;
+            }
+        }
+        else
+        {
+            // The status messages are no longer arriving, so the cache must be rebuilt once the
+            // connection to the %Registry Service has been restored.
+            ODL_LOG("! (_channel && (0 < _channel->getInputCount()))"); //####
+            forgetEverything();
+            _needsSubscription = true;
+        }
+        generation = _generation;
+        _lock.unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(found); //####
+    return found;
+} // DiscoveryCache::lookUp
+
+void
+DiscoveryCache::remember(const YarpString &       criteria,
+                         const bool               getNames,
+                         const yarp::os::Bottle & response,
+                         const int                generation)
+{
+    ODL_OBJENTER(); //####
+    ODL_S2s("criteria = ", criteria, "response = ", response.toString()); //####
+    ODL_B1("getNames = ", getNames); //####
+    ODL_LL1("generation = ", generation); //####
+    try
+    {
+        bool mustSubscribe;
+
+        _lock.lock();
+        mustSubscribe = _needsSubscription;
+        // Only successful responses are kept. A response that was obtained while the status
+        // messages were not arriving, or while the cache was being changed, might already be out
+        // of date, so it is not kept either.
+        if ((! mustSubscribe) && (generation == _generation) &&
+            (MpM_EXPECTED_MATCH_RESPONSE_SIZE_ == response.size()) &&
+            (response.get(0).toString() == MpM_OK_RESPONSE_))
+        {
+            _entries[makeKey(criteria, getNames)] = response;
+        }
+        _lock.unlock();
+        if (mustSubscribe && (! subscribe()))
+        {
+            ODL_LOG("(mustSubscribe && (! subscribe()))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // DiscoveryCache::remember
+
+bool
+DiscoveryCache::subscribe(CheckFunction checker,
+                          void *        checkStuff)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("checkStuff = ", checkStuff); //####
+    bool result = false;
+
+    try
+    {
+        if (! _channel)
+        {
+            _channelName = GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                BUILD_NAME_("discovery_", DEFAULT_CHANNEL_ROOT_));
+            _channel = new GeneralChannel(false);
+#if defined(MpM_ReportOnConnections)
+            _channel->setReporter(*Utilities::GetGlobalStatusReporter());
+#endif // defined(MpM_ReportOnConnections)
+            if (_channel->openWithRetries(_channelName, STANDARD_WAIT_TIME_))
+            {
+                setChannel(_channel);
+                _channel->setReader(*this);
+            }
+            else
+            {
+                ODL_LOG("! (_channel->openWithRetries(_channelName, STANDARD_WAIT_TIME_))"); //####
+                BaseChannel::RelinquishChannel(_channel);
+                _channel = NULL;
+            }
+        }
+        if (_channel)
+        {
+            result = Utilities::NetworkConnectWithRetries(MpM_REGISTRY_STATUS_NAME_, _channelName,
+                                                          STANDARD_WAIT_TIME_, false, checker,
+                                                          checkStuff);
+            // Anything learned before the connection was made might have been changed by a status
+            // message that was not seen.
+            _lock.lock();
+            forgetEverything();
+            _lastSequence = -1;
+            _needsSubscription = (! result);
+            _lock.unlock();
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // DiscoveryCache::subscribe
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,207 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mDiscoveryCache.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a process-local cache of service lookups.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMDiscoveryCache_HPP_))
+# define MpMDiscoveryCache_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseInputHandler.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a process-local cache of service lookups. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class GeneralChannel;
+
+        /*! @brief A process-local cache of the responses to 'match' requests.
+
+         The cache listens to the status channel of the %Registry Service. When a service is
+         removed, it is dropped from the cached responses; when a service is added, or when a status
+         message has been missed, the cached responses are discarded, as the criteria can only be
+         evaluated by the %Registry Service. */
+        class DiscoveryCache : public BaseInputHandler
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseInputHandler inherited;
+
+            /*! @brief A mapping from lookups to the responses from the %Registry Service. */
+            typedef std::map<YarpString, yarp::os::Bottle> DiscoveryEntryMap;
+
+        public :
+
+            /*! @brief The constructor. */
+            DiscoveryCache(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~DiscoveryCache(void);
+
+            /*! @brief Retrieve the response to a lookup, if it is present.
+             @param[in] criteria The matching conditions.
+             @param[in] getNames @c true if service names are to be returned and @c false if
+             service ports are to be returned.
+             @param[out] result The response to the lookup.
+             @param[out] generation The state of the cache, to be passed to remember() if the
+             %Registry Service must be asked.
+             @returns @c true if the response was present and @c false if the %Registry Service
+             must be asked. */
+            bool
+            lookUp(const YarpString & criteria,
+                   const bool         getNames,
+                   yarp::os::Bottle & result,
+                   int &              generation);
+
+            /*! @brief Record the response to a lookup.
+             @param[in] criteria The matching conditions.
+             @param[in] getNames @c true if service names were returned and @c false if service
+             ports were returned.
+             @param[in] response The response from the %Registry Service.
+             @param[in] generation The state of the cache when the lookup was not found; if the
+             cache has changed since then, the response might be out of date and is not kept. */
+            void
+            remember(const YarpString &       criteria,
+                     const bool               getNames,
+                     const yarp::os::Bottle & response,
+                     const int                generation);
+
+            /*! @brief Connect the cache to the status channel of the %Registry Service.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function.
+             @returns @c true if the cache is receiving status messages and @c false otherwise. */
+            bool
+            subscribe(CheckFunction checker = NULL,
+                      void *        checkStuff = NULL);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            DiscoveryCache(const DiscoveryCache & other);
+
+            /*! @brief Remove a service from the cached responses.
+             @param[in] channelName The channel of the service that is no longer present. */
+            void
+            forgetChannel(const YarpString & channelName);
+
+            /*! @brief Discard all the cached responses. */
+            void
+            forgetEverything(void);
+
+            /*! @brief Process partially-structured input data.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @returns @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleInput(const yarp::os::Bottle &     input,
+                        const YarpString &           senderChannel,
+                        yarp::os::ConnectionWriter * replyMechanism,
+                        const size_t                 numBytes);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            DiscoveryCache &
+            operator =(const DiscoveryCache & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The cached responses. */
+            DiscoveryEntryMap _entries;
+
+            /*! @brief The contention lock used to control access to the cached responses. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The channel used to receive the status messages. */
+            GeneralChannel * _channel;
+
+            /*! @brief The name of the channel used to receive the status messages. */
+            YarpString _channelName;
+
+            /*! @brief The number of times that the cached responses have been changed by status
+             messages. */
+            int _generation;
+
+            /*! @brief The sequence number of the most recent status message, or @c -1 if no
+             status message has been received. */
+            int _lastSequence;
+
+            /*! @brief @c true if the connection to the status channel has been lost and must be
+             restored before responses can be cached. */
+            bool _needsSubscription;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // DiscoveryCache
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMDiscoveryCache_HPP_)
@@ -0,0 +1,350 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mFrameLatencyTrace.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for tracing the latency of frames from a device.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mFrameLatencyTrace.hpp"
+
+#include <m+m/m+mSendReceiveCounters.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for tracing the latency of frames from a device. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of microseconds in a second. */
+static const double kMicrosecondsPerSecond = 1e6;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Add a sample to the statistics for a stage.
+ @param[in,out] stage The statistics for the stage.
+ @param[in] elapsed The time taken by the stage, in seconds. */
+static void
+addSample(FrameLatencyStage & stage,
+          const double        elapsed)
+{
+    ODL_ENTER(); //####
+    ODL_P1("stage = ", &stage); //####
+    ODL_D1("elapsed = ", elapsed); //####
+    // The clocks are read at different points, so a short stage can appear to take negative time.
+    double  actual = std::max(0.0, elapsed);
+    int64_t microseconds = static_cast<int64_t>(actual * kMicrosecondsPerSecond);
+    int     bucket = 0;
+
+    for ( ; (microseconds >= (static_cast<int64_t>(1) << bucket)) &&
+         ((FRAME_LATENCY_BUCKET_COUNT_ - 1) > bucket); ++bucket)
+    {
+    }
+    ++stage._buckets[bucket];
+    if (0 == stage._count++)
+    {
+        stage._minimum = stage._maximum = actual;
+    }
+    else
+    {
+        stage._minimum = std::min(stage._minimum, actual);
+        stage._maximum = std::max(stage._maximum, actual);
+    }
+    stage._sum += actual;
+    ODL_EXIT(); //####
+} // addSample
+
+/*! @brief Discard the statistics for a stage.
+ @param[out] stage The statistics for the stage. */
+static void
+clearStage(FrameLatencyStage & stage)
+{
+    ODL_ENTER(); //####
+    ODL_P1("stage = ", &stage); //####
+    for (int ii = 0; FRAME_LATENCY_BUCKET_COUNT_ > ii; ++ii)
+    {
+        stage._buckets[ii] = 0;
+    }
+    stage._count = 0;
+    stage._maximum = stage._minimum = stage._sum = 0;
+    ODL_EXIT(); //####
+} // clearStage
+
+/*! @brief Return the time, in microseconds, below which a fraction of the samples of a stage
+ fall.
+
+ The result is the upper bound of the bucket that holds the sample, limited to the longest time.
+ @param[in] stage The statistics for the stage.
+ @param[in] fraction The fraction of the samples.
+ @returns The time below which the fraction of the samples fall. */
+static int64_t
+percentileOfStage(const FrameLatencyStage & stage,
+                  const double              fraction)
+{
+    ODL_ENTER(); //####
+    ODL_P1("stage = ", &stage); //####
+    ODL_D1("fraction = ", fraction); //####
+    int64_t limit = static_cast<int64_t>(stage._maximum * kMicrosecondsPerSecond);
+    int64_t result = limit;
+    int64_t target = static_cast<int64_t>(stage._count * fraction);
+    int64_t seen = 0;
+
+    for (int ii = 0; FRAME_LATENCY_BUCKET_COUNT_ > ii; ++ii)
+    {
+        seen += stage._buckets[ii];
+        if (seen > target)
+        {
+            result = std::min(limit, static_cast<int64_t>(1) << ii);
+            break;
+        }
+    }
+    ODL_EXIT_LL(result); //####
+    return result;
+} // percentileOfStage
+
+/*! @brief Add the statistics for a stage to a dictionary.
+ @param[in,out] dictionary The dictionary to be updated.
+ @param[in] tag The key for the statistics.
+ @param[in] stage The statistics for the stage. */
+static void
+addStageToDictionary(yarp::os::Property &      dictionary,
+                     const YarpString &        tag,
+                     const FrameLatencyStage & stage)
+{
+    ODL_ENTER(); //####
+    ODL_P2("dictionary = ", &dictionary, "stage = ", &stage); //####
+    ODL_S1s("tag = ", tag); //####
+    yarp::os::Value    stuff;
+    yarp::os::Bottle * stuffAsList = stuff.asList();
+
+    if (stuffAsList)
+    {
+        double mean = ((0 < stage._count) ? (stage._sum / stage._count) : 0);
+
+        stuffAsList->addInt(static_cast<int>(stage._minimum * kMicrosecondsPerSecond));
+        stuffAsList->addInt(static_cast<int>(mean * kMicrosecondsPerSecond));
+        stuffAsList->addInt(static_cast<int>(percentileOfStage(stage, 0.5)));
+        stuffAsList->addInt(static_cast<int>(percentileOfStage(stage, 0.99)));
+        stuffAsList->addInt(static_cast<int>(stage._maximum * kMicrosecondsPerSecond));
+        dictionary.put(tag, stuff);
+    }
+    ODL_EXIT(); //####
+} // addStageToDictionary
+
+/*! @brief Describe the statistics for a stage.
+ @param[in,out] outBuffer The description to be added to.
+ @param[in] name The name of the stage.
+ @param[in] stage The statistics for the stage. */
+static void
+describeStage(std::stringstream &       outBuffer,
+              const char *              name,
+              const FrameLatencyStage & stage)
+{
+    ODL_ENTER(); //####
+    ODL_P2("outBuffer = ", &outBuffer, "stage = ", &stage); //####
+    ODL_S1("name = ", name); //####
+    double mean = ((0 < stage._count) ? (stage._sum / stage._count) : 0);
+
+    outBuffer << name << "\tmin " <<
+                static_cast<int64_t>(stage._minimum * kMicrosecondsPerSecond) << "\tmean " <<
+                static_cast<int64_t>(mean * kMicrosecondsPerSecond) << "\tp50 " <<
+                percentileOfStage(stage, 0.5) << "\tp99 " << percentileOfStage(stage, 0.99) <<
+                "\tmax " << static_cast<int64_t>(stage._maximum * kMicrosecondsPerSecond) <<
+                LINE_END_;
+    ODL_EXIT(); //####
+} // describeStage
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+FrameLatencyTrace::FrameLatencyTrace(void) :
+    _lock(), _frameNumber(0), _arrivalTime(0), _deviceTime(0), _encodedTime(0)
+{
+    ODL_ENTER(); //####
+    clear();
+    ODL_EXIT_P(this); //####
+} // FrameLatencyTrace::FrameLatencyTrace
+
+FrameLatencyTrace::~FrameLatencyTrace(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // FrameLatencyTrace::~FrameLatencyTrace
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+FrameLatencyTrace::addToList(yarp::os::Bottle & counterList,
+                             const YarpString & channel)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counterList = ", &counterList); //####
+    ODL_S1s("channel = ", channel); //####
+    char                 buffer1[DATE_TIME_BUFFER_SIZE_];
+    char                 buffer2[DATE_TIME_BUFFER_SIZE_];
+    yarp::os::Property & props = counterList.addDict();
+
+    Utilities::GetDateAndTime(buffer1, sizeof(buffer1), buffer2, sizeof(buffer2));
+    props.put(MpM_SENDRECEIVE_CHANNEL_, channel);
+    props.put(MpM_SENDRECEIVE_DATE_, buffer1);
+    props.put(MpM_SENDRECEIVE_TIME_, buffer2);
+    _lock.lock();
+    props.put(MpM_LATENCY_FRAMES_, static_cast<int>(_totalStage._count));
+    addStageToDictionary(props, MpM_LATENCY_DEVICE_, _deviceStage);
+    addStageToDictionary(props, MpM_LATENCY_ENCODE_, _encodeStage);
+    addStageToDictionary(props, MpM_LATENCY_WRITE_, _writeStage);
+    addStageToDictionary(props, MpM_LATENCY_TOTAL_, _totalStage);
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // FrameLatencyTrace::addToList
+
+void
+FrameLatencyTrace::addToMessage(yarp::os::Bottle & message)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    yarp::os::Bottle & timing = message.addList();
+
+    timing.addString(MpM_LATENCY_MESSAGE_TAG_);
+    timing.addInt(static_cast<int>(_frameNumber));
+    timing.addDouble(_deviceTime);
+    timing.addDouble(_arrivalTime);
+    timing.addDouble(_encodedTime);
+    ODL_OBJEXIT(); //####
+} // FrameLatencyTrace::addToMessage
+
+void
+FrameLatencyTrace::clear(void)
+{
+    ODL_OBJENTER(); //####
+    _lock.lock();
+    clearStage(_deviceStage);
+    clearStage(_encodeStage);
+    clearStage(_writeStage);
+    clearStage(_totalStage);
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // FrameLatencyTrace::clear
+
+void
+FrameLatencyTrace::frameArrived(const int64_t frameNumber,
+                                const double  frameAge)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("frameNumber = ", frameNumber); //####
+    ODL_D1("frameAge = ", frameAge); //####
+    _frameNumber = frameNumber;
+    _arrivalTime = _encodedTime = yarp::os::Time::now();
+    _deviceTime = _arrivalTime - frameAge;
+    ODL_OBJEXIT(); //####
+} // FrameLatencyTrace::frameArrived
+
+void
+FrameLatencyTrace::frameEncoded(void)
+{
+    ODL_OBJENTER(); //####
+    _encodedTime = yarp::os::Time::now();
+    ODL_OBJEXIT(); //####
+} // FrameLatencyTrace::frameEncoded
+
+void
+FrameLatencyTrace::frameWritten(void)
+{
+    ODL_OBJENTER(); //####
+    double writtenTime = yarp::os::Time::now();
+
+    _lock.lock();
+    addSample(_deviceStage, _arrivalTime - _deviceTime);
+    addSample(_encodeStage, _encodedTime - _arrivalTime);
+    addSample(_writeStage, writtenTime - _encodedTime);
+    addSample(_totalStage, writtenTime - _deviceTime);
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // FrameLatencyTrace::frameWritten
+
+YarpString
+FrameLatencyTrace::report(void)
+{
+    ODL_OBJENTER(); //####
+    std::stringstream outBuffer;
+
+    _lock.lock();
+    outBuffer << "latency (microseconds) for " << _totalStage._count << " frames" << LINE_END_;
+    describeStage(outBuffer, MpM_LATENCY_DEVICE_, _deviceStage);
+    describeStage(outBuffer, MpM_LATENCY_ENCODE_, _encodeStage);
+    describeStage(outBuffer, MpM_LATENCY_WRITE_, _writeStage);
+    describeStage(outBuffer, MpM_LATENCY_TOTAL_, _totalStage);
+    _lock.unlock();
+    YarpString result(outBuffer.str());
+
+    ODL_OBJEXIT_s(result); //####
+    return result;
+} // FrameLatencyTrace::report
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,228 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mFrameLatencyTrace.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for tracing the latency of frames from a device.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMFrameLatencyTrace_HPP_))
+# define MpMFrameLatencyTrace_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for tracing the latency of frames from a device. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The number of buckets used to record the distribution of the latency of a stage; the
+ buckets are powers of two of microseconds. */
+# define FRAME_LATENCY_BUCKET_COUNT_ 25
+
+/*! @brief The metrics key for the number of frames that were traced. */
+# define MpM_LATENCY_FRAMES_         "frames"
+
+/*! @brief The metrics key for the time from the device producing a frame to the frame arriving. */
+# define MpM_LATENCY_DEVICE_         "device"
+
+/*! @brief The metrics key for the time from a frame arriving to the frame being encoded. */
+# define MpM_LATENCY_ENCODE_         "encode"
+
+/*! @brief The metrics key for the time from a frame being encoded to the frame being written. */
+# define MpM_LATENCY_WRITE_          "write"
+
+/*! @brief The metrics key for the time from the device producing a frame to the frame being
+ written. */
+# define MpM_LATENCY_TOTAL_          "total"
+
+/*! @brief The tag at the start of the timing information that is added to a message. */
+# define MpM_LATENCY_MESSAGE_TAG_    "latency"
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief The distribution of the time taken by a stage of the handling of frames. */
+        struct FrameLatencyStage
+        {
+            /*! @brief The number of frames in each bucket; bucket N holds times less than 2^N
+             microseconds. */
+            int64_t _buckets[FRAME_LATENCY_BUCKET_COUNT_];
+
+            /*! @brief The number of frames. */
+            int64_t _count;
+
+            /*! @brief The longest time, in seconds. */
+            double _maximum;
+
+            /*! @brief The shortest time, in seconds. */
+            double _minimum;
+
+            /*! @brief The sum of the times, in seconds. */
+            double _sum;
+
+        }; // FrameLatencyStage
+
+        /*! @brief A record of the time taken by each stage of the handling of frames from a
+         device.
+
+         A frame passes through three stages: from the device to the service, through the SDK;
+         from its arrival to its encoding as a message; and from its encoding to its write to the
+         output channel. The time at which the device produced a frame is derived from the age of
+         the frame, as reported by the SDK, so that the clocks of the device and the service need
+         not agree.
+
+         The frame times are only updated by the thread that handles the frames; the statistics
+         can be retrieved from any thread. */
+        class FrameLatencyTrace
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            FrameLatencyTrace(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~FrameLatencyTrace(void);
+
+            /*! @brief Add the statistics to a list of metrics.
+
+             Each stage is reported as a list of the shortest, mean, median, 99th percentile and
+             longest times, in microseconds; the percentiles are the bounds of the buckets that
+             contain them.
+             @param[in,out] counterList The list to be added to.
+             @param[in] channel The name of the channel that the frames are written to. */
+            void
+            addToList(yarp::os::Bottle & counterList,
+                      const YarpString & channel);
+
+            /*! @brief Add the timing of the current frame to a message.
+
+             The timing is added as a list of the tag MpM_LATENCY_MESSAGE_TAG_, the frame number and
+             the times, in seconds, at which the frame was produced, arrived and was encoded.
+             @param[in,out] message The message to be extended. */
+            void
+            addToMessage(yarp::os::Bottle & message)
+            const;
+
+            /*! @brief Discard the statistics. */
+            void
+            clear(void);
+
+            /*! @brief Record the arrival of a frame from the device.
+             @param[in] frameNumber The number of the frame, as reported by the device.
+             @param[in] frameAge The time, in seconds, since the device produced the frame. */
+            void
+            frameArrived(const int64_t frameNumber,
+                         const double  frameAge);
+
+            /*! @brief Record the encoding of the current frame. */
+            void
+            frameEncoded(void);
+
+            /*! @brief Record the write of the current frame and update the statistics. */
+            void
+            frameWritten(void);
+
+            /*! @brief Return a description of the statistics.
+             @returns A description of the statistics, with one line for each stage. */
+            YarpString
+            report(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            FrameLatencyTrace(const FrameLatencyTrace & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            FrameLatencyTrace &
+            operator =(const FrameLatencyTrace & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock for the statistics. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The time taken from the device producing a frame to its arrival. */
+            FrameLatencyStage _deviceStage;
+
+            /*! @brief The time taken from the arrival of a frame to its encoding. */
+            FrameLatencyStage _encodeStage;
+
+            /*! @brief The time taken from the encoding of a frame to its write. */
+            FrameLatencyStage _writeStage;
+
+            /*! @brief The time taken from the device producing a frame to its write. */
+            FrameLatencyStage _totalStage;
+
+            /*! @brief The number of the current frame. */
+            int64_t _frameNumber;
+
+            /*! @brief The time at which the current frame arrived. */
+            double _arrivalTime;
+
+            /*! @brief The time at which the device produced the current frame. */
+            double _deviceTime;
+
+            /*! @brief The time at which the current frame was encoded. */
+            double _encodedTime;
+
+        }; // FrameLatencyTrace
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMFrameLatencyTrace_HPP_)
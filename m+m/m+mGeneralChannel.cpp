@@ -39,6 +39,9 @@
 #include "m+mGeneralChannel.hpp"
 
 #include <m+m/m+mBailOut.hpp>
+#include <m+m/m+mBaseInputHandler.hpp>
+#include <m+m/m+mMulticastReceiver.hpp>
+#include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -77,12 +80,76 @@ using namespace MplusM::Common;
 # pragma mark Class methods
 #endif // defined(__APPLE__)
 
+bool
+GeneralChannel::ParseMulticastGroup(const YarpString & group,
+                                    YarpString &       address,
+                                    int &              port)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("group = ", group); //####
+    ODL_P2("address = ", &address, "port = ", &port); //####
+    bool   result = false;
+    size_t colonPos = group.rfind(":");
+
+    if ((YarpString::npos != colonPos) && (0 < colonPos))
+    {
+        YarpString   portPart(group.substr(colonPos + 1));
+        const char * startPtr = portPart.c_str();
+        char *       endPtr;
+        int          aPort = static_cast<int>(strtol(startPtr, &endPtr, 10));
+
+        if ((startPtr != endPtr) && (! *endPtr) && Utilities::ValidPortNumber(aPort))
+        {
+            address = group.substr(0, colonPos);
+            port = aPort;
+            result = true;
+        }
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // GeneralChannel::ParseMulticastGroup
+
+bool
+GeneralChannel::ParseOutputQueuePolicy(const YarpString &  policyName,
+                                       OutputQueuePolicy & policy)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("policyName = ", policyName); //####
+    ODL_P1("policy = ", &policy); //####
+    bool result = true;
+
+    if (policyName == "block")
+    {
+        policy = kOutputQueuePolicyBlock;
+    }
+    else if (policyName == "conflate")
+    {
+        policy = kOutputQueuePolicyConflate;
+    }
+    else if (policyName == "newest")
+    {
+        policy = kOutputQueuePolicyDropNewest;
+    }
+    else if (policyName == "oldest")
+    {
+        policy = kOutputQueuePolicyDropOldest;
+    }
+    else
+    {
+        result = false;
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // GeneralChannel::ParseOutputQueuePolicy
+
 #if defined(__APPLE__)
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
 
 GeneralChannel::GeneralChannel(const bool isOutput) :
-    inherited(), _protocol(), _protocolDescription(), _isOutput(isOutput)
+    inherited(), _protocol(), _protocolDescription(), _batcher(NULL), _multicastReceiver(NULL),
+    _multicastSender(NULL), _outputQueue(NULL), _pipelineLink(NULL), _inputHandler(NULL),
+    _isOutput(isOutput)
 {
     ODL_ENTER(); //####
     ODL_B1("isOutput = ", isOutput); //####
@@ -92,6 +159,11 @@ GeneralChannel::GeneralChannel(const bool isOutput) :
 GeneralChannel::~GeneralChannel(void)
 {
     ODL_OBJENTER(); //####
+    stopMulticast();
+    stopPipelineLink();
+    // The batcher writes its waiting messages through the output queue, if there is one.
+    stopBatching();
+    stopOutputQueue();
     ODL_OBJEXIT(); //####
 } // GeneralChannel::~GeneralChannel
 
@@ -99,6 +171,258 @@ GeneralChannel::~GeneralChannel(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+bool
+GeneralChannel::dispatchMessage(yarp::os::Bottle & message,
+                                const bool         countSend)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    ODL_B1("countSend = ", countSend); //####
+    bool result = true;
+
+    if (_multicastSender)
+    {
+        result = _multicastSender->send(message);
+    }
+    if (_pipelineLink)
+    {
+        result = (_pipelineLink->post(message) && result);
+    }
+    // A linked or multicast channel is only written to if something outside the process is
+    // connected to it.
+    if (((! _pipelineLink) && (! _multicastSender)) || (0 < getOutputCount()))
+    {
+        // The message batcher and the output queue update the send counters when they write
+        // the message, whether or not the send is to be counted here.
+        if (_batcher)
+        {
+            result = (_batcher->post(message) && result);
+        }
+        else if (_outputQueue)
+        {
+            result = (_outputQueue->post(message) && result);
+        }
+        else if (countSend)
+        {
+            result = (inherited::writeBottle(message) && result);
+        }
+        else
+        {
+            size_t messageSize;
+            size_t uncompressedSize;
+
+            result = (writeWithCompression(message, messageSize, uncompressedSize) && result);
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::dispatchMessage
+
+bool
+GeneralChannel::getBatchCounters(MessageBatchCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    bool result = (NULL != _batcher);
+
+    if (result)
+    {
+        _batcher->getCounters(counters);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::getBatchCounters
+
+bool
+GeneralChannel::getMulticastCounters(MulticastCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    bool result = true;
+
+    if (_multicastSender)
+    {
+        _multicastSender->getCounters(counters);
+    }
+    else if (_multicastReceiver)
+    {
+        _multicastReceiver->getCounters(counters);
+    }
+    else
+    {
+        result = false;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::getMulticastCounters
+
+bool
+GeneralChannel::getOutputQueueCounters(OutputQueueCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    bool result = (NULL != _outputQueue);
+
+    if (result)
+    {
+        _outputQueue->getCounters(counters);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::getOutputQueueCounters
+
+bool
+GeneralChannel::getPipelineLinkCounters(PipelineLinkCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    bool result = (NULL != _pipelineLink);
+
+    if (result)
+    {
+        _pipelineLink->getCounters(counters);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::getPipelineLinkCounters
+
+YarpString
+GeneralChannel::multicastGroup(void)
+const
+{
+    ODL_OBJENTER(); //####
+    YarpString        result;
+    std::stringstream buff;
+
+    if (_multicastSender)
+    {
+        buff << _multicastSender->address().c_str() << ":" << _multicastSender->port();
+    }
+    else if (_multicastReceiver)
+    {
+        buff << _multicastReceiver->address().c_str() << ":" << _multicastReceiver->port();
+    }
+    result = buff.str();
+    ODL_OBJEXIT_s(result); //####
+    return result;
+} // GeneralChannel::multicastGroup
+
+bool
+GeneralChannel::setBatching(const size_t maximumBytes,
+                            const double maximumDelay)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("maximumBytes = ", maximumBytes); //####
+    ODL_D1("maximumDelay = ", maximumDelay); //####
+    bool result = true;
+
+    stopBatching();
+    if (0 < maximumBytes)
+    {
+        _batcher = new MessageBatchThread(*this, maximumBytes, maximumDelay);
+        if (! _batcher->start())
+        {
+            ODL_LOG("(! _batcher->start())"); //####
+            delete _batcher;
+            _batcher = NULL;
+            result = false;
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::setBatching
+
+bool
+GeneralChannel::setMulticastGroup(const YarpString & address,
+                                  const int          port,
+                                  const bool         latestOnly)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("address = ", address); //####
+    ODL_LL1("port = ", port); //####
+    ODL_B1("latestOnly = ", latestOnly); //####
+    bool result = true;
+
+    stopMulticast();
+    if (0 < address.length())
+    {
+        if (_isOutput)
+        {
+            _multicastSender = new MulticastSender;
+            if (! _multicastSender->open(address, port))
+            {
+                ODL_LOG("(! _multicastSender->open(address, port))"); //####
+                delete _multicastSender;
+                _multicastSender = NULL;
+                result = false;
+            }
+        }
+        else
+        {
+            _multicastReceiver = new MulticastReceiver(*this, address, port, latestOnly);
+            if (! _multicastReceiver->start())
+            {
+                ODL_LOG("(! _multicastReceiver->start())"); //####
+                delete _multicastReceiver;
+                _multicastReceiver = NULL;
+                result = false;
+            }
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::setMulticastGroup
+
+bool
+GeneralChannel::setOutputQueue(const size_t            capacity,
+                               const OutputQueuePolicy policy)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL2("capacity = ", capacity, "policy = ", policy); //####
+    bool result = true;
+
+    stopOutputQueue();
+    if (0 < capacity)
+    {
+        _outputQueue = new OutputQueueThread(*this, capacity, policy);
+        if (! _outputQueue->start())
+        {
+            ODL_LOG("(! _outputQueue->start())"); //####
+            delete _outputQueue;
+            _outputQueue = NULL;
+            result = false;
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::setOutputQueue
+
+bool
+GeneralChannel::setPipelineLink(GeneralChannel * destination,
+                                const size_t     capacity,
+                                const int        core)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("destination = ", destination); //####
+    ODL_LL2("capacity = ", capacity, "core = ", core); //####
+    bool result = true;
+
+    stopPipelineLink();
+    if (destination)
+    {
+        _pipelineLink = new PipelineLinkThread(*this, *destination, capacity, core);
+        if (! _pipelineLink->start())
+        {
+            ODL_LOG("(! _pipelineLink->start())"); //####
+            delete _pipelineLink;
+            _pipelineLink = NULL;
+            result = false;
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::setPipelineLink
+
 void
 GeneralChannel::setProtocol(const YarpString & newProtocol,
                             const YarpString & description)
@@ -110,6 +434,156 @@ GeneralChannel::setProtocol(const YarpString & newProtocol,
     ODL_OBJEXIT(); //####
 } // GeneralChannel::setProtocol
 
+void
+GeneralChannel::setReader(yarp::os::PortReader & reader)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("reader = ", &reader); //####
+    _inputHandler = dynamic_cast<BaseInputHandler *>(&reader);
+    inherited::setReader(reader);
+    ODL_OBJEXIT(); //####
+} // GeneralChannel::setReader
+
+void
+GeneralChannel::stopBatching(void)
+{
+    ODL_OBJENTER(); //####
+    if (_batcher)
+    {
+        _batcher->stop();
+        delete _batcher;
+        _batcher = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // GeneralChannel::stopBatching
+
+void
+GeneralChannel::stopMulticast(void)
+{
+    ODL_OBJENTER(); //####
+    if (_multicastReceiver)
+    {
+        _multicastReceiver->stop();
+        delete _multicastReceiver;
+        _multicastReceiver = NULL;
+    }
+    if (_multicastSender)
+    {
+        delete _multicastSender;
+        _multicastSender = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // GeneralChannel::stopMulticast
+
+void
+GeneralChannel::stopOutputQueue(void)
+{
+    ODL_OBJENTER(); //####
+    if (_outputQueue)
+    {
+        _outputQueue->stop();
+        delete _outputQueue;
+        _outputQueue = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // GeneralChannel::stopOutputQueue
+
+void
+GeneralChannel::stopPipelineLink(void)
+{
+    ODL_OBJENTER(); //####
+    if (_pipelineLink)
+    {
+        _pipelineLink->stop();
+        delete _pipelineLink;
+        _pipelineLink = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // GeneralChannel::stopPipelineLink
+
+bool
+GeneralChannel::write(yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool result = dispatchMessage(message, false);
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::write
+
+bool
+GeneralChannel::write(yarp::os::PortWriter & writer)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("writer = ", &writer); //####
+    bool result;
+
+    if (writesDirectly())
+    {
+        result = inherited::write(writer);
+    }
+    else
+    {
+        ODL_LOG("! (writesDirectly())"); //####
+        result = false;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::write
+
+bool
+GeneralChannel::writeBottle(yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool result = dispatchMessage(message, true);
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::writeBottle
+
+bool
+GeneralChannel::writeFrame(yarp::os::Bottle & frame,
+                           const size_t       messageCount)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("frame = ", &frame); //####
+    ODL_LL1("messageCount = ", messageCount); //####
+    bool result;
+
+    if (_outputQueue)
+    {
+        result = _outputQueue->post(frame);
+    }
+    else
+    {
+        result = inherited::writeBottle(frame);
+    }
+    // The frame is counted as a single message, so the rest of the messages in it are added.
+    if (result)
+    {
+        for (size_t ii = 1; messageCount > ii; ++ii)
+        {
+            updateSendCounters(0);
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::writeFrame
+
+bool
+GeneralChannel::writesDirectly(void)
+const
+{
+    ODL_OBJENTER(); //####
+    bool result = ((! _batcher) && (! _multicastSender) && (! _outputQueue) && (! _pipelineLink) &&
+                   (kCompressionMethodNone == compressionMethod()));
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::writesDirectly
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
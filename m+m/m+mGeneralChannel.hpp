@@ -40,6 +40,10 @@
 # define MpMGeneralChannel_HPP_ /* Header guard */
 
 # include <m+m/m+mBaseChannel.hpp>
+# include <m+m/m+mMessageBatchThread.hpp>
+# include <m+m/m+mMulticastSender.hpp>
+# include <m+m/m+mOutputQueueThread.hpp>
+# include <m+m/m+mPipelineLinkThread.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -52,10 +56,81 @@
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
 
+/*! @brief The metrics key for the number of messages that were written on their own because the
+ channel had been idle. */
+# define MpM_BATCH_DIRECT_          "batchDirect"
+
+/*! @brief The metrics key for the number of batched messages that could not be written. */
+# define MpM_BATCH_FAILED_          "batchFailed"
+
+/*! @brief The metrics key for the number of batches that were written. */
+# define MpM_BATCH_FRAMES_          "batchFrames"
+
+/*! @brief The metrics key for the number of messages that were written as part of a batch. */
+# define MpM_BATCH_MESSAGES_        "batchMessages"
+
+/*! @brief The metrics key for the number of compressed messages that could not be restored. */
+# define MpM_DECOMPRESS_FAILED_     "decompressFailed"
+
+/*! @brief The metrics key for the number of messages that could not be sent to the multicast
+ group. */
+# define MpM_MULTICAST_FAILED_      "multicastFailed"
+
+/*! @brief The metrics key for the number of messages from the multicast group that arrived after a
+ later message. */
+# define MpM_MULTICAST_LATE_        "multicastLate"
+
+/*! @brief The metrics key for the number of messages from the multicast group that never
+ arrived. */
+# define MpM_MULTICAST_LOST_        "multicastLost"
+
+/*! @brief The metrics key for the number of messages received from the multicast group. */
+# define MpM_MULTICAST_RECEIVED_    "multicastReceived"
+
+/*! @brief The metrics key for the number of messages sent to the multicast group. */
+# define MpM_MULTICAST_SENT_        "multicastSent"
+
+/*! @brief The metrics key for the number of messages from the multicast group that were discarded
+ because a newer message was waiting. */
+# define MpM_MULTICAST_SUPERSEDED_  "multicastSuperseded"
+
+/*! @brief The metrics key for the number of messages waiting in the output queue. */
+# define MpM_OUTPUTQUEUE_DEPTH_     "queueDepth"
+
+/*! @brief The metrics key for the number of messages discarded because the output queue was
+ full. */
+# define MpM_OUTPUTQUEUE_DROPPED_   "queueDropped"
+
+/*! @brief The metrics key for the number of queued messages that could not be written. */
+# define MpM_OUTPUTQUEUE_FAILED_    "queueFailed"
+
+/*! @brief The metrics key for the largest number of messages that have been waiting in the output
+ queue. */
+# define MpM_OUTPUTQUEUE_MAXDEPTH_  "queueMaxDepth"
+
+/*! @brief The metrics key for the number of messages passed to an input handler in the same
+ process. */
+# define MpM_PIPELINE_DELIVERED_    "pipelineDelivered"
+
+/*! @brief The metrics key for the number of messages waiting to be passed to an input handler in
+ the same process. */
+# define MpM_PIPELINE_DEPTH_        "pipelineDepth"
+
+/*! @brief The metrics key for the number of messages that waited for room to be passed to an input
+ handler in the same process. */
+# define MpM_PIPELINE_STALLS_       "pipelineStalls"
+
+/*! @brief The metrics key for the number of messages that had no input handler in the same process
+ to be passed to. */
+# define MpM_PIPELINE_UNHANDLED_    "pipelineUnhandled"
+
 namespace MplusM
 {
     namespace Common
     {
+        class BaseInputHandler;
+        class MulticastReceiver;
+
         /*! @brief A convenience class to provide distinct channels to and from adapters. */
         class GeneralChannel : public BaseChannel
         {
@@ -80,6 +155,41 @@ namespace MplusM
             virtual
             ~GeneralChannel(void);
 
+            /*! @brief Retrieve the activity of the message batcher.
+             @param[out] counters The activity of the message batcher.
+             @returns @c true if the channel batches its messages and @c false otherwise. */
+            bool
+            getBatchCounters(MessageBatchCounters & counters);
+
+            /*! @brief Returns the input handler that is connected to the channel.
+             @returns The input handler that is connected to the channel, or @c NULL if there is
+             none or it is not an m+m input handler. */
+            inline BaseInputHandler *
+            getInputHandler(void)
+            const
+            {
+                return _inputHandler;
+            } // getInputHandler
+
+            /*! @brief Retrieve the activity of the multicast group that the channel sends to or
+             receives from.
+             @param[out] counters The activity of the multicast group.
+             @returns @c true if the channel uses a multicast group and @c false otherwise. */
+            bool
+            getMulticastCounters(MulticastCounters & counters);
+
+            /*! @brief Retrieve the activity of the output queue.
+             @param[out] counters The activity of the output queue.
+             @returns @c true if the channel has an output queue and @c false otherwise. */
+            bool
+            getOutputQueueCounters(OutputQueueCounters & counters);
+
+            /*! @brief Retrieve the activity of the link to an input channel in the same process.
+             @param[out] counters The activity of the link.
+             @returns @c true if the channel has a link and @c false otherwise. */
+            bool
+            getPipelineLinkCounters(PipelineLinkCounters & counters);
+
             /*! @brief Returns @c true if the channel is used for output and @c false otherwise.
              @returns @c true if the channel is used for output and @c false otherwise. */
             inline bool
@@ -89,6 +199,13 @@ namespace MplusM
                 return _isOutput;
             } // isOutput
 
+            /*! @brief Returns the multicast group that the channel sends to or receives from.
+             @returns The multicast group, as 'address:port', or an empty string if the channel
+             does not use a multicast group. */
+            YarpString
+            multicastGroup(void)
+            const;
+
             /*! @brief Returns the protocol associated with the channel.
              @returns The protocol associated with the channel. */
             inline const YarpString &
@@ -107,6 +224,91 @@ namespace MplusM
                 return _protocolDescription;
             } // protocolDescription
 
+            /*! @brief Split the name of a multicast group into its address and port.
+             @param[in] group The name of the multicast group, as 'address:port'.
+             @param[out] address The IPv4 address of the multicast group.
+             @param[out] port The UDP port of the multicast group.
+             @returns @c true if the name was valid and @c false otherwise. */
+            static bool
+            ParseMulticastGroup(const YarpString & group,
+                                YarpString &       address,
+                                int &              port);
+
+            /*! @brief Convert the name of an output queue policy to the policy.
+             @param[in] policyName The name of the policy, which is one of 'block', 'conflate',
+             'oldest' or 'newest'.
+             @param[out] policy The policy.
+             @returns @c true if the name was recognized and @c false otherwise. */
+            static bool
+            ParseOutputQueuePolicy(const YarpString &  policyName,
+                                   OutputQueuePolicy & policy);
+
+            /*! @brief Gather the small messages written to the channel into batches, or write
+             each message on its own.
+
+             A message is written at once if the channel has been idle for the batching delay, so
+             batching only adds latency when messages are being written faster than that. Only
+             the messages written to the channel itself are batched; the messages sent to a
+             multicast group or a linked input channel are not. This should not be called while
+             other threads are writing to the channel.
+             @param[in] maximumBytes The serialized size at which a batch is written, or zero if
+             the messages are to be written on their own.
+             @param[in] maximumDelay The longest time, in seconds, that a message can wait in a
+             batch.
+             @returns @c true if the batching mode was set and @c false otherwise. */
+            bool
+            setBatching(const size_t maximumBytes,
+                        const double maximumDelay);
+
+            /*! @brief Send the messages written to an output channel to a multicast group, or
+             pass the messages sent to a multicast group to the input handler of an input channel.
+
+             An output channel serializes each message once and sends it to the group, no matter
+             how many receivers have joined; the message is still written to the channel if
+             anything is connected to it. An input channel joins the group and passes the messages
+             to its input handler from a separate thread. This should not be called while other
+             threads are writing to the channel.
+             @param[in] address The IPv4 address of the multicast group, or an empty string if the
+             channel is to stop using a multicast group.
+             @param[in] port The UDP port of the multicast group.
+             @param[in] latestOnly For an input channel, @c true if a message is to be discarded
+             when a newer one is waiting and @c false if every message is to be passed on.
+             @returns @c true if the multicast group was set up or removed and @c false
+             otherwise. */
+            bool
+            setMulticastGroup(const YarpString & address,
+                              const int          port,
+                              const bool         latestOnly = false);
+
+            /*! @brief Write messages to the channel from a separate thread, through a bounded
+             queue, or directly from the calling thread.
+
+             This should not be called while other threads are writing to the channel.
+             @param[in] capacity The maximum number of messages that can be waiting, or zero if
+             the messages are to be written directly.
+             @param[in] policy What to do with a message when the queue is full.
+             @returns @c true if the output mode was set and @c false otherwise. */
+            bool
+            setOutputQueue(const size_t            capacity,
+                           const OutputQueuePolicy policy);
+
+            /*! @brief Pass the messages written to the channel directly to the input handler of an
+             input channel in the same process, from a separate thread.
+
+             The messages are still written to the channel if anything outside the process is
+             connected to it. This should not be called while other threads are writing to the
+             channel, and the link must be removed before the input channel is closed.
+             @param[in] destination The input channel whose handler will receive the messages, or
+             @c NULL if the link is to be removed.
+             @param[in] capacity The maximum number of messages that can be waiting.
+             @param[in] core The processor core for the thread that calls the input handler, or a
+             negative number if the thread is not to be bound to a core.
+             @returns @c true if the link was set up or removed and @c false otherwise. */
+            bool
+            setPipelineLink(GeneralChannel * destination,
+                            const size_t     capacity,
+                            const int        core);
+
             /*! @brief Sets the protocol associated with the channel.
              @param[in] newProtocol The new protocol associated with the channel.
              @param[in] description The description of the new protocol. */
@@ -114,6 +316,61 @@ namespace MplusM
             setProtocol(const YarpString & newProtocol,
                         const YarpString & description);
 
+            /*! @brief Set the object that processes the messages arriving on the channel.
+             @param[in] reader The object that processes the messages. */
+            virtual void
+            setReader(yarp::os::PortReader & reader);
+
+            using inherited::write;
+
+            /*! @brief Write a message to the channel, through the message batcher or the output
+             queue if there is one, and to the linked input channel if there is one.
+             @param[in] message The message to write.
+             @returns @c true if the message was sent, queued or discarded by the queue policy and
+             @c false otherwise. */
+            bool
+            write(yarp::os::Bottle & message);
+
+            /*! @brief Write an object other than a bottle to the channel.
+
+             Such objects can't be batched, queued, compressed or passed on to a multicast group
+             or a linked input channel, so they are only written if the channel writes directly;
+             otherwise, the object should be written as a bottle.
+             @param[in] writer The object to write.
+             @returns @c true if the object was sent and @c false if it could not be sent or the
+             channel does not write directly. */
+            bool
+            write(yarp::os::PortWriter & writer);
+
+            using inherited::writeBottle;
+
+            /*! @brief Write a message to the channel, through the message batcher or the output
+             queue if there is one, and to the linked input channel if there is one, and update the
+             send counters.
+             @param[in] message The message to write.
+             @returns @c true if the message was sent, queued or discarded by the queue policy and
+             @c false otherwise. */
+            bool
+            writeBottle(yarp::os::Bottle & message);
+
+            /*! @brief Write a message or a batch of messages from the message batcher to the
+             channel, through the output queue if there is one, and update the send counters.
+             @param[in] frame The message or batch of messages to write.
+             @param[in] messageCount The number of messages in the frame.
+             @returns @c true if the frame was sent, queued or discarded by the queue policy and
+             @c false otherwise. */
+            bool
+            writeFrame(yarp::os::Bottle & frame,
+                       const size_t       messageCount);
+
+            /*! @brief Returns @c true if the messages written to the channel go straight to the
+             port.
+             @returns @c true if the channel has no multicast group, linked input channel, message
+             batcher, output queue or compression and @c false otherwise. */
+            bool
+            writesDirectly(void)
+            const;
+
         protected :
 
         private :
@@ -128,6 +385,37 @@ namespace MplusM
             GeneralChannel &
             operator =(const GeneralChannel & other);
 
+            /*! @brief Send a message to the multicast group and the linked input channel if there
+             are any, and write it through the message batcher, the output queue or the port.
+
+             Messages that go through the message batcher or the output queue are always counted
+             when the batch or the queued message is written.
+             @param[in] message The message to send.
+             @param[in] countSend @c true if the send counters are to be updated when the message
+             is written straight to the port and @c false otherwise.
+             @returns @c true if the message was sent, queued or discarded by the queue policy and
+             @c false otherwise. */
+            bool
+            dispatchMessage(yarp::os::Bottle & message,
+                            const bool         countSend);
+
+            /*! @brief Stop the message batcher, writing any messages that are waiting. */
+            void
+            stopBatching(void);
+
+            /*! @brief Stop sending to or receiving from the multicast group. */
+            void
+            stopMulticast(void);
+
+            /*! @brief Stop the output queue, discarding any messages that are waiting. */
+            void
+            stopOutputQueue(void);
+
+            /*! @brief Stop the link to an input channel in the same process, discarding any
+             messages that are waiting. */
+            void
+            stopPipelineLink(void);
+
         public :
 
         protected :
@@ -140,6 +428,29 @@ namespace MplusM
             /*! @brief The description of the protocol that the channel supports. */
             YarpString _protocolDescription;
 
+            /*! @brief The thread that gathers messages into batches, or @c NULL if messages are
+             written on their own. */
+            MessageBatchThread * _batcher;
+
+            /*! @brief The thread that receives the messages sent to a multicast group, or
+             @c NULL if the channel is not an input channel that has joined a group. */
+            MulticastReceiver * _multicastReceiver;
+
+            /*! @brief The object that sends the messages to a multicast group, or @c NULL if the
+             channel is not an output channel that sends to a group. */
+            MulticastSender * _multicastSender;
+
+            /*! @brief The thread that writes the queued messages, or @c NULL if messages are
+             written directly. */
+            OutputQueueThread * _outputQueue;
+
+            /*! @brief The thread that passes messages to an input channel in the same process, or
+             @c NULL if there is no link. */
+            PipelineLinkThread * _pipelineLink;
+
+            /*! @brief The input handler that is connected to the channel, if any. */
+            BaseInputHandler * _inputHandler;
+
             /*! @brief @c true if the channel is used for output and @c false otherwise. */
             bool _isOutput;
 
@@ -0,0 +1,386 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mHeartbeatPacket.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the packets sent by the service heartbeat.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mHeartbeatPacket.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the packets sent by the service heartbeat. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of bytes for each channel, not including the characters of its name. */
+static const size_t kChannelSize = 21;
+
+/*! @brief The flag that is set if the service is active. */
+static const uint8_t kFlagStarted = 0x01;
+
+/*! @brief The flag that is set if some channels were left out of the packet. */
+static const uint8_t kFlagTruncated = 0x02;
+
+/*! @brief The number of bytes in the packet header, not including the characters of the service
+ name. */
+static const size_t kHeaderSize = 13;
+
+/*! @brief The first byte of a heartbeat packet. */
+static const uint8_t kMagic1 = 'M';
+
+/*! @brief The second byte of a heartbeat packet. */
+static const uint8_t kMagic2 = 'H';
+
+/*! @brief The longest name that can be sent. */
+static const size_t kMaximumNameLength = 255;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Retrieve a name from a packet.
+ @param[in] buffer The packet.
+ @param[in] length The number of bytes in the packet.
+ @param[in,out] position The offset of the name in the packet.
+ @param[out] name The name that was retrieved.
+ @returns @c true if the name was complete and @c false otherwise. */
+static bool
+getName(const uint8_t * buffer,
+        const size_t    length,
+        size_t &        position,
+        YarpString &    name)
+{
+    bool okSoFar = false;
+
+    if (length > position)
+    {
+        size_t nameLength = buffer[position];
+
+        if (length >= (position + 1 + nameLength))
+        {
+            name = YarpString(reinterpret_cast<const char *>(buffer + position + 1), nameLength);
+            position += 1 + nameLength;
+            okSoFar = true;
+        }
+    }
+    return okSoFar;
+} // getName
+
+/*! @brief Retrieve a 16-bit value from a packet.
+ @param[in] buffer The packet.
+ @param[in,out] position The offset of the value in the packet.
+ @returns The value that was retrieved. */
+static uint32_t
+getUnsigned16(const uint8_t * buffer,
+              size_t &        position)
+{
+    uint32_t result = ((static_cast<uint32_t>(buffer[position]) << 8) |
+                       static_cast<uint32_t>(buffer[position + 1]));
+
+    position += 2;
+    return result;
+} // getUnsigned16
+
+/*! @brief Retrieve a 32-bit value from a packet.
+ @param[in] buffer The packet.
+ @param[in,out] position The offset of the value in the packet.
+ @returns The value that was retrieved. */
+static uint32_t
+getUnsigned32(const uint8_t * buffer,
+              size_t &        position)
+{
+    uint32_t result = ((static_cast<uint32_t>(buffer[position]) << 24) |
+                       (static_cast<uint32_t>(buffer[position + 1]) << 16) |
+                       (static_cast<uint32_t>(buffer[position + 2]) << 8) |
+                       static_cast<uint32_t>(buffer[position + 3]));
+
+    position += 4;
+    return result;
+} // getUnsigned32
+
+/*! @brief Add a name to a packet.
+ @param[in,out] buffer The packet.
+ @param[in,out] position The offset of the name in the packet.
+ @param[in] name The name to be added. */
+static void
+putName(uint8_t *          buffer,
+        size_t &           position,
+        const YarpString & name)
+{
+    size_t nameLength = std::min(name.length(), kMaximumNameLength);
+
+    buffer[position] = static_cast<uint8_t>(nameLength);
+    memcpy(buffer + position + 1, name.c_str(), nameLength);
+    position += 1 + nameLength;
+} // putName
+
+/*! @brief Add a 16-bit value to a packet.
+ @param[in,out] buffer The packet.
+ @param[in,out] position The offset of the value in the packet.
+ @param[in] value The value to be added. */
+static void
+putUnsigned16(uint8_t *      buffer,
+              size_t &       position,
+              const uint32_t value)
+{
+    buffer[position] = static_cast<uint8_t>(value >> 8);
+    buffer[position + 1] = static_cast<uint8_t>(value);
+    position += 2;
+} // putUnsigned16
+
+/*! @brief Add a 32-bit value to a packet.
+ @param[in,out] buffer The packet.
+ @param[in,out] position The offset of the value in the packet.
+ @param[in] value The value to be added. */
+static void
+putUnsigned32(uint8_t *      buffer,
+              size_t &       position,
+              const uint32_t value)
+{
+    buffer[position] = static_cast<uint8_t>(value >> 24);
+    buffer[position + 1] = static_cast<uint8_t>(value >> 16);
+    buffer[position + 2] = static_cast<uint8_t>(value >> 8);
+    buffer[position + 3] = static_cast<uint8_t>(value);
+    position += 4;
+} // putUnsigned32
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+HeartbeatPacket::HeartbeatPacket(void) :
+    _serviceName(), _channels(), _interval(HEARTBEAT_INTERVAL_), _sequence(0), _started(false),
+    _truncated(false)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // HeartbeatPacket::HeartbeatPacket
+
+HeartbeatPacket::~HeartbeatPacket(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // HeartbeatPacket::~HeartbeatPacket
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+HeartbeatPacket::addChannel(const HeartbeatChannel & channel)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("channel = ", &channel); //####
+    _channels.push_back(channel);
+    ODL_OBJEXIT(); //####
+} // HeartbeatPacket::addChannel
+
+void
+HeartbeatPacket::clear(void)
+{
+    ODL_OBJENTER(); //####
+    _serviceName = "";
+    _channels.clear();
+    _interval = HEARTBEAT_INTERVAL_;
+    _sequence = 0;
+    _started = _truncated = false;
+    ODL_OBJEXIT(); //####
+} // HeartbeatPacket::clear
+
+bool
+HeartbeatPacket::decode(const uint8_t * buffer,
+                        const size_t    length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("buffer = ", buffer); //####
+    ODL_LL1("length = ", length); //####
+    bool okSoFar = false;
+
+    clear();
+    if ((kHeaderSize <= length) && (kMagic1 == buffer[0]) && (kMagic2 == buffer[1]) &&
+        (HEARTBEAT_VERSION_ == buffer[2]))
+    {
+        size_t   position = 4;
+        uint8_t  flags = buffer[3];
+        uint32_t channelCount;
+
+        _started = (0 != (flags & kFlagStarted));
+        _truncated = (0 != (flags & kFlagTruncated));
+        _sequence = getUnsigned32(buffer, position);
+        _interval = (getUnsigned16(buffer, position) / 1000.0);
+        channelCount = getUnsigned16(buffer, position);
+        okSoFar = getName(buffer, length, position, _serviceName);
+        for (uint32_t ii = 0; okSoFar && (channelCount > ii); ++ii)
+        {
+            HeartbeatChannel aChannel;
+
+            if (getName(buffer, length, position, aChannel._name) &&
+                (length >= (position + kChannelSize - 1)))
+            {
+                aChannel._inMessages = getUnsigned32(buffer, position);
+                aChannel._inBytes = getUnsigned32(buffer, position);
+                aChannel._outMessages = getUnsigned32(buffer, position);
+                aChannel._outBytes = getUnsigned32(buffer, position);
+                aChannel._queueDepth = getUnsigned32(buffer, position);
+                _channels.push_back(aChannel);
+            }
+            else
+            {
+                ODL_LOG("! (getName(buffer, length, position, aChannel._name) && " //####
+                        "(length >= (position + kChannelSize - 1)))"); //####
+                okSoFar = false;
+            }
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((kHeaderSize <= length) && (kMagic1 == buffer[0]) && " //####
+                "(kMagic2 == buffer[1]) && (HEARTBEAT_VERSION_ == buffer[2]))"); //####
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // HeartbeatPacket::decode
+
+size_t
+HeartbeatPacket::encode(uint8_t *    buffer,
+                        const size_t bufferSize)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("buffer = ", buffer); //####
+    ODL_LL1("bufferSize = ", bufferSize); //####
+    size_t position = kHeaderSize + std::min(_serviceName.length(), kMaximumNameLength);
+    size_t result = 0;
+
+    if (bufferSize >= position)
+    {
+        size_t   headerPosition = 0;
+        uint32_t channelCount = 0;
+        uint32_t intervalInMilliseconds = static_cast<uint32_t>(_interval * 1000.0);
+        uint8_t  flags = 0;
+
+        _truncated = false;
+        for (size_t ii = 0, mm = _channels.size(); (mm > ii) && (! _truncated); ++ii)
+        {
+            const HeartbeatChannel & aChannel = _channels[ii];
+            size_t                   channelSize = kChannelSize +
+                                                    std::min(aChannel._name.length(),
+                                                             kMaximumNameLength);
+
+            if ((bufferSize >= (position + channelSize)) && (0xFFFF > channelCount))
+            {
+                putName(buffer, position, aChannel._name);
+                putUnsigned32(buffer, position, aChannel._inMessages);
+                putUnsigned32(buffer, position, aChannel._inBytes);
+                putUnsigned32(buffer, position, aChannel._outMessages);
+                putUnsigned32(buffer, position, aChannel._outBytes);
+                putUnsigned32(buffer, position, aChannel._queueDepth);
+                ++channelCount;
+            }
+            else
+            {
+                _truncated = true;
+            }
+        }
+        if (_started)
+        {
+            flags |= kFlagStarted;
+        }
+        if (_truncated)
+        {
+            flags |= kFlagTruncated;
+        }
+        buffer[headerPosition++] = kMagic1;
+        buffer[headerPosition++] = kMagic2;
+        buffer[headerPosition++] = HEARTBEAT_VERSION_;
+        buffer[headerPosition++] = flags;
+        putUnsigned32(buffer, headerPosition, _sequence);
+        putUnsigned16(buffer, headerPosition, std::min(intervalInMilliseconds,
+                                                       static_cast<uint32_t>(0xFFFF)));
+        putUnsigned16(buffer, headerPosition, channelCount);
+        putName(buffer, headerPosition, _serviceName);
+        result = position;
+    }
+    ODL_OBJEXIT_LL(result); //####
+    return result;
+} // HeartbeatPacket::encode
+
+void
+HeartbeatPacket::setHeader(const YarpString & serviceName,
+                           const uint32_t     sequence,
+                           const double       interval,
+                           const bool         started)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("serviceName = ", serviceName); //####
+    ODL_LL1("sequence = ", sequence); //####
+    ODL_D1("interval = ", interval); //####
+    ODL_B1("started = ", started); //####
+    _serviceName = serviceName;
+    _sequence = sequence;
+    _interval = interval;
+    _started = started;
+    ODL_OBJEXIT(); //####
+} // HeartbeatPacket::setHeader
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,275 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mHeartbeatPacket.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the packets sent by the service heartbeat.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMHeartbeatPacket_HPP_))
+# define MpMHeartbeatPacket_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the packets sent by the service heartbeat. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The time, in seconds, between heartbeats. */
+# define HEARTBEAT_INTERVAL_ 1.0
+
+/*! @brief The largest heartbeat packet that will be sent, chosen so that a packet is not
+ fragmented on an Ethernet network. */
+# define HEARTBEAT_MAXIMUM_PACKET_SIZE_ 1400
+
+/*! @brief The number of heartbeat intervals without a packet, after which a service is considered
+ to be unresponsive. */
+# define HEARTBEAT_STALE_INTERVALS_ 3
+
+/*! @brief The version of the heartbeat packet layout. */
+# define HEARTBEAT_VERSION_ 1
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief The activity of a channel since the previous heartbeat. */
+        struct HeartbeatChannel
+        {
+            /*! @brief The name of the channel. */
+            YarpString _name;
+
+            /*! @brief The number of bytes received. */
+            uint32_t _inBytes;
+
+            /*! @brief The number of messages received. */
+            uint32_t _inMessages;
+
+            /*! @brief The number of bytes sent. */
+            uint32_t _outBytes;
+
+            /*! @brief The number of messages sent. */
+            uint32_t _outMessages;
+
+            /*! @brief The number of messages waiting to be sent. */
+            uint32_t _queueDepth;
+
+        }; // HeartbeatChannel
+
+        /*! @brief A sequence of channel activity records. */
+        typedef std::vector<HeartbeatChannel> HeartbeatChannelVector;
+
+        /*! @brief The summary of the activity of a service that is sent as a heartbeat.
+
+         The packet is a compact binary record, in network byte order, so that it can be sent
+         frequently without adding noticeable traffic. It starts with the characters 'M' and 'H',
+         the layout version, a set of flags, the sequence number of the packet, the interval to the
+         next packet in milliseconds, the number of channels and the name of the service. Each
+         channel follows as its name, the number of messages and bytes received and sent since the
+         previous packet, and the depth of its output queue. Names are sent as a length byte
+         followed by the characters, without a terminator. Channels that do not fit in
+         HEARTBEAT_MAXIMUM_PACKET_SIZE_ bytes are left out and the packet is marked as truncated.
+         */
+        class HeartbeatPacket
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            HeartbeatPacket(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~HeartbeatPacket(void);
+
+            /*! @brief Add the activity of a channel to the packet.
+             @param[in] channel The activity of the channel. */
+            void
+            addChannel(const HeartbeatChannel & channel);
+
+            /*! @brief Return the activity of the channels in the packet.
+             @returns The activity of the channels in the packet. */
+            inline const HeartbeatChannelVector &
+            channels(void)
+            const
+            {
+                return _channels;
+            } // channels
+
+            /*! @brief Discard the contents of the packet. */
+            void
+            clear(void);
+
+            /*! @brief Set the packet from the bytes that were received.
+             @param[in] buffer The bytes that were received.
+             @param[in] length The number of bytes that were received.
+             @returns @c true if the bytes were a valid heartbeat packet and @c false
+             otherwise. */
+            bool
+            decode(const uint8_t * buffer,
+                   const size_t    length);
+
+            /*! @brief Convert the packet to the bytes to be sent.
+             @param[out] buffer The bytes to be sent.
+             @param[in] bufferSize The number of bytes available in the buffer.
+             @returns The number of bytes to be sent, or zero if the buffer is too small to hold
+             the packet header. */
+            size_t
+            encode(uint8_t *    buffer,
+                   const size_t bufferSize);
+
+            /*! @brief Return the time, in seconds, until the next packet.
+             @returns The time, in seconds, until the next packet. */
+            inline double
+            interval(void)
+            const
+            {
+                return _interval;
+            } // interval
+
+            /*! @brief Return @c true if the service is active.
+             @returns @c true if the service is active and @c false otherwise. */
+            inline bool
+            isStarted(void)
+            const
+            {
+                return _started;
+            } // isStarted
+
+            /*! @brief Return the sequence number of the packet.
+             @returns The sequence number of the packet. */
+            inline uint32_t
+            sequence(void)
+            const
+            {
+                return _sequence;
+            } // sequence
+
+            /*! @brief Return the name of the service that sent the packet.
+             @returns The name of the service that sent the packet. */
+            inline const YarpString &
+            serviceName(void)
+            const
+            {
+                return _serviceName;
+            } // serviceName
+
+            /*! @brief Set the values that describe the service.
+             @param[in] serviceName The name of the service.
+             @param[in] sequence The sequence number of the packet.
+             @param[in] interval The time, in seconds, until the next packet.
+             @param[in] started @c true if the service is active and @c false otherwise. */
+            void
+            setHeader(const YarpString & serviceName,
+                      const uint32_t     sequence,
+                      const double       interval,
+                      const bool         started);
+
+            /*! @brief Return @c true if some channels were left out of the packet.
+             @returns @c true if some channels were left out of the packet and @c false
+             otherwise. */
+            inline bool
+            wasTruncated(void)
+            const
+            {
+                return _truncated;
+            } // wasTruncated
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            HeartbeatPacket(const HeartbeatPacket & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            HeartbeatPacket &
+            operator =(const HeartbeatPacket & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The name of the service that sent the packet. */
+            YarpString _serviceName;
+
+            /*! @brief The activity of the channels of the service. */
+            HeartbeatChannelVector _channels;
+
+            /*! @brief The time, in seconds, until the next packet. */
+            double _interval;
+
+            /*! @brief The sequence number of the packet. */
+            uint32_t _sequence;
+
+            /*! @brief @c true if the service is active and @c false otherwise. */
+            bool _started;
+
+            /*! @brief @c true if some channels were left out of the packet and @c false
+             otherwise. */
+            bool _truncated;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[2];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // HeartbeatPacket
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMHeartbeatPacket_HPP_)
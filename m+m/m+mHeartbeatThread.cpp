@@ -0,0 +1,302 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+mHeartbeatThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a thread that sends service heartbeats.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mHeartbeatThread.hpp"
+
+#include <m+m/m+mBaseService.hpp>
+#include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mGeneralChannel.hpp>
+#include <m+m/m+mHeartbeatPacket.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a thread that sends service heartbeats. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The largest change in a counter that can be sent. */
+static const int64_t kMaximumDelta = 0x0FFFFFFFF;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the change in a counter since the previous heartbeat.
+ @param[in] current The current value of the counter.
+ @param[in] previous The value of the counter at the previous heartbeat.
+ @returns The change in the counter, limited to the largest value that can be sent. */
+static uint32_t
+counterDelta(const int64_t current,
+             const int64_t previous)
+{
+    // If the counter went backwards, the metrics were reset since the previous heartbeat.
+    int64_t delta = ((current >= previous) ? (current - previous) : current);
+
+    return static_cast<uint32_t>(std::min(delta, kMaximumDelta));
+} // counterDelta
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+HeartbeatThread::HeartbeatThread(BaseService &      service,
+                                 const YarpString & address,
+                                 const int          port) :
+    inherited(), _address(address), _service(service), _previousCounters(), _beatTime(0),
+    _socket(INVALID_SOCKET), _port(port), _destination(0), _sequence(0)
+{
+    ODL_ENTER(); //####
+    ODL_P1("service = ", &service); //####
+    ODL_S1s("address = ", address); //####
+    ODL_LL1("port = ", port); //####
+    ODL_EXIT_P(this); //####
+} // HeartbeatThread::HeartbeatThread
+
+HeartbeatThread::~HeartbeatThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // HeartbeatThread::~HeartbeatThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+HeartbeatThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    for ( ; ! isStopping(); )
+    {
+        double now = yarp::os::Time::now();
+
+        if (_beatTime <= now)
+        {
+            ODL_LOG("(_beatTime <= now)"); //####
+            sendHeartbeat();
+            _beatTime = now + HEARTBEAT_INTERVAL_;
+        }
+        if (! isStopping())
+        {
+            yarp::os::Time::delay(HEARTBEAT_INTERVAL_ / 20.0);
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // HeartbeatThread::run
+
+void
+HeartbeatThread::sendHeartbeat(void)
+{
+    ODL_OBJENTER(); //####
+    try
+    {
+        uint8_t             buffer[HEARTBEAT_MAXIMUM_PACKET_SIZE_];
+        HeartbeatCounterMap currentCounters;
+        HeartbeatPacket     packet;
+        size_t              length;
+        yarp::os::Bottle    metrics;
+
+        _service.gatherMetrics(metrics);
+        packet.setHeader(_service.getEndpoint().getName(), _sequence++, HEARTBEAT_INTERVAL_,
+                         _service.isStarted());
+        for (int ii = 0, mm = metrics.size(); mm > ii; ++ii)
+        {
+            yarp::os::Value & aValue(metrics.get(ii));
+
+            if (aValue.isDict())
+            {
+                yarp::os::Property * propList = aValue.asDict();
+                SendReceiveCounters  counters;
+
+                if (propList && propList->check(MpM_SENDRECEIVE_CHANNEL_) &&
+                    counters.setFromDictionary(*propList))
+                {
+                    HeartbeatChannel                    aChannel;
+                    HeartbeatCounterMap::const_iterator match;
+                    SendReceiveCounters                 previous;
+
+                    aChannel._name = propList->find(MpM_SENDRECEIVE_CHANNEL_).toString();
+                    match = _previousCounters.find(aChannel._name);
+                    // A channel that was not seen before reports no activity, as the time over
+                    // which its counters grew is not known.
+                    if (_previousCounters.end() == match)
+                    {
+                        previous = counters;
+                    }
+                    else
+                    {
+                        previous = match->second;
+                    }
+                    aChannel._inBytes = counterDelta(counters.inBytes(), previous.inBytes());
+                    aChannel._inMessages = counterDelta(counters.inMessages(),
+                                                        previous.inMessages());
+                    aChannel._outBytes = counterDelta(counters.outBytes(), previous.outBytes());
+                    aChannel._outMessages = counterDelta(counters.outMessages(),
+                                                         previous.outMessages());
+                    if (propList->check(MpM_OUTPUTQUEUE_DEPTH_))
+                    {
+                        aChannel._queueDepth =
+                                counterDelta(propList->find(MpM_OUTPUTQUEUE_DEPTH_).asInt(), 0);
+                    }
+                    else
+                    {
+                        aChannel._queueDepth = 0;
+                    }
+                    packet.addChannel(aChannel);
+                    currentCounters[aChannel._name] = counters;
+                }
+            }
+        }
+        _previousCounters.swap(currentCounters);
+        length = packet.encode(buffer, sizeof(buffer));
+        if ((0 < length) && (INVALID_SOCKET != _socket))
+        {
+            struct sockaddr_in destination;
+
+            memset(&destination, 0, sizeof(destination));
+            destination.sin_family = AF_INET;
+            destination.sin_addr.s_addr = _destination;
+            destination.sin_port = htons(static_cast<u_short>(_port));
+            // A heartbeat that cannot be sent is simply lost, as the next one will follow shortly.
+            sendto(_socket, reinterpret_cast<const char *>(buffer), static_cast<int>(length), 0,
+                   reinterpret_cast<struct sockaddr *>(&destination), sizeof(destination));
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // HeartbeatThread::sendHeartbeat
+
+bool
+HeartbeatThread::threadInit(void)
+{
+    ODL_OBJENTER(); //####
+    bool           result = false;
+    struct in_addr anAddress;
+
+#if MAC_OR_LINUX_
+    if (1 == inet_pton(AF_INET, _address.c_str(), &anAddress))
+#else // ! MAC_OR_LINUX_
+    if (1 == InetPtonA(AF_INET, _address.c_str(), &anAddress))
+#endif // ! MAC_OR_LINUX_
+    {
+        _destination = anAddress.s_addr;
+        _socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        if (INVALID_SOCKET == _socket)
+        {
+            ODL_LOG("(INVALID_SOCKET == _socket)"); //####
+        }
+        else
+        {
+            if (IN_MULTICAST(ntohl(_destination)))
+            {
+                unsigned char loop = 1;
+                unsigned char timeToLive = 1;
+
+                setsockopt(_socket, IPPROTO_IP, IP_MULTICAST_TTL,
+                           reinterpret_cast<const char *>(&timeToLive), sizeof(timeToLive));
+                setsockopt(_socket, IPPROTO_IP, IP_MULTICAST_LOOP,
+                           reinterpret_cast<const char *>(&loop), sizeof(loop));
+            }
+            _sequence = 0;
+            _beatTime = yarp::os::Time::now();
+            result = true;
+        }
+    }
+    else
+    {
+        ODL_LOG("! (1 == inet_pton(AF_INET, _address.c_str(), &anAddress))"); //####
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // HeartbeatThread::threadInit
+
+void
+HeartbeatThread::threadRelease(void)
+{
+    ODL_OBJENTER(); //####
+    if (INVALID_SOCKET != _socket)
+    {
+#if MAC_OR_LINUX_
+        ::close(_socket);
+#else // ! MAC_OR_LINUX_
+        closesocket(_socket);
+#endif // ! MAC_OR_LINUX_
+        _socket = INVALID_SOCKET;
+    }
+    ODL_OBJEXIT(); //####
+} // HeartbeatThread::threadRelease
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,164 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mHeartbeatThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that sends service heartbeats.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMHeartbeatThread_HPP_))
+# define MpMHeartbeatThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mSendReceiveCounters.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that sends service heartbeats. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class BaseService;
+
+        /*! @brief The most recent counters for each channel of a service. */
+        typedef std::map<YarpString, SendReceiveCounters> HeartbeatCounterMap;
+
+        /*! @brief A convenience class to send the activity of a service as UDP packets.
+
+         Every HEARTBEAT_INTERVAL_ seconds, the metrics of the service are gathered and the change
+         in the counters for each channel is sent as a HeartbeatPacket to a unicast or multicast
+         address. Multicast packets are limited to the local network and are looped back, so that a
+         collector on the same machine receives them. */
+        class HeartbeatThread : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] service The service whose activity is to be sent.
+             @param[in] address The IPv4 address to send the heartbeats to.
+             @param[in] port The UDP port to send the heartbeats to. */
+            HeartbeatThread(BaseService &      service,
+                            const YarpString & address,
+                            const int          port);
+
+            /*! @brief The destructor. */
+            virtual
+            ~HeartbeatThread(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            HeartbeatThread(const HeartbeatThread & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            HeartbeatThread &
+            operator =(const HeartbeatThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+            /*! @brief Gather the metrics of the service and send the change since the previous
+             heartbeat. */
+            void
+            sendHeartbeat(void);
+
+            /*! @brief The thread initialization method.
+             @returns @c true if the thread is ready to run. */
+            virtual bool
+            threadInit(void);
+
+            /*! @brief The thread termination method. */
+            virtual void
+            threadRelease(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The IPv4 address to send the heartbeats to. */
+            YarpString _address;
+
+            /*! @brief The service whose activity is to be sent. */
+            BaseService & _service;
+
+            /*! @brief The counters for each channel at the previous heartbeat. */
+            HeartbeatCounterMap _previousCounters;
+
+            /*! @brief The time at which the thread will next send a heartbeat. */
+            double _beatTime;
+
+            /*! @brief The socket used to send the heartbeats. */
+            SOCKET _socket;
+
+            /*! @brief The UDP port to send the heartbeats to. */
+            int _port;
+
+            /*! @brief The IPv4 address to send the heartbeats to, in network byte order. */
+            uint32_t _destination;
+
+            /*! @brief The sequence number of the next heartbeat. */
+            uint32_t _sequence;
+
+        }; // HeartbeatThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMHeartbeatThread_HPP_)
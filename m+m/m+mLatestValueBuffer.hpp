@@ -0,0 +1,228 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mLatestValueBuffer.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a latest-value, triple-buffered handoff.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMLatestValueBuffer_HPP_))
+# define MpMLatestValueBuffer_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a latest-value, triple-buffered handoff. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A latest-value handoff between a single producer and a single consumer.
+
+         The producer fills the write slot and publishes it; the consumer acquires the most
+         recently published value and then works with the read slot. Three slots are used, so
+         that neither side ever waits for the other to finish with a value; the lock is only held
+         while the slot indices are exchanged. Values that are published before the consumer
+         acquires them are replaced by newer ones and counted as overwritten. */
+        template <typename Value>
+        class LatestValueBuffer
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            LatestValueBuffer(void) :
+                _lock(), _numOverwritten(0), _numPublished(0), _readIndex(0), _readyIndex(1),
+                _writeIndex(2), _fresh(false)
+            {
+            } // LatestValueBuffer
+
+            /*! @brief The destructor. */
+            ~LatestValueBuffer(void)
+            {
+            } // ~LatestValueBuffer
+
+            /*! @brief Make the most recently published value available in the read slot.
+             @returns @c true if a value was published since the last call and @c false if the
+             read slot is unchanged. */
+            bool
+            acquire(void)
+            {
+                bool result;
+
+                _lock.lock();
+                result = _fresh;
+                if (_fresh)
+                {
+                    size_t temp = _readIndex;
+
+                    _readIndex = _readyIndex;
+                    _readyIndex = temp;
+                    _fresh = false;
+                }
+                _lock.unlock();
+                return result;
+            } // acquire
+
+            /*! @brief Retrieve the number of values that were published and the number that were
+             replaced before they could be acquired.
+             @param[out] numPublished The number of values that were published.
+             @param[out] numOverwritten The number of values that were never acquired. */
+            void
+            getCounts(int64_t & numPublished,
+                      int64_t & numOverwritten)
+            {
+                _lock.lock();
+                numPublished = _numPublished;
+                numOverwritten = _numOverwritten;
+                _lock.unlock();
+            } // getCounts
+
+            /*! @brief Make the write slot the most recently published value.
+
+             The previous write slot is handed over, so the contents of the new write slot are
+             left over from an older value and must be completely replaced.
+             @returns @c true if the previously published value had been acquired and @c false if
+             it was replaced. */
+            bool
+            publish(void)
+            {
+                bool   result;
+                size_t temp;
+
+                _lock.lock();
+                temp = _writeIndex;
+                _writeIndex = _readyIndex;
+                _readyIndex = temp;
+                result = (! _fresh);
+                if (_fresh)
+                {
+                    ++_numOverwritten;
+                }
+                _fresh = true;
+                ++_numPublished;
+                _lock.unlock();
+                return result;
+            } // publish
+
+            /*! @brief Return the slot holding the value most recently acquired by the consumer.
+             @returns The slot holding the value most recently acquired by the consumer. */
+            inline Value &
+            readSlot(void)
+            {
+                return _slots[_readIndex];
+            } // readSlot
+
+            /*! @brief Return the slot that the producer is to fill in.
+             @returns The slot that the producer is to fill in. */
+            inline Value &
+            writeSlot(void)
+            {
+                return _slots[_writeIndex];
+            } // writeSlot
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            LatestValueBuffer(const LatestValueBuffer & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            LatestValueBuffer &
+            operator =(const LatestValueBuffer & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock for the slot indices. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The values being handed over. */
+            Value _slots[3];
+
+            /*! @brief The number of values that were replaced before they could be acquired. */
+            int64_t _numOverwritten;
+
+            /*! @brief The number of values that were published. */
+            int64_t _numPublished;
+
+            /*! @brief The slot owned by the consumer. */
+            size_t _readIndex;
+
+            /*! @brief The slot holding the most recently published value. */
+            size_t _readyIndex;
+
+            /*! @brief The slot owned by the producer. */
+            size_t _writeIndex;
+
+            /*! @brief @c true if the most recently published value has not been acquired. */
+            bool _fresh;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // LatestValueBuffer
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMLatestValueBuffer_HPP_)
@@ -0,0 +1,285 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mMessageBatchThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the thread that writes batches of small messages to a
+//              channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMessageBatchThread.hpp"
+
+#include <m+m/m+mGeneralChannel.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the thread that writes batches of small messages to a
+ channel. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+bool
+MessageBatchThread::IsBatch(const yarp::os::Bottle & message)
+{
+    ODL_ENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool result = false;
+
+    if (1 < message.size())
+    {
+        yarp::os::Value & firstValue = message.get(0);
+
+        result = (firstValue.isString() && (firstValue.toString() == MpM_MESSAGE_BATCH_MARKER_) &&
+                  message.get(1).isList());
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // MessageBatchThread::IsBatch
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+MessageBatchThread::MessageBatchThread(GeneralChannel & channel,
+                                       const size_t     maximumBytes,
+                                       const double     maximumDelay) :
+    inherited(), _batch(), _lock(), _batchStarted(0), _channel(channel), _batchStartTime(0),
+    _lastWriteTime(0), _maximumDelay(maximumDelay), _batchBytes(0), _maximumBytes(maximumBytes)
+{
+    ODL_ENTER(); //####
+    ODL_P1("channel = ", &channel); //####
+    ODL_LL1("maximumBytes = ", maximumBytes); //####
+    ODL_D1("maximumDelay = ", maximumDelay); //####
+    _batch.addString(MpM_MESSAGE_BATCH_MARKER_);
+    _counters._direct = _counters._failed = _counters._frames = _counters._messages = 0;
+    ODL_EXIT_P(this); //####
+} // MessageBatchThread::MessageBatchThread
+
+MessageBatchThread::~MessageBatchThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // MessageBatchThread::~MessageBatchThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+MessageBatchThread::flush(void)
+{
+    ODL_OBJENTER(); //####
+    bool   result = true;
+    size_t count = static_cast<size_t>(_batch.size() - 1);
+
+    if (0 < count)
+    {
+        // A batch of one is written as a plain message, since there is nothing to save.
+        if (1 == count)
+        {
+            yarp::os::Bottle message(*_batch.get(1).asList());
+
+            result = _channel.writeFrame(message, 1);
+        }
+        else
+        {
+            result = _channel.writeFrame(_batch, count);
+        }
+        if (result)
+        {
+            ++_counters._frames;
+            _counters._messages += count;
+        }
+        else
+        {
+            _counters._failed += count;
+        }
+        _batch.clear();
+        _batch.addString(MpM_MESSAGE_BATCH_MARKER_);
+        _batchBytes = 0;
+        _lastWriteTime = yarp::os::Time::now();
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MessageBatchThread::flush
+
+void
+MessageBatchThread::getCounters(MessageBatchCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    _lock.lock();
+    counters = _counters;
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // MessageBatchThread::getCounters
+
+void
+MessageBatchThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _batchStarted.post();
+    ODL_OBJEXIT(); //####
+} // MessageBatchThread::onStop
+
+bool
+MessageBatchThread::post(yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool result = true;
+    bool wasEmpty = false;
+
+    // The lock is held while writing, so that the messages reach the channel in order.
+    _lock.lock();
+    if (isStopping())
+    {
+        result = false;
+    }
+    else
+    {
+        double now = yarp::os::Time::now();
+
+        if ((1 == _batch.size()) && (_maximumDelay <= (now - _lastWriteTime)))
+        {
+            // The channel has been idle, so waiting for more messages would only add latency.
+            result = _channel.writeFrame(message, 1);
+            if (result)
+            {
+                ++_counters._direct;
+            }
+            else
+            {
+                ++_counters._failed;
+            }
+            _lastWriteTime = now;
+        }
+        else
+        {
+            size_t messageBytes = 0;
+
+            message.toBinary(&messageBytes);
+            if (1 == _batch.size())
+            {
+                _batchStartTime = now;
+                wasEmpty = true;
+            }
+            _batch.addList() = message;
+            _batchBytes += messageBytes;
+            if (_maximumBytes <= _batchBytes)
+            {
+                result = flush();
+            }
+        }
+    }
+    _lock.unlock();
+    if (wasEmpty)
+    {
+        _batchStarted.post();
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MessageBatchThread::post
+
+void
+MessageBatchThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    for ( ; ! isStopping(); )
+    {
+        _batchStarted.wait();
+        // The batch may have been written because it filled up, and a new batch may have been
+        // started since, so the delay is measured from the start of whichever batch is waiting.
+        for (bool waiting = true; waiting && (! isStopping()); )
+        {
+            double delay = 0;
+
+            _lock.lock();
+            waiting = (1 < _batch.size());
+            if (waiting)
+            {
+                delay = (_batchStartTime + _maximumDelay - yarp::os::Time::now());
+                if (0 >= delay)
+                {
+                    flush();
+                    waiting = false;
+                }
+            }
+            _lock.unlock();
+            if (waiting)
+            {
+                yarp::os::Time::delay(delay);
+            }
+        }
+    }
+    // Write whatever is still waiting, so that no messages are lost when batching stops.
+    _lock.lock();
+    flush();
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // MessageBatchThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,204 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mMessageBatchThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the thread that writes batches of small messages to a
+//              channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMMessageBatchThread_HPP_))
+# define MpMMessageBatchThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the thread that writes batches of small messages to a
+ channel. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The first value of a message that holds a batch of messages, each as a list. */
+# define MpM_MESSAGE_BATCH_MARKER_ "$$m+m batch$$"
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class GeneralChannel;
+
+        /*! @brief The activity of a message batcher. */
+        struct MessageBatchCounters
+        {
+            /*! @brief The number of messages that were written on their own, because the channel
+             had been idle. */
+            int64_t _direct;
+
+            /*! @brief The number of messages that could not be written to the channel. */
+            int64_t _failed;
+
+            /*! @brief The number of batches that were written to the channel. */
+            int64_t _frames;
+
+            /*! @brief The number of messages that were written as part of a batch. */
+            int64_t _messages;
+
+        }; // MessageBatchCounters
+
+        /*! @brief A thread that gathers the small messages written to an output channel into
+         batches, so that each batch pays the framing and system call costs only once.
+
+         A message that is written after the channel has been idle for the batching delay is
+         written at once; otherwise it is added to the waiting batch, which is written when it
+         reaches the size limit or when the oldest message in it has waited for the batching
+         delay. The receiving input handler passes each message in a batch on separately. */
+        class MessageBatchThread : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] channel The channel that the messages are written to.
+             @param[in] maximumBytes The serialized size at which a batch is written.
+             @param[in] maximumDelay The longest time, in seconds, that a message can wait in a
+             batch. */
+            MessageBatchThread(GeneralChannel & channel,
+                               const size_t     maximumBytes,
+                               const double     maximumDelay);
+
+            /*! @brief The destructor. */
+            virtual
+            ~MessageBatchThread(void);
+
+            /*! @brief Retrieve the activity of the batcher.
+             @param[out] counters The activity of the batcher. */
+            void
+            getCounters(MessageBatchCounters & counters);
+
+            /*! @brief Returns @c true if a message holds a batch of messages.
+             @param[in] message The message to be checked.
+             @returns @c true if the message holds a batch of messages and @c false otherwise. */
+            static bool
+            IsBatch(const yarp::os::Bottle & message);
+
+            /*! @brief Write a message to the channel or add it to the waiting batch.
+             @param[in] message The message to be written.
+             @returns @c true if the message was written or added to the batch and @c false if it
+             could not be written or the thread is stopping. */
+            bool
+            post(yarp::os::Bottle & message);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            MessageBatchThread(const MessageBatchThread & other);
+
+            /*! @brief Write the waiting batch to the channel; the lock must be held.
+             @returns @c true if the batch was empty or was written and @c false otherwise. */
+            bool
+            flush(void);
+
+            /*! @brief Called when the thread is being asked to stop. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            MessageBatchThread &
+            operator =(const MessageBatchThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The waiting batch, which starts with the batch marker. */
+            yarp::os::Bottle _batch;
+
+            /*! @brief The contention lock for the batch and the counters. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Signalled when a message is added to an empty batch. */
+            yarp::os::Semaphore _batchStarted;
+
+            /*! @brief The channel that the messages are written to. */
+            GeneralChannel & _channel;
+
+            /*! @brief The activity of the batcher. */
+            MessageBatchCounters _counters;
+
+            /*! @brief The time at which the first message was added to the waiting batch. */
+            double _batchStartTime;
+
+            /*! @brief The time at which a message or batch was last written to the channel. */
+            double _lastWriteTime;
+
+            /*! @brief The longest time, in seconds, that a message can wait in a batch. */
+            double _maximumDelay;
+
+            /*! @brief The serialized size of the messages in the waiting batch. */
+            size_t _batchBytes;
+
+            /*! @brief The serialized size at which a batch is written. */
+            size_t _maximumBytes;
+
+        }; // MessageBatchThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMMessageBatchThread_HPP_)
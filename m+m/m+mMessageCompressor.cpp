@@ -0,0 +1,564 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mMessageCompressor.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the compression of large channel messages.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMessageCompressor.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <map>
+
+#if defined(MpM_UseMessageCompression)
+# include <lz4.h>
+# include <zdict.h>
+# include <zstd.h>
+#endif // defined(MpM_UseMessageCompression)
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the compression of large channel messages. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of values in a compressed message. */
+static const int kCompressedMessageSize = 4;
+
+/*! @brief The largest factor by which LZ4 can expand its compressed data. */
+static const size_t kLZ4MaximumRatio = 255;
+
+/*! @brief The largest message, in bytes, that will be compressed or decompressed; a frame that
+ claims to hold a larger message is rejected before any memory is set aside for it. */
+static const size_t kMaximumUncompressedSize = (64 * 1024 * 1024);
+
+/*! @brief The zstd compression level, which balances speed and size. */
+static const int kZstdLevel = 3;
+
+/*! @brief The zstd dictionaries used to decompress messages, by dictionary identifier. */
+static std::map<unsigned int, void *> lDictionaries;
+
+/*! @brief The contention lock for the zstd dictionaries. */
+static yarp::os::Mutex lDictionariesLock;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if (! defined(MpM_UseMessageCompression))
+# if (! MAC_OR_LINUX_)
+#  pragma warning(push)
+#  pragma warning(disable: 4100)
+# endif // ! MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+bool
+MessageCompressor::AddDictionary(const YarpString & dictionary)
+{
+#if (! defined(MpM_UseMessageCompression))
+# if MAC_OR_LINUX_
+#  pragma unused(dictionary)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+    ODL_ENTER(); //####
+    ODL_LL1("dictionary.length() = ", dictionary.length()); //####
+    bool result = false;
+
+#if defined(MpM_UseMessageCompression)
+    unsigned int dictionaryId = ZDICT_getDictID(dictionary.c_str(), dictionary.length());
+
+    // A dictionary without an identifier cannot be matched to the frames that used it.
+    if (0 < dictionaryId)
+    {
+        lDictionariesLock.lock();
+        if (lDictionaries.end() == lDictionaries.find(dictionaryId))
+        {
+            ZSTD_DDict * prepared = ZSTD_createDDict(dictionary.c_str(), dictionary.length());
+
+            if (prepared)
+            {
+                lDictionaries[dictionaryId] = prepared;
+                result = true;
+            }
+        }
+        else
+        {
+            result = true;
+        }
+        lDictionariesLock.unlock();
+    }
+#endif // defined(MpM_UseMessageCompression)
+    ODL_EXIT_B(result); //####
+    return result;
+} // MessageCompressor::AddDictionary
+#if (! defined(MpM_UseMessageCompression))
+# if (! MAC_OR_LINUX_)
+#  pragma warning(pop)
+# endif // ! MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+
+bool
+MessageCompressor::Decompress(const yarp::os::Bottle & frame,
+                              yarp::os::Bottle &       message,
+                              size_t &                 uncompressedSize)
+{
+    ODL_ENTER(); //####
+    ODL_P3("frame = ", &frame, "message = ", &message, "uncompressedSize = ", //####
+           &uncompressedSize); //####
+    bool result = false;
+
+    if (IsCompressed(frame))
+    {
+        yarp::os::Value & data = frame.get(3);
+        const char *      compressed = data.asBlob();
+        int               method = frame.get(1).asInt();
+        int               length = frame.get(2).asInt();
+        size_t            compressedLength = data.asBlobLength();
+        bool              plausible = (compressed && (0 < length) &&
+                                       (kMaximumUncompressedSize >= static_cast<size_t>(length)));
+
+#if defined(MpM_UseMessageCompression)
+        // The uncompressed size comes from the sender, so it is checked against what the
+        // compressed data could actually hold before the buffer is allocated.
+        if (plausible)
+        {
+            if (kCompressionMethodLZ4 == method)
+            {
+                plausible = ((compressedLength * kLZ4MaximumRatio) >= static_cast<size_t>(length));
+            }
+            else if (kCompressionMethodZstd == method)
+            {
+                unsigned long long contentSize = ZSTD_getFrameContentSize(compressed,
+                                                                          compressedLength);
+
+                plausible = (static_cast<unsigned long long>(length) == contentSize);
+            }
+            else
+            {
+                plausible = false;
+            }
+        }
+#endif // defined(MpM_UseMessageCompression)
+        if (plausible)
+        {
+            std::vector<char> buffer(length);
+
+#if defined(MpM_UseMessageCompression)
+            if (kCompressionMethodLZ4 == method)
+            {
+                result = (length == LZ4_decompress_safe(compressed, &buffer[0],
+                                                        static_cast<int>(compressedLength),
+                                                        length));
+            }
+            else if (kCompressionMethodZstd == method)
+            {
+                ZSTD_DCtx *  context = ZSTD_createDCtx();
+                unsigned int dictionaryId = ZSTD_getDictID_fromFrame(compressed,
+                                                                     compressedLength);
+                size_t       restored = 0;
+
+                if (context)
+                {
+                    if (0 < dictionaryId)
+                    {
+                        ZSTD_DDict * prepared = NULL;
+
+                        lDictionariesLock.lock();
+                        std::map<unsigned int, void *>::const_iterator match =
+                                                                lDictionaries.find(dictionaryId);
+
+                        if (lDictionaries.end() != match)
+                        {
+                            prepared = static_cast<ZSTD_DDict *>(match->second);
+                        }
+                        lDictionariesLock.unlock();
+                        // The prepared dictionaries are never released, so they can be used
+                        // without holding the lock.
+                        if (prepared)
+                        {
+                            restored = ZSTD_decompress_usingDDict(context, &buffer[0], length,
+                                                                  compressed, compressedLength,
+                                                                  prepared);
+                        }
+                        else
+                        {
+                            ODL_LOG("! (prepared)"); //####
+                        }
+                    }
+                    else
+                    {
+                        restored = ZSTD_decompressDCtx(context, &buffer[0], length, compressed,
+                                                       compressedLength);
+                    }
+                    ZSTD_freeDCtx(context);
+                }
+                result = ((! ZSTD_isError(restored)) &&
+                          (static_cast<size_t>(length) == restored));
+            }
+#else // ! defined(MpM_UseMessageCompression)
+            ODL_LL2("method = ", method, "compressedLength = ", compressedLength); //####
+#endif // ! defined(MpM_UseMessageCompression)
+            if (result)
+            {
+                message.fromBinary(&buffer[0], length);
+                uncompressedSize = static_cast<size_t>(length);
+            }
+        }
+        else
+        {
+            ODL_LOG("! (plausible)"); //####
+        }
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // MessageCompressor::Decompress
+
+YarpString
+MessageCompressor::description(void)
+const
+{
+    ODL_OBJENTER(); //####
+    YarpString        result;
+    std::stringstream buff;
+
+    if (kCompressionMethodLZ4 == _method)
+    {
+        buff << "lz4";
+    }
+    else if (kCompressionMethodZstd == _method)
+    {
+        buff << "zstd";
+        if (0 < _dictionaryId)
+        {
+            buff << ":" << _dictionaryId;
+        }
+    }
+    result = buff.str();
+    ODL_OBJEXIT_s(result); //####
+    return result;
+} // MessageCompressor::description
+
+bool
+MessageCompressor::IsAvailable(void)
+{
+    ODL_ENTER(); //####
+#if defined(MpM_UseMessageCompression)
+    bool result = true;
+#else // ! defined(MpM_UseMessageCompression)
+    bool result = false;
+#endif // ! defined(MpM_UseMessageCompression)
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // MessageCompressor::IsAvailable
+
+bool
+MessageCompressor::IsCompressed(const yarp::os::Bottle & message)
+{
+    ODL_ENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool result = false;
+
+    if (kCompressedMessageSize == message.size())
+    {
+        yarp::os::Value & firstValue = message.get(0);
+
+        result = (firstValue.isString() &&
+                  (firstValue.toString() == MpM_COMPRESSED_MESSAGE_MARKER_) &&
+                  message.get(1).isInt() && message.get(2).isInt() && message.get(3).isBlob());
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // MessageCompressor::IsCompressed
+
+bool
+MessageCompressor::ParseCompressionMethod(const YarpString &  methodName,
+                                          CompressionMethod & method)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("methodName = ", methodName); //####
+    ODL_P1("method = ", &method); //####
+    bool result = true;
+
+    if (methodName == "lz4")
+    {
+        method = kCompressionMethodLZ4;
+    }
+    else if (methodName == "none")
+    {
+        method = kCompressionMethodNone;
+    }
+    else if (methodName == "zstd")
+    {
+        method = kCompressionMethodZstd;
+    }
+    else
+    {
+        result = false;
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // MessageCompressor::ParseCompressionMethod
+
+#if (! defined(MpM_UseMessageCompression))
+# if (! MAC_OR_LINUX_)
+#  pragma warning(push)
+#  pragma warning(disable: 4100)
+# endif // ! MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+bool
+MessageCompressor::TrainDictionary(const YarpStringVector & samples,
+                                   const size_t             capacity,
+                                   YarpString &             dictionary)
+{
+#if (! defined(MpM_UseMessageCompression))
+# if MAC_OR_LINUX_
+#  pragma unused(samples,capacity,dictionary)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+    ODL_ENTER(); //####
+    ODL_P2("samples = ", &samples, "dictionary = ", &dictionary); //####
+    ODL_LL1("capacity = ", capacity); //####
+    bool result = false;
+
+#if defined(MpM_UseMessageCompression)
+    if ((0 < samples.size()) && (0 < capacity))
+    {
+        std::string         sampleBytes;
+        std::vector<size_t> sampleSizes;
+        std::vector<char>   buffer(capacity);
+
+        for (YarpStringVector::const_iterator walker(samples.begin()); samples.end() != walker;
+             ++walker)
+        {
+            sampleBytes.append(walker->c_str(), walker->length());
+            sampleSizes.push_back(walker->length());
+        }
+        size_t trained = ZDICT_trainFromBuffer(&buffer[0], capacity, sampleBytes.data(),
+                                               &sampleSizes[0],
+                                               static_cast<unsigned>(sampleSizes.size()));
+
+        if (! ZDICT_isError(trained))
+        {
+            dictionary = YarpString(&buffer[0], trained);
+            result = true;
+        }
+    }
+#endif // defined(MpM_UseMessageCompression)
+    ODL_EXIT_B(result); //####
+    return result;
+} // MessageCompressor::TrainDictionary
+#if (! defined(MpM_UseMessageCompression))
+# if (! MAC_OR_LINUX_)
+#  pragma warning(pop)
+# endif // ! MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+MessageCompressor::MessageCompressor(const CompressionMethod method,
+                                     const size_t            threshold) :
+    _lock(), _buffer(), _context(NULL), _dictionary(NULL), _threshold(threshold), _method(method),
+    _dictionaryId(0)
+{
+    ODL_ENTER(); //####
+    ODL_LL2("method = ", method, "threshold = ", threshold); //####
+    ODL_EXIT_P(this); //####
+} // MessageCompressor::MessageCompressor
+
+MessageCompressor::~MessageCompressor(void)
+{
+    ODL_OBJENTER(); //####
+#if defined(MpM_UseMessageCompression)
+    if (_dictionary)
+    {
+        ZSTD_freeCDict(static_cast<ZSTD_CDict *>(_dictionary));
+    }
+    if (_context)
+    {
+        ZSTD_freeCCtx(static_cast<ZSTD_CCtx *>(_context));
+    }
+#endif // defined(MpM_UseMessageCompression)
+    ODL_OBJEXIT(); //####
+} // MessageCompressor::~MessageCompressor
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+MessageCompressor::compress(yarp::os::Bottle & message,
+                            yarp::os::Bottle & frame,
+                            size_t &           uncompressedSize)
+{
+    ODL_OBJENTER(); //####
+    ODL_P3("message = ", &message, "frame = ", &frame, "uncompressedSize = ", //####
+           &uncompressedSize); //####
+    bool         result = false;
+    size_t       length = 0;
+    const char * bytes = message.toBinary(&length);
+
+    uncompressedSize = length;
+    if ((kCompressionMethodNone != _method) && (_threshold <= length) &&
+        (kMaximumUncompressedSize >= length))
+    {
+        size_t compressedLength = 0;
+
+        _lock.lock();
+#if defined(MpM_UseMessageCompression)
+        if (kCompressionMethodLZ4 == _method)
+        {
+            int bound = LZ4_compressBound(static_cast<int>(length));
+
+            _buffer.resize(bound);
+            int written = LZ4_compress_default(bytes, &_buffer[0], static_cast<int>(length),
+                                               bound);
+
+            compressedLength = ((0 < written) ? static_cast<size_t>(written) : 0);
+        }
+        else if (_context)
+        {
+            ZSTD_CCtx * context = static_cast<ZSTD_CCtx *>(_context);
+            size_t      bound = ZSTD_compressBound(length);
+            size_t      written;
+
+            _buffer.resize(bound);
+            if (_dictionary)
+            {
+                written = ZSTD_compress_usingCDict(context, &_buffer[0], bound, bytes, length,
+                                                   static_cast<ZSTD_CDict *>(_dictionary));
+            }
+            else
+            {
+                written = ZSTD_compressCCtx(context, &_buffer[0], bound, bytes, length,
+                                            kZstdLevel);
+            }
+            compressedLength = (ZSTD_isError(written) ? 0 : written);
+        }
+#else // ! defined(MpM_UseMessageCompression)
+        ODL_P1("bytes = ", bytes); //####
+#endif // ! defined(MpM_UseMessageCompression)
+        // Data that does not shrink, such as an image that is already compressed, is sent as is.
+        if ((0 < compressedLength) && (length > compressedLength))
+        {
+            frame.clear();
+            frame.addString(MpM_COMPRESSED_MESSAGE_MARKER_);
+            frame.addInt(static_cast<int>(_method));
+            frame.addInt(static_cast<int>(length));
+            frame.add(yarp::os::Value(&_buffer[0], static_cast<int>(compressedLength)));
+            result = true;
+        }
+        _lock.unlock();
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MessageCompressor::compress
+
+#if (! defined(MpM_UseMessageCompression))
+# if (! MAC_OR_LINUX_)
+#  pragma warning(push)
+#  pragma warning(disable: 4100)
+# endif // ! MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+bool
+MessageCompressor::open(const YarpString & dictionary)
+{
+#if (! defined(MpM_UseMessageCompression))
+# if MAC_OR_LINUX_
+#  pragma unused(dictionary)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+    ODL_OBJENTER(); //####
+    ODL_LL1("dictionary.length() = ", dictionary.length()); //####
+    bool result = (kCompressionMethodNone == _method);
+
+#if defined(MpM_UseMessageCompression)
+    if (kCompressionMethodLZ4 == _method)
+    {
+        result = true;
+    }
+    else if ((kCompressionMethodZstd == _method) && (! _context))
+    {
+        _context = ZSTD_createCCtx();
+        result = (NULL != _context);
+        if (result && (0 < dictionary.length()))
+        {
+            _dictionary = ZSTD_createCDict(dictionary.c_str(), dictionary.length(), kZstdLevel);
+            result = ((NULL != _dictionary) && AddDictionary(dictionary));
+            if (result)
+            {
+                _dictionaryId = ZDICT_getDictID(dictionary.c_str(), dictionary.length());
+            }
+        }
+    }
+#endif // defined(MpM_UseMessageCompression)
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MessageCompressor::open
+#if (! defined(MpM_UseMessageCompression))
+# if (! MAC_OR_LINUX_)
+#  pragma warning(pop)
+# endif // ! MAC_OR_LINUX_
+#endif // ! defined(MpM_UseMessageCompression)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,236 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mMessageCompressor.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the compression of large channel messages.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMMessageCompressor_HPP_))
+# define MpMMessageCompressor_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the compression of large channel messages.
+
+ A compressed message holds the compressed message marker, the compression method, the size of
+ the serialized message and the compressed bytes, as a blob. A frame compressed with a zstd
+ dictionary records the identifier of the dictionary, so the receiver only needs to have added
+ the same dictionary. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The first value of a message that holds a compressed message. */
+# define MpM_COMPRESSED_MESSAGE_MARKER_ "$$m+m compressed$$"
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A class to compress the large messages written to a channel.
+
+         A message is only compressed if its serialized size reaches the threshold and the
+         compressed form is smaller. */
+        class MessageCompressor
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] method How the messages are compressed.
+             @param[in] threshold The smallest serialized size of a message that is
+             compressed. */
+            MessageCompressor(const CompressionMethod method,
+                              const size_t            threshold);
+
+            /*! @brief The destructor. */
+            virtual
+            ~MessageCompressor(void);
+
+            /*! @brief Add a zstd dictionary to the set used to decompress messages.
+             @param[in] dictionary The contents of the dictionary.
+             @returns @c true if the dictionary was valid and @c false otherwise. */
+            static bool
+            AddDictionary(const YarpString & dictionary);
+
+            /*! @brief Compress a message.
+             @param[in] message The message to be compressed.
+             @param[out] frame The compressed message.
+             @param[out] uncompressedSize The serialized size of the message.
+             @returns @c true if the message was compressed and @c false if it is to be sent as
+             is. */
+            bool
+            compress(yarp::os::Bottle & message,
+                     yarp::os::Bottle & frame,
+                     size_t &           uncompressedSize);
+
+            /*! @brief Restore a compressed message.
+
+             A frame that claims an uncompressed size that its compressed data could not hold,
+             or that is larger than the limit on message size, is rejected without being
+             decompressed.
+             @param[in] frame The compressed message.
+             @param[out] message The restored message.
+             @param[out] uncompressedSize The serialized size of the restored message.
+             @returns @c true if the message was restored and @c false otherwise. */
+            static bool
+            Decompress(const yarp::os::Bottle & frame,
+                       yarp::os::Bottle &       message,
+                       size_t &                 uncompressedSize);
+
+            /*! @brief Returns how the messages are compressed, so that receivers can tell whether
+             they are able to restore them.
+             @returns The name of the compression method, followed by ':' and the identifier of
+             the zstd dictionary if one is used. */
+            YarpString
+            description(void)
+            const;
+
+            /*! @brief Returns @c true if messages can be compressed and restored.
+             @returns @c true if m+m was built with message compression and @c false
+             otherwise. */
+            static bool
+            IsAvailable(void);
+
+            /*! @brief Returns @c true if a message holds a compressed message.
+             @param[in] message The message to be checked.
+             @returns @c true if the message holds a compressed message and @c false
+             otherwise. */
+            static bool
+            IsCompressed(const yarp::os::Bottle & message);
+
+            /*! @brief Returns how the messages are compressed.
+             @returns How the messages are compressed. */
+            inline CompressionMethod
+            method(void)
+            const
+            {
+                return _method;
+            } // method
+
+            /*! @brief Prepare the compressor for use.
+             @param[in] dictionary The contents of a zstd dictionary, or an empty string if no
+             dictionary is to be used. The dictionary is also added to the set used to decompress
+             messages.
+             @returns @c true if the compressor is ready and @c false otherwise. */
+            bool
+            open(const YarpString & dictionary);
+
+            /*! @brief Convert the name of a compression method to the method.
+             @param[in] methodName The name of the method, which is one of 'lz4', 'none' or
+             'zstd'.
+             @param[out] method The method.
+             @returns @c true if the name was recognized and @c false otherwise. */
+            static bool
+            ParseCompressionMethod(const YarpString &  methodName,
+                                   CompressionMethod & method);
+
+            /*! @brief Returns the smallest serialized size of a message that is compressed.
+             @returns The smallest serialized size of a message that is compressed. */
+            inline size_t
+            threshold(void)
+            const
+            {
+                return _threshold;
+            } // threshold
+
+            /*! @brief Build a zstd dictionary from a set of typical messages.
+             @param[in] samples The serialized messages to learn from.
+             @param[in] capacity The largest size of the dictionary.
+             @param[out] dictionary The contents of the dictionary.
+             @returns @c true if the dictionary was built and @c false otherwise. */
+            static bool
+            TrainDictionary(const YarpStringVector & samples,
+                            const size_t             capacity,
+                            YarpString &             dictionary);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            MessageCompressor(const MessageCompressor & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            MessageCompressor &
+            operator =(const MessageCompressor & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock for the compression state. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The buffer that holds the compressed bytes. */
+            std::vector<char> _buffer;
+
+            /*! @brief The zstd compression context, or @c NULL if zstd is not used. */
+            void * _context;
+
+            /*! @brief The prepared zstd dictionary, or @c NULL if there is no dictionary. */
+            void * _dictionary;
+
+            /*! @brief The smallest serialized size of a message that is compressed. */
+            size_t _threshold;
+
+            /*! @brief How the messages are compressed. */
+            CompressionMethod _method;
+
+            /*! @brief The identifier of the zstd dictionary, or zero if there is no dictionary. */
+            unsigned int _dictionaryId;
+
+        }; // MessageCompressor
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMMessageCompressor_HPP_)
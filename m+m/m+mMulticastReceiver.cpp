@@ -0,0 +1,350 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mMulticastReceiver.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the thread that receives the messages sent to a multicast
+//              group.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMulticastReceiver.hpp"
+
+#include <m+m/m+mBaseInputHandler.hpp>
+#include <m+m/m+mGeneralChannel.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <poll.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the thread that receives the messages sent to a multicast
+ group. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of milliseconds to wait for a datagram before checking if the thread is
+ stopping. */
+static const int kPollTime = 100;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+MulticastReceiver::MulticastReceiver(GeneralChannel &   destination,
+                                     const YarpString & address,
+                                     const int          port,
+                                     const bool         latestOnly) :
+    inherited(), _address(address), _groupName(), _message(), _fragmentsSeen(),
+    _destination(destination), _received(0), _lost(0), _late(0), _superseded(0),
+    _socket(INVALID_SOCKET), _port(port), _assemblySequence(0), _fragmentsMissing(0),
+    _nextSequence(0), _assembling(false), _haveSequence(false), _latestOnly(latestOnly)
+{
+    ODL_ENTER(); //####
+    ODL_P1("destination = ", &destination); //####
+    ODL_S1s("address = ", address); //####
+    ODL_LL1("port = ", port); //####
+    ODL_B1("latestOnly = ", latestOnly); //####
+    std::stringstream buff;
+
+    buff << address.c_str() << ":" << port;
+    _groupName = buff.str();
+    ODL_EXIT_P(this); //####
+} // MulticastReceiver::MulticastReceiver
+
+MulticastReceiver::~MulticastReceiver(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // MulticastReceiver::~MulticastReceiver
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+MulticastReceiver::finishMessage(const uint32_t sequence)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("sequence = ", sequence); //####
+    // The difference is taken as a signed value, so that the sequence numbers can wrap around.
+    int32_t gap = (_haveSequence ? static_cast<int32_t>(sequence - _nextSequence) : 0);
+
+    if (0 > gap)
+    {
+        ODL_LOG("(0 > gap)"); //####
+        _late.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        _lost.fetch_add(gap, std::memory_order_relaxed);
+        _nextSequence = sequence + 1;
+        _haveSequence = true;
+        if (_latestOnly && waitForDatagram(0))
+        {
+            ODL_LOG("(_latestOnly && waitForDatagram(0))"); //####
+            _superseded.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            BaseInputHandler * handler = _destination.getInputHandler();
+            yarp::os::Bottle   aMessage;
+
+            aMessage.fromBinary(_message.data(), static_cast<int>(_message.size()));
+            _received.fetch_add(1, std::memory_order_relaxed);
+            if (handler)
+            {
+                handler->deliverInput(aMessage, _groupName);
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // MulticastReceiver::finishMessage
+
+void
+MulticastReceiver::getCounters(MulticastCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    counters._sent = 0;
+    counters._failed = 0;
+    counters._received = _received.load(std::memory_order_relaxed);
+    counters._lost = _lost.load(std::memory_order_relaxed);
+    counters._late = _late.load(std::memory_order_relaxed);
+    counters._superseded = _superseded.load(std::memory_order_relaxed);
+    ODL_OBJEXIT(); //####
+} // MulticastReceiver::getCounters
+
+void
+MulticastReceiver::handleDatagram(const uint8_t * datagram,
+                                  const size_t    length)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("datagram = ", datagram); //####
+    ODL_LL1("length = ", length); //####
+    MulticastFragmentHeader header;
+
+    // The message length is checked against the number of fragments, so that a damaged header
+    // cannot cause a large allocation.
+    if (MulticastSender::DecodeHeader(datagram, length, header) &&
+        ((header._fragmentCount * static_cast<size_t>(MULTICAST_FRAGMENT_SIZE_)) >=
+         header._messageLength))
+    {
+        size_t offset = (header._fragmentIndex * MULTICAST_FRAGMENT_SIZE_);
+        size_t fragmentLength = (length - MULTICAST_HEADER_SIZE_);
+
+        // A fragment of a different message means that the current message will never be
+        // complete; it is counted as lost when the sequence numbers are checked.
+        if ((! _assembling) || (_assemblySequence != header._sequence) ||
+            (_message.size() != header._messageLength) ||
+            (_fragmentsSeen.size() != header._fragmentCount))
+        {
+            _assembling = true;
+            _assemblySequence = header._sequence;
+            _fragmentsMissing = header._fragmentCount;
+            _fragmentsSeen.assign(header._fragmentCount, false);
+            _message.resize(header._messageLength);
+        }
+        if ((header._messageLength >= (offset + fragmentLength)) &&
+            (! _fragmentsSeen[header._fragmentIndex]))
+        {
+            if (0 < fragmentLength)
+            {
+                memcpy(_message.data() + offset, datagram + MULTICAST_HEADER_SIZE_,
+                       fragmentLength);
+            }
+            _fragmentsSeen[header._fragmentIndex] = true;
+            if (0 == --_fragmentsMissing)
+            {
+                _assembling = false;
+                finishMessage(header._sequence);
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // MulticastReceiver::handleDatagram
+
+void
+MulticastReceiver::run(void)
+{
+    ODL_OBJENTER(); //####
+    uint8_t datagram[MULTICAST_HEADER_SIZE_ + MULTICAST_FRAGMENT_SIZE_ + 1];
+
+    for ( ; ! isStopping(); )
+    {
+        if (waitForDatagram(kPollTime))
+        {
+            int length = static_cast<int>(recv(_socket, reinterpret_cast<char *>(datagram),
+                                               sizeof(datagram), 0));
+
+            if (0 < length)
+            {
+                handleDatagram(datagram, static_cast<size_t>(length));
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // MulticastReceiver::run
+
+bool
+MulticastReceiver::threadInit(void)
+{
+    ODL_OBJENTER(); //####
+    bool           result = false;
+    struct in_addr groupAddress;
+
+#if MAC_OR_LINUX_
+    if (1 == inet_pton(AF_INET, _address.c_str(), &groupAddress))
+#else // ! MAC_OR_LINUX_
+    if (1 == InetPtonA(AF_INET, _address.c_str(), &groupAddress))
+#endif // ! MAC_OR_LINUX_
+    {
+        _socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    }
+    if (INVALID_SOCKET != _socket)
+    {
+        int                reuse = 1;
+        struct ip_mreq     request;
+        struct sockaddr_in localAddress;
+
+        // Several receivers on the same machine can join the same multicast group.
+        setsockopt(_socket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char *>(&reuse),
+                   sizeof(reuse));
+        memset(&localAddress, 0, sizeof(localAddress));
+        localAddress.sin_family = AF_INET;
+        localAddress.sin_addr.s_addr = htonl(INADDR_ANY);
+        localAddress.sin_port = htons(static_cast<u_short>(_port));
+        memset(&request, 0, sizeof(request));
+        request.imr_interface.s_addr = htonl(INADDR_ANY);
+        request.imr_multiaddr = groupAddress;
+        if ((0 == bind(_socket, reinterpret_cast<struct sockaddr *>(&localAddress),
+                       sizeof(localAddress))) &&
+            (0 == setsockopt(_socket, IPPROTO_IP, IP_ADD_MEMBERSHIP,
+                             reinterpret_cast<const char *>(&request), sizeof(request))))
+        {
+            _assembling = false;
+            _haveSequence = false;
+            result = true;
+        }
+        else
+        {
+            ODL_LOG("! ((0 == bind(_socket, reinterpret_cast<struct sockaddr *>" //####
+                    "(&localAddress), sizeof(localAddress))) && (0 == setsockopt(_socket, " //####
+                    "IPPROTO_IP, IP_ADD_MEMBERSHIP, reinterpret_cast<const char *>" //####
+                    "(&request), sizeof(request))))"); //####
+            threadRelease();
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MulticastReceiver::threadInit
+
+void
+MulticastReceiver::threadRelease(void)
+{
+    ODL_OBJENTER(); //####
+    if (INVALID_SOCKET != _socket)
+    {
+#if MAC_OR_LINUX_
+        ::close(_socket);
+#else // ! MAC_OR_LINUX_
+        closesocket(_socket);
+#endif // ! MAC_OR_LINUX_
+        _socket = INVALID_SOCKET;
+    }
+    ODL_OBJEXIT(); //####
+} // MulticastReceiver::threadRelease
+
+bool
+MulticastReceiver::waitForDatagram(const int milliseconds)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("milliseconds = ", milliseconds); //####
+    bool      result;
+    int       res;
+#if MAC_OR_LINUX_
+    pollfd    pollSet[1];
+#else // ! MAC_OR_LINUX_
+    WSAPOLLFD pollSet[1];
+#endif // ! MAC_OR_LINUX_
+
+    pollSet[0].fd = _socket;
+    pollSet[0].events = POLLIN;
+    pollSet[0].revents = 0;
+#if MAC_OR_LINUX_
+    res = poll(pollSet, 1, milliseconds);
+#else // ! MAC_OR_LINUX_
+    res = WSAPoll(pollSet, 1, milliseconds);
+#endif // ! MAC_OR_LINUX_
+    result = ((0 < res) && (pollSet[0].revents & POLLIN));
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MulticastReceiver::waitForDatagram
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,242 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mMulticastReceiver.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the thread that receives the messages sent to a multicast
+//              group.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMMulticastReceiver_HPP_))
+# define MpMMulticastReceiver_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mMulticastSender.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the thread that receives the messages sent to a multicast
+ group. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class GeneralChannel;
+
+        /*! @brief A thread that receives the messages sent to a multicast group and passes them to
+         the input handler of an input channel.
+
+         The fragments of each message are put back together and the sequence numbers are checked,
+         so that missing messages are counted and messages that arrive after a later one are
+         discarded. In 'latest only' mode, a message is also discarded if a newer one is already
+         waiting, so that a slow input handler always works on the most recent data. */
+        class MulticastReceiver : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] destination The channel whose input handler receives the messages.
+             @param[in] address The IPv4 address of the multicast group.
+             @param[in] port The UDP port of the multicast group.
+             @param[in] latestOnly @c true if a message is to be discarded when a newer one is
+             waiting and @c false otherwise. */
+            MulticastReceiver(GeneralChannel &   destination,
+                              const YarpString & address,
+                              const int          port,
+                              const bool         latestOnly);
+
+            /*! @brief The destructor. */
+            virtual
+            ~MulticastReceiver(void);
+
+            /*! @brief Returns the IPv4 address of the multicast group.
+             @returns The IPv4 address of the multicast group. */
+            inline const YarpString &
+            address(void)
+            const
+            {
+                return _address;
+            } // address
+
+            /*! @brief Retrieve the activity of the receiver.
+             @param[out] counters The activity of the receiver. */
+            void
+            getCounters(MulticastCounters & counters);
+
+            /*! @brief Returns the UDP port of the multicast group.
+             @returns The UDP port of the multicast group. */
+            inline int
+            port(void)
+            const
+            {
+                return _port;
+            } // port
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            MulticastReceiver(const MulticastReceiver & other);
+
+            /*! @brief Check the sequence number of a complete message and pass it on.
+             @param[in] sequence The sequence number of the message. */
+            void
+            finishMessage(const uint32_t sequence);
+
+            /*! @brief Add a datagram to the message that is being put back together.
+             @param[in] datagram The datagram that was received.
+             @param[in] length The number of bytes in the datagram. */
+            void
+            handleDatagram(const uint8_t * datagram,
+                           const size_t    length);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            MulticastReceiver &
+            operator =(const MulticastReceiver & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+            /*! @brief The thread initialization method.
+             @returns @c true if the thread is ready to run. */
+            virtual bool
+            threadInit(void);
+
+            /*! @brief The thread termination method. */
+            virtual void
+            threadRelease(void);
+
+            /*! @brief Wait for a datagram to arrive.
+             @param[in] milliseconds The longest time to wait.
+             @returns @c true if a datagram is waiting and @c false otherwise. */
+            bool
+            waitForDatagram(const int milliseconds);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The IPv4 address of the multicast group. */
+            YarpString _address;
+
+            /*! @brief The name of the multicast group, as passed to the input handler. */
+            YarpString _groupName;
+
+            /*! @brief The bytes of the message that is being put back together. */
+            std::vector<char> _message;
+
+            /*! @brief The fragments of the message that have arrived. */
+            std::vector<bool> _fragmentsSeen;
+
+            /*! @brief The channel whose input handler receives the messages. */
+            GeneralChannel & _destination;
+
+            /*! @brief The number of messages that were passed to the input handler. */
+            std::atomic<int64_t> _received;
+
+            /*! @brief The number of messages that were missing from the sequence. */
+            std::atomic<int64_t> _lost;
+
+            /*! @brief The number of messages that arrived after a later message. */
+            std::atomic<int64_t> _late;
+
+            /*! @brief The number of messages that were discarded because a newer one was
+             waiting. */
+            std::atomic<int64_t> _superseded;
+
+            /*! @brief The socket used to receive the datagrams. */
+            SOCKET _socket;
+
+            /*! @brief The UDP port of the multicast group. */
+            int _port;
+
+            /*! @brief The sequence number of the message that is being put back together. */
+            uint32_t _assemblySequence;
+
+            /*! @brief The number of fragments of the message that have not yet arrived. */
+            uint32_t _fragmentsMissing;
+
+            /*! @brief The sequence number of the next message that is expected. */
+            uint32_t _nextSequence;
+
+            /*! @brief @c true if a message is being put back together and @c false otherwise. */
+            bool _assembling;
+
+            /*! @brief @c true if a message has been received and @c false otherwise. */
+            bool _haveSequence;
+
+            /*! @brief @c true if a message is discarded when a newer one is waiting and @c false
+             otherwise. */
+            bool _latestOnly;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[1];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // MulticastReceiver
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMMulticastReceiver_HPP_)
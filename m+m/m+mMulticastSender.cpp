@@ -0,0 +1,385 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mMulticastSender.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for sending the messages of a channel to a multicast group.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mMulticastSender.hpp"
+
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <unistd.h>
+#endif // MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for sending the messages of a channel to a multicast group. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The first byte of a multicast datagram. */
+static const uint8_t kMagic1 = 'M';
+
+/*! @brief The second byte of a multicast datagram. */
+static const uint8_t kMagic2 = 'C';
+
+/*! @brief The largest number of fragments in a message. */
+static const uint32_t kMaximumFragmentCount = 0x0FFFF;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Retrieve a 16-bit value from a datagram.
+ @param[in] buffer The datagram.
+ @param[in,out] position The offset of the value in the datagram.
+ @returns The value that was retrieved. */
+static uint32_t
+getUnsigned16(const uint8_t * buffer,
+              size_t &        position)
+{
+    uint32_t result = ((static_cast<uint32_t>(buffer[position]) << 8) |
+                       static_cast<uint32_t>(buffer[position + 1]));
+
+    position += 2;
+    return result;
+} // getUnsigned16
+
+/*! @brief Retrieve a 32-bit value from a datagram.
+ @param[in] buffer The datagram.
+ @param[in,out] position The offset of the value in the datagram.
+ @returns The value that was retrieved. */
+static uint32_t
+getUnsigned32(const uint8_t * buffer,
+              size_t &        position)
+{
+    uint32_t result = ((static_cast<uint32_t>(buffer[position]) << 24) |
+                       (static_cast<uint32_t>(buffer[position + 1]) << 16) |
+                       (static_cast<uint32_t>(buffer[position + 2]) << 8) |
+                       static_cast<uint32_t>(buffer[position + 3]));
+
+    position += 4;
+    return result;
+} // getUnsigned32
+
+/*! @brief Add a 16-bit value to a datagram.
+ @param[in,out] buffer The datagram.
+ @param[in,out] position The offset of the value in the datagram.
+ @param[in] value The value to be added. */
+static void
+putUnsigned16(uint8_t *      buffer,
+              size_t &       position,
+              const uint32_t value)
+{
+    buffer[position] = static_cast<uint8_t>(value >> 8);
+    buffer[position + 1] = static_cast<uint8_t>(value);
+    position += 2;
+} // putUnsigned16
+
+/*! @brief Add a 32-bit value to a datagram.
+ @param[in,out] buffer The datagram.
+ @param[in,out] position The offset of the value in the datagram.
+ @param[in] value The value to be added. */
+static void
+putUnsigned32(uint8_t *      buffer,
+              size_t &       position,
+              const uint32_t value)
+{
+    buffer[position] = static_cast<uint8_t>(value >> 24);
+    buffer[position + 1] = static_cast<uint8_t>(value >> 16);
+    buffer[position + 2] = static_cast<uint8_t>(value >> 8);
+    buffer[position + 3] = static_cast<uint8_t>(value);
+    position += 4;
+} // putUnsigned32
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+bool
+MulticastSender::DecodeHeader(const uint8_t *           buffer,
+                              const size_t              length,
+                              MulticastFragmentHeader & header)
+{
+    ODL_ENTER(); //####
+    ODL_P2("buffer = ", buffer, "header = ", &header); //####
+    ODL_LL1("length = ", length); //####
+    bool okSoFar = false;
+
+    if ((MULTICAST_HEADER_SIZE_ <= length) && (kMagic1 == buffer[0]) && (kMagic2 == buffer[1]) &&
+        (MULTICAST_VERSION_ == buffer[2]))
+    {
+        size_t position = 4;
+
+        header._sequence = getUnsigned32(buffer, position);
+        header._messageLength = getUnsigned32(buffer, position);
+        header._fragmentIndex = getUnsigned16(buffer, position);
+        header._fragmentCount = getUnsigned16(buffer, position);
+        okSoFar = (header._fragmentIndex < header._fragmentCount);
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // MulticastSender::DecodeHeader
+
+void
+MulticastSender::EncodeHeader(uint8_t *                       buffer,
+                              const MulticastFragmentHeader & header)
+{
+    ODL_ENTER(); //####
+    ODL_P2("buffer = ", buffer, "header = ", &header); //####
+    size_t position = 4;
+
+    buffer[0] = kMagic1;
+    buffer[1] = kMagic2;
+    buffer[2] = MULTICAST_VERSION_;
+    buffer[3] = 0;
+    putUnsigned32(buffer, position, header._sequence);
+    putUnsigned32(buffer, position, header._messageLength);
+    putUnsigned16(buffer, position, header._fragmentIndex);
+    putUnsigned16(buffer, position, header._fragmentCount);
+    ODL_EXIT(); //####
+} // MulticastSender::EncodeHeader
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+MulticastSender::MulticastSender(void) :
+    _address(), _sent(0), _failed(0), _socket(INVALID_SOCKET), _port(0), _destination(0),
+    _sequence(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // MulticastSender::MulticastSender
+
+MulticastSender::~MulticastSender(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    ODL_OBJEXIT(); //####
+} // MulticastSender::~MulticastSender
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+MulticastSender::close(void)
+{
+    ODL_OBJENTER(); //####
+    if (INVALID_SOCKET != _socket)
+    {
+#if MAC_OR_LINUX_
+        ::close(_socket);
+#else // ! MAC_OR_LINUX_
+        closesocket(_socket);
+#endif // ! MAC_OR_LINUX_
+        _socket = INVALID_SOCKET;
+    }
+    _address = "";
+    _port = 0;
+    ODL_OBJEXIT(); //####
+} // MulticastSender::close
+
+void
+MulticastSender::getCounters(MulticastCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    counters._sent = _sent.load(std::memory_order_relaxed);
+    counters._failed = _failed.load(std::memory_order_relaxed);
+    counters._received = 0;
+    counters._lost = 0;
+    counters._late = 0;
+    counters._superseded = 0;
+    ODL_OBJEXIT(); //####
+} // MulticastSender::getCounters
+
+bool
+MulticastSender::open(const YarpString & address,
+                      const int          port)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("address = ", address); //####
+    ODL_LL1("port = ", port); //####
+    bool           result = false;
+    struct in_addr anAddress;
+
+    close();
+#if MAC_OR_LINUX_
+    if (1 == inet_pton(AF_INET, address.c_str(), &anAddress))
+#else // ! MAC_OR_LINUX_
+    if (1 == InetPtonA(AF_INET, address.c_str(), &anAddress))
+#endif // ! MAC_OR_LINUX_
+    {
+        if (IN_MULTICAST(ntohl(anAddress.s_addr)) && Utilities::ValidPortNumber(port))
+        {
+            _socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+            if (INVALID_SOCKET == _socket)
+            {
+                ODL_LOG("(INVALID_SOCKET == _socket)"); //####
+            }
+            else
+            {
+                unsigned char loop = 1;
+                unsigned char timeToLive = 1;
+
+                setsockopt(_socket, IPPROTO_IP, IP_MULTICAST_TTL,
+                           reinterpret_cast<const char *>(&timeToLive), sizeof(timeToLive));
+                setsockopt(_socket, IPPROTO_IP, IP_MULTICAST_LOOP,
+                           reinterpret_cast<const char *>(&loop), sizeof(loop));
+                _address = address;
+                _destination = anAddress.s_addr;
+                _port = port;
+                result = true;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (IN_MULTICAST(ntohl(anAddress.s_addr)) && " //####
+                    "Utilities::ValidPortNumber(port))"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (1 == inet_pton(AF_INET, address.c_str(), &anAddress))"); //####
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MulticastSender::open
+
+bool
+MulticastSender::send(yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool result = false;
+
+    try
+    {
+        if (INVALID_SOCKET != _socket)
+        {
+            size_t                  messageLength = 0;
+            const char *            bytes = message.toBinary(&messageLength);
+            MulticastFragmentHeader header;
+            uint8_t                 datagram[MULTICAST_HEADER_SIZE_ + MULTICAST_FRAGMENT_SIZE_];
+            struct sockaddr_in      destination;
+
+            memset(&destination, 0, sizeof(destination));
+            destination.sin_family = AF_INET;
+            destination.sin_addr.s_addr = _destination;
+            destination.sin_port = htons(static_cast<u_short>(_port));
+            // Every message uses up a sequence number, so that receivers count the messages that
+            // could not be sent as lost.
+            header._sequence = _sequence++;
+            header._messageLength = static_cast<uint32_t>(messageLength);
+            header._fragmentCount = static_cast<uint32_t>((messageLength +
+                                                           MULTICAST_FRAGMENT_SIZE_ - 1) /
+                                                          MULTICAST_FRAGMENT_SIZE_);
+            if (0 == header._fragmentCount)
+            {
+                header._fragmentCount = 1;
+            }
+            result = (bytes && (kMaximumFragmentCount >= header._fragmentCount));
+            for (header._fragmentIndex = 0;
+                 result && (header._fragmentCount > header._fragmentIndex);
+                 ++header._fragmentIndex)
+            {
+                size_t offset = (header._fragmentIndex * MULTICAST_FRAGMENT_SIZE_);
+                size_t fragmentLength = std::min(messageLength - offset,
+                                                 static_cast<size_t>(MULTICAST_FRAGMENT_SIZE_));
+                int    datagramLength = static_cast<int>(MULTICAST_HEADER_SIZE_ + fragmentLength);
+                int    sentLength;
+
+                EncodeHeader(datagram, header);
+                if (0 < fragmentLength)
+                {
+                    memcpy(datagram + MULTICAST_HEADER_SIZE_, bytes + offset, fragmentLength);
+                }
+                sentLength = static_cast<int>(sendto(_socket,
+                                                     reinterpret_cast<const char *>(datagram),
+                                                     datagramLength, 0,
+                                                     reinterpret_cast<struct sockaddr *>
+                                                                                (&destination),
+                                                     sizeof(destination)));
+                result = (datagramLength == sentLength);
+            }
+            if (result)
+            {
+                _sent.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                _failed.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MulticastSender::send
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
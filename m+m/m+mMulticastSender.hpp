@@ -0,0 +1,245 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mMulticastSender.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for sending the messages of a channel to a multicast group.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMMulticastSender_HPP_))
+# define MpMMulticastSender_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# include <atomic>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for sending the messages of a channel to a multicast group. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The largest number of message bytes in a multicast datagram, chosen so that a datagram
+ is not fragmented on an Ethernet network. */
+# define MULTICAST_FRAGMENT_SIZE_ 1400
+
+/*! @brief The number of bytes in the header of a multicast datagram. */
+# define MULTICAST_HEADER_SIZE_ 16
+
+/*! @brief The version of the multicast datagram layout. */
+# define MULTICAST_VERSION_ 1
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief The activity of a channel that sends to or receives from a multicast group. */
+        struct MulticastCounters
+        {
+            /*! @brief The number of messages that were sent to the group. */
+            int64_t _sent;
+
+            /*! @brief The number of messages that could not be sent to the group. */
+            int64_t _failed;
+
+            /*! @brief The number of messages that were received from the group. */
+            int64_t _received;
+
+            /*! @brief The number of messages that were missing from the sequence, or that never
+             arrived completely. */
+            int64_t _lost;
+
+            /*! @brief The number of messages that were discarded because a later message had
+             already been received. */
+            int64_t _late;
+
+            /*! @brief The number of messages that were discarded because a newer message was
+             waiting to be received. */
+            int64_t _superseded;
+
+        }; // MulticastCounters
+
+        /*! @brief The header of each multicast datagram.
+
+         A message is sent as one or more datagrams, each holding a fragment of the serialized
+         message. All the fragments of a message have the same sequence number. */
+        struct MulticastFragmentHeader
+        {
+            /*! @brief The sequence number of the message. */
+            uint32_t _sequence;
+
+            /*! @brief The number of bytes in the serialized message. */
+            uint32_t _messageLength;
+
+            /*! @brief The position of the fragment in the message. */
+            uint32_t _fragmentIndex;
+
+            /*! @brief The number of fragments in the message. */
+            uint32_t _fragmentCount;
+
+        }; // MulticastFragmentHeader
+
+        /*! @brief A convenience class to send the messages of a channel to a multicast group.
+
+         Each message is serialized once and sent as a sequence of datagrams, no matter how many
+         receivers have joined the group. The datagrams are limited to the local network and are
+         looped back, so that receivers on the same machine see them. */
+        class MulticastSender
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            MulticastSender(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~MulticastSender(void);
+
+            /*! @brief Returns the IPv4 address of the multicast group.
+             @returns The IPv4 address of the multicast group. */
+            inline const YarpString &
+            address(void)
+            const
+            {
+                return _address;
+            } // address
+
+            /*! @brief Stop sending to the multicast group. */
+            void
+            close(void);
+
+            /*! @brief Retrieve the header of a multicast datagram.
+             @param[in] buffer The datagram.
+             @param[in] length The number of bytes in the datagram.
+             @param[out] header The header of the datagram.
+             @returns @c true if the datagram has a valid header and @c false otherwise. */
+            static bool
+            DecodeHeader(const uint8_t *           buffer,
+                         const size_t              length,
+                         MulticastFragmentHeader & header);
+
+            /*! @brief Fill in the header of a multicast datagram.
+             @param[out] buffer The datagram, which must have room for the header.
+             @param[in] header The header of the datagram. */
+            static void
+            EncodeHeader(uint8_t *                       buffer,
+                         const MulticastFragmentHeader & header);
+
+            /*! @brief Retrieve the activity of the sender.
+             @param[out] counters The activity of the sender. */
+            void
+            getCounters(MulticastCounters & counters);
+
+            /*! @brief Start sending to a multicast group.
+             @param[in] address The IPv4 address of the multicast group.
+             @param[in] port The UDP port of the multicast group.
+             @returns @c true if the group is valid and @c false otherwise. */
+            bool
+            open(const YarpString & address,
+                 const int          port);
+
+            /*! @brief Returns the UDP port of the multicast group.
+             @returns The UDP port of the multicast group. */
+            inline int
+            port(void)
+            const
+            {
+                return _port;
+            } // port
+
+            /*! @brief Send a message to the multicast group; called only from the thread that
+             writes to the channel.
+             @param[in] message The message to be sent.
+             @returns @c true if the message was sent and @c false otherwise. */
+            bool
+            send(yarp::os::Bottle & message);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            MulticastSender(const MulticastSender & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            MulticastSender &
+            operator =(const MulticastSender & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The IPv4 address of the multicast group. */
+            YarpString _address;
+
+            /*! @brief The number of messages that were sent to the group. */
+            std::atomic<int64_t> _sent;
+
+            /*! @brief The number of messages that could not be sent to the group. */
+            std::atomic<int64_t> _failed;
+
+            /*! @brief The socket used to send the datagrams. */
+            SOCKET _socket;
+
+            /*! @brief The UDP port of the multicast group. */
+            int _port;
+
+            /*! @brief The IPv4 address of the multicast group, in network byte order. */
+            uint32_t _destination;
+
+            /*! @brief The sequence number of the next message. */
+            uint32_t _sequence;
+
+        }; // MulticastSender
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMMulticastSender_HPP_)
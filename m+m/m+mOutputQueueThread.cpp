@@ -0,0 +1,254 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mOutputQueueThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the thread that writes queued messages to a channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mOutputQueueThread.hpp"
+
+#include <m+m/m+mGeneralChannel.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the thread that writes queued messages to a channel. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+OutputQueueThread::OutputQueueThread(GeneralChannel &        channel,
+                                     const size_t            capacity,
+                                     const OutputQueuePolicy policy) :
+    inherited(), _ring(std::max(capacity, static_cast<size_t>(1))), _lock(), _itemsAvailable(0),
+    _spaceAvailable(0), _channel(channel), _head(0), _blockedWriters(0), _policy(policy)
+{
+    ODL_ENTER(); //####
+    ODL_P1("channel = ", &channel); //####
+    ODL_LL2("capacity = ", capacity, "policy = ", policy); //####
+    _counters._dropped = _counters._failed = _counters._written = 0;
+    _counters._depth = _counters._maximumDepth = 0;
+    ODL_EXIT_P(this); //####
+} // OutputQueueThread::OutputQueueThread
+
+OutputQueueThread::~OutputQueueThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // OutputQueueThread::~OutputQueueThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+OutputQueueThread::getCounters(OutputQueueCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    _lock.lock();
+    counters = _counters;
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // OutputQueueThread::getCounters
+
+void
+OutputQueueThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    int blockedWriters;
+
+    _lock.lock();
+    blockedWriters = _blockedWriters;
+    _blockedWriters = 0;
+    _lock.unlock();
+    for ( ; 0 < blockedWriters; --blockedWriters)
+    {
+        _spaceAvailable.post();
+    }
+    _itemsAvailable.post();
+    ODL_OBJEXIT(); //####
+} // OutputQueueThread::onStop
+
+bool
+OutputQueueThread::post(const yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool   result = true;
+    bool   wasEmpty = false;
+    size_t capacity = _ring.size();
+
+    _lock.lock();
+    if (kOutputQueuePolicyBlock == _policy)
+    {
+        for ( ; (capacity <= _counters._depth) && (! isStopping()); )
+        {
+            ++_blockedWriters;
+            _lock.unlock();
+            _spaceAvailable.wait();
+            _lock.lock();
+        }
+    }
+    if (isStopping())
+    {
+        result = false;
+    }
+    else if (capacity > _counters._depth)
+    {
+        wasEmpty = (0 == _counters._depth);
+        _ring[(_head + _counters._depth) % capacity] = message;
+        ++_counters._depth;
+        _counters._maximumDepth = std::max(_counters._maximumDepth, _counters._depth);
+    }
+    else
+    {
+        switch (_policy)
+        {
+            case kOutputQueuePolicyConflate :
+                _ring[(_head + _counters._depth - 1) % capacity] = message;
+                break;
+
+            case kOutputQueuePolicyDropOldest :
+                // The queue is full, so the newest message goes where the oldest one was.
+                _ring[_head] = message;
+                _head = (_head + 1) % capacity;
+                break;
+
+            default :
+                // The new message is discarded.
+                break;
+
+        }
+        ++_counters._dropped;
+    }
+    _lock.unlock();
+    if (wasEmpty)
+    {
+        _itemsAvailable.post();
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // OutputQueueThread::post
+
+void
+OutputQueueThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    yarp::os::Bottle message;
+
+    for ( ; ! isStopping(); )
+    {
+        _itemsAvailable.wait();
+        // Write everything that is waiting, since a message that is added to a queue that is not
+        // empty does not signal.
+        for (bool more = true; more && (! isStopping()); )
+        {
+            bool wakeWriter = false;
+
+            _lock.lock();
+            more = (0 < _counters._depth);
+            if (more)
+            {
+                message = _ring[_head];
+                _ring[_head].clear();
+                _head = (_head + 1) % _ring.size();
+                --_counters._depth;
+                if (0 < _blockedWriters)
+                {
+                    --_blockedWriters;
+                    wakeWriter = true;
+                }
+            }
+            _lock.unlock();
+            if (wakeWriter)
+            {
+                _spaceAvailable.post();
+            }
+            if (more)
+            {
+                bool written = _channel.BaseChannel::writeBottle(message);
+
+                _lock.lock();
+                if (written)
+                {
+                    ++_counters._written;
+                }
+                else
+                {
+                    ++_counters._failed;
+                }
+                _lock.unlock();
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // OutputQueueThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,185 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mOutputQueueThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the thread that writes queued messages to a channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMOutputQueueThread_HPP_))
+# define MpMOutputQueueThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the thread that writes queued messages to a channel. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class GeneralChannel;
+
+        /*! @brief The activity of an output queue. */
+        struct OutputQueueCounters
+        {
+            /*! @brief The number of messages that were discarded because the queue was full. */
+            int64_t _dropped;
+
+            /*! @brief The number of messages that could not be written to the channel. */
+            int64_t _failed;
+
+            /*! @brief The number of messages that were written to the channel. */
+            int64_t _written;
+
+            /*! @brief The number of messages waiting in the queue. */
+            size_t _depth;
+
+            /*! @brief The largest number of messages that have been waiting in the queue. */
+            size_t _maximumDepth;
+
+        }; // OutputQueueCounters
+
+        /*! @brief A thread that writes the messages in a bounded queue to an output channel.
+
+         The threads that produce the messages only wait for the queue, not for the channel, so a
+         slow reader of the channel does not delay them unless the policy for a full queue is to
+         wait. */
+        class OutputQueueThread : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] channel The channel that the messages are written to.
+             @param[in] capacity The maximum number of messages that can be waiting.
+             @param[in] policy What to do with a message when the queue is full. */
+            OutputQueueThread(GeneralChannel &        channel,
+                              const size_t            capacity,
+                              const OutputQueuePolicy policy);
+
+            /*! @brief The destructor. */
+            virtual
+            ~OutputQueueThread(void);
+
+            /*! @brief Retrieve the activity of the queue.
+             @param[out] counters The activity of the queue. */
+            void
+            getCounters(OutputQueueCounters & counters);
+
+            /*! @brief Add a message to the queue.
+             @param[in] message The message to be written.
+             @returns @c true if the message was added to the queue or discarded because of the
+             policy and @c false if the thread is stopping. */
+            bool
+            post(const yarp::os::Bottle & message);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            OutputQueueThread(const OutputQueueThread & other);
+
+            /*! @brief Called when the thread is being asked to stop. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            OutputQueueThread &
+            operator =(const OutputQueueThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The waiting messages, as a ring starting at the head. */
+            std::vector<yarp::os::Bottle> _ring;
+
+            /*! @brief The contention lock for the queue and the counters. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Signalled when a message is added to an empty queue. */
+            yarp::os::Semaphore _itemsAvailable;
+
+            /*! @brief Signalled when a message is removed from the queue while a producer is
+             waiting for room. */
+            yarp::os::Semaphore _spaceAvailable;
+
+            /*! @brief The channel that the messages are written to. */
+            GeneralChannel & _channel;
+
+            /*! @brief The activity of the queue. */
+            OutputQueueCounters _counters;
+
+            /*! @brief The position of the oldest waiting message. */
+            size_t _head;
+
+            /*! @brief The number of producers that are waiting for room in the queue. */
+            int _blockedWriters;
+
+            /*! @brief What to do with a message when the queue is full. */
+            OutputQueuePolicy _policy;
+
+        }; // OutputQueueThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMOutputQueueThread_HPP_)
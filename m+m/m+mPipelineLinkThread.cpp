@@ -0,0 +1,230 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mPipelineLinkThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the thread that links services within a process.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mPipelineLinkThread.hpp"
+
+#include <m+m/m+mBaseInputHandler.hpp>
+#include <m+m/m+mGeneralChannel.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the thread that links services within a process. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of times to look for a message before waiting for one. */
+static const int kSpinLimit = 100;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PipelineLinkThread::PipelineLinkThread(GeneralChannel & source,
+                                       GeneralChannel & destination,
+                                       const size_t     capacity,
+                                       const int        core) :
+    inherited(), _sourceName(source.name()), _queue(capacity), _itemsAvailable(0),
+    _destination(destination), _delivered(0), _stalls(0), _unhandled(0), _core(core),
+    _waiting(false)
+{
+    ODL_ENTER(); //####
+    ODL_P2("source = ", &source, "destination = ", &destination); //####
+    ODL_LL2("capacity = ", capacity, "core = ", core); //####
+    ODL_EXIT_P(this); //####
+} // PipelineLinkThread::PipelineLinkThread
+
+PipelineLinkThread::~PipelineLinkThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // PipelineLinkThread::~PipelineLinkThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+PipelineLinkThread::getCounters(PipelineLinkCounters & counters)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    counters._delivered = _delivered.load(std::memory_order_relaxed);
+    counters._stalls = _stalls.load(std::memory_order_relaxed);
+    counters._unhandled = _unhandled.load(std::memory_order_relaxed);
+    counters._depth = _queue.depth();
+    ODL_OBJEXIT(); //####
+} // PipelineLinkThread::getCounters
+
+void
+PipelineLinkThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _itemsAvailable.post();
+    ODL_OBJEXIT(); //####
+} // PipelineLinkThread::onStop
+
+bool
+PipelineLinkThread::post(const yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool               result;
+    bool               stalled = false;
+    yarp::os::Bottle * copy = new yarp::os::Bottle(message);
+
+    for (result = _queue.push(copy); (! result) && (! isStopping()); result = _queue.push(copy))
+    {
+        if (! stalled)
+        {
+            stalled = true;
+            _stalls.fetch_add(1, std::memory_order_relaxed);
+        }
+        yarp::os::Time::yield();
+    }
+    if (result)
+    {
+        // The fence pairs with the one in run(), so that either this thread sees that the link
+        // thread is waiting or the link thread sees the new message.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_waiting.load(std::memory_order_relaxed) && _waiting.exchange(false))
+        {
+            _itemsAvailable.post();
+        }
+    }
+    else
+    {
+        delete copy;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PipelineLinkThread::post
+
+void
+PipelineLinkThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    for ( ; ! isStopping(); )
+    {
+        yarp::os::Bottle * message = _queue.pop();
+
+        // A busy pipeline refills the queue quickly, and a few more looks cost much less than
+        // waking up from the semaphore.
+        for (int ii = 0; (! message) && (kSpinLimit > ii); ++ii)
+        {
+            yarp::os::Time::yield();
+            message = _queue.pop();
+        }
+        if (message)
+        {
+            BaseInputHandler * handler = _destination.getInputHandler();
+
+            if (handler)
+            {
+                handler->deliverInput(*message, _sourceName);
+                _delivered.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                _unhandled.fetch_add(1, std::memory_order_relaxed);
+            }
+            delete message;
+        }
+        else
+        {
+            _waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (_queue.isEmpty() && (! isStopping()))
+            {
+                _itemsAvailable.wait();
+            }
+            _waiting.store(false, std::memory_order_relaxed);
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // PipelineLinkThread::run
+
+bool
+PipelineLinkThread::threadInit(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = true;
+
+    if ((0 <= _core) && (! Utilities::PinCurrentThreadToCore(_core)))
+    {
+        // The link still works if the core is not available, just without the binding.
+        ODL_LOG("((0 <= _core) && (! Utilities::PinCurrentThreadToCore(_core)))"); //####
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PipelineLinkThread::threadInit
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,205 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mPipelineLinkThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the thread that links services within a process.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMPipelineLinkThread_HPP_))
+# define MpMPipelineLinkThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mPipelineQueue.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the thread that links services within a process. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class GeneralChannel;
+
+        /*! @brief The activity of an in-process link. */
+        struct PipelineLinkCounters
+        {
+            /*! @brief The number of messages that were passed to the input handler. */
+            int64_t _delivered;
+
+            /*! @brief The number of messages that had to wait for room in the queue. */
+            int64_t _stalls;
+
+            /*! @brief The number of messages that were discarded because the input channel had no
+             input handler. */
+            int64_t _unhandled;
+
+            /*! @brief The number of messages waiting in the queue. */
+            size_t _depth;
+
+        }; // PipelineLinkCounters
+
+        /*! @brief A thread that passes the messages written to an output channel directly to the
+         input handler of an input channel in the same process.
+
+         The messages are passed through a lock-free queue, so the writer of the output channel and
+         the input handler run in parallel without serializing the messages. When the queue is
+         full, the writer waits for room, so no messages are lost. */
+        class PipelineLinkThread : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] source The channel that the messages are written to.
+             @param[in] destination The channel whose input handler receives the messages.
+             @param[in] capacity The maximum number of messages that can be waiting.
+             @param[in] core The processor core that the thread is bound to, or a negative number
+             if the thread is not bound. */
+            PipelineLinkThread(GeneralChannel & source,
+                               GeneralChannel & destination,
+                               const size_t     capacity,
+                               const int        core);
+
+            /*! @brief The destructor. */
+            virtual
+            ~PipelineLinkThread(void);
+
+            /*! @brief Retrieve the activity of the link.
+             @param[out] counters The activity of the link. */
+            void
+            getCounters(PipelineLinkCounters & counters);
+
+            /*! @brief Add a message to the queue; called only from the thread that writes to the
+             output channel.
+             @param[in] message The message to be passed on.
+             @returns @c true if the message was added to the queue and @c false if the thread is
+             stopping. */
+            bool
+            post(const yarp::os::Bottle & message);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            PipelineLinkThread(const PipelineLinkThread & other);
+
+            /*! @brief Called when the thread is being asked to stop. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            PipelineLinkThread &
+            operator =(const PipelineLinkThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+            /*! @brief The thread initialization method.
+             @returns @c true if the thread is ready to run. */
+            virtual bool
+            threadInit(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The name of the channel that the messages are written to. */
+            YarpString _sourceName;
+
+            /*! @brief The waiting messages. */
+            PipelineQueue _queue;
+
+            /*! @brief Signalled when a message is added while the thread is waiting for one. */
+            yarp::os::Semaphore _itemsAvailable;
+
+            /*! @brief The channel whose input handler receives the messages. */
+            GeneralChannel & _destination;
+
+            /*! @brief The number of messages that were passed to the input handler. */
+            std::atomic<int64_t> _delivered;
+
+            /*! @brief The number of messages that had to wait for room in the queue. */
+            std::atomic<int64_t> _stalls;
+
+            /*! @brief The number of messages that were discarded because the input channel had no
+             input handler. */
+            std::atomic<int64_t> _unhandled;
+
+            /*! @brief The processor core that the thread is bound to, or a negative number if the
+             thread is not bound. */
+            int _core;
+
+            /*! @brief @c true if the thread is, or is about to be, waiting for a message. */
+            std::atomic<bool> _waiting;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[3];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // PipelineLinkThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMPipelineLinkThread_HPP_)
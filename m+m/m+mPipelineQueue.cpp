@@ -0,0 +1,198 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mPipelineQueue.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a single-producer / single-consumer queue of messages.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mPipelineQueue.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a single-producer / single-consumer queue of messages. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the smallest power of two that is not less than a value.
+ @param[in] value The value to be rounded up.
+ @returns The smallest power of two that is not less than the value. */
+static size_t
+roundUpToPowerOfTwo(const size_t value)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("value = ", value); //####
+    size_t result = 1;
+
+    for ( ; result < value; result <<= 1)
+    {
+    }
+    ODL_EXIT_LL(result); //####
+    return result;
+} // roundUpToPowerOfTwo
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PipelineQueue::PipelineQueue(const size_t capacity) :
+    _slots(roundUpToPowerOfTwo(capacity), NULL), _mask(_slots.size() - 1), _head(0),
+    _tailSeenByConsumer(0), _tail(0), _headSeenByProducer(0)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("capacity = ", capacity); //####
+    ODL_EXIT_P(this); //####
+} // PipelineQueue::PipelineQueue
+
+PipelineQueue::~PipelineQueue(void)
+{
+    ODL_OBJENTER(); //####
+    for (yarp::os::Bottle * message = pop(); message; message = pop())
+    {
+        delete message;
+    }
+    ODL_OBJEXIT(); //####
+} // PipelineQueue::~PipelineQueue
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+size_t
+PipelineQueue::depth(void)
+const
+{
+    ODL_OBJENTER(); //####
+    size_t head = _head.load(std::memory_order_acquire);
+    size_t tail = _tail.load(std::memory_order_acquire);
+    size_t result = ((tail >= head) ? (tail - head) : 0);
+
+    ODL_OBJEXIT_LL(result); //####
+    return result;
+} // PipelineQueue::depth
+
+bool
+PipelineQueue::isEmpty(void)
+const
+{
+    ODL_OBJENTER(); //####
+    bool result = (_head.load(std::memory_order_relaxed) ==
+                   _tail.load(std::memory_order_seq_cst));
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PipelineQueue::isEmpty
+
+yarp::os::Bottle *
+PipelineQueue::pop(void)
+{
+    ODL_OBJENTER(); //####
+    yarp::os::Bottle * result = NULL;
+    size_t             head = _head.load(std::memory_order_relaxed);
+
+    // Only look at the producer's position when the last one seen has been used up, so that the
+    // cache line that the producer writes to is not pulled over for every message.
+    if (head == _tailSeenByConsumer)
+    {
+        _tailSeenByConsumer = _tail.load(std::memory_order_acquire);
+    }
+    if (head != _tailSeenByConsumer)
+    {
+        size_t slot = (head & _mask);
+
+        result = _slots[slot];
+        _slots[slot] = NULL;
+        _head.store(head + 1, std::memory_order_release);
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // PipelineQueue::pop
+
+bool
+PipelineQueue::push(yarp::os::Bottle * message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", message); //####
+    bool   result = true;
+    size_t tail = _tail.load(std::memory_order_relaxed);
+
+    // Only look at the consumer's position when the queue appears to be full, so that the cache
+    // line that the consumer writes to is not pulled over for every message.
+    if ((tail - _headSeenByProducer) > _mask)
+    {
+        _headSeenByProducer = _head.load(std::memory_order_acquire);
+        result = ((tail - _headSeenByProducer) <= _mask);
+    }
+    if (result)
+    {
+        _slots[tail & _mask] = message;
+        _tail.store(tail + 1, std::memory_order_release);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PipelineQueue::push
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,194 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mPipelineQueue.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a single-producer / single-consumer queue of messages.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMPipelineQueue_HPP_))
+# define MpMPipelineQueue_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# include <atomic>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a single-producer / single-consumer queue of messages. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The number of bytes that are kept between the fields that are written by the producer
+ and the fields that are written by the consumer, so that they are not in the same cache line. */
+# define PIPELINE_QUEUE_LINE_SIZE_ 64
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A bounded queue of messages, passed by pointer, between exactly one producing
+         thread and exactly one consuming thread.
+
+         Neither side takes a lock; each side only writes its own index and reads the other's, so
+         the queue does not provide any way to wait for it to become non-empty or non-full. The
+         queue owns the messages that it holds. */
+        class PipelineQueue
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] capacity The minimum number of messages that the queue can hold. */
+            explicit
+            PipelineQueue(const size_t capacity);
+
+            /*! @brief The destructor. */
+            ~PipelineQueue(void);
+
+            /*! @brief Return the number of messages in the queue.
+
+             The value is only a snapshot if the producer or consumer is active.
+             @returns The number of messages in the queue. */
+            size_t
+            depth(void)
+            const;
+
+            /*! @brief Return @c true if the queue has no messages; called by the consumer.
+             @returns @c true if the queue has no messages and @c false otherwise. */
+            bool
+            isEmpty(void)
+            const;
+
+            /*! @brief Remove the oldest message from the queue; called by the consumer.
+             @returns The oldest message, which is now owned by the caller, or @c NULL if the queue
+             is empty. */
+            yarp::os::Bottle *
+            pop(void);
+
+            /*! @brief Add a message to the queue; called by the producer.
+             @param[in] message The message to be added, which is owned by the queue if it is added.
+             @returns @c true if the message was added and @c false if the queue is full. */
+            bool
+            push(yarp::os::Bottle * message);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            PipelineQueue(const PipelineQueue & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            PipelineQueue &
+            operator =(const PipelineQueue & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The slots for the messages; the number of slots is a power of two. */
+            std::vector<yarp::os::Bottle *> _slots;
+
+            /*! @brief The mask to convert a position to a slot index. */
+            size_t _mask;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to keep the consumer fields out of the cache line of the shared
+             fields. */
+            char _filler1[PIPELINE_QUEUE_LINE_SIZE_];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+            /*! @brief The position of the next message to be removed; written by the consumer. */
+            std::atomic<size_t> _head;
+
+            /*! @brief The consumer's copy of the producer's position, which is refreshed only when
+             the queue appears to be empty. */
+            size_t _tailSeenByConsumer;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to keep the producer fields out of the cache line of the consumer
+             fields. */
+            char _filler2[PIPELINE_QUEUE_LINE_SIZE_];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+            /*! @brief The position of the next message to be added; written by the producer. */
+            std::atomic<size_t> _tail;
+
+            /*! @brief The producer's copy of the consumer's position, which is refreshed only when
+             the queue appears to be full. */
+            size_t _headSeenByProducer;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to keep the producer fields out of the cache line of whatever follows
+             the queue. */
+            char _filler3[PIPELINE_QUEUE_LINE_SIZE_];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // PipelineQueue
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMPipelineQueue_HPP_)
@@ -158,6 +158,36 @@ RequestMap::fillInRequestInfo(yarp::os::Bottle & reply,
     ODL_OBJEXIT(); //####
 } // RequestMap::fillInRequestInfo
 
+void
+RequestMap::fillInStatisticsReply(yarp::os::Bottle & reply)
+{
+    ODL_OBJENTER(); //####
+    try
+    {
+        lock();
+        if (0 < _handlers.size())
+        {
+            for (RequestHandlerMap::const_iterator walker = _handlers.begin();
+                 _handlers.end() != walker; ++walker)
+            {
+                BaseRequestHandler * aHandler = walker->second;
+
+                if (aHandler->name() == walker->first)
+                {
+                    aHandler->statistics().addToList(reply, walker->first);
+                }
+            }
+        }
+        unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // RequestMap::fillInStatisticsReply
+
 BaseRequestHandler *
 RequestMap::lookupRequestHandler(const YarpString & request)
 {
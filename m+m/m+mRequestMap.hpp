@@ -97,6 +97,13 @@ namespace MplusM
             fillInRequestInfo(yarp::os::Bottle & reply,
                               const YarpString & requestName);
 
+            /*! @brief Construct the response to a 'requestStats' request.
+
+             Each request is reported once, under its canonical name, even if it has aliases.
+             @param[in,out] reply The package to hold the reply. */
+            void
+            fillInStatisticsReply(yarp::os::Bottle & reply);
+
             /*! @brief Return the function corresponding to a particular request.
              @param[in] request The requested operation.
              @returns A pointer to the function to be invoked for the request, or @c NULL if it is
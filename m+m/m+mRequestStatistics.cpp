@@ -0,0 +1,158 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mRequestStatistics.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the timing statistics of a request.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mRequestStatistics.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the timing statistics of a request. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+RequestStatistics::RequestStatistics(void) :
+    _count(0), _maxMicroseconds(0), _totalMicroseconds(0)
+{
+    ODL_ENTER(); //####
+    for (int ii = 0; REQUEST_STATISTICS_BUCKETS_ > ii; ++ii)
+    {
+        _buckets[ii].store(0, std::memory_order_relaxed);
+    }
+    ODL_EXIT_P(this); //####
+} // RequestStatistics::RequestStatistics
+
+RequestStatistics::~RequestStatistics(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // RequestStatistics::~RequestStatistics
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+RequestStatistics::addToList(yarp::os::Bottle & list,
+                             const YarpString & requestName)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("list = ", &list); //####
+    ODL_S1s("requestName = ", requestName); //####
+    yarp::os::Bottle & entry = list.addList();
+
+    // The counts are sent as doubles, as they can exceed the range of the integers in a bottle.
+    entry.addString(requestName);
+    entry.addDouble(static_cast<double>(_count.load(std::memory_order_relaxed)));
+    entry.addDouble(_totalMicroseconds.load(std::memory_order_relaxed) / 1e6);
+    entry.addDouble(_maxMicroseconds.load(std::memory_order_relaxed) / 1e6);
+    yarp::os::Bottle & histogram = entry.addList();
+
+    for (int ii = 0; REQUEST_STATISTICS_BUCKETS_ > ii; ++ii)
+    {
+        histogram.addDouble(static_cast<double>(_buckets[ii].load(std::memory_order_relaxed)));
+    }
+    ODL_OBJEXIT(); //####
+} // RequestStatistics::addToList
+
+void
+RequestStatistics::record(const double elapsed)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1("elapsed = ", elapsed); //####
+    uint64_t microseconds = ((0 < elapsed) ? static_cast<uint64_t>(elapsed * 1e6) : 0);
+    uint64_t previousMax = _maxMicroseconds.load(std::memory_order_relaxed);
+    int      bucket = 0;
+
+    // The bucket is the number of significant bits in the time, limited to the last bucket.
+    for (uint64_t remaining = microseconds; 0 < remaining; remaining >>= 1)
+    {
+        ++bucket;
+    }
+    if (REQUEST_STATISTICS_BUCKETS_ <= bucket)
+    {
+        bucket = REQUEST_STATISTICS_BUCKETS_ - 1;
+    }
+    _buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _totalMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+    for ( ; (previousMax < microseconds) &&
+         (! _maxMicroseconds.compare_exchange_weak(previousMax, microseconds,
+                                                   std::memory_order_relaxed)); )
+    {
+    }
+    ODL_OBJEXIT(); //####
+} // RequestStatistics::record
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,141 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mRequestStatistics.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the timing statistics of a request.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMRequestStatistics_HPP_))
+# define MpMRequestStatistics_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# include <atomic>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the timing statistics of a request. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The number of buckets in the latency histogram of a request. Bucket zero counts
+ requests that took less than a microsecond, bucket @c n counts requests that took at least
+ 2^(n-1) and less than 2^n microseconds and the last bucket also counts anything longer. */
+# define REQUEST_STATISTICS_BUCKETS_ 24
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief The number of calls, the total and maximum time and a latency histogram for a
+         request.
+
+         All the values are updated without locks, so that they can be recorded for every request;
+         a snapshot taken while requests are being processed may be slightly inconsistent. */
+        class RequestStatistics
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            RequestStatistics(void);
+
+            /*! @brief The destructor. */
+            ~RequestStatistics(void);
+
+            /*! @brief Add the statistics to a list.
+
+             The added list contains the request name, the number of calls, the total and maximum
+             time in seconds and a list of the histogram bucket counts.
+             @param[in,out] list The list to be added to.
+             @param[in] requestName The name of the request. */
+            void
+            addToList(yarp::os::Bottle & list,
+                      const YarpString & requestName)
+            const;
+
+            /*! @brief Record the time taken by a request.
+             @param[in] elapsed The time taken, in seconds. */
+            void
+            record(const double elapsed);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            RequestStatistics(const RequestStatistics & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            RequestStatistics &
+            operator =(const RequestStatistics & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The latency histogram. */
+            std::atomic<uint64_t> _buckets[REQUEST_STATISTICS_BUCKETS_];
+
+            /*! @brief The number of calls. */
+            std::atomic<uint64_t> _count;
+
+            /*! @brief The longest time taken, in microseconds. */
+            std::atomic<uint64_t> _maxMicroseconds;
+
+            /*! @brief The total time taken, in microseconds. */
+            std::atomic<uint64_t> _totalMicroseconds;
+
+        }; // RequestStatistics
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMRequestStatistics_HPP_)
@@ -0,0 +1,256 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mRequestTracer.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a sampling recorder of request spans.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mRequestTracer.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a sampling recorder of request spans. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Copy a string into a fixed-size buffer, truncating it if necessary.
+ @param[out] destination The buffer to be filled in, which must hold @c size + 1 characters.
+ @param[in] size The maximum number of characters to copy.
+ @param[in] source The string to be copied. */
+static void
+copyTruncated(char *             destination,
+              const size_t       size,
+              const YarpString & source)
+{
+    size_t length = source.length();
+
+    if (size < length)
+    {
+        length = size;
+    }
+    memcpy(destination, source.c_str(), length);
+    destination[length] = '\0';
+} // copyTruncated
+
+/*! @brief Return the smallest power of two that is not less than a value.
+ @param[in] value The value to be rounded up.
+ @returns The smallest power of two that is not less than the value. */
+static size_t
+roundUpToPowerOfTwo(const size_t value)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("value = ", value); //####
+    size_t result = 1;
+
+    for ( ; result < value; result <<= 1)
+    {
+    }
+    ODL_EXIT_LL(result); //####
+    return result;
+} // roundUpToPowerOfTwo
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+RequestTracer::RequestTracer(const size_t capacity) :
+    _drainLock(), _slots(NULL), _mask(roundUpToPowerOfTwo(capacity) - 1), _readPosition(0),
+    _requestCount(0), _writePosition(0), _sampleInterval(0)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("capacity = ", capacity); //####
+    _slots = new Slot[_mask + 1];
+    for (size_t ii = 0; _mask >= ii; ++ii)
+    {
+        _slots[ii]._sequence.store(0, std::memory_order_relaxed);
+    }
+    ODL_EXIT_P(this); //####
+} // RequestTracer::RequestTracer
+
+RequestTracer::~RequestTracer(void)
+{
+    ODL_OBJENTER(); //####
+    delete[] _slots;
+    ODL_OBJEXIT(); //####
+} // RequestTracer::~RequestTracer
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+int
+RequestTracer::drain(yarp::os::Bottle & spans)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("spans = ", &spans); //####
+    int result = 0;
+
+    _drainLock.lock();
+    uint64_t endPosition = _writePosition.load(std::memory_order_acquire);
+    uint64_t position = _readPosition;
+
+    // Anything older than one lap of the ring has already been replaced.
+    if (_mask < (endPosition - position))
+    {
+        result = static_cast<int>(endPosition - position - (_mask + 1));
+        position = endPosition - (_mask + 1);
+    }
+    for ( ; endPosition > position; ++position)
+    {
+        Slot &      aSlot = _slots[position & _mask];
+        uint64_t    expected = (position << 1) + 2;
+        uint64_t    before = aSlot._sequence.load(std::memory_order_acquire);
+        RequestSpan copy;
+
+        if ((position << 1) + 1 >= before)
+        {
+            // The span is still being written, or its writer has claimed the position but not yet
+            // marked the slot, so leave it for the next collection.
+            break;
+        }
+        if (expected == before)
+        {
+            copy = aSlot._span;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (expected == aSlot._sequence.load(std::memory_order_relaxed))
+            {
+                yarp::os::Bottle & aSpan = spans.addList();
+
+                aSpan.addString(copy._request);
+                aSpan.addString(copy._sender);
+                aSpan.addDouble(copy._startTime);
+                aSpan.addDouble(copy._duration);
+                aSpan.addInt(static_cast<int>(copy._replySize));
+            }
+            else
+            {
+                ++result;
+            }
+        }
+        else
+        {
+            ++result;
+        }
+    }
+    _readPosition = position;
+    _drainLock.unlock();
+    ODL_OBJEXIT_L(result); //####
+    return result;
+} // RequestTracer::drain
+
+void
+RequestTracer::record(const YarpString & request,
+                      const YarpString & sender,
+                      const double       startTime,
+                      const double       duration,
+                      const size_t       replySize)
+{
+    ODL_OBJENTER(); //####
+    ODL_S2s("request = ", request, "sender = ", sender); //####
+    ODL_D2("startTime = ", startTime, "duration = ", duration); //####
+    ODL_LL1("replySize = ", replySize); //####
+    uint64_t position = _writePosition.fetch_add(1, std::memory_order_relaxed);
+    Slot &   aSlot = _slots[position & _mask];
+
+    // Mark the slot as being written before touching the span, so that a reader that sees the
+    // completed sequence value also sees the complete span.
+    aSlot._sequence.store((position << 1) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    aSlot._span._startTime = startTime;
+    aSlot._span._duration = duration;
+    aSlot._span._replySize = replySize;
+    copyTruncated(aSlot._span._request, REQUEST_TRACER_REQUEST_SIZE_, request);
+    copyTruncated(aSlot._span._sender, REQUEST_TRACER_SENDER_SIZE_, sender);
+    aSlot._sequence.store((position << 1) + 2, std::memory_order_release);
+    ODL_OBJEXIT(); //####
+} // RequestTracer::record
+
+void
+RequestTracer::setSampleInterval(const int interval)
+{
+    ODL_OBJENTER(); //####
+    ODL_L1("interval = ", interval); //####
+    _sampleInterval.store(((0 < interval) ? interval : 0), std::memory_order_relaxed);
+    ODL_OBJEXIT(); //####
+} // RequestTracer::setSampleInterval
+
+bool
+RequestTracer::shouldSample(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = false;
+    int  interval = _sampleInterval.load(std::memory_order_relaxed);
+
+    if (0 < interval)
+    {
+        result = (0 == (_requestCount.fetch_add(1, std::memory_order_relaxed) % interval));
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RequestTracer::shouldSample
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,227 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mRequestTracer.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a sampling recorder of request spans.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMRequestTracer_HPP_))
+# define MpMRequestTracer_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# include <atomic>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a sampling recorder of request spans. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The number of spans that are retained by a service. */
+# define REQUEST_TRACER_CAPACITY_ 512
+
+/*! @brief The maximum number of characters of a request name that are kept in a span. */
+# define REQUEST_TRACER_REQUEST_SIZE_ 40
+
+/*! @brief The maximum number of characters of a sender channel name that are kept in a span. */
+# define REQUEST_TRACER_SENDER_SIZE_ 80
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief The record of a single request. */
+        struct RequestSpan
+        {
+            /*! @brief The time at which processing of the request started. */
+            double _startTime;
+
+            /*! @brief The time taken to process the request, in seconds. */
+            double _duration;
+
+            /*! @brief The size of the reply, in bytes, or zero if no reply was sent. */
+            size_t _replySize;
+
+            /*! @brief The name of the request, truncated if necessary. */
+            char _request[REQUEST_TRACER_REQUEST_SIZE_ + 1];
+
+            /*! @brief The channel that sent the request, truncated if necessary. */
+            char _sender[REQUEST_TRACER_SENDER_SIZE_ + 1];
+
+        }; // RequestSpan
+
+        /*! @brief A fixed-size ring of request spans, recorded for a sample of the requests.
+
+         Recording a span does not take a lock and does not allocate memory; each slot carries a
+         sequence value that lets the reader reject a span that was overwritten while it was being
+         copied. When the ring fills, the oldest spans are replaced. */
+        class RequestTracer
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] capacity The minimum number of spans that the ring can hold. */
+            explicit
+            RequestTracer(const size_t capacity = REQUEST_TRACER_CAPACITY_);
+
+            /*! @brief The destructor. */
+            ~RequestTracer(void);
+
+            /*! @brief Move the spans that were recorded since the previous call to a list.
+
+             Each span is added as a list of the request name, the sender channel, the start time,
+             the duration in seconds and the reply size in bytes.
+             @param[in,out] spans The list to be added to.
+             @returns The number of spans that were lost, because they were replaced before they
+             could be collected. */
+            int
+            drain(yarp::os::Bottle & spans);
+
+            /*! @brief Record a span.
+             @param[in] request The name of the request.
+             @param[in] sender The channel that sent the request.
+             @param[in] startTime The time at which processing of the request started.
+             @param[in] duration The time taken to process the request, in seconds.
+             @param[in] replySize The size of the reply, in bytes. */
+            void
+            record(const YarpString & request,
+                   const YarpString & sender,
+                   const double       startTime,
+                   const double       duration,
+                   const size_t       replySize);
+
+            /*! @brief Return the sampling interval.
+             @returns The number of requests per recorded span, or zero if no spans are being
+             recorded. */
+            inline int
+            sampleInterval(void)
+            const
+            {
+                return _sampleInterval.load(std::memory_order_relaxed);
+            } // sampleInterval
+
+            /*! @brief Set the sampling interval.
+             @param[in] interval The number of requests per recorded span, or zero to stop recording
+             spans. */
+            void
+            setSampleInterval(const int interval);
+
+            /*! @brief Return @c true if the current request is to be recorded.
+             @returns @c true if the current request is to be recorded and @c false otherwise. */
+            bool
+            shouldSample(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            RequestTracer(const RequestTracer & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            RequestTracer &
+            operator =(const RequestTracer & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief A position in the ring and the span that it holds. */
+            struct Slot
+            {
+                /*! @brief Twice the position plus one while the span is being written and twice
+                 the position plus two once it is complete. */
+                std::atomic<uint64_t> _sequence;
+
+                /*! @brief The span. */
+                RequestSpan _span;
+
+            }; // Slot
+
+            /*! @brief The contention lock used to serialize collection of the spans. */
+            yarp::os::Mutex _drainLock;
+
+            /*! @brief The slots for the spans; the number of slots is a power of two. */
+            Slot * _slots;
+
+            /*! @brief The mask to convert a position to a slot index. */
+            size_t _mask;
+
+            /*! @brief The position of the next span to be collected. */
+            uint64_t _readPosition;
+
+            /*! @brief The number of requests seen while sampling. */
+            std::atomic<uint64_t> _requestCount;
+
+            /*! @brief The position of the next span to be written. */
+            std::atomic<uint64_t> _writePosition;
+
+            /*! @brief The number of requests per recorded span, or zero if no spans are being
+             recorded. */
+            std::atomic<int> _sampleInterval;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // RequestTracer
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMRequestTracer_HPP_)
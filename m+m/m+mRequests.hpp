@@ -65,6 +65,9 @@
 /*! @brief The name for an 'arguments' request. */
 # define MpM_ARGUMENTS_REQUEST_            "arguments"
 
+/*! @brief The standard name for an 'async' request. */
+# define MpM_ASYNC_REQUEST_                "async"
+
 /*! @brief The standard name for a 'channels' request. */
 # define MpM_CHANNELS_REQUEST_             "channels"
 
@@ -89,6 +92,9 @@
 /*! @brief The standard name for an 'info' request. */
 # define MpM_INFO_REQUEST_                 "info"
 
+/*! @brief The name for an 'instances' request. */
+# define MpM_INSTANCES_REQUEST_            "instances"
+
 /*! @brief The standard name for a 'list' request. */
 # define MpM_LIST_REQUEST_                 "list"
 
@@ -110,9 +116,15 @@
 /*! @brief The name for a 'register' request. */
 # define MpM_REGISTER_REQUEST_             "register"
 
+/*! @brief The standard name for a 'requestStats' request. */
+# define MpM_REQUESTSTATS_REQUEST_         "requestStats"
+
 /*! @brief The name for a 'restartStreams' request. */
 # define MpM_RESTARTSTREAMS_REQUEST_       "restartStreams"
 
+/*! @brief The name for a 'roundTrips' request. */
+# define MpM_ROUNDTRIPS_REQUEST_           "roundTrips"
+
 /*! @brief The name for a 'setMetricsState' request. */
 # define MpM_SETMETRICSSTATE_REQUEST_      "setMetricsState"
 
@@ -125,15 +137,31 @@
 /*! @brief The name for a 'stopStreams' request. */
 # define MpM_STOPSTREAMS_REQUEST_          "stopStreams"
 
+/*! @brief The standard name for a 'timestamp' request. */
+# define MpM_TIMESTAMP_REQUEST_            "timestamp"
+
+/*! @brief The standard name for a 'traces' request. */
+# define MpM_TRACES_REQUEST_               "traces"
+
 /*! @brief The name for an 'unregister' request. */
 # define MpM_UNREGISTER_REQUEST_           "unregister"
 
 /*! @brief The name for a 'where' request. */
 # define MpM_WHERE_REQUEST_                "where"
 
+/*! @brief The smallest number of elements in the input of an 'async' request. */
+# define MpM_MINIMUM_ASYNC_INPUT_SIZE_ 3
+
 /*! @brief The number of elements expected in a channel description. */
 # define MpM_EXPECTED_CHANNEL_DESCRIPTOR_SIZE_ 3
 
+/*! @brief The number of elements in a channel description that includes a multicast group. */
+# define MpM_MULTICAST_CHANNEL_DESCRIPTOR_SIZE_ 4
+
+/*! @brief The number of elements in a channel description that includes a compression method; the
+ multicast group, which is empty if the port does not use one, precedes it. */
+# define MpM_COMPRESSED_CHANNEL_DESCRIPTOR_SIZE_ 5
+
 /*! @brief The number of elements expected in the output of a 'channels' request. */
 # define MpM_EXPECTED_CHANNELS_RESPONSE_SIZE_        3
 
@@ -146,6 +174,9 @@
 /*! @brief The number of elements expected in the output of a 'extraInfo' request. */
 # define MpM_EXPECTED_EXTRAINFO_RESPONSE_SIZE_       1
 
+/*! @brief The number of elements expected in the output of an 'instances' request. */
+# define MpM_EXPECTED_INSTANCES_RESPONSE_SIZE_       2
+
 /*! @brief The number of elements expected in the output of a 'metricsState' request. */
 # define MpM_EXPECTED_METRICSSTATE_RESPONSE_SIZE_    1
 
@@ -93,6 +93,35 @@ addLargeValueToDictionary(yarp::os::Property & dictionary,
     }
 } // addLargeValueToDictionary
 
+/*! @brief Retrieve a large value from a dictionary.
+ @param[in] dictionary The dictionary to be read.
+ @param[in] tag The tag associated with the value.
+ @param[out] bigValue The value that was retrieved.
+ @returns @c true if the value was present and @c false otherwise. */
+static bool
+getLargeValueFromDictionary(const yarp::os::Property & dictionary,
+                            const YarpString &         tag,
+                            int64_t &                  bigValue)
+{
+    bool okSoFar = false;
+
+    if (dictionary.check(tag))
+    {
+        yarp::os::Value    stuff(dictionary.find(tag));
+        yarp::os::Bottle * stuffAsList = stuff.asList();
+
+        if (stuffAsList && (2 == stuffAsList->size()))
+        {
+            int64_t highPart = stuffAsList->get(0).asInt();
+            int64_t lowPart = stuffAsList->get(1).asInt();
+
+            bigValue = ((highPart << 32) | (lowPart & 0x0FFFFFFFF));
+            okSoFar = true;
+        }
+    }
+    return okSoFar;
+} // getLargeValueFromDictionary
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -105,7 +134,8 @@ SendReceiveCounters::SendReceiveCounters(const int64_t initialInBytes,
                                          const size_t  initialInMessages,
                                          const int64_t initialOutBytes,
                                          const size_t  initialOutMessages) :
-    _inBytes(initialInBytes), _outBytes(initialOutBytes), _inMessages(initialInMessages),
+    _inBytes(initialInBytes), _outBytes(initialOutBytes), _inUncompressedBytes(initialInBytes),
+    _outUncompressedBytes(initialOutBytes), _inMessages(initialInMessages),
     _outMessages(initialOutMessages)
 {
     ODL_ENTER(); //####
@@ -135,6 +165,8 @@ SendReceiveCounters::addToList(yarp::os::Bottle & counterList,
     addLargeValueToDictionary(props, MpM_SENDRECEIVE_INMESSAGES_, _inMessages);
     addLargeValueToDictionary(props, MpM_SENDRECEIVE_OUTBYTES_, _outBytes);
     addLargeValueToDictionary(props, MpM_SENDRECEIVE_OUTMESSAGES_, _outMessages);
+    addLargeValueToDictionary(props, MpM_SENDRECEIVE_INUNCOMPRESSED_, _inUncompressedBytes);
+    addLargeValueToDictionary(props, MpM_SENDRECEIVE_OUTUNCOMPRESSED_, _outUncompressedBytes);
     ODL_OBJEXIT(); //####
 } // SendReceiveCounters::addToList
 
@@ -143,27 +175,34 @@ SendReceiveCounters::clearCounters(void)
 {
     ODL_OBJENTER(); //####
     _inBytes = _outBytes = 0;
+    _inUncompressedBytes = _outUncompressedBytes = 0;
     _inMessages = _outMessages = 0;
     ODL_OBJEXIT(); //####
 } // SendReceiveCounters::clearCounters
 
 SendReceiveCounters &
-SendReceiveCounters::incrementInCounters(const int64_t moreInBytes)
+SendReceiveCounters::incrementInCounters(const int64_t moreInBytes,
+                                         const int64_t moreInUncompressedBytes)
 {
     ODL_OBJENTER(); //####
-    ODL_LL1("moreInBytes = ", moreInBytes); //####
+    ODL_LL2("moreInBytes = ", moreInBytes, "moreInUncompressedBytes = ", //####
+            moreInUncompressedBytes); //####
     _inBytes += moreInBytes;
+    _inUncompressedBytes += moreInUncompressedBytes;
     ++_inMessages;
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // SendReceiveCounters::incrementInCounters
 
 SendReceiveCounters &
-SendReceiveCounters::incrementOutCounters(const int64_t moreOutBytes)
+SendReceiveCounters::incrementOutCounters(const int64_t moreOutBytes,
+                                          const int64_t moreOutUncompressedBytes)
 {
     ODL_OBJENTER(); //####
-    ODL_LL1("moreOutBytes = ", moreOutBytes); //####
+    ODL_LL2("moreOutBytes = ", moreOutBytes, "moreOutUncompressedBytes = ", //####
+            moreOutUncompressedBytes); //####
     _outBytes += moreOutBytes;
+    _outUncompressedBytes += moreOutUncompressedBytes;
     ++_outMessages;
     ODL_OBJEXIT_P(this); //####
     return *this;
@@ -176,6 +215,8 @@ SendReceiveCounters::operator =(const SendReceiveCounters & other)
     ODL_P1("other = ", &other); //####
     _inBytes = other._inBytes;
     _outBytes = other._outBytes;
+    _inUncompressedBytes = other._inUncompressedBytes;
+    _outUncompressedBytes = other._outUncompressedBytes;
     _inMessages = other._inMessages;
     _outMessages = other._outMessages;
     ODL_OBJEXIT_P(this); //####
@@ -189,12 +230,62 @@ SendReceiveCounters::operator +=(const SendReceiveCounters & other)
     ODL_P1("other = ", &other); //####
     _inBytes += other._inBytes;
     _outBytes += other._outBytes;
+    _inUncompressedBytes += other._inUncompressedBytes;
+    _outUncompressedBytes += other._outUncompressedBytes;
     _inMessages += other._inMessages;
     _outMessages += other._outMessages;
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // SendReceiveCounters::operator +=
 
+bool
+SendReceiveCounters::setFromDictionary(const yarp::os::Property & dictionary)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("dictionary = ", &dictionary); //####
+    bool    okSoFar;
+    int64_t inBytes;
+    int64_t inMessages;
+    int64_t inUncompressedBytes;
+    int64_t outBytes;
+    int64_t outMessages;
+    int64_t outUncompressedBytes;
+
+    okSoFar = (getLargeValueFromDictionary(dictionary, MpM_SENDRECEIVE_INBYTES_, inBytes) &&
+               getLargeValueFromDictionary(dictionary, MpM_SENDRECEIVE_INMESSAGES_, inMessages) &&
+               getLargeValueFromDictionary(dictionary, MpM_SENDRECEIVE_OUTBYTES_, outBytes) &&
+               getLargeValueFromDictionary(dictionary, MpM_SENDRECEIVE_OUTMESSAGES_,
+                                           outMessages));
+    if (okSoFar)
+    {
+        _inBytes = inBytes;
+        _inMessages = static_cast<size_t>(inMessages);
+        _outBytes = outBytes;
+        _outMessages = static_cast<size_t>(outMessages);
+        // The uncompressed byte counts are absent from older services, which never compress.
+        if (getLargeValueFromDictionary(dictionary, MpM_SENDRECEIVE_INUNCOMPRESSED_,
+                                        inUncompressedBytes))
+        {
+            _inUncompressedBytes = inUncompressedBytes;
+        }
+        else
+        {
+            _inUncompressedBytes = inBytes;
+        }
+        if (getLargeValueFromDictionary(dictionary, MpM_SENDRECEIVE_OUTUNCOMPRESSED_,
+                                        outUncompressedBytes))
+        {
+            _outUncompressedBytes = outUncompressedBytes;
+        }
+        else
+        {
+            _outUncompressedBytes = outBytes;
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // SendReceiveCounters::setFromDictionary
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -64,12 +64,18 @@
 /*! @brief The property keyword for the number of received messages. */
 # define MpM_SENDRECEIVE_INMESSAGES_  "inMessages"
 
+/*! @brief The property keyword for the number of received bytes, before decompression. */
+# define MpM_SENDRECEIVE_INUNCOMPRESSED_  "inUncompressedBytes"
+
 /*! @brief The property keyword for the number of sent bytes. */
 # define MpM_SENDRECEIVE_OUTBYTES_    "outBytes"
 
 /*! @brief The property keyword for the number of sent messages. */
 # define MpM_SENDRECEIVE_OUTMESSAGES_ "outMessages"
 
+/*! @brief The property keyword for the number of sent bytes, before compression. */
+# define MpM_SENDRECEIVE_OUTUNCOMPRESSED_ "outUncompressedBytes"
+
 /*! @brief The property keyword for the time. */
 # define MpM_SENDRECEIVE_TIME_        "time"
 
@@ -110,17 +116,76 @@ namespace MplusM
             void
             clearCounters(void);
 
+            /*! @brief Return the number of bytes received.
+             @returns The number of bytes received. */
+            inline int64_t
+            inBytes(void)
+            const
+            {
+                return _inBytes;
+            } // inBytes
+
+            /*! @brief Return the number of messages received.
+             @returns The number of messages received. */
+            inline size_t
+            inMessages(void)
+            const
+            {
+                return _inMessages;
+            } // inMessages
+
+            /*! @brief Return the number of bytes received, before decompression.
+             @returns The number of bytes received, before decompression. */
+            inline int64_t
+            inUncompressedBytes(void)
+            const
+            {
+                return _inUncompressedBytes;
+            } // inUncompressedBytes
+
             /*! @brief Update the received data.
              @param[in] moreInBytes The number of bytes received.
+             @param[in] moreInUncompressedBytes The number of bytes received, after
+             decompression.
              @returns The modified values. */
             SendReceiveCounters &
-            incrementInCounters(const int64_t moreInBytes);
+            incrementInCounters(const int64_t moreInBytes,
+                                const int64_t moreInUncompressedBytes);
 
             /*! @brief Update the sent data.
              @param[in] moreOutBytes The number of bytes sent.
+             @param[in] moreOutUncompressedBytes The number of bytes sent, before compression.
              @returns The modified values. */
             SendReceiveCounters &
-            incrementOutCounters(const int64_t moreOutBytes);
+            incrementOutCounters(const int64_t moreOutBytes,
+                                 const int64_t moreOutUncompressedBytes);
+
+            /*! @brief Return the number of bytes sent.
+             @returns The number of bytes sent. */
+            inline int64_t
+            outBytes(void)
+            const
+            {
+                return _outBytes;
+            } // outBytes
+
+            /*! @brief Return the number of messages sent.
+             @returns The number of messages sent. */
+            inline size_t
+            outMessages(void)
+            const
+            {
+                return _outMessages;
+            } // outMessages
+
+            /*! @brief Return the number of bytes sent, before compression.
+             @returns The number of bytes sent, before compression. */
+            inline int64_t
+            outUncompressedBytes(void)
+            const
+            {
+                return _outUncompressedBytes;
+            } // outUncompressedBytes
 
             /*! @brief The assignment operator.
              @param[in] other The values to be assigned to the send / receive counters.
@@ -134,6 +199,13 @@ namespace MplusM
             SendReceiveCounters &
             operator +=(const SendReceiveCounters & other);
 
+            /*! @brief Set the send / receive counters from a dictionary that was produced by
+             addToList().
+             @param[in] dictionary The dictionary to be read.
+             @returns @c true if the dictionary held all the counters and @c false otherwise. */
+            bool
+            setFromDictionary(const yarp::os::Property & dictionary);
+
         protected :
 
         private :
@@ -150,6 +222,12 @@ namespace MplusM
             /*! @brief The number of bytes sent. */
             int64_t _outBytes;
 
+            /*! @brief The number of bytes received, before decompression. */
+            int64_t _inUncompressedBytes;
+
+            /*! @brief The number of bytes sent, before compression. */
+            int64_t _outUncompressedBytes;
+
             /*! @brief The number of messages received. */
             size_t _inMessages;
 
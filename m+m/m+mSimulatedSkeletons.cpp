@@ -0,0 +1,428 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mSimulatedSkeletons.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a source of simulated skeleton data.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mSimulatedSkeletons.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <cmath>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a source of simulated skeleton data. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using std::cerr;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The default number of frames per second. */
+static const double kDefaultRate = 100;
+
+/*! @brief The default number of segments for each generated subject. */
+static const size_t kDefaultSegmentCount = 20;
+
+/*! @brief The default number of generated subjects. */
+static const size_t kDefaultSubjectCount = 1;
+
+/*! @brief The distance between generated subjects. */
+static const double kSubjectSpacing = 1000;
+
+/*! @brief The extent of the motion of a generated segment. */
+static const double kSegmentSwing = 100;
+
+/*! @brief The distance between the segments of a generated subject. */
+static const double kSegmentSpacing = 10;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Convert a string to a non-negative number.
+ @param[in] aString The string to be converted.
+ @param[out] aNumber The converted value.
+ @returns @c true if the string held a non-negative number and @c false otherwise. */
+static bool
+getNonNegativeNumber(const YarpString & aString,
+                     double &           aNumber)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("aString = ", aString); //####
+    ODL_P1("aNumber = ", &aNumber); //####
+    const char * startPtr = aString.c_str();
+    char *       endPtr;
+    double       dblValue = strtod(startPtr, &endPtr);
+    bool         result = ((startPtr != endPtr) && (! *endPtr) && (0 <= dblValue));
+
+    if (result)
+    {
+        aNumber = dblValue;
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // getNonNegativeNumber
+
+/*! @brief Separate a string into comma-separated fields.
+ @param[in] aString The string to be separated.
+ @param[out] fields The fields of the string. */
+static void
+splitAtCommas(const YarpString & aString,
+              YarpStringVector & fields)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("aString = ", aString); //####
+    ODL_P1("fields = ", &fields); //####
+    std::string asStdString(aString.c_str());
+    size_t      start = 0;
+
+    fields.clear();
+    for (size_t comma = asStdString.find(','); std::string::npos != comma;
+         comma = asStdString.find(',', start))
+    {
+        fields.push_back(asStdString.substr(start, comma - start).c_str());
+        start = comma + 1;
+    }
+    fields.push_back(asStdString.substr(start).c_str());
+    ODL_EXIT(); //####
+} // splitAtCommas
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+SimulatedSkeletonSource::SimulatedSkeletonSource(void) :
+    _frames(), _startTime(0), _rate(kDefaultRate), _frameNumber(0), _framesMissed(0),
+    _frameIndex(0), _generated(true)
+{
+    ODL_ENTER(); //####
+    _frames.resize(1);
+    ODL_EXIT_P(this); //####
+} // SimulatedSkeletonSource::SimulatedSkeletonSource
+
+SimulatedSkeletonSource::~SimulatedSkeletonSource(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // SimulatedSkeletonSource::~SimulatedSkeletonSource
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+SimulatedSkeletonSource::configure(const YarpString & description)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("description = ", description); //####
+    bool result = false;
+
+    try
+    {
+        double           firstNumber;
+        YarpStringVector fields;
+
+        splitAtCommas(description, fields);
+        _frames.clear();
+        if (getNonNegativeNumber(fields[0], firstNumber))
+        {
+            double subjectCount = kDefaultSubjectCount;
+            double segmentCount = kDefaultSegmentCount;
+
+            if (((1 >= fields.size()) || getNonNegativeNumber(fields[1], subjectCount)) &&
+                ((2 >= fields.size()) || getNonNegativeNumber(fields[2], segmentCount)) &&
+                (3 >= fields.size()))
+            {
+                SimulatedSubjectVector aFrame(static_cast<size_t>(subjectCount));
+
+                for (size_t ii = 0, numSubjects = aFrame.size(); numSubjects > ii; ++ii)
+                {
+                    SimulatedSubject & aSubject = aFrame[ii];
+                    std::stringstream  subjectName;
+
+                    subjectName << "Subject" << (ii + 1);
+                    aSubject._name = subjectName.str();
+                    aSubject._segments.resize(static_cast<size_t>(segmentCount));
+                    for (size_t jj = 0, numSegments = aSubject._segments.size(); numSegments > jj;
+                         ++jj)
+                    {
+                        std::stringstream segmentName;
+
+                        segmentName << "Segment" << (jj + 1);
+                        aSubject._segments[jj]._name = segmentName.str();
+                        aSubject._segments[jj]._occluded = false;
+                    }
+                }
+                _frames.push_back(aFrame);
+                _rate = firstNumber;
+                _generated = true;
+                result = true;
+            }
+        }
+        else
+        {
+            double newRate = kDefaultRate;
+
+            if (((1 >= fields.size()) || getNonNegativeNumber(fields[1], newRate)) &&
+                (2 >= fields.size()))
+            {
+                result = readFrames(fields[0]);
+                _rate = newRate;
+                _generated = false;
+            }
+        }
+        if (! result)
+        {
+            cerr << "Simulated device description '" << description.c_str() << "' is not valid." <<
+                    endl;
+            _frames.clear();
+            _frames.resize(1);
+            _generated = true;
+        }
+        _frameIndex = 0;
+        restart();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SimulatedSkeletonSource::configure
+
+void
+SimulatedSkeletonSource::generateFrame(void)
+{
+    ODL_OBJENTER(); //####
+    SimulatedSubjectVector & aFrame = _frames[0];
+    double                   baseTime = (_frameNumber / ((0 < _rate) ? _rate : kDefaultRate));
+
+    for (size_t ii = 0, numSubjects = aFrame.size(); numSubjects > ii; ++ii)
+    {
+        SimulatedSegmentVector & segments = aFrame[ii]._segments;
+        double                   angle = (baseTime + (0.1 * ii)) / 2;
+        double                   sinHalf = sin(angle);
+        double                   cosHalf = cos(angle);
+
+        for (size_t jj = 0, numSegments = segments.size(); numSegments > jj; ++jj)
+        {
+            SimulatedSegment & aSegment = segments[jj];
+            double             phase = baseTime + jj;
+
+            aSegment._translation[0] = (kSubjectSpacing * ii) + (kSegmentSwing * sin(phase));
+            aSegment._translation[1] = kSegmentSwing * cos(phase);
+            aSegment._translation[2] = kSegmentSpacing * jj;
+            // Rotate each subject about the vertical axis.
+            aSegment._rotation[0] = 0;
+            aSegment._rotation[1] = 0;
+            aSegment._rotation[2] = sinHalf;
+            aSegment._rotation[3] = cosHalf;
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // SimulatedSkeletonSource::generateFrame
+
+void
+SimulatedSkeletonSource::nextFrame(void)
+{
+    ODL_OBJENTER(); //####
+    ++_frameNumber;
+    if (_generated)
+    {
+        generateFrame();
+    }
+    else if (_frames.size() <= ++_frameIndex)
+    {
+        _frameIndex = 0;
+    }
+    ODL_OBJEXIT(); //####
+} // SimulatedSkeletonSource::nextFrame
+
+bool
+SimulatedSkeletonSource::readFrames(const YarpString & filePath)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("filePath = ", filePath); //####
+    FILE * inFile;
+
+#if MAC_OR_LINUX_
+    inFile = fopen(filePath.c_str(), "r");
+#else // ! MAC_OR_LINUX_
+    if (fopen_s(&inFile, filePath.c_str(), "r"))
+    {
+        inFile = NULL;
+    }
+#endif // ! MAC_OR_LINUX_
+    if (inFile)
+    {
+        char                   buffer[1024];
+        SimulatedSubjectVector aFrame;
+
+        for ( ; fgets(buffer, sizeof(buffer), inFile); )
+        {
+            char * commentStart = strchr(buffer, '#');
+
+            if (commentStart)
+            {
+                *commentStart = '\0';
+            }
+            std::istringstream inLine(buffer);
+            std::string        subjectName;
+            std::string        segmentName;
+            SimulatedSegment   aSegment;
+
+            if (inLine >> subjectName)
+            {
+                if (inLine >> segmentName >> aSegment._translation[0] >>
+                    aSegment._translation[1] >> aSegment._translation[2] >>
+                    aSegment._rotation[0] >> aSegment._rotation[1] >> aSegment._rotation[2] >>
+                    aSegment._rotation[3])
+                {
+                    aSegment._name = segmentName.c_str();
+                    aSegment._occluded = false;
+                    if (aFrame.empty() || (aFrame.back()._name != subjectName.c_str()))
+                    {
+                        aFrame.resize(aFrame.size() + 1);
+                        aFrame.back()._name = subjectName.c_str();
+                    }
+                    aFrame.back()._segments.push_back(aSegment);
+                }
+                else
+                {
+                    cerr << "Ignoring an incomplete line in '" << filePath.c_str() << "'." << endl;
+                }
+            }
+            else if (! (commentStart || aFrame.empty()))
+            {
+                // A blank line ends the frame.
+                _frames.push_back(aFrame);
+                aFrame.clear();
+            }
+        }
+        if (! aFrame.empty())
+        {
+            _frames.push_back(aFrame);
+        }
+        fclose(inFile);
+    }
+    else
+    {
+        ODL_LOG("! (inFile)"); //####
+    }
+    bool result = (! _frames.empty());
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SimulatedSkeletonSource::readFrames
+
+void
+SimulatedSkeletonSource::restart(void)
+{
+    ODL_OBJENTER(); //####
+    _startTime = yarp::os::Time::now();
+    _frameNumber = _framesMissed = 0;
+    if (_generated)
+    {
+        generateFrame();
+    }
+    ODL_OBJEXIT(); //####
+} // SimulatedSkeletonSource::restart
+
+void
+SimulatedSkeletonSource::waitForFrame(void)
+{
+    ODL_OBJENTER(); //####
+    if (0 < _rate)
+    {
+        // Frames are scheduled from the start time, rather than from the previous frame, so that
+        // the delays do not accumulate.
+        double  elapsed = yarp::os::Time::now() - _startTime;
+        int64_t dueFrame = static_cast<int64_t>(elapsed * _rate);
+
+        if (dueFrame > (_frameNumber + 1))
+        {
+            int64_t skipped = dueFrame - (_frameNumber + 1);
+
+            _framesMissed += skipped;
+            if (! _generated)
+            {
+                _frameIndex = static_cast<size_t>((_frameIndex + skipped) % _frames.size());
+            }
+            _frameNumber = dueFrame - 1;
+        }
+        else
+        {
+            double delay = ((_frameNumber + 1) / _rate) - elapsed;
+
+            if (0 < delay)
+            {
+                yarp::os::Time::delay(delay);
+            }
+        }
+    }
+    nextFrame();
+    ODL_OBJEXIT(); //####
+} // SimulatedSkeletonSource::waitForFrame
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,262 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mSimulatedSkeletons.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a source of simulated skeleton data.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by H Plus Technologies Ltd. and Simon Fraser University.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-19
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMSimulatedSkeletons_HPP_))
+# define MpMSimulatedSkeletons_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a source of simulated skeleton data. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief The position and orientation of a simulated segment. */
+        struct SimulatedSegment
+        {
+            /*! @brief The name of the segment. */
+            YarpString _name;
+
+            /*! @brief The translation of the segment, as X, Y and Z. */
+            double _translation[3];
+
+            /*! @brief The rotation of the segment, as a quaternion in X, Y, Z and W order. */
+            double _rotation[4];
+
+            /*! @brief @c true if the segment is not visible and @c false otherwise. */
+            bool _occluded;
+
+        }; // SimulatedSegment
+
+        /*! @brief A set of simulated segments. */
+        typedef std::vector<SimulatedSegment> SimulatedSegmentVector;
+
+        /*! @brief A simulated subject. */
+        struct SimulatedSubject
+        {
+            /*! @brief The name of the subject. */
+            YarpString _name;
+
+            /*! @brief The segments of the subject. */
+            SimulatedSegmentVector _segments;
+
+        }; // SimulatedSubject
+
+        /*! @brief A set of simulated subjects, making up a single frame. */
+        typedef std::vector<SimulatedSubject> SimulatedSubjectVector;
+
+        /*! @brief A source of skeleton frames that stands in for a motion-capture device.
+
+         The frames are either generated, for a given number of subjects and segments, or read
+         from a text file and repeated. Frames are produced at a fixed rate, so that the services
+         that consume them can be exercised at rates and sizes that the physical devices at hand
+         cannot provide. */
+        class SimulatedSkeletonSource
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            SimulatedSkeletonSource(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~SimulatedSkeletonSource(void);
+
+            /*! @brief Set up the source from a textual description.
+
+             The description is either 'rate,subjects,segments', for generated frames, or
+             'file[,rate]', for frames read from a file. A rate of zero produces frames as quickly
+             as they are requested. A frame file has one segment per line, as 'subject segment x y
+             z qx qy qz qw'; frames are separated by blank lines and '#' starts a comment.
+             @param[in] description The description of the source.
+             @returns @c true if the source was set up and @c false otherwise. */
+            bool
+            configure(const YarpString & description);
+
+            /*! @brief Return the current frame.
+             @returns The subjects of the current frame. */
+            inline const SimulatedSubjectVector &
+            currentFrame(void)
+            const
+            {
+                return _frames[_frameIndex];
+            } // currentFrame
+
+            /*! @brief Return the time at which the current frame was due.
+             @returns The time at which the current frame was due, or the current time if frames
+             are produced as quickly as they are requested. */
+            inline double
+            frameDueTime(void)
+            const
+            {
+                return ((0 < _rate) ? (_startTime + (_frameNumber / _rate)) :
+                        yarp::os::Time::now());
+            } // frameDueTime
+
+            /*! @brief Return the number of the current frame.
+             @returns The number of the current frame. */
+            inline int64_t
+            frameNumber(void)
+            const
+            {
+                return _frameNumber;
+            } // frameNumber
+
+            /*! @brief Return the number of frames that were skipped because they were not
+             requested in time.
+             @returns The number of frames that were skipped. */
+            inline int64_t
+            framesMissed(void)
+            const
+            {
+                return _framesMissed;
+            } // framesMissed
+
+            /*! @brief Advance to the next frame, without waiting. */
+            void
+            nextFrame(void);
+
+            /*! @brief Return the rate at which frames are produced.
+             @returns The number of frames per second, or zero if frames are produced as quickly
+             as they are requested. */
+            inline double
+            rate(void)
+            const
+            {
+                return _rate;
+            } // rate
+
+            /*! @brief Restart the timing of the frames. */
+            void
+            restart(void);
+
+            /*! @brief Wait until the next frame is due and then advance to it.
+
+             If the frame is already overdue, the frames that should have been produced in the
+             meantime are skipped, as a device would do, and are counted as missed. */
+            void
+            waitForFrame(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            SimulatedSkeletonSource(const SimulatedSkeletonSource & other);
+
+            /*! @brief Fill in the generated frame for the current frame number. */
+            void
+            generateFrame(void);
+
+            /*! @brief Read the frames from a file.
+             @param[in] filePath The path to the file.
+             @returns @c true if at least one frame was read and @c false otherwise. */
+            bool
+            readFrames(const YarpString & filePath);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @returns The updated object. */
+            SimulatedSkeletonSource &
+            operator =(const SimulatedSkeletonSource & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The frames to be produced; a generated source has a single frame that is
+             rewritten for each frame number. */
+            std::vector<SimulatedSubjectVector> _frames;
+
+            /*! @brief The time at which the first frame was produced. */
+            double _startTime;
+
+            /*! @brief The number of frames per second, or zero if frames are produced as quickly
+             as they are requested. */
+            double _rate;
+
+            /*! @brief The number of the current frame. */
+            int64_t _frameNumber;
+
+            /*! @brief The number of frames that were skipped because they were not requested in
+             time. */
+            int64_t _framesMissed;
+
+            /*! @brief The index of the current frame in the set of frames. */
+            size_t _frameIndex;
+
+            /*! @brief @c true if the frames are generated and @c false if they were read from a
+             file. */
+            bool _generated;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // SimulatedSkeletonSource
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMSimulatedSkeletons_HPP_)
@@ -44,6 +44,7 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#include <cmath>
 #include <inttypes.h>
 
 #if defined(__APPLE__)
@@ -83,6 +84,95 @@ static const size_t kInitialBufferSize = 10000;
 /*! @brief The size of a scratch buffer to use when formatting numeric values. */
 static const size_t kNumBuffSize = 100;
 
+/*! @brief A floating-point value with an explicit significand and binary exponent, as used by
+ the Grisu2 shortest-representation algorithm. */
+struct DiyFp
+{
+    /*! @brief The significand. */
+    uint64_t _f;
+
+    /*! @brief The binary exponent. */
+    int _e;
+
+}; // DiyFp
+
+/*! @brief The magnitude below which every integer is exactly representable as a double. */
+static const double kMaxExactInteger = 9007199254740992.0;
+
+/*! @brief The number of explicit significand bits in an IEEE double. */
+static const int kDpSignificandSize = 52;
+
+/*! @brief The exponent bias of an IEEE double, adjusted for the significand. */
+static const int kDpExponentBias = (0x3FF + kDpSignificandSize);
+
+/*! @brief The mask for the exponent bits of an IEEE double. */
+static const uint64_t kDpExponentMask = UINT64_C(0x7FF0000000000000);
+
+/*! @brief The mask for the significand bits of an IEEE double. */
+static const uint64_t kDpSignificandMask = UINT64_C(0x000FFFFFFFFFFFFF);
+
+/*! @brief The implicit leading bit of a normalized IEEE double. */
+static const uint64_t kDpHiddenBit = UINT64_C(0x0010000000000000);
+
+/*! @brief The significands of the cached powers of ten, from 10^-348 to 10^340 in steps of 8. */
+static const uint64_t kCachedPowersF[] =
+{
+    UINT64_C(0xfa8fd5a0081c0288), UINT64_C(0xbaaee17fa23ebf76), UINT64_C(0x8b16fb203055ac76),
+    UINT64_C(0xcf42894a5dce35ea), UINT64_C(0x9a6bb0aa55653b2d), UINT64_C(0xe61acf033d1a45df),
+    UINT64_C(0xab70fe17c79ac6ca), UINT64_C(0xff77b1fcbebcdc4f), UINT64_C(0xbe5691ef416bd60c),
+    UINT64_C(0x8dd01fad907ffc3c), UINT64_C(0xd3515c2831559a83), UINT64_C(0x9d71ac8fada6c9b5),
+    UINT64_C(0xea9c227723ee8bcb), UINT64_C(0xaecc49914078536d), UINT64_C(0x823c12795db6ce57),
+    UINT64_C(0xc21094364dfb5637), UINT64_C(0x9096ea6f3848984f), UINT64_C(0xd77485cb25823ac7),
+    UINT64_C(0xa086cfcd97bf97f4), UINT64_C(0xef340a98172aace5), UINT64_C(0xb23867fb2a35b28e),
+    UINT64_C(0x84c8d4dfd2c63f3b), UINT64_C(0xc5dd44271ad3cdba), UINT64_C(0x936b9fcebb25c996),
+    UINT64_C(0xdbac6c247d62a584), UINT64_C(0xa3ab66580d5fdaf6), UINT64_C(0xf3e2f893dec3f126),
+    UINT64_C(0xb5b5ada8aaff80b8), UINT64_C(0x87625f056c7c4a8b), UINT64_C(0xc9bcff6034c13053),
+    UINT64_C(0x964e858c91ba2655), UINT64_C(0xdff9772470297ebd), UINT64_C(0xa6dfbd9fb8e5b88f),
+    UINT64_C(0xf8a95fcf88747d94), UINT64_C(0xb94470938fa89bcf), UINT64_C(0x8a08f0f8bf0f156b),
+    UINT64_C(0xcdb02555653131b6), UINT64_C(0x993fe2c6d07b7fac), UINT64_C(0xe45c10c42a2b3b06),
+    UINT64_C(0xaa242499697392d3), UINT64_C(0xfd87b5f28300ca0e), UINT64_C(0xbce5086492111aeb),
+    UINT64_C(0x8cbccc096f5088cc), UINT64_C(0xd1b71758e219652c), UINT64_C(0x9c40000000000000),
+    UINT64_C(0xe8d4a51000000000), UINT64_C(0xad78ebc5ac620000), UINT64_C(0x813f3978f8940984),
+    UINT64_C(0xc097ce7bc90715b3), UINT64_C(0x8f7e32ce7bea5c70), UINT64_C(0xd5d238a4abe98068),
+    UINT64_C(0x9f4f2726179a2245), UINT64_C(0xed63a231d4c4fb27), UINT64_C(0xb0de65388cc8ada8),
+    UINT64_C(0x83c7088e1aab65db), UINT64_C(0xc45d1df942711d9a), UINT64_C(0x924d692ca61be758),
+    UINT64_C(0xda01ee641a708dea), UINT64_C(0xa26da3999aef774a), UINT64_C(0xf209787bb47d6b85),
+    UINT64_C(0xb454e4a179dd1877), UINT64_C(0x865b86925b9bc5c2), UINT64_C(0xc83553c5c8965d3d),
+    UINT64_C(0x952ab45cfa97a0b3), UINT64_C(0xde469fbd99a05fe3), UINT64_C(0xa59bc234db398c25),
+    UINT64_C(0xf6c69a72a3989f5c), UINT64_C(0xb7dcbf5354e9bece), UINT64_C(0x88fcf317f22241e2),
+    UINT64_C(0xcc20ce9bd35c78a5), UINT64_C(0x98165af37b2153df), UINT64_C(0xe2a0b5dc971f303a),
+    UINT64_C(0xa8d9d1535ce3b396), UINT64_C(0xfb9b7cd9a4a7443c), UINT64_C(0xbb764c4ca7a44410),
+    UINT64_C(0x8bab8eefb6409c1a), UINT64_C(0xd01fef10a657842c), UINT64_C(0x9b10a4e5e9913129),
+    UINT64_C(0xe7109bfba19c0c9d), UINT64_C(0xac2820d9623bf429), UINT64_C(0x80444b5e7aa7cf85),
+    UINT64_C(0xbf21e44003acdd2d), UINT64_C(0x8e679c2f5e44ff8f), UINT64_C(0xd433179d9c8cb841),
+    UINT64_C(0x9e19db92b4e31ba9), UINT64_C(0xeb96bf6ebadf77d9), UINT64_C(0xaf87023b9bf0ee6b)
+};
+
+/*! @brief The binary exponents of the cached powers of ten. */
+static const int16_t kCachedPowersE[] =
+{
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066
+};
+
+/*! @brief The powers of ten that fit in an unsigned 64-bit integer. */
+static const uint64_t kPowersOfTen[] =
+{
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000),
+    UINT64_C(100000), UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000),
+    UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000),
+    UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000),
+    UINT64_C(1000000000000000), UINT64_C(10000000000000000), UINT64_C(100000000000000000),
+    UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
+};
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -91,10 +181,351 @@ static const size_t kNumBuffSize = 100;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Construct a DiyFp value.
+ @param[in] significand The significand.
+ @param[in] exponent The binary exponent.
+ @returns The combined value. */
+static inline DiyFp
+makeDiyFp(const uint64_t significand,
+          const int      exponent)
+{
+    DiyFp result;
+
+    result._f = significand;
+    result._e = exponent;
+    return result;
+} // makeDiyFp
+
+/*! @brief Multiply two DiyFp values, keeping the rounded upper half of the product.
+ @param[in] lhs The first value.
+ @param[in] rhs The second value.
+ @returns The product. */
+static inline DiyFp
+multiplyDiyFp(const DiyFp & lhs,
+              const DiyFp & rhs)
+{
+    static const uint64_t kMask32 = UINT64_C(0xFFFFFFFF);
+    uint64_t              aa = (lhs._f >> 32);
+    uint64_t              bb = (lhs._f & kMask32);
+    uint64_t              cc = (rhs._f >> 32);
+    uint64_t              dd = (rhs._f & kMask32);
+    uint64_t              ac = (aa * cc);
+    uint64_t              bc = (bb * cc);
+    uint64_t              ad = (aa * dd);
+    uint64_t              bd = (bb * dd);
+    uint64_t              middle = (bd >> 32) + (ad & kMask32) + (bc & kMask32);
+
+    middle += (UINT64_C(1) << 31); // Round the discarded half.
+    return makeDiyFp(ac + (ad >> 32) + (bc >> 32) + (middle >> 32), lhs._e + rhs._e + 64);
+} // multiplyDiyFp
+
+/*! @brief Shift a DiyFp value left until a given bit is set, then by a fixed extra amount.
+ @param[in] value The value to be normalized.
+ @param[in] topBit The bit that must be set before the extra shift.
+ @param[in] extraShift The additional shift to apply.
+ @returns The normalized value. */
+static inline DiyFp
+normalizeDiyFp(const DiyFp &  value,
+               const uint64_t topBit,
+               const int      extraShift)
+{
+    DiyFp result = value;
+
+    while (! (result._f & topBit))
+    {
+        result._f <<= 1;
+        --result._e;
+    }
+    result._f <<= extraShift;
+    result._e -= extraShift;
+    return result;
+} // normalizeDiyFp
+
+/*! @brief Move the last generated digit closer to the exact value, if the rounding interval
+ allows it.
+ @param[in,out] digits The generated digits.
+ @param[in] length The number of generated digits.
+ @param[in] delta The width of the rounding interval.
+ @param[in] rest The remainder after the last digit.
+ @param[in] tenKappa The weight of the last digit.
+ @param[in] distance The distance from the upper boundary to the exact value. */
+static inline void
+roundLastDigit(char *         digits,
+               const int      length,
+               const uint64_t delta,
+               uint64_t       rest,
+               const uint64_t tenKappa,
+               const uint64_t distance)
+{
+    while ((rest < distance) && ((delta - rest) >= tenKappa) &&
+           (((rest + tenKappa) < distance) || ((distance - rest) > (rest + tenKappa - distance))))
+    {
+        --digits[length - 1];
+        rest += tenKappa;
+    }
+} // roundLastDigit
+
+/*! @brief Generate the shortest digit sequence that lies within the rounding interval.
+ @param[in] exact The scaled value.
+ @param[in] upper The scaled upper boundary.
+ @param[in] delta The width of the scaled rounding interval.
+ @param[out] digits The generated digits.
+ @param[out] length The number of generated digits.
+ @param[in,out] decimalExponent The power of ten of the last digit. */
+static void
+generateDigits(const DiyFp & exact,
+               const DiyFp & upper,
+               uint64_t      delta,
+               char *        digits,
+               int &         length,
+               int &         decimalExponent)
+{
+    const DiyFp one = makeDiyFp(UINT64_C(1) << -upper._e, upper._e);
+    uint64_t    distance = (upper._f - exact._f);
+    uint32_t    p1 = static_cast<uint32_t>(upper._f >> -one._e);
+    uint64_t    p2 = (upper._f & (one._f - 1));
+    int         kappa = 1;
+
+    for (uint32_t limit = 10; (10 > kappa) && (p1 >= limit); limit *= 10)
+    {
+        ++kappa;
+    }
+    length = 0;
+    while (0 < kappa)
+    {
+        uint32_t divisor = static_cast<uint32_t>(kPowersOfTen[kappa - 1]);
+        uint32_t digit = (p1 / divisor);
+
+        p1 %= divisor;
+        if (digit || length)
+        {
+            digits[length++] = static_cast<char>('0' + digit);
+        }
+        --kappa;
+        uint64_t rest = (static_cast<uint64_t>(p1) << -one._e) + p2;
+
+        if (rest <= delta)
+        {
+            decimalExponent += kappa;
+            roundLastDigit(digits, length, delta, rest, kPowersOfTen[kappa] << -one._e,
+                           distance);
+            return;
+
+        }
+    }
+    for ( ; ; )
+    {
+        p2 *= 10;
+        delta *= 10;
+        char digit = static_cast<char>(p2 >> -one._e);
+
+        if (digit || length)
+        {
+            digits[length++] = static_cast<char>('0' + digit);
+        }
+        p2 &= (one._f - 1);
+        --kappa;
+        if (p2 < delta)
+        {
+            decimalExponent += kappa;
+            roundLastDigit(digits, length, delta, p2, one._f, distance * kPowersOfTen[-kappa]);
+            return;
+
+        }
+    }
+} // generateDigits
+
+/*! @brief Produce the shortest decimal digit sequence that reads back as the given value.
+
+ This is the Grisu2 algorithm of Florian Loitsch; the value must be finite and greater than zero.
+ @param[in] aDouble The value to be converted.
+ @param[out] digits The generated digits, without a terminating null.
+ @param[out] length The number of generated digits.
+ @param[out] decimalExponent The power of ten to apply to the digits. */
+static void
+generateShortestDigits(const double aDouble,
+                       char *       digits,
+                       int &        length,
+                       int &        decimalExponent)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &aDouble, sizeof(bits));
+    int      biasedExponent = static_cast<int>((bits & kDpExponentMask) >> kDpSignificandSize);
+    uint64_t significand = (bits & kDpSignificandMask);
+    DiyFp    value;
+
+    if (biasedExponent)
+    {
+        value = makeDiyFp(significand + kDpHiddenBit, biasedExponent - kDpExponentBias);
+    }
+    else
+    {
+        value = makeDiyFp(significand, 1 - kDpExponentBias);
+    }
+    DiyFp upper = normalizeDiyFp(makeDiyFp((value._f << 1) + 1, value._e - 1), kDpHiddenBit << 1,
+                                 64 - kDpSignificandSize - 2);
+    DiyFp lower = ((kDpHiddenBit == value._f) ? makeDiyFp((value._f << 2) - 1, value._e - 2) :
+                   makeDiyFp((value._f << 1) - 1, value._e - 1));
+
+    lower._f <<= (lower._e - upper._e);
+    lower._e = upper._e;
+    // Select the cached power of ten that brings the upper boundary's exponent into [-60, -32].
+    double   estimate = (((-61 - upper._e) * 0.30102999566398114) + 347);
+    int      power = static_cast<int>(estimate);
+
+    if (power != estimate)
+    {
+        ++power;
+    }
+    unsigned index = static_cast<unsigned>((power >> 3) + 1);
+    DiyFp    cachedPower = makeDiyFp(kCachedPowersF[index], kCachedPowersE[index]);
+    DiyFp    scaled = multiplyDiyFp(normalizeDiyFp(value, kDpHiddenBit,
+                                                   64 - kDpSignificandSize - 1), cachedPower);
+    DiyFp    scaledUpper = multiplyDiyFp(upper, cachedPower);
+    DiyFp    scaledLower = multiplyDiyFp(lower, cachedPower);
+
+    decimalExponent = (348 - static_cast<int>(index << 3));
+    ++scaledLower._f;
+    --scaledUpper._f;
+    generateDigits(scaled, scaledUpper, scaledUpper._f - scaledLower._f, digits, length,
+                   decimalExponent);
+} // generateShortestDigits
+
+/*! @brief Write the decimal representation of an unsigned integer.
+ @param[out] outBuff The buffer to be written to, which must hold at least 20 characters.
+ @param[in] aValue The value to be written.
+ @returns The number of characters written. */
+static size_t
+formatUnsigned(char *   outBuff,
+               uint64_t aValue)
+{
+    char   scratch[20];
+    size_t count = 0;
+
+    do
+    {
+        scratch[count++] = static_cast<char>('0' + (aValue % 10));
+        aValue /= 10;
+    }
+    while (aValue);
+    for (size_t ii = 0; count > ii; ++ii)
+    {
+        outBuff[ii] = scratch[count - ii - 1];
+    }
+    return count;
+} // formatUnsigned
+
+/*! @brief Write the shortest representation of a floating-point value that reads back exactly.
+ @param[out] outBuff The buffer to be written to, which must hold at least 32 characters.
+ @param[in] aDouble The value to be written.
+ @returns The number of characters written. */
+static size_t
+formatDouble(char *       outBuff,
+             const double aDouble)
+{
+    size_t length = 0;
+    double magnitude = aDouble;
+
+    if (aDouble != aDouble)
+    {
+        memcpy(outBuff, "nan", 3);
+        return 3;
+
+    }
+    if (std::signbit(aDouble))
+    {
+        outBuff[length++] = '-';
+        magnitude = -aDouble;
+    }
+    if (std::isinf(magnitude))
+    {
+        memcpy(outBuff + length, "inf", 3);
+        return (length + 3);
+
+    }
+    if ((kMaxExactInteger > magnitude) &&
+        (magnitude == static_cast<double>(static_cast<uint64_t>(magnitude))))
+    {
+        // Integral values, including zero, don't need the digit generator.
+        return (length + formatUnsigned(outBuff + length, static_cast<uint64_t>(magnitude)));
+
+    }
+    char digits[20];
+    int  digitCount;
+    int  decimalExponent;
+
+    generateShortestDigits(magnitude, digits, digitCount, decimalExponent);
+    // 'point' is the position of the decimal point, relative to the first digit.
+    int point = (digitCount + decimalExponent);
+
+    if ((0 <= decimalExponent) && (21 >= point))
+    {
+        memcpy(outBuff + length, digits, digitCount);
+        length += digitCount;
+        memset(outBuff + length, '0', decimalExponent);
+        length += decimalExponent;
+    }
+    else if ((0 < point) && (21 >= point))
+    {
+        memcpy(outBuff + length, digits, point);
+        length += point;
+        outBuff[length++] = '.';
+        memcpy(outBuff + length, digits + point, digitCount - point);
+        length += (digitCount - point);
+    }
+    else if ((-6 < point) && (0 >= point))
+    {
+        outBuff[length++] = '0';
+        outBuff[length++] = '.';
+        memset(outBuff + length, '0', -point);
+        length += -point;
+        memcpy(outBuff + length, digits, digitCount);
+        length += digitCount;
+    }
+    else
+    {
+        int exponent = (point - 1);
+
+        outBuff[length++] = digits[0];
+        if (1 < digitCount)
+        {
+            outBuff[length++] = '.';
+            memcpy(outBuff + length, digits + 1, digitCount - 1);
+            length += (digitCount - 1);
+        }
+        outBuff[length++] = 'e';
+        if (0 > exponent)
+        {
+            outBuff[length++] = '-';
+            exponent = -exponent;
+        }
+        else
+        {
+            outBuff[length++] = '+';
+        }
+        length += formatUnsigned(outBuff + length, static_cast<uint64_t>(exponent));
+    }
+    return length;
+} // formatDouble
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
 
+size_t
+StringBuffer::ConvertDouble(char *       outBuff,
+                            const double aDouble)
+{
+    ODL_ENTER(); //####
+    ODL_P1("outBuff = ", outBuff); //####
+    ODL_D1("aDouble = ", aDouble); //####
+    size_t result = formatDouble(outBuff, aDouble);
+
+    ODL_EXIT_LL(result); //####
+    return result;
+} // StringBuffer::ConvertDouble
+
 #if defined(__APPLE__)
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
@@ -107,13 +538,14 @@ StringBuffer::StringBuffer(void) :
     ODL_LL3("_currentLength = ", _currentLength, "_currentSize = ", _currentSize, //####
             "_thresholdLength = ", _thresholdLength); //####
     setSize(kInitialBufferSize);
+    *_buffer = '\0';
     ODL_EXIT_P(this); //####
 } // StringBuffer::StringBuffer
 
 StringBuffer::~StringBuffer(void)
 {
     ODL_OBJENTER(); //####
-    delete _buffer;
+    delete[] _buffer;
     ODL_OBJEXIT(); //####
 } // StringBuffer::~StringBuffer
 
@@ -122,17 +554,33 @@ StringBuffer::~StringBuffer(void)
 #endif // defined(__APPLE__)
 
 StringBuffer &
-StringBuffer::addChar(const char aChar)
+StringBuffer::addBytes(const char * someChars,
+                       const size_t numChars)
 {
     ODL_OBJENTER(); //####
-    ODL_C1("aChar = ", aChar); //####
-    if ((_currentLength + 1) >= _thresholdLength)
+    ODL_P1("someChars = ", someChars); //####
+    ODL_LL1("numChars = ", numChars); //####
+    if (someChars && (0 < numChars))
     {
-        ODL_LOG("((_currentLength + 1) >= _thresholdLength)"); //####
-        setSize(static_cast<size_t>(_currentSize * kBufferIncreaseFactor));
+        ensureSpace(numChars);
+        memcpy(_buffer + _currentLength, someChars, numChars);
+        _currentLength += numChars;
+        *(_buffer + _currentLength) = '\0';
+        ODL_LL1("_currentLength <- ", _currentLength); //####
     }
+    ODL_OBJEXIT_P(this); //####
+    return *this;
+} // StringBuffer::addBytes
+
+StringBuffer &
+StringBuffer::addChar(const char aChar)
+{
+    ODL_OBJENTER(); //####
+    ODL_C1("aChar = ", aChar); //####
+    ensureSpace(1);
     *(_buffer + _currentLength) = aChar;
     ++_currentLength;
+    *(_buffer + _currentLength) = '\0';
     ODL_LL1("_currentLength <- ", _currentLength); //####
     ODL_OBJEXIT_P(this); //####
     return *this;
@@ -143,25 +591,10 @@ StringBuffer::addDouble(const double aDouble)
 {
     ODL_OBJENTER(); //####
     ODL_D1("aDouble = ", aDouble); //####
-    char numBuff[kNumBuffSize];
-
-#if MAC_OR_LINUX_
-    snprintf(numBuff, sizeof(numBuff), "%g", aDouble);
-#else // ! MAC_OR_LINUX_
-    sprintf_s(numBuff, sizeof(numBuff), "%g", aDouble);
-#endif // ! MAC_OR_LINUX_
-    ODL_S1("numBuff <- ", numBuff); //####
-    size_t lengthToAdd = strlen(numBuff);
-
-    // Note that the array 'numBuff' is significantly smaller than the initial size of the internal
-    // buffer, so there's no need to calculate the increase factor to apply.
-    if ((_currentLength + lengthToAdd) >= _thresholdLength)
-    {
-        ODL_LOG("((_currentLength + lengthToAdd) >= _thresholdLength)"); //####
-        setSize(static_cast<size_t>(_currentSize * kBufferIncreaseFactor));
-    }
-    memcpy(_buffer + _currentLength, numBuff, lengthToAdd + 1);
-    _currentLength += lengthToAdd;
+    // Format directly into the internal buffer, as there's no need for a scratch copy.
+    ensureSpace(kMaxDoubleLength);
+    _currentLength += formatDouble(_buffer + _currentLength, aDouble);
+    *(_buffer + _currentLength) = '\0';
     ODL_LL1("_currentLength <- ", _currentLength); //####
     ODL_OBJEXIT_P(this); //####
     return *this;
@@ -172,21 +605,22 @@ StringBuffer::addLong(const int64_t aLong)
 {
     ODL_OBJENTER(); //####
     ODL_LL1("aLong = ", aLong); //####
-    char numBuff[kNumBuffSize];
-
-    snprintf(numBuff, sizeof(numBuff), "%" PRId64, aLong);
-    ODL_S1("numBuff <- ", numBuff); //####
-    size_t lengthToAdd = strlen(numBuff);
-
-    // Note that the array 'numBuff' is significantly smaller than the initial size of the internal
-    // buffer, so there's no need to calculate the increase factor to apply.
-    if ((_currentLength + lengthToAdd) >= _thresholdLength)
+    // Note that the longest value, including its sign, is significantly smaller than the scratch
+    // buffer size.
+    ensureSpace(kNumBuffSize);
+    if (0 > aLong)
     {
-        ODL_LOG("((_currentLength + lengthToAdd) >= _thresholdLength)"); //####
-        setSize(static_cast<size_t>(_currentSize * kBufferIncreaseFactor));
+        *(_buffer + _currentLength) = '-';
+        ++_currentLength;
+        // Negate in unsigned arithmetic, so that the most negative value is handled properly.
+        _currentLength += formatUnsigned(_buffer + _currentLength,
+                                         UINT64_C(0) - static_cast<uint64_t>(aLong));
     }
-    memcpy(_buffer + _currentLength, numBuff, lengthToAdd + 1);
-    _currentLength += lengthToAdd;
+    else
+    {
+        _currentLength += formatUnsigned(_buffer + _currentLength, static_cast<uint64_t>(aLong));
+    }
+    *(_buffer + _currentLength) = '\0';
     ODL_LL1("_currentLength <- ", _currentLength); //####
     ODL_OBJEXIT_P(this); //####
     return *this;
@@ -199,23 +633,7 @@ StringBuffer::addString(const char * aString)
     ODL_S1("aString = ", aString); //####
     if (aString)
     {
-        size_t lengthToAdd = strlen(aString);
-
-        if ((_currentLength + lengthToAdd) >= _thresholdLength)
-        {
-            ODL_LOG("((_currentLength + lengthToAdd) >= _thresholdLength)"); //####
-            double scaleFactor = ((kFactorSlop * (_currentLength + lengthToAdd)) / _currentLength);
-#if MAC_OR_LINUX_
-            double factorToUse = std::max(scaleFactor, kBufferIncreaseFactor);
-#else // ! MAC_OR_LINUX_
-            double factorToUse = max(scaleFactor, kBufferIncreaseFactor);
-#endif // ! MAC_OR_LINUX_
-
-            setSize(static_cast<size_t>(_currentSize * factorToUse));
-        }
-        memcpy(_buffer + _currentLength, aString, lengthToAdd + 1);
-        _currentLength += lengthToAdd;
-        ODL_LL1("_currentLength <- ", _currentLength); //####
+        addBytes(aString, strlen(aString));
     }
     ODL_OBJEXIT_P(this); //####
     return *this;
@@ -226,28 +644,7 @@ StringBuffer::addString(const YarpString & aString)
 {
     ODL_OBJENTER(); //####
     ODL_S1s("aString = ", aString); //####
-    const char * actualString = aString.c_str();
-
-    if (actualString)
-    {
-        size_t lengthToAdd = strlen(actualString);
-
-        if ((_currentLength + lengthToAdd) >= _thresholdLength)
-        {
-            ODL_LOG("((_currentLength + lengthToAdd) >= _thresholdLength)"); //####
-            double scaleFactor = ((kFactorSlop * (_currentLength + lengthToAdd)) / _currentLength);
-#if MAC_OR_LINUX_
-            double factorToUse = std::max(scaleFactor, kBufferIncreaseFactor);
-#else // ! MAC_OR_LINUX_
-            double factorToUse = max(scaleFactor, kBufferIncreaseFactor);
-#endif // ! MAC_OR_LINUX_
-
-            setSize(static_cast<size_t>(_currentSize * factorToUse));
-        }
-        memcpy(_buffer + _currentLength, actualString, lengthToAdd + 1);
-        _currentLength += lengthToAdd;
-        ODL_LL1("_currentLength <- ", _currentLength); //####
-    }
+    addBytes(aString.c_str(), aString.length());
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // StringBuffer::addString
@@ -256,23 +653,40 @@ StringBuffer &
 StringBuffer::addTab(void)
 {
     ODL_OBJENTER(); //####
-    if ((_currentLength + 1) >= _thresholdLength)
-    {
-        ODL_LOG("((_currentLength + 1) >= _thresholdLength)"); //####
-        setSize(static_cast<size_t>(_currentSize * kBufferIncreaseFactor));
-    }
-    *(_buffer + _currentLength) = '\t';
-    ++_currentLength;
-    ODL_LL1("_currentLength <- ", _currentLength); //####
+    addChar('\t');
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // StringBuffer::addTab
 
+void
+StringBuffer::grow(const size_t numChars)
+{
+    ODL_OBJENTER(); //####
+    ODL_LL1("numChars = ", numChars); //####
+    // Grow geometrically, but leave some extra room if a single addition is larger than the usual
+    // increase.
+    size_t required = static_cast<size_t>(kFactorSlop * (_currentLength + numChars + 1));
+    size_t newSize = static_cast<size_t>(_currentSize * kBufferIncreaseFactor);
+
+    if (newSize < required)
+    {
+        newSize = required;
+    }
+    // Make sure that the threshold will be beyond the new length.
+    while (static_cast<size_t>(newSize * kThresholdFactor) <= (_currentLength + numChars))
+    {
+        newSize = static_cast<size_t>(newSize * kBufferIncreaseFactor) + 1;
+    }
+    setSize(newSize);
+    ODL_OBJEXIT(); //####
+} // StringBuffer::grow
+
 StringBuffer &
 StringBuffer::reset(void)
 {
     ODL_OBJENTER(); //####
     _currentLength = 0;
+    *_buffer = '\0';
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // StringBuffer::reset
@@ -284,9 +698,17 @@ StringBuffer::setSize(const size_t newSize)
     ODL_LL1("newSize = ", newSize); //####
     char * newBuffer = new char[newSize];
 
-    if (_buffer && (0 < _currentLength))
+    if (_buffer)
     {
-        memcpy(newBuffer, _buffer, _currentLength);
+        if (0 < _currentLength)
+        {
+            memcpy(newBuffer, _buffer, _currentLength + 1);
+        }
+        else
+        {
+            *newBuffer = '\0';
+        }
+        delete[] _buffer;
     }
     _buffer = newBuffer;
     ODL_P1("_buffer <- ", _buffer); //####
@@ -74,6 +74,14 @@ namespace MplusM
             virtual
             ~StringBuffer(void);
 
+            /*! @brief Add a sequence of characters to the buffer.
+             @param[in] someChars The characters to add, which need not be null-terminated.
+             @param[in] numChars The number of characters to add.
+             @returns The StringBuffer object so that cascading can be done. */
+            StringBuffer &
+            addBytes(const char * someChars,
+                     const size_t numChars);
+
             /*! @brief Add a character to the buffer.
              @param[in] aChar The character to add.
              @returns The StringBuffer object so that cascading can be done. */
@@ -82,6 +90,8 @@ namespace MplusM
 
             /*! @brief Add a character string representation of a floating-point value to the
              buffer.
+
+             The shortest representation that reads back as the same value is used.
              @param[in] aDouble The value to add.
              @returns The StringBuffer object so that cascading can be done. */
             StringBuffer &
@@ -122,6 +132,16 @@ namespace MplusM
                 return _buffer;
             } // getString
 
+            /*! @brief Write the shortest character string representation of a floating-point
+             value that reads back as the same value.
+             @param[out] outBuff The buffer to be written to, which must hold at least
+             @c kMaxDoubleLength characters. A terminating null is not added.
+             @param[in] aDouble The value to be converted.
+             @returns The number of characters written. */
+            static size_t
+            ConvertDouble(char *       outBuff,
+                          const double aDouble);
+
             /*! @brief Return the number of valid charaacters in the buffer.
              @returns The number of valid characters in the buffer. */
             inline size_t
@@ -149,6 +169,24 @@ namespace MplusM
             StringBuffer &
             operator =(const StringBuffer & other);
 
+            /*! @brief Make sure that there is room for additional characters, as well as a
+             terminating null, in the internal buffer.
+             @param[in] numChars The number of characters that will be added. */
+            inline void
+            ensureSpace(const size_t numChars)
+            {
+                if ((_currentLength + numChars) >= _thresholdLength)
+                {
+                    grow(numChars);
+                }
+            } // ensureSpace
+
+            /*! @brief Increase the size of the internal buffer so that additional characters
+             can be added.
+             @param[in] numChars The number of characters that will be added. */
+            void
+            grow(const size_t numChars);
+
             /*! @brief Increase the size of the internal buffer, copying the current contents into
              the new buffer.
              @param[in] newSize The size for the new internal buffer. */
@@ -157,6 +195,9 @@ namespace MplusM
 
         public :
 
+            /*! @brief The maximum number of characters produced by ConvertDouble(). */
+            static const size_t kMaxDoubleLength = 32;
+
         protected :
 
         private :
@@ -40,6 +40,7 @@
 
 #include <m+m/m+mBaseClient.hpp>
 #include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mConnectionGatherThread.hpp>
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mServiceRequest.hpp>
 #include <m+m/m+mServiceResponse.hpp>
@@ -106,11 +107,24 @@
 #endif // ! defined(__APPLE__)
 
 #if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <fcntl.h>
 # include <netdb.h>
+# include <netinet/in.h>
+# include <poll.h>
 # include <pwd.h>
+# include <unistd.h>
 # include <uuid/uuid.h>
 #endif // MAC_OR_LINUX_
 
+#if defined(__APPLE__)
+# include <mach/mach.h>
+# include <mach/thread_policy.h>
+#elif LINUX_
+# include <pthread.h>
+# include <sched.h>
+#endif // LINUX_
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -162,6 +176,104 @@ static const char * kLineMarker = "registration name ";
 /*! @brief The part name being used for probing connections. */
 static const char * kMagicName = "<$probe>";
 
+/*! @brief The start of the answer of a YARP port to the text form of the handshake. */
+static const char kPortProbeReply[] = "Welcome ";
+
+/*! @brief The maximum number of ports that are checked at the same time when looking for stale
+ ports. */
+static const size_t kMaxConcurrentPortProbes = 128;
+
+/*! @brief The number of seconds allowed to check a port, if no time is given. */
+static const double kDefaultPortProbeTime = 5;
+
+/*! @brief The maximum number of ports that are inspected at the same time when gathering a
+ connection graph, if no limit is given. */
+static const size_t kDefaultConcurrentConnectionGathers = 32;
+
+/*! @brief A mapping from port names to positions in a connection graph. */
+typedef std::map<YarpString, size_t> PortIndexMap;
+
+/*! @brief The progress of a check of a port. */
+enum PortProbeState
+{
+    /*! @brief The port has not been checked yet. */
+    kPortProbeStatePending,
+
+    /*! @brief A connection to the port has been started. */
+    kPortProbeStateActive,
+
+    /*! @brief The port accepted a connection and the YARP handshake has been sent. */
+    kPortProbeStateHandshake,
+
+    /*! @brief The port completed the YARP handshake. */
+    kPortProbeStateAlive,
+
+    /*! @brief The port refused a connection, did not respond in time or did not answer as a YARP
+     port. */
+    kPortProbeStateStale,
+
+    /*! @brief The port could not be checked before the sweep ran out of time. */
+    kPortProbeStateUnchecked
+
+}; // PortProbeState
+
+/*! @brief The information needed to check a port. */
+struct PortProbe
+{
+    /*! @brief The registered name of the port. */
+    YarpString _portName;
+
+    /*! @brief The connection information for the port. */
+    yarp::os::Contact _contact;
+
+    /*! @brief The network address of the port. */
+    struct sockaddr_in _address;
+
+    /*! @brief The time by which the port must accept a connection or answer the handshake. */
+    double _deadline;
+
+    /*! @brief The part of the answer to the handshake that has arrived. */
+    YarpString _reply;
+
+    /*! @brief The socket being used to connect to the port. */
+    SOCKET _socket;
+
+    /*! @brief The progress of the check. */
+    PortProbeState _state;
+
+}; // PortProbe
+
+/*! @brief A sequence of port checks. */
+typedef std::vector<PortProbe> PortProbeVector;
+
+#if defined(MpM_UseSharedMemoryTransport)
+/*! @brief The number of seconds that the host of a channel is remembered. */
+static const double kChannelHostLifetime = 30;
+
+/*! @brief The largest number of channel hosts that are remembered. */
+static const size_t kMaxChannelHosts = 1024;
+
+/*! @brief The host of a channel, as reported by the name server. */
+struct ChannelHost
+{
+    /*! @brief The host address of the channel. */
+    YarpString _host;
+
+    /*! @brief The time at which the host was reported. */
+    double _reportTime;
+
+}; // ChannelHost
+
+/*! @brief A mapping from channel names to their hosts. */
+typedef std::map<YarpString, ChannelHost> ChannelHostMap;
+
+/*! @brief The hosts of the channels that have been connected recently. */
+static ChannelHostMap lChannelHosts;
+
+/*! @brief The contention lock for the channel hosts. */
+static yarp::os::Mutex lChannelHostsLock;
+#endif // defined(MpM_UseSharedMemoryTransport)
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -214,6 +326,99 @@ getNameServerPortList(yarp::os::Bottle & response)
     return okSoFar;
 } // getNameServerPortList
 
+#if defined(MpM_UseSharedMemoryTransport)
+/*! @brief Get the host of a channel, asking the name server only if the host is not known or was
+ found too long ago.
+
+ A channel that has moved to another host since it was last seen only leads to a shared memory
+ connection being tried and failing, which falls back to TCP.
+ @param[in] channelName The name of the channel.
+ @param[out] host The host address of the channel.
+ @returns @c true if the host of the channel is known and @c false otherwise. */
+static bool
+getChannelHost(const YarpString & channelName,
+               YarpString &       host)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("channelName = ", channelName); //####
+    ODL_P1("host = ", &host); //####
+    bool   result = false;
+    double now = yarp::os::Time::now();
+
+    lChannelHostsLock.lock();
+    ChannelHostMap::const_iterator match(lChannelHosts.find(channelName));
+
+    if ((lChannelHosts.end() != match) &&
+        (kChannelHostLifetime > (now - match->second._reportTime)))
+    {
+        host = match->second._host;
+        result = true;
+    }
+    lChannelHostsLock.unlock();
+    if (! result)
+    {
+        yarp::os::Contact channelContact = yarp::os::Network::queryName(channelName);
+
+        if (channelContact.isValid())
+        {
+            host = channelContact.getHost();
+            result = (0 < host.length());
+        }
+        else
+        {
+            ODL_LOG("! (channelContact.isValid())"); //####
+        }
+        if (result)
+        {
+            ChannelHost newHost;
+
+            newHost._host = host;
+            newHost._reportTime = now;
+            lChannelHostsLock.lock();
+            // Most of the remembered channels will be gone by the time the limit is reached.
+            if ((kMaxChannelHosts <= lChannelHosts.size()) &&
+                (lChannelHosts.end() == lChannelHosts.find(channelName)))
+            {
+                lChannelHosts.clear();
+            }
+            lChannelHosts[channelName] = newHost;
+            lChannelHostsLock.unlock();
+        }
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // getChannelHost
+
+/*! @brief Check if two channels are hosted on the same machine.
+ @param[in] sourceName The name of the source channel.
+ @param[in] destinationName The name of the destination channel.
+ @returns @c true if both channels are registered with the same host address and @c false
+ otherwise. */
+static bool
+channelsShareAHost(const YarpString & sourceName,
+                   const YarpString & destinationName)
+{
+    ODL_ENTER(); //####
+    ODL_S2s("sourceName = ", sourceName, "destinationName = ", destinationName); //####
+    bool       result;
+    YarpString destinationHost;
+    YarpString sourceHost;
+
+    if (getChannelHost(sourceName, sourceHost) && getChannelHost(destinationName, destinationHost))
+    {
+        result = (sourceHost == destinationHost);
+    }
+    else
+    {
+        ODL_LOG("! (getChannelHost(sourceName, sourceHost) && " //####
+                "getChannelHost(destinationName, destinationHost))"); //####
+        result = false;
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // channelsShareAHost
+#endif // defined(MpM_UseSharedMemoryTransport)
+
 #if (! MAC_OR_LINUX_)
 # pragma warning(push)
 # pragma warning(disable: 4100)
@@ -567,6 +772,82 @@ checkForOutputConnection(const yarp::os::Bottle & response,
     ODL_EXIT(); //####
 } // checkForOutputConnection
 
+/*! @brief Check if a set of connections includes a connection with a port.
+ @param[in] connections The connections to be checked.
+ @param[in] portName The port to be looked for.
+ @returns @c true if there is a connection with the port and @c false otherwise. */
+static bool
+hasConnectionWithPort(const ChannelVector & connections,
+                      const YarpString &    portName)
+{
+    ODL_ENTER(); //####
+    ODL_P1("connections = ", &connections); //####
+    ODL_S1s("portName = ", portName); //####
+    bool result = false;
+
+    for (ChannelVector::const_iterator walker(connections.begin());
+         (! result) && (connections.end() != walker); ++walker)
+    {
+        result = (walker->_portName == portName);
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // hasConnectionWithPort
+
+/*! @brief Remove the connections that are only reported by one of the two ports involved.
+
+ A connection that is made or broken while a connection graph is being gathered can be seen by one
+ of the ports and not the other; only connections that both ports agree on, or that involve a port
+ that was not inspected or did not answer, are retained.
+ @param[in,out] graph The connection graph to be updated. */
+static void
+reconcileConnectionGraph(PortConnectionsVector & graph)
+{
+    ODL_ENTER(); //####
+    ODL_P1("graph = ", &graph); //####
+    PortIndexMap          answered;
+    PortConnectionsVector reconciled(graph);
+
+    for (size_t ii = 0, mm = graph.size(); mm > ii; ++ii)
+    {
+        if (graph[ii]._answered)
+        {
+            answered[graph[ii]._portName] = ii;
+        }
+    }
+    for (size_t ii = 0, mm = graph.size(); mm > ii; ++ii)
+    {
+        const PortConnections & original = graph[ii];
+        PortConnections &       updated = reconciled[ii];
+        PortIndexMap::iterator  match;
+
+        updated._inputs.clear();
+        updated._outputs.clear();
+        for (ChannelVector::const_iterator walker(original._inputs.begin());
+             original._inputs.end() != walker; ++walker)
+        {
+            match = answered.find(walker->_portName);
+            if ((answered.end() == match) ||
+                hasConnectionWithPort(graph[match->second]._outputs, original._portName))
+            {
+                updated._inputs.push_back(*walker);
+            }
+        }
+        for (ChannelVector::const_iterator walker(original._outputs.begin());
+             original._outputs.end() != walker; ++walker)
+        {
+            match = answered.find(walker->_portName);
+            if ((answered.end() == match) ||
+                hasConnectionWithPort(graph[match->second]._inputs, original._portName))
+            {
+                updated._outputs.push_back(*walker);
+            }
+        }
+    }
+    graph.swap(reconciled);
+    ODL_EXIT(); //####
+} // reconcileConnectionGraph
+
 /*! @brief Add a service metrics property to a string.
  @param[in] propList The dictionary to process.
  @param[in] flavour The output format to be used.
@@ -875,125 +1156,218 @@ processNameServerResponse(const YarpString & received,
     ODL_EXIT(); //####
 } // processNameServerResponse
 
-/*! @brief Convert a YARP value into a JSON element.
+#if defined(MpM_UseCustomStringBuffer)
+/*! @brief The type of buffer used to assemble JSON output. */
+typedef Common::StringBuffer JSONBuffer;
+#else // ! defined(MpM_UseCustomStringBuffer)
+/*! @brief The type of buffer used to assemble JSON output. */
+typedef std::stringstream JSONBuffer;
+#endif // ! defined(MpM_UseCustomStringBuffer)
+
+/*! @brief Add a sequence of characters to a JSON output buffer.
  @param[in,out] outBuffer The buffer to be written to.
- @param[in] inputValue The value to be processed. */
+ @param[in] someChars The characters to add.
+ @param[in] numChars The number of characters to add. */
+static inline void
+appendBytes(JSONBuffer & outBuffer,
+            const char * someChars,
+            const size_t numChars)
+{
 #if defined(MpM_UseCustomStringBuffer)
-static void
-processValue(Common::StringBuffer &  outBuffer,
-             const yarp::os::Value & inputValue);
+    outBuffer.addBytes(someChars, numChars);
 #else // ! defined(MpM_UseCustomStringBuffer)
-static void
-processValue(std::stringstream &     outBuffer,
-             const yarp::os::Value & inputValue);
+    outBuffer.write(someChars, numChars);
 #endif // ! defined(MpM_UseCustomStringBuffer)
+} // appendBytes
 
-/*! @brief Convert a YARP string into a JSON string.
+/*! @brief Add a single character to a JSON output buffer.
  @param[in,out] outBuffer The buffer to be written to.
- @param[in] inputString The string to be processed. */
+ @param[in] aChar The character to add. */
+static inline void
+appendChar(JSONBuffer & outBuffer,
+           const char   aChar)
+{
 #if defined(MpM_UseCustomStringBuffer)
-static void
-processString(Common::StringBuffer & outBuffer,
-              const YarpString &     inputString)
+    outBuffer.addChar(aChar);
 #else // ! defined(MpM_UseCustomStringBuffer)
-static void
-processString(std::stringstream & outBuffer,
-              const YarpString &  inputString)
+    outBuffer.put(aChar);
 #endif // ! defined(MpM_UseCustomStringBuffer)
+} // appendChar
+
+/*! @brief Add a string literal to a JSON output buffer.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] literal_ The string literal to add. */
+#define APPEND_LITERAL_(outBuffer, literal_) \
+    appendBytes(outBuffer, literal_, sizeof(literal_) - 1)
+
+/*! @brief Add a floating-point number to a JSON output buffer.
+
+ JSON has no representation for infinities or NaNs, so they are written as @c null.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] aDouble The value to add. */
+static void
+appendDouble(JSONBuffer & outBuffer,
+             const double aDouble)
 {
     ODL_ENTER(); //####
-    ODL_P2("outBuffer = ", &outBuffer, "inputString = ", &inputString); //####
+    ODL_P1("outBuffer = ", &outBuffer); //####
+    ODL_D1("aDouble = ", aDouble); //####
+    if ((aDouble != aDouble) || ((aDouble - aDouble) != 0))
+    {
+        APPEND_LITERAL_(outBuffer, "null");
+    }
+    else
+    {
+        char numBuff[Common::StringBuffer::kMaxDoubleLength];
+
+        appendBytes(outBuffer, numBuff, Common::StringBuffer::ConvertDouble(numBuff, aDouble));
+    }
+    ODL_EXIT(); //####
+} // appendDouble
+
+/*! @brief Add an integer to a JSON output buffer.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] aLong The value to add. */
+static inline void
+appendLong(JSONBuffer &  outBuffer,
+           const int64_t aLong)
+{
 #if defined(MpM_UseCustomStringBuffer)
-    outBuffer.addChar('"');
+    outBuffer.addLong(aLong);
 #else // ! defined(MpM_UseCustomStringBuffer)
-    outBuffer << '"';
+    outBuffer << aLong;
 #endif // ! defined(MpM_UseCustomStringBuffer)
-    for (size_t ii = 0, mm = inputString.length(); mm > ii; ++ii)
+} // appendLong
+
+/*! @brief Check if a list has the form of a dictionary, without building the dictionary.
+
+ This applies the same rules as ListIsReallyDictionary(), but doesn't allocate anything.
+ @param[in] aList The list of interest.
+ @returns @c true if the list can be treated as a dictionary and @c false otherwise. */
+static bool
+listHasDictionaryForm(const yarp::os::Bottle & aList)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aList = ", &aList); //####
+    int  mm = aList.size();
+    bool isDictionary = (0 < mm);
+
+    for (int ii = 0; isDictionary && (mm > ii); ++ii)
+    {
+        const yarp::os::Value & anEntry = aList.get(ii);
+        yarp::os::Bottle *      entryAsList = (anEntry.isList() ? anEntry.asList() : NULL);
+
+        if (entryAsList && (2 == entryAsList->size()) && entryAsList->get(0).isString())
+        {
+            // Duplicate keys mean that this isn't a dictionary; the lists that we see are short,
+            // so a direct comparison is cheaper than building a set.
+            YarpString key(entryAsList->get(0).asString());
+
+            for (int jj = 0; isDictionary && (ii > jj); ++jj)
+            {
+                if (key == aList.get(jj).asList()->get(0).asString())
+                {
+                    isDictionary = false;
+                }
+            }
+        }
+        else
+        {
+            isDictionary = false;
+        }
+    }
+    ODL_EXIT_B(isDictionary); //####
+    return isDictionary;
+} // listHasDictionaryForm
+
+/*! @brief Convert a YARP value into a JSON element.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] inputValue The value to be processed. */
+static void
+processValue(JSONBuffer &            outBuffer,
+             const yarp::os::Value & inputValue);
+
+/*! @brief Convert a YARP string into a JSON string.
+
+ Runs of characters that don't need escaping are copied in a single operation.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] inputString The string to be processed. */
+static void
+processString(JSONBuffer &       outBuffer,
+              const YarpString & inputString)
+{
+    ODL_ENTER(); //####
+    ODL_P2("outBuffer = ", &outBuffer, "inputString = ", &inputString); //####
+    static const char kHexDigits[] = "0123456789abcdef";
+    const char *      startOfRun = inputString.c_str();
+    const char *      endOfString = startOfRun + inputString.length();
+
+    appendChar(outBuffer, '"');
+    for (const char * walker = startOfRun; endOfString > walker; ++walker)
     {
-        char aChar = inputString[ii];
+        char aChar = *walker;
+        char escaped;
 
         switch (aChar)
         {
             case '\\' :
             case '"' :
             case '/' :
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addChar(kEscapeChar).addChar(aChar);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << kEscapeChar << aChar;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                escaped = aChar;
                 break;
 
             case '\b' :
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addChar(kEscapeChar).addChar('b');
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << kEscapeChar << 'b';
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                escaped = 'b';
                 break;
 
             case '\f' :
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addChar(kEscapeChar).addChar('f');
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << kEscapeChar << 'f';
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                escaped = 'f';
                 break;
 
             case '\n' :
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addChar(kEscapeChar).addChar('n');
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << kEscapeChar << 'n';
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                escaped = 'n';
                 break;
 
             case '\r' :
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addChar(kEscapeChar).addChar('r');
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << kEscapeChar << 'r';
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                escaped = 'r';
                 break;
 
             case '\t' :
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addChar(kEscapeChar).addChar('t');
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << kEscapeChar << 't';
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                escaped = 't';
                 break;
 
             default :
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addChar(aChar);
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << aChar;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                // Other control characters must be written as Unicode escapes.
+                escaped = ((0x20 > static_cast<unsigned char>(aChar)) ? 'u' : '\0');
                 break;
 
         }
+        if (escaped)
+        {
+            appendBytes(outBuffer, startOfRun, walker - startOfRun);
+            appendChar(outBuffer, kEscapeChar);
+            appendChar(outBuffer, escaped);
+            if ('u' == escaped)
+            {
+                char hexBuff[4] = { '0', '0', kHexDigits[(aChar >> 4) & 0x0F],
+                                    kHexDigits[aChar & 0x0F] };
+
+                appendBytes(outBuffer, hexBuff, sizeof(hexBuff));
+            }
+            startOfRun = walker + 1;
+        }
     }
-#if defined(MpM_UseCustomStringBuffer)
-    outBuffer.addChar('"');
-#else // ! defined(MpM_UseCustomStringBuffer)
-    outBuffer << '"';
-#endif // ! defined(MpM_UseCustomStringBuffer)
+    appendBytes(outBuffer, startOfRun, endOfString - startOfRun);
+    appendChar(outBuffer, '"');
     ODL_EXIT(); //####
 } // processString
 
 /*! @brief Convert a YARP dictionary into a JSON object.
  @param[in,out] outBuffer The buffer to be written to.
  @param[in] inputDictionary The dictionary to be processed. */
-#if defined(MpM_UseCustomStringBuffer)
 static void
-processDictionary(Common::StringBuffer &     outBuffer,
+processDictionary(JSONBuffer &               outBuffer,
                   const yarp::os::Property & inputDictionary)
-#else // ! defined(MpM_UseCustomStringBuffer)
-static void
-processDictionary(std::stringstream &        outBuffer,
-                  const yarp::os::Property & inputDictionary)
-#endif // ! defined(MpM_UseCustomStringBuffer)
 {
     ODL_ENTER(); //####
     ODL_P2("outBuffer = ", &outBuffer, "inputDictionary = ", &inputDictionary); //####
@@ -1001,14 +1375,10 @@ processDictionary(std::stringstream &        outBuffer,
 
     // A dictionary converted to a string is a list of two-element lists, with the key as the first
     // entry and the value as the second.
-#if defined(MpM_UseCustomStringBuffer)
-    outBuffer.addString("{ ");
-#else // ! defined(MpM_UseCustomStringBuffer)
-    outBuffer << "{ ";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+    APPEND_LITERAL_(outBuffer, "{ ");
     for (int ii = 0, mm = asList.size(); mm > ii; ++ii)
     {
-        yarp::os::Value anEntry(asList.get(ii));
+        const yarp::os::Value & anEntry = asList.get(ii);
 
         if (anEntry.isList())
         {
@@ -1018,119 +1388,96 @@ processDictionary(std::stringstream &        outBuffer,
             {
                 if (0 < ii)
                 {
-#if defined(MpM_UseCustomStringBuffer)
-                    outBuffer.addString(", ");
-#else // ! defined(MpM_UseCustomStringBuffer)
-                    outBuffer << ", ";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                    APPEND_LITERAL_(outBuffer, ", ");
                 }
                 processString(outBuffer, entryAsList->get(0).toString());
-#if defined(MpM_UseCustomStringBuffer)
-                outBuffer.addString(" : ");
-#else // ! defined(MpM_UseCustomStringBuffer)
-                outBuffer << " : ";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+                APPEND_LITERAL_(outBuffer, " : ");
                 processValue(outBuffer, entryAsList->get(1));
             }
         }
     }
-#if defined(MpM_UseCustomStringBuffer)
-    outBuffer.addString(" }");
-#else // ! defined(MpM_UseCustomStringBuffer)
-    outBuffer << " }";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+    APPEND_LITERAL_(outBuffer, " }");
     ODL_EXIT(); //####
 } // processDictionary
 
-/*! @brief Convert a YARP list into a JSON array.
+/*! @brief Convert a YARP list that has the form of a dictionary into a JSON object.
+
+ The entries are written in list order, directly from the list.
  @param[in,out] outBuffer The buffer to be written to.
  @param[in] inputList The list to be processed. */
-#if defined(MpM_UseCustomStringBuffer)
 static void
-processList(Common::StringBuffer &   outBuffer,
-            const yarp::os::Bottle & inputList)
-#else // ! defined(MpM_UseCustomStringBuffer)
+processDictionaryList(JSONBuffer &             outBuffer,
+                      const yarp::os::Bottle & inputList)
+{
+    ODL_ENTER(); //####
+    ODL_P2("outBuffer = ", &outBuffer, "inputList = ", &inputList); //####
+    APPEND_LITERAL_(outBuffer, "{ ");
+    for (int ii = 0, mm = inputList.size(); mm > ii; ++ii)
+    {
+        yarp::os::Bottle * entryAsList = inputList.get(ii).asList();
+
+        if (0 < ii)
+        {
+            APPEND_LITERAL_(outBuffer, ", ");
+        }
+        processString(outBuffer, entryAsList->get(0).asString());
+        APPEND_LITERAL_(outBuffer, " : ");
+        processValue(outBuffer, entryAsList->get(1));
+    }
+    APPEND_LITERAL_(outBuffer, " }");
+    ODL_EXIT(); //####
+} // processDictionaryList
+
+/*! @brief Convert a YARP list into a JSON array.
+ @param[in,out] outBuffer The buffer to be written to.
+ @param[in] inputList The list to be processed. */
 static void
-processList(std::stringstream &      outBuffer,
+processList(JSONBuffer &             outBuffer,
             const yarp::os::Bottle & inputList)
-#endif // ! defined(MpM_UseCustomStringBuffer)
 {
     ODL_ENTER(); //####
     ODL_P2("outBuffer = ", &outBuffer, "inputList = ", &inputList); //####
-#if defined(MpM_UseCustomStringBuffer)
-    outBuffer.addString("[ ");
-#else // ! defined(MpM_UseCustomStringBuffer)
-    outBuffer << "( ";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+    APPEND_LITERAL_(outBuffer, "[ ");
     for (int ii = 0, mm = inputList.size(); mm > ii; ++ii)
     {
-        yarp::os::Value aValue(inputList.get(ii));
-
         if (0 < ii)
         {
-#if defined(MpM_UseCustomStringBuffer)
-            outBuffer.addString(", ");
-#else // ! defined(MpM_UseCustomStringBuffer)
-            outBuffer << ", ";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+            APPEND_LITERAL_(outBuffer, ", ");
         }
-        processValue(outBuffer, aValue);
+        processValue(outBuffer, inputList.get(ii));
     }
-#if defined(MpM_UseCustomStringBuffer)
-    outBuffer.addString(" ]");
-#else // ! defined(MpM_UseCustomStringBuffer)
-    outBuffer << " ]";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+    APPEND_LITERAL_(outBuffer, " ]");
     ODL_EXIT(); //####
 } // processList
 
-#if defined(MpM_UseCustomStringBuffer)
-static void
-processValue(Common::StringBuffer &  outBuffer,
-             const yarp::os::Value & inputValue)
-#else // ! defined(MpM_UseCustomStringBuffer)
 static void
-processValue(std::stringstream &     outBuffer,
+processValue(JSONBuffer &            outBuffer,
              const yarp::os::Value & inputValue)
-#endif // ! defined(MpM_UseCustomStringBuffer)
 {
     ODL_ENTER(); //####
     ODL_P2("outBuffer = ", &outBuffer, "inputValue = ", &inputValue); //####
     if (inputValue.isBool())
     {
-        bool value = inputValue.asBool();
-
-#if defined(MpM_UseCustomStringBuffer)
-        outBuffer.addString(value ? "true" : "false");
-#else // ! defined(MpM_UseCustomStringBuffer)
-        outBuffer << (value ? "true" : "false");
-#endif // ! defined(MpM_UseCustomStringBuffer)
+        if (inputValue.asBool())
+        {
+            APPEND_LITERAL_(outBuffer, "true");
+        }
+        else
+        {
+            APPEND_LITERAL_(outBuffer, "false");
+        }
     }
     else if (inputValue.isInt())
     {
-        int value = inputValue.asInt();
-
-#if defined(MpM_UseCustomStringBuffer)
-        outBuffer.addLong(value);
-#else // ! defined(MpM_UseCustomStringBuffer)
-        outBuffer << value;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+        appendLong(outBuffer, inputValue.asInt());
     }
     else if (inputValue.isString())
     {
-        YarpString value = inputValue.asString();
-
-        processString(outBuffer, value);
+        processString(outBuffer, inputValue.asString());
     }
     else if (inputValue.isDouble())
     {
-        double value = inputValue.asDouble();
-
-#if defined(MpM_UseCustomStringBuffer)
-        outBuffer.addDouble(value);
-#else // ! defined(MpM_UseCustomStringBuffer)
-        outBuffer << value;
-#endif // ! defined(MpM_UseCustomStringBuffer)
+        appendDouble(outBuffer, inputValue.asDouble());
     }
     else if (inputValue.isDict())
     {
@@ -1147,11 +1494,9 @@ processValue(std::stringstream &     outBuffer,
 
         if (value)
         {
-            yarp::os::Property asDict;
-
-            if (ListIsReallyDictionary(*value, asDict))
+            if (listHasDictionaryForm(*value))
             {
-                processDictionary(outBuffer, asDict);
+                processDictionaryList(outBuffer, *value);
             }
             else
             {
@@ -1162,15 +1507,440 @@ processValue(std::stringstream &     outBuffer,
     else
     {
         // We don't know what to do with this...
-#if defined(MpM_UseCustomStringBuffer)
-        outBuffer.addString("null");
-#else // ! defined(MpM_UseCustomStringBuffer)
-        outBuffer << "null";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+        APPEND_LITERAL_(outBuffer, "null");
     }
     ODL_EXIT(); //####
 } // processValue
 
+/*! @brief Release the socket being used to check a port.
+ @param[in,out] probe The port check to be updated.
+ @param[in] newState The result of the check. */
+static void
+finishPortProbe(PortProbe &          probe,
+                const PortProbeState newState)
+{
+    ODL_ENTER(); //####
+    ODL_P1("probe = ", &probe); //####
+    ODL_LL1("newState = ", newState); //####
+    if (INVALID_SOCKET != probe._socket)
+    {
+#if MAC_OR_LINUX_
+        close(probe._socket);
+#else // ! MAC_OR_LINUX_
+        closesocket(probe._socket);
+#endif // ! MAC_OR_LINUX_
+        probe._socket = INVALID_SOCKET;
+    }
+    probe._state = newState;
+    ODL_EXIT(); //####
+} // finishPortProbe
+
+/*! @brief Fill in the network address of a port.
+ @param[out] address The network address of the port.
+ @param[in] hostName The host of the port, as an IP address or a host name.
+ @param[in] portNumber The port number of the port.
+ @returns @c true if the address was determined and @c false otherwise. */
+static bool
+getPortProbeAddress(struct sockaddr_in & address,
+                    const YarpString &   hostName,
+                    const int            portNumber)
+{
+    ODL_ENTER(); //####
+    ODL_P1("address = ", &address); //####
+    ODL_S1s("hostName = ", hostName); //####
+    ODL_LL1("portNumber = ", portNumber); //####
+    bool okSoFar;
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<u_short>(portNumber));
+#if MAC_OR_LINUX_
+    okSoFar = (0 < inet_pton(AF_INET, hostName.c_str(), &address.sin_addr));
+#else // ! MAC_OR_LINUX_
+    okSoFar = (0 < InetPton(AF_INET, hostName.c_str(), &address.sin_addr));
+#endif // ! MAC_OR_LINUX_
+    if (! okSoFar)
+    {
+        // The name server normally holds numeric addresses, so this is rarely needed.
+        struct addrinfo   hints;
+        struct addrinfo * results = NULL;
+
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        if ((! getaddrinfo(hostName.c_str(), NULL, &hints, &results)) && results)
+        {
+            memcpy(&address.sin_addr,
+                   &reinterpret_cast<struct sockaddr_in *>(results->ai_addr)->sin_addr,
+                   sizeof(address.sin_addr));
+            okSoFar = true;
+        }
+        if (results)
+        {
+            freeaddrinfo(results);
+        }
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // getPortProbeAddress
+
+/*! @brief Read the answer of a port to the YARP handshake.
+ @param[in,out] probe The port check to be updated.
+ @returns @c true if the answer is complete or the port closed the connection and @c false if more
+ of the answer is expected. */
+static bool
+readPortProbeReply(PortProbe & probe)
+{
+    ODL_ENTER(); //####
+    ODL_P1("probe = ", &probe); //####
+    bool   done = true;
+    char   buffer[sizeof(kPortProbeReply)];
+    size_t wanted = sizeof(kPortProbeReply) - 1 - probe._reply.length();
+#if MAC_OR_LINUX_
+    ssize_t received = recv(probe._socket, buffer, wanted, 0);
+#else // ! MAC_OR_LINUX_
+    int     received = recv(probe._socket, buffer, static_cast<int>(wanted), 0);
+#endif // ! MAC_OR_LINUX_
+
+    if (0 < received)
+    {
+        probe._reply += YarpString(buffer, static_cast<size_t>(received));
+        if (probe._reply.length() < (sizeof(kPortProbeReply) - 1))
+        {
+            done = false;
+        }
+        else
+        {
+            // Something that is not a YARP port has taken over the port number.
+            finishPortProbe(probe, (probe._reply == kPortProbeReply) ? kPortProbeStateAlive :
+                            kPortProbeStateStale);
+        }
+    }
+    else
+    {
+        ODL_LOG("! (0 < received)"); //####
+        finishPortProbe(probe, kPortProbeStateStale);
+    }
+    ODL_EXIT_B(done); //####
+    return done;
+} // readPortProbeReply
+
+/*! @brief Send the YARP handshake to a port that has accepted a connection.
+
+ A port number can be reused by an unrelated process after a YARP port goes away, so accepting a
+ connection is not enough; the port must also answer as a YARP port. The text form of the
+ handshake is used, as every YARP port understands it and answers with a fixed greeting.
+ @param[in,out] probe The port check to be updated.
+ @param[in] deadline The time by which the port must answer the handshake. */
+static void
+sendPortProbeHandshake(PortProbe &  probe,
+                       const double deadline)
+{
+    ODL_ENTER(); //####
+    ODL_P1("probe = ", &probe); //####
+    ODL_D1("deadline = ", deadline); //####
+    YarpString handshake("CONNECT ");
+    int        flags = 0;
+
+#if defined(MSG_NOSIGNAL)
+    flags = MSG_NOSIGNAL;
+#endif // defined(MSG_NOSIGNAL)
+    handshake += kMagicName;
+    handshake += "\r\n";
+#if MAC_OR_LINUX_
+    ssize_t sent = send(probe._socket, handshake.c_str(), handshake.length(), flags);
+#else // ! MAC_OR_LINUX_
+    int     sent = send(probe._socket, handshake.c_str(), static_cast<int>(handshake.length()),
+                        flags);
+#endif // ! MAC_OR_LINUX_
+
+    // The handshake is much smaller than the send buffer of a new connection, so it is sent at
+    // once or not at all.
+    if (static_cast<size_t>(sent) == handshake.length())
+    {
+        probe._deadline = deadline;
+        probe._reply = "";
+        probe._state = kPortProbeStateHandshake;
+    }
+    else
+    {
+        ODL_LOG("! (static_cast<size_t>(sent) == handshake.length())"); //####
+        finishPortProbe(probe, kPortProbeStateStale);
+    }
+    ODL_EXIT(); //####
+} // sendPortProbeHandshake
+
+/*! @brief Start a non-blocking connection to a port.
+ @param[in,out] probe The port check to be started.
+ @param[in] deadline The time by which the port must accept the connection. */
+static void
+startPortProbe(PortProbe &  probe,
+               const double deadline)
+{
+    ODL_ENTER(); //####
+    ODL_P1("probe = ", &probe); //####
+    ODL_D1("deadline = ", deadline); //####
+    probe._deadline = deadline;
+    probe._socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (INVALID_SOCKET == probe._socket)
+    {
+        ODL_LOG("(INVALID_SOCKET == probe._socket)"); //####
+        probe._state = kPortProbeStateUnchecked;
+    }
+    else
+    {
+        bool inProgress = false;
+        int  res;
+
+#if MAC_OR_LINUX_
+        fcntl(probe._socket, F_SETFL, fcntl(probe._socket, F_GETFL, 0) | O_NONBLOCK);
+        res = connect(probe._socket, reinterpret_cast<struct sockaddr *>(&probe._address),
+                      sizeof(probe._address));
+        inProgress = ((0 != res) && (EINPROGRESS == errno));
+#else // ! MAC_OR_LINUX_
+        u_long nonBlocking = 1;
+
+        ioctlsocket(probe._socket, FIONBIO, &nonBlocking);
+        res = connect(probe._socket, reinterpret_cast<LPSOCKADDR>(&probe._address),
+                      sizeof(probe._address));
+        inProgress = ((SOCKET_ERROR == res) && (WSAEWOULDBLOCK == WSAGetLastError()));
+#endif // ! MAC_OR_LINUX_
+        if (0 == res)
+        {
+            finishPortProbe(probe, kPortProbeStateAlive);
+        }
+        else if (inProgress)
+        {
+            probe._state = kPortProbeStateActive;
+        }
+        else
+        {
+            ODL_LOG("! (inProgress)"); //####
+            finishPortProbe(probe, kPortProbeStateStale);
+        }
+    }
+    ODL_EXIT(); //####
+} // startPortProbe
+
+/*! @brief Check a set of ports concurrently, waiting for each connection to complete or fail.
+
+ Each port that accepts a connection is then sent the YARP handshake on the same socket, so a
+ process that accepts connections but does not answer, such as one that is suspended, takes no
+ more of the sweep than a port that does not accept at all. Ports that have not been checked when
+ the overall time runs out are left unchecked.
+ @param[in,out] probes The ports to be checked.
+ @param[in] probeTime The number of seconds allowed for each port to accept a connection, and
+ again to answer the handshake.
+ @param[in] sweepDeadline The time by which all checks must be complete. */
+static void
+sweepPortProbes(PortProbeVector & probes,
+                const double      probeTime,
+                const double      sweepDeadline)
+{
+    ODL_ENTER(); //####
+    ODL_P1("probes = ", &probes); //####
+    ODL_D2("probeTime = ", probeTime, "sweepDeadline = ", sweepDeadline); //####
+    size_t              nextToStart = 0;
+    std::vector<size_t> active;
+#if MAC_OR_LINUX_
+    std::vector<pollfd> pollSet;
+#else // ! MAC_OR_LINUX_
+    std::vector<WSAPOLLFD> pollSet;
+#endif // ! MAC_OR_LINUX_
+
+    active.reserve(kMaxConcurrentPortProbes);
+    pollSet.reserve(kMaxConcurrentPortProbes);
+    for (double now = yarp::os::Time::now(); now < sweepDeadline; now = yarp::os::Time::now())
+    {
+        // Keep the number of connections in progress bounded, so that the process does not run out
+        // of descriptors on a large name server.
+        for ( ; (probes.size() > nextToStart) && (kMaxConcurrentPortProbes > active.size());
+             ++nextToStart)
+        {
+            PortProbe & probe = probes[nextToStart];
+
+            startPortProbe(probe, std::min(now + probeTime, sweepDeadline));
+            if (kPortProbeStateActive == probe._state)
+            {
+                active.push_back(nextToStart);
+            }
+        }
+        if (active.empty())
+        {
+            break;
+        }
+
+        double earliest = sweepDeadline;
+
+        pollSet.resize(active.size());
+        for (size_t ii = 0, mm = active.size(); mm > ii; ++ii)
+        {
+            PortProbe & probe = probes[active[ii]];
+
+            pollSet[ii].fd = probe._socket;
+            pollSet[ii].events = ((kPortProbeStateActive == probe._state) ? POLLOUT : POLLIN);
+            pollSet[ii].revents = 0;
+            earliest = std::min(earliest, probe._deadline);
+        }
+        int waitTime = static_cast<int>(std::max(0.0, (earliest - now) * 1000.0)) + 1;
+
+#if MAC_OR_LINUX_
+        poll(&pollSet[0], static_cast<nfds_t>(pollSet.size()), waitTime);
+#else // ! MAC_OR_LINUX_
+        WSAPoll(&pollSet[0], static_cast<ULONG>(pollSet.size()), waitTime);
+#endif // ! MAC_OR_LINUX_
+        now = yarp::os::Time::now();
+        size_t kept = 0;
+
+        for (size_t ii = 0, mm = active.size(); mm > ii; ++ii)
+        {
+            PortProbe & probe = probes[active[ii]];
+
+            if (pollSet[ii].revents && (kPortProbeStateActive == probe._state))
+            {
+                int       socketError = 0;
+                socklen_t errorLength = sizeof(socketError);
+
+                // A connection that completed may still have failed, so check how it ended.
+                getsockopt(probe._socket, SOL_SOCKET, SO_ERROR,
+                           reinterpret_cast<char *>(&socketError), &errorLength);
+                if (socketError)
+                {
+                    finishPortProbe(probe, kPortProbeStateStale);
+                }
+                else
+                {
+                    sendPortProbeHandshake(probe, std::min(now + probeTime, sweepDeadline));
+                    if (kPortProbeStateHandshake == probe._state)
+                    {
+                        active[kept++] = active[ii];
+                    }
+                }
+            }
+            else if (pollSet[ii].revents)
+            {
+                if (! readPortProbeReply(probe))
+                {
+                    active[kept++] = active[ii];
+                }
+            }
+            else if (probe._deadline <= now)
+            {
+                // Only a port that had its full time to respond is considered to be stale.
+                finishPortProbe(probe, (probe._deadline < sweepDeadline) ? kPortProbeStateStale :
+                                kPortProbeStateUnchecked);
+            }
+            else
+            {
+                active[kept++] = active[ii];
+            }
+        }
+        active.resize(kept);
+    }
+    // Anything still in progress was cut off by the overall deadline, not by its own timeout.
+    for (size_t ii = 0, mm = active.size(); mm > ii; ++ii)
+    {
+        finishPortProbe(probes[active[ii]], kPortProbeStateUnchecked);
+    }
+    for ( ; probes.size() > nextToStart; ++nextToStart)
+    {
+        probes[nextToStart]._state = kPortProbeStateUnchecked;
+    }
+    ODL_EXIT(); //####
+} // sweepPortProbes
+
+/*! @brief Remove a set of ports from the name server.
+
+ The requests are all sent over one connection to the name server, before any of the answers are
+ read, rather than making a new connection for each port.
+ @param[in] portNames The names of the ports to be removed.
+ @param[in] timeToWait The number of seconds allowed for the name server to answer. */
+static void
+unregisterPortNames(const YarpStringVector & portNames,
+                    const double             timeToWait)
+{
+    ODL_ENTER(); //####
+    ODL_P1("portNames = ", &portNames); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool              sent = false;
+    YarpString        serverName(yarp::os::NetworkBase::getNameServerName());
+    yarp::os::Contact address = yarp::os::Network::queryName(serverName.c_str());
+
+    if (address.isValid() && (0 < portNames.size()))
+    {
+        address.setTimeout(static_cast<float>(timeToWait));
+        yarp::os::OutputProtocol * out = yarp::os::impl::Carriers::connect(address);
+
+        if (out)
+        {
+            yarp::os::Route rr(kMagicName, serverName.c_str(), "text_ack");
+
+            if (out->open(rr))
+            {
+                yarp::os::impl::BufferedConnectionWriter bw(out->getConnection().isTextMode());
+                yarp::os::InputStream &                  is = out->getInputStream();
+                yarp::os::OutputStream &                 os = out->getOutputStream();
+                yarp::os::impl::StreamConnectionReader   reader;
+                size_t                                   answered = 0;
+
+                is.setReadTimeout(timeToWait);
+                os.setWriteTimeout(timeToWait);
+                for (YarpStringVector::const_iterator walker(portNames.begin());
+                     portNames.end() != walker; ++walker)
+                {
+                    yarp::os::Bottle            cmd;
+                    yarp::os::impl::PortCommand pc(0, "d");
+
+                    cmd.addString("unregister");
+                    cmd.addString(*walker);
+                    pc.write(bw);
+                    cmd.write(bw);
+                }
+                bw.write(os);
+                sent = os.isOk();
+                reader.reset(is, NULL, rr, 0, true);
+                // Wait for the name server to answer every request, so that the ports are gone
+                // before the caller goes on.
+                while (sent && (portNames.size() > answered))
+                {
+                    yarp::os::Bottle resp;
+
+                    if (! resp.read(reader))
+                    {
+                        ODL_LOG("(! resp.read(reader))"); //####
+                        break;
+                    }
+
+                    if (resp.get(0).asString() != "<ACK>")
+                    {
+                        ++answered;
+                    }
+                }
+                ODL_LL1("answered = ", answered); //####
+            }
+            else
+            {
+                ODL_LOG("! (out->open(rr))"); //####
+            }
+            delete out;
+        }
+        else
+        {
+            ODL_LOG("! (out)"); //####
+        }
+    }
+    if (! sent)
+    {
+        // Fall back to removing the ports one at a time.
+        for (YarpStringVector::const_iterator walker(portNames.begin());
+             portNames.end() != walker; ++walker)
+        {
+            yarp::os::NetworkBase::unregisterName(*walker);
+        }
+    }
+    ODL_EXIT(); //####
+} // unregisterPortNames
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -1410,12 +2180,13 @@ Utilities::ConvertMessageToJSON(std::stringstream &      outBuffer,
 
 #if defined(MpM_UseCustomStringBuffer)
     outBuffer.reset();
-    outBuffer.addString("{ \"time\" : ");
-    outBuffer.addLong(now).addString(", \"value\" : ");
 #else // ! defined(MpM_UseCustomStringBuffer)
-    outBuffer.seekp(0);
-    outBuffer << "{ \"time\" : " << now << ", \"value\" : ";
+    outBuffer.str("");
+    outBuffer.clear();
 #endif // ! defined(MpM_UseCustomStringBuffer)
+    APPEND_LITERAL_(outBuffer, "{ \"time\" : ");
+    appendLong(outBuffer, now);
+    APPEND_LITERAL_(outBuffer, ", \"value\" : ");
     if (1 == mm)
     {
         processValue(outBuffer, input.get(0));
@@ -1426,17 +2197,9 @@ Utilities::ConvertMessageToJSON(std::stringstream &      outBuffer,
     }
     else
     {
-#if defined(MpM_UseCustomStringBuffer)
-        outBuffer.addString("null");
-#else // ! defined(MpM_UseCustomStringBuffer)
-        outBuffer << "null";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+        APPEND_LITERAL_(outBuffer, "null");
     }
-#if defined(MpM_UseCustomStringBuffer)
-    outBuffer.addString(" }\n");
-#else // ! defined(MpM_UseCustomStringBuffer)
-    outBuffer << " }\n";
-#endif // ! defined(MpM_UseCustomStringBuffer)
+    APPEND_LITERAL_(outBuffer, " }\n");
     ODL_EXIT(); //####
 } // Utilities::ConvertMessageToJSON
 
@@ -1520,56 +2283,186 @@ Utilities::ConvertMetricsToString(const yarp::os::Bottle & metrics,
     {
         yarp::os::Value & aValue(metrics.get(ii));
 
-        if (aValue.isDict())
+        if (aValue.isDict())
+        {
+            yarp::os::Property * propList = aValue.asDict();
+
+            if (propList)
+            {
+                convertMetricPropertyToString(*propList, flavour, channelWidth, sawSome, result);
+            }
+        }
+        else if (aValue.isList())
+        {
+            yarp::os::Bottle * asList = aValue.asList();
+
+            if (asList)
+            {
+                yarp::os::Property propList;
+
+                if (ListIsReallyDictionary(*asList, propList))
+                {
+                    convertMetricPropertyToString(propList, flavour, channelWidth, sawSome, result);
+                }
+            }
+        }
+    }
+    if (kOutputFlavourJSON == flavour)
+    {
+        result << " ]";
+    }
+    ODL_EXIT_s(result.str()); //####
+    return result.str();
+} // Utilities::ConvertMetricsToString
+
+bool
+Utilities::GatherConnectionGraph(const YarpStringVector & portNames,
+                                 PortConnectionsVector &  graph,
+                                 const InputOutputFlag    which,
+                                 const double             timeToWait,
+                                 const size_t             maxConcurrent,
+                                 CheckFunction            checker,
+                                 void *                   checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_P3("portNames = ", &portNames, "graph = ", &graph, "checkStuff = ", checkStuff); //####
+    ODL_L2("which = ", static_cast<int>(which), "maxConcurrent = ", maxConcurrent); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool result = true;
+
+    graph.clear();
+    try
+    {
+        size_t                                numThreads = (maxConcurrent ? maxConcurrent :
+                                                            kDefaultConcurrentConnectionGathers);
+        size_t                                nextPort = 0;
+        yarp::os::Mutex                       portLock;
+        PortConnectionsVector                 snapshot(portNames.size());
+        std::vector<ConnectionGatherThread *> threads;
+
+        for (size_t ii = 0, mm = portNames.size(); mm > ii; ++ii)
         {
-            yarp::os::Property * propList = aValue.asDict();
+            snapshot[ii]._portName = portNames[ii];
+            snapshot[ii]._answered = false;
+        }
+        if (snapshot.size() < numThreads)
+        {
+            numThreads = snapshot.size();
+        }
+        for (size_t ii = 0; numThreads > ii; ++ii)
+        {
+            ConnectionGatherThread * aThread = new ConnectionGatherThread(snapshot, nextPort,
+                                                                          portLock, which,
+                                                                          timeToWait);
 
-            if (propList)
+            if (aThread->start())
             {
-                convertMetricPropertyToString(*propList, flavour, channelWidth, sawSome, result);
+                threads.push_back(aThread);
+            }
+            else
+            {
+                ODL_LOG("! (aThread->start())"); //####
+                delete aThread;
             }
         }
-        else if (aValue.isList())
+        if (threads.empty() && (0 < snapshot.size()))
         {
-            yarp::os::Bottle * asList = aValue.asList();
+            ODL_LOG("(threads.empty() && (0 < snapshot.size()))"); //####
+            // Fall back to inspecting the ports one at a time.
+            for (size_t ii = 0, mm = snapshot.size(); mm > ii; ++ii)
+            {
+                if (checker && checker(checkStuff))
+                {
+                    break;
+                }
 
-            if (asList)
+                PortConnections & aPort = snapshot[ii];
+
+                aPort._answered = GatherPortConnections(aPort._portName, aPort._inputs,
+                                                        aPort._outputs, which, true, checker,
+                                                        checkStuff, timeToWait);
+            }
+        }
+        else
+        {
+            for (bool stopping = false; ; )
             {
-                yarp::os::Property propList;
+                bool stillRunning = false;
 
-                if (ListIsReallyDictionary(*asList, propList))
+                for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
                 {
-                    convertMetricPropertyToString(propList, flavour, channelWidth, sawSome, result);
+                    if (threads[ii]->isRunning())
+                    {
+                        stillRunning = true;
+                    }
+                }
+                if (! stillRunning)
+                {
+                    break;
+                }
+
+                if ((! stopping) && checker && checker(checkStuff))
+                {
+                    // Let the threads finish the ports that they are working on, but no others.
+                    for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+                    {
+                        threads[ii]->askToStop();
+                    }
+                    stopping = true;
                 }
+                ConsumeSomeTime();
+            }
+        }
+        for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+        {
+            threads[ii]->stop();
+            delete threads[ii];
+        }
+        for (size_t ii = 0, mm = snapshot.size(); mm > ii; ++ii)
+        {
+            if (! snapshot[ii]._answered)
+            {
+                result = false;
             }
         }
+        if (kInputAndOutputBoth == which)
+        {
+            reconcileConnectionGraph(snapshot);
+        }
+        graph.swap(snapshot);
     }
-    if (kOutputFlavourJSON == flavour)
+    catch (...)
     {
-        result << " ]";
+        ODL_LOG("Exception caught"); //####
+        throw;
     }
-    ODL_EXIT_s(result.str()); //####
-    return result.str();
-} // Utilities::ConvertMetricsToString
+    ODL_EXIT_B(result); //####
+    return result;
+} // Utilities::GatherConnectionGraph
 
-void
+bool
 Utilities::GatherPortConnections(const YarpString &    portName,
                                  ChannelVector &       inputs,
                                  ChannelVector &       outputs,
                                  const InputOutputFlag which,
                                  const bool            quiet,
                                  CheckFunction         checker,
-                                 void *                checkStuff)
+                                 void *                checkStuff,
+                                 const double          timeToWait)
 {
     ODL_ENTER(); //####
     ODL_S1s("portName = ", portName); //####
     ODL_P3("inputs = ", &inputs, "outputs = ", &outputs, "checkStuff = ", checkStuff); //####
     ODL_L1("which = ", static_cast<int>(which)); //####
     ODL_B1("quiet = ", quiet); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool result = false;
+
     inputs.clear();
     outputs.clear();
     try
     {
+        double            deadline = yarp::os::Time::now() + timeToWait;
         yarp::os::Contact address = yarp::os::Network::queryName(portName.c_str());
 
         if (address.isValid())
@@ -1578,8 +2471,13 @@ Utilities::GatherPortConnections(const YarpString &    portName,
                 (address.getCarrier() == "xmlrpc"))
             {
                 // Note that the following connect() call will hang indefinitely if the address
-                // given is for an 'output' port that is connected to another 'output' port.
-                // 'yarp ping /port' will hang as well.
+                // given is for an 'output' port that is connected to another 'output' port, unless
+                // a time limit has been given. 'yarp ping /port' will hang as well.
+                if (0 < timeToWait)
+                {
+                    address.setTimeout(static_cast<float>(timeToWait));
+                }
+
                 yarp::os::OutputProtocol * out = yarp::os::impl::Carriers::connect(address);
 
                 if (out)
@@ -1596,6 +2494,11 @@ Utilities::GatherPortConnections(const YarpString &    portName,
                         yarp::os::impl::PortCommand              pc(0, "*");
                         yarp::os::impl::StreamConnectionReader   reader;
 
+                        if (0 < timeToWait)
+                        {
+                            is.setReadTimeout(timeToWait);
+                            os.setWriteTimeout(timeToWait);
+                        }
                         pc.write(bw);
                         bw.write(os);
                         reader.reset(is, NULL, rr, 0, true);
@@ -1606,12 +2509,24 @@ Utilities::GatherPortConnections(const YarpString &    portName,
                                 break;
                             }
 
-                            resp.read(reader);
+                            if ((0 < timeToWait) && (deadline < yarp::os::Time::now()))
+                            {
+                                ODL_LOG("((0 < timeToWait) && " //####
+                                        "(deadline < yarp::os::Time::now()))"); //####
+                                break;
+                            }
+
+                            if (! resp.read(reader))
+                            {
+                                ODL_LOG("(! resp.read(reader))"); //####
+                                break;
+                            }
+
                             YarpString checkString(resp.get(0).asString());
 
                             if (checkString == "<ACK>")
                             {
-                                done = true;
+                                done = result = true;
                             }
                             else if (checkString == "There")
                             {
@@ -1654,7 +2569,8 @@ Utilities::GatherPortConnections(const YarpString &    portName,
         ODL_LOG("Exception caught"); //####
         throw;
     }
-    ODL_EXIT(); //####
+    ODL_EXIT_B(result); //####
+    return result;
 } // Utilities::GatherPortConnections
 
 bool
@@ -2317,9 +3233,18 @@ Utilities::GetNameAndDescriptionForService(const YarpString &  serviceChannelNam
                                         {
                                             yarp::os::Bottle * inputChannelAsList =
                                                                                 element.asList();
-
-                                            if (MpM_EXPECTED_CHANNEL_DESCRIPTOR_SIZE_ ==
-                                                                        inputChannelAsList->size())
+                                            int                listSize =
+                                                                        inputChannelAsList->size();
+
+                                            // A channel that uses a multicast group adds the group
+                                            // to its description, and a channel that compresses
+                                            // its messages adds the group and the method.
+                                            if ((MpM_EXPECTED_CHANNEL_DESCRIPTOR_SIZE_ ==
+                                                                                    listSize) ||
+                                                (MpM_MULTICAST_CHANNEL_DESCRIPTOR_SIZE_ ==
+                                                                                    listSize) ||
+                                                (MpM_COMPRESSED_CHANNEL_DESCRIPTOR_SIZE_ ==
+                                                                                    listSize))
                                             {
                                                 yarp::os::Value firstValue =
                                                                         inputChannelAsList->get(0);
@@ -2338,6 +3263,24 @@ Utilities::GetNameAndDescriptionForService(const YarpString &  serviceChannelNam
                                                     aChannel._portMode = kChannelModeOther;
                                                     aChannel._protocolDescription =
                                                                             thirdValue.asString();
+                                                    if (MpM_MULTICAST_CHANNEL_DESCRIPTOR_SIZE_ <=
+                                                                                    listSize)
+                                                    {
+                                                        yarp::os::Value fourthValue =
+                                                                        inputChannelAsList->get(3);
+
+                                                        aChannel._multicastGroup =
+                                                                        fourthValue.toString();
+                                                    }
+                                                    if (MpM_COMPRESSED_CHANNEL_DESCRIPTOR_SIZE_ ==
+                                                                                    listSize)
+                                                    {
+                                                        yarp::os::Value fifthValue =
+                                                                        inputChannelAsList->get(4);
+
+                                                        aChannel._compression =
+                                                                        fifthValue.toString();
+                                                    }
                                                     descriptor._inputChannels.push_back(aChannel);
                                                 }
                                                 else
@@ -2371,9 +3314,18 @@ Utilities::GetNameAndDescriptionForService(const YarpString &  serviceChannelNam
                                         {
                                             yarp::os::Bottle * outputChannelAsList =
                                                                                 element.asList();
-
-                                            if (MpM_EXPECTED_CHANNEL_DESCRIPTOR_SIZE_ ==
-                                                                        outputChannelAsList->size())
+                                            int                listSize =
+                                                                        outputChannelAsList->size();
+
+                                            // A channel that uses a multicast group adds the group
+                                            // to its description, and a channel that compresses
+                                            // its messages adds the group and the method.
+                                            if ((MpM_EXPECTED_CHANNEL_DESCRIPTOR_SIZE_ ==
+                                                                                    listSize) ||
+                                                (MpM_MULTICAST_CHANNEL_DESCRIPTOR_SIZE_ ==
+                                                                                    listSize) ||
+                                                (MpM_COMPRESSED_CHANNEL_DESCRIPTOR_SIZE_ ==
+                                                                                    listSize))
                                             {
                                                 yarp::os::Value firstValue =
                                                                         outputChannelAsList->get(0);
@@ -2392,6 +3344,24 @@ Utilities::GetNameAndDescriptionForService(const YarpString &  serviceChannelNam
                                                     aChannel._portMode = kChannelModeOther;
                                                     aChannel._protocolDescription =
                                                                             thirdValue.asString();
+                                                    if (MpM_MULTICAST_CHANNEL_DESCRIPTOR_SIZE_ <=
+                                                                                    listSize)
+                                                    {
+                                                        yarp::os::Value fourthValue =
+                                                                        outputChannelAsList->get(3);
+
+                                                        aChannel._multicastGroup =
+                                                                        fourthValue.toString();
+                                                    }
+                                                    if (MpM_COMPRESSED_CHANNEL_DESCRIPTOR_SIZE_ ==
+                                                                                    listSize)
+                                                    {
+                                                        yarp::os::Value fifthValue =
+                                                                        outputChannelAsList->get(4);
+
+                                                        aChannel._compression =
+                                                                        fifthValue.toString();
+                                                    }
                                                     descriptor._outputChannels.push_back(aChannel);
                                                 }
                                                 else
@@ -2659,6 +3629,213 @@ Utilities::GetRandomHexString(void)
     return result;
 } // Utilities::GetRandomHexString
 
+bool
+Utilities::GetRoundTripTimes(RoundTripTimeMap & times,
+                             const double       timeToWait,
+                             CheckFunction      checker,
+                             void *             checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_P2("times = ", &times, "checkStuff = ", checkStuff); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool            result = false;
+    YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                               BUILD_NAME_("roundtrips_",
+                                                           DEFAULT_CHANNEL_ROOT_)));
+    ClientChannel * newChannel = new ClientChannel;
+
+    times.clear();
+    if (newChannel)
+    {
+        if (newChannel->openWithRetries(aName, timeToWait))
+        {
+            if (NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_, timeToWait, false,
+                                          checker, checkStuff))
+            {
+                yarp::os::Bottle parameters;
+                ServiceRequest   request(MpM_ROUNDTRIPS_REQUEST_, parameters);
+                ServiceResponse  response;
+
+                if (request.send(*newChannel, response))
+                {
+                    ODL_S1s("response <- ", response.asString()); //####
+                    if (1 == response.count())
+                    {
+                        yarp::os::Value theValue(response.element(0));
+
+                        if (theValue.isList())
+                        {
+                            yarp::os::Bottle * asList = theValue.asList();
+
+                            result = true;
+                            for (int ii = 0, mm = asList->size(); mm > ii; ++ii)
+                            {
+                                yarp::os::Value aPair(asList->get(ii));
+
+                                if (aPair.isList())
+                                {
+                                    yarp::os::Bottle * pairList = aPair.asList();
+
+                                    if ((2 == pairList->size()) && pairList->get(0).isString() &&
+                                        pairList->get(1).isDouble())
+                                    {
+                                        times[pairList->get(0).toString()] =
+                                                                    pairList->get(1).asDouble();
+                                    }
+                                }
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! (theValue.isList())"); //####
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! (1 == response.count())"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (request.send(*newChannel, response))"); //####
+                }
+#if defined(MpM_DoExplicitDisconnect)
+                if (! NetworkDisconnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_, timeToWait,
+                                                   checker, checkStuff))
+                {
+                    ODL_LOG("(! NetworkDisconnectWithRetries(aName, " //####
+                            "MpM_REGISTRY_ENDPOINT_NAME_, timeToWait, checker, " //####
+                            "checkStuff))"); //####
+                }
+#endif // defined(MpM_DoExplicitDisconnect)
+            }
+            else
+            {
+                ODL_LOG("! (NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_, " //####
+                        "timetoWait, false, checker, checkStuff))"); //####
+            }
+#if defined(MpM_DoExplicitClose)
+            newChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+        }
+        else
+        {
+            ODL_LOG("! (newChannel->openWithRetries(aName, timeToWait))"); //####
+        }
+        delete newChannel;
+    }
+    else
+    {
+        ODL_LOG("! (newChannel)"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // Utilities::GetRoundTripTimes
+
+bool
+Utilities::GetServiceInstances(const YarpString & serviceName,
+                               YarpStringVector & channels,
+                               const double       timeToWait,
+                               CheckFunction      checker,
+                               void *             checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("serviceName = ", serviceName); //####
+    ODL_P2("channels = ", &channels, "checkStuff = ", checkStuff); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool            result = false;
+    YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                               BUILD_NAME_("instances_",
+                                                           DEFAULT_CHANNEL_ROOT_)));
+    ClientChannel * newChannel = new ClientChannel;
+
+    channels.clear();
+    if (newChannel)
+    {
+        if (newChannel->openWithRetries(aName, timeToWait))
+        {
+            if (NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_, timeToWait, false,
+                                          checker, checkStuff))
+            {
+                yarp::os::Bottle parameters;
+
+                parameters.addString(serviceName);
+                ServiceRequest  request(MpM_INSTANCES_REQUEST_, parameters);
+                ServiceResponse response;
+
+                if (request.send(*newChannel, response))
+                {
+                    ODL_S1s("response <- ", response.asString()); //####
+                    if (MpM_EXPECTED_INSTANCES_RESPONSE_SIZE_ == response.count())
+                    {
+                        yarp::os::Value theStatus(response.element(0));
+                        yarp::os::Value theValue(response.element(1));
+
+                        if (theStatus.isString() && (theStatus.toString() == MpM_OK_RESPONSE_) &&
+                            theValue.isList())
+                        {
+                            yarp::os::Bottle * asList = theValue.asList();
+
+                            result = true;
+                            for (int ii = 0, mm = asList->size(); mm > ii; ++ii)
+                            {
+                                yarp::os::Value aChannel(asList->get(ii));
+
+                                if (aChannel.isString())
+                                {
+                                    channels.push_back(aChannel.toString());
+                                }
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! (theStatus.isString() && (theStatus.toString() == " //####
+                                    "MpM_OK_RESPONSE_) && theValue.isList())"); //####
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! (MpM_EXPECTED_INSTANCES_RESPONSE_SIZE_ == " //####
+                                "response.count())"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (request.send(*newChannel, response))"); //####
+                }
+#if defined(MpM_DoExplicitDisconnect)
+                if (! NetworkDisconnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_, timeToWait,
+                                                   checker, checkStuff))
+                {
+                    ODL_LOG("(! NetworkDisconnectWithRetries(aName, " //####
+                            "MpM_REGISTRY_ENDPOINT_NAME_, timeToWait, checker, " //####
+                            "checkStuff))"); //####
+                }
+#endif // defined(MpM_DoExplicitDisconnect)
+            }
+            else
+            {
+                ODL_LOG("! (NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_, " //####
+                        "timetoWait, false, checker, checkStuff))"); //####
+            }
+#if defined(MpM_DoExplicitClose)
+            newChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+        }
+        else
+        {
+            ODL_LOG("! (newChannel->openWithRetries(aName, timeToWait))"); //####
+        }
+        delete newChannel;
+    }
+    else
+    {
+        ODL_LOG("! (newChannel)"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // Utilities::GetServiceInstances
+
 bool
 Utilities::GetServiceNames(YarpStringVector & services,
                            const bool         quiet,
@@ -2869,11 +4046,22 @@ Utilities::NetworkConnectWithRetries(const YarpString & sourceName,
             BailOut      bailer(timeToWait);
 #endif // RETRY_LOOPS_USE_TIMEOUTS
             const char * carrier;
+#if defined(MpM_UseSharedMemoryTransport)
+            bool         tryingSharedMemory = false;
+#endif // defined(MpM_UseSharedMemoryTransport)
 
             if (isUDP)
             {
                 carrier = "udp";
             }
+#if defined(MpM_UseSharedMemoryTransport)
+            else if (channelsShareAHost(sourceName, destinationName))
+            {
+                // Both ends are on this machine, so avoid the loopback interface.
+                carrier = "shmem";
+                tryingSharedMemory = true;
+            }
+#endif // defined(MpM_UseSharedMemoryTransport)
             else
             {
                 carrier = "tcp";
@@ -2892,6 +4080,17 @@ Utilities::NetworkConnectWithRetries(const YarpString & sourceName,
                 result = yarp::os::Network::connect(sourceName, destinationName, carrier, true);
 #endif // ! (defined(ODL_ENABLE_LOGGING_) && defined(MpM_LogIncludesYarpTrace))
                 ODL_LOG("connected?"); //####
+#if defined(MpM_UseSharedMemoryTransport)
+                if ((! result) && tryingSharedMemory)
+                {
+                    // The shared memory carrier is not available to one of the ends, so fall
+                    // back to TCP without using up a retry.
+                    ODL_LOG("((! result) && tryingSharedMemory)"); //####
+                    carrier = "tcp";
+                    tryingSharedMemory = false;
+                    continue;
+                }
+#endif // defined(MpM_UseSharedMemoryTransport)
                 if (! result)
                 {
                     if (0 < --retriesLeft)
@@ -3008,6 +4207,44 @@ Utilities::NetworkDisconnectWithRetries(const YarpString & sourceName,
 # pragma warning(pop)
 #endif // ! MAC_OR_LINUX_
 
+bool
+Utilities::PinCurrentThreadToCore(const int core)
+{
+    ODL_ENTER(); //####
+    ODL_LL1("core = ", core); //####
+    bool result = false;
+
+    if (0 <= core)
+    {
+#if defined(__APPLE__)
+        // Mac OS X does not bind threads to cores; threads with different affinity tags are
+        // only encouraged to run on different cores.
+        thread_affinity_policy_data_t policy = { core + 1 };
+
+        result = (KERN_SUCCESS == thread_policy_set(mach_thread_self(), THREAD_AFFINITY_POLICY,
+                                                    reinterpret_cast<thread_policy_t>(&policy),
+                                                    THREAD_AFFINITY_POLICY_COUNT));
+#elif LINUX_
+        if (CPU_SETSIZE > core)
+        {
+            cpu_set_t cores;
+
+            CPU_ZERO(&cores);
+            CPU_SET(core, &cores);
+            result = (0 == pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores));
+        }
+#else // ! LINUX_
+        if ((8 * sizeof(DWORD_PTR)) > static_cast<size_t>(core))
+        {
+            result = (0 != SetThreadAffinityMask(GetCurrentThread(),
+                                                 static_cast<DWORD_PTR>(1) << core));
+        }
+#endif // ! LINUX_
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // Utilities::PinCurrentThreadToCore
+
 bool
 Utilities::ProcessStandardClientOptions(const int          argc,
                                         char * *           argv,
@@ -3337,6 +4574,8 @@ Utilities::RemoveStalePorts(const float timeout)
     ODL_ENTER(); //####
     ODL_D1("timeout = ", timeout); //####
     bool                       okSoFar;
+    double                     probeTime = ((0 <= timeout) ? timeout : kDefaultPortProbeTime);
+    double                     sweepStart = yarp::os::Time::now();
     yarp::os::impl::NameConfig nc;
     yarp::os::impl::String     name = nc.getNamespace();
     yarp::os::Bottle           msg;
@@ -3360,6 +4599,11 @@ Utilities::RemoveStalePorts(const float timeout)
     }
     if (okSoFar)
     {
+        PortProbeVector probes;
+        size_t          numAlive = 0;
+        size_t          numRemoved = 0;
+        size_t          numUnchecked = 0;
+
         for (int ii = 1; reply.size() > ii; ++ii)
         {
             yarp::os::Bottle * entry = reply.get(ii).asList();
@@ -3380,32 +4624,25 @@ Utilities::RemoveStalePorts(const float timeout)
                     else
                     {
                         ODL_LOG("! (cc.getCarrier() == \"mcast\")"); //####
-                        yarp::os::Contact addr = cc;
-
-                        ODL_S1s("Testing at ", addr.toURI()); //####
-                        if (addr.isValid())
+                        ODL_S1s("Testing at ", cc.toURI()); //####
+                        if (cc.isValid())
                         {
-                            if (0 <= timeout)
+                            PortProbe probe;
+
+                            probe._portName = port;
+                            probe._contact = cc;
+                            probe._deadline = 0;
+                            probe._socket = INVALID_SOCKET;
+                            probe._state = kPortProbeStatePending;
+                            if (getPortProbeAddress(probe._address, cc.getHost(), cc.getPort()))
                             {
-                                addr.setTimeout(timeout);
-                            }
-                            yarp::os::OutputProtocol * out =
-                                                            yarp::os::impl::Carriers::connect(addr);
-
-                            if (out)
-                            {
-                                delete out;
+                                probes.push_back(probe);
                             }
                             else
                             {
-                                ODL_LOG("No response, removing port."); //####
-                                char buffer1[DATE_TIME_BUFFER_SIZE_];
-                                char buffer2[DATE_TIME_BUFFER_SIZE_];
-
-                                GetDateAndTime(buffer1, sizeof(buffer1), buffer2, sizeof(buffer2));
-                                yarp::os::NetworkBase::unregisterName(port);
-                                cerr << buffer1 << " " << buffer2 << " Removing stale port '" <<
-                                        port.c_str() << "'." << endl;
+                                ODL_LOG("! (getPortProbeAddress(probe._address, " //####
+                                        "cc.getHost(), cc.getPort()))"); //####
+                                ++numUnchecked;
                             }
                         }
                     }
@@ -3416,6 +4653,40 @@ Utilities::RemoveStalePorts(const float timeout)
                 }
             }
         }
+        // Check all the ports at once, rather than one after another, so that the sweep takes about
+        // one timeout interval no matter how many ports are not responding.
+        sweepPortProbes(probes, probeTime, sweepStart + (2 * probeTime));
+        double           sweepTime = yarp::os::Time::now() - sweepStart;
+        YarpStringVector staleNames;
+
+        for (PortProbeVector::const_iterator walker(probes.begin()); probes.end() != walker;
+             ++walker)
+        {
+            if (kPortProbeStateAlive == walker->_state)
+            {
+                ++numAlive;
+            }
+            else if (kPortProbeStateStale == walker->_state)
+            {
+                ODL_LOG("No response, removing port."); //####
+                char buffer1[DATE_TIME_BUFFER_SIZE_];
+                char buffer2[DATE_TIME_BUFFER_SIZE_];
+
+                GetDateAndTime(buffer1, sizeof(buffer1), buffer2, sizeof(buffer2));
+                staleNames.push_back(walker->_portName);
+                cerr << buffer1 << " " << buffer2 << " Removing stale port '" <<
+                        walker->_portName.c_str() << "'." << endl;
+                ++numRemoved;
+            }
+            else
+            {
+                ++numUnchecked;
+            }
+        }
+        unregisterPortNames(staleNames, probeTime);
+        cerr << "Checked " << (numAlive + numRemoved + numUnchecked) << " ports in " <<
+                sweepTime << " seconds; " << numAlive << " responded, " << numRemoved <<
+                " removed, " << numUnchecked << " not checked." << endl;
     }
     ODL_LOG("Giving name server a chance to do garbage collection."); //####
     YarpString       serverName = yarp::os::NetworkBase::getNameServerName();
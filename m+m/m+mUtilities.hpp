@@ -164,9 +164,33 @@ namespace MplusM
 
         }; // ServiceDescriptor
 
+        /*! @brief The connections of a port, as seen when gathering a connection graph. */
+        struct PortConnections
+        {
+            /*! @brief The registered name of the port. */
+            YarpString _portName;
+
+            /*! @brief The input connections for the port. */
+            Common::ChannelVector _inputs;
+
+            /*! @brief The output connections for the port. */
+            Common::ChannelVector _outputs;
+
+            /*! @brief @c true if the port reported its connections in time and @c false
+             otherwise. */
+            bool _answered;
+
+        }; // PortConnections
+
+        /*! @brief A set of port connections, in the same order as the ports were requested. */
+        typedef std::vector<PortConnections> PortConnectionsVector;
+
         /*! @brief A set of port descriptions. */
         typedef std::vector<PortDescriptor> PortVector;
 
+        /*! @brief A mapping from service channels to round-trip times. */
+        typedef std::map<YarpString, double> RoundTripTimeMap;
+
         /*! @brief Add a connection between two ports.
          @param[in] fromPortName The name of the source port.
          @param[in] toPortName The name of the destination port.
@@ -240,6 +264,30 @@ namespace MplusM
         ConvertMetricsToString(const yarp::os::Bottle &    metrics,
                                const Common::OutputFlavour flavour = Common::kOutputFlavourNormal);
 
+        /*! @brief Collect the input and output connections for a set of ports.
+
+         The ports are inspected concurrently, by a bounded number of threads, and the result is
+         only filled in once every port has answered or run out of time. When both inputs and
+         outputs are gathered, a connection that is reported by only one of two ports that both
+         answered is dropped, as it was made or broken while the ports were being inspected.
+         @param[in] portNames The ports to be inspected.
+         @param[out] graph The connections for each port, in the same order as the port names.
+         @param[in] which A flag to specify what is to be gathered.
+         @param[in] timeToWait The number of seconds allowed for each port.
+         @param[in] maxConcurrent The maximum number of ports to be inspected at the same time;
+         if zero, a default is used.
+         @param[in] checker A function that provides for early exit from loops.
+         @param[in] checkStuff The private data for the early exit function.
+         @returns @c true if every port answered and @c false otherwise. */
+        bool
+        GatherConnectionGraph(const YarpStringVector & portNames,
+                              PortConnectionsVector &  graph,
+                              const InputOutputFlag    which,
+                              const double             timeToWait,
+                              const size_t             maxConcurrent = 0,
+                              Common::CheckFunction    checker = NULL,
+                              void *                   checkStuff = NULL);
+
         /*! @brief Collect the input and output connections for a port.
          @param[in] portName The port to be inspected.
          @param[out] inputs The collected inputs for the port.
@@ -247,15 +295,19 @@ namespace MplusM
          @param[in] which A flag to specify what is to be gathered.
          @param[in] quiet @c true if status output is to be suppressed and @c false otherwise.
          @param[in] checker A function that provides for early exit from loops.
-         @param[in] checkStuff The private data for the early exit function. */
-        void
+         @param[in] checkStuff The private data for the early exit function.
+         @param[in] timeToWait The number of seconds allowed for the port to answer; if not
+         positive, there is no limit.
+         @returns @c true if the port reported all of its connections and @c false otherwise. */
+        bool
         GatherPortConnections(const YarpString &      portName,
                               Common::ChannelVector & inputs,
                               Common::ChannelVector & outputs,
                               const InputOutputFlag   which,
                               const bool              quiet = false,
                               Common::CheckFunction   checker = NULL,
-                              void *                  checkStuff = NULL);
+                              void *                  checkStuff = NULL,
+                              const double            timeToWait = 0);
 
         /*! @brief Retrieve the configuration values for a service.
          @param[in] serviceChannelName The channel for the service.
@@ -399,6 +451,34 @@ namespace MplusM
         YarpString
         GetRandomHexString(void);
 
+        /*! @brief Retrieve the most recent round-trip times recorded by the %Registry Service.
+         @param[out] times The round-trip times, in seconds, for each service channel.
+         @param[in] timeToWait The number of seconds allowed before a failure is considered.
+         @param[in] checker A function that provides for early exit from loops.
+         @param[in] checkStuff The private data for the early exit function.
+         @returns @c true if the %Registry Service returned the desired information and @c false
+         otherwise. */
+        bool
+        GetRoundTripTimes(RoundTripTimeMap &    times,
+                          const double          timeToWait,
+                          Common::CheckFunction checker = NULL,
+                          void *                checkStuff = NULL);
+
+        /*! @brief Retrieve the channels of the services registered under a canonical name.
+         @param[in] serviceName The canonical name shared by the instances of the service.
+         @param[out] channels The service channels, in a stable order.
+         @param[in] timeToWait The number of seconds allowed before a failure is considered.
+         @param[in] checker A function that provides for early exit from loops.
+         @param[in] checkStuff The private data for the early exit function.
+         @returns @c true if the %Registry Service returned the desired information and @c false
+         otherwise. */
+        bool
+        GetServiceInstances(const YarpString &    serviceName,
+                            YarpStringVector &    channels,
+                            const double          timeToWait,
+                            Common::CheckFunction checker = NULL,
+                            void *                checkStuff = NULL);
+
         /*! @brief Retrieve the set of known services.
          @param[out] services The set of registered services.
          @param[in] quiet @c true if status output is to be suppressed and @c false otherwise.
@@ -445,6 +525,8 @@ namespace MplusM
         MapStringToServiceKind(const YarpString & kindString);
 
         /*! @brief Connect two channels, using a backoff strategy with retries.
+         If both channels are on the same host, a shared memory connection is tried first, falling
+         back to TCP if that fails.
          @param[in] sourceName The name of the source channel.
          @param[in] destinationName The name of the destination channel.
          @param[in] timeToWait The number of seconds allowed before a failure is considered.
@@ -474,6 +556,16 @@ namespace MplusM
                                      Common::CheckFunction checker = NULL,
                                      void *                checkStuff = NULL);
 
+        /*! @brief Bind the calling thread to a processor core.
+
+         On Mac OS X, this is only a hint to the scheduler to keep the thread apart from threads
+         that were given different cores.
+         @param[in] core The zero-origin index of the core, or a negative number to leave the
+         thread unbound.
+         @returns @c true if the thread was bound to the core and @c false otherwise. */
+        bool
+        PinCurrentThreadToCore(const int core);
+
         /*! @brief Return @c true if the port name is for the %Registry Service.
          @param[in] portName the name of the port.
          @returns @c true if the port name is for the %Registry Service main port. */
@@ -558,7 +650,11 @@ namespace MplusM
                          void *                checkStuff = NULL);
 
         /*! @brief Remove any ports that YARP considers to be stale.
-         @param[in] timeout The number of seconds to allow YARP to check a port. */
+
+         The ports are checked concurrently, so the time taken does not depend on the number of
+         ports that do not respond.
+         @param[in] timeout The number of seconds to allow for each port to accept a
+         connection. */
         void
         RemoveStalePorts(const float timeout = 5);
 